@@ -0,0 +1,81 @@
+# Generates the compiled SIGPAC municipality name table from its JSON source.
+#
+# Usage: cmake -DINPUT=<municipality_data.json> -DOUTPUT=<municipalitytable.cpp> -P GenerateMunicipalityTable.cmake
+#
+# The JSON maps province codes to objects mapping municipality codes to names. Each province
+# is emitted as a single string blob of concatenated UTF-8 names alongside an array of
+# (municipality code, name length, name offset) entries sorted by municipality code, so the
+# whole table ends up in read-only data without any parsing at runtime.
+
+if(NOT INPUT OR NOT OUTPUT)
+  message(FATAL_ERROR "INPUT and OUTPUT must be defined")
+endif()
+
+file(READ "${INPUT}" _json)
+string(JSON _province_count LENGTH "${_json}")
+
+set(_provinces)
+math(EXPR _last_province "${_province_count} - 1")
+foreach(_i RANGE ${_last_province})
+  string(JSON _province MEMBER "${_json}" ${_i})
+  list(APPEND _provinces ${_province})
+endforeach()
+list(SORT _provinces COMPARE NATURAL)
+list(GET _provinces -1 _max_province)
+
+set(_content "// Generated from municipality_data.json by GenerateMunicipalityTable.cmake, do not edit.\n\n")
+string(APPEND _content "#include \"municipalitytable_p.h\"\n\n")
+
+set(_total_entries 0)
+foreach(_province ${_provinces})
+  string(JSON _municipalities GET "${_json}" ${_province})
+  string(JSON _municipality_count LENGTH "${_municipalities}")
+
+  set(_codes)
+  math(EXPR _last_municipality "${_municipality_count} - 1")
+  foreach(_j RANGE ${_last_municipality})
+    string(JSON _code MEMBER "${_municipalities}" ${_j})
+    list(APPEND _codes ${_code})
+  endforeach()
+  list(SORT _codes COMPARE NATURAL)
+
+  set(_names "")
+  set(_entries "")
+  set(_offset 0)
+  foreach(_code ${_codes})
+    string(JSON _name GET "${_municipalities}" ${_code})
+    # string(LENGTH) counts bytes, which is what the offsets into the UTF-8 blob need
+    string(LENGTH "${_name}" _length)
+    string(REPLACE "\\" "\\\\" _escaped "${_name}")
+    string(REPLACE "\"" "\\\"" _escaped "${_escaped}")
+    string(APPEND _names "  \"${_escaped}\"\n")
+    string(APPEND _entries "  { ${_code}, ${_length}, ${_offset} },\n")
+    math(EXPR _offset "${_offset} + ${_length}")
+  endforeach()
+  math(EXPR _total_entries "${_total_entries} + ${_municipality_count}")
+
+  string(APPEND _content "static const char sNames${_province}[] =\n${_names};\n\n")
+  string(APPEND _content "static const MunicipalityTableEntry sEntries${_province}[] = {\n${_entries}};\n\n")
+endforeach()
+
+string(APPEND _content "const MunicipalityTableProvince sMunicipalityTableProvinces[] = {\n")
+foreach(_province RANGE ${_max_province})
+  list(FIND _provinces ${_province} _found)
+  if(_found EQUAL -1)
+    string(APPEND _content "  { nullptr, nullptr, 0 },\n")
+  else()
+    string(APPEND _content "  { sNames${_province}, sEntries${_province}, static_cast<int>( std::size( sEntries${_province} ) ) },\n")
+  endif()
+endforeach()
+string(APPEND _content "};\n\n")
+string(APPEND _content "const int sMunicipalityTableProvinceCount = static_cast<int>( std::size( sMunicipalityTableProvinces ) );\n")
+
+# Only touch the output when the table changed to avoid needless rebuilds
+if(EXISTS "${OUTPUT}")
+  file(READ "${OUTPUT}" _previous)
+  if(_previous STREQUAL _content)
+    return()
+  endif()
+endif()
+file(WRITE "${OUTPUT}" "${_content}")
+message(STATUS "Generated ${_total_entries} municipality names into ${OUTPUT}")
@@ -369,6 +369,11 @@ void AppInterface::clearProject() const
   mApp->clearProject();
 }
 
+bool AppInterface::restoreProjectBackup( ProjectBackupManager *backupManager, const QString &backupPath ) const
+{
+  return mApp->restoreProjectBackup( backupManager, backupPath );
+}
+
 void AppInterface::importUrl( const QString &url )
 {
   QString sanitizedUrl = url.trimmed();
@@ -18,6 +18,8 @@
 #ifndef APPINTERFACE_H
 #define APPINTERFACE_H
 
+#include "projectbackupmanager.h"
+
 #include <QObject>
 #include <QPointF>
 #include <QQmlComponent>
@@ -104,6 +106,12 @@ class AppInterface : public QObject
      */
     Q_INVOKABLE void clearProject() const;
 
+    /**
+     * Restores the backup at \a backupPath over the currently opened project, which is closed
+     * while its files are replaced and reopened afterwards.
+     */
+    Q_INVOKABLE bool restoreProjectBackup( ProjectBackupManager *backupManager, const QString &backupPath ) const;
+
     /**
      * Returns the item matching the provided object \a name
      */
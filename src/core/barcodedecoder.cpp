@@ -20,49 +20,33 @@
 
 #include <ZXing/ReadBarcode.h>
 
-class BarcodeDecoderThread : public QThread
-{
-  public:
-    explicit BarcodeDecoderThread( BarcodeDecoder *decoder, const QImage &image )
-      : QThread()
-      , mDecoder( decoder )
-      , mImage( image )
-    {
-    }
-
-  private:
-    void run() override
-    {
-      if ( mDecoder )
-      {
-        mDecoder->decodeImage( mImage );
-      }
-    }
-
-    BarcodeDecoder *mDecoder = nullptr;
-    QImage mImage;
-};
+#include <algorithm>
 
-BarcodeDecoder::BarcodeDecoder( QObject *parent )
-  : QObject( parent )
-{
-}
-
-void BarcodeDecoder::clearDecodedString()
+namespace
 {
-  if ( mDecodedString.isEmpty() )
+  QString decodeView( const ZXing::ImageView &imageView )
   {
-    return;
-  }
+#if ZXing_VERSION_MAJOR >= 2
+    ZXing::ReaderOptions options;
+    options.setFormats( ZXing::BarcodeFormat::Any );
+    options.setTryRotate( true );
 
-  mDecodedString.clear();
+    ZXing::Result result = ZXing::ReadBarcode( imageView, options );
+    const std::string text = result.text();
+    return QString::fromStdString( text.c_str() );
+#else
+    ZXing::DecodeHints hints;
+    hints.setFormats( ZXing::BarcodeFormat::Any );
+    hints.setTryRotate( true );
 
-  emit decodedStringChanged();
-}
+    ZXing::Result result = ZXing::ReadBarcode( imageView, hints );
+    const std::wstring text = result.text();
+    return QString::fromWCharArray( text.c_str() );
+#endif
+  }
 
-void BarcodeDecoder::decodeImage( const QImage &image )
-{
-  auto imageFormatFromQImage = []( const QImage &img ) {
+  ZXing::ImageFormat imageFormatFromQImage( const QImage &img )
+  {
     switch ( img.format() )
     {
       case QImage::Format_ARGB32:
@@ -70,7 +54,7 @@ void BarcodeDecoder::decodeImage( const QImage &image )
 #if Q_BYTE_ORDER == Q_LITTLE_ENDIAN
         return ZXing::ImageFormat::BGRX;
 #else
-        return ImageFormat::XRGB;
+        return ZXing::ImageFormat::XRGB;
 #endif
       case QImage::Format_RGB888:
         return ZXing::ImageFormat::RGB;
@@ -82,38 +66,174 @@ void BarcodeDecoder::decodeImage( const QImage &image )
       default:
         return ZXing::ImageFormat::None;
     }
-  };
+  }
 
-  ZXing::ImageFormat imageFormat = imageFormatFromQImage( image );
-  if ( imageFormat != ZXing::ImageFormat::None )
+  QString decodeImageRegion( const QImage &image, const QRect &region )
   {
-    ZXing::ImageView imageView( image.bits(), image.width(), image.height(), imageFormat, static_cast<int>( image.bytesPerLine() ) );
+    const ZXing::ImageFormat imageFormat = imageFormatFromQImage( image );
+    if ( imageFormat == ZXing::ImageFormat::None )
+      return QString();
 
-#if ZXing_VERSION_MAJOR >= 2
-    ZXing::ReaderOptions options;
-    options.setFormats( ZXing::BarcodeFormat::Any );
-    options.setTryRotate( true );
+    const int pixelStride = image.depth() / 8;
+    const uchar *data = image.constBits() + region.top() * image.bytesPerLine() + region.left() * pixelStride;
+    return decodeView( ZXing::ImageView( data, region.width(), region.height(), imageFormat, static_cast<int>( image.bytesPerLine() ), pixelStride ) );
+  }
 
-    ZXing::Result result = ZXing::ReadBarcode( imageView, options );
-    const std::string text = result.text();
-    QString resultText = QString::fromStdString( text.c_str() );
-#else
-    ZXing::DecodeHints hints;
-    hints.setFormats( ZXing::BarcodeFormat::Any );
-    hints.setTryRotate( true );
+  //! Returns the pixels of an image of a given \a size covered by a \a region normalized to that size, the whole image if none
+  QRect pixelRegion( const QRectF &region, const QSize &size )
+  {
+    const QRect rect( QPoint( 0, 0 ), size );
+    const QRect pixels = QRectF( region.x() * size.width(), region.y() * size.height(), region.width() * size.width(), region.height() * size.height() )
+                           .toAlignedRect()
+                           .intersected( rect );
+    return pixels.isEmpty() ? rect : pixels;
+  }
+} // namespace
 
-    ZXing::Result result = ZXing::ReadBarcode( imageView, hints );
-    const std::wstring text = result.text();
-    QString resultText = QString::fromWCharArray( text.c_str() );
+QString BarcodeDecoder::decodeFrame( const QVideoFrame &videoFrame, const QRectF &regionOfInterest )
+{
+  QVideoFrame frame = videoFrame;
+
+  // The region is given as displayed, frames may be stored mirrored or rotated
+  QRectF bufferRegion = regionOfInterest;
+  if ( frame.mirrored() )
+    bufferRegion.moveLeft( 1 - bufferRegion.right() );
+#if QT_VERSION >= QT_VERSION_CHECK( 6, 7, 0 )
+  const int rotation = static_cast<int>( frame.rotation() );
+#else
+  const int rotation = static_cast<int>( frame.rotationAngle() );
 #endif
-    if ( !resultText.isEmpty() && mDecodedString != resultText )
-    {
-      mDecodedString = resultText;
-      emit decodedStringChanged();
-    }
+  switch ( rotation )
+  {
+    case 90:
+      bufferRegion = QRectF( bufferRegion.y(), 1 - bufferRegion.right(), bufferRegion.height(), bufferRegion.width() );
+      break;
+    case 180:
+      bufferRegion = QRectF( 1 - bufferRegion.right(), 1 - bufferRegion.bottom(), bufferRegion.width(), bufferRegion.height() );
+      break;
+    case 270:
+      bufferRegion = QRectF( 1 - bufferRegion.bottom(), bufferRegion.x(), bufferRegion.height(), bufferRegion.width() );
+      break;
+    default:
+      break;
   }
 
-  return;
+  const QRect region = pixelRegion( bufferRegion, frame.size() );
+
+  ZXing::ImageFormat imageFormat = ZXing::ImageFormat::None;
+  int pixelStride = 1;
+  int byteOffset = 0;
+  switch ( frame.pixelFormat() )
+  {
+    case QVideoFrameFormat::Format_NV12:
+    case QVideoFrameFormat::Format_NV21:
+    case QVideoFrameFormat::Format_IMC1:
+    case QVideoFrameFormat::Format_IMC2:
+    case QVideoFrameFormat::Format_IMC3:
+    case QVideoFrameFormat::Format_IMC4:
+    case QVideoFrameFormat::Format_YUV420P:
+    case QVideoFrameFormat::Format_YUV422P:
+    case QVideoFrameFormat::Format_YV12:
+    case QVideoFrameFormat::Format_Y8:
+      imageFormat = ZXing::ImageFormat::Lum;
+      break;
+    case QVideoFrameFormat::Format_P010:
+    case QVideoFrameFormat::Format_P016:
+    case QVideoFrameFormat::Format_Y16:
+      // Keep the most significant byte of 16-bit luminance samples
+      imageFormat = ZXing::ImageFormat::Lum;
+      pixelStride = 2;
+      byteOffset = Q_BYTE_ORDER == Q_LITTLE_ENDIAN ? 1 : 0;
+      break;
+    case QVideoFrameFormat::Format_UYVY:
+      imageFormat = ZXing::ImageFormat::Lum;
+      pixelStride = 2;
+      byteOffset = 1;
+      break;
+    case QVideoFrameFormat::Format_YUYV:
+      imageFormat = ZXing::ImageFormat::Lum;
+      pixelStride = 2;
+      break;
+    case QVideoFrameFormat::Format_ARGB8888:
+    case QVideoFrameFormat::Format_ARGB8888_Premultiplied:
+    case QVideoFrameFormat::Format_XRGB8888:
+      imageFormat = ZXing::ImageFormat::XRGB;
+      pixelStride = 4;
+      break;
+    case QVideoFrameFormat::Format_BGRA8888:
+    case QVideoFrameFormat::Format_BGRA8888_Premultiplied:
+    case QVideoFrameFormat::Format_BGRX8888:
+      imageFormat = ZXing::ImageFormat::BGRX;
+      pixelStride = 4;
+      break;
+    case QVideoFrameFormat::Format_ABGR8888:
+    case QVideoFrameFormat::Format_XBGR8888:
+      imageFormat = ZXing::ImageFormat::XBGR;
+      pixelStride = 4;
+      break;
+    case QVideoFrameFormat::Format_RGBA8888:
+    case QVideoFrameFormat::Format_RGBX8888:
+      imageFormat = ZXing::ImageFormat::RGBX;
+      pixelStride = 4;
+      break;
+    default:
+      break;
+  }
+
+  if ( imageFormat == ZXing::ImageFormat::None )
+  {
+    // Converted images are already rotated and mirrored as displayed
+    const QImage image = frame.toImage().convertToFormat( QImage::Format_Grayscale8 );
+    return image.isNull() ? QString() : decodeImageRegion( image, pixelRegion( regionOfInterest, image.size() ) );
+  }
+
+  if ( !frame.map( QVideoFrame::ReadOnly ) )
+    return QString();
+
+  const int bytesPerLine = frame.bytesPerLine( 0 );
+  const uchar *data = frame.bits( 0 ) + byteOffset + region.top() * bytesPerLine + region.left() * pixelStride;
+  const QString text = decodeView( ZXing::ImageView( data, region.width(), region.height(), imageFormat, bytesPerLine, pixelStride ) );
+  frame.unmap();
+  return text;
+}
+
+BarcodeDecoder::BarcodeDecoder( QObject *parent )
+  : QObject( parent )
+{
+  // A single worker thread is kept alive for as long as the decoder exists
+  mThreadPool.setMaxThreadCount( 1 );
+  mThreadPool.setExpiryTimeout( -1 );
+}
+
+BarcodeDecoder::~BarcodeDecoder()
+{
+  mThreadPool.waitForDone();
+}
+
+void BarcodeDecoder::clearDecodedString()
+{
+  setDecodedString( QString() );
+}
+
+void BarcodeDecoder::setDecodedString( const QString &decodedString )
+{
+  if ( mDecodedString == decodedString )
+  {
+    return;
+  }
+
+  mDecodedString = decodedString;
+
+  emit decodedStringChanged();
+}
+
+void BarcodeDecoder::decodeImage( const QImage &image )
+{
+  const QString resultText = decodeImageRegion( image, image.rect() );
+  if ( !resultText.isEmpty() )
+  {
+    setDecodedString( resultText );
+  }
 }
 
 QVideoSink *BarcodeDecoder::videoSink() const
@@ -135,21 +255,42 @@ void BarcodeDecoder::setVideoSink( QVideoSink *sink )
   emit videoSinkChanged();
 }
 
+void BarcodeDecoder::setRegionOfInterest( const QRectF &regionOfInterest )
+{
+  if ( mRegionOfInterest == regionOfInterest )
+    return;
+
+  mRegionOfInterest = regionOfInterest;
+
+  emit regionOfInterestChanged();
+}
+
 void BarcodeDecoder::decodeVideoFrame( const QVideoFrame &frame )
 {
-  if ( mDecodingThread || !frame.isValid() )
+  if ( mDecoding || !frame.isValid() )
     return;
 
-  QImage image = frame.toImage();
-  if ( !image.isNull() && image.format() != QImage::Format_ARGB32 )
-  {
-    image = image.convertToFormat( QImage::Format_ARGB32 );
-  }
+  // Leave the worker idle about as long as decoding takes
+  const qint64 frameInterval = std::clamp( static_cast<qint64>( 2 * mAverageDecodingTime ), MinimumFrameInterval, MaximumFrameInterval );
+  if ( mFrameTimer.isValid() && mFrameTimer.elapsed() < frameInterval )
+    return;
+
+  mFrameTimer.start();
+  mDecoding = true;
+
+  // Video frames are explicitly shared, the worker reads the very same buffer
+  mThreadPool.start( [this, frame, regionOfInterest = mRegionOfInterest] {
+    QElapsedTimer timer;
+    timer.start();
+    const QString resultText = decodeFrame( frame, regionOfInterest );
+    const qint64 decodingTime = timer.elapsed();
 
-  mDecodingThread = new BarcodeDecoderThread( this, image );
-  connect( mDecodingThread, &QThread::finished, this, [=] {
-    mDecodingThread->deleteLater();
-    mDecodingThread = nullptr;
+    QMetaObject::invokeMethod( this, [this, resultText, decodingTime] {
+        mDecoding = false;
+        mAverageDecodingTime = mAverageDecodingTime > 0 ? 0.8 * mAverageDecodingTime + 0.2 * decodingTime : decodingTime;
+        if ( !resultText.isEmpty() )
+        {
+          setDecodedString( resultText );
+        } }, Qt::QueuedConnection );
   } );
-  mDecodingThread->start();
 }
@@ -17,13 +17,22 @@
 #ifndef BARCODEDECODER_H
 #define BARCODEDECODER_H
 
+#include <QElapsedTimer>
 #include <QImage>
 #include <QObject>
 #include <QPointer>
-#include <QThread>
+#include <QRectF>
+#include <QThreadPool>
 #include <QVideoSink>
 
 /**
+ * \brief Decodes barcodes from still images and video frames.
+ *
+ * Video frames are decoded one at a time on a persistent worker thread, straight from
+ * their luminance plane or pixels when their format allows it, and cropped to a region
+ * of interest. Frames arriving while the worker is busy are skipped, and the interval
+ * between decoded frames adapts to the time decoding takes so that the worker stays idle
+ * about half of the time.
  * \ingroup core
  */
 class BarcodeDecoder : public QObject
@@ -33,8 +42,15 @@ class BarcodeDecoder : public QObject
     Q_PROPERTY( QVideoSink *videoSink READ videoSink WRITE setVideoSink NOTIFY videoSinkChanged )
     Q_PROPERTY( QString decodedString READ decodedString NOTIFY decodedStringChanged )
 
+    /**
+     * The region of video frames scanned for barcodes, in coordinates normalized to the
+     * frame size as displayed, i.e. once rotated and mirrored. Defaults to the whole frame.
+     */
+    Q_PROPERTY( QRectF regionOfInterest READ regionOfInterest WRITE setRegionOfInterest NOTIFY regionOfInterestChanged )
+
   public:
     explicit BarcodeDecoder( QObject *parent = nullptr );
+    ~BarcodeDecoder() override;
 
     /**
      * Returns the last barcode decoded string.
@@ -54,18 +70,44 @@ class BarcodeDecoder : public QObject
     QVideoSink *videoSink() const;
     void setVideoSink( QVideoSink *sink );
 
+    //! \copydoc BarcodeDecoder::regionOfInterest
+    QRectF regionOfInterest() const { return mRegionOfInterest; }
+
+    //! \copydoc BarcodeDecoder::regionOfInterest
+    void setRegionOfInterest( const QRectF &regionOfInterest );
+
+    /**
+     * Scans the \a regionOfInterest of a video \a frame for barcodes and returns the decoded
+     * string, or an empty string if none. Planar and semi-planar YUV frames are read from
+     * their luminance plane, packed YUV frames by skipping their chrominance bytes, and 32-bit
+     * RGB frames as is. Other formats go through a grayscale conversion.
+     */
+    static QString decodeFrame( const QVideoFrame &frame, const QRectF &regionOfInterest = QRectF( 0, 0, 1, 1 ) );
+
   public slots:
     void decodeVideoFrame( const QVideoFrame &frame );
 
   signals:
     void decodedStringChanged();
     void videoSinkChanged();
+    void regionOfInterestChanged();
 
   private:
-    QImage mImage;
+    //! Shortest interval in milliseconds between the start of two frame decodings
+    static constexpr qint64 MinimumFrameInterval = 40;
+    //! Longest interval in milliseconds between the start of two frame decodings
+    static constexpr qint64 MaximumFrameInterval = 1000;
+
+    void setDecodedString( const QString &decodedString );
+
     QString mDecodedString;
-    QThread *mDecodingThread = nullptr;
     QPointer<QVideoSink> mVideoSink;
+    QRectF mRegionOfInterest = QRectF( 0, 0, 1, 1 );
+
+    QThreadPool mThreadPool;
+    bool mDecoding = false;
+    QElapsedTimer mFrameTimer;
+    double mAverageDecodingTime = 0;
 };
 
 #endif // BARCODEDECODER_H
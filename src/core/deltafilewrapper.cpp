@@ -20,9 +20,11 @@
 #include "utils/fileutils.h"
 
 
+#include <QDataStream>
 #include <QDebug>
 #include <QFile>
 #include <QFileInfo>
+#include <QSaveFile>
 #include <QUuid>
 #include <qgsmessagelog.h>
 #include <qgsproject.h>
@@ -40,6 +42,28 @@ Q_GLOBAL_STATIC( CacheAttachmentFieldNamesMap, sCacheAttachmentFieldNames );
  */
 Q_GLOBAL_STATIC( QSet<QString>, sFileLocks );
 
+/**
+ * Magic number identifying a delta journal file ("QFDJ").
+ */
+static const quint32 sJournalMagic = 0x5146444A;
+
+/**
+ * Name of the JSON snapshot property holding the journal generation the snapshot is paired with.
+ */
+static const QString sJournalGenerationKey = QStringLiteral( "journalGeneration" );
+
+namespace
+{
+  QByteArray journalHeader( quint32 generation )
+  {
+    QByteArray header;
+    QDataStream stream( &header, QIODevice::WriteOnly );
+    stream.setVersion( QDataStream::Qt_6_0 );
+    stream << sJournalMagic << generation;
+    return header;
+  }
+} // namespace
+
 
 DeltaFileWrapper::DeltaFileWrapper( const QgsProject *project, const QString &fileName )
   : mProject( project )
@@ -123,6 +147,11 @@ DeltaFileWrapper::DeltaFileWrapper( const QgsProject *project, const QString &fi
 
         mDeltas.append( v );
       }
+
+      mJournalGeneration = static_cast<quint32>( mJsonRoot.value( sJournalGenerationKey ).toInteger() );
+      mJsonRoot.remove( sJournalGenerationKey );
+
+      replayJournal();
     }
   }
   else if ( mErrorType == DeltaFileWrapper::ErrorTypes::NoError )
@@ -137,8 +166,10 @@ DeltaFileWrapper::DeltaFileWrapper( const QgsProject *project, const QString &fi
       mErrorType = DeltaFileWrapper::ErrorTypes::IOError;
       mErrorDetails = deltaFile.errorString();
     }
+    deltaFile.close();
 
     // toFile() modifies mErrorType and mErrorDetails, that's why we ignore the boolean return
+    mNeedsCompaction = true;
     toFile();
   }
   else
@@ -182,6 +213,7 @@ void DeltaFileWrapper::reset()
   mIsDirty = true;
   mDeltas = QJsonArray();
   mLocalPkDeltaIdx.clear();
+  mNeedsCompaction = true;
 
   emit countChanged();
 }
@@ -190,6 +222,7 @@ void DeltaFileWrapper::reset()
 void DeltaFileWrapper::resetId()
 {
   mJsonRoot.insert( QStringLiteral( "id" ), QUuid::createUuid().toString( QUuid::WithoutBraces ) );
+  mNeedsCompaction = true;
 }
 
 
@@ -265,9 +298,59 @@ QString DeltaFileWrapper::toString() const
 
 bool DeltaFileWrapper::toFile()
 {
-  QFile deltaFile( mFileName );
+  if ( mNeedsCompaction
+       || mJournalRecordCount >= DeltaJournalCompactionRecords
+       || mJournalSize + mJournalBuffer.size() >= DeltaJournalCompactionBytes
+       || !QFileInfo::exists( mFileName ) )
+    return compact();
 
-  if ( !deltaFile.open( QIODevice::WriteOnly | QIODevice::Unbuffered ) )
+  if ( !mJournalBuffer.isEmpty() )
+  {
+    QFile journalFile( journalFileName() );
+
+    if ( !journalFile.open( QIODevice::WriteOnly | QIODevice::Append | QIODevice::Unbuffered ) )
+    {
+      mErrorType = DeltaFileWrapper::ErrorTypes::IOError;
+      mErrorDetails = journalFile.errorString();
+      return false;
+    }
+
+    if ( journalFile.size() == 0 )
+      mJournalBuffer.prepend( journalHeader( mJournalGeneration ) );
+
+    // a single write per call batches all the records collected since the last write behind one sync
+    if ( journalFile.write( mJournalBuffer ) == -1 || !FileUtils::syncFile( journalFile ) )
+    {
+      mErrorType = DeltaFileWrapper::ErrorTypes::IOError;
+      mErrorDetails = journalFile.errorString();
+      return false;
+    }
+
+    mJournalSize = journalFile.size();
+    mJournalBuffer.clear();
+  }
+
+  mIsDirty = false;
+
+  emit savedToFile();
+
+  return true;
+}
+
+
+bool DeltaFileWrapper::compact()
+{
+  QJsonObject jsonRoot( mJsonRoot );
+  jsonRoot.insert( QStringLiteral( "version" ), DeltaFormatVersion );
+  jsonRoot.insert( QStringLiteral( "id" ), id() );
+  jsonRoot.insert( QStringLiteral( "project" ), mCloudProjectId );
+  jsonRoot.insert( QStringLiteral( "deltas" ), mDeltas );
+  jsonRoot.insert( QStringLiteral( "files" ), QJsonArray() );
+  jsonRoot.insert( sJournalGenerationKey, static_cast<qint64>( mJournalGeneration + 1 ) );
+
+  QSaveFile deltaFile( mFileName );
+
+  if ( !deltaFile.open( QIODevice::WriteOnly ) )
   {
     mErrorType = DeltaFileWrapper::ErrorTypes::IOError;
     mErrorDetails = deltaFile.errorString();
@@ -275,7 +358,7 @@ bool DeltaFileWrapper::toFile()
     return false;
   }
 
-  if ( deltaFile.write( toJson() ) == -1 )
+  if ( deltaFile.write( QJsonDocument( jsonRoot ).toJson( QJsonDocument::Indented ) ) == -1 || !deltaFile.commit() )
   {
     mErrorType = DeltaFileWrapper::ErrorTypes::IOError;
     mErrorDetails = deltaFile.errorString();
@@ -283,7 +366,24 @@ bool DeltaFileWrapper::toFile()
     return false;
   }
 
-  deltaFile.close();
+  // the snapshot now refers to the next generation, the records left in the journal are stale from here on even if truncating fails
+  mJournalGeneration++;
+  mJournalBuffer.clear();
+  mJournalRecordCount = 0;
+  mJournalSize = 0;
+  mNeedsCompaction = false;
+
+  // records appended to a stale journal would be dropped on replay, it must be emptied before appending again
+  QFile journalFile( journalFileName() );
+  if ( journalFile.exists() && !journalFile.remove() && !journalFile.resize( 0 ) )
+  {
+    mNeedsCompaction = true;
+    mErrorType = DeltaFileWrapper::ErrorTypes::IOError;
+    mErrorDetails = journalFile.errorString();
+    QgsMessageLog::logMessage( QStringLiteral( "Failed to remove stale delta journal %1: %2" ).arg( journalFile.fileName(), journalFile.errorString() ) );
+    return false;
+  }
+
   mIsDirty = false;
   // QgsLogger::debug( "Finished writing deltas JSON" );
 
@@ -293,6 +393,128 @@ bool DeltaFileWrapper::toFile()
 }
 
 
+QString DeltaFileWrapper::journalFileName() const
+{
+  return QStringLiteral( "%1.journal" ).arg( mFileName );
+}
+
+
+int DeltaFileWrapper::journalRecordCount() const
+{
+  return mJournalRecordCount;
+}
+
+
+void DeltaFileWrapper::journalDelta( JournalOperation operation, qsizetype index, const QJsonObject &delta )
+{
+  // the whole state will be written anyway, no need to track individual changes
+  if ( mNeedsCompaction )
+    return;
+
+  QByteArray record;
+  QDataStream recordStream( &record, QIODevice::WriteOnly );
+  recordStream.setVersion( QDataStream::Qt_6_0 );
+  recordStream << static_cast<quint8>( operation ) << static_cast<qint32>( index );
+  if ( operation != JournalOperation::Remove )
+    recordStream << QJsonDocument( delta ).toJson( QJsonDocument::Compact );
+
+  QDataStream stream( &mJournalBuffer, QIODevice::WriteOnly | QIODevice::Append );
+  stream.setVersion( QDataStream::Qt_6_0 );
+  stream << record << qChecksum( record );
+
+  mJournalRecordCount++;
+}
+
+
+void DeltaFileWrapper::replayJournal()
+{
+  QFile journalFile( journalFileName() );
+
+  if ( !journalFile.exists() )
+    return;
+
+  if ( !journalFile.open( QIODevice::ReadOnly ) )
+  {
+    mErrorType = DeltaFileWrapper::ErrorTypes::IOError;
+    mErrorDetails = journalFile.errorString();
+    return;
+  }
+
+  QDataStream stream( &journalFile );
+  stream.setVersion( QDataStream::Qt_6_0 );
+
+  quint32 magic = 0;
+  quint32 generation = 0;
+  stream >> magic >> generation;
+
+  // a journal from an older generation has already been compacted into the snapshot
+  if ( stream.status() != QDataStream::Ok || magic != sJournalMagic || generation != mJournalGeneration )
+  {
+    mNeedsCompaction = true;
+    return;
+  }
+
+  while ( !stream.atEnd() )
+  {
+    QByteArray record;
+    quint16 checksum = 0;
+    stream >> record >> checksum;
+
+    if ( stream.status() != QDataStream::Ok || checksum != qChecksum( record ) )
+    {
+      QgsMessageLog::logMessage( QStringLiteral( "Ignoring truncated delta journal tail in %1" ).arg( journalFile.fileName() ) );
+      mNeedsCompaction = true;
+      break;
+    }
+
+    QDataStream recordStream( record );
+    recordStream.setVersion( QDataStream::Qt_6_0 );
+    quint8 operation = 0;
+    qint32 index = 0;
+    QByteArray payload;
+    recordStream >> operation >> index;
+
+    switch ( static_cast<JournalOperation>( operation ) )
+    {
+      case JournalOperation::Append:
+        recordStream >> payload;
+        mDeltas.append( QJsonDocument::fromJson( payload ).object() );
+        break;
+
+      case JournalOperation::Replace:
+        recordStream >> payload;
+        if ( index >= 0 && index < mDeltas.size() )
+          mDeltas.replace( index, QJsonDocument::fromJson( payload ).object() );
+        break;
+
+      case JournalOperation::Remove:
+        if ( index >= 0 && index < mDeltas.size() )
+          mDeltas.removeAt( index );
+        break;
+    }
+
+    mJournalRecordCount++;
+  }
+
+  mJournalSize = journalFile.size();
+
+  rebuildLocalPkDeltaIdx();
+}
+
+
+void DeltaFileWrapper::rebuildLocalPkDeltaIdx()
+{
+  mLocalPkDeltaIdx.clear();
+
+  for ( qsizetype i = 0; i < mDeltas.size(); i++ )
+  {
+    const QJsonObject delta = mDeltas.at( i ).toObject();
+    if ( delta.value( QStringLiteral( "method" ) ).toString() == QStringLiteral( "create" ) )
+      mLocalPkDeltaIdx[delta.value( QStringLiteral( "localLayerId" ) ).toString()][delta.value( QStringLiteral( "localPk" ) ).toString()] = static_cast<int>( i );
+  }
+}
+
+
 QString DeltaFileWrapper::toFileForUpload( const QString &outFileName ) const
 {
   QString fileName = outFileName;
@@ -336,7 +558,10 @@ bool DeltaFileWrapper::append( const DeltaFileWrapper *deltaFileWrapper )
   const QJsonArray constDeltas = deltaFileWrapper->deltas();
 
   for ( const QJsonValue &delta : constDeltas )
+  {
+    journalDelta( JournalOperation::Append, mDeltas.size(), delta.toObject() );
     mDeltas.append( delta );
+  }
 
   emit countChanged();
 
@@ -814,6 +1039,7 @@ void DeltaFileWrapper::mergeCreateDelta( const QJsonObject &delta )
   const QString localLayerId = delta.value( QStringLiteral( "localLayerId" ) ).toString();
   mLocalPkDeltaIdx[localLayerId][localPk] = static_cast<int>( mDeltas.count() );
 
+  journalDelta( JournalOperation::Append, mDeltas.size(), delta );
   mDeltas.append( delta );
   mIsDirty = true;
 
@@ -830,11 +1056,14 @@ void DeltaFileWrapper::mergeDeleteDelta( const QJsonObject &delta )
   if ( layerPkDeltaIdx.contains( localPk ) )
   {
     // Feature creation/deletion occured in the same delta session, just remove as if nothing had ever occured
-    mDeltas.removeAt( layerPkDeltaIdx.take( localPk ) );
+    const int deltaIdx = layerPkDeltaIdx.take( localPk );
+    journalDelta( JournalOperation::Remove, deltaIdx );
+    mDeltas.removeAt( deltaIdx );
     emit countChanged();
     return;
   }
 
+  journalDelta( JournalOperation::Append, mDeltas.size(), delta );
   mDeltas.append( delta );
   mIsDirty = true;
 
@@ -909,6 +1138,7 @@ void DeltaFileWrapper::mergePatchDelta( const QJsonObject &delta )
     deltaCreate.insert( QStringLiteral( "new" ), newCreate );
     deltaCreate.insert( QStringLiteral( "sourcePk" ), delta.value( QStringLiteral( "sourcePk" ) ) );
 
+    journalDelta( JournalOperation::Replace, deltaIdx, deltaCreate );
     mDeltas.replace( deltaIdx, deltaCreate );
 
     return;
@@ -966,12 +1196,14 @@ void DeltaFileWrapper::mergePatchDelta( const QJsonObject &delta )
         existingDelta.insert( "old", existingOldData );
         existingDelta.insert( "new", existingNewData );
 
+        journalDelta( JournalOperation::Replace, i, existingDelta );
         mDeltas.replace( i, existingDelta );
 
         return;
       }
     }
 
+    journalDelta( JournalOperation::Append, mDeltas.size(), delta );
     mDeltas.append( delta );
 
     emit countChanged();
@@ -27,6 +27,16 @@
 
 const QString DeltaFormatVersion = QStringLiteral( "1.0" );
 
+/**
+ * Number of journal records after which the next `toFile()` call compacts the journal into the JSON snapshot.
+ */
+const int DeltaJournalCompactionRecords = 500;
+
+/**
+ * Journal size in bytes after which the next `toFile()` call compacts the journal into the JSON snapshot.
+ */
+const qint64 DeltaJournalCompactionBytes = 4 * 1024 * 1024;
+
 /**
  * A class that wraps the operations with a delta file. All read and write operations to a delta file should go through this class.
  * \ingroup core
@@ -212,11 +222,39 @@ class DeltaFileWrapper : public QObject
     /**
      * Writes deltas file to the permanent storage.
      *
+     * Changes made since the last call are appended to the journal file next to the delta file, so the cost of
+     * a write grows with the size of the change rather than with the size of the delta history. The journal is
+     * compacted into the JSON snapshot once it grows beyond DeltaJournalCompactionRecords or DeltaJournalCompactionBytes.
+     *
      * @return bool whether write has been successful
      */
     Q_INVOKABLE bool toFile();
 
 
+    /**
+     * Rewrites the JSON snapshot of the delta file and truncates the journal.
+     *
+     * @return bool whether write has been successful
+     */
+    bool compact();
+
+
+    /**
+     * Returns the file name of the journal accompanying the delta file.
+     *
+     * @return QString journal file name
+     */
+    QString journalFileName() const;
+
+
+    /**
+     * Returns the number of records stored in the journal, including those not yet written.
+     *
+     * @return int number of journal records
+     */
+    int journalRecordCount() const;
+
+
     /**
      * Writes deltas file to the permanent storage with replaced layerIds, ready for upload.
      *
@@ -360,6 +398,32 @@ class DeltaFileWrapper : public QObject
 
 
   private:
+    /**
+     * Journal record operations, mirroring the mutations done on `mDeltas`.
+     */
+    enum class JournalOperation : quint8
+    {
+      Append = 1,
+      Replace = 2,
+      Remove = 3,
+    };
+
+    /**
+     * Queues a journal record for the given \a operation on the delta at \a index. The record is written on the next `toFile()` call.
+     */
+    void journalDelta( JournalOperation operation, qsizetype index, const QJsonObject &delta = QJsonObject() );
+
+    /**
+     * Replays the journal records on top of the deltas loaded from the JSON snapshot.
+     * A truncated or corrupted tail, e.g. after a crash while writing, is ignored and scheduled for compaction.
+     */
+    void replayJournal();
+
+    /**
+     * Rebuilds the mapping between the local primary keys and the index of their create delta.
+     */
+    void rebuildLocalPkDeltaIdx();
+
     /**
      * Converts geometry to QJsonValue string in WKT format.
      * Returns null if the geometry is null, or WKT string of the geometry
@@ -478,6 +542,36 @@ class DeltaFileWrapper : public QObject
     bool mIsDirty = false;
 
 
+    /**
+     * Encoded journal records that have not been written to the journal file yet.
+     */
+    QByteArray mJournalBuffer;
+
+
+    /**
+     * Number of records stored in the journal file and in the journal buffer.
+     */
+    int mJournalRecordCount = 0;
+
+
+    /**
+     * Size in bytes of the journal file.
+     */
+    qint64 mJournalSize = 0;
+
+
+    /**
+     * Journal generation, incremented on each compaction. Journal records of other generations are stale and never replayed.
+     */
+    quint32 mJournalGeneration = 0;
+
+
+    /**
+     * Holds whether the next write should rewrite the JSON snapshot instead of appending to the journal.
+     */
+    bool mNeedsCompaction = false;
+
+
     /**
      * Holds whether the pushing state has been activated.
      */
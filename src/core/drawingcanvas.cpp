@@ -37,9 +37,6 @@ void DrawingCanvas::createBlankCanvas( int width, int height, QColor backgroundC
   mBackgroundImage = QImage( QSize( width, height ), QImage::Format_ARGB32 );
   mBackgroundImage.fill( backgroundColor );
 
-  mDrawingImage = QImage( QSize( width, height ), QImage::Format_ARGB32 );
-  mDrawingImage.fill( Qt::transparent );
-
   setIsEmpty( false );
   setIsDirty( false );
   fitCanvas();
@@ -61,14 +58,11 @@ void DrawingCanvas::createCanvasFromImage( const QString &path )
       mBackgroundImage.convertTo( QImage::Format_ARGB32 );
     }
 
-    mDrawingImage = QImage( mBackgroundImage.size(), QImage::Format_ARGB32 );
-    mDrawingImage.fill( Qt::transparent );
     setIsEmpty( false );
   }
   else
   {
     mLoadedImagePath.clear();
-    mDrawingImage = QImage();
     setIsEmpty( false );
   }
 
@@ -79,10 +73,12 @@ void DrawingCanvas::createCanvasFromImage( const QString &path )
 void DrawingCanvas::clear()
 {
   mStrokes.clear();
+  mCurrentStroke.points.clear();
+  mTiles.clear();
+  mCheckpoints.clear();
 
   mLoadedImagePath.clear();
   mBackgroundImage = QImage();
-  mDrawingImage = QImage();
 
   setZoomFactor( 1.0 );
   setOffset( QPointF( 0, 0 ) );
@@ -99,7 +95,11 @@ QString DrawingCanvas::save() const
 
   QPainter painter( &image );
   painter.drawImage( 0, 0, mBackgroundImage );
-  painter.drawImage( 0, 0, mDrawingImage );
+  for ( auto it = mTiles.constBegin(); it != mTiles.constEnd(); ++it )
+  {
+    painter.drawImage( tileRect( it.key() ).topLeft(), it.value() );
+  }
+  painter.end();
 
   if ( !mLoadedImagePath.isEmpty() )
   {
@@ -270,7 +270,9 @@ void DrawingCanvas::strokeMove( const QPointF &point )
   {
     mCurrentStroke.points << itemToCanvas( point );
 
-    update();
+    // Only repaint the area covered by the new segment
+    const double margin = mCurrentStroke.width * mZoomFactor / 2 + 2;
+    update( QRectF( lastPoint, point ).normalized().adjusted( -margin, -margin, margin, margin ).toAlignedRect() );
   }
 }
 
@@ -282,17 +284,88 @@ void DrawingCanvas::strokeEnd( const QPointF &point )
   }
 
   mCurrentStroke.points << itemToCanvas( point );
+  mCurrentStroke.bounds = strokeBounds( mCurrentStroke );
 
-  QPainter painter( &mDrawingImage );
-  painter.setRenderHint( QPainter::Antialiasing, true );
-  drawStroke( &painter, mCurrentStroke );
-
+  rasterizeStroke( mCurrentStroke );
   mStrokes << mCurrentStroke;
   mCurrentStroke.points.clear();
 
+  if ( mStrokes.size() % CheckpointInterval == 0 )
+  {
+    addCheckpoint( static_cast<int>( mStrokes.size() ) );
+  }
+
   setIsDirty( true );
 
-  update();
+  const Stroke &stroke = mStrokes.last();
+  update( QRectF( canvasToItem( stroke.bounds.topLeft() ), canvasToItem( stroke.bounds.bottomRight() + QPoint( 1, 1 ) ) ).toAlignedRect() );
+}
+
+QRect DrawingCanvas::strokeBounds( const Stroke &stroke )
+{
+  QPointF topLeft = stroke.points.at( 0 );
+  QPointF bottomRight = topLeft;
+  for ( const QPointF &point : stroke.points )
+  {
+    topLeft = QPointF( std::min( topLeft.x(), point.x() ), std::min( topLeft.y(), point.y() ) );
+    bottomRight = QPointF( std::max( bottomRight.x(), point.x() ), std::max( bottomRight.y(), point.y() ) );
+  }
+
+  // Account for the pen width and antialiasing
+  const double margin = stroke.width / 2 + 2;
+  return QRectF( topLeft, bottomRight ).adjusted( -margin, -margin, margin, margin ).toAlignedRect();
+}
+
+void DrawingCanvas::rasterizeStroke( const Stroke &stroke )
+{
+  const QRect bounds = stroke.bounds.intersected( QRect( QPoint( 0, 0 ), mBackgroundImage.size() ) );
+  if ( bounds.isEmpty() )
+  {
+    return;
+  }
+
+  for ( int row = bounds.top() / TileSize; row <= bounds.bottom() / TileSize; row++ )
+  {
+    for ( int column = bounds.left() / TileSize; column <= bounds.right() / TileSize; column++ )
+    {
+      QImage &tile = mTiles[tileKey( column, row )];
+      if ( tile.isNull() )
+      {
+        tile = QImage( TileSize, TileSize, QImage::Format_ARGB32_Premultiplied );
+        tile.fill( Qt::transparent );
+      }
+
+      QPainter painter( &tile );
+      painter.setRenderHint( QPainter::Antialiasing, true );
+      painter.translate( -column * TileSize, -row * TileSize );
+      drawStroke( &painter, stroke );
+    }
+  }
+}
+
+void DrawingCanvas::addCheckpoint( int strokeCount )
+{
+  // Tiles are implicitly shared, a checkpoint only costs the tiles painted after it
+  mCheckpoints << Checkpoint { strokeCount, mTiles };
+  if ( mCheckpoints.size() <= MaximumCheckpoints )
+  {
+    return;
+  }
+
+  // Merge the most recent pair of intervals between checkpoints not outgrowing the interval before them,
+  // leaving the latest interval alone, so that the spacing doubles with age and undoing far back never
+  // replays the whole drawing
+  auto interval = [this]( int index ) { return mCheckpoints.at( index ).strokeCount - ( index > 0 ? mCheckpoints.at( index - 1 ).strokeCount : 0 ); };
+  int removedIndex = 0;
+  for ( int i = static_cast<int>( mCheckpoints.size() ) - 3; i > 0; i-- )
+  {
+    if ( interval( i ) + interval( i + 1 ) <= interval( i - 1 ) )
+    {
+      removedIndex = i;
+      break;
+    }
+  }
+  mCheckpoints.removeAt( removedIndex );
 }
 
 void DrawingCanvas::drawStroke( QPainter *painter, const Stroke &stroke, bool onCanvas ) const
@@ -319,13 +392,31 @@ void DrawingCanvas::undo()
     mCurrentStroke.points.clear();
     mStrokes.removeLast();
 
-    // Reset image and redraw remaining strokes
-    mDrawingImage.fill( Qt::transparent );
-    for ( const Stroke &stroke : std::as_const( mStrokes ) )
+    // Restore the closest checkpoint and redraw the strokes which followed it
+    while ( !mCheckpoints.isEmpty() && mCheckpoints.last().strokeCount > mStrokes.size() )
     {
-      QPainter painter( &mDrawingImage );
-      painter.setRenderHint( QPainter::Antialiasing, true );
-      drawStroke( &painter, stroke );
+      mCheckpoints.removeLast();
+    }
+
+    int replayedStrokeIndex = 0;
+    if ( !mCheckpoints.isEmpty() )
+    {
+      mTiles = mCheckpoints.last().tiles;
+      replayedStrokeIndex = mCheckpoints.last().strokeCount;
+    }
+    else
+    {
+      mTiles.clear();
+    }
+
+    // Checkpoints undone past are re-created along the way, further undos replay as few strokes
+    for ( ; replayedStrokeIndex < mStrokes.size(); replayedStrokeIndex++ )
+    {
+      rasterizeStroke( mStrokes.at( replayedStrokeIndex ) );
+      if ( ( replayedStrokeIndex + 1 ) % CheckpointInterval == 0 )
+      {
+        addCheckpoint( replayedStrokeIndex + 1 );
+      }
     }
 
     setIsDirty( !mStrokes.isEmpty() );
@@ -370,8 +461,31 @@ void DrawingCanvas::paint( QPainter *painter )
     painter->setBrush( QBrush( shadowColor ) );
     painter->drawRect( imageRect.translated( 3, 3 ) );
 
-    painter->drawImage( imageRect, mBackgroundImage );
-    painter->drawImage( imageRect, mDrawingImage );
+    // Only draw the part of the canvas within the area being repainted
+    QRectF visibleRect = imageRect;
+    if ( painter->hasClipping() )
+    {
+      visibleRect = visibleRect.intersected( painter->clipBoundingRect() );
+    }
+    const QRect visibleCanvasRect = QRectF( itemToCanvas( visibleRect.topLeft() ), itemToCanvas( visibleRect.bottomRight() ) ).toAlignedRect().intersected( mBackgroundImage.rect() );
+    if ( !visibleCanvasRect.isEmpty() )
+    {
+      painter->drawImage( QRectF( canvasToItem( visibleCanvasRect.topLeft() ), QSizeF( visibleCanvasRect.size() ) * mZoomFactor ), mBackgroundImage, visibleCanvasRect );
+
+      // Disable antialiasing while drawing tiles to avoid seams along their edges
+      painter->save();
+      painter->setRenderHint( QPainter::Antialiasing, false );
+      painter->setClipRect( imageRect, Qt::IntersectClip );
+      for ( auto it = mTiles.constBegin(); it != mTiles.constEnd(); ++it )
+      {
+        const QRect rect = tileRect( it.key() );
+        if ( rect.intersects( visibleCanvasRect ) )
+        {
+          painter->drawImage( QRectF( canvasToItem( rect.topLeft() ), QSizeF( rect.size() ) * mZoomFactor ), it.value() );
+        }
+      }
+      painter->restore();
+    }
 
     if ( mCurrentStroke.points.size() > 1 )
     {
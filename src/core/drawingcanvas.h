@@ -17,6 +17,7 @@
 #ifndef DRAWINGCANVAS_H
 #define DRAWINGCANVAS_H
 
+#include <QHash>
 #include <QImage>
 #include <QObject>
 #include <QQuickPaintedItem>
@@ -24,6 +25,13 @@
 #define DEFAULT_STROKE_WIDTH 5
 
 /**
+ * \brief A canvas on which strokes are sketched over a blank or photo background.
+ *
+ * Strokes are rasterized into a layer of fixed-size tiles, only the tiles a stroke touches
+ * being allocated and repainted. A checkpoint of the layer is kept every few strokes,
+ * sharing the tiles left untouched since, so that undoing a stroke only replays the
+ * strokes drawn after the closest checkpoint. Older checkpoints are thinned out so that
+ * their spacing grows geometrically, and checkpoints are re-created while replaying strokes.
  * \ingroup core
  */
 class DrawingCanvas : public QQuickPaintedItem
@@ -169,16 +177,44 @@ class DrawingCanvas : public QQuickPaintedItem
     void offsetChanged();
 
   private:
+    //! Width and height in pixels of the drawing layer tiles
+    static constexpr int TileSize = 256;
+    //! Number of strokes between two checkpoints
+    static constexpr int CheckpointInterval = 16;
+    //! Maximum number of checkpoints kept, older ones being thinned out first
+    static constexpr int MaximumCheckpoints = 6;
+
     struct Stroke
     {
         double width = 5.0;
         QColor color = QColor( 0, 0, 0 );
         QColor fillColor = QColor( Qt::transparent );
         QList<QPointF> points;
+        //! Canvas pixels covered by the stroke
+        QRect bounds;
+    };
+
+    struct Checkpoint
+    {
+        //! Number of strokes rasterized in the checkpoint tiles
+        int strokeCount = 0;
+        QHash<quint32, QImage> tiles;
     };
 
     void drawStroke( QPainter *painter, const Stroke &stroke, bool onCanvas = true ) const;
 
+    //! Keeps a checkpoint of the current tiles holding the first \a strokeCount strokes
+    void addCheckpoint( int strokeCount );
+
+    //! Paints a \a stroke onto the tiles it covers
+    void rasterizeStroke( const Stroke &stroke );
+
+    //! Returns the canvas pixels covered by a \a stroke
+    static QRect strokeBounds( const Stroke &stroke );
+
+    static quint32 tileKey( int column, int row ) { return ( static_cast<quint32>( row ) << 16 ) | static_cast<quint32>( column ); }
+    static QRect tileRect( quint32 key ) { return QRect( static_cast<int>( key & 0xffff ) * TileSize, static_cast<int>( key >> 16 ) * TileSize, TileSize, TileSize ); }
+
     QPointF itemToCanvas( const QPointF &point ) const;
     QPointF canvasToItem( const QPointF &point ) const;
 
@@ -192,7 +228,8 @@ class DrawingCanvas : public QQuickPaintedItem
     QPointF mOffset = QPointF( 0, 0 );
 
     QImage mBackgroundImage;
-    QImage mDrawingImage;
+    QHash<quint32, QImage> mTiles;
+    QList<Checkpoint> mCheckpoints;
 
     QList<Stroke> mStrokes;
     Stroke mCurrentStroke;
@@ -0,0 +1,636 @@
+/***************************************************************************
+  featurecountcache.cpp - FeatureCountCache
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "featurecountcache.h"
+#include "featurequeryexecutor.h"
+#include "layerobserver.h"
+
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSaveFile>
+#include <qgsexpressioncontextutils.h>
+#include <qgsfeedback.h>
+#include <qgsmessagelog.h>
+#include <qgsproject.h>
+#include <qgsproviderregistry.h>
+#include <qgsrendercontext.h>
+#include <qgsrenderer.h>
+#include <qgssqliteutils.h>
+#include <qgsvectordataprovider.h>
+#include <qgsvectorlayer.h>
+#include <qgsvectorlayereditbuffer.h>
+#include <qgsvectorlayerfeatureiterator.h>
+
+#include <sqlite3.h>
+
+//! What a worker needs to count the features of a layer
+struct FeatureCountCache::CountSource
+{
+    std::unique_ptr<QgsAbstractFeatureSource> featureSource;
+    QgsFields fields;
+    //! Renderer classifying the features into legend symbols, null to only count them
+    std::unique_ptr<QgsFeatureRenderer> renderer;
+    QgsExpressionContext context;
+    QgsFeatureIds fids;
+    //! Provider type, source and subset string of the layer, to determine the revision of its data if not empty
+    QString providerType;
+    QString source;
+    QString subsetString;
+};
+
+FeatureCountCache::FeatureCountCache( QgsProject *project, LayerObserver *layerObserver, QObject *parent )
+  : QObject( parent )
+  , mProject( project )
+{
+  connect( mProject, &QgsProject::homePathChanged, this, &FeatureCountCache::onHomePathChanged );
+  connect( mProject, &QgsProject::layersWillBeRemoved, this, &FeatureCountCache::onLayersWillBeRemoved );
+  connect( layerObserver, &LayerObserver::featuresCommitted, this, &FeatureCountCache::onFeaturesCommitted );
+}
+
+FeatureCountCache::~FeatureCountCache()
+{
+  for ( const LayerCounts &counts : std::as_const( mCounts ) )
+  {
+    if ( counts.ticket )
+      FeatureQueryExecutor::instance()->cancel( counts.ticket );
+    if ( counts.revisionTicket )
+      FeatureQueryExecutor::instance()->cancel( counts.revisionTicket );
+  }
+}
+
+qint64 FeatureCountCache::featureCount( QgsVectorLayer *layer )
+{
+  if ( !layer || !layer->isValid() )
+    return -1;
+
+  return countsFor( layer ).total;
+}
+
+qint64 FeatureCountCache::symbolFeatureCount( QgsVectorLayer *layer, const QString &ruleKey )
+{
+  if ( !layer || !layer->isValid() )
+    return -1;
+
+  // Outdated symbol counts are still shown while being recounted, symbols they don't know of are not
+  const LayerCounts &counts = countsFor( layer );
+  return counts.symbols.value( ruleKey, counts.symbolsValid ? 0 : -1 );
+}
+
+FeatureCountCache::LayerCounts &FeatureCountCache::countsFor( QgsVectorLayer *layer )
+{
+  LayerCounts &counts = mCounts[layer->id()];
+  if ( !counts.verified )
+  {
+    counts.verified = true;
+
+    connect( layer, &QgsVectorLayer::subsetStringChanged, this, &FeatureCountCache::onLayerChanged, Qt::UniqueConnection );
+    connect( layer, &QgsVectorLayer::dataSourceChanged, this, &FeatureCountCache::onLayerChanged, Qt::UniqueConnection );
+    connect( layer, &QgsVectorLayer::rendererChanged, this, &FeatureCountCache::onRendererChanged, Qt::UniqueConnection );
+    connect( layer, &QgsVectorLayer::afterRollBack, this, &FeatureCountCache::onAfterRollBack, Qt::UniqueConnection );
+    connect( layer, &QgsVectorLayer::beforeCommitChanges, this, &FeatureCountCache::onBeforeCommitChanges, Qt::UniqueConnection );
+
+    // Persisted counts only hold for the data and the renderer they were computed for, the
+    // data being checked in the background not to open it from the models asking for counts
+    if ( counts.revision.isEmpty() )
+    {
+      counts.total = -1;
+      counts.symbols.clear();
+      counts.symbolsValid = false;
+    }
+    else
+    {
+      if ( counts.renderer != rendererDescription( layer ) )
+      {
+        counts.symbols.clear();
+        counts.symbolsValid = false;
+      }
+      checkRevision( layer );
+    }
+  }
+
+  if ( !counts.ticket && ( counts.total < 0 || !counts.symbolsValid ) )
+    recount( layer );
+
+  return counts;
+}
+
+quint64 FeatureCountCache::count( QgsVectorLayer *layer, const QgsFeatureIds &fids, bool withRevision, std::function<void( const Counts & )> callback )
+{
+  std::shared_ptr<CountSource> source = std::make_shared<CountSource>();
+  source->featureSource = std::make_unique<QgsVectorLayerFeatureSource>( layer );
+  source->fields = layer->fields();
+  if ( layer->renderer() )
+    source->renderer.reset( layer->renderer()->clone() );
+  source->context.appendScopes( QgsExpressionContextUtils::globalProjectLayerScopes( layer ) );
+  source->fids = fids;
+  if ( withRevision )
+  {
+    source->providerType = layer->providerType();
+    source->source = layer->source();
+    source->subsetString = layer->subsetString();
+  }
+
+  FeatureQueryExecutor::Query query;
+  query.layers << layer;
+  query.priority = FeatureQueryExecutor::Priority::Background;
+
+  return FeatureQueryExecutor::instance()->submit<Counts>(
+    query,
+    [source]( QgsFeedback *feedback ) {
+      // Determined first, counts missing changes made meanwhile are then found outdated
+      const QString revision = !source->providerType.isEmpty() ? layerRevision( source->providerType, source->source, source->subsetString ) : QString();
+      Counts counts = countFeatures( *source, feedback );
+      counts.revision = revision;
+      return counts;
+    },
+    this, std::move( callback ) );
+}
+
+FeatureCountCache::Counts FeatureCountCache::countFeatures( CountSource &source, QgsFeedback *feedback )
+{
+  Counts counts;
+
+  QgsRenderContext renderContext;
+  renderContext.setExpressionContext( source.context );
+
+  QgsFeatureRequest request;
+  request.setFeedback( feedback );
+  if ( !source.fids.isEmpty() )
+    request.setFilterFids( source.fids );
+
+  if ( source.renderer )
+  {
+    if ( !source.renderer->filterNeedsGeometry() )
+    {
+#if _QGIS_VERSION_INT >= 33500
+      request.setFlags( Qgis::FeatureRequestFlag::NoGeometry );
+#else
+      request.setFlags( QgsFeatureRequest::NoGeometry );
+#endif
+    }
+    request.setSubsetOfAttributes( source.renderer->usedAttributes( renderContext ), source.fields );
+    source.renderer->startRender( renderContext, source.fields );
+  }
+  else
+  {
+#if _QGIS_VERSION_INT >= 33500
+    request.setFlags( Qgis::FeatureRequestFlag::NoGeometry );
+#else
+    request.setFlags( QgsFeatureRequest::NoGeometry );
+#endif
+    request.setNoAttributes();
+  }
+
+  QgsFeatureIterator iterator = source.featureSource->getFeatures( request );
+  QgsFeature feature;
+  while ( iterator.nextFeature( feature ) )
+  {
+    counts.total++;
+    if ( source.renderer )
+    {
+      renderContext.expressionContext().setFeature( feature );
+      const QSet<QString> keys = source.renderer->legendKeysForFeature( feature, renderContext );
+      for ( const QString &key : keys )
+        counts.symbols[key]++;
+    }
+
+    if ( feedback->isCanceled() )
+      break;
+  }
+
+  if ( source.renderer )
+    source.renderer->stopRender( renderContext );
+
+  return counts;
+}
+
+void FeatureCountCache::recount( QgsVectorLayer *layer )
+{
+  const QString layerId = layer->id();
+  LayerCounts &counts = mCounts[layerId];
+  if ( counts.ticket )
+    FeatureQueryExecutor::instance()->cancel( counts.ticket );
+  // The count determines the revision itself
+  if ( counts.revisionTicket )
+    FeatureQueryExecutor::instance()->cancel( counts.revisionTicket );
+  counts.revisionTicket = 0;
+
+  // Counts including uncommitted edits are neither persisted nor adjusted by commits
+  const bool committed = !layer->isModified();
+  const QString renderer = rendererDescription( layer );
+
+  counts.ticket = count( layer, QgsFeatureIds(), committed, [this, layerId, committed, renderer]( const Counts &result ) {
+    auto it = mCounts.find( layerId );
+    if ( it == mCounts.end() )
+      return;
+
+    it->ticket = 0;
+    it->total = result.total;
+    it->symbols = result.symbols;
+    it->symbolsValid = true;
+    it->committed = committed;
+    it->revision = result.revision;
+    it->renderer = renderer;
+
+    save();
+    emit countsChanged( layerId );
+  } );
+}
+
+void FeatureCountCache::checkRevision( QgsVectorLayer *layer )
+{
+  const QString layerId = layer->id();
+  LayerCounts &counts = mCounts[layerId];
+  if ( counts.revisionTicket )
+    FeatureQueryExecutor::instance()->cancel( counts.revisionTicket );
+
+  const QString providerType = layer->providerType();
+  const QString source = layer->source();
+  const QString subsetString = layer->subsetString();
+
+  FeatureQueryExecutor::Query query;
+  query.layers << layer;
+  query.priority = FeatureQueryExecutor::Priority::Background;
+
+  counts.revisionTicket = FeatureQueryExecutor::instance()->submit<QString>(
+    query,
+    [providerType, source, subsetString]( QgsFeedback * ) {
+      return layerRevision( providerType, source, subsetString );
+    },
+    this, [this, layerId]( const QString &revision ) {
+      auto it = mCounts.find( layerId );
+      if ( it == mCounts.end() )
+        return;
+
+      it->revisionTicket = 0;
+      if ( it->revision.isEmpty() )
+      {
+        it->revision = revision;
+        save();
+        return;
+      }
+
+      if ( it->revision == revision )
+        return;
+
+      QgsVectorLayer *layer = qobject_cast<QgsVectorLayer *>( mProject->mapLayer( layerId ) );
+      if ( !layer )
+        return;
+
+      it->total = -1;
+      it->symbols.clear();
+      it->symbolsValid = false;
+      recount( layer );
+      emit countsChanged( layerId );
+    } );
+}
+
+void FeatureCountCache::onHomePathChanged()
+{
+  for ( const LayerCounts &counts : std::as_const( mCounts ) )
+  {
+    if ( counts.ticket )
+      FeatureQueryExecutor::instance()->cancel( counts.ticket );
+    if ( counts.revisionTicket )
+      FeatureQueryExecutor::instance()->cancel( counts.revisionTicket );
+  }
+  mCounts.clear();
+
+  // Projects which are not saved yet have their counts computed every time
+  const QFileInfo projectFileInfo( mProject->fileName() );
+  mPath = projectFileInfo.exists()
+            ? QStringLiteral( "%1/.%2.counts.json" ).arg( projectFileInfo.absolutePath(), projectFileInfo.completeBaseName() )
+            : QString();
+
+  load();
+}
+
+void FeatureCountCache::onLayersWillBeRemoved( const QStringList &layerIds )
+{
+  for ( const QString &layerId : layerIds )
+  {
+    const LayerCounts counts = mCounts.take( layerId );
+    if ( counts.ticket )
+      FeatureQueryExecutor::instance()->cancel( counts.ticket );
+    if ( counts.revisionTicket )
+      FeatureQueryExecutor::instance()->cancel( counts.revisionTicket );
+  }
+}
+
+void FeatureCountCache::onBeforeCommitChanges()
+{
+  QgsVectorLayer *layer = qobject_cast<QgsVectorLayer *>( sender() );
+  if ( !layer )
+    return;
+
+  auto it = mCounts.find( layer->id() );
+  if ( it == mCounts.end() )
+    return;
+
+  it->leavingFids.clear();
+  it->leavingSymbols.clear();
+  it->leavingClassified = false;
+
+  // Counts the commit can't be applied to are recounted anyway
+  QgsVectorLayerEditBuffer *editBuffer = layer->editBuffer();
+  if ( !editBuffer || it->ticket || !it->committed || it->total < 0 || !it->symbolsValid )
+    return;
+
+  QgsFeatureIds fids = editBuffer->deletedFeatureIds();
+  const QList<QgsFeatureId> changedGeometriesFids = editBuffer->changedGeometries().keys();
+  for ( const QgsFeatureId fid : changedGeometriesFids )
+  {
+    if ( !FID_IS_NEW( fid ) )
+      fids.insert( fid );
+  }
+  const QList<QgsFeatureId> changedAttributesFids = editBuffer->changedAttributeValues().keys();
+  for ( const QgsFeatureId fid : changedAttributesFids )
+  {
+    if ( !FID_IS_NEW( fid ) )
+      fids.insert( fid );
+  }
+
+  if ( fids.size() > MaximumClassifiedFeatures )
+    return;
+
+  if ( !fids.isEmpty() && layer->renderer() )
+  {
+    // The symbols the features leave are the ones of their committed values, read from the
+    // provider as the layer would return the edited ones. This has to happen before the
+    // provider is written to, only the few edited features are read.
+    CountSource source;
+    source.featureSource.reset( layer->dataProvider()->featureSource() );
+    source.fields = layer->dataProvider()->fields();
+    source.renderer.reset( layer->renderer()->clone() );
+    source.context.appendScopes( QgsExpressionContextUtils::globalProjectLayerScopes( layer ) );
+    source.fids = fids;
+
+    // Renderers relying on virtual or joined fields can't classify provider features
+    QgsRenderContext renderContext;
+    renderContext.setExpressionContext( source.context );
+    const QSet<QString> usedAttributes = source.renderer->usedAttributes( renderContext );
+    for ( const QString &attribute : usedAttributes )
+    {
+      if ( source.fields.lookupField( attribute ) < 0 )
+        return;
+    }
+
+    QgsFeedback feedback;
+    it->leavingSymbols = countFeatures( source, &feedback ).symbols;
+  }
+
+  it->leavingFids = fids;
+  it->leavingClassified = true;
+}
+
+void FeatureCountCache::onFeaturesCommitted( const QString &layerId, const QgsFeatureIds &addedFids, const QgsFeatureIds &changedFids, const QgsFeatureIds &deletedFids )
+{
+  auto it = mCounts.find( layerId );
+  if ( it == mCounts.end() || !it->verified )
+    return;
+
+  QgsVectorLayer *layer = qobject_cast<QgsVectorLayer *>( mProject->mapLayer( layerId ) );
+  if ( !layer )
+    return;
+
+  const QgsFeatureIds leavingFids = std::exchange( it->leavingFids, QgsFeatureIds() );
+  const QHash<QString, qint64> leavingSymbols = std::exchange( it->leavingSymbols, QHash<QString, qint64>() );
+  const bool leavingClassified = std::exchange( it->leavingClassified, false );
+
+  // A pending count may have missed the commit, counts including edits may already include it
+  if ( it->ticket || !it->committed || it->total < 0 )
+  {
+    recount( layer );
+    return;
+  }
+
+  it->total += addedFids.size() - deletedFids.size();
+
+  // Changed features contain the added ones, the other ones move from the symbols they were classified into
+  if ( it->symbolsValid )
+  {
+    if ( !leavingClassified || !leavingFids.contains( ( changedFids | deletedFids ) - addedFids ) )
+    {
+      it->symbolsValid = false;
+      recount( layer );
+      emit countsChanged( layerId );
+      return;
+    }
+
+    for ( auto symbolIt = leavingSymbols.constBegin(); symbolIt != leavingSymbols.constEnd(); ++symbolIt )
+      it->symbols[symbolIt.key()] -= symbolIt.value();
+
+    const QgsFeatureIds arrivingFids = ( leavingFids - deletedFids ) | addedFids;
+    if ( !arrivingFids.isEmpty() )
+    {
+      it->ticket = count( layer, arrivingFids, false, [this, layerId]( const Counts &result ) {
+        auto it = mCounts.find( layerId );
+        if ( it == mCounts.end() )
+          return;
+
+        it->ticket = 0;
+        for ( auto symbolIt = result.symbols.constBegin(); symbolIt != result.symbols.constEnd(); ++symbolIt )
+          it->symbols[symbolIt.key()] += symbolIt.value();
+
+        save();
+        emit countsChanged( layerId );
+      } );
+    }
+  }
+
+  // Persisted again once the revision of the committed data is known
+  it->revision.clear();
+  checkRevision( layer );
+
+  emit countsChanged( layerId );
+}
+
+void FeatureCountCache::onLayerChanged()
+{
+  QgsVectorLayer *layer = qobject_cast<QgsVectorLayer *>( sender() );
+  if ( !layer )
+    return;
+
+  auto it = mCounts.find( layer->id() );
+  if ( it == mCounts.end() )
+    return;
+
+  if ( it->ticket )
+    FeatureQueryExecutor::instance()->cancel( it->ticket );
+  it->ticket = 0;
+  if ( it->revisionTicket )
+    FeatureQueryExecutor::instance()->cancel( it->revisionTicket );
+  it->revisionTicket = 0;
+  it->total = -1;
+  it->symbols.clear();
+  it->symbolsValid = false;
+
+  // Counted again once asked for
+  emit countsChanged( layer->id() );
+}
+
+void FeatureCountCache::onRendererChanged()
+{
+  QgsVectorLayer *layer = qobject_cast<QgsVectorLayer *>( sender() );
+  if ( !layer )
+    return;
+
+  auto it = mCounts.find( layer->id() );
+  if ( it == mCounts.end() || it->renderer == rendererDescription( layer ) )
+    return;
+
+  if ( it->ticket )
+    FeatureQueryExecutor::instance()->cancel( it->ticket );
+  it->ticket = 0;
+  it->symbols.clear();
+  it->symbolsValid = false;
+
+  emit countsChanged( layer->id() );
+}
+
+void FeatureCountCache::onAfterRollBack()
+{
+  QgsVectorLayer *layer = qobject_cast<QgsVectorLayer *>( sender() );
+  if ( !layer )
+    return;
+
+  auto it = mCounts.find( layer->id() );
+  if ( it != mCounts.end() && ( !it->committed || it->ticket ) )
+    recount( layer );
+}
+
+QString FeatureCountCache::layerRevision( const QString &providerType, const QString &source, const QString &subsetString )
+{
+  const QVariantMap parts = QgsProviderRegistry::instance()->decodeUri( providerType, source );
+  const QString path = parts.value( QStringLiteral( "path" ) ).toString();
+  if ( path.isEmpty() )
+    return QString();
+
+  const QFileInfo fileInfo( path );
+  if ( !fileInfo.isFile() )
+    return QString();
+
+  QStringList revision;
+  revision << source << subsetString;
+
+  // Checkpoints rewrite SQLite based files without changing their content, a GeoPackage is
+  // identified by the last change and the feature count of its tables instead
+  QFile file( path );
+  if ( file.open( QIODevice::ReadOnly ) && file.read( 16 ) == QByteArrayLiteral( "SQLite format 3\0" ) )
+  {
+    file.close();
+    const QString contentRevision = geopackageRevision( path, parts.value( QStringLiteral( "layerName" ) ).toString() );
+    if ( contentRevision.isEmpty() )
+      return QString();
+
+    revision << contentRevision;
+    return revision.join( '|' );
+  }
+
+  revision << QString::number( fileInfo.lastModified().toMSecsSinceEpoch() ) << QString::number( fileInfo.size() );
+  return revision.join( '|' );
+}
+
+QString FeatureCountCache::geopackageRevision( const QString &path, const QString &tableName )
+{
+  sqlite3_database_unique_ptr database;
+  if ( database.open_v2( path, SQLITE_OPEN_READONLY, nullptr ) != SQLITE_OK )
+    return QString();
+
+  // The feature counts are kept current by triggers, the last changes by the writers
+  int status = SQLITE_OK;
+  sqlite3_statement_unique_ptr statement = database.prepare( QStringLiteral( "SELECT c.table_name, c.last_change, o.feature_count FROM gpkg_contents c"
+                                                                             " LEFT JOIN gpkg_ogr_contents o ON lower( o.table_name ) = lower( c.table_name )"
+                                                                             " WHERE ?1 = '' OR lower( c.table_name ) = lower( ?1 )"
+                                                                             " ORDER BY c.table_name" ),
+                                                             status );
+  if ( status != SQLITE_OK )
+    return QString();
+
+  const QByteArray tableNameUtf8 = tableName.toUtf8();
+  sqlite3_bind_text( statement.get(), 1, tableNameUtf8.constData(), static_cast<int>( tableNameUtf8.size() ), SQLITE_STATIC );
+
+  QStringList revision;
+  while ( statement.step() == SQLITE_ROW )
+    revision << statement.columnAsText( 0 ) << statement.columnAsText( 1 ) << statement.columnAsText( 2 );
+  return revision.join( '|' );
+}
+
+QString FeatureCountCache::rendererDescription( QgsVectorLayer *layer )
+{
+  return layer->renderer() ? layer->renderer()->dump() : QString();
+}
+
+void FeatureCountCache::load()
+{
+  if ( mPath.isEmpty() )
+    return;
+
+  QFile file( mPath );
+  if ( !file.open( QIODevice::ReadOnly ) )
+    return;
+
+  const QJsonObject layers = QJsonDocument::fromJson( file.readAll() ).object();
+  for ( auto it = layers.constBegin(); it != layers.constEnd(); ++it )
+  {
+    const QJsonObject layer = it.value().toObject();
+
+    LayerCounts counts;
+    counts.revision = layer.value( QStringLiteral( "revision" ) ).toString();
+    counts.renderer = layer.value( QStringLiteral( "renderer" ) ).toString();
+    counts.total = static_cast<qint64>( layer.value( QStringLiteral( "total" ) ).toDouble( -1 ) );
+    const QJsonObject symbols = layer.value( QStringLiteral( "symbols" ) ).toObject();
+    for ( auto symbolIt = symbols.constBegin(); symbolIt != symbols.constEnd(); ++symbolIt )
+      counts.symbols.insert( symbolIt.key(), static_cast<qint64>( symbolIt.value().toDouble() ) );
+    counts.symbolsValid = true;
+    mCounts.insert( it.key(), counts );
+  }
+}
+
+void FeatureCountCache::save() const
+{
+  if ( mPath.isEmpty() )
+    return;
+
+  QJsonObject layers;
+  for ( auto it = mCounts.constBegin(); it != mCounts.constEnd(); ++it )
+  {
+    if ( it->revision.isEmpty() || !it->committed || it->total < 0 || !it->symbolsValid || it->ticket )
+      continue;
+
+    QJsonObject symbols;
+    for ( auto symbolIt = it->symbols.constBegin(); symbolIt != it->symbols.constEnd(); ++symbolIt )
+      symbols.insert( symbolIt.key(), static_cast<double>( symbolIt.value() ) );
+
+    QJsonObject layer;
+    layer.insert( QStringLiteral( "revision" ), it->revision );
+    layer.insert( QStringLiteral( "renderer" ), it->renderer );
+    layer.insert( QStringLiteral( "total" ), static_cast<double>( it->total ) );
+    layer.insert( QStringLiteral( "symbols" ), symbols );
+    layers.insert( it.key(), layer );
+  }
+
+  QSaveFile file( mPath );
+  if ( !file.open( QIODevice::WriteOnly ) )
+  {
+    QgsMessageLog::logMessage( tr( "Could not save the feature counts %1: %2" ).arg( mPath, file.errorString() ), QStringLiteral( "SIGPACGO" ), Qgis::Warning );
+    return;
+  }
+  file.write( QJsonDocument( layers ).toJson( QJsonDocument::Compact ) );
+  file.commit();
+}
@@ -0,0 +1,161 @@
+/***************************************************************************
+  featurecountcache.h - FeatureCountCache
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef FEATURECOUNTCACHE_H
+#define FEATURECOUNTCACHE_H
+
+#include "qfield_core_export.h"
+
+#include <QHash>
+#include <QObject>
+#include <qgsfeatureid.h>
+
+#include <functional>
+
+class LayerObserver;
+class QgsFeedback;
+class QgsProject;
+class QgsVectorLayer;
+
+/**
+ * \brief Feature counts of the vector layers of a project, per layer and per legend symbol.
+ *
+ * Missing counts are computed in the background by the FeatureQueryExecutor, callers
+ * getting -1 until countsChanged() is emitted. Counts are then kept current from the
+ * commits reported by the LayerObserver: layer totals are adjusted with the added and
+ * deleted features. Features a commit modifies or deletes are classified into the
+ * symbols they leave right before the commit, their symbols are then moved to the ones
+ * they are classified into once committed, along with the symbols of the added ones.
+ *
+ * Counts of layers stored in local files are persisted in a sidecar next to the project
+ * file, along with the revision of the data they were computed for, so that reopening
+ * an unchanged project shows its counts without counting anything. GeoPackages are
+ * revisioned by their content, which checkpoints of their write-ahead log don't alter.
+ * Revisions are determined in the background, persisted counts being shown until found
+ * outdated.
+ *
+ * Counts run as background queries, which never take up every worker of the executor.
+ * \ingroup core
+ */
+class QFIELD_CORE_EXPORT FeatureCountCache : public QObject
+{
+    Q_OBJECT
+
+  public:
+    explicit FeatureCountCache( QgsProject *project, LayerObserver *layerObserver, QObject *parent = nullptr );
+    ~FeatureCountCache() override;
+
+    //! Returns the number of features of a \a layer, or -1 until counted
+    qint64 featureCount( QgsVectorLayer *layer );
+
+    //! Returns the number of features of a \a layer rendered with the legend symbol \a ruleKey, or -1 until counted
+    qint64 symbolFeatureCount( QgsVectorLayer *layer, const QString &ruleKey );
+
+  signals:
+    //! Emitted when the counts of the layer with a given \a layerId have changed
+    void countsChanged( const QString &layerId );
+
+  private slots:
+    void onHomePathChanged();
+    void onLayersWillBeRemoved( const QStringList &layerIds );
+    //! Classifies the features the layer emitting the signal is about to modify or delete
+    void onBeforeCommitChanges();
+    void onFeaturesCommitted( const QString &layerId, const QgsFeatureIds &addedFids, const QgsFeatureIds &changedFids, const QgsFeatureIds &deletedFids );
+    //! Invalidates the counts of the layer emitting the signal
+    void onLayerChanged();
+    //! Invalidates the symbol counts of the layer emitting the signal
+    void onRendererChanged();
+    //! Recounts the layer emitting the signal if its counts included the rolled back edits
+    void onAfterRollBack();
+
+  private:
+    //! Maximum number of features a commit modifies or deletes for them to be classified rather than recounted
+    static constexpr int MaximumClassifiedFeatures = 1000;
+
+    struct CountSource;
+
+    struct LayerCounts
+    {
+        //! Revision of the data the counts were computed for, empty if it can't be determined or is being determined
+        QString revision;
+        //! Description of the renderer the symbol counts were computed for
+        QString renderer;
+        qint64 total = -1;
+        QHash<QString, qint64> symbols;
+        bool symbolsValid = false;
+        //! Whether the counts left out uncommitted edits, commits can then be applied to them
+        bool committed = true;
+        //! Whether the counts were checked against the layer since being loaded
+        bool verified = false;
+        //! Ticket of the pending count, 0 if none
+        quint64 ticket = 0;
+        //! Ticket of the pending revision check, 0 if none
+        quint64 revisionTicket = 0;
+        //! Committed features the pending commit modifies or deletes
+        QgsFeatureIds leavingFids;
+        //! Symbols of the committed features the pending commit modifies or deletes
+        QHash<QString, qint64> leavingSymbols;
+        //! Whether the features the pending commit modifies or deletes were classified
+        bool leavingClassified = false;
+    };
+
+    struct Counts
+    {
+        qint64 total = 0;
+        QHash<QString, qint64> symbols;
+        //! Revision of the data determined before counting, if asked for
+        QString revision;
+    };
+
+    //! Returns the counts of a \a layer, scheduling what is missing
+    LayerCounts &countsFor( QgsVectorLayer *layer );
+
+    /**
+     * Counts the features of a \a layer, or only the features with given \a fids, in the background.
+     * The revision of the data is determined beforehand if \a withRevision is TRUE.
+     */
+    quint64 count( QgsVectorLayer *layer, const QgsFeatureIds &fids, bool withRevision, std::function<void( const Counts & )> callback );
+
+    //! Counts the features of a \a source, in the calling thread
+    static Counts countFeatures( CountSource &source, QgsFeedback *feedback );
+
+    //! Schedules a count of all the features of a \a layer, replacing any pending one
+    void recount( QgsVectorLayer *layer );
+
+    /**
+     * Determines the revision of the data of a \a layer in the background. Counts without
+     * a revision, which commits were applied to, take it. Counts computed for another
+     * revision are discarded and recounted.
+     */
+    void checkRevision( QgsVectorLayer *layer );
+
+    //! Returns the revision of the data of a layer given by its \a providerType, \a source and \a subsetString, empty if it can't be determined
+    static QString layerRevision( const QString &providerType, const QString &source, const QString &subsetString );
+
+    //! Returns the revision of the content of the GeoPackage at \a path, limited to \a tableName if not empty
+    static QString geopackageRevision( const QString &path, const QString &tableName );
+
+    //! Returns the description of the renderer of a \a layer
+    static QString rendererDescription( QgsVectorLayer *layer );
+
+    void load();
+    void save() const;
+
+    QgsProject *mProject = nullptr;
+    QString mPath;
+    QHash<QString, LayerCounts> mCounts;
+};
+
+#endif // FEATURECOUNTCACHE_H
@@ -18,23 +18,21 @@
 #ifndef FEATUREEXPRESSIONVALUESGATHERER_H
 #define FEATUREEXPRESSIONVALUESGATHERER_H
 
-#include <QMutex>
-#include <QThread>
 #include <qgsapplication.h>
 #include <qgsfeature.h>
+#include <qgsfeedback.h>
 #include <qgslogger.h>
 #include <qgsvectorlayer.h>
 #include <qgsvectorlayerfeatureiterator.h>
 
 /**
  * Gathers features with substring matching on an expression.
- * \note This is a is an exact copy of QGIS' QgsFeatureExpressionValuesGatherer
+ * Gathering runs synchronously, gatherers are meant to be handed to the FeatureQueryExecutor.
+ * \note This is adapted from QGIS' QgsFeatureExpressionValuesGatherer
  * \ingroup core
  */
-class FeatureExpressionValuesGatherer : public QThread
+class FeatureExpressionValuesGatherer
 {
-    Q_OBJECT
-
   public:
     /**
        * Constructor
@@ -48,6 +46,7 @@ class FeatureExpressionValuesGatherer : public QThread
                                               const QgsFeatureRequest &request = QgsFeatureRequest(),
                                               const QStringList &identifierFields = QStringList() )
       : mSource( new QgsVectorLayerFeatureSource( layer ) )
+      , mLayerId( layer->id() )
       , mDisplayExpression( displayExpression.isEmpty() ? layer->displayExpression() : displayExpression )
       , mExpressionContext( layer->createExpressionContext() )
       , mRequest( request )
@@ -85,11 +84,19 @@ class FeatureExpressionValuesGatherer : public QThread
       return Entry( QVariantList(), QgsApplication::nullRepresentation(), QgsFeature( layer->fields() ) );
     }
 
-    void run() override
+    /**
+     * Gathers the entries of the features matching the request, stopping early when
+     * the \a feedback is canceled. Can be called from any thread, one call at a time.
+     */
+    QVector<Entry> gather( QgsFeedback *feedback = nullptr )
     {
-      mWasCanceled = false;
+      QVector<Entry> entries;
 
-      QgsFeatureIterator iterator = mSource->getFeatures( mRequest );
+      QgsFeatureRequest request( mRequest );
+      if ( feedback )
+        request.setFeedback( feedback );
+
+      QgsFeatureIterator iterator = mSource->getFeatures( request );
 
       mDisplayExpression.prepare( &mExpressionContext );
 
@@ -107,66 +114,61 @@ class FeatureExpressionValuesGatherer : public QThread
 
         const QString expressionValue = mDisplayExpression.evaluate( &mExpressionContext ).toString();
 
-        mEntries.append( Entry( attributes, expressionValue, feature ) );
+        entries.append( Entry( attributes, expressionValue, feature ) );
 
-        QMutexLocker locker( &mCancelMutex );
-        if ( mWasCanceled )
-          return;
+        if ( feedback && feedback->isCanceled() )
+          break;
       }
-    }
-
-    //! Informs the gatherer to immediately stop collecting values
-    void stop()
-    {
-      QMutexLocker locker( &mCancelMutex );
-      mWasCanceled = true;
-    }
-
-    //! Returns TRUE if collection was canceled before completion
-    bool wasCanceled() const
-    {
-      QMutexLocker locker( &mCancelMutex );
-      return mWasCanceled;
-    }
 
-    QVector<Entry> entries() const
-    {
-      return mEntries;
-    }
-
-    QgsFeatureRequest request() const
-    {
-      return mRequest;
+      return entries;
     }
 
     /**
-     * Internal data, use for whatever you want.
+     * Returns a key describing what is gathered, identical for gatherers returning identical entries.
+     * The key doesn't account for the expression context of the request filter, gatherers whose
+     * filter depends on more than the layer and project scopes shouldn't share their entries.
      */
-    QVariant data() const
+    QString key() const
     {
-      return mData;
+      QStringList parts;
+      parts << mLayerId
+            << mDisplayExpression.expression()
+            << mIdentifierFields.join( ',' )
+            << QString::number( static_cast<int>( mRequest.filterType() ) )
+            << mRequest.filterExpression()
+            << mRequest.filterRect().toString( 12 )
+            << mRequest.destinationCrs().authid()
+            << QString::number( mRequest.limit() )
+            << QString::number( static_cast<int>( mRequest.flags() ) );
+
+      QStringList fids;
+      const QgsFeatureIds filterFids = mRequest.filterFids();
+      for ( const QgsFeatureId fid : filterFids )
+        fids << QString::number( fid );
+      std::sort( fids.begin(), fids.end() );
+      parts << fids.join( ',' );
+
+      QStringList attributes;
+      const QgsAttributeList subset = mRequest.subsetOfAttributes();
+      for ( const int index : subset )
+        attributes << QString::number( index );
+      parts << attributes.join( ',' );
+
+      return parts.join( QChar( 0x1f ) );
     }
 
-    /**
-     * Internal data, use for whatever you want.
-     */
-    void setData( const QVariant &data )
+    QgsFeatureRequest request() const
     {
-      mData = data;
+      return mRequest;
     }
 
-  protected:
-    QVector<Entry> mEntries;
-
   private:
     std::unique_ptr<QgsVectorLayerFeatureSource> mSource;
+    QString mLayerId;
     QgsExpression mDisplayExpression;
     QgsExpressionContext mExpressionContext;
     QgsFeatureRequest mRequest;
-    bool mWasCanceled = false;
-    mutable QMutex mCancelMutex;
     QStringList mIdentifierFields;
-    QVariant mData;
 };
 
 #endif // FEATUREEXPRESSIONVALUESGATHERER_H
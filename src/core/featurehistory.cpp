@@ -1,15 +1,130 @@
 #include "featurehistory.h"
 
+#include <QDataStream>
+#include <QFileInfo>
 #include <qgsmessagelog.h>
 #include <qgsvectorlayer.h>
 #include <qgsvectorlayereditbuffer.h>
 
 #include <tracker.h>
 
+#include <algorithm>
+
+static void writeFeature( QDataStream &stream, const QgsFeature &feature )
+{
+  const QgsAttributes attributes = feature.attributes();
+  stream << static_cast<qint64>( feature.id() ) << static_cast<qint32>( attributes.size() );
+  for ( const QVariant &attribute : attributes )
+    stream << attribute;
+  stream << ( feature.hasGeometry() ? feature.geometry().asWkb() : QByteArray() );
+}
+
+static QgsFeature readFeature( QDataStream &stream )
+{
+  qint64 fid = FID_NULL;
+  qint32 attributeCount = 0;
+  stream >> fid >> attributeCount;
+
+  QgsAttributes attributes( attributeCount );
+  for ( qint32 i = 0; i < attributeCount && stream.status() == QDataStream::Ok; ++i )
+    stream >> attributes[i];
+
+  QByteArray wkb;
+  stream >> wkb;
+
+  QgsFeature feature( fid );
+  feature.setAttributes( attributes );
+  if ( !wkb.isEmpty() )
+  {
+    QgsGeometry geometry;
+    geometry.fromWkb( wkb );
+    feature.setGeometry( geometry );
+  }
+  return feature;
+}
+
+static QByteArray serializeModifications( const QMap<QString, FeatureHistory::FeatureModifications> &modificationsByLayerId )
+{
+  QByteArray data;
+  QDataStream stream( &data, QIODevice::WriteOnly );
+  stream.setVersion( QDataStream::Qt_6_0 );
+
+  stream << static_cast<qint32>( modificationsByLayerId.size() );
+  for ( auto it = modificationsByLayerId.constBegin(); it != modificationsByLayerId.constEnd(); ++it )
+  {
+    const FeatureHistory::FeatureModifications &modifications = it.value();
+    stream << it.key();
+
+    stream << static_cast<qint32>( modifications.createdFeatures.size() );
+    for ( const QgsFeature &feature : modifications.createdFeatures )
+      writeFeature( stream, feature );
+
+    stream << static_cast<qint32>( modifications.updatedFeatures.size() );
+    for ( const FeatureHistory::FeatureDiff &diff : modifications.updatedFeatures )
+    {
+      stream << static_cast<qint64>( diff.fid ) << diff.oldAttributes << diff.newAttributes << diff.geometryChanged;
+      if ( diff.geometryChanged )
+        stream << static_cast<qint32>( diff.geometryOffset ) << diff.oldGeometryBytes << diff.newGeometryBytes << diff.oldGeometryChecksum << diff.newGeometryChecksum;
+    }
+
+    stream << static_cast<qint32>( modifications.deletedFeatures.size() );
+    for ( const QgsFeature &feature : modifications.deletedFeatures )
+      writeFeature( stream, feature );
+  }
+
+  return data;
+}
+
+static bool deserializeModifications( const QByteArray &data, QMap<QString, FeatureHistory::FeatureModifications> &modificationsByLayerId )
+{
+  QDataStream stream( data );
+  stream.setVersion( QDataStream::Qt_6_0 );
+
+  qint32 layerCount = 0;
+  stream >> layerCount;
+  for ( qint32 i = 0; i < layerCount && stream.status() == QDataStream::Ok; ++i )
+  {
+    QString layerId;
+    FeatureHistory::FeatureModifications modifications;
+    stream >> layerId;
+
+    qint32 count = 0;
+    stream >> count;
+    for ( qint32 j = 0; j < count && stream.status() == QDataStream::Ok; ++j )
+      modifications.createdFeatures << readFeature( stream );
+
+    stream >> count;
+    for ( qint32 j = 0; j < count && stream.status() == QDataStream::Ok; ++j )
+    {
+      FeatureHistory::FeatureDiff diff;
+      qint64 fid = FID_NULL;
+      stream >> fid >> diff.oldAttributes >> diff.newAttributes >> diff.geometryChanged;
+      diff.fid = fid;
+      if ( diff.geometryChanged )
+      {
+        qint32 offset = 0;
+        stream >> offset >> diff.oldGeometryBytes >> diff.newGeometryBytes >> diff.oldGeometryChecksum >> diff.newGeometryChecksum;
+        diff.geometryOffset = offset;
+      }
+      modifications.updatedFeatures << diff;
+    }
+
+    stream >> count;
+    for ( qint32 j = 0; j < count && stream.status() == QDataStream::Ok; ++j )
+      modifications.deletedFeatures << readFeature( stream );
+
+    modificationsByLayerId.insert( layerId, modifications );
+  }
+
+  return stream.status() == QDataStream::Ok;
+}
+
 FeatureHistory::FeatureHistory( const QgsProject *project, TrackingModel *trackingModel )
   : mProject( project )
   , mTrackingModel( trackingModel )
 {
+  mStepCache.setMaxCost( mMemoryBudget );
+
   connect( mProject, &QgsProject::homePathChanged, this, &FeatureHistory::onHomePathChanged );
   connect( mProject, &QgsProject::layersAdded, this, &FeatureHistory::onLayersAdded );
   connect( &mTimer, &QTimer::timeout, this, &FeatureHistory::onTimerTimeout );
@@ -26,6 +141,92 @@ void FeatureHistory::onHomePathChanged()
   mObservedLayerIds.clear();
 
   addLayerListeners();
+  openJournal();
+}
+
+void FeatureHistory::openJournal()
+{
+  mTimer.stop();
+  mTempHistoryStep.clear();
+  mPendingCommits.clear();
+  mStepCache.clear();
+
+  // Projects which are not saved yet get a journal living as long as they are opened
+  const QFileInfo projectFileInfo( mProject->fileName() );
+  const QString path = projectFileInfo.exists()
+                         ? QStringLiteral( "%1/.%2.history.sqlite" ).arg( projectFileInfo.absolutePath(), projectFileInfo.completeBaseName() )
+                         : QStringLiteral( ":memory:" );
+  if ( path != mJournal.path() || path == QLatin1String( ":memory:" ) || !mJournal.isOpen() )
+  {
+    if ( !mJournal.open( path ) )
+      mJournal.open( QStringLiteral( ":memory:" ) );
+  }
+
+  mUndoSteps = mJournal.steps( FeatureHistoryJournal::Stack::Undo );
+  mRedoSteps = mJournal.steps( FeatureHistoryJournal::Stack::Redo );
+  trimSteps();
+
+  emit isUndoAvailableChanged();
+  emit isRedoAvailableChanged();
+}
+
+void FeatureHistory::setMaximumSteps( int maximumSteps )
+{
+  if ( mMaximumSteps == maximumSteps )
+    return;
+
+  mMaximumSteps = std::max( maximumSteps, 1 );
+  trimSteps();
+
+  emit maximumStepsChanged();
+  emit isUndoAvailableChanged();
+}
+
+void FeatureHistory::setMemoryBudget( qint64 memoryBudget )
+{
+  if ( mMemoryBudget == memoryBudget )
+    return;
+
+  mMemoryBudget = std::max<qint64>( memoryBudget, 0 );
+  mStepCache.setMaxCost( mMemoryBudget );
+
+  emit memoryBudgetChanged();
+}
+
+void FeatureHistory::trimSteps()
+{
+  while ( mUndoSteps.size() > mMaximumSteps )
+  {
+    const FeatureHistoryJournal::Step step = mUndoSteps.takeFirst();
+    mJournal.remove( step.id );
+    mStepCache.remove( step.id );
+  }
+}
+
+void FeatureHistory::bytesDelta( const QByteArray &from, const QByteArray &to, int &offset, QByteArray &fromBytes, QByteArray &toBytes )
+{
+  const qsizetype length = std::min( from.size(), to.size() );
+
+  qsizetype prefix = 0;
+  while ( prefix < length && from.at( prefix ) == to.at( prefix ) )
+    prefix++;
+
+  qsizetype suffix = 0;
+  while ( suffix < length - prefix && from.at( from.size() - 1 - suffix ) == to.at( to.size() - 1 - suffix ) )
+    suffix++;
+
+  offset = static_cast<int>( prefix );
+  fromBytes = from.mid( prefix, from.size() - prefix - suffix );
+  toBytes = to.mid( prefix, to.size() - prefix - suffix );
+}
+
+bool FeatureHistory::applyBytesDelta( QByteArray &bytes, int offset, const QByteArray &expected, const QByteArray &replacement )
+{
+  if ( offset < 0 || offset + expected.size() > bytes.size() || bytes.mid( offset, expected.size() ) != expected )
+    return false;
+
+  bytes.replace( offset, expected.size(), replacement );
+  return true;
 }
 
 void FeatureHistory::addLayerListeners()
@@ -50,12 +251,10 @@ void FeatureHistory::addLayerListeners()
     disconnect( vl, &QgsVectorLayer::beforeCommitChanges, this, &FeatureHistory::onBeforeCommitChanges );
     disconnect( vl, &QgsVectorLayer::afterCommitChanges, this, &FeatureHistory::onAfterCommitChanges );
     disconnect( vl, &QgsVectorLayer::committedFeaturesAdded, this, &FeatureHistory::onCommittedFeaturesAdded );
-    disconnect( vl, &QgsVectorLayer::committedFeaturesRemoved, this, &FeatureHistory::onCommittedFeaturesRemoved );
 
     connect( vl, &QgsVectorLayer::beforeCommitChanges, this, &FeatureHistory::onBeforeCommitChanges );
     connect( vl, &QgsVectorLayer::afterCommitChanges, this, &FeatureHistory::onAfterCommitChanges );
     connect( vl, &QgsVectorLayer::committedFeaturesAdded, this, &FeatureHistory::onCommittedFeaturesAdded );
-    connect( vl, &QgsVectorLayer::committedFeaturesRemoved, this, &FeatureHistory::onCommittedFeaturesRemoved );
 
     mObservedLayerIds.insert( vl->id() );
   }
@@ -84,33 +283,76 @@ void FeatureHistory::onBeforeCommitChanges()
   }
 
   const QgsFeatureIds deletedFids = eb->deletedFeatureIds();
-  const QgsFeatureIds changedGeometriesFids = qgis::listToSet( eb->changedGeometries().keys() );
-  const QgsFeatureIds changedAttributesFids = qgis::listToSet( eb->changedAttributeValues().keys() );
-  // NOTE QgsFeatureIds underlying implementation is QSet, so no need to check if the QgsFeatureId already exists
-  QgsFeatureIds changedFids;
-
-  for ( const QgsFeatureId fid : deletedFids )
-    changedFids.insert( fid );
+  const QgsGeometryMap changedGeometries = eb->changedGeometries();
+  const QgsChangedAttributesMap changedAttributes = eb->changedAttributeValues();
+  const QgsFields fields = vl->fields();
 
-  for ( const QgsFeatureId fid : changedGeometriesFids )
-    changedFids.insert( fid );
-
-  for ( const QgsFeatureId fid : changedAttributesFids )
-    changedFids.insert( fid );
+  PendingCommit pendingCommit;
 
   // NOTE we read the features from the dataProvider directly as we want to access the old values.
   // If we use the layer, we get the values from the edit buffer.
-  QgsFeatureIterator featuresIt = vl->dataProvider()->getFeatures( QgsFeatureRequest( changedFids ) );
-  QMap<QgsFeatureId, QgsFeature> modifiedFeatures;
-  QgsFeature f;
+  // Deleted features are kept whole to be restored.
+  if ( !deletedFids.isEmpty() )
+  {
+    QgsFeatureIterator featuresIt = vl->dataProvider()->getFeatures( QgsFeatureRequest( deletedFids ) );
+    QgsFeature f;
+    while ( featuresIt.nextFeature( f ) )
+      pendingCommit.deletedFeatures << f;
+  }
 
-  while ( featuresIt.nextFeature( f ) )
-    modifiedFeatures.insert( f.id(), f );
+  // Only the changed attributes and geometries of updated features are read, to compute their diffs
+  QgsFeatureIds updatedFids;
+  QSet<int> providerAttributes;
+  for ( auto it = changedAttributes.constBegin(); it != changedAttributes.constEnd(); ++it )
+  {
+    updatedFids.insert( it.key() );
+    for ( auto attributeIt = it.value().constBegin(); attributeIt != it.value().constEnd(); ++attributeIt )
+    {
+      if ( fields.fieldOrigin( attributeIt.key() ) == Qgis::FieldOrigin::Provider )
+        providerAttributes.insert( fields.fieldOriginIndex( attributeIt.key() ) );
+    }
+  }
+  for ( auto it = changedGeometries.constBegin(); it != changedGeometries.constEnd(); ++it )
+    updatedFids.insert( it.key() );
+  updatedFids.subtract( deletedFids );
+
+  if ( !updatedFids.isEmpty() )
+  {
+    QgsFeatureRequest request( updatedFids );
+    request.setSubsetOfAttributes( qgis::setToList( providerAttributes ) );
+    if ( changedGeometries.isEmpty() )
+      request.setFlags( Qgis::FeatureRequestFlag::NoGeometry );
+
+    QgsFeatureIterator featuresIt = vl->dataProvider()->getFeatures( request );
+    QgsFeature f;
+    while ( featuresIt.nextFeature( f ) )
+    {
+      FeatureDiff diff;
+      diff.fid = f.id();
+
+      const QgsAttributeMap newAttributes = changedAttributes.value( f.id() );
+      for ( auto it = newAttributes.constBegin(); it != newAttributes.constEnd(); ++it )
+      {
+        if ( fields.fieldOrigin( it.key() ) != Qgis::FieldOrigin::Provider )
+          continue;
+
+        const QVariant oldValue = f.attribute( fields.fieldOriginIndex( it.key() ) );
+        if ( oldValue != it.value() )
+        {
+          diff.oldAttributes.insert( it.key(), oldValue );
+          diff.newAttributes.insert( it.key(), it.value() );
+        }
+      }
+
+      if ( changedGeometries.contains( f.id() ) )
+        pendingCommit.oldGeometries.insert( f.id(), f.hasGeometry() ? f.geometry().asWkb() : QByteArray() );
 
-  qInfo() << "FeatureHistory::onBeforeCommitChanges: vl->id()=" << vl->id() << "changedFids=" << changedFids;
+      pendingCommit.updatedFeatures.insert( f.id(), diff );
+    }
+  }
 
   // NOTE no need to keep track of added features, as they are always present in the layer after commit
-  mTempModifiedFeaturesByLayerId.insert( vl->id(), modifiedFeatures );
+  mPendingCommits.insert( vl->id(), pendingCommit );
 }
 
 
@@ -128,28 +370,16 @@ void FeatureHistory::onCommittedFeaturesAdded( const QString &localLayerId, cons
     return;
   }
 
-  qDebug() << "FeatureHistory::onCommittedFeaturesAdded: adding create committed features";
-
   FeatureModifications modifications = mTempHistoryStep.take( vl->id() );
 
   for ( const QgsFeature &f : addedFeatures )
   {
-    modifications.createdFeatures.append( OldNewFeaturePair( QgsFeature(), f ) );
+    modifications.createdFeatures.append( f );
   }
 
   mTempHistoryStep.insert( vl->id(), modifications );
 }
 
-void FeatureHistory::onCommittedFeaturesRemoved( const QString &layerId, const QgsFeatureIds &deletedFeatureIds )
-{
-  if ( mIsApplyingModifications )
-  {
-    return;
-  }
-
-  mTempDeletedFeatureIdsByLayerId.insert( layerId, deletedFeatureIds );
-}
-
 void FeatureHistory::onAfterCommitChanges()
 {
   if ( mIsApplyingModifications )
@@ -166,23 +396,38 @@ void FeatureHistory::onAfterCommitChanges()
 
   const QString layerId = vl->id();
   FeatureModifications modifications = mTempHistoryStep.take( layerId );
-  QMap<QgsFeatureId, QgsFeature> modifiedFeaturesOld = mTempModifiedFeaturesByLayerId.take( layerId );
-  const QgsFeatureIds deletedFids = mTempDeletedFeatureIdsByLayerId.take( layerId );
+  PendingCommit pendingCommit = mPendingCommits.take( layerId );
 
-  for ( const QgsFeatureId &deletedFid : deletedFids )
+  modifications.deletedFeatures = pendingCommit.deletedFeatures;
+
+  // Geometries are diffed against their committed version, which the provider may have altered
+  if ( !pendingCommit.oldGeometries.isEmpty() )
   {
-    OldNewFeaturePair oldNewFeaturePair( modifiedFeaturesOld.take( deletedFid ), QgsFeature() );
-    modifications.deletedFeatures.append( oldNewFeaturePair );
-  }
+    QgsFeatureRequest request( qgis::listToSet( pendingCommit.oldGeometries.keys() ) );
+    request.setNoAttributes();
 
-  const QgsFeatureIds modifiedFids = qgis::listToSet( modifiedFeaturesOld.keys() );
-  QgsFeatureIterator featuresIt = vl->getFeatures( QgsFeatureRequest( modifiedFids ) );
-  QgsFeature f;
+    QgsFeatureIterator featuresIt = vl->getFeatures( request );
+    QgsFeature f;
+    while ( featuresIt.nextFeature( f ) )
+    {
+      const QByteArray oldWkb = pendingCommit.oldGeometries.take( f.id() );
+      const QByteArray newWkb = f.hasGeometry() ? f.geometry().asWkb() : QByteArray();
+      if ( oldWkb == newWkb )
+        continue;
+
+      FeatureDiff &diff = pendingCommit.updatedFeatures[f.id()];
+      diff.fid = f.id();
+      diff.geometryChanged = true;
+      diff.oldGeometryChecksum = qChecksum( oldWkb );
+      diff.newGeometryChecksum = qChecksum( newWkb );
+      bytesDelta( oldWkb, newWkb, diff.geometryOffset, diff.oldGeometryBytes, diff.newGeometryBytes );
+    }
+  }
 
-  while ( featuresIt.nextFeature( f ) )
+  for ( const FeatureDiff &diff : std::as_const( pendingCommit.updatedFeatures ) )
   {
-    OldNewFeaturePair oldNewFeaturePair( modifiedFeaturesOld.take( f.id() ), f );
-    modifications.updatedFeatures.append( oldNewFeaturePair );
+    if ( !diff.newAttributes.isEmpty() || diff.geometryChanged )
+      modifications.updatedFeatures << diff;
   }
 
   if ( !modifications.createdFeatures.isEmpty() || !modifications.updatedFeatures.isEmpty() || !modifications.deletedFeatures.isEmpty() )
@@ -205,68 +450,70 @@ void FeatureHistory::onLayerInTrackingChanged( QgsVectorLayer *vl, bool isTracki
     disconnect( vl, &QgsVectorLayer::beforeCommitChanges, this, &FeatureHistory::onBeforeCommitChanges );
     disconnect( vl, &QgsVectorLayer::afterCommitChanges, this, &FeatureHistory::onAfterCommitChanges );
     disconnect( vl, &QgsVectorLayer::committedFeaturesAdded, this, &FeatureHistory::onCommittedFeaturesAdded );
-    disconnect( vl, &QgsVectorLayer::committedFeaturesRemoved, this, &FeatureHistory::onCommittedFeaturesRemoved );
   }
   else
   {
     connect( vl, &QgsVectorLayer::beforeCommitChanges, this, &FeatureHistory::onBeforeCommitChanges );
     connect( vl, &QgsVectorLayer::afterCommitChanges, this, &FeatureHistory::onAfterCommitChanges );
     connect( vl, &QgsVectorLayer::committedFeaturesAdded, this, &FeatureHistory::onCommittedFeaturesAdded );
-    connect( vl, &QgsVectorLayer::committedFeaturesRemoved, this, &FeatureHistory::onCommittedFeaturesRemoved );
   }
 }
 
 void FeatureHistory::onTimerTimeout()
 {
   mTimer.stop();
-  mUndoHistory.append( mTempHistoryStep );
+
+  FeatureHistoryJournal::Step step;
+  for ( auto it = mTempHistoryStep.constBegin(); it != mTempHistoryStep.constEnd(); ++it )
+  {
+    step.createdCount += static_cast<int>( it.value().createdFeatures.size() );
+    step.updatedCount += static_cast<int>( it.value().updatedFeatures.size() );
+    step.deletedCount += static_cast<int>( it.value().deletedFeatures.size() );
+  }
+  if ( mTempHistoryStep.size() == 1 )
+    step.layerId = mTempHistoryStep.firstKey();
+
+  const QByteArray data = serializeModifications( mTempHistoryStep );
+  step.size = data.size();
+  step.id = mJournal.append( step, data );
+  if ( step.id > 0 )
+  {
+    mUndoSteps.append( step );
+    mStepCache.insert( step.id, new QMap<QString, FeatureModifications>( mTempHistoryStep ), step.size );
+  }
   mTempHistoryStep.clear();
-  mRedoHistory.clear();
+
+  for ( const FeatureHistoryJournal::Step &redoStep : std::as_const( mRedoSteps ) )
+    mStepCache.remove( redoStep.id );
+  mRedoSteps.clear();
+  mJournal.clear( FeatureHistoryJournal::Stack::Redo );
+
+  trimSteps();
 
   emit isUndoAvailableChanged();
   emit isRedoAvailableChanged();
 }
 
-QMap<QString, FeatureHistory::FeatureModifications> FeatureHistory::reverseModifications( QMap<QString, FeatureModifications> &modificationsByLayerId )
+QMap<QString, FeatureHistory::FeatureModifications> FeatureHistory::loadStep( const FeatureHistoryJournal::Step &step )
 {
-  QMap<QString, FeatureModifications> reversedModificationsByLayerId;
-
-  const QStringList layerIds = modificationsByLayerId.keys();
-  for ( const QString &layerId : layerIds )
+  if ( const QMap<QString, FeatureModifications> *modifications = mStepCache.object( step.id ) )
   {
-    QgsVectorLayer *vl = qobject_cast<QgsVectorLayer *>( mProject->mapLayer( layerId ) );
-
-    if ( !vl )
-    {
-      continue;
-    }
-
-    FeatureModifications modifications = modificationsByLayerId.value( layerId );
-    FeatureModifications reversedModifications;
-
-    for ( const OldNewFeaturePair &pair : modifications.deletedFeatures )
-    {
-      reversedModifications.createdFeatures.append( OldNewFeaturePair( pair.second, pair.first ) );
-    }
-
-    for ( const OldNewFeaturePair &pair : modifications.createdFeatures )
-    {
-      reversedModifications.deletedFeatures.append( OldNewFeaturePair( pair.second, pair.first ) );
-    }
-
-    for ( const OldNewFeaturePair &pair : modifications.updatedFeatures )
-    {
-      reversedModifications.updatedFeatures.append( OldNewFeaturePair( pair.second, pair.first ) );
-    }
+    return *modifications;
+  }
 
-    reversedModificationsByLayerId.insert( layerId, reversedModifications );
+  QMap<QString, FeatureModifications> modifications;
+  if ( !deserializeModifications( mJournal.data( step.id ), modifications ) )
+  {
+    QgsMessageLog::logMessage( tr( "Failed to read a step of the feature history" ) );
+    return QMap<QString, FeatureModifications>();
   }
 
-  return reversedModificationsByLayerId;
+  mStepCache.insert( step.id, new QMap<QString, FeatureModifications>( modifications ), step.size );
+  return modifications;
 }
 
 
-bool FeatureHistory::applyModifications( QMap<QString, FeatureModifications> &modificationsByLayerId )
+bool FeatureHistory::applyModifications( const QMap<QString, FeatureModifications> &modificationsByLayerId, bool forward )
 {
   mIsApplyingModifications = true;
 
@@ -281,65 +528,85 @@ bool FeatureHistory::applyModifications( QMap<QString, FeatureModifications> &mo
       continue;
     }
 
-    FeatureModifications undoFeatureModifications = modificationsByLayerId.value( layerId );
+    const FeatureModifications &modifications = modificationsByLayerId[layerId];
 
     if ( !vl->startEditing() )
     {
+      mIsApplyingModifications = false;
       return false;
     }
 
-    // created features
+    auto fail = [this, vl]( const QString &message ) {
+      QgsMessageLog::logMessage( message );
+      if ( !vl->rollBack() )
+      {
+        QgsMessageLog::logMessage( tr( "Failed to rollback undo feature modifications in layer \"%1\"" ).arg( vl->name() ) );
+      }
+      mIsApplyingModifications = false;
+      return false;
+    };
+
+    // undoing removes the created features and restores the deleted ones, redoing the opposite
+    const QgsFeatureList &featuresToRemove = forward ? modifications.deletedFeatures : modifications.createdFeatures;
+    const QgsFeatureList &featuresToRestore = forward ? modifications.createdFeatures : modifications.deletedFeatures;
+
     QgsFeatureIds fidsToDelete;
-    for ( const OldNewFeaturePair &pair : undoFeatureModifications.createdFeatures )
+    for ( const QgsFeature &feature : featuresToRemove )
     {
-      fidsToDelete << pair.second.id();
+      fidsToDelete << feature.id();
     }
 
-    if ( !undoFeatureModifications.createdFeatures.isEmpty() && !vl->deleteFeatures( fidsToDelete ) )
+    if ( !fidsToDelete.isEmpty() && !vl->deleteFeatures( fidsToDelete ) )
     {
-      QgsMessageLog::logMessage( tr( "Failed to undo created features in layer \"%1\"" ).arg( vl->name() ) );
-      return false;
+      return fail( tr( "Failed to undo created features in layer \"%1\"" ).arg( vl->name() ) );
     }
 
-    // deleted features
     QgsFeatureList featuresToAdd;
-    for ( const OldNewFeaturePair &pair : undoFeatureModifications.deletedFeatures )
+    for ( QgsFeature feature : featuresToRestore )
     {
-      featuresToAdd.append( pair.first );
+      feature.setFields( vl->fields(), false );
+      featuresToAdd.append( feature );
     }
 
-    if ( !undoFeatureModifications.deletedFeatures.isEmpty() && !vl->addFeatures( featuresToAdd ) )
+    if ( !featuresToAdd.isEmpty() && !vl->addFeatures( featuresToAdd ) )
     {
-      QgsMessageLog::logMessage( tr( "Failed to undo deleted features in layer \"%1\"" ).arg( vl->name() ) );
-      return false;
+      return fail( tr( "Failed to undo deleted features in layer \"%1\"" ).arg( vl->name() ) );
     }
 
     // update features
-    QgsFeatureIds featureIds;
-    for ( const OldNewFeaturePair &pair : undoFeatureModifications.updatedFeatures )
+    for ( const FeatureDiff &diff : modifications.updatedFeatures )
     {
-      featureIds.insert( pair.first.id() );
-    }
+      const QgsAttributeMap &targetAttributes = forward ? diff.newAttributes : diff.oldAttributes;
+      const QgsAttributeMap &currentAttributes = forward ? diff.oldAttributes : diff.newAttributes;
+      if ( !targetAttributes.isEmpty() && !vl->changeAttributeValues( diff.fid, targetAttributes, currentAttributes, true ) )
+      {
+        return fail( tr( "Failed to undo update features in layer \"%1\"" ).arg( vl->name() ) );
+      }
 
-    for ( OldNewFeaturePair &pair : undoFeatureModifications.updatedFeatures )
-    {
-      if ( !vl->updateFeature( pair.first, true ) )
+      if ( diff.geometryChanged )
       {
-        QgsMessageLog::logMessage( tr( "Failed to undo update features in layer \"%1\"" ).arg( vl->name() ) );
-        return false;
+        const QgsGeometry currentGeometry = vl->getGeometry( diff.fid );
+        QByteArray wkb = currentGeometry.isNull() ? QByteArray() : currentGeometry.asWkb();
+        if ( qChecksum( wkb ) != ( forward ? diff.oldGeometryChecksum : diff.newGeometryChecksum )
+             || !applyBytesDelta( wkb, diff.geometryOffset, forward ? diff.oldGeometryBytes : diff.newGeometryBytes, forward ? diff.newGeometryBytes : diff.oldGeometryBytes ) )
+        {
+          // The geometry was modified outside of the history, the diff doesn't apply anymore
+          return fail( tr( "Failed to undo update features in layer \"%1\"" ).arg( vl->name() ) );
+        }
+
+        QgsGeometry geometry;
+        if ( !wkb.isEmpty() )
+          geometry.fromWkb( wkb );
+        if ( !vl->changeGeometry( diff.fid, geometry, true ) )
+        {
+          return fail( tr( "Failed to undo update features in layer \"%1\"" ).arg( vl->name() ) );
+        }
       }
     }
 
     if ( !vl->commitChanges() )
     {
-      QgsMessageLog::logMessage( tr( "Failed to commit undo feature modification in layer \"%1\"" ).arg( vl->name() ) );
-
-      if ( !vl->rollBack() )
-      {
-        QgsMessageLog::logMessage( tr( "Failed to rollback undo feature modifications in layer \"%1\"" ).arg( vl->name() ) );
-      }
-
-      return false;
+      return fail( tr( "Failed to commit undo feature modification in layer \"%1\"" ).arg( vl->name() ) );
     }
   }
 
@@ -350,20 +617,32 @@ bool FeatureHistory::applyModifications( QMap<QString, FeatureModifications> &mo
 
 bool FeatureHistory::undo()
 {
-  if ( mUndoHistory.isEmpty() )
+  if ( mUndoSteps.isEmpty() )
   {
     return false;
   }
 
-  QMap<QString, FeatureModifications> modifications = mUndoHistory.takeLast();
-  QMap<QString, FeatureModifications> reversedModifications = reverseModifications( modifications );
+  const FeatureHistoryJournal::Step step = mUndoSteps.last();
+  const QMap<QString, FeatureModifications> modifications = loadStep( step );
 
-  if ( !applyModifications( modifications ) )
+  if ( modifications.isEmpty() )
   {
+    // The step could not be read, it is dropped so that it doesn't block the history
+    mUndoSteps.removeLast();
+    mJournal.remove( step.id );
+    emit isUndoAvailableChanged();
+    emit isRedoAvailableChanged();
     return false;
   }
 
-  mRedoHistory.append( reversedModifications );
+  if ( !applyModifications( modifications, false ) )
+  {
+    return false;
+  }
+
+  mUndoSteps.removeLast();
+  mRedoSteps.append( step );
+  mJournal.move( step.id, FeatureHistoryJournal::Stack::Redo );
 
   emit isUndoAvailableChanged();
   emit isRedoAvailableChanged();
@@ -374,20 +653,32 @@ bool FeatureHistory::undo()
 
 bool FeatureHistory::redo()
 {
-  if ( mRedoHistory.isEmpty() )
+  if ( mRedoSteps.isEmpty() )
   {
     return false;
   }
 
-  QMap<QString, FeatureModifications> modifications = mRedoHistory.takeLast();
-  QMap<QString, FeatureModifications> reversedModifications = reverseModifications( modifications );
+  const FeatureHistoryJournal::Step step = mRedoSteps.last();
+  const QMap<QString, FeatureModifications> modifications = loadStep( step );
+
+  if ( modifications.isEmpty() )
+  {
+    // The step could not be read, it is dropped so that it doesn't block the history
+    mRedoSteps.removeLast();
+    mJournal.remove( step.id );
+    emit isUndoAvailableChanged();
+    emit isRedoAvailableChanged();
+    return false;
+  }
 
-  if ( !applyModifications( modifications ) )
+  if ( !applyModifications( modifications, true ) )
   {
     return false;
   }
 
-  mUndoHistory.append( reversedModifications );
+  mRedoSteps.removeLast();
+  mUndoSteps.append( step );
+  mJournal.move( step.id, FeatureHistoryJournal::Stack::Undo );
 
   emit isUndoAvailableChanged();
   emit isRedoAvailableChanged();
@@ -398,97 +689,51 @@ bool FeatureHistory::redo()
 
 bool FeatureHistory::isUndoAvailable()
 {
-  return !mUndoHistory.isEmpty();
+  return !mUndoSteps.isEmpty();
 }
 
 
 bool FeatureHistory::isRedoAvailable()
 {
-  return !mRedoHistory.isEmpty();
+  return !mRedoSteps.isEmpty();
 }
 
 const QString FeatureHistory::undoMessage()
 {
-  if ( mUndoHistory.isEmpty() )
+  if ( mUndoSteps.isEmpty() )
   {
     return QString();
   }
 
-  int totalChanges = 0;
-  QMap<QString, FeatureModifications> modifiedFeaturesByLayerId = mUndoHistory.last();
-  QStringList layerIds;
-  bool hasCreatedFeatures = false;
-  bool hasUpdatedFeatures = false;
-  bool hasDeletedFeatures = false;
-  for ( const QString &layerId : modifiedFeaturesByLayerId.keys() )
-  {
-    if ( !layerIds.contains( layerId ) )
-    {
-      layerIds << layerId;
-    }
+  return stepMessage( mUndoSteps.last(), false );
+}
 
-    hasCreatedFeatures |= modifiedFeaturesByLayerId[layerId].createdFeatures.count() > 0;
-    hasUpdatedFeatures |= modifiedFeaturesByLayerId[layerId].updatedFeatures.count() > 0;
-    hasDeletedFeatures |= modifiedFeaturesByLayerId[layerId].deletedFeatures.count() > 0;
-    // cppcheck-suppress useStlAlgorithm
-    totalChanges += modifiedFeaturesByLayerId[layerId].createdFeatures.count()
-                    + modifiedFeaturesByLayerId[layerId].updatedFeatures.count()
-                    + modifiedFeaturesByLayerId[layerId].deletedFeatures.count();
-  }
 
-  if ( totalChanges > 0 )
+const QString FeatureHistory::redoMessage()
+{
+  if ( mRedoSteps.isEmpty() )
   {
-    QgsVectorLayer *vl = layerIds.size() == 1 ? qobject_cast<QgsVectorLayer *>( mProject->mapLayer( layerIds.first() ) ) : nullptr;
-    if ( hasCreatedFeatures && !hasUpdatedFeatures && !hasDeletedFeatures )
-    {
-      return vl ? tr( "Undo creation of %n feature(s) on layer %1.", "", totalChanges ).arg( vl->name() ) : tr( "Undo creation of %n feature(s).", "", totalChanges );
-    }
-    else if ( !hasCreatedFeatures && !hasUpdatedFeatures && hasDeletedFeatures )
-    {
-      return vl ? tr( "Undo deletion of %n feature(s) on layer %1.", "", totalChanges ).arg( vl->name() ) : tr( "Undo deletion of %n feature(s).", "", totalChanges );
-    }
-    else
-    {
-      return vl ? tr( "Undo modifications on %n feature(s) on layer %1.", "", totalChanges ).arg( vl->name() ) : tr( "Undo modifications on %n feature(s).", "", totalChanges );
-    }
+    return QString();
   }
 
-  return QString();
+  return stepMessage( mRedoSteps.last(), true );
 }
 
-
-const QString FeatureHistory::redoMessage()
+QString FeatureHistory::stepMessage( const FeatureHistoryJournal::Step &step, bool redo ) const
 {
-  if ( mRedoHistory.isEmpty() )
+  const int totalChanges = step.createdCount + step.updatedCount + step.deletedCount;
+  if ( totalChanges == 0 )
   {
     return QString();
   }
 
-  int totalChanges = 0;
-  QMap<QString, FeatureModifications> modifiedFeaturesByLayerId = mRedoHistory.last();
-  QStringList layerIds;
-  bool hasCreatedFeatures = false;
-  bool hasUpdatedFeatures = false;
-  bool hasDeletedFeatures = false;
-  for ( const QString &layerId : modifiedFeaturesByLayerId.keys() )
-  {
-    if ( !layerIds.contains( layerId ) )
-    {
-      layerIds << layerId;
-    }
+  const bool hasCreatedFeatures = step.createdCount > 0;
+  const bool hasUpdatedFeatures = step.updatedCount > 0;
+  const bool hasDeletedFeatures = step.deletedCount > 0;
+  QgsVectorLayer *vl = !step.layerId.isEmpty() ? qobject_cast<QgsVectorLayer *>( mProject->mapLayer( step.layerId ) ) : nullptr;
 
-    hasCreatedFeatures |= modifiedFeaturesByLayerId[layerId].deletedFeatures.count() > 0;
-    hasUpdatedFeatures |= modifiedFeaturesByLayerId[layerId].updatedFeatures.count() > 0;
-    hasDeletedFeatures |= modifiedFeaturesByLayerId[layerId].createdFeatures.count() > 0;
-    // cppcheck-suppress useStlAlgorithm
-    totalChanges += modifiedFeaturesByLayerId[layerId].deletedFeatures.count()
-                    + modifiedFeaturesByLayerId[layerId].updatedFeatures.count()
-                    + modifiedFeaturesByLayerId[layerId].createdFeatures.count();
-  }
-
-  if ( totalChanges > 0 )
+  if ( redo )
   {
-    QgsVectorLayer *vl = layerIds.size() == 1 ? qobject_cast<QgsVectorLayer *>( mProject->mapLayer( layerIds.first() ) ) : nullptr;
     if ( hasCreatedFeatures && !hasUpdatedFeatures && !hasDeletedFeatures )
     {
       return vl ? tr( "Redo creation of %n feature(s) on layer %1", "", totalChanges ).arg( vl->name() ) : tr( "Redo creation of %n feature(s)", "", totalChanges );
@@ -503,5 +748,16 @@ const QString FeatureHistory::redoMessage()
     }
   }
 
-  return QString();
+  if ( hasCreatedFeatures && !hasUpdatedFeatures && !hasDeletedFeatures )
+  {
+    return vl ? tr( "Undo creation of %n feature(s) on layer %1.", "", totalChanges ).arg( vl->name() ) : tr( "Undo creation of %n feature(s).", "", totalChanges );
+  }
+  else if ( !hasCreatedFeatures && !hasUpdatedFeatures && hasDeletedFeatures )
+  {
+    return vl ? tr( "Undo deletion of %n feature(s) on layer %1.", "", totalChanges ).arg( vl->name() ) : tr( "Undo deletion of %n feature(s).", "", totalChanges );
+  }
+  else
+  {
+    return vl ? tr( "Undo modifications on %n feature(s) on layer %1.", "", totalChanges ).arg( vl->name() ) : tr( "Undo modifications on %n feature(s).", "", totalChanges );
+  }
 }
@@ -1,15 +1,22 @@
 #ifndef FEATUREHISTORY_H
 #define FEATUREHISTORY_H
 
+#include "featurehistoryjournal.h"
+
+#include <QCache>
 #include <QObject>
 #include <QTimer>
 #include <qgsproject.h>
 
 #include <trackingmodel.h>
 
-typedef QPair<QgsFeature, QgsFeature> OldNewFeaturePair;
-
 /**
+ * Keeps track of the committed feature changes to undo and redo them.
+ *
+ * Steps are stored as compact diffs, changed attribute values and the changed byte
+ * range of geometries, in a journal next to the project so that the history survives
+ * restarts. Only the summaries of the steps are kept in memory, steps themselves are
+ * loaded when undone or redone and cached within a memory budget.
  * \ingroup core
  */
 class FeatureHistory : public QObject
@@ -18,8 +25,38 @@ class FeatureHistory : public QObject
 
     Q_PROPERTY( bool isUndoAvailable READ isUndoAvailable NOTIFY isUndoAvailableChanged )
     Q_PROPERTY( bool isRedoAvailable READ isRedoAvailable NOTIFY isRedoAvailableChanged )
+    Q_PROPERTY( int maximumSteps READ maximumSteps WRITE setMaximumSteps NOTIFY maximumStepsChanged )
+    Q_PROPERTY( qint64 memoryBudget READ memoryBudget WRITE setMemoryBudget NOTIFY memoryBudgetChanged )
 
   public:
+    //! Default maximum number of undo steps kept
+    static constexpr int DefaultMaximumSteps = 100;
+    //! Default size in bytes of the steps kept in memory
+    static constexpr qint64 DefaultMemoryBudget = 4 * 1024 * 1024;
+
+    /**
+     * Stores the changes of an updated feature.
+     */
+    struct FeatureDiff
+    {
+        QgsFeatureId fid = FID_NULL;
+        //! Values of the changed attributes before the update
+        QgsAttributeMap oldAttributes;
+        //! Values of the changed attributes after the update
+        QgsAttributeMap newAttributes;
+        bool geometryChanged = false;
+        //! Offset of the changed byte range of the geometry WKB
+        int geometryOffset = 0;
+        //! Changed bytes of the geometry WKB before the update
+        QByteArray oldGeometryBytes;
+        //! Changed bytes of the geometry WKB after the update
+        QByteArray newGeometryBytes;
+        //! Checksum of the geometry WKB before the update
+        quint16 oldGeometryChecksum = 0;
+        //! Checksum of the geometry WKB after the update
+        quint16 newGeometryChecksum = 0;
+    };
+
     /**
      * Stores the created, updated and deleted features on each undo/redo step.
      */
@@ -28,9 +65,9 @@ class FeatureHistory : public QObject
         FeatureModifications()
         {}
 
-        QList<OldNewFeaturePair> createdFeatures;
-        QList<OldNewFeaturePair> updatedFeatures;
-        QList<OldNewFeaturePair> deletedFeatures;
+        QgsFeatureList createdFeatures;
+        QList<FeatureDiff> updatedFeatures;
+        QgsFeatureList deletedFeatures;
     };
 
     /**
@@ -56,9 +93,39 @@ class FeatureHistory : public QObject
     bool isUndoAvailable();
     bool isRedoAvailable();
 
+    //! Returns the maximum number of undo steps kept
+    int maximumSteps() const { return mMaximumSteps; }
+
+    //! Sets the maximum number of undo steps kept, older steps are dropped
+    void setMaximumSteps( int maximumSteps );
+
+    //! Returns the size in bytes of the steps kept in memory
+    qint64 memoryBudget() const { return mMemoryBudget; }
+
+    //! Sets the size in bytes of the steps kept in memory
+    void setMemoryBudget( qint64 memoryBudget );
+
+    /**
+     * Computes the byte range differing between \a from and \a to.
+     * \param from the bytes before the change
+     * \param to the bytes after the change
+     * \param offset the offset of the differing range
+     * \param fromBytes the differing bytes of \a from
+     * \param toBytes the differing bytes of \a to
+     */
+    static void bytesDelta( const QByteArray &from, const QByteArray &to, int &offset, QByteArray &fromBytes, QByteArray &toBytes );
+
+    /**
+     * Replaces the \a expected bytes at \a offset in \a bytes by \a replacement.
+     * \returns FALSE if \a bytes don't hold the \a expected bytes at \a offset
+     */
+    static bool applyBytesDelta( QByteArray &bytes, int offset, const QByteArray &expected, const QByteArray &replacement );
+
   signals:
     void isUndoAvailableChanged();
     void isRedoAvailableChanged();
+    void maximumStepsChanged();
+    void memoryBudgetChanged();
 
   private slots:
     /**
@@ -74,10 +141,7 @@ class FeatureHistory : public QObject
     //! Called when features are added on the layer
     void onCommittedFeaturesAdded( const QString &localLayerId, const QgsFeatureList &addedFeatures );
 
-    //! Called after features are committed for deletion.
-    void onCommittedFeaturesRemoved( const QString &layerId, const QgsFeatureIds &deletedFeatureIds );
-
-    //! Called before features are committed. Used to prepare the old state of the features and store it in \a mHistry.
+    //! Called before features are committed. Used to prepare the deleted features and the diffs of the updated ones.
     void onBeforeCommitChanges();
 
     //! Called after features are committed. Used because the added features do not have FID before they are committed.
@@ -92,14 +156,34 @@ class FeatureHistory : public QObject
   private:
     static const int sTimeoutMs = 50;
 
+    /**
+     * Stores the changes of a layer being committed.
+     */
+    struct PendingCommit
+    {
+        QgsFeatureList deletedFeatures;
+        QMap<QgsFeatureId, FeatureDiff> updatedFeatures;
+        //! WKB of the changed geometries before the commit
+        QHash<QgsFeatureId, QByteArray> oldGeometries;
+    };
+
     //! Add the needed event listeners to monitor for changes.
     void addLayerListeners();
 
-    //! Apply given modifications on all layers in the current project. Used both by undo and redo operations.
-    bool applyModifications( QMap<QString, FeatureModifications> &modificationsByLayerId );
+    //! Opens the journal of the current project and loads the summaries of its steps.
+    void openJournal();
+
+    //! Apply given modifications on all layers in the current project, \a forward for redo and backward for undo.
+    bool applyModifications( const QMap<QString, FeatureModifications> &modificationsByLayerId, bool forward );
+
+    //! Returns the modifications of a given \a step, loaded from the journal if not cached.
+    QMap<QString, FeatureModifications> loadStep( const FeatureHistoryJournal::Step &step );
 
-    //! Reverse the modification. Used to make undo modifications into redo modifications.
-    QMap<QString, FeatureModifications> reverseModifications( QMap<QString, FeatureModifications> &modificationsByLayerId );
+    //! Drops the oldest undo steps exceeding the maximum number of steps.
+    void trimSteps();
+
+    //! Returns the message describing a \a step being undone, or redone if \a redo is TRUE.
+    QString stepMessage( const FeatureHistoryJournal::Step &step, bool redo ) const;
 
     //! The current project instance.
     const QgsProject *mProject = nullptr;
@@ -116,17 +200,23 @@ class FeatureHistory : public QObject
     //! Temporary storage of all modifications before creating a new undo step.
     QMap<QString, FeatureModifications> mTempHistoryStep;
 
-    //! Temporary storage of All features that have been modified before creating a new undo step.
-    QMap<QString, QMap<QgsFeatureId, QgsFeature>> mTempModifiedFeaturesByLayerId;
+    //! Temporary storage of the changes of the layers being committed.
+    QMap<QString, PendingCommit> mPendingCommits;
+
+    //! Journal storing the steps.
+    FeatureHistoryJournal mJournal;
+
+    //! Undo steps, the most recent one last
+    QList<FeatureHistoryJournal::Step> mUndoSteps;
 
-    //! Temporary storage of the deleted feature ids before creating a new undo step.
-    QMap<QString, QgsFeatureIds> mTempDeletedFeatureIdsByLayerId;
+    //! Redo steps, the most recently undone one last
+    QList<FeatureHistoryJournal::Step> mRedoSteps;
 
-    //! Undo history records
-    QList<QMap<QString, FeatureModifications>> mUndoHistory;
+    //! Steps loaded from the journal, within the memory budget
+    QCache<qint64, QMap<QString, FeatureModifications>> mStepCache;
 
-    //! Redo history records
-    QList<QMap<QString, FeatureModifications>> mRedoHistory;
+    int mMaximumSteps = DefaultMaximumSteps;
+    qint64 mMemoryBudget = DefaultMemoryBudget;
 
     //! Layer ids being observed for changes. Should reset when the project is changed. Used to prevent double event listeners.
     QSet<QString> mObservedLayerIds;
@@ -0,0 +1,177 @@
+/***************************************************************************
+  featurehistoryjournal.cpp - FeatureHistoryJournal
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "featurehistoryjournal.h"
+
+#include <QObject>
+#include <qgsmessagelog.h>
+
+#include <sqlite3.h>
+
+bool FeatureHistoryJournal::open( const QString &path )
+{
+  close();
+
+  int status = mDatabase.open_v2( path, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, nullptr );
+  if ( status != SQLITE_OK )
+  {
+    QgsMessageLog::logMessage( QObject::tr( "Could not open the feature history journal %1: %2" ).arg( path, mDatabase.errorMessage() ), QStringLiteral( "SIGPACGO" ), Qgis::Warning );
+    mDatabase.reset();
+    return false;
+  }
+
+  QString error;
+  mDatabase.exec( QStringLiteral( "PRAGMA journal_mode=WAL;" ), error );
+  mDatabase.exec( QStringLiteral( "PRAGMA synchronous=NORMAL;" ), error );
+  status = mDatabase.exec( QStringLiteral( "CREATE TABLE IF NOT EXISTS steps ("
+                                           " id INTEGER PRIMARY KEY AUTOINCREMENT,"
+                                           " stack INTEGER NOT NULL,"
+                                           " layer_id TEXT,"
+                                           " created_count INTEGER NOT NULL,"
+                                           " updated_count INTEGER NOT NULL,"
+                                           " deleted_count INTEGER NOT NULL,"
+                                           " size INTEGER NOT NULL,"
+                                           " data BLOB NOT NULL );" ),
+                           error );
+  if ( status != SQLITE_OK )
+  {
+    QgsMessageLog::logMessage( QObject::tr( "Could not initialize the feature history journal %1: %2" ).arg( path, error ), QStringLiteral( "SIGPACGO" ), Qgis::Warning );
+    mDatabase.reset();
+    return false;
+  }
+
+  mPath = path;
+  return true;
+}
+
+void FeatureHistoryJournal::close()
+{
+  mDatabase.reset();
+  mPath.clear();
+}
+
+QList<FeatureHistoryJournal::Step> FeatureHistoryJournal::steps( Stack stack ) const
+{
+  QList<Step> steps;
+  if ( !mDatabase )
+    return steps;
+
+  // The undo stack grows with new steps, the redo one with steps undone from the most recent one
+  int status = SQLITE_OK;
+  sqlite3_statement_unique_ptr statement = mDatabase.prepare( stack == Stack::Undo
+                                                                ? QStringLiteral( "SELECT id, layer_id, created_count, updated_count, deleted_count, size FROM steps WHERE stack = 0 ORDER BY id ASC" )
+                                                                : QStringLiteral( "SELECT id, layer_id, created_count, updated_count, deleted_count, size FROM steps WHERE stack = 1 ORDER BY id DESC" ),
+                                                              status );
+  if ( status != SQLITE_OK )
+    return steps;
+
+  while ( statement.step() == SQLITE_ROW )
+  {
+    Step step;
+    step.id = statement.columnAsInt64( 0 );
+    step.layerId = statement.columnAsText( 1 );
+    step.createdCount = static_cast<int>( statement.columnAsInt64( 2 ) );
+    step.updatedCount = static_cast<int>( statement.columnAsInt64( 3 ) );
+    step.deletedCount = static_cast<int>( statement.columnAsInt64( 4 ) );
+    step.size = statement.columnAsInt64( 5 );
+    steps << step;
+  }
+
+  return steps;
+}
+
+qint64 FeatureHistoryJournal::append( const Step &step, const QByteArray &data )
+{
+  if ( !mDatabase )
+    return 0;
+
+  int status = SQLITE_OK;
+  sqlite3_statement_unique_ptr statement = mDatabase.prepare( QStringLiteral( "INSERT INTO steps ( stack, layer_id, created_count, updated_count, deleted_count, size, data ) VALUES ( 0, ?, ?, ?, ?, ?, ? )" ), status );
+  if ( status != SQLITE_OK )
+    return 0;
+
+  const QByteArray layerIdUtf8 = step.layerId.toUtf8();
+  if ( step.layerId.isEmpty() )
+    sqlite3_bind_null( statement.get(), 1 );
+  else
+    sqlite3_bind_text( statement.get(), 1, layerIdUtf8.constData(), static_cast<int>( layerIdUtf8.size() ), SQLITE_STATIC );
+  sqlite3_bind_int64( statement.get(), 2, step.createdCount );
+  sqlite3_bind_int64( statement.get(), 3, step.updatedCount );
+  sqlite3_bind_int64( statement.get(), 4, step.deletedCount );
+  sqlite3_bind_int64( statement.get(), 5, data.size() );
+  sqlite3_bind_blob( statement.get(), 6, data.constData(), static_cast<int>( data.size() ), SQLITE_STATIC );
+  if ( statement.step() != SQLITE_DONE )
+  {
+    QgsMessageLog::logMessage( QObject::tr( "Could not store a step in the feature history journal %1: %2" ).arg( mPath, mDatabase.errorMessage() ), QStringLiteral( "SIGPACGO" ), Qgis::Warning );
+    return 0;
+  }
+
+  return sqlite3_last_insert_rowid( mDatabase.get() );
+}
+
+QByteArray FeatureHistoryJournal::data( qint64 id ) const
+{
+  if ( !mDatabase )
+    return QByteArray();
+
+  int status = SQLITE_OK;
+  sqlite3_statement_unique_ptr statement = mDatabase.prepare( QStringLiteral( "SELECT data FROM steps WHERE id = ?" ), status );
+  if ( status != SQLITE_OK )
+    return QByteArray();
+
+  sqlite3_bind_int64( statement.get(), 1, id );
+  if ( statement.step() != SQLITE_ROW )
+    return QByteArray();
+
+  return QByteArray( static_cast<const char *>( sqlite3_column_blob( statement.get(), 0 ) ), sqlite3_column_bytes( statement.get(), 0 ) );
+}
+
+bool FeatureHistoryJournal::move( qint64 id, Stack stack )
+{
+  if ( !mDatabase )
+    return false;
+
+  int status = SQLITE_OK;
+  sqlite3_statement_unique_ptr statement = mDatabase.prepare( QStringLiteral( "UPDATE steps SET stack = ? WHERE id = ?" ), status );
+  if ( status != SQLITE_OK )
+    return false;
+
+  sqlite3_bind_int64( statement.get(), 1, stack == Stack::Undo ? 0 : 1 );
+  sqlite3_bind_int64( statement.get(), 2, id );
+  return statement.step() == SQLITE_DONE;
+}
+
+void FeatureHistoryJournal::remove( qint64 id )
+{
+  if ( !mDatabase )
+    return;
+
+  int status = SQLITE_OK;
+  sqlite3_statement_unique_ptr statement = mDatabase.prepare( QStringLiteral( "DELETE FROM steps WHERE id = ?" ), status );
+  if ( status != SQLITE_OK )
+    return;
+
+  sqlite3_bind_int64( statement.get(), 1, id );
+  statement.step();
+}
+
+void FeatureHistoryJournal::clear( Stack stack )
+{
+  if ( !mDatabase )
+    return;
+
+  QString error;
+  mDatabase.exec( stack == Stack::Undo ? QStringLiteral( "DELETE FROM steps WHERE stack = 0;" ) : QStringLiteral( "DELETE FROM steps WHERE stack = 1;" ), error );
+}
@@ -0,0 +1,97 @@
+/***************************************************************************
+  featurehistoryjournal.h - FeatureHistoryJournal
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef FEATUREHISTORYJOURNAL_H
+#define FEATUREHISTORYJOURNAL_H
+
+#include "qfield_core_export.h"
+
+#include <QList>
+#include <QString>
+#include <qgssqliteutils.h>
+
+/**
+ * \brief SQLite storage of the undo and redo steps of FeatureHistory.
+ *
+ * Each step is stored as an opaque blob along with a summary of its content, so that
+ * the stacks can be listed and described without loading the steps themselves. A step
+ * belongs either to the undo or to the redo stack, undoing and redoing it only moves it
+ * from one stack to the other.
+ * \ingroup core
+ */
+class QFIELD_CORE_EXPORT FeatureHistoryJournal
+{
+  public:
+    enum class Stack
+    {
+      Undo,
+      Redo,
+    };
+
+    //! Summary of a step
+    struct Step
+    {
+        qint64 id = 0;
+        //! Id of the layer modified by the step, empty if several layers were modified
+        QString layerId;
+        int createdCount = 0;
+        int updatedCount = 0;
+        int deletedCount = 0;
+        //! Size in bytes of the step data
+        qint64 size = 0;
+    };
+
+    /**
+     * Opens or creates the journal at \a path, ":memory:" opening a journal which isn't persisted.
+     * \returns FALSE if the journal could not be opened
+     */
+    bool open( const QString &path );
+
+    //! Closes the journal
+    void close();
+
+    //! Returns TRUE if the journal is open
+    bool isOpen() const { return static_cast<bool>( mDatabase ); }
+
+    //! Returns the path of the journal
+    QString path() const { return mPath; }
+
+    //! Returns the steps of a given \a stack, the top of the stack being the last step
+    QList<Step> steps( Stack stack ) const;
+
+    /**
+     * Pushes a \a step with a given \a data on top of the undo stack.
+     * \returns the id of the step, 0 if it could not be stored
+     */
+    qint64 append( const Step &step, const QByteArray &data );
+
+    //! Returns the data of the step with a given \a id
+    QByteArray data( qint64 id ) const;
+
+    //! Moves the step with a given \a id on top of the \a stack
+    bool move( qint64 id, Stack stack );
+
+    //! Removes the step with a given \a id
+    void remove( qint64 id );
+
+    //! Removes all the steps of a \a stack
+    void clear( Stack stack );
+
+  private:
+    QString mPath;
+    sqlite3_database_unique_ptr mDatabase;
+};
+
+#endif // FEATUREHISTORYJOURNAL_H
@@ -16,6 +16,7 @@
 
 
 #include "featurelistmodel.h"
+#include "featurequeryexecutor.h"
 #include "qgsvectorlayer.h"
 #include "stringutils.h"
 
@@ -41,12 +42,10 @@ FeatureListModel::~FeatureListModel()
 
 void FeatureListModel::cleanupGatherer()
 {
-  if ( mGatherer )
+  if ( mGathererTicket )
   {
-    disconnect( mGatherer, &QThread::finished, this, &FeatureListModel::processFeatureList );
-    connect( mGatherer, &QThread::finished, mGatherer, &QObject::deleteLater );
-    mGatherer->stop();
-    mGatherer = nullptr;
+    FeatureQueryExecutor::instance()->cancel( mGathererTicket );
+    mGathererTicket = 0;
   }
 }
 
@@ -334,11 +333,13 @@ void FeatureListModel::gatherFeatureList()
     }
   }
 
+  bool requiresFormScope = false;
   if ( !mSearchTerm.isEmpty() || !mFilterExpression.isEmpty() )
   {
     QgsExpressionContext filterContext = QgsExpressionContext( QgsExpressionContextUtils::globalProjectLayerScopes( mCurrentLayer ) );
 
-    if ( mCurrentFormFeature.isValid() && QgsValueRelationFieldFormatter::expressionRequiresFormScope( mFilterExpression ) )
+    requiresFormScope = mCurrentFormFeature.isValid() && QgsValueRelationFieldFormatter::expressionRequiresFormScope( mFilterExpression );
+    if ( requiresFormScope )
       filterContext.appendScope( QgsExpressionContextUtils::formScope( mCurrentFormFeature ) );
 
     request.setExpressionContext( filterContext );
@@ -358,16 +359,26 @@ void FeatureListModel::gatherFeatureList()
 
   cleanupGatherer();
 
-  mGatherer = new FeatureExpressionValuesGatherer( mCurrentLayer, fieldDisplayString, request, QStringList() << keyField() << groupField() );
-  connect( mGatherer, &QThread::finished, this, &FeatureListModel::processFeatureList );
-  mGatherer->start();
+  auto gatherer = std::make_shared<FeatureExpressionValuesGatherer>( mCurrentLayer, fieldDisplayString, request, QStringList() << keyField() << groupField() );
+
+  // Value relations of several forms often list the same features, share their queries unless the filter depends on the form feature
+  FeatureQueryExecutor::Query query;
+  query.key = requiresFormScope ? QString() : gatherer->key();
+  query.layers << mCurrentLayer;
+  query.priority = mSearchTerm.isEmpty() ? FeatureQueryExecutor::Priority::Normal : FeatureQueryExecutor::Priority::Interactive;
+
+  mGathererTicket = FeatureQueryExecutor::instance()->submit<QVector<FeatureExpressionValuesGatherer::Entry>>(
+    query,
+    [gatherer]( QgsFeedback *feedback ) { return gatherer->gather( feedback ); },
+    this,
+    [this]( const QVector<FeatureExpressionValuesGatherer::Entry> &gatheredEntries ) {
+      mGathererTicket = 0;
+      processFeatureList( gatheredEntries );
+    } );
 }
 
-void FeatureListModel::processFeatureList()
+void FeatureListModel::processFeatureList( const QVector<FeatureExpressionValuesGatherer::Entry> &gatheredEntries )
 {
-  if ( !mGatherer )
-    return;
-
   mEntries.clear();
 
   QList<Entry> entries;
@@ -375,10 +386,6 @@ void FeatureListModel::processFeatureList()
   if ( mAddNull )
     entries.append( Entry( QStringLiteral( "<i>NULL</i>" ), QVariant(), QVariant(), QgsFeatureId() ) );
 
-  const QVector<FeatureExpressionValuesGatherer::Entry> gatheredEntries = mGatherer->entries();
-  mGatherer->deleteLater();
-  mGatherer = nullptr;
-
   for ( const FeatureExpressionValuesGatherer::Entry &gatheredEntry : gatheredEntries )
   {
     Entry entry;
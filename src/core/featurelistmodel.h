@@ -221,7 +221,7 @@ class FeatureListModel : public QAbstractItemModel
        * Reloads a layer. This will normally be triggered
        * by \see reloadLayer and should not be called directly.
        */
-    void processFeatureList();
+    void processFeatureList( const QVector<FeatureExpressionValuesGatherer::Entry> &gatheredEntries );
 
   private:
     struct Entry
@@ -262,7 +262,8 @@ class FeatureListModel : public QAbstractItemModel
 
     QPointer<QgsVectorLayer> mCurrentLayer;
 
-    FeatureExpressionValuesGatherer *mGatherer = nullptr;
+    //! Ticket of the gathering query submitted to the FeatureQueryExecutor, 0 when none is pending
+    quint64 mGathererTicket = 0;
 
     QList<Entry> mEntries;
     QString mKeyField;
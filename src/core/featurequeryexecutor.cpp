@@ -0,0 +1,205 @@
+/***************************************************************************
+  featurequeryexecutor.cpp - FeatureQueryExecutor
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "featurequeryexecutor.h"
+
+#include <QCoreApplication>
+#include <qgsvectorlayer.h>
+
+FeatureQueryExecutor::FeatureQueryExecutor( QObject *parent )
+  : QObject( parent )
+{
+  mThreadPool.setMaxThreadCount( MaximumThreadCount );
+  mCache.setMaxCost( MaximumCachedResults );
+}
+
+FeatureQueryExecutor::~FeatureQueryExecutor()
+{
+  for ( const std::shared_ptr<Execution> &execution : std::as_const( mExecutions ) )
+    execution->feedback.cancel();
+
+  mPendingBackground.clear();
+  mThreadPool.clear();
+  mThreadPool.waitForDone();
+}
+
+FeatureQueryExecutor *FeatureQueryExecutor::instance()
+{
+  static QPointer<FeatureQueryExecutor> sInstance;
+  if ( !sInstance )
+  {
+    sInstance = new FeatureQueryExecutor( QCoreApplication::instance() );
+  }
+  return sInstance;
+}
+
+quint64 FeatureQueryExecutor::submitTask( const Query &query, Task task, QObject *context, Callback callback )
+{
+  const quint64 ticket = ++mLastTicket;
+
+  // Queries without a key never share anything, a key unique to the ticket keeps them apart
+  const bool cacheable = !query.key.isEmpty();
+  QString executionKey;
+  if ( cacheable )
+  {
+    executionKey = query.key;
+    for ( QgsVectorLayer *layer : query.layers )
+    {
+      if ( layer )
+        executionKey += QStringLiteral( "|%1" ).arg( revision( layer ) );
+    }
+  }
+  else
+  {
+    executionKey = QStringLiteral( "#%1" ).arg( ticket );
+  }
+
+  mSubscribers.insert( ticket, Subscriber { executionKey, QPointer<QObject>( context ), std::move( callback ) } );
+
+  if ( cacheable )
+  {
+    if ( CachedResult *cached = mCache.object( executionKey ) )
+    {
+      if ( cached->age.elapsed() <= CacheTimeToLive )
+      {
+        // Deliver asynchronously all the same, callers don't expect their callback within submit()
+        const std::shared_ptr<const void> result = cached->result;
+        QMetaObject::invokeMethod( this, [this, ticket, result] { deliver( ticket, result ); }, Qt::QueuedConnection );
+        return ticket;
+      }
+      mCache.remove( executionKey );
+    }
+
+    auto it = mExecutions.find( executionKey );
+    if ( it != mExecutions.end() )
+    {
+      it.value()->tickets << ticket;
+      return ticket;
+    }
+  }
+
+  std::shared_ptr<Execution> execution = std::make_shared<Execution>();
+  execution->tickets << ticket;
+  execution->priority = query.priority;
+  mExecutions.insert( executionKey, execution );
+
+  start( [this, executionKey, execution, task = std::move( task ), cacheable] {
+    std::shared_ptr<const void> result;
+    if ( !execution->feedback.isCanceled() )
+      result = task( &execution->feedback );
+
+    QMetaObject::invokeMethod( this, [this, executionKey, execution, result, cacheable] { finish( executionKey, execution, result, cacheable ); }, Qt::QueuedConnection );
+  },
+         query.priority );
+
+  return ticket;
+}
+
+void FeatureQueryExecutor::start( std::function<void()> runnable, Priority priority )
+{
+  if ( priority == Priority::Background )
+  {
+    // Long running background queries would otherwise occupy every worker
+    if ( mBackgroundCount >= MaximumBackgroundThreadCount )
+    {
+      mPendingBackground << std::move( runnable );
+      return;
+    }
+    mBackgroundCount++;
+  }
+
+  mThreadPool.start( std::move( runnable ), static_cast<int>( priority ) );
+}
+
+void FeatureQueryExecutor::finish( const QString &executionKey, const std::shared_ptr<Execution> &execution, const std::shared_ptr<const void> &result, bool cacheable )
+{
+  auto it = mExecutions.find( executionKey );
+  if ( it != mExecutions.end() && it.value() == execution )
+    mExecutions.erase( it );
+
+  if ( execution->priority == Priority::Background )
+  {
+    mBackgroundCount--;
+    if ( !mPendingBackground.isEmpty() )
+      start( mPendingBackground.takeFirst(), Priority::Background );
+  }
+
+  // A canceled execution has no subscribers left and may have stopped halfway
+  if ( execution->feedback.isCanceled() || !result )
+    return;
+
+  if ( cacheable )
+  {
+    CachedResult *cached = new CachedResult;
+    cached->result = result;
+    cached->age.start();
+    mCache.insert( executionKey, cached, 1 );
+  }
+
+  const QList<quint64> tickets = execution->tickets;
+  for ( const quint64 ticket : tickets )
+    deliver( ticket, result );
+}
+
+void FeatureQueryExecutor::deliver( quint64 ticket, const std::shared_ptr<const void> &result )
+{
+  auto it = mSubscribers.find( ticket );
+  if ( it == mSubscribers.end() )
+    return;
+
+  const Subscriber subscriber = it.value();
+  mSubscribers.erase( it );
+
+  if ( subscriber.context )
+    subscriber.callback( result );
+}
+
+void FeatureQueryExecutor::cancel( quint64 ticket )
+{
+  auto it = mSubscribers.find( ticket );
+  if ( it == mSubscribers.end() )
+    return;
+
+  const QString executionKey = it.value().executionKey;
+  mSubscribers.erase( it );
+
+  auto executionIt = mExecutions.find( executionKey );
+  if ( executionIt == mExecutions.end() )
+    return;
+
+  std::shared_ptr<Execution> execution = executionIt.value();
+  execution->tickets.removeAll( ticket );
+  if ( execution->tickets.isEmpty() )
+  {
+    execution->feedback.cancel();
+    mExecutions.erase( executionIt );
+  }
+}
+
+quint64 FeatureQueryExecutor::revision( QgsVectorLayer *layer )
+{
+  auto it = mRevisions.find( layer );
+  if ( it != mRevisions.end() )
+    return it.value();
+
+  // Revisions are unique across layers, a layer created where a deleted one lived never inherits its results
+  auto bump = [this, layer] { mRevisions[layer] = ++mLastRevision; };
+  connect( layer, &QgsVectorLayer::dataChanged, this, bump );
+  connect( layer, &QgsVectorLayer::layerModified, this, bump );
+  connect( layer, &QgsVectorLayer::subsetStringChanged, this, bump );
+  connect( layer, &QObject::destroyed, this, [this, layer] { mRevisions.remove( layer ); } );
+
+  return mRevisions.insert( layer, ++mLastRevision ).value();
+}
@@ -0,0 +1,161 @@
+/***************************************************************************
+  featurequeryexecutor.h - FeatureQueryExecutor
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef FEATUREQUERYEXECUTOR_H
+#define FEATUREQUERYEXECUTOR_H
+
+#include "qfield_core_export.h"
+
+#include <QCache>
+#include <QElapsedTimer>
+#include <QHash>
+#include <QObject>
+#include <QPointer>
+#include <QThreadPool>
+#include <qgsfeedback.h>
+
+#include <functional>
+#include <memory>
+
+class QgsVectorLayer;
+
+/**
+ * \brief Runs feature queries on a small project-wide pool of worker threads.
+ *
+ * Queries run by priority on a bounded number of threads, so that bursts of requests
+ * don't end up with as many threads reading the same data sources. Queries submitted
+ * with the same key while an identical query is running share its execution, and their
+ * results are kept for a few seconds for identical queries submitted later on. Keys are
+ * combined with a revision of the layers the queries read, bumped whenever the data of
+ * a layer changes, so that changed data is never served from the cache.
+ *
+ * Background queries, such as counting the features of whole layers, run on at most
+ * MaximumBackgroundThreadCount threads at once, leaving a worker to the queries a user
+ * is waiting for.
+ *
+ * A canceled query stops receiving its result. Its execution is told to stop through
+ * its feedback once no other query shares it.
+ *
+ * Queries are submitted and canceled from the main thread, results are delivered to it.
+ * \ingroup core
+ */
+class QFIELD_CORE_EXPORT FeatureQueryExecutor : public QObject
+{
+    Q_OBJECT
+
+  public:
+    enum class Priority
+    {
+      Background,  //!< Results nobody is waiting for, e.g. refreshing geofencing areas
+      Normal,      //!< Results displayed once available, e.g. relation editors of a form
+      Interactive, //!< Results a user is waiting for, e.g. value relation search
+    };
+
+    //! Description of a query
+    struct Query
+    {
+        //! Queries with the same non-empty key share executions and cached results, an empty key disabling both
+        QString key;
+        //! Layers the query reads, any change to their data invalidating cached results
+        QList<QgsVectorLayer *> layers;
+        Priority priority = Priority::Normal;
+    };
+
+    //! Maximum number of queries running at once
+    static constexpr int MaximumThreadCount = 2;
+    //! Maximum number of background queries running at once
+    static constexpr int MaximumBackgroundThreadCount = 1;
+    //! Number of milliseconds results are kept for identical queries
+    static constexpr qint64 CacheTimeToLive = 5000;
+    //! Maximum number of results kept for identical queries
+    static constexpr int MaximumCachedResults = 32;
+
+    ~FeatureQueryExecutor() override;
+
+    //! Returns the executor of the application
+    static FeatureQueryExecutor *instance();
+
+    /**
+     * Submits a \a query which runs a \a task on a worker thread. The task should stop as soon as
+     * the feedback it is given is canceled. The \a callback is invoked on the main thread with the
+     * result unless the query is canceled or the \a context is destroyed beforehand.
+     * \returns a ticket identifying the query, with which it can be canceled
+     */
+    template<typename Result>
+    quint64 submit( const Query &query, std::function<Result( QgsFeedback * )> task, QObject *context, std::function<void( const Result & )> callback )
+    {
+      return submitTask(
+        query,
+        [task = std::move( task )]( QgsFeedback *feedback ) -> std::shared_ptr<const void> {
+          return std::make_shared<const Result>( task( feedback ) );
+        },
+        context,
+        [callback = std::move( callback )]( const std::shared_ptr<const void> &result ) {
+          callback( *std::static_pointer_cast<const Result>( result ) );
+        } );
+    }
+
+    //! Cancels the query identified by a given \a ticket
+    void cancel( quint64 ticket );
+
+  private:
+    using Task = std::function<std::shared_ptr<const void>( QgsFeedback * )>;
+    using Callback = std::function<void( const std::shared_ptr<const void> & )>;
+
+    struct Execution
+    {
+        QgsFeedback feedback;
+        QList<quint64> tickets;
+        Priority priority = Priority::Normal;
+    };
+
+    struct Subscriber
+    {
+        QString executionKey;
+        QPointer<QObject> context;
+        Callback callback;
+    };
+
+    struct CachedResult
+    {
+        std::shared_ptr<const void> result;
+        QElapsedTimer age;
+    };
+
+    explicit FeatureQueryExecutor( QObject *parent = nullptr );
+
+    quint64 submitTask( const Query &query, Task task, QObject *context, Callback callback );
+    //! Starts a \a runnable on the pool, background ones once a background slot is free
+    void start( std::function<void()> runnable, Priority priority );
+    void finish( const QString &executionKey, const std::shared_ptr<Execution> &execution, const std::shared_ptr<const void> &result, bool cacheable );
+    void deliver( quint64 ticket, const std::shared_ptr<const void> &result );
+
+    //! Returns the revision of the data of a \a layer, starting to track it if needed
+    quint64 revision( QgsVectorLayer *layer );
+
+    QThreadPool mThreadPool;
+    quint64 mLastTicket = 0;
+    quint64 mLastRevision = 0;
+
+    QHash<QString, std::shared_ptr<Execution>> mExecutions;
+    QHash<quint64, Subscriber> mSubscribers;
+    QCache<QString, CachedResult> mCache;
+    QHash<QgsVectorLayer *, quint64> mRevisions;
+
+    int mBackgroundCount = 0;
+    QList<std::function<void()>> mPendingBackground;
+};
+
+#endif // FEATUREQUERYEXECUTOR_H
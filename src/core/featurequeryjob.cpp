@@ -0,0 +1,228 @@
+/***************************************************************************
+  featurequeryjob.cpp - FeatureQueryJob
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "featurequeryexecutor.h"
+#include "featurequeryjob.h"
+
+#include <QElapsedTimer>
+#include <QSet>
+#include <qgsfeaturerequest.h>
+#include <qgsvariantutils.h>
+#include <qgsvectorlayer.h>
+#include <qgsvectorlayerfeatureiterator.h>
+
+//! Maximum number of results accumulated before a chunk is handed over
+static const int sChunkSize = 250;
+//! Maximum time in milliseconds results are held back before a chunk is handed over
+static const int sChunkInterval = 50;
+
+/**
+ * Iterates a feature source snapshot on an executor thread and hands results over in chunks.
+ * Signals are delivered to the job through queued connections, which Qt drops on its own
+ * should the job be destroyed while the worker is still winding down.
+ */
+class FeatureQueryWorker : public QObject
+{
+    Q_OBJECT
+
+  public:
+    FeatureQueryWorker( FeatureQueryJob::QueryType type, QgsVectorLayer *layer, int fieldIndex, const QgsFeatureRequest &request, int limit, long long featureCount, const std::shared_ptr<std::atomic<bool>> &canceled )
+      : mType( type )
+      , mSource( new QgsVectorLayerFeatureSource( layer ) )
+      , mFieldIndex( fieldIndex )
+      , mRequest( request )
+      , mLimit( limit )
+      , mFeatureCount( featureCount )
+      , mCanceled( canceled )
+    {
+    }
+
+    void run( QgsFeedback *feedback )
+    {
+      mRequest.setFeedback( feedback );
+
+      QgsFeatureIterator iterator = mSource->getFeatures( mRequest );
+      QgsFeature feature;
+      QSet<QVariant> seenValues;
+      QVariantList chunk;
+      long long iterated = 0;
+      long long collected = 0;
+
+      QElapsedTimer chunkTimer;
+      chunkTimer.start();
+
+      while ( !mCanceled->load() && !feedback->isCanceled() && iterator.nextFeature( feature ) )
+      {
+        iterated++;
+        if ( mType == FeatureQueryJob::QueryType::UniqueValues )
+        {
+          const QVariant value = feature.attribute( mFieldIndex );
+          if ( QgsVariantUtils::isNull( value ) || seenValues.contains( value ) )
+            continue;
+
+          seenValues.insert( value );
+          chunk << value;
+        }
+        else
+        {
+          chunk << QVariant::fromValue( feature );
+        }
+        collected++;
+
+        if ( mLimit > 0 && collected >= mLimit )
+          break;
+
+        if ( chunk.size() >= sChunkSize || chunkTimer.elapsed() >= sChunkInterval )
+        {
+          emit chunkReady( chunk, currentProgress( iterated ) );
+          chunk.clear();
+          chunkTimer.restart();
+        }
+      }
+
+      if ( !chunk.isEmpty() && !mCanceled->load() )
+        emit chunkReady( chunk, currentProgress( iterated ) );
+    }
+
+  signals:
+    void chunkReady( const QVariantList &chunk, double progress );
+
+  private:
+    double currentProgress( long long iterated ) const
+    {
+      if ( mFeatureCount <= 0 )
+        return -1.0;
+      return std::min( 1.0, static_cast<double>( iterated ) / static_cast<double>( mFeatureCount ) );
+    }
+
+    FeatureQueryJob::QueryType mType;
+    std::unique_ptr<QgsVectorLayerFeatureSource> mSource;
+    int mFieldIndex = -1;
+    QgsFeatureRequest mRequest;
+    int mLimit = -1;
+    long long mFeatureCount = -1;
+    std::shared_ptr<std::atomic<bool>> mCanceled;
+};
+
+FeatureQueryJob::FeatureQueryJob( QueryType type, QgsVectorLayer *layer, const QString &fieldName, const QString &filterExpression, int limit, QObject *parent )
+  : QObject( parent )
+  , mType( type )
+  , mLayer( layer )
+  , mFieldName( fieldName )
+  , mFilterExpression( filterExpression )
+  , mLimit( limit )
+  , mCanceled( std::make_shared<std::atomic<bool>>( false ) )
+{
+}
+
+FeatureQueryJob::~FeatureQueryJob()
+{
+  // The worker keeps its own snapshot and only shares the cancel flag with the job
+  mCanceled->store( true );
+  if ( mTicket )
+    FeatureQueryExecutor::instance()->cancel( mTicket );
+}
+
+bool FeatureQueryJob::start()
+{
+  if ( mStarted || !mLayer || !mLayer->isValid() )
+    return false;
+
+  QgsFeatureRequest request;
+  int fieldIndex = -1;
+  if ( mType == QueryType::UniqueValues )
+  {
+    fieldIndex = mLayer->fields().indexOf( mFieldName );
+    if ( fieldIndex < 0 )
+      return false;
+
+    request.setSubsetOfAttributes( QgsAttributeList() << fieldIndex );
+#if _QGIS_VERSION_INT >= 33500
+    request.setFlags( Qgis::FeatureRequestFlag::NoGeometry );
+#else
+    request.setFlags( QgsFeatureRequest::NoGeometry );
+#endif
+  }
+
+  // Without a filter, the layer feature count provides a progress estimate
+  long long featureCount = -1;
+  if ( !mFilterExpression.isEmpty() )
+    request.setFilterExpression( mFilterExpression );
+  else
+    featureCount = mLayer->featureCount();
+
+  // The feature source snapshot must be taken on the thread owning the layer, the worker is
+  // released on that thread too once the executor is done with it
+  std::shared_ptr<FeatureQueryWorker> worker( new FeatureQueryWorker( mType, mLayer, fieldIndex, request, mLimit, featureCount, mCanceled ), []( FeatureQueryWorker *worker ) { worker->deleteLater(); } );
+  connect( worker.get(), &FeatureQueryWorker::chunkReady, this, &FeatureQueryJob::onChunkReady, Qt::QueuedConnection );
+
+  mStarted = true;
+  mRunning = true;
+  mProgress = featureCount > 0 ? 0.0 : -1.0;
+  emit runningChanged();
+  emit progressChanged();
+
+  // Chunks are queued before the worker returns, the callback is hence invoked after the last one
+  FeatureQueryExecutor::Query query;
+  query.layers << mLayer;
+  query.priority = FeatureQueryExecutor::Priority::Interactive;
+  mTicket = FeatureQueryExecutor::instance()->submit<bool>(
+    query,
+    [worker]( QgsFeedback *feedback ) {
+      worker->run( feedback );
+      return true;
+    },
+    this, [this]( const bool & ) { onWorkerDone(); } );
+  return true;
+}
+
+void FeatureQueryJob::cancel()
+{
+  if ( !mRunning || mCanceled->load() )
+    return;
+
+  mCanceled->store( true );
+  emit canceledChanged();
+}
+
+void FeatureQueryJob::onChunkReady( const QVariantList &chunk, double progress )
+{
+  if ( mCanceled->load() )
+    return;
+
+  mResults << chunk;
+  emit resultsAdded( chunk );
+
+  if ( !qFuzzyCompare( mProgress, progress ) )
+  {
+    mProgress = progress;
+    emit progressChanged();
+  }
+}
+
+void FeatureQueryJob::onWorkerDone()
+{
+  mTicket = 0;
+  mRunning = false;
+  if ( !mCanceled->load() && mProgress >= 0.0 )
+  {
+    mProgress = 1.0;
+    emit progressChanged();
+  }
+  emit runningChanged();
+  emit finished();
+}
+
+#include "featurequeryjob.moc"
@@ -0,0 +1,126 @@
+/***************************************************************************
+  featurequeryjob.h - FeatureQueryJob
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef FEATUREQUERYJOB_H
+#define FEATUREQUERYJOB_H
+
+#include "qfield_core_export.h"
+
+#include <QObject>
+#include <QPointer>
+#include <QVariantList>
+
+#include <atomic>
+#include <memory>
+
+class QgsVectorLayer;
+
+/**
+ * \brief A background feature query whose results are streamed back in chunks.
+ *
+ * The query runs on a QgsVectorLayerFeatureSource snapshot taken when the job is
+ * started, as an interactive query of the FeatureQueryExecutor. Results are delivered on
+ * the thread owning the job through resultsAdded(), so QML can populate its models
+ * progressively while the iteration is still ongoing.
+ *
+ * Jobs are created through the FeatureUtils asynchronous functions. A job is
+ * canceled when destroyed, which makes it safe to drop a running job from QML.
+ * \ingroup core
+ */
+class QFIELD_CORE_EXPORT FeatureQueryJob : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY( bool running READ running NOTIFY runningChanged )
+    Q_PROPERTY( bool canceled READ canceled NOTIFY canceledChanged )
+    Q_PROPERTY( double progress READ progress NOTIFY progressChanged )
+    Q_PROPERTY( int resultCount READ resultCount NOTIFY resultsAdded )
+    Q_PROPERTY( QVariantList results READ results NOTIFY resultsAdded )
+
+  public:
+    enum class QueryType
+    {
+      UniqueValues, //!< Distinct non-null values of a single field
+      Features,     //!< Complete features
+    };
+    Q_ENUM( QueryType )
+
+    /**
+     * Creates a job querying \a layer. For QueryType::UniqueValues, \a fieldName defines the
+     * field whose distinct values are collected. An optional \a filterExpression restricts the
+     * features iterated and a positive \a limit caps the number of results.
+     */
+    explicit FeatureQueryJob( QueryType type, QgsVectorLayer *layer, const QString &fieldName = QString(), const QString &filterExpression = QString(), int limit = -1, QObject *parent = nullptr );
+    ~FeatureQueryJob() override;
+
+    //! Returns TRUE while the query is being executed
+    bool running() const { return mRunning; }
+
+    //! Returns TRUE if the query was canceled before completion
+    bool canceled() const { return mCanceled->load(); }
+
+    /**
+     * Returns the progress of the query between 0 and 1, or -1 when the progress
+     * cannot be determined (e.g. for filtered queries).
+     */
+    double progress() const { return mProgress; }
+
+    //! Returns the number of results received so far
+    int resultCount() const { return static_cast<int>( mResults.size() ); }
+
+    //! Returns the results received so far
+    QVariantList results() const { return mResults; }
+
+    /**
+     * Submits the query to the FeatureQueryExecutor.
+     * \returns FALSE if the job is already started or the layer is invalid
+     */
+    bool start();
+
+    //! Stops the query as soon as possible, results received so far are kept
+    Q_INVOKABLE void cancel();
+
+  signals:
+    void runningChanged();
+    void canceledChanged();
+    void progressChanged();
+
+    //! Emitted whenever a new \a chunk of results is available
+    void resultsAdded( const QVariantList &chunk );
+
+    //! Emitted once the query has completed or was canceled
+    void finished();
+
+  private slots:
+    void onChunkReady( const QVariantList &chunk, double progress );
+    void onWorkerDone();
+
+  private:
+    QueryType mType = QueryType::Features;
+    QPointer<QgsVectorLayer> mLayer;
+    QString mFieldName;
+    QString mFilterExpression;
+    int mLimit = -1;
+
+    bool mStarted = false;
+    bool mRunning = false;
+    double mProgress = 0.0;
+    QVariantList mResults;
+    std::shared_ptr<std::atomic<bool>> mCanceled;
+    //! Ticket of the query submitted to the executor, 0 once done
+    quint64 mTicket = 0;
+};
+
+#endif // FEATUREQUERYJOB_H
@@ -0,0 +1,670 @@
+/***************************************************************************
+  featuresearchindex.cpp - FeatureSearchIndex
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "featuresearchindex.h"
+#include "layerobserver.h"
+
+#include <QFileInfo>
+#include <QMutexLocker>
+#include <qgsexpression.h>
+#include <qgsexpressioncontextutils.h>
+#include <qgsfeatureiterator.h>
+#include <qgsmessagelog.h>
+#include <qgsproject.h>
+#include <qgssqliteutils.h>
+#include <qgsvariantutils.h>
+#include <qgsvectordataprovider.h>
+#include <qgsvectorlayer.h>
+#include <qgsvectorlayerfeatureiterator.h>
+
+#include <algorithm>
+#include <sqlite3.h>
+#include <tuple>
+
+namespace
+{
+  //! Number of features inserted per transaction while building a table
+  constexpr int BuildBatchSize = 10000;
+  //! Maximum number of indexed terms compared to a word when looking for similar terms
+  constexpr int MaximumScannedTerms = 20000;
+  //! Maximum number of similar terms a word is extended to
+  constexpr int MaximumAlternatives = 8;
+
+  //! What a worker needs to turn features into index entries
+  struct EntrySource
+  {
+      std::unique_ptr<QgsVectorLayerFeatureSource> featureSource;
+      QgsFeatureRequest request;
+      QgsExpression expression;
+      QgsExpressionContext context;
+      QList<int> searchableIndexes;
+  };
+
+  std::shared_ptr<EntrySource> entrySource( QgsVectorLayer *layer )
+  {
+    std::shared_ptr<EntrySource> source = std::make_shared<EntrySource>();
+    source->featureSource = std::make_unique<QgsVectorLayerFeatureSource>( layer );
+    source->expression = QgsExpression( layer->displayExpression() );
+    source->context.appendScopes( QgsExpressionContextUtils::globalProjectLayerScopes( layer ) );
+    source->expression.prepare( &source->context );
+
+    QSet<int> attributes = source->expression.referencedAttributeIndexes( layer->fields() );
+    const QgsFields fields = layer->fields();
+    for ( int i = 0; i < fields.size(); ++i )
+    {
+      const QgsField field = fields.at( i );
+#if _QGIS_VERSION_INT >= 33300
+      if ( field.configurationFlags().testFlag( Qgis::FieldConfigurationFlag::NotSearchable ) )
+#else
+      if ( field.configurationFlags().testFlag( QgsField::ConfigurationFlag::NotSearchable ) )
+#endif
+        continue;
+
+      if ( field.type() != QMetaType::QString && !field.isNumeric() && field.type() != QMetaType::QDate && field.type() != QMetaType::QDateTime )
+        continue;
+
+      source->searchableIndexes << i;
+      attributes << i;
+    }
+
+    source->request.setSubsetOfAttributes( qgis::setToList( attributes ) );
+    if ( !source->expression.needsGeometry() )
+    {
+#if _QGIS_VERSION_INT >= 33500
+      source->request.setFlags( Qgis::FeatureRequestFlag::NoGeometry );
+#else
+      source->request.setFlags( QgsFeatureRequest::NoGeometry );
+#endif
+    }
+    return source;
+  }
+
+  void bindText( sqlite3_stmt *statement, int index, const QString &text )
+  {
+    const QByteArray utf8 = text.toUtf8();
+    sqlite3_bind_text( statement, index, utf8.constData(), static_cast<int>( utf8.size() ), SQLITE_TRANSIENT );
+  }
+
+  //! Opens the sidecar at \a path for writing, creating its catalog if needed
+  bool openForWriting( sqlite3_database_unique_ptr &database, const QString &path )
+  {
+    if ( database.open_v2( path, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, nullptr ) != SQLITE_OK )
+    {
+      QgsMessageLog::logMessage( QObject::tr( "Could not open the search index %1: %2" ).arg( path, database.errorMessage() ), QStringLiteral( "SIGPACGO" ), Qgis::Warning );
+      return false;
+    }
+
+    QString error;
+    database.exec( QStringLiteral( "PRAGMA journal_mode=WAL;" ), error );
+    database.exec( QStringLiteral( "PRAGMA synchronous=NORMAL;" ), error );
+    if ( database.exec( QStringLiteral( "CREATE TABLE IF NOT EXISTS layers ("
+                                        " id INTEGER PRIMARY KEY AUTOINCREMENT,"
+                                        " layer_id TEXT NOT NULL UNIQUE,"
+                                        " signature TEXT NOT NULL,"
+                                        " feature_count INTEGER NOT NULL,"
+                                        " complete INTEGER NOT NULL );" ),
+                        error )
+         != SQLITE_OK )
+    {
+      QgsMessageLog::logMessage( QObject::tr( "Could not initialize the search index %1: %2" ).arg( path, error ), QStringLiteral( "SIGPACGO" ), Qgis::Warning );
+      return false;
+    }
+    return true;
+  }
+
+  //! Returns the id of the complete table of a layer, 0 if there is none
+  qint64 completeTableId( sqlite3_database_unique_ptr &database, const QString &layerId )
+  {
+    int status = SQLITE_OK;
+    sqlite3_statement_unique_ptr statement = database.prepare( QStringLiteral( "SELECT id FROM layers WHERE layer_id = ? AND complete = 1" ), status );
+    if ( status != SQLITE_OK )
+      return 0;
+
+    bindText( statement.get(), 1, layerId );
+    return statement.step() == SQLITE_ROW ? statement.columnAsInt64( 0 ) : 0;
+  }
+
+  //! Inserts the features returned by \a iterator into a table, one transaction per batch
+  bool insertEntries( sqlite3_database_unique_ptr &database, qint64 tableId, EntrySource &source, QgsFeatureIterator &iterator, const std::atomic<bool> &canceled )
+  {
+    int status = SQLITE_OK;
+    sqlite3_statement_unique_ptr statement = database.prepare( QStringLiteral( "INSERT INTO entries_%1 ( rowid, title, content ) VALUES ( ?, ?, ? )" ).arg( tableId ), status );
+    if ( status != SQLITE_OK )
+      return false;
+
+    QString error;
+    database.exec( QStringLiteral( "BEGIN;" ), error );
+
+    int pending = 0;
+    QgsFeature feature;
+    QStringList values;
+    while ( iterator.nextFeature( feature ) )
+    {
+      if ( canceled )
+      {
+        database.exec( QStringLiteral( "ROLLBACK;" ), error );
+        return false;
+      }
+
+      source.context.setFeature( feature );
+      values.clear();
+      for ( int index : std::as_const( source.searchableIndexes ) )
+      {
+        const QVariant value = feature.attribute( index );
+        if ( !QgsVariantUtils::isNull( value ) )
+          values << value.toString();
+      }
+
+      sqlite3_reset( statement.get() );
+      sqlite3_bind_int64( statement.get(), 1, feature.id() );
+      bindText( statement.get(), 2, source.expression.evaluate( &source.context ).toString() );
+      bindText( statement.get(), 3, values.join( QLatin1Char( ' ' ) ) );
+      if ( statement.step() != SQLITE_DONE )
+      {
+        database.exec( QStringLiteral( "ROLLBACK;" ), error );
+        return false;
+      }
+
+      if ( ++pending == BuildBatchSize )
+      {
+        database.exec( QStringLiteral( "COMMIT; BEGIN;" ), error );
+        pending = 0;
+      }
+    }
+
+    return database.exec( QStringLiteral( "COMMIT;" ), error ) == SQLITE_OK;
+  }
+
+  QString quotedTerm( const QString &term )
+  {
+    return QStringLiteral( "\"%1\"" ).arg( QString( term ).replace( QLatin1Char( '"' ), QLatin1String( "\"\"" ) ) );
+  }
+} // namespace
+
+FeatureSearchIndex::FeatureSearchIndex( QgsProject *project, LayerObserver *layerObserver, QObject *parent )
+  : QObject( parent )
+  , mProject( project )
+{
+  mThreadPool.setMaxThreadCount( 1 );
+
+  connect( mProject, &QgsProject::homePathChanged, this, &FeatureSearchIndex::onHomePathChanged );
+  connect( mProject, &QgsProject::layersAdded, this, &FeatureSearchIndex::onLayersAdded );
+  connect( mProject, &QgsProject::layersWillBeRemoved, this, &FeatureSearchIndex::onLayersWillBeRemoved );
+  connect( layerObserver, &LayerObserver::featuresCommitted, this, &FeatureSearchIndex::onFeaturesCommitted );
+}
+
+FeatureSearchIndex::~FeatureSearchIndex()
+{
+  cancelAll();
+  mThreadPool.waitForDone();
+}
+
+void FeatureSearchIndex::setEnabled( bool enabled )
+{
+  if ( mEnabled == enabled )
+    return;
+
+  mEnabled = enabled;
+  onHomePathChanged();
+
+  emit enabledChanged();
+}
+
+bool FeatureSearchIndex::isReady( const QString &layerId ) const
+{
+  QMutexLocker locker( &mMutex );
+  auto it = mLayerIndexes.constFind( layerId );
+  return it != mLayerIndexes.constEnd() && it->ready;
+}
+
+void FeatureSearchIndex::cancelAll()
+{
+  QMutexLocker locker( &mMutex );
+  for ( const LayerIndex &layerIndex : std::as_const( mLayerIndexes ) )
+    *layerIndex.canceled = true;
+  mLayerIndexes.clear();
+}
+
+void FeatureSearchIndex::onHomePathChanged()
+{
+  cancelAll();
+
+  // Projects which are not saved yet are searched through their providers
+  const QFileInfo projectFileInfo( mProject->fileName() );
+  {
+    QMutexLocker locker( &mMutex );
+    mPath = mEnabled && projectFileInfo.exists()
+              ? QStringLiteral( "%1/.%2.search.sqlite" ).arg( projectFileInfo.absolutePath(), projectFileInfo.completeBaseName() )
+              : QString();
+  }
+
+  onLayersAdded( mProject->mapLayers().values() );
+}
+
+void FeatureSearchIndex::onLayersAdded( const QList<QgsMapLayer *> &layers )
+{
+  for ( QgsMapLayer *layer : layers )
+  {
+    QgsVectorLayer *vl = qobject_cast<QgsVectorLayer *>( layer );
+    if ( !vl )
+      continue;
+
+    connect( vl, &QgsVectorLayer::displayExpressionChanged, this, &FeatureSearchIndex::onLayerChanged, Qt::UniqueConnection );
+    connect( vl, &QgsVectorLayer::updatedFields, this, &FeatureSearchIndex::onLayerChanged, Qt::UniqueConnection );
+
+    {
+      QMutexLocker locker( &mMutex );
+      if ( mLayerIndexes.contains( vl->id() ) )
+        continue;
+    }
+    indexLayer( vl );
+  }
+}
+
+void FeatureSearchIndex::onLayersWillBeRemoved( const QStringList &layerIds )
+{
+  QMutexLocker locker( &mMutex );
+  for ( const QString &layerId : layerIds )
+  {
+    auto it = mLayerIndexes.find( layerId );
+    if ( it == mLayerIndexes.end() )
+      continue;
+
+    *it->canceled = true;
+    mLayerIndexes.erase( it );
+  }
+}
+
+void FeatureSearchIndex::onLayerChanged()
+{
+  QgsVectorLayer *vl = qobject_cast<QgsVectorLayer *>( sender() );
+  if ( vl && mProject->mapLayer( vl->id() ) == vl )
+    indexLayer( vl );
+}
+
+QString FeatureSearchIndex::layerSignature( QgsVectorLayer *layer )
+{
+  QStringList fieldNames;
+  const QgsFields fields = layer->fields();
+  for ( const QgsField &field : fields )
+  {
+#if _QGIS_VERSION_INT >= 33300
+    if ( !field.configurationFlags().testFlag( Qgis::FieldConfigurationFlag::NotSearchable ) )
+#else
+    if ( !field.configurationFlags().testFlag( QgsField::ConfigurationFlag::NotSearchable ) )
+#endif
+      fieldNames << field.name();
+  }
+
+  return QStringList( { layer->source(), layer->displayExpression(), fieldNames.join( QLatin1Char( ',' ) ) } ).join( QLatin1Char( '\n' ) );
+}
+
+void FeatureSearchIndex::indexLayer( QgsVectorLayer *layer )
+{
+  QString path;
+  std::shared_ptr<std::atomic<bool>> canceled = std::make_shared<std::atomic<bool>>( false );
+  {
+    QMutexLocker locker( &mMutex );
+    auto it = mLayerIndexes.find( layer->id() );
+    if ( it != mLayerIndexes.end() )
+    {
+      *it->canceled = true;
+      mLayerIndexes.erase( it );
+    }
+
+    if ( mPath.isEmpty() || !layer->isValid() || !layer->dataProvider() || !layer->flags().testFlag( QgsMapLayer::Searchable ) )
+      return;
+
+    LayerIndex layerIndex;
+    layerIndex.canceled = canceled;
+    mLayerIndexes.insert( layer->id(), layerIndex );
+    path = mPath;
+  }
+
+  const QString layerId = layer->id();
+  const QString signature = layerSignature( layer );
+  const long long featureCount = layer->dataProvider()->featureCount();
+  std::shared_ptr<EntrySource> source = entrySource( layer );
+
+  mThreadPool.start( [this, path, layerId, signature, featureCount, source, canceled] {
+    if ( *canceled )
+      return;
+
+    sqlite3_database_unique_ptr database;
+    if ( !openForWriting( database, path ) )
+      return;
+
+    int status = SQLITE_OK;
+    qint64 tableId = 0;
+    bool upToDate = false;
+    {
+      sqlite3_statement_unique_ptr statement = database.prepare( QStringLiteral( "SELECT id, signature, feature_count, complete FROM layers WHERE layer_id = ?" ), status );
+      if ( status != SQLITE_OK )
+        return;
+
+      bindText( statement.get(), 1, layerId );
+      if ( statement.step() == SQLITE_ROW )
+      {
+        tableId = statement.columnAsInt64( 0 );
+        upToDate = statement.columnAsText( 1 ) == signature && statement.columnAsInt64( 2 ) == featureCount && statement.columnAsInt64( 3 ) == 1;
+      }
+    }
+
+    if ( !upToDate )
+    {
+      QString error;
+      if ( tableId != 0 )
+      {
+        database.exec( QStringLiteral( "DROP TABLE IF EXISTS vocab_%1; DROP TABLE IF EXISTS entries_%1;" ).arg( tableId ), error );
+        sqlite3_statement_unique_ptr statement = database.prepare( QStringLiteral( "UPDATE layers SET signature = ?, complete = 0 WHERE id = ?" ), status );
+        bindText( statement.get(), 1, signature );
+        sqlite3_bind_int64( statement.get(), 2, tableId );
+        statement.step();
+      }
+      else
+      {
+        sqlite3_statement_unique_ptr statement = database.prepare( QStringLiteral( "INSERT INTO layers ( layer_id, signature, feature_count, complete ) VALUES ( ?, ?, 0, 0 )" ), status );
+        bindText( statement.get(), 1, layerId );
+        bindText( statement.get(), 2, signature );
+        if ( statement.step() != SQLITE_DONE )
+          return;
+        tableId = sqlite3_last_insert_rowid( database.get() );
+      }
+
+      // Display expression values rank ten times higher than other field values
+      if ( database.exec( QStringLiteral( "CREATE VIRTUAL TABLE entries_%1 USING fts5( title, content, tokenize = 'unicode61 remove_diacritics 2', prefix = '1 2 3' );"
+                                          "INSERT INTO entries_%1 ( entries_%1, rank ) VALUES ( 'rank', 'bm25(10.0, 1.0)' );"
+                                          "CREATE VIRTUAL TABLE vocab_%1 USING fts5vocab( entries_%1, 'row' );" )
+                            .arg( tableId ),
+                          error )
+           != SQLITE_OK )
+      {
+        QgsMessageLog::logMessage( QObject::tr( "Could not create the search index of layer %1: %2" ).arg( layerId, error ), QStringLiteral( "SIGPACGO" ), Qgis::Warning );
+        return;
+      }
+
+      QgsFeatureIterator iterator = source->featureSource->getFeatures( source->request );
+      if ( !insertEntries( database, tableId, *source, iterator, *canceled ) )
+        return;
+
+      sqlite3_statement_unique_ptr statement = database.prepare( QStringLiteral( "UPDATE layers SET feature_count = ?, complete = 1 WHERE id = ?" ), status );
+      sqlite3_bind_int64( statement.get(), 1, featureCount );
+      sqlite3_bind_int64( statement.get(), 2, tableId );
+      if ( statement.step() != SQLITE_DONE )
+        return;
+    }
+
+    QMetaObject::invokeMethod( this, [this, layerId, tableId, canceled] {
+        if ( *canceled )
+          return;
+
+        {
+          QMutexLocker locker( &mMutex );
+          auto it = mLayerIndexes.find( layerId );
+          if ( it == mLayerIndexes.end() || it->canceled != canceled )
+            return;
+          it->tableId = tableId;
+          it->ready = true;
+        }
+        emit layerIndexed( layerId ); }, Qt::QueuedConnection );
+  } );
+}
+
+void FeatureSearchIndex::onFeaturesCommitted( const QString &layerId, const QgsFeatureIds &addedFids, const QgsFeatureIds &changedFids, const QgsFeatureIds &deletedFids )
+{
+  // Added features are part of the changed ones
+  Q_UNUSED( addedFids )
+
+  QString path;
+  {
+    QMutexLocker locker( &mMutex );
+    if ( !mLayerIndexes.contains( layerId ) )
+      return;
+    path = mPath;
+  }
+
+  QgsVectorLayer *layer = qobject_cast<QgsVectorLayer *>( mProject->mapLayer( layerId ) );
+  if ( !layer || !layer->dataProvider() )
+    return;
+
+  const long long featureCount = layer->dataProvider()->featureCount();
+  std::shared_ptr<EntrySource> source = entrySource( layer );
+  source->request.setFilterFids( changedFids );
+
+  // Queued behind any build of the layer, the table then reflects the commit either way
+  mThreadPool.start( [path, layerId, changedFids, deletedFids, featureCount, source] {
+    sqlite3_database_unique_ptr database;
+    if ( !openForWriting( database, path ) )
+      return;
+
+    const qint64 tableId = completeTableId( database, layerId );
+    if ( tableId == 0 )
+      return;
+
+    int status = SQLITE_OK;
+    QString error;
+    database.exec( QStringLiteral( "BEGIN;" ), error );
+    {
+      sqlite3_statement_unique_ptr statement = database.prepare( QStringLiteral( "DELETE FROM entries_%1 WHERE rowid = ?" ).arg( tableId ), status );
+      if ( status != SQLITE_OK )
+      {
+        database.exec( QStringLiteral( "ROLLBACK;" ), error );
+        return;
+      }
+
+      const QgsFeatureIds removedFids = changedFids + deletedFids;
+      for ( QgsFeatureId fid : removedFids )
+      {
+        sqlite3_reset( statement.get() );
+        sqlite3_bind_int64( statement.get(), 1, fid );
+        statement.step();
+      }
+    }
+    database.exec( QStringLiteral( "COMMIT;" ), error );
+
+    if ( !changedFids.isEmpty() )
+    {
+      const std::atomic<bool> canceled( false );
+      QgsFeatureIterator iterator = source->featureSource->getFeatures( source->request );
+      insertEntries( database, tableId, *source, iterator, canceled );
+    }
+
+    sqlite3_statement_unique_ptr statement = database.prepare( QStringLiteral( "UPDATE layers SET feature_count = ? WHERE id = ?" ), status );
+    sqlite3_bind_int64( statement.get(), 1, featureCount );
+    sqlite3_bind_int64( statement.get(), 2, tableId );
+    statement.step();
+  } );
+}
+
+QList<FeatureSearchIndex::Match> FeatureSearchIndex::search( const QString &layerId, const QString &string, int limit ) const
+{
+  QList<Match> matches;
+
+  QString path;
+  qint64 tableId = 0;
+  {
+    QMutexLocker locker( &mMutex );
+    auto it = mLayerIndexes.constFind( layerId );
+    if ( it == mLayerIndexes.constEnd() || !it->ready )
+      return matches;
+    path = mPath;
+    tableId = it->tableId;
+  }
+
+  const QStringList tokens = tokenize( string );
+  if ( tokens.isEmpty() || limit <= 0 )
+    return matches;
+
+  sqlite3_database_unique_ptr database;
+  if ( database.open_v2( path, SQLITE_OPEN_READONLY, nullptr ) != SQLITE_OK )
+    return matches;
+
+  QSet<QgsFeatureId> foundFids;
+  auto runQuery = [&]( const QString &query, bool fuzzy ) {
+    int status = SQLITE_OK;
+    sqlite3_statement_unique_ptr statement = database.prepare( QStringLiteral( "SELECT rowid, title, snippet( entries_%1, 1, '', '', '…', 8 ) FROM entries_%1 WHERE entries_%1 MATCH ? ORDER BY rank LIMIT ?" ).arg( tableId ), status );
+    if ( status != SQLITE_OK )
+      return;
+
+    bindText( statement.get(), 1, query );
+    sqlite3_bind_int( statement.get(), 2, limit + static_cast<int>( foundFids.size() ) );
+
+    // Matches are scored by rank, those whose display expression starts with the search string first
+    const QString normalizedString = tokens.join( QLatin1Char( ' ' ) );
+    QList<Match> queryMatches;
+    while ( statement.step() == SQLITE_ROW && matches.size() + queryMatches.size() < limit )
+    {
+      Match match;
+      match.fid = statement.columnAsInt64( 0 );
+      if ( foundFids.contains( match.fid ) )
+        continue;
+
+      match.title = statement.columnAsText( 1 );
+      match.excerpt = statement.columnAsText( 2 );
+      match.fuzzy = fuzzy;
+      match.score = ( fuzzy ? 0.5 : 0.75 ) * ( 1.0 - static_cast<double>( queryMatches.size() ) / limit );
+      if ( !fuzzy && tokenize( match.title ).join( QLatin1Char( ' ' ) ).startsWith( normalizedString ) )
+        match.score += 0.25;
+      queryMatches << match;
+    }
+
+    std::stable_sort( queryMatches.begin(), queryMatches.end(), []( const Match &a, const Match &b ) { return a.score > b.score; } );
+    for ( const Match &match : std::as_const( queryMatches ) )
+      foundFids.insert( match.fid );
+    matches << queryMatches;
+  };
+
+  runQuery( matchQuery( tokens ), false );
+  if ( matches.size() >= limit )
+    return matches;
+
+  // Extend words to the indexed terms sharing their first letter within a small edit distance
+  QHash<QString, QStringList> alternatives;
+  for ( const QString &token : tokens )
+  {
+    if ( token.size() < 3 )
+      continue;
+
+    const int maximumDistance = token.size() <= 4 ? 1 : 2;
+    int status = SQLITE_OK;
+    sqlite3_statement_unique_ptr statement = database.prepare( QStringLiteral( "SELECT term, doc FROM vocab_%1 WHERE term >= ? AND term < ? LIMIT %2" ).arg( tableId ).arg( MaximumScannedTerms ), status );
+    if ( status != SQLITE_OK )
+      continue;
+
+    const QChar first = token.at( 0 );
+    bindText( statement.get(), 1, QString( first ) );
+    bindText( statement.get(), 2, QString( QChar( first.unicode() + 1 ) ) );
+
+    QList<std::tuple<int, qint64, QString>> candidates;
+    while ( statement.step() == SQLITE_ROW )
+    {
+      const QString term = statement.columnAsText( 0 );
+      if ( term.startsWith( token ) )
+        continue;
+
+      const int distance = std::min( editDistance( token, term.left( token.size() ), maximumDistance ), editDistance( token, term, maximumDistance ) );
+      if ( distance <= maximumDistance )
+        candidates << std::make_tuple( distance, -statement.columnAsInt64( 1 ), term );
+    }
+
+    std::sort( candidates.begin(), candidates.end() );
+    QStringList terms;
+    for ( int i = 0; i < std::min<int>( candidates.size(), MaximumAlternatives ); ++i )
+      terms << std::get<2>( candidates.at( i ) );
+    if ( !terms.isEmpty() )
+      alternatives.insert( token, terms );
+  }
+
+  if ( !alternatives.isEmpty() )
+    runQuery( matchQuery( tokens, alternatives ), true );
+
+  return matches;
+}
+
+QStringList FeatureSearchIndex::tokenize( const QString &string )
+{
+  const QString decomposed = string.normalized( QString::NormalizationForm_D ).toCaseFolded();
+
+  QStringList tokens;
+  QString token;
+  for ( const QChar &character : decomposed )
+  {
+    if ( character.category() == QChar::Mark_NonSpacing )
+      continue;
+
+    if ( character.isLetterOrNumber() )
+    {
+      token += character;
+    }
+    else if ( !token.isEmpty() )
+    {
+      tokens << token;
+      token.clear();
+    }
+  }
+  if ( !token.isEmpty() )
+    tokens << token;
+
+  return tokens;
+}
+
+int FeatureSearchIndex::editDistance( const QString &a, const QString &b, int maximum )
+{
+  if ( std::abs( a.size() - b.size() ) > maximum )
+    return maximum + 1;
+
+  // Optimal string alignment distance, keeping the last three rows only
+  const int columns = static_cast<int>( b.size() ) + 1;
+  QVector<int> previousPrevious( columns ), previous( columns ), current( columns );
+  for ( int j = 0; j < columns; ++j )
+    previous[j] = j;
+
+  for ( int i = 1; i <= a.size(); ++i )
+  {
+    current[0] = i;
+    int rowMinimum = current[0];
+    for ( int j = 1; j < columns; ++j )
+    {
+      const int cost = a.at( i - 1 ) == b.at( j - 1 ) ? 0 : 1;
+      current[j] = std::min( { previous[j] + 1, current[j - 1] + 1, previous[j - 1] + cost } );
+      if ( i > 1 && j > 1 && a.at( i - 1 ) == b.at( j - 2 ) && a.at( i - 2 ) == b.at( j - 1 ) )
+        current[j] = std::min( current[j], previousPrevious[j - 2] + 1 );
+      rowMinimum = std::min( rowMinimum, current[j] );
+    }
+
+    if ( rowMinimum > maximum )
+      return maximum + 1;
+
+    std::swap( previousPrevious, previous );
+    std::swap( previous, current );
+  }
+
+  return std::min( previous[columns - 1], maximum + 1 );
+}
+
+QString FeatureSearchIndex::matchQuery( const QStringList &tokens, const QHash<QString, QStringList> &alternatives )
+{
+  QStringList parts;
+  for ( const QString &token : tokens )
+  {
+    QStringList terms( { QStringLiteral( "%1*" ).arg( quotedTerm( token ) ) } );
+    const QStringList tokenAlternatives = alternatives.value( token );
+    for ( const QString &alternative : tokenAlternatives )
+      terms << quotedTerm( alternative );
+
+    parts << ( terms.size() == 1 ? terms.first() : QStringLiteral( "( %1 )" ).arg( terms.join( QLatin1String( " OR " ) ) ) );
+  }
+  return parts.join( QLatin1String( " AND " ) );
+}
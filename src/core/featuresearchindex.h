@@ -0,0 +1,149 @@
+/***************************************************************************
+  featuresearchindex.h - FeatureSearchIndex
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef FEATURESEARCHINDEX_H
+#define FEATURESEARCHINDEX_H
+
+#include "qfield_core_export.h"
+
+#include <QHash>
+#include <QMutex>
+#include <QObject>
+#include <QThreadPool>
+#include <qgsfeatureid.h>
+
+#include <atomic>
+#include <memory>
+
+class LayerObserver;
+class QgsMapLayer;
+class QgsProject;
+class QgsVectorLayer;
+
+/**
+ * \brief Full-text index of the features of the searchable layers of a project.
+ *
+ * Each searchable vector layer gets its own SQLite FTS5 table, stored in a sidecar
+ * next to the project file, holding the display expression value of every feature
+ * along with the values of its searchable fields. Tables are built in the background
+ * when a project is opened or a display expression changes, and kept current from the
+ * commits reported by the LayerObserver.
+ *
+ * Searches match every word of the search string as a prefix, ranked by relevance with
+ * the display expression weighing more than the other fields. When too few features
+ * match, words are extended to indexed terms within a small edit distance. Layers
+ * without a ready table are left to the caller to search through their provider.
+ * \ingroup core
+ */
+class QFIELD_CORE_EXPORT FeatureSearchIndex : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY( bool enabled READ enabled WRITE setEnabled NOTIFY enabledChanged )
+
+  public:
+    //! A feature matching a search
+    struct Match
+    {
+        QgsFeatureId fid = FID_NULL;
+        //! Display expression value of the feature
+        QString title;
+        //! Excerpt of the searchable fields values around the matching words
+        QString excerpt;
+        //! Relevance of the match, between 0 and 1
+        double score = 0;
+        //! Whether the match required extending words to similar terms
+        bool fuzzy = false;
+    };
+
+    explicit FeatureSearchIndex( QgsProject *project, LayerObserver *layerObserver, QObject *parent = nullptr );
+    ~FeatureSearchIndex() override;
+
+    //! Returns TRUE if layers get indexed
+    bool enabled() const { return mEnabled; }
+
+    //! Sets whether layers get indexed, disabling the index leaves searches to the providers
+    void setEnabled( bool enabled );
+
+    //! Returns TRUE if the layer with a given \a layerId can be searched through the index
+    bool isReady( const QString &layerId ) const;
+
+    /**
+     * Searches the layer with a given \a layerId for features matching a \a string, returning
+     * at most \a limit matches ordered by decreasing relevance. Can be called from any thread.
+     */
+    QList<Match> search( const QString &layerId, const QString &string, int limit ) const;
+
+    //! Returns the lowercase, diacritics-free words of a \a string, the way they are indexed
+    static QStringList tokenize( const QString &string );
+
+    /**
+     * Returns the Damerau-Levenshtein distance between two strings \a a and \a b, or
+     * \a maximum + 1 as soon as it is known to exceed \a maximum.
+     */
+    static int editDistance( const QString &a, const QString &b, int maximum );
+
+    /**
+     * Returns the FTS5 query matching every token as a prefix. A token with \a alternatives
+     * also matches any of its alternative terms.
+     */
+    static QString matchQuery( const QStringList &tokens, const QHash<QString, QStringList> &alternatives = QHash<QString, QStringList>() );
+
+  signals:
+    void enabledChanged();
+
+    //! Emitted when the layer with a given \a layerId has been indexed
+    void layerIndexed( const QString &layerId );
+
+  private slots:
+    void onHomePathChanged();
+    void onLayersAdded( const QList<QgsMapLayer *> &layers );
+    void onLayersWillBeRemoved( const QStringList &layerIds );
+    void onLayerChanged();
+    void onFeaturesCommitted( const QString &layerId, const QgsFeatureIds &addedFids, const QgsFeatureIds &changedFids, const QgsFeatureIds &deletedFids );
+
+  private:
+    struct LayerIndex
+    {
+        //! Id of the layer table in the sidecar, 0 until known
+        qint64 tableId = 0;
+        bool ready = false;
+        std::shared_ptr<std::atomic<bool>> canceled;
+    };
+
+    //! Checks the table of a \a layer, rebuilding it if it doesn't match the layer anymore
+    void indexLayer( QgsVectorLayer *layer );
+
+    //! Returns the description of what is indexed for a \a layer, a different one requiring a rebuild
+    static QString layerSignature( QgsVectorLayer *layer );
+
+    void cancelAll();
+
+    QgsProject *mProject = nullptr;
+    bool mEnabled = true;
+    QString mPath;
+
+    mutable QMutex mMutex;
+    QHash<QString, LayerIndex> mLayerIndexes;
+
+    /**
+     * A single thread writes to the sidecar, serializing builds and updates. Unlike the
+     * FeatureQueryExecutor, which runs queries concurrently, it guarantees that an update
+     * is only applied once the table it updates has been built.
+     */
+    QThreadPool mThreadPool;
+};
+
+#endif // FEATURESEARCHINDEX_H
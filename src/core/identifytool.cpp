@@ -21,15 +21,103 @@
 #include <qgsproject.h>
 #include <qgsrenderer.h>
 #include <qgsvectorlayer.h>
+#include <qgsvectorlayerfeatureiterator.h>
 #include <qgsvectorlayertemporalproperties.h>
 
+/**
+ * Everything needed to identify the features of a layer away from the GUI thread.
+ */
+struct IdentifyTool::LayerRequest
+{
+    QPointer<QgsVectorLayer> layer;
+    std::unique_ptr<QgsVectorLayerFeatureSource> source;
+    QgsFeatureRequest request;
+    QgsFields fields;
+    std::unique_ptr<QgsFeatureRenderer> renderer;
+    QgsRenderContext context;
+    //! TRUE if the renderer filter is known and already part of the request
+    bool rendererFilterCached = false;
+    QString rendererFilter;
+};
+
+static QString combineFilters( const QString &filter1, const QString &filter2 )
+{
+  if ( filter1.isEmpty() )
+    return filter2;
+  if ( filter2.isEmpty() )
+    return filter1;
+  return QStringLiteral( "(%1) AND (%2)" ).arg( filter1, filter2 );
+}
+
+QgsFeatureList IdentifyTool::identifyFeatures( LayerRequest &layerRequest, const std::atomic<bool> &canceled )
+{
+  QgsFeatureList features;
+  QgsRenderContext &context = layerRequest.context;
+  QgsFeatureRenderer *renderer = layerRequest.renderer.get();
+
+  if ( renderer )
+  {
+    renderer->startRender( context, layerRequest.fields );
+
+    if ( !layerRequest.rendererFilterCached )
+    {
+      layerRequest.rendererFilter = renderer->filter( layerRequest.fields );
+      if ( layerRequest.rendererFilter == QLatin1String( "FALSE" ) )
+      {
+        renderer->stopRender( context );
+        return features;
+      }
+
+      if ( !layerRequest.rendererFilter.isEmpty() )
+      {
+        const QString filter = layerRequest.request.filterExpression() ? layerRequest.request.filterExpression()->expression() : QString();
+        layerRequest.request.setFilterExpression( combineFilters( filter, layerRequest.rendererFilter ) );
+      }
+    }
+  }
+
+  // The search rectangle or features may not be transformable, no features are found then
+  try
+  {
+    QgsFeatureIterator fit = layerRequest.source->getFeatures( layerRequest.request );
+    QgsFeature f;
+    while ( !canceled.load() && fit.nextFeature( f ) )
+    {
+      context.expressionContext().setFeature( f );
+      if ( renderer && !renderer->willRenderFeature( f, context ) )
+        continue;
+
+      features << f;
+    }
+  }
+  catch ( QgsCsException &cse )
+  {
+    Q_UNUSED( cse );
+  }
+
+  if ( renderer )
+  {
+    renderer->stopRender( context );
+  }
+
+  return features;
+}
+
 IdentifyTool::IdentifyTool( QObject *parent )
   : QObject( parent )
   , mMapSettings( nullptr )
+  , mCanceled( std::make_shared<std::atomic<bool>>( false ) )
   , mSearchRadiusMm( 5 )
 {
 }
 
+IdentifyTool::~IdentifyTool()
+{
+  // Workers post their results to the tool, they must be done before it goes away
+  mCanceled->store( true );
+  mThreadPool.waitForDone();
+}
+
 QgsQuickMapSettings *IdentifyTool::mapSettings() const
 {
   return mMapSettings;
@@ -44,7 +132,7 @@ void IdentifyTool::setMapSettings( QgsQuickMapSettings *mapSettings )
   emit mapSettingsChanged();
 }
 
-void IdentifyTool::identify( const QPointF &point ) const
+void IdentifyTool::identify( const QPointF &point )
 {
   if ( mDeactivated )
     return;
@@ -55,7 +143,10 @@ void IdentifyTool::identify( const QPointF &point ) const
     return;
   }
 
+  cancel();
+
   mModel->clear( true );
+  mIdentifyModel = mModel;
 
   QgsPointXY mapPoint = mMapSettings->screenToCoordinate( point );
 
@@ -66,36 +157,112 @@ void IdentifyTool::identify( const QPointF &point ) const
       continue;
 
     QgsVectorLayer *vl = qobject_cast<QgsVectorLayer *>( layer );
-    if ( vl )
-    {
-      QList<IdentifyResult> results = identifyVectorLayer( vl, mapPoint );
-      mModel->appendFeatures( results );
-    }
+    if ( !vl )
+      continue;
+
+    std::shared_ptr<LayerRequest> request = prepareLayerRequest( vl, mapPoint );
+    if ( !request )
+      continue;
+
+    const int index = static_cast<int>( mLayerResults.size() );
+    mLayerResults << QList<IdentifyResult>();
+    mLayerDone << false;
+
+    mThreadPool.start( [this, request, index, generation = mGeneration, canceled = mCanceled] {
+      const QgsFeatureList features = identifyFeatures( *request, *canceled );
+      if ( canceled->load() )
+        return;
+
+      QMetaObject::invokeMethod( this, [this, generation, index, request, features] { onLayerIdentified( generation, index, request, features ); }, Qt::QueuedConnection );
+    } );
   }
 }
 
-QList<IdentifyTool::IdentifyResult> IdentifyTool::identifyVectorLayer( QgsVectorLayer *layer, const QgsPointXY &point ) const
+void IdentifyTool::cancel()
 {
-  QList<IdentifyResult> results;
+  mCanceled->store( true );
+  mCanceled = std::make_shared<std::atomic<bool>>( false );
+  mGeneration++;
+
+  mIdentifyModel.clear();
+  mLayerResults.clear();
+  mLayerDone.clear();
+  mNextLayerIndex = 0;
+}
+
+void IdentifyTool::onLayerIdentified( int generation, int index, const std::shared_ptr<LayerRequest> &request, const QgsFeatureList &features )
+{
+  if ( generation != mGeneration )
+    return;
+
+  QgsVectorLayer *layer = request->layer;
+  if ( layer && !request->rendererFilterCached )
+  {
+    mRendererFilters.insert( layer->id(), RendererFilter { request->context.rendererScale(), request->rendererFilter } );
+    connect( layer, &QgsMapLayer::rendererChanged, this, &IdentifyTool::onLayerRendererChanged, Qt::UniqueConnection );
+    connect( layer, &QgsMapLayer::styleChanged, this, &IdentifyTool::onLayerRendererChanged, Qt::UniqueConnection );
+  }
 
+  if ( layer )
+  {
+    for ( const QgsFeature &feature : features )
+      mLayerResults[index].append( IdentifyResult( layer, feature ) );
+  }
+  mLayerDone[index] = true;
+
+  // Results are appended following the layer order, as soon as the preceding layers are done
+  while ( mNextLayerIndex < mLayerDone.size() && mLayerDone.at( mNextLayerIndex ) )
+  {
+    if ( mIdentifyModel && !mLayerResults.at( mNextLayerIndex ).isEmpty() )
+      mIdentifyModel->appendFeatures( mLayerResults.at( mNextLayerIndex ) );
+    mLayerResults[mNextLayerIndex].clear();
+    mNextLayerIndex++;
+  }
+}
+
+void IdentifyTool::onLayerRendererChanged()
+{
+  if ( QgsMapLayer *layer = qobject_cast<QgsMapLayer *>( sender() ) )
+    mRendererFilters.remove( layer->id() );
+}
+
+std::shared_ptr<IdentifyTool::LayerRequest> IdentifyTool::prepareLayerRequest( QgsVectorLayer *layer, const QgsPointXY &point ) const
+{
   if ( !layer || !layer->isSpatial() )
-    return results;
+    return nullptr;
 
-  if ( !layer->isInScaleRange( mMapSettings->mapSettings().scale() ) )
-    return results;
+  const QgsMapSettings mapSettings = mMapSettings->mapSettings();
+  if ( !layer->isInScaleRange( mapSettings.scale() ) )
+    return nullptr;
 
   QString temporalFilter;
   if ( mMapSettings->isTemporal() )
   {
-    if ( !layer->temporalProperties()->isVisibleInTemporalRange( mMapSettings->mapSettings().temporalRange() ) )
-      return results;
+    if ( !layer->temporalProperties()->isVisibleInTemporalRange( mapSettings.temporalRange() ) )
+      return nullptr;
 
     QgsVectorLayerTemporalContext temporalContext;
     temporalContext.setLayer( layer );
-    temporalFilter = qobject_cast<const QgsVectorLayerTemporalProperties *>( layer->temporalProperties() )->createFilterString( temporalContext, mMapSettings->mapSettings().temporalRange() );
+    temporalFilter = qobject_cast<const QgsVectorLayerTemporalProperties *>( layer->temporalProperties() )->createFilterString( temporalContext, mapSettings.temporalRange() );
   }
 
-  QgsFeatureList featureList;
+  // Layers whose renderer draws nothing at this scale are skipped altogether
+  QString rendererFilter;
+  bool rendererFilterCached = false;
+  auto cachedFilter = mRendererFilters.constFind( layer->id() );
+  if ( cachedFilter != mRendererFilters.constEnd() && qgsDoubleNear( cachedFilter->scale, mapSettings.scale() ) )
+  {
+    if ( cachedFilter->expression == QLatin1String( "FALSE" ) )
+      return nullptr;
+
+    rendererFilter = cachedFilter->expression;
+    rendererFilterCached = true;
+  }
+
+  auto layerRequest = std::make_shared<LayerRequest>();
+  layerRequest->layer = layer;
+  layerRequest->rendererFilterCached = rendererFilterCached;
+  layerRequest->rendererFilter = rendererFilter;
 
   // toLayerCoordinates will throw an exception for an 'invalid' point.
   // For example, if you project a world map onto a globe using EPSG 2163
@@ -111,63 +278,62 @@ QList<IdentifyTool::IdentifyResult> IdentifyTool::identifyVectorLayer( QgsVector
     r.setYMinimum( point.y() - searchRadius );
     r.setYMaximum( point.y() + searchRadius );
 
-    r = toLayerCoordinates( layer, r );
-
-    QgsFeatureRequest req;
-    req.setFilterRect( r );
-    if ( !temporalFilter.isEmpty() )
-      req.setFilterExpression( temporalFilter );
-    req.setLimit( QSettings().value( "/QField/identify/limit", 200 ).toInt() );
-#if _QGIS_VERSION_INT >= 33500
-    req.setFlags( Qgis::FeatureRequestFlag::ExactIntersect );
-#else
-    req.setFlags( QgsFeatureRequest::ExactIntersect );
-#endif
-
-    QgsAttributeTableConfig config = layer->attributeTableConfig();
-    if ( !config.sortExpression().isEmpty() )
-    {
-      req.addOrderBy( config.sortExpression(), config.sortOrder() == Qt::AscendingOrder );
-    }
-    else if ( !layer->displayExpression().isEmpty() )
-    {
-      req.addOrderBy( layer->displayExpression() );
-    }
-
-    QgsFeatureIterator fit = layer->getFeatures( req );
-    QgsFeature f;
-    while ( fit.nextFeature( f ) )
-      featureList << QgsFeature( f );
+    layerRequest->request.setFilterRect( toLayerCoordinates( layer, r ) );
   }
   catch ( QgsCsException &cse )
   {
     Q_UNUSED( cse );
     // catch exception for 'invalid' point and proceed with no features found
+    return nullptr;
   }
 
-  QgsRenderContext context( QgsRenderContext::fromMapSettings( mMapSettings->mapSettings() ) );
-  context.setExpressionContext( QgsExpressionContext( QgsExpressionContextUtils::globalProjectLayerScopes( layer ) ) );
-  context.expressionContext() << QgsExpressionContextUtils::mapSettingsScope( mMapSettings->mapSettings() );
-  QgsFeatureRenderer *renderer = layer->renderer();
+  QgsFeatureRequest &req = layerRequest->request;
+  const QString filter = combineFilters( temporalFilter, rendererFilter );
+  if ( !filter.isEmpty() )
+    req.setFilterExpression( filter );
+  req.setLimit( QSettings().value( "/QField/identify/limit", 200 ).toInt() );
+#if _QGIS_VERSION_INT >= 33500
+  req.setFlags( Qgis::FeatureRequestFlag::ExactIntersect );
+#else
+  req.setFlags( QgsFeatureRequest::ExactIntersect );
+#endif
 
-  if ( renderer )
+  QgsAttributeTableConfig config = layer->attributeTableConfig();
+  if ( !config.sortExpression().isEmpty() )
   {
-    renderer->startRender( context, layer->fields() );
+    req.addOrderBy( config.sortExpression(), config.sortOrder() == Qt::AscendingOrder );
   }
-
-  for ( const QgsFeature &feature : std::as_const( featureList ) )
+  else if ( !layer->displayExpression().isEmpty() )
   {
-    context.expressionContext().setFeature( feature );
-    if ( renderer && !renderer->willRenderFeature( const_cast<QgsFeature &>( feature ), context ) )
-      continue;
-
-    results.append( IdentifyResult( layer, feature ) );
+    req.addOrderBy( layer->displayExpression() );
   }
 
-  if ( renderer )
-  {
-    renderer->stopRender( context );
-  }
+  // Everything touching the layer happens here, on the thread owning it
+  layerRequest->context = QgsRenderContext::fromMapSettings( mapSettings );
+  layerRequest->context.setExpressionContext( QgsExpressionContext( QgsExpressionContextUtils::globalProjectLayerScopes( layer ) ) );
+  layerRequest->context.expressionContext() << QgsExpressionContextUtils::mapSettingsScope( mapSettings );
+  req.setExpressionContext( layerRequest->context.expressionContext() );
+
+  layerRequest->fields = layer->fields();
+  if ( layer->renderer() )
+    layerRequest->renderer.reset( layer->renderer()->clone() );
+  layerRequest->source = std::make_unique<QgsVectorLayerFeatureSource>( layer );
+
+  return layerRequest;
+}
+
+QList<IdentifyTool::IdentifyResult> IdentifyTool::identifyVectorLayer( QgsVectorLayer *layer, const QgsPointXY &point ) const
+{
+  QList<IdentifyResult> results;
+
+  std::shared_ptr<LayerRequest> request = prepareLayerRequest( layer, point );
+  if ( !request )
+    return results;
+
+  const std::atomic<bool> canceled( false );
+  const QgsFeatureList features = identifyFeatures( *request, canceled );
+  for ( const QgsFeature &feature : features )
+    results.append( IdentifyResult( layer, feature ) );
 
   return results;
 }
@@ -189,7 +355,10 @@ void IdentifyTool::setModel( MultiFeatureListModel *model )
 void IdentifyTool::setDeactivated( bool deactivated )
 {
   if ( deactivated )
+  {
+    cancel();
     mModel->clear();
+  }
   mDeactivated = deactivated;
 }
 
@@ -17,17 +17,28 @@
 #define IDENTIFYTOOL_H
 
 #include <QObject>
+#include <QPointer>
+#include <QThreadPool>
 #include <qgsfeature.h>
 #include <qgsmapsettings.h>
 #include <qgspoint.h>
 #include <qgsrendercontext.h>
 
+#include <atomic>
+#include <memory>
+
 class QgsMapLayer;
 class QgsQuickMapSettings;
 class QgsVectorLayer;
 class MultiFeatureListModel;
 
 /**
+ * Identifies the features found around a point of the map canvas.
+ *
+ * Layers are queried in parallel on a thread pool, through feature source snapshots,
+ * and results are appended to the model as soon as a layer and the ones preceding it
+ * are done. Features are prefiltered with the filter expression of the layer renderers,
+ * cached per layer, so that features which are not drawn are skipped by the providers.
  * \ingroup core
  */
 class IdentifyTool : public QObject
@@ -53,6 +64,7 @@ class IdentifyTool : public QObject
 
   public:
     explicit IdentifyTool( QObject *parent = nullptr );
+    ~IdentifyTool() override;
 
     QgsQuickMapSettings *mapSettings() const;
     void setMapSettings( QgsQuickMapSettings *mapSettings );
@@ -73,14 +85,53 @@ class IdentifyTool : public QObject
     void deactivatedChanged();
 
   public slots:
-    void identify( const QPointF &point ) const;
+    //! Identifies the features around a \a point in screen coordinates, results are appended to the model as they come
+    void identify( const QPointF &point );
 
+    //! Identifies the features of a \a layer around a \a point in map coordinates, on the calling thread
     QList<IdentifyResult> identifyVectorLayer( QgsVectorLayer *layer, const QgsPointXY &point ) const;
 
+  private slots:
+    void onLayerRendererChanged();
+
   private:
+    struct LayerRequest;
+
+    //! Filter expression of a layer renderer, valid at a given scale
+    struct RendererFilter
+    {
+        double scale = 0.0;
+        QString expression;
+    };
+
+    //! Prepares the request identifying the features of a \a layer around a \a point, nullptr if the layer is skipped
+    std::shared_ptr<LayerRequest> prepareLayerRequest( QgsVectorLayer *layer, const QgsPointXY &point ) const;
+
+    //! Iterates the features of a prepared \a layerRequest, skipping the ones its renderer doesn't draw, on any thread
+    static QgsFeatureList identifyFeatures( LayerRequest &layerRequest, const std::atomic<bool> &canceled );
+
+    //! Called on the GUI thread once the layer at \a index of the identify \a generation is done
+    void onLayerIdentified( int generation, int index, const std::shared_ptr<LayerRequest> &request, const QgsFeatureList &features );
+
+    //! Cancels the ongoing identify
+    void cancel();
+
     QgsQuickMapSettings *mMapSettings = nullptr;
     MultiFeatureListModel *mModel = nullptr;
 
+    QThreadPool mThreadPool;
+    std::shared_ptr<std::atomic<bool>> mCanceled;
+    int mGeneration = 0;
+    //! Model the ongoing identify appends its results to
+    QPointer<MultiFeatureListModel> mIdentifyModel;
+    //! Results of the layers of the ongoing identify, by layer order
+    QList<QList<IdentifyResult>> mLayerResults;
+    QList<bool> mLayerDone;
+    //! Index of the first layer whose results are not appended yet
+    int mNextLayerIndex = 0;
+
+    QHash<QString, RendererFilter> mRendererFilters;
+
     double searchRadiusMU( const QgsRenderContext &context ) const;
     double searchRadiusMU() const;
 
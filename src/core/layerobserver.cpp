@@ -272,6 +272,54 @@ void LayerObserver::onEditingStopped()
 }
 
 
+void LayerObserver::trackCommittedFeaturesAdded( const QString &layerId, const QgsFeatureList &addedFeatures )
+{
+  CommittedFids &committedFids = mCommittedFids[layerId];
+  for ( const QgsFeature &feature : addedFeatures )
+  {
+    committedFids.added.insert( feature.id() );
+    committedFids.changed.insert( feature.id() );
+  }
+}
+
+
+void LayerObserver::trackCommittedFeaturesRemoved( const QString &layerId, const QgsFeatureIds &deletedFeatureIds )
+{
+  CommittedFids &committedFids = mCommittedFids[layerId];
+  committedFids.added.subtract( deletedFeatureIds );
+  committedFids.changed.subtract( deletedFeatureIds );
+  committedFids.deleted.unite( deletedFeatureIds );
+}
+
+
+void LayerObserver::trackCommittedAttributeValuesChanges( const QString &layerId, const QgsChangedAttributesMap &changedAttributesValues )
+{
+  QgsFeatureIds &changedFids = mCommittedFids[layerId].changed;
+  for ( auto it = changedAttributesValues.constBegin(); it != changedAttributesValues.constEnd(); ++it )
+    changedFids.insert( it.key() );
+}
+
+
+void LayerObserver::trackCommittedGeometriesChanges( const QString &layerId, const QgsGeometryMap &changedGeometries )
+{
+  QgsFeatureIds &changedFids = mCommittedFids[layerId].changed;
+  for ( auto it = changedGeometries.constBegin(); it != changedGeometries.constEnd(); ++it )
+    changedFids.insert( it.key() );
+}
+
+
+void LayerObserver::onAfterCommitChanges()
+{
+  const QgsVectorLayer *vl = qobject_cast<QgsVectorLayer *>( sender() );
+  if ( !vl )
+    return;
+
+  const CommittedFids committedFids = mCommittedFids.take( vl->id() );
+  if ( !committedFids.changed.isEmpty() || !committedFids.deleted.isEmpty() )
+    emit featuresCommitted( vl->id(), committedFids.added, committedFids.changed, committedFids.deleted );
+}
+
+
 void LayerObserver::addLayerListeners()
 {
   const QList<QgsMapLayer *> layers = mProject->mapLayers().values();
@@ -282,6 +330,16 @@ void LayerObserver::addLayerListeners()
 
     if ( vl )
     {
+      if ( !vl->readOnly() )
+      {
+        // Commits are reported for every editable layer, the unique connections surviving project changes
+        connect( vl, &QgsVectorLayer::committedFeaturesAdded, this, &LayerObserver::trackCommittedFeaturesAdded, Qt::UniqueConnection );
+        connect( vl, &QgsVectorLayer::committedFeaturesRemoved, this, &LayerObserver::trackCommittedFeaturesRemoved, Qt::UniqueConnection );
+        connect( vl, &QgsVectorLayer::committedAttributeValuesChanges, this, &LayerObserver::trackCommittedAttributeValuesChanges, Qt::UniqueConnection );
+        connect( vl, &QgsVectorLayer::committedGeometriesChanges, this, &LayerObserver::trackCommittedGeometriesChanges, Qt::UniqueConnection );
+        connect( vl, &QgsVectorLayer::afterCommitChanges, this, &LayerObserver::onAfterCommitChanges, Qt::UniqueConnection );
+      }
+
       if ( mObservedLayerIds.contains( vl->id() ) )
         continue;
 
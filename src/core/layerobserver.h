@@ -67,6 +67,16 @@ class LayerObserver : public QObject
     void layerEdited( const QString &layerId );
     void deltaFileWrapperChanged();
 
+    /**
+     * Emitted once changes have been committed to a layer
+     *
+     * @param layerId layer ID
+     * @param addedFids IDs of the features added by the commit
+     * @param changedFids IDs of the features added or modified by the commit
+     * @param deletedFids IDs of the features deleted by the commit
+     */
+    void featuresCommitted( const QString &layerId, const QgsFeatureIds &addedFids, const QgsFeatureIds &changedFids, const QgsFeatureIds &deletedFids );
+
 
   private slots:
     /**
@@ -132,6 +142,36 @@ class LayerObserver : public QObject
     void onEditingStopped();
 
 
+    /**
+     * Collects the IDs of the added features until the commit is over
+     */
+    void trackCommittedFeaturesAdded( const QString &layerId, const QgsFeatureList &addedFeatures );
+
+
+    /**
+     * Collects the IDs of the deleted features until the commit is over
+     */
+    void trackCommittedFeaturesRemoved( const QString &layerId, const QgsFeatureIds &deletedFeatureIds );
+
+
+    /**
+     * Collects the IDs of the features with changed attributes until the commit is over
+     */
+    void trackCommittedAttributeValuesChanges( const QString &layerId, const QgsChangedAttributesMap &changedAttributesValues );
+
+
+    /**
+     * Collects the IDs of the features with changed geometries until the commit is over
+     */
+    void trackCommittedGeometriesChanges( const QString &layerId, const QgsGeometryMap &changedGeometries );
+
+
+    /**
+     * Emits the features committed to the layer
+     */
+    void onAfterCommitChanges();
+
+
   private:
     /**
      * The current Deltas File Wrapper object
@@ -173,6 +213,22 @@ class LayerObserver : public QObject
     QSet<QString> mObservedLayerIds;
 
 
+    struct CommittedFids
+    {
+        QgsFeatureIds added;
+        QgsFeatureIds changed;
+        QgsFeatureIds deleted;
+    };
+
+
+    /**
+     * Added, changed and deleted feature IDs of the commits in progress.
+     * key    - layer ID
+     * value  - added, changed and deleted feature IDs for that layer
+     */
+    QMap<QString, CommittedFids> mCommittedFids;
+
+
     /**
      * Add the needed event listeners to monitor for changes.
      * Assigns listeners only for layer actions of `cloud` and `offline`.
@@ -14,6 +14,7 @@
  *                                                                         *
  ***************************************************************************/
 
+#include "featurecountcache.h"
 #include "layertreemodel.h"
 #include "qfield.h"
 
@@ -114,6 +115,11 @@ QgsRectangle FlatLayerTreeModel::nodeExtent( const QModelIndex &index, QgsQuickM
   return mSourceModel->nodeExtent( mapToSource( index ), mapSettings, buffer );
 }
 
+void FlatLayerTreeModel::setFeatureCountCache( FeatureCountCache *featureCountCache )
+{
+  mSourceModel->setFeatureCountCache( featureCountCache );
+}
+
 FlatLayerTreeModelBase::FlatLayerTreeModelBase( QgsLayerTree *layerTree, QgsProject *project, QObject *parent )
   : QAbstractProxyModel( parent )
   , mProject( project )
@@ -574,18 +580,10 @@ QVariant FlatLayerTreeModelBase::data( const QModelIndex &index, int role ) cons
       QString id;
       if ( QgsLayerTreeModelLegendNode *sym = mLayerTreeModel->index2legendNode( sourceIndex ) )
       {
+        // The position of the node within the legend nodes of its layer lets the provider find it directly
         id += QStringLiteral( "legend" );
         id += '/' + sym->layerNode()->layerId();
-        QStringList legendParts;
-        QModelIndex currentIndex = sourceIndex;
-        while ( sym )
-        {
-          legendParts << QString::number( currentIndex.internalId() );
-          currentIndex = currentIndex.parent();
-          sym = mLayerTreeModel->index2legendNode( currentIndex );
-        }
-        std::reverse( legendParts.begin(), legendParts.end() );
-        id += '/' + legendParts.join( QStringLiteral( "~__~" ) );
+        id += '/' + QString::number( mLayerTreeModel->layerLegendNodes( sym->layerNode() ).indexOf( sym ) );
       }
       else
       {
@@ -843,6 +841,21 @@ QVariant FlatLayerTreeModelBase::data( const QModelIndex &index, int role ) cons
       if ( layer->dataProvider() && layer->dataProvider()->name() == QStringLiteral( "WFS" ) )
         return QVariant();
 
+      if ( mFeatureCountCache )
+      {
+        // Symbol nodes count the features listed when showing their features, other nodes the layer features
+        if ( QgsSymbolLegendNode *symbolNode = qobject_cast<QgsSymbolLegendNode *>( mLayerTreeModel->index2legendNode( sourceIndex ) ) )
+        {
+#if _QGIS_VERSION_INT >= 33500
+          const QString ruleKey = symbolNode->data( static_cast<int>( QgsLayerTreeModelLegendNode::CustomRole::RuleKey ) ).toString();
+#else
+          const QString ruleKey = symbolNode->data( QgsLayerTreeModelLegendNode::RuleKeyRole ).toString();
+#endif
+          return QVariant::fromValue<long>( mFeatureCountCache->symbolFeatureCount( layer, ruleKey ) );
+        }
+        return QVariant::fromValue<long>( mFeatureCountCache->featureCount( layer ) );
+      }
+
       if ( layer->renderer() && layer->renderer()->type() == QStringLiteral( "singleSymbol" ) && layer->renderer()->legendSymbolItems().size() > 0 )
       {
         const long count = layer->featureCount( layer->renderer()->legendSymbolItems().at( 0 ).ruleKey() );
@@ -1152,6 +1165,48 @@ void FlatLayerTreeModelBase::featureCountChanged()
   emit dataChanged( createIndex( 0, 0 ), createIndex( rowCount() - 1, 0 ), QVector<int>() << FlatLayerTreeModel::Name << FlatLayerTreeModel::FeatureCount );
 }
 
+void FlatLayerTreeModelBase::setFeatureCountCache( FeatureCountCache *featureCountCache )
+{
+  if ( mFeatureCountCache == featureCountCache )
+    return;
+
+  if ( mFeatureCountCache )
+    disconnect( mFeatureCountCache, &FeatureCountCache::countsChanged, this, &FlatLayerTreeModelBase::layerFeatureCountsChanged );
+
+  mFeatureCountCache = featureCountCache;
+
+  if ( mFeatureCountCache )
+    connect( mFeatureCountCache, &FeatureCountCache::countsChanged, this, &FlatLayerTreeModelBase::layerFeatureCountsChanged );
+}
+
+void FlatLayerTreeModelBase::layerFeatureCountsChanged( const QString &layerId )
+{
+  if ( mFrozen )
+    return;
+
+  // The rows of a layer are contiguous, its node being followed by its legend nodes
+  int firstRow = -1;
+  int lastRow = -1;
+  for ( auto it = mIndexMap.constBegin(); it != mIndexMap.constEnd(); ++it )
+  {
+    QgsLayerTreeLayer *nodeLayer = nullptr;
+    if ( QgsLayerTreeModelLegendNode *legendNode = mLayerTreeModel->index2legendNode( it.value() ) )
+      nodeLayer = legendNode->layerNode();
+    else if ( QgsLayerTreeNode *node = mLayerTreeModel->index2node( it.value() ); QgsLayerTree::isLayer( node ) )
+      nodeLayer = QgsLayerTree::toLayer( node );
+
+    if ( nodeLayer && nodeLayer->layerId() == layerId )
+    {
+      if ( firstRow == -1 )
+        firstRow = it.key();
+      lastRow = it.key();
+    }
+  }
+
+  if ( firstRow != -1 )
+    emit dataChanged( createIndex( firstRow, 0 ), createIndex( lastRow, 0 ), QVector<int>() << FlatLayerTreeModel::Name << FlatLayerTreeModel::FeatureCount );
+}
+
 QHash<int, QByteArray> FlatLayerTreeModelBase::roleNames() const
 {
   QHash<int, QByteArray> roleNames = QAbstractProxyModel::roleNames();
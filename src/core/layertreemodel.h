@@ -17,9 +17,11 @@
 #ifndef LAYERTREEMODEL_H
 #define LAYERTREEMODEL_H
 
+#include <QPointer>
 #include <QSortFilterProxyModel>
 #include <qgslayertreelayer.h>
 
+class FeatureCountCache;
 class QgsLayerTree;
 class QgsLayerTreeModel;
 class QgsProject;
@@ -86,6 +88,12 @@ class FlatLayerTreeModelBase : public QAbstractProxyModel
     //! Calculate layer tree node extent and add optional buffer
     Q_INVOKABLE QgsRectangle nodeExtent( const QModelIndex &index, QgsQuickMapSettings *mapSettings, const float buffer );
 
+    //! Returns the cache providing feature counts, if NULLPTR features are counted on demand
+    FeatureCountCache *featureCountCache() const { return mFeatureCountCache; }
+
+    //! Sets the cache providing feature counts
+    void setFeatureCountCache( FeatureCountCache *featureCountCache );
+
   signals:
     void mapThemeChanged();
     void isTemporalChanged();
@@ -93,6 +101,7 @@ class FlatLayerTreeModelBase : public QAbstractProxyModel
 
   private:
     void featureCountChanged();
+    void layerFeatureCountsChanged( const QString &layerId );
     void updateTemporalState();
     void adjustTemporalStateFromAddedLayers( const QList<QgsMapLayer *> &layers );
 
@@ -105,6 +114,7 @@ class FlatLayerTreeModelBase : public QAbstractProxyModel
     QString mMapTheme;
     QgsProject *mProject = nullptr;
     QList<QgsLayerTreeLayer *> mLayersInTracking;
+    QPointer<FeatureCountCache> mFeatureCountCache;
 
     bool mIsTemporal = false;
 
@@ -186,6 +196,9 @@ class FlatLayerTreeModel : public QSortFilterProxyModel
     //! Calculate layer tree node extent
     Q_INVOKABLE QgsRectangle nodeExtent( const QModelIndex &index, QgsQuickMapSettings *mapSettings, const float buffer = 0.02 );
 
+    //! Sets the cache providing feature counts
+    void setFeatureCountCache( FeatureCountCache *featureCountCache );
+
   signals:
     void mapThemeChanged();
     void isTemporalChanged();
@@ -0,0 +1,273 @@
+/***************************************************************************
+  lazylayermanager.cpp - LazyLayerManager
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "lazylayermanager.h"
+
+#include <QCoreApplication>
+#include <QDomDocument>
+#include <QRunnable>
+#include <QThread>
+#include <QThreadPool>
+#include <qgslayertree.h>
+#include <qgsmessagelog.h>
+#include <qgsproject.h>
+#include <qgsrasterlayer.h>
+#include <qgsvectortilelayer.h>
+
+/**
+ * Creates a layer on a pool thread and hands it over to the main thread. Data providers
+ * issue their capabilities requests from the constructor, which is what makes creating
+ * remote layers on the main thread so costly.
+ */
+class LazyLayerWorker : public QObject, public QRunnable
+{
+    Q_OBJECT
+
+  public:
+    LazyLayerWorker( const QString &placeholderId, LazyLayerManager::LayerType type, const QString &source, const QString &name, const QString &providerKey, const QgsCoordinateTransformContext &transformContext )
+      : mPlaceholderId( placeholderId )
+      , mType( type )
+      , mSource( source )
+      , mName( name )
+      , mProviderKey( providerKey )
+      , mTransformContext( transformContext )
+    {
+      setAutoDelete( true );
+    }
+
+    void run() override
+    {
+      QgsMapLayer *layer = nullptr;
+      switch ( mType )
+      {
+        case LazyLayerManager::LayerType::Raster:
+        {
+          QgsRasterLayer::LayerOptions options;
+          options.transformContext = mTransformContext;
+          layer = new QgsRasterLayer( mSource, mName, mProviderKey, options );
+          break;
+        }
+
+        case LazyLayerManager::LayerType::VectorTile:
+        {
+          QgsVectorTileLayer::LayerOptions options( mTransformContext );
+          layer = new QgsVectorTileLayer( mSource, mName, options );
+          break;
+        }
+      }
+
+      layer->moveToThread( QCoreApplication::instance()->thread() );
+      emit created( mPlaceholderId, layer );
+    }
+
+  signals:
+    void created( const QString &placeholderId, QgsMapLayer *layer );
+
+  private:
+    QString mPlaceholderId;
+    LazyLayerManager::LayerType mType;
+    QString mSource;
+    QString mName;
+    QString mProviderKey;
+    QgsCoordinateTransformContext mTransformContext;
+};
+
+LazyLayerManager::LazyLayerManager( QgsProject *project, QObject *parent )
+  : QObject( parent )
+  , mProject( project )
+{
+  connect( mProject->layerTreeRoot(), &QgsLayerTreeNode::visibilityChanged, this, &LazyLayerManager::onVisibilityChanged );
+  connect( mProject, &QgsProject::layersWillBeRemoved, this, &LazyLayerManager::onLayersWillBeRemoved );
+  connect( mProject, &QgsProject::writeProject, this, &LazyLayerManager::onWriteProject );
+}
+
+LazyLayerManager::~LazyLayerManager() = default;
+
+QgsMapLayer *LazyLayerManager::addLayer( QgsLayerTreeGroup *group, LayerType type, const QString &source, const QString &name, const QString &providerKey )
+{
+  if ( !mProject || !group )
+    return nullptr;
+
+  // Placeholders are created without a data source, which keeps them off the network
+  QgsMapLayer *placeholder = nullptr;
+  switch ( type )
+  {
+    case LayerType::Raster:
+      placeholder = new QgsRasterLayer();
+      placeholder->setName( name );
+      break;
+
+    case LayerType::VectorTile:
+      placeholder = new QgsVectorTileLayer( QString(), name );
+      break;
+  }
+
+  Definition definition;
+  definition.type = type;
+  definition.source = source;
+  definition.name = name;
+  definition.providerKey = providerKey;
+  mPlaceholders.insert( placeholder->id(), definition );
+
+  mProject->addMapLayer( placeholder, false );
+  group->addLayer( placeholder );
+  return placeholder;
+}
+
+bool LazyLayerManager::isPlaceholder( const QgsMapLayer *layer ) const
+{
+  return layer && mPlaceholders.contains( layer->id() );
+}
+
+void LazyLayerManager::instantiateVisibleLayers()
+{
+  if ( !mProject )
+    return;
+
+  const QStringList placeholderIds = mPlaceholders.keys();
+  for ( const QString &placeholderId : placeholderIds )
+  {
+    QgsLayerTreeLayer *treeLayer = mProject->layerTreeRoot()->findLayer( placeholderId );
+    if ( treeLayer && treeLayer->isVisible() )
+      instantiate( placeholderId );
+  }
+}
+
+void LazyLayerManager::setPaused( bool paused )
+{
+  if ( mPaused == paused )
+    return;
+
+  mPaused = paused;
+  if ( !mPaused )
+    instantiateVisibleLayers();
+}
+
+void LazyLayerManager::onVisibilityChanged( QgsLayerTreeNode *node )
+{
+  if ( mPaused || mPlaceholders.isEmpty() )
+    return;
+
+  // Checking a group makes the placeholders it contains visible without them being notified
+  if ( QgsLayerTree::isGroup( node ) )
+  {
+    const QList<QgsLayerTreeLayer *> treeLayers = QgsLayerTree::toGroup( node )->findLayers();
+    for ( QgsLayerTreeLayer *treeLayer : treeLayers )
+    {
+      if ( treeLayer->isVisible() && mPlaceholders.contains( treeLayer->layerId() ) )
+        instantiate( treeLayer->layerId() );
+    }
+  }
+  else if ( QgsLayerTree::isLayer( node ) )
+  {
+    QgsLayerTreeLayer *treeLayer = QgsLayerTree::toLayer( node );
+    if ( treeLayer->isVisible() && mPlaceholders.contains( treeLayer->layerId() ) )
+      instantiate( treeLayer->layerId() );
+  }
+}
+
+void LazyLayerManager::onLayersWillBeRemoved( const QStringList &layerIds )
+{
+  for ( const QString &layerId : layerIds )
+    mPlaceholders.remove( layerId );
+}
+
+void LazyLayerManager::onWriteProject( QDomDocument &document )
+{
+  if ( mPlaceholders.isEmpty() )
+    return;
+
+  // Placeholders have no data source of their own, saved projects get the actual one
+  QDomNodeList layerElements = document.elementsByTagName( QStringLiteral( "maplayer" ) );
+  for ( int i = 0; i < layerElements.size(); i++ )
+  {
+    QDomElement layerElement = layerElements.at( i ).toElement();
+    const QString layerId = layerElement.firstChildElement( QStringLiteral( "id" ) ).text();
+    if ( !mPlaceholders.contains( layerId ) )
+      continue;
+
+    const Definition definition = mPlaceholders.value( layerId );
+    const QList<QPair<QString, QString>> values = {
+      qMakePair( QStringLiteral( "datasource" ), definition.source ),
+      qMakePair( QStringLiteral( "provider" ), definition.type == LayerType::Raster ? definition.providerKey : QStringLiteral( "xyzvectortiles" ) ),
+    };
+    for ( const auto &value : values )
+    {
+      QDomElement element = layerElement.firstChildElement( value.first );
+      if ( element.isNull() )
+      {
+        element = document.createElement( value.first );
+        layerElement.appendChild( element );
+      }
+      while ( element.hasChildNodes() )
+        element.removeChild( element.firstChild() );
+      element.appendChild( document.createTextNode( value.second ) );
+    }
+  }
+}
+
+void LazyLayerManager::instantiate( const QString &placeholderId )
+{
+  if ( mPending.contains( placeholderId ) )
+    return;
+
+  const Definition definition = mPlaceholders.value( placeholderId );
+  mPending.insert( placeholderId );
+
+  LazyLayerWorker *worker = new LazyLayerWorker( placeholderId, definition.type, definition.source, definition.name, definition.providerKey, mProject->transformContext() );
+  connect( worker, &LazyLayerWorker::created, this, &LazyLayerManager::onLayerCreated, Qt::QueuedConnection );
+  QThreadPool::globalInstance()->start( worker );
+}
+
+void LazyLayerManager::onLayerCreated( const QString &placeholderId, QgsMapLayer *layer )
+{
+  mPending.remove( placeholderId );
+
+  // The placeholder may have been removed in the meantime, e.g. when another project got loaded
+  QgsMapLayer *placeholder = mProject && mPlaceholders.contains( placeholderId ) ? mProject->mapLayer( placeholderId ) : nullptr;
+  QgsLayerTreeLayer *treeLayer = placeholder ? mProject->layerTreeRoot()->findLayer( placeholderId ) : nullptr;
+  QgsLayerTreeGroup *group = treeLayer ? qobject_cast<QgsLayerTreeGroup *>( treeLayer->parent() ) : nullptr;
+  if ( !group )
+  {
+    mPlaceholders.remove( placeholderId );
+    delete layer;
+    return;
+  }
+
+  if ( !layer->isValid() )
+  {
+    // The placeholder stays in place, toggling it again retries
+    QgsMessageLog::logMessage( tr( "Could not load layer %1: %2" ).arg( layer->name(), layer->error().summary() ), QStringLiteral( "SIGPACGO" ), Qgis::Warning );
+    delete layer;
+    return;
+  }
+
+  mPlaceholders.remove( placeholderId );
+  layer->setOpacity( placeholder->opacity() );
+
+  const int index = static_cast<int>( group->children().indexOf( treeLayer ) );
+  const bool checked = treeLayer->itemVisibilityChecked();
+  const bool expanded = treeLayer->isExpanded();
+
+  mProject->addMapLayer( layer, false );
+  QgsLayerTreeLayer *layerTreeLayer = group->insertLayer( index, layer );
+  layerTreeLayer->setItemVisibilityChecked( checked );
+  layerTreeLayer->setExpanded( expanded );
+  mProject->removeMapLayer( placeholderId );
+
+  emit layerInstantiated( layer );
+}
+
+#include "lazylayermanager.moc"
@@ -0,0 +1,111 @@
+/***************************************************************************
+  lazylayermanager.h - LazyLayerManager
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef LAZYLAYERMANAGER_H
+#define LAZYLAYERMANAGER_H
+
+#include "qfield_core_export.h"
+
+#include <QHash>
+#include <QObject>
+#include <QPointer>
+#include <QSet>
+
+class QDomDocument;
+class QgsLayerTreeGroup;
+class QgsLayerTreeNode;
+class QgsMapLayer;
+class QgsProject;
+
+/**
+ * \brief Defers the instantiation of remote layers until they are first made visible.
+ *
+ * Lazy layers enter the project and its layer tree as lightweight placeholders which
+ * carry the layer name but no data provider, so that adding them never waits on a
+ * remote service. As soon as a placeholder becomes visible, the actual layer is
+ * created on the global thread pool, where blocking capabilities requests are
+ * harmless, and replaces the placeholder at the same position of the layer tree.
+ * \ingroup core
+ */
+class QFIELD_CORE_EXPORT LazyLayerManager : public QObject
+{
+    Q_OBJECT
+
+  public:
+    enum class LayerType
+    {
+      Raster,     //!< A raster layer, e.g. WMS or XYZ tiles
+      VectorTile, //!< A vector tile layer
+    };
+    Q_ENUM( LayerType )
+
+    explicit LazyLayerManager( QgsProject *project, QObject *parent = nullptr );
+    ~LazyLayerManager() override;
+
+    /**
+     * Adds a placeholder for a layer of a given \a type, \a source and \a providerKey to the
+     * project and appends it to \a group. The placeholder is returned so that its tree
+     * visibility and opacity can be configured, both carry over to the actual layer.
+     */
+    QgsMapLayer *addLayer( QgsLayerTreeGroup *group, LayerType type, const QString &source, const QString &name, const QString &providerKey = QStringLiteral( "wms" ) );
+
+    //! Returns TRUE if \a layer is a placeholder whose actual layer has not been instantiated yet
+    bool isPlaceholder( const QgsMapLayer *layer ) const;
+
+    //! Returns the number of placeholders left to instantiate
+    int placeholderCount() const { return static_cast<int>( mPlaceholders.size() ); }
+
+    /**
+     * Instantiates the layers of all currently visible placeholders.
+     * This is done automatically whenever a placeholder becomes visible.
+     */
+    void instantiateVisibleLayers();
+
+    /**
+     * Sets whether instantiation is \a paused, e.g. while a project is being set up and the
+     * visibility of its layers is still being adjusted. Resuming instantiates visible placeholders.
+     */
+    void setPaused( bool paused );
+
+  signals:
+    //! Emitted when the actual \a layer has replaced its placeholder
+    void layerInstantiated( QgsMapLayer *layer );
+
+  private slots:
+    void onVisibilityChanged( QgsLayerTreeNode *node );
+    void onLayersWillBeRemoved( const QStringList &layerIds );
+    void onWriteProject( QDomDocument &document );
+    void onLayerCreated( const QString &placeholderId, QgsMapLayer *layer );
+
+  private:
+    struct Definition
+    {
+        LayerType type = LayerType::Raster;
+        QString source;
+        QString name;
+        QString providerKey;
+    };
+
+    void instantiate( const QString &placeholderId );
+
+    QPointer<QgsProject> mProject;
+    bool mPaused = false;
+    //! Definitions of the layers left to instantiate, by placeholder layer id
+    QHash<QString, Definition> mPlaceholders;
+    //! Placeholder layer ids whose actual layer is being created
+    QSet<QString> mPending;
+};
+
+#endif // LAZYLAYERMANAGER_H
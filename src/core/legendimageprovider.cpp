@@ -20,6 +20,7 @@
 #include <qgslayertreemodel.h>
 #include <qgslayertreemodellegendnode.h>
 #include <qgsproject.h>
+#include <qgssymbol.h>
 
 LegendImageProvider::LegendImageProvider( QgsLayerTreeModel *layerTreeModel )
   : QQuickImageProvider( Pixmap )
@@ -27,6 +28,7 @@ LegendImageProvider::LegendImageProvider( QgsLayerTreeModel *layerTreeModel )
   , mRootNode( layerTreeModel->rootGroup() )
 {
   mLayerTreeModel->setFlag( QgsLayerTreeModel::ShowLegendAsTree, true );
+  mCache.setMaxCost( MaximumCacheSize );
 }
 
 QPixmap LegendImageProvider::requestPixmap( const QString &id, QSize *size, const QSize &requestedSize )
@@ -36,88 +38,105 @@ QPixmap LegendImageProvider::requestPixmap( const QString &id, QSize *size, cons
 
   // the id is passed on as an encoded URL string which needs decoding
   const QString decodedId = QUrl::fromPercentEncoding( id.toUtf8() );
-  QStringList idParts = decodedId.split( '/' ).mid( 0, 2 );
-  idParts << decodedId.section( '/', 2 );
+  const QString type = decodedId.section( '/', 0, 0 );
 
-  if ( idParts.value( 0 ) == QStringLiteral( "legend" ) )
+  QString layerId;
+  QgsLayerTreeModelLegendNode *legendNode = nullptr;
+  if ( type == QStringLiteral( "legend" ) )
   {
-    QgsLayerTreeLayer *layerNode = mRootNode->findLayer( idParts.value( 1 ) );
-    QModelIndex layerIndex = mLayerTreeModel->node2index( layerNode );
-    QModelIndex index = mLayerTreeModel->index( 0, 0, layerIndex );
-    QStringList legendParts;
-    while ( index.isValid() )
+    layerId = decodedId.section( '/', 1, -2 );
+    bool ok = false;
+    const int position = decodedId.section( '/', -1 ).toInt( &ok );
+    if ( QgsLayerTreeLayer *layerNode = ok ? mRootNode->findLayer( layerId ) : nullptr )
+      legendNode = mLayerTreeModel->layerLegendNodes( layerNode ).value( position );
+
+    if ( !legendNode )
+      return QPixmap( requestedSize );
+  }
+  else if ( type == QStringLiteral( "layer" ) )
+  {
+    layerId = decodedId.section( '/', 1 );
+    QgsLayerTreeLayer *layerNode = mRootNode->findLayer( layerId );
+    if ( !layerNode )
+      return QPixmap( requestedSize );
+
+    legendNode = mLayerTreeModel->legendNodeEmbeddedInParent( layerNode );
+    if ( !legendNode )
     {
-      legendParts << QString::number( index.internalId() );
-      if ( idParts.value( 2 ) == legendParts.join( QStringLiteral( "~__~" ) ) )
-      {
-        QPixmap pixmap = mLayerTreeModel->data( index, Qt::DecorationRole ).value<QPixmap>();
-        if ( pixmap.isNull() )
-        {
-          QIcon icon = mLayerTreeModel->data( index, Qt::DecorationRole ).value<QIcon>();
-          if ( !icon.isNull() )
-            pixmap = icon.pixmap( iconSize, iconSize );
-        }
-        if ( pixmap.isNull() )
-        {
-          pixmap = QPixmap( iconSize, iconSize );
-          pixmap.fill( QColor( 255, 255, 255 ) );
-        }
-        return pixmap;
-      }
-      else
-      {
-        if ( mLayerTreeModel->hasChildren( index ) )
-        {
-          index = mLayerTreeModel->index( 0, 0, index );
-        }
-        else
-        {
-          legendParts.removeLast();
-
-          QModelIndex nextIndex = mLayerTreeModel->sibling( index.row() + 1, 0, index );
-          while ( !nextIndex.isValid() && index != layerIndex )
-          {
-            legendParts.removeLast();
-            index = index.parent();
-            nextIndex = mLayerTreeModel->sibling( index.row() + 1, 0, index );
-          }
-          index = nextIndex;
-        }
-      }
+      QPixmap pixmap( iconSize, iconSize );
+      pixmap.fill( QColor( 255, 255, 255 ) );
+      return pixmap;
     }
   }
+  else
+  {
+    return QPixmap( requestedSize );
+  }
+
+  // Symbols sized in map units change with the map scale, they are rendered every time
+  QgsSymbolLegendNode *symbolNode = qobject_cast<QgsSymbolLegendNode *>( legendNode );
+  if ( symbolNode && symbolNode->symbol() && symbolNode->symbol()->usesMapUnits() )
+    return renderLegendNode( legendNode, iconSize );
+
+  double mapUnitsPerPixel = 0;
+  int dpi = 0;
+  double scale = 0;
+  mLayerTreeModel->legendMapViewData( &mapUnitsPerPixel, &dpi, &scale );
+
+  const QString key = QStringLiteral( "%1/%2/%3/%4/%5" ).arg( layerId ).arg( revision( legendNode->layerNode()->layer() ) ).arg( iconSize ).arg( dpi ).arg( decodedId );
+  if ( QPixmap *cached = mCache.object( key ) )
+    return *cached;
+
+  const QPixmap pixmap = renderLegendNode( legendNode, iconSize );
+  mCache.insert( key, new QPixmap( pixmap ), 1 + pixmap.width() * pixmap.height() * pixmap.depth() / 8 / 1024 );
+  return pixmap;
+}
 
-  if ( idParts.value( 0 ) == QStringLiteral( "layer" ) )
+QPixmap LegendImageProvider::renderLegendNode( QgsLayerTreeModelLegendNode *legendNode, int iconSize ) const
+{
+  QPixmap pixmap = legendNode->data( Qt::DecorationRole ).value<QPixmap>();
+  if ( pixmap.isNull() )
+  {
+    QIcon icon = legendNode->data( Qt::DecorationRole ).value<QIcon>();
+    if ( !icon.isNull() )
+      pixmap = icon.pixmap( iconSize, iconSize );
+  }
+  if ( pixmap.isNull() )
   {
-    QgsLayerTreeLayer *layerNode = mRootNode->findLayer( idParts.value( 1 ) );
+    pixmap = QPixmap( iconSize, iconSize );
+    pixmap.fill( QColor( 255, 255, 255 ) );
+  }
+  return pixmap;
+}
 
-    if ( layerNode )
+quint64 LegendImageProvider::revision( QgsMapLayer *layer )
+{
+  if ( !layer )
+    return 0;
+
+  auto it = mRevisions.constFind( layer->id() );
+  if ( it != mRevisions.constEnd() )
+    return it.value();
+
+  const QString layerId = layer->id();
+  auto invalidate = [this, layerId] {
+    mRevisions[layerId] = ++mLastRevision;
+
+    const QString prefix = layerId + '/';
+    const QList<QString> keys = mCache.keys();
+    for ( const QString &key : keys )
     {
-      QgsLayerTreeModelLegendNode *legendNode = mLayerTreeModel->legendNodeEmbeddedInParent( layerNode );
-      if ( legendNode )
-      {
-        QPixmap pixmap = legendNode->data( Qt::DecorationRole ).value<QPixmap>();
-        if ( pixmap.isNull() )
-        {
-          QIcon icon = legendNode->data( Qt::DecorationRole ).value<QIcon>();
-          if ( !icon.isNull() )
-            pixmap = icon.pixmap( iconSize, iconSize );
-        }
-        if ( pixmap.isNull() )
-        {
-          pixmap = QPixmap( iconSize, iconSize );
-          pixmap.fill( QColor( 255, 255, 255 ) );
-        }
-        return pixmap;
-      }
-      else
-      {
-        QPixmap pixmap( iconSize, iconSize );
-        pixmap.fill( QColor( 255, 255, 255 ) );
-        return pixmap;
-      }
+      if ( key.startsWith( prefix ) )
+        mCache.remove( key );
     }
-  }
+  };
+  connect( layer, &QgsMapLayer::rendererChanged, this, invalidate );
+  connect( layer, &QgsMapLayer::styleChanged, this, invalidate );
+  connect( layer, &QgsMapLayer::legendChanged, this, invalidate );
+  connect( layer, &QObject::destroyed, this, [this, layerId, invalidate] {
+    invalidate();
+    mRevisions.remove( layerId );
+  } );
 
-  return QPixmap( requestedSize );
+  return mRevisions.insert( layerId, ++mLastRevision ).value();
 }
@@ -16,11 +16,25 @@
 #ifndef LEGENDIMAGEPROVIDER_H
 #define LEGENDIMAGEPROVIDER_H
 
+#include <QCache>
+#include <QHash>
 #include <QQuickImageProvider>
 
 class QgsLayerTreeModel;
+class QgsLayerTreeModelLegendNode;
 class QgsLayerTree;
+class QgsMapLayer;
 
+/**
+ * Provides the legend symbols of the layer tree to QML.
+ *
+ * Legend images are identified with "legend/<layer id>/<position of the legend node>" for
+ * legend nodes, and with "layer/<layer id>" for the legend node embedded in a layer node.
+ *
+ * Rendered symbols are cached per layer style revision and icon size, the revision of
+ * a layer being bumped when its renderer, style or legend changes. Symbols sized in map
+ * units depend on the map scale and are never cached.
+ */
 class LegendImageProvider : public QQuickImageProvider
 {
   public:
@@ -28,9 +42,22 @@ class LegendImageProvider : public QQuickImageProvider
 
     QPixmap requestPixmap( const QString &id, QSize *size, const QSize &requestedSize ) override;
 
+    //! Maximum size in kilobytes of the cached legend symbols
+    static constexpr int MaximumCacheSize = 8 * 1024;
+
   private:
+    //! Returns the pixmap of a \a legendNode, or a blank pixmap of \a iconSize if it has none
+    QPixmap renderLegendNode( QgsLayerTreeModelLegendNode *legendNode, int iconSize ) const;
+
+    //! Returns the style revision of a \a layer, starting to track it if needed
+    quint64 revision( QgsMapLayer *layer );
+
     QgsLayerTreeModel *mLayerTreeModel = nullptr;
     QgsLayerTree *mRootNode = nullptr;
+
+    QCache<QString, QPixmap> mCache;
+    QHash<QString, quint64> mRevisions;
+    quint64 mLastRevision = 0;
 };
 
 #endif // LEGENDIMAGEPROVIDER_H
@@ -16,6 +16,7 @@
 
 #include "activelayerfeatureslocatorfilter.h"
 #include "featurelistextentcontroller.h"
+#include "featuresearchindex.h"
 #include "locatormodelsuperbridge.h"
 #include "qgsquickmapsettings.h"
 
@@ -79,8 +80,12 @@ QStringList ActiveLayerFeaturesLocatorFilter::prepare( const QString &string, co
   bool allowNumeric = false;
   double numericalValue = searchString.toDouble( &allowNumeric );
 
+  // unrestricted searches go through the full-text index once the layer is indexed
+  FeatureSearchIndex *searchIndex = mLocatorBridge->featureSearchIndex();
+  mSearchIndex = !isRestricting && !searchString.isEmpty() && searchIndex && searchIndex->isReady( layer->id() ) ? searchIndex : nullptr;
+
   // search in display expression if no field restriction
-  if ( !isRestricting )
+  if ( !isRestricting && !mSearchIndex )
   {
     QgsFeatureRequest req;
     req.setSubsetOfAttributes( qgis::setToList( mDispExpression.referencedAttributeIndexes( layer->fields() ) ) );
@@ -176,7 +181,7 @@ QStringList ActiveLayerFeaturesLocatorFilter::prepare( const QString &string, co
   }
 
   req.setLimit( mMaxTotalResults );
-  mFieldIterator = layer->getFeatures( req );
+  mFieldIterator = mSearchIndex ? QgsFeatureIterator() : layer->getFeatures( req );
 
   mLayerId = layer->id();
   mLayerName = layer->name();
@@ -218,6 +223,36 @@ void ActiveLayerFeaturesLocatorFilter::fetchResults( const QString &string, cons
     return;
   }
 
+  if ( mSearchIndex )
+  {
+    const QList<FeatureSearchIndex::Match> matches = mSearchIndex->search( mLayerId, searchString, mMaxTotalResults );
+    for ( const FeatureSearchIndex::Match &match : matches )
+    {
+      if ( feedback->isCanceled() )
+        return;
+
+      QgsLocatorResult result;
+      result.displayString = match.title;
+      if ( match.excerpt != match.title )
+        result.description = match.excerpt;
+      result.group = mLayerName;
+#if _QGIS_VERSION_INT >= 33300
+      result.setUserData( QVariantList() << match.fid << mLayerId );
+#else
+      result.userData = QVariantList() << match.fid << mLayerId;
+#endif
+      result.score = match.score;
+      result.actions << QgsLocatorResult::ResultAction( OpenForm, tr( "Open form" ), QStringLiteral( "qrc:/themes/sigpacgo/nodpi/ic_baseline-list_white_24dp.svg" ) );
+      if ( mLayerIsSpatial )
+      {
+        result.actions << QgsLocatorResult::ResultAction( Navigation, tr( "Set feature as destination" ), QStringLiteral( "qrc:/themes/sigpacgo/nodpi/ic_navigation_flag_purple_24dp.svg" ) );
+      }
+
+      emit resultFetched( result );
+    }
+    return;
+  }
+
   // search in display title
   if ( mDisplayTitleIterator.isValid() )
   {
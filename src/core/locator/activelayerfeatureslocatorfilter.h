@@ -24,6 +24,7 @@
 #include <qgsvectorlayerfeatureiterator.h>
 
 
+class FeatureSearchIndex;
 class LocatorModelSuperBridge;
 
 /**
@@ -71,6 +72,7 @@ class ActiveLayerFeaturesLocatorFilter : public QgsLocatorFilter
     QgsExpressionContext mContext;
     QgsFeatureIterator mDisplayTitleIterator;
     QgsFeatureIterator mFieldIterator;
+    FeatureSearchIndex *mSearchIndex = nullptr;
     QString mLayerId;
     QString mLayerName;
     bool mLayerIsSpatial = false;
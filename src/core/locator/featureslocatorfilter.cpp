@@ -16,6 +16,7 @@
 
 #include "featurelistextentcontroller.h"
 #include "featureslocatorfilter.h"
+#include "featuresearchindex.h"
 #include "locatormodelsuperbridge.h"
 #include "qgsquickmapsettings.h"
 
@@ -49,6 +50,7 @@ QStringList FeaturesLocatorFilter::prepare( const QString &string, const QgsLoca
     return QStringList();
 
   mPreparedLayers.clear();
+  FeatureSearchIndex *searchIndex = mLocatorBridge->featureSearchIndex();
   const QMap<QString, QgsMapLayer *> layers = QgsProject::instance()->mapLayers();
   for ( auto it = layers.constBegin(); it != layers.constEnd(); ++it )
   {
@@ -56,6 +58,19 @@ QStringList FeaturesLocatorFilter::prepare( const QString &string, const QgsLoca
     if ( !layer || !layer->isValid() || !layer->dataProvider() || !layer->flags().testFlag( QgsMapLayer::Searchable ) )
       continue;
 
+    if ( searchIndex && searchIndex->isReady( layer->id() ) )
+    {
+      std::shared_ptr<PreparedLayer> preparedLayer( new PreparedLayer() );
+      preparedLayer->layerId = layer->id();
+      preparedLayer->layerName = layer->name();
+      preparedLayer->layerIcon = QgsMapLayerModel::iconForLayer( layer );
+      preparedLayer->layerGeometryType = layer->geometryType();
+      preparedLayer->searchIndex = searchIndex;
+
+      mPreparedLayers.append( preparedLayer );
+      continue;
+    }
+
     QgsExpression expression( layer->displayExpression() );
     QgsExpressionContext expressionContext;
     expressionContext.appendScopes( QgsExpressionContextUtils::globalProjectLayerScopes( layer ) );
@@ -100,6 +115,39 @@ void FeaturesLocatorFilter::fetchResults( const QString &string, const QgsLocato
   // we cannot used const loop since iterator::nextFeature is not const
   for ( auto preparedLayer : std::as_const( mPreparedLayers ) )
   {
+    if ( preparedLayer->searchIndex )
+    {
+      const QList<FeatureSearchIndex::Match> matches = preparedLayer->searchIndex->search( preparedLayer->layerId, string, std::min( mMaxResultsPerLayer, mMaxTotalResults - foundInTotal ) );
+      for ( const FeatureSearchIndex::Match &match : matches )
+      {
+        if ( feedback->isCanceled() )
+          return;
+
+        QgsLocatorResult result;
+        result.group = preparedLayer->layerName;
+        result.displayString = match.title;
+#if _QGIS_VERSION_INT >= 33300
+        result.setUserData( QVariantList() << match.fid << preparedLayer->layerId );
+#else
+        result.userData = QVariantList() << match.fid << preparedLayer->layerId;
+#endif
+        result.icon = preparedLayer->layerIcon;
+        result.score = match.score;
+        result.actions << QgsLocatorResult::ResultAction( OpenForm, tr( "Open form" ), QStringLiteral( "qrc:/themes/sigpacgo/nodpi/ic_baseline-list_white_24dp.svg" ) );
+        if ( preparedLayer->layerGeometryType != Qgis::GeometryType::Null && preparedLayer->layerGeometryType != Qgis::GeometryType::Unknown )
+        {
+          result.actions << QgsLocatorResult::ResultAction( Navigation, tr( "Set feature as destination" ), QStringLiteral( "qrc:/themes/sigpacgo/nodpi/ic_navigation_flag_purple_24dp.svg" ) );
+        }
+
+        emit resultFetched( result );
+        foundInTotal++;
+      }
+
+      if ( foundInTotal >= mMaxTotalResults )
+        break;
+      continue;
+    }
+
     int foundInCurrentLayer = 0;
     QgsFeatureIterator it = preparedLayer->featureSource->getFeatures( preparedLayer->request );
     while ( it.nextFeature( f ) )
@@ -24,6 +24,7 @@
 #include <qgsvectorlayerfeatureiterator.h>
 
 
+class FeatureSearchIndex;
 class LocatorModelSuperBridge;
 
 /**
@@ -55,6 +56,8 @@ class FeaturesLocatorFilter : public QgsLocatorFilter
         QString layerId;
         QIcon layerIcon;
         Qgis::GeometryType layerGeometryType;
+        //! Full-text index searched instead of the feature source when the layer is indexed
+        FeatureSearchIndex *searchIndex = nullptr;
     };
 
     explicit FeaturesLocatorFilter( LocatorModelSuperBridge *locatorBridge, QObject *parent = nullptr );
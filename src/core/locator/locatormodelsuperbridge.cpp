@@ -20,6 +20,7 @@
 #include "expressioncalculatorlocatorfilter.h"
 #include "featurelistextentcontroller.h"
 #include "featureslocatorfilter.h"
+#include "featuresearchindex.h"
 #include "finlandlocatorfilter.h"
 #include "gnsspositioninformation.h"
 #include "gotolocatorfilter.h"
@@ -167,6 +168,20 @@ void LocatorModelSuperBridge::setKeepScale( bool keepScale )
   emit keepScaleChanged();
 }
 
+FeatureSearchIndex *LocatorModelSuperBridge::featureSearchIndex() const
+{
+  return mFeatureSearchIndex;
+}
+
+void LocatorModelSuperBridge::setFeatureSearchIndex( FeatureSearchIndex *featureSearchIndex )
+{
+  if ( featureSearchIndex == mFeatureSearchIndex )
+    return;
+
+  mFeatureSearchIndex = featureSearchIndex;
+  emit featureSearchIndexChanged();
+}
+
 void LocatorModelSuperBridge::requestSearch( const QString &text )
 {
   emit searchRequested( text );
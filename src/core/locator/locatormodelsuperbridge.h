@@ -26,6 +26,7 @@
 
 class QgsQuickMapSettings;
 class FeatureListExtentController;
+class FeatureSearchIndex;
 class PeliasGeocoder;
 class GnssPositionInformation;
 class QFieldLocatorFilter;
@@ -74,6 +75,8 @@ class LocatorModelSuperBridge : public QgsLocatorModelBridge
     Q_PROPERTY( Navigation *navigation READ navigation WRITE setNavigation NOTIFY navigationChanged )
     //! The keep scale flag. When turned on, locator actions should not result in changed scale
     Q_PROPERTY( bool keepScale READ keepScale WRITE setKeepScale NOTIFY keepScaleChanged )
+    //! The full-text index through which feature filters search the indexed layers
+    Q_PROPERTY( FeatureSearchIndex *featureSearchIndex READ featureSearchIndex WRITE setFeatureSearchIndex NOTIFY featureSearchIndexChanged )
 
   public:
     explicit LocatorModelSuperBridge( QObject *parent = nullptr );
@@ -114,6 +117,11 @@ class LocatorModelSuperBridge : public QgsLocatorModelBridge
     //! \copydoc LocatorModelSuperBridge::keepScale
     void setKeepScale( bool keepScale );
 
+    //! \copydoc LocatorModelSuperBridge::featureSearchIndex
+    FeatureSearchIndex *featureSearchIndex() const;
+    //! \copydoc LocatorModelSuperBridge::featureSearchIndex
+    void setFeatureSearchIndex( FeatureSearchIndex *featureSearchIndex );
+
     /**
      * Requests a \a text query against the search bar.
      */
@@ -163,6 +171,7 @@ class LocatorModelSuperBridge : public QgsLocatorModelBridge
     void activeLayerChanged();
     void messageEmitted( const QString &text );
     void keepScaleChanged();
+    void featureSearchIndexChanged();
     void searchRequested( const QString &text );
     void searchTextChangeRequested( const QString &text );
     void locatorFiltersChanged();
@@ -180,6 +189,7 @@ class LocatorModelSuperBridge : public QgsLocatorModelBridge
     PeliasGeocoder *mFinlandGeocoder = nullptr;
     BookmarkModel *mBookmarks = nullptr;
     Navigation *mNavigation = nullptr;
+    FeatureSearchIndex *mFeatureSearchIndex = nullptr;
 };
 
 class LocatorFiltersModel : public QAbstractListModel
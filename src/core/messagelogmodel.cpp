@@ -16,13 +16,24 @@
 #include "messagelogmodel.h"
 
 #include <QDebug>
+#include <QDir>
+#include <QFileInfo>
 #include <qgsapplication.h>
 
+//! Delay after which pending messages are picked up, about one frame
+static const int sProcessingDelay = 16;
+
 MessageLogModel::MessageLogModel( QObject *parent )
   : QAbstractListModel( parent )
   , mMessageLog( QgsApplication::messageLog() )
+  , mPendingMessages( PendingMessagesCapacity )
 {
-  connect( mMessageLog, static_cast<void ( QgsMessageLog::* )( const QString &message, const QString &tag, Qgis::MessageLevel level )>( &QgsMessageLog::messageReceived ), this, &MessageLogModel::onMessageReceived );
+  mProcessingTimer.setSingleShot( true );
+  mProcessingTimer.setInterval( sProcessingDelay );
+  connect( &mProcessingTimer, &QTimer::timeout, this, &MessageLogModel::processPendingMessages );
+
+  // Messages are pushed to the ring buffer on the thread logging them
+  connect( mMessageLog, static_cast<void ( QgsMessageLog::* )( const QString &message, const QString &tag, Qgis::MessageLevel level )>( &QgsMessageLog::messageReceived ), this, &MessageLogModel::onMessageReceived, Qt::DirectConnection );
 }
 
 QHash<int, QByteArray> MessageLogModel::roleNames() const
@@ -44,21 +55,21 @@ int MessageLogModel::rowCount( const QModelIndex &parent ) const
 
 QVariant MessageLogModel::data( const QModelIndex &index, int role ) const
 {
-  if ( index.row() >= mMessages.size() )
+  if ( index.row() < 0 || index.row() >= mMessages.size() )
     return QVariant();
 
+  const LogMessage &message = mMessages.at( mMessages.size() - 1 - index.row() );
   if ( role == MessageRole )
-    return mMessages.at( index.row() ).message;
+    return message.message;
   else if ( role == MessageTagRole )
-    return mMessages.at( index.row() ).tag;
+    return message.tag;
   else if ( role == MessageLevelRole )
-    return mMessages.at( index.row() ).level;
+    return message.level;
   else if ( role == MessageDateTimeRole )
-    return mMessages.at( index.row() ).datetime;
+    return message.datetime.toString( QStringLiteral( "yyyy-MM-dd hh:mm:ss:zzz" ) );
 
   return QVariant();
 }
-
 void MessageLogModel::suppress( const QVariantMap &filters )
 {
   for ( const QString &tags : filters.keys() )
@@ -103,28 +114,190 @@ void MessageLogModel::clear()
 {
   beginResetModel();
   mMessages.clear();
+  mLevelCounts.clear();
   endResetModel();
 }
 
+void MessageLogModel::setLogFilePath( const QString &path )
+{
+  if ( mLogFilePath == path )
+    return;
+
+  mLogFile.close();
+  mLogFilePath = path;
+  if ( !mLogFilePath.isEmpty() )
+  {
+    QDir().mkpath( QFileInfo( mLogFilePath ).absolutePath() );
+    mLogFile.setFileName( mLogFilePath );
+    if ( !mLogFile.open( QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text ) )
+      qWarning() << QStringLiteral( "Could not open log file %1" ).arg( mLogFilePath );
+  }
+
+  emit logFilePathChanged();
+}
+
+int MessageLogModel::retentionLimit( Qgis::MessageLevel level )
+{
+  switch ( level )
+  {
+    case Qgis::Critical:
+      return 2000;
+    case Qgis::Warning:
+      return 1000;
+    case Qgis::Info:
+    case Qgis::Success:
+    case Qgis::NoLevel:
+      break;
+  }
+  return 500;
+}
+
 void MessageLogModel::onMessageReceived( const QString &message, const QString &tag, Qgis::MessageLevel level )
 {
+  // This is called on the thread logging the message, only the ring buffer and atomics can be used here
   if ( tag == QLatin1String( "3D" ) )
   {
     return;
   }
-  else if ( mSuppressedFilters.contains( tag ) )
+
+  if ( !mPendingMessages.push( LogMessage( tag, message, level ) ) )
   {
-    for ( const QString &filter : mSuppressedFilters[tag] )
+    mDroppedMessages++;
+  }
+
+  if ( !mProcessingScheduled.exchange( true ) )
+  {
+    QMetaObject::invokeMethod( &mProcessingTimer, qOverload<>( &QTimer::start ), Qt::QueuedConnection );
+  }
+}
+
+void MessageLogModel::processPendingMessages()
+{
+  // Messages pushed from now on schedule another pass
+  mProcessingScheduled = false;
+
+  QVector<LogMessage> messages;
+  LogMessage message;
+  while ( mPendingMessages.pop( message ) )
+  {
+    writeToLogFile( message );
+
+    bool suppressed = false;
+    if ( mSuppressedFilters.contains( message.tag ) )
     {
-      if ( message.contains( filter, Qt::CaseInsensitive ) )
+      for ( const QString &filter : mSuppressedFilters[message.tag] )
       {
-        return;
+        if ( message.message.contains( filter, Qt::CaseInsensitive ) )
+        {
+          suppressed = true;
+          break;
+        }
       }
     }
+
+    if ( !suppressed )
+      messages << std::move( message );
+  }
+
+  if ( const int dropped = mDroppedMessages.exchange( 0 ) )
+  {
+    messages << LogMessage( QStringLiteral( "SIGPACGO" ), tr( "%n message(s) could not be logged, too many messages were received at once", "", dropped ), Qgis::Warning );
+    writeToLogFile( messages.last() );
   }
 
-  beginInsertRows( QModelIndex(), 0, 0 );
-  mMessages.prepend( LogMessage( tag, message, level ) );
-  qDebug() << "Nes message " << tag << " : " << message;
+  if ( mLogFile.isOpen() )
+    mLogFile.flush();
+
+  if ( messages.isEmpty() )
+    return;
+
+  beginInsertRows( QModelIndex(), 0, static_cast<int>( messages.size() ) - 1 );
+  for ( LogMessage &received : messages )
+  {
+    mLevelCounts[received.level]++;
+    mMessages << std::move( received );
+  }
   endInsertRows();
+
+  applyRetention();
+}
+
+void MessageLogModel::applyRetention()
+{
+  QMap<Qgis::MessageLevel, int> excess;
+  for ( auto it = mLevelCounts.constBegin(); it != mLevelCounts.constEnd(); ++it )
+  {
+    const int count = it.value() - retentionLimit( it.key() );
+    if ( count > 0 )
+      excess.insert( it.key(), count );
+  }
+
+  if ( excess.isEmpty() )
+    return;
+
+  // Flag the oldest messages of each level exceeding its limit
+  QVector<bool> removed( mMessages.size(), false );
+  for ( qsizetype i = 0; i < mMessages.size() && !excess.isEmpty(); ++i )
+  {
+    const Qgis::MessageLevel level = mMessages.at( i ).level;
+    auto it = excess.find( level );
+    if ( it == excess.end() )
+      continue;
+
+    removed[i] = true;
+    mLevelCounts[level]--;
+    if ( --it.value() == 0 )
+      excess.erase( it );
+  }
+
+  // Remove contiguous runs, the most recent first so that older indexes stay valid
+  qsizetype last = mMessages.size() - 1;
+  while ( last >= 0 )
+  {
+    if ( !removed.at( last ) )
+    {
+      last--;
+      continue;
+    }
+
+    qsizetype first = last;
+    while ( first > 0 && removed.at( first - 1 ) )
+      first--;
+
+    const int firstRow = static_cast<int>( mMessages.size() - 1 - last );
+    const int lastRow = static_cast<int>( mMessages.size() - 1 - first );
+    beginRemoveRows( QModelIndex(), firstRow, lastRow );
+    mMessages.remove( first, last - first + 1 );
+    endRemoveRows();
+
+    last = first - 1;
+  }
+}
+
+void MessageLogModel::writeToLogFile( const LogMessage &message )
+{
+  if ( !mLogFile.isOpen() )
+    return;
+
+  static const QStringList levels = { QStringLiteral( "INFO" ), QStringLiteral( "WARNING" ), QStringLiteral( "CRITICAL" ), QStringLiteral( "SUCCESS" ) };
+  const QString level = levels.value( static_cast<int>( message.level ), QStringLiteral( "NONE" ) );
+  const QString line = QStringLiteral( "%1 [%2] %3: %4\n" ).arg( message.datetime.toString( Qt::ISODateWithMs ), level, message.tag, message.message );
+  mLogFile.write( line.toUtf8() );
+
+  if ( mLogFile.size() >= MaximumLogFileSize )
+    rotateLogFile();
+}
+
+void MessageLogModel::rotateLogFile()
+{
+  mLogFile.close();
+
+  // The oldest rotated file is dropped, messages.log.1 becomes messages.log.2 and so on
+  QFile::remove( QStringLiteral( "%1.%2" ).arg( mLogFilePath ).arg( RotatedLogFileCount ) );
+  for ( int i = RotatedLogFileCount - 1; i > 0; --i )
+    QFile::rename( QStringLiteral( "%1.%2" ).arg( mLogFilePath ).arg( i ), QStringLiteral( "%1.%2" ).arg( mLogFilePath ).arg( i + 1 ) );
+  QFile::rename( mLogFilePath, QStringLiteral( "%1.1" ).arg( mLogFilePath ) );
+
+  if ( !mLogFile.open( QIODevice::WriteOnly | QIODevice::Append | QIODevice::Text ) )
+    qWarning() << QStringLiteral( "Could not open log file %1" ).arg( mLogFilePath );
 }
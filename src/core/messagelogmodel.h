@@ -16,19 +16,33 @@
 #ifndef MESSAGELOGMODEL_H
 #define MESSAGELOGMODEL_H
 
+#include "ringbuffer.h"
+
 #include <QAbstractListModel>
 #include <QDateTime>
+#include <QFile>
+#include <QTimer>
 #include <qgsmessagelog.h>
 
+#include <atomic>
+
 /**
  * This model will connect to the message log and publish any
  * messages received from there.
+ *
+ * Messages can be logged from any thread, they are pushed to a bounded lock-free
+ * ring buffer and the model picks them up once per frame with a single row insertion.
+ * The number of messages kept is bounded per level, so that warnings and errors
+ * outlive informational messages. Every message, suppressed or not, can also be
+ * written to a log file rotated once it grows too large.
  * \ingroup core
  */
 class MessageLogModel : public QAbstractListModel
 {
     Q_OBJECT
 
+    Q_PROPERTY( QString logFilePath READ logFilePath WRITE setLogFilePath NOTIFY logFilePathChanged )
+
     struct LogMessage
     {
         LogMessage()
@@ -38,14 +52,14 @@ class MessageLogModel : public QAbstractListModel
           : tag( tag )
           , message( message )
           , level( level )
-          , datetime( QDateTime::currentDateTime().toString( QStringLiteral( "yyyy-MM-dd hh:mm:ss:zzz" ) ) )
+          , datetime( QDateTime::currentDateTime() )
         {
         }
 
         QString tag;
         QString message;
-        Qgis::MessageLevel level;
-        QString datetime;
+        Qgis::MessageLevel level = Qgis::Info;
+        QDateTime datetime;
     };
 
     enum Roles
@@ -57,6 +71,13 @@ class MessageLogModel : public QAbstractListModel
     };
 
   public:
+    //! Number of messages which can wait to be picked up by the model
+    static constexpr int PendingMessagesCapacity = 4096;
+    //! Maximum size of the log file before it gets rotated
+    static constexpr qint64 MaximumLogFileSize = 1024 * 1024;
+    //! Number of rotated log files kept next to the log file
+    static constexpr int RotatedLogFileCount = 3;
+
     explicit MessageLogModel( QObject *parent = nullptr );
 
     QHash<int, QByteArray> roleNames() const override;
@@ -72,13 +93,42 @@ class MessageLogModel : public QAbstractListModel
     //! Clears any messages from the log
     Q_INVOKABLE void clear();
 
+    //! Returns the path of the file messages are written to, empty if none
+    QString logFilePath() const { return mLogFilePath; }
+
+    //! Sets the path of the file messages are written to, an empty path stops writing messages
+    void setLogFilePath( const QString &path );
+
+    //! Returns the maximum number of messages of a given \a level kept by the model
+    static int retentionLimit( Qgis::MessageLevel level );
+
+  signals:
+    void logFilePathChanged();
+
   private slots:
     void onMessageReceived( const QString &message, const QString &tag, Qgis::MessageLevel level );
 
   private:
+    //! Moves pending messages to the model
+    void processPendingMessages();
+    //! Removes the oldest messages of levels exceeding their retention limit
+    void applyRetention();
+    void writeToLogFile( const LogMessage &message );
+    void rotateLogFile();
+
     QgsMessageLog *mMessageLog = nullptr;
+    //! Messages ordered from the oldest to the most recent, the most recent one being the first row
     QVector<LogMessage> mMessages;
+    QMap<Qgis::MessageLevel, int> mLevelCounts;
     QMap<QString, QStringList> mSuppressedFilters;
+
+    RingBuffer<LogMessage> mPendingMessages;
+    std::atomic<bool> mProcessingScheduled { false };
+    std::atomic<int> mDroppedMessages { 0 };
+    QTimer mProcessingTimer;
+
+    QString mLogFilePath;
+    QFile mLogFile;
 };
 
 #endif // MESSAGELOGMODEL_H
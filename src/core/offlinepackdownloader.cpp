@@ -0,0 +1,387 @@
+/***************************************************************************
+  offlinepackdownloader.cpp - OfflinePackDownloader
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "offlinepackdownloader.h"
+
+#include <QNetworkReply>
+#include <QNetworkRequest>
+#include <qgscoordinatereferencesystem.h>
+#include <qgscoordinatetransform.h>
+#include <qgscsexception.h>
+#include <qgsdatasourceuri.h>
+#include <qgslayertree.h>
+#include <qgsmessagelog.h>
+#include <qgsnetworkaccessmanager.h>
+#include <qgsproject.h>
+#include <qgsrasterlayer.h>
+#include <qgsvectortilelayer.h>
+
+#include <algorithm>
+#include <cmath>
+
+//! Number of tile requests kept in flight, low enough to respect public tile servers' usage policies
+static const int sMaximumConcurrentRequests = 4;
+//! Latitude bounds of the web mercator tiling scheme
+static const double sMaximumLatitude = 85.0511287798;
+//! Hosts, along with their subdomains, whose terms of use permit bulk tile downloads
+static const QStringList sBulkDownloadHosts = {
+  QStringLiteral( "sigpac-hubcloud.es" ),
+  QStringLiteral( "ign.es" ),
+  QStringLiteral( "idee.es" ),
+  QStringLiteral( "mapa.gob.es" ),
+  QStringLiteral( "mapama.gob.es" ),
+  QStringLiteral( "juntadeandalucia.es" ),
+};
+
+static int longitudeToTileX( double longitude, int zoom )
+{
+  const int tiles = 1 << zoom;
+  return std::clamp( static_cast<int>( std::floor( ( longitude + 180.0 ) / 360.0 * tiles ) ), 0, tiles - 1 );
+}
+
+static int latitudeToTileY( double latitude, int zoom )
+{
+  const int tiles = 1 << zoom;
+  const double radians = std::clamp( latitude, -sMaximumLatitude, sMaximumLatitude ) * M_PI / 180.0;
+  const double y = ( 1.0 - std::log( std::tan( radians ) + 1.0 / std::cos( radians ) ) / M_PI ) / 2.0 * tiles;
+  return std::clamp( static_cast<int>( std::floor( y ) ), 0, tiles - 1 );
+}
+
+OfflinePackDownloader::OfflinePackDownloader( QObject *parent )
+  : QObject( parent )
+{
+}
+
+OfflinePackDownloader::~OfflinePackDownloader()
+{
+  cancel();
+}
+
+void OfflinePackDownloader::setTileStore( TileStore *tileStore )
+{
+  if ( mTileStore == tileStore )
+    return;
+
+  mTileStore = tileStore;
+  emit tileStoreChanged();
+}
+
+void OfflinePackDownloader::setName( const QString &name )
+{
+  if ( mName == name )
+    return;
+
+  mName = name;
+  emit nameChanged();
+}
+
+void OfflinePackDownloader::setUrlTemplates( const QStringList &urlTemplates )
+{
+  if ( mUrlTemplates == urlTemplates )
+    return;
+
+  mUrlTemplates = urlTemplates;
+  mSources.clear();
+  for ( const QString &urlTemplate : urlTemplates )
+  {
+    Source source;
+    source.urlTemplate = urlTemplate;
+    mSources << source;
+  }
+
+  emit urlTemplatesChanged();
+  emit tileCountChanged();
+}
+
+void OfflinePackDownloader::setMinimumZoom( int minimumZoom )
+{
+  if ( mMinimumZoom == minimumZoom )
+    return;
+
+  mMinimumZoom = minimumZoom;
+  emit minimumZoomChanged();
+  emit tileCountChanged();
+}
+
+void OfflinePackDownloader::setMaximumZoom( int maximumZoom )
+{
+  if ( mMaximumZoom == maximumZoom )
+    return;
+
+  mMaximumZoom = maximumZoom;
+  emit maximumZoomChanged();
+  emit tileCountChanged();
+}
+
+void OfflinePackDownloader::setExtent( const QgsRectangle &extent, const QgsCoordinateReferenceSystem &crs )
+{
+  QgsRectangle wgs84Extent = extent;
+  const QgsCoordinateReferenceSystem wgs84( QStringLiteral( "EPSG:4326" ) );
+  if ( crs.isValid() && crs != wgs84 )
+  {
+    QgsCoordinateTransform transform( crs, wgs84, QgsProject::instance()->transformContext() );
+    try
+    {
+      wgs84Extent = transform.transformBoundingBox( extent );
+    }
+    catch ( const QgsCsException & )
+    {
+      wgs84Extent.setNull();
+    }
+  }
+
+  mExtent = wgs84Extent;
+  emit tileCountChanged();
+}
+
+void OfflinePackDownloader::setSourcesFromProject( QgsProject *project )
+{
+  if ( !project )
+    return;
+
+  QList<Source> sources;
+  QStringList urlTemplates;
+  QStringList skippedSources;
+  const QList<QgsMapLayer *> layers = project->mapLayers().values();
+  for ( QgsMapLayer *layer : layers )
+  {
+    QgsLayerTreeLayer *treeLayer = project->layerTreeRoot()->findLayer( layer );
+    if ( !treeLayer || !treeLayer->isVisible() )
+      continue;
+
+    // Only XYZ sources can be enumerated, WMS layers are cached as they are browsed
+    const bool isRaster = qobject_cast<QgsRasterLayer *>( layer ) && layer->providerType() == QLatin1String( "wms" );
+    if ( !isRaster && !qobject_cast<QgsVectorTileLayer *>( layer ) )
+      continue;
+
+    QgsDataSourceUri uri;
+    uri.setEncodedUri( layer->source() );
+    if ( uri.param( QStringLiteral( "type" ) ) != QLatin1String( "xyz" ) )
+      continue;
+
+    Source source;
+    source.urlTemplate = uri.param( QStringLiteral( "url" ) );
+    if ( source.urlTemplate.isEmpty() || urlTemplates.contains( source.urlTemplate ) )
+      continue;
+
+    if ( !isBulkDownloadAllowed( source.urlTemplate ) )
+    {
+      QgsMessageLog::logMessage( tr( "Layer %1 is left out of the offline pack, its provider does not permit bulk downloads" ).arg( layer->name() ), QStringLiteral( "SIGPACGO" ), Qgis::Info );
+      skippedSources << layer->name();
+      continue;
+    }
+
+    if ( uri.hasParam( QStringLiteral( "zmin" ) ) )
+      source.minimumZoom = uri.param( QStringLiteral( "zmin" ) ).toInt();
+    if ( uri.hasParam( QStringLiteral( "zmax" ) ) )
+      source.maximumZoom = uri.param( QStringLiteral( "zmax" ) ).toInt();
+
+    sources << source;
+    urlTemplates << source.urlTemplate;
+  }
+
+  mSources = sources;
+  mUrlTemplates = urlTemplates;
+  emit urlTemplatesChanged();
+  emit tileCountChanged();
+
+  if ( mSkippedSources != skippedSources )
+  {
+    mSkippedSources = skippedSources;
+    emit skippedSourcesChanged();
+  }
+}
+
+bool OfflinePackDownloader::isBulkDownloadAllowed( const QString &urlTemplate )
+{
+  const QString host = QUrl( urlTemplate ).host().toLower();
+  if ( host.isEmpty() )
+    return false;
+
+  for ( const QString &allowedHost : sBulkDownloadHosts )
+  {
+    if ( host == allowedHost || host.endsWith( QLatin1Char( '.' ) + allowedHost ) )
+      return true;
+  }
+  return false;
+}
+
+QList<QUrl> OfflinePackDownloader::tileUrls( const QString &urlTemplate, const QgsRectangle &extent, int minimumZoom, int maximumZoom )
+{
+  QList<QUrl> urls;
+  if ( extent.isNull() || urlTemplate.isEmpty() )
+    return urls;
+
+  for ( int zoom = std::max( minimumZoom, 0 ); zoom <= maximumZoom; zoom++ )
+  {
+    const int minimumX = longitudeToTileX( extent.xMinimum(), zoom );
+    const int maximumX = longitudeToTileX( extent.xMaximum(), zoom );
+    const int minimumY = latitudeToTileY( extent.yMaximum(), zoom );
+    const int maximumY = latitudeToTileY( extent.yMinimum(), zoom );
+    const int tiles = 1 << zoom;
+
+    QString zoomTemplate = urlTemplate;
+    zoomTemplate.replace( QLatin1String( "{z}" ), QString::number( zoom ) );
+    for ( int x = minimumX; x <= maximumX; x++ )
+    {
+      QString columnTemplate = zoomTemplate;
+      columnTemplate.replace( QLatin1String( "{x}" ), QString::number( x ) );
+      for ( int y = minimumY; y <= maximumY; y++ )
+      {
+        QString url = columnTemplate;
+        url.replace( QLatin1String( "{-y}" ), QString::number( tiles - 1 - y ) );
+        url.replace( QLatin1String( "{y}" ), QString::number( y ) );
+        urls << QUrl( url );
+      }
+    }
+  }
+
+  return urls;
+}
+
+qint64 OfflinePackDownloader::countTiles( const QgsRectangle &extent, int minimumZoom, int maximumZoom )
+{
+  if ( extent.isNull() )
+    return 0;
+
+  qint64 count = 0;
+  for ( int zoom = std::max( minimumZoom, 0 ); zoom <= maximumZoom; zoom++ )
+  {
+    const qint64 columns = longitudeToTileX( extent.xMaximum(), zoom ) - longitudeToTileX( extent.xMinimum(), zoom ) + 1;
+    const qint64 rows = latitudeToTileY( extent.yMinimum(), zoom ) - latitudeToTileY( extent.yMaximum(), zoom ) + 1;
+    count += columns * rows;
+  }
+  return count;
+}
+
+int OfflinePackDownloader::tileCount() const
+{
+  qint64 count = 0;
+  for ( const Source &source : mSources )
+    count += countTiles( mExtent, std::max( mMinimumZoom, source.minimumZoom ), std::min( mMaximumZoom, source.maximumZoom ) );
+  return count > MaximumTileCount ? -1 : static_cast<int>( count );
+}
+
+double OfflinePackDownloader::progress() const
+{
+  if ( mTotalCount == 0 )
+    return 0.0;
+  return static_cast<double>( mCompletedCount + mFailedCount ) / mTotalCount;
+}
+
+bool OfflinePackDownloader::start()
+{
+  if ( mRunning || !mTileStore || !mTileStore->isValid() || mName.isEmpty() )
+    return false;
+
+  const int count = tileCount();
+  if ( count <= 0 )
+    return false;
+
+  mQueue.clear();
+  mQueue.reserve( count );
+  for ( const Source &source : std::as_const( mSources ) )
+    mQueue << tileUrls( source.urlTemplate, mExtent, std::max( mMinimumZoom, source.minimumZoom ), std::min( mMaximumZoom, source.maximumZoom ) );
+
+  mTotalCount = static_cast<int>( mQueue.size() );
+  mCompletedCount = 0;
+  mFailedCount = 0;
+  mRunning = true;
+  emit runningChanged();
+  emit progressChanged();
+
+  downloadNext();
+  return true;
+}
+
+void OfflinePackDownloader::cancel()
+{
+  if ( !mRunning )
+    return;
+
+  mQueue.clear();
+  const QSet<QNetworkReply *> replies = mReplies;
+  mReplies.clear();
+  for ( QNetworkReply *reply : replies )
+  {
+    reply->disconnect( this );
+    reply->abort();
+    reply->deleteLater();
+  }
+
+  finish( false );
+}
+
+void OfflinePackDownloader::downloadNext()
+{
+  bool progressed = false;
+  while ( mReplies.size() < sMaximumConcurrentRequests && !mQueue.isEmpty() )
+  {
+    const QUrl url = mQueue.takeFirst();
+
+    // Tiles already stored are pinned to the pack without hitting the network again
+    QByteArray data;
+    QString contentType;
+    if ( mTileStore->tile( url, data, contentType ) )
+    {
+      mTileStore->insertTile( url, data, contentType, mName );
+      mCompletedCount++;
+      progressed = true;
+      continue;
+    }
+
+    QNetworkRequest request( url );
+    request.setAttribute( static_cast<QNetworkRequest::Attribute>( QgsNetworkRequestParameters::AttributeInitiatorClass ), QStringLiteral( "OfflinePackDownloader" ) );
+    QNetworkReply *reply = QgsNetworkAccessManager::instance()->get( request );
+    mReplies.insert( reply );
+    connect( reply, &QNetworkReply::finished, this, [this, reply] { onReplyFinished( reply ); } );
+  }
+
+  if ( progressed )
+    emit progressChanged();
+
+  if ( mReplies.isEmpty() && mQueue.isEmpty() )
+    finish( mFailedCount == 0 );
+}
+
+void OfflinePackDownloader::onReplyFinished( QNetworkReply *reply )
+{
+  mReplies.remove( reply );
+  reply->deleteLater();
+
+  const QByteArray data = reply->readAll();
+  if ( reply->error() == QNetworkReply::NoError && !data.isEmpty()
+       && mTileStore && mTileStore->insertTile( reply->request().url(), data, reply->header( QNetworkRequest::ContentTypeHeader ).toString(), mName ) )
+    mCompletedCount++;
+  else
+    mFailedCount++;
+
+  emit progressChanged();
+
+  if ( !mTileStore )
+  {
+    cancel();
+    return;
+  }
+
+  downloadNext();
+}
+
+void OfflinePackDownloader::finish( bool success )
+{
+  mRunning = false;
+  emit runningChanged();
+  emit finished( success );
+}
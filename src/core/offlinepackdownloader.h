@@ -0,0 +1,177 @@
+/***************************************************************************
+  offlinepackdownloader.h - OfflinePackDownloader
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef OFFLINEPACKDOWNLOADER_H
+#define OFFLINEPACKDOWNLOADER_H
+
+#include "qfield_core_export.h"
+#include "tilestore.h"
+
+#include <QList>
+#include <QObject>
+#include <QPointer>
+#include <QSet>
+#include <QUrl>
+#include <qgsrectangle.h>
+
+class QNetworkReply;
+class QgsCoordinateReferenceSystem;
+class QgsProject;
+
+/**
+ * \brief Pre-seeds a TileStore with the XYZ tiles covering an extent over a zoom range.
+ *
+ * Tiles are downloaded in the background with a bounded number of concurrent requests
+ * and pinned to a named offline pack, so the area renders from local storage while
+ * fieldwork happens without network coverage.
+ * \ingroup core
+ */
+class QFIELD_CORE_EXPORT OfflinePackDownloader : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY( TileStore *tileStore READ tileStore WRITE setTileStore NOTIFY tileStoreChanged )
+    Q_PROPERTY( QString name READ name WRITE setName NOTIFY nameChanged )
+    Q_PROPERTY( QStringList urlTemplates READ urlTemplates WRITE setUrlTemplates NOTIFY urlTemplatesChanged )
+    Q_PROPERTY( QStringList skippedSources READ skippedSources NOTIFY skippedSourcesChanged )
+    Q_PROPERTY( int minimumZoom READ minimumZoom WRITE setMinimumZoom NOTIFY minimumZoomChanged )
+    Q_PROPERTY( int maximumZoom READ maximumZoom WRITE setMaximumZoom NOTIFY maximumZoomChanged )
+    Q_PROPERTY( int tileCount READ tileCount NOTIFY tileCountChanged )
+    Q_PROPERTY( int completedCount READ completedCount NOTIFY progressChanged )
+    Q_PROPERTY( int failedCount READ failedCount NOTIFY progressChanged )
+    Q_PROPERTY( double progress READ progress NOTIFY progressChanged )
+    Q_PROPERTY( bool running READ running NOTIFY runningChanged )
+
+  public:
+    //! Maximum number of tiles a single pack can hold
+    static constexpr int MaximumTileCount = 100000;
+
+    explicit OfflinePackDownloader( QObject *parent = nullptr );
+    ~OfflinePackDownloader() override;
+
+    TileStore *tileStore() const { return mTileStore; }
+    void setTileStore( TileStore *tileStore );
+
+    //! Returns the name of the offline pack the tiles are pinned to
+    QString name() const { return mName; }
+    void setName( const QString &name );
+
+    /**
+     * Returns the XYZ URL templates downloaded, supporting the {x}, {y}, {-y} and {z} placeholders.
+     * Templates set directly are downloaded as is, whether their provider permits it or not.
+     */
+    QStringList urlTemplates() const { return mUrlTemplates; }
+    void setUrlTemplates( const QStringList &urlTemplates );
+
+    int minimumZoom() const { return mMinimumZoom; }
+    void setMinimumZoom( int minimumZoom );
+
+    int maximumZoom() const { return mMaximumZoom; }
+    void setMaximumZoom( int maximumZoom );
+
+    //! Sets the \a extent, expressed in \a crs, covered by the pack
+    Q_INVOKABLE void setExtent( const QgsRectangle &extent, const QgsCoordinateReferenceSystem &crs );
+
+    //! Returns the extent covered by the pack in WGS 84
+    QgsRectangle extent() const { return mExtent; }
+
+    /**
+     * Collects the URL templates of the visible XYZ raster and vector tile layers of \a project.
+     * Zoom levels beyond those served by a layer are skipped for that layer, layers whose
+     * provider does not permit bulk downloads are skipped altogether.
+     * \see skippedSources()
+     */
+    Q_INVOKABLE void setSourcesFromProject( QgsProject *project );
+
+    //! Returns the names of the layers left out by setSourcesFromProject() as their provider does not permit bulk downloads
+    QStringList skippedSources() const { return mSkippedSources; }
+
+    //! Returns the number of tiles of the pack, or -1 if it exceeds MaximumTileCount
+    int tileCount() const;
+
+    int completedCount() const { return mCompletedCount; }
+    int failedCount() const { return mFailedCount; }
+    double progress() const;
+    bool running() const { return mRunning; }
+
+    /**
+     * Starts downloading the pack tiles not yet present in the store.
+     * \returns FALSE if the pack is invalid or too large
+     */
+    Q_INVOKABLE bool start();
+
+    //! Stops downloading, tiles stored so far remain in the pack
+    Q_INVOKABLE void cancel();
+
+    /**
+     * Returns the URLs of the tiles covering the WGS 84 \a extent from \a minimumZoom to
+     * \a maximumZoom for an XYZ \a urlTemplate.
+     */
+    static QList<QUrl> tileUrls( const QString &urlTemplate, const QgsRectangle &extent, int minimumZoom, int maximumZoom );
+
+    //! Returns the number of tiles covering the WGS 84 \a extent from \a minimumZoom to \a maximumZoom
+    static qint64 countTiles( const QgsRectangle &extent, int minimumZoom, int maximumZoom );
+
+    /**
+     * Returns TRUE if the provider serving an XYZ \a urlTemplate permits bulk downloads.
+     * Public tile servers such as OpenStreetMap's or Google's forbid prefetching areas,
+     * only the hosts of the Spanish public administrations serving SIGPAC data are allowed.
+     */
+    static bool isBulkDownloadAllowed( const QString &urlTemplate );
+
+  signals:
+    void tileStoreChanged();
+    void nameChanged();
+    void urlTemplatesChanged();
+    void skippedSourcesChanged();
+    void minimumZoomChanged();
+    void maximumZoomChanged();
+    void tileCountChanged();
+    void progressChanged();
+    void runningChanged();
+
+    //! Emitted once the download is over, \a success is FALSE if canceled or some tiles failed
+    void finished( bool success );
+
+  private:
+    struct Source
+    {
+        QString urlTemplate;
+        int minimumZoom = 0;
+        int maximumZoom = 22;
+    };
+
+    void downloadNext();
+    void onReplyFinished( QNetworkReply *reply );
+    void finish( bool success );
+
+    QPointer<TileStore> mTileStore;
+    QString mName;
+    QStringList mUrlTemplates;
+    QStringList mSkippedSources;
+    QList<Source> mSources;
+    QgsRectangle mExtent;
+    int mMinimumZoom = 0;
+    int mMaximumZoom = 16;
+
+    QList<QUrl> mQueue;
+    QSet<QNetworkReply *> mReplies;
+    int mTotalCount = 0;
+    int mCompletedCount = 0;
+    int mFailedCount = 0;
+    bool mRunning = false;
+};
+
+#endif // OFFLINEPACKDOWNLOADER_H
@@ -0,0 +1,377 @@
+/***************************************************************************
+  photopipeline.cpp - PhotoPipeline
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "gnsspositioninformation.h"
+#include "photopipeline.h"
+
+#include <QBuffer>
+#include <QFileInfo>
+#include <QFontMetrics>
+#include <QImageReader>
+#include <QPainter>
+#include <QSaveFile>
+#include <qgsmessagelog.h>
+
+#include <cmath>
+#include <exiv2/exiv2.hpp>
+
+QString PhotoPipeline::exifValueString( const QString &key, const QVariant &value )
+{
+  Exiv2::TypeId typeId = Exiv2::invalidTypeId;
+  try
+  {
+    typeId = Exiv2::ExifKey( key.toStdString() ).defaultTypeId();
+  }
+  catch ( const std::exception & )
+  {
+    return value.toString();
+  }
+
+  switch ( value.userType() )
+  {
+    case QMetaType::Double:
+    case QMetaType::Float:
+    {
+      const double number = value.toDouble();
+      if ( typeId != Exiv2::unsignedRational && typeId != Exiv2::signedRational )
+        return QString::number( number, 'f', 6 );
+
+      if ( key.endsWith( QLatin1String( "GPSLatitude" ) ) || key.endsWith( QLatin1String( "GPSLongitude" ) ) )
+      {
+        // Coordinates are stored as degrees, minutes and seconds
+        const double absolute = std::abs( number );
+        const double degrees = std::floor( absolute );
+        const double minutes = std::floor( ( absolute - degrees ) * 60 );
+        const double seconds = ( ( absolute - degrees ) * 60 - minutes ) * 60;
+        return QStringLiteral( "%1/1 %2/1 %3/1000" ).arg( static_cast<qint64>( degrees ) ).arg( static_cast<qint64>( minutes ) ).arg( std::llround( seconds * 1000 ) );
+      }
+      return QStringLiteral( "%1/1000" ).arg( std::llround( number * 1000 ) );
+    }
+
+    case QMetaType::QDate:
+      return value.toDate().toString( QStringLiteral( "yyyy:MM:dd" ) );
+
+    case QMetaType::QTime:
+    {
+      const QTime time = value.toTime();
+      return QStringLiteral( "%1/1 %2/1 %3/1" ).arg( time.hour() ).arg( time.minute() ).arg( time.second() );
+    }
+
+    case QMetaType::QDateTime:
+      return value.toDateTime().toString( QStringLiteral( "yyyy:MM:dd hh:mm:ss" ) );
+
+    default:
+      break;
+  }
+
+  return value.toString();
+}
+
+static void applyTags( Exiv2::Image &image, const QVariantMap &tags )
+{
+  Exiv2::ExifData &exifData = image.exifData();
+  Exiv2::XmpData &xmpData = image.xmpData();
+  for ( auto it = tags.constBegin(); it != tags.constEnd(); ++it )
+  {
+    if ( it.key().startsWith( QLatin1String( "Xmp." ) ) )
+    {
+      xmpData[it.key().toStdString()] = it.value().toString().toStdString();
+      continue;
+    }
+
+    const Exiv2::ExifKey key( it.key().toStdString() );
+    auto value = Exiv2::Value::create( key.defaultTypeId() );
+    value->read( PhotoPipeline::exifValueString( it.key(), it.value() ).toStdString() );
+
+    auto existing = exifData.findKey( key );
+    if ( existing != exifData.end() )
+      exifData.erase( existing );
+    exifData.add( key, value.get() );
+  }
+}
+
+static void updatePixelDimensions( Exiv2::ExifData &exifData, const QSize &size )
+{
+  const QList<QPair<const char *, int>> dimensions = {
+    qMakePair( "Exif.Photo.PixelXDimension", size.width() ),
+    qMakePair( "Exif.Photo.PixelYDimension", size.height() ),
+  };
+  for ( const auto &dimension : dimensions )
+  {
+    auto it = exifData.findKey( Exiv2::ExifKey( dimension.first ) );
+    if ( it != exifData.end() )
+      it->setValue( std::to_string( dimension.second ) );
+  }
+}
+
+PhotoPipeline::PhotoPipeline( QObject *parent )
+  : QObject( parent )
+{
+  // Photos are processed one at a time, decoded camera photos are large
+  mThreadPool.setMaxThreadCount( 1 );
+}
+
+PhotoPipeline::~PhotoPipeline()
+{
+  mThreadPool.waitForDone();
+}
+
+bool PhotoPipeline::process( const QString &imagePath, const QVariantMap &operations )
+{
+  if ( mPendingCount >= MaximumPendingCount )
+    return false;
+
+  mPendingCount++;
+  emit pendingCountChanged();
+
+  mThreadPool.start( [this, imagePath, operations] {
+    const bool success = processNow( imagePath, operations );
+    QMetaObject::invokeMethod(
+      this, [this, imagePath, success] {
+        mPendingCount--;
+        emit pendingCountChanged();
+        emit processed( imagePath, success );
+      },
+      Qt::QueuedConnection );
+  } );
+  return true;
+}
+
+bool PhotoPipeline::processNow( const QString &imagePath, const QVariantMap &operations )
+{
+  if ( !QFileInfo::exists( imagePath ) )
+    return false;
+
+  const int maximumWidthHeight = operations.value( QStringLiteral( "maximumWidthHeight" ) ).toInt();
+  const QString stampText = operations.value( QStringLiteral( "stampText" ) ).toString();
+  QVariantMap tags = operations.value( QStringLiteral( "tags" ) ).toMap();
+  const QVariant positionInformation = operations.value( QStringLiteral( "positionInformation" ) );
+  if ( positionInformation.canConvert<GnssPositionInformation>() )
+    tags.insert( positionTags( positionInformation.value<GnssPositionInformation>() ) );
+
+  // The header tells whether the photo needs to be resized, sparing a decode otherwise
+  QImageReader reader( imagePath );
+  const QByteArray format = reader.format();
+  const QSize size = reader.size();
+  const bool resize = maximumWidthHeight > 0 && ( !size.isValid() || size.width() > maximumWidthHeight || size.height() > maximumWidthHeight );
+  const bool stamp = !stampText.isEmpty();
+  if ( !resize && !stamp && tags.isEmpty() )
+    return true;
+
+  if ( !resize && !stamp )
+  {
+    // Only the metadata changes, it is rewritten in place once
+    try
+    {
+      auto image = Exiv2::ImageFactory::open( imagePath.toStdString() );
+      image->readMetadata();
+      applyTags( *image, tags );
+      image->writeMetadata();
+      return true;
+    }
+    catch ( const std::exception &e )
+    {
+      QgsMessageLog::logMessage( tr( "Could not write metadata of photo %1: %2" ).arg( imagePath, QString::fromStdString( e.what() ) ), QStringLiteral( "SIGPACGO" ), Qgis::Warning );
+      return false;
+    }
+  }
+
+  QImage image( imagePath );
+  if ( image.isNull() )
+  {
+    QgsMessageLog::logMessage( tr( "Could not read photo %1" ).arg( imagePath ), QStringLiteral( "SIGPACGO" ), Qgis::Warning );
+    return false;
+  }
+
+  if ( maximumWidthHeight > 0 && ( image.width() > maximumWidthHeight || image.height() > maximumWidthHeight ) )
+  {
+    image = image.width() > image.height()
+              ? image.scaledToWidth( maximumWidthHeight, Qt::SmoothTransformation )
+              : image.scaledToHeight( maximumWidthHeight, Qt::SmoothTransformation );
+  }
+
+  if ( stamp )
+    drawStamp( image, stampText, operations.value( QStringLiteral( "stampStyling" ) ).toMap() );
+
+  QByteArray data;
+  QBuffer buffer( &data );
+  buffer.open( QIODevice::WriteOnly );
+  if ( !image.save( &buffer, format.isEmpty() ? nullptr : format.constData(), 90 ) )
+  {
+    QgsMessageLog::logMessage( tr( "Could not encode photo %1" ).arg( imagePath ), QStringLiteral( "SIGPACGO" ), Qgis::Warning );
+    return false;
+  }
+  buffer.close();
+
+  // The original metadata and the new tags are written to the encoded photo in memory
+  try
+  {
+    auto source = Exiv2::ImageFactory::open( imagePath.toStdString() );
+    source->readMetadata();
+
+    auto target = Exiv2::ImageFactory::open( reinterpret_cast<const Exiv2::byte *>( data.constData() ), data.size() );
+    target->setExifData( source->exifData() );
+    target->setXmpData( source->xmpData() );
+    target->setIptcData( source->iptcData() );
+    Exiv2::ExifThumb( target->exifData() ).erase();
+    updatePixelDimensions( target->exifData(), image.size() );
+    applyTags( *target, tags );
+    target->writeMetadata();
+
+    Exiv2::BasicIo &io = target->io();
+    io.seek( 0, Exiv2::BasicIo::beg );
+    QByteArray tagged( static_cast<qsizetype>( io.size() ), Qt::Uninitialized );
+    if ( static_cast<qsizetype>( io.read( reinterpret_cast<Exiv2::byte *>( tagged.data() ), tagged.size() ) ) == tagged.size() )
+      data = tagged;
+  }
+  catch ( const std::exception &e )
+  {
+    QgsMessageLog::logMessage( tr( "Could not carry metadata over to photo %1: %2" ).arg( imagePath, QString::fromStdString( e.what() ) ), QStringLiteral( "SIGPACGO" ), Qgis::Warning );
+  }
+
+  QSaveFile file( imagePath );
+  if ( !file.open( QIODevice::WriteOnly ) || file.write( data ) != data.size() || !file.commit() )
+  {
+    QgsMessageLog::logMessage( tr( "Could not write photo %1" ).arg( imagePath ), QStringLiteral( "SIGPACGO" ), Qgis::Warning );
+    return false;
+  }
+
+  return true;
+}
+
+QVariantMap PhotoPipeline::positionTags( const GnssPositionInformation &positionInformation )
+{
+  QVariantMap tags;
+  if ( positionInformation.latitudeValid() && positionInformation.longitudeValid() )
+  {
+    tags["Exif.GPSInfo.GPSVersionID"] = QStringLiteral( "2 2 0 0" );
+    tags["Exif.GPSInfo.GPSLatitude"] = std::abs( positionInformation.latitude() );
+    tags["Exif.GPSInfo.GPSLatitudeRef"] = positionInformation.latitude() >= 0 ? "N" : "S";
+    tags["Exif.GPSInfo.GPSLongitude"] = std::abs( positionInformation.longitude() );
+    tags["Exif.GPSInfo.GPSLongitudeRef"] = positionInformation.longitude() >= 0 ? "E" : "W";
+    if ( positionInformation.elevationValid() )
+    {
+      tags["Exif.GPSInfo.GPSAltitude"] = std::abs( positionInformation.elevation() );
+      // 0 stands for above sea level, 1 for below
+      tags["Exif.GPSInfo.GPSAltitudeRef"] = positionInformation.elevation() >= 0 ? "0" : "1";
+    }
+  }
+  if ( positionInformation.orientationValid() )
+  {
+    tags["Exif.GPSInfo.GPSImgDirection"] = positionInformation.orientation();
+    tags["Exif.GPSInfo.GPSImgDirectionRef"] = "M";
+  }
+  if ( positionInformation.speedValid() )
+  {
+    tags["Exif.GPSInfo.GPSSpeed"] = positionInformation.speed();
+    tags["Exif.GPSInfo.GPSSpeedRef"] = "K";
+  }
+
+  if ( positionInformation.utcDateTime().isValid() )
+  {
+    tags["Exif.GPSInfo.GPSDateStamp"] = positionInformation.utcDateTime().date();
+    tags["Exif.GPSInfo.GPSTimeStamp"] = positionInformation.utcDateTime().time();
+  }
+
+  tags["Exif.GPSInfo.GPSSatellites"] = QString::number( positionInformation.satellitesUsed() ).rightJustified( 2, '0' );
+
+  tags["Exif.Image.Make"] = QStringLiteral( "SIGPACGO" );
+  tags["Xmp.tiff.Make"] = QStringLiteral( "SIGPACGO" );
+
+  return tags;
+}
+
+void PhotoPipeline::drawStamp( QImage &image, const QString &text, const QVariantMap &styling )
+{
+  if ( image.isNull() || text.isEmpty() )
+    return;
+
+  QPainter painter( &image );
+  painter.setRenderHint( QPainter::Antialiasing );
+
+  const QStringList lines = text.split( QStringLiteral( "\n" ) );
+
+  // Get styling parameters with defaults if not provided
+  const int baseFontSize = styling.value( QStringLiteral( "fontSize" ), std::min( image.width(), image.height() ) / 40 ).toInt();
+  const QColor textColor( styling.value( QStringLiteral( "color" ), QStringLiteral( "#FFFFFF" ) ).toString() );
+  const QColor backgroundColor( styling.value( QStringLiteral( "backgroundColor" ), QStringLiteral( "#80000000" ) ).toString() );
+  const QColor accentColor( styling.value( QStringLiteral( "accentColor" ), QStringLiteral( "#0078D7" ) ).toString() );
+  const int padding = styling.value( QStringLiteral( "padding" ), 10 ).toInt();
+  const QString position = styling.value( QStringLiteral( "position" ), QStringLiteral( "bottomLeft" ) ).toString().toLower();
+  const bool shadow = styling.value( QStringLiteral( "shadow" ), true ).toBool();
+
+  // The first and last lines (date and SIGPACGO line) use a larger title font
+  QFont titleFont = painter.font();
+  titleFont.setPixelSize( baseFontSize * 1.2 );
+  titleFont.setBold( true );
+
+  QFont regularFont = painter.font();
+  regularFont.setPixelSize( baseFontSize );
+  regularFont.setBold( true );
+
+  const QFontMetrics titleMetrics( titleFont );
+  const QFontMetrics regularMetrics( regularFont );
+  auto isTitle = [&lines]( int i ) { return i == 0 || i == lines.size() - 1; };
+
+  int textWidth = 0;
+  int textHeight = 0;
+  for ( int i = 0; i < lines.size(); ++i )
+  {
+    const QFontMetrics &metrics = isTitle( i ) ? titleMetrics : regularMetrics;
+    textWidth = std::max( textWidth, metrics.horizontalAdvance( lines[i] ) );
+    textHeight += metrics.height();
+  }
+  textWidth += padding * 2;
+  textHeight += padding * 2;
+
+  int rectX = padding;
+  int rectY = image.height() - textHeight - padding;
+  if ( position == QLatin1String( "bottomright" ) )
+  {
+    rectX = image.width() - textWidth - padding;
+  }
+  else if ( position == QLatin1String( "topleft" ) )
+  {
+    rectY = padding;
+  }
+  else if ( position == QLatin1String( "topright" ) )
+  {
+    rectX = image.width() - textWidth - padding;
+    rectY = padding;
+  }
+
+  // Semi-transparent background with an accent bar on the left
+  painter.setBrush( backgroundColor );
+  painter.setPen( Qt::NoPen );
+  painter.drawRoundedRect( rectX, rectY, textWidth, textHeight, 10, 10 );
+  painter.setBrush( accentColor );
+  painter.drawRoundedRect( rectX, rectY, 6, textHeight, 3, 3 );
+
+  int currentY = rectY + padding;
+  for ( int i = 0; i < lines.size(); ++i )
+  {
+    painter.setFont( isTitle( i ) ? titleFont : regularFont );
+    if ( shadow )
+    {
+      painter.setPen( QColor( 0, 0, 0, 120 ) );
+      painter.drawText( rectX + padding + 1, currentY + 1, lines[i] );
+    }
+
+    painter.setPen( i == lines.size() - 1 ? accentColor : textColor );
+    painter.drawText( rectX + padding, currentY, lines[i] );
+
+    currentY += isTitle( i ) ? titleMetrics.height() : regularMetrics.height();
+  }
+}
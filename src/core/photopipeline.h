@@ -0,0 +1,101 @@
+/***************************************************************************
+  photopipeline.h - PhotoPipeline
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef PHOTOPIPELINE_H
+#define PHOTOPIPELINE_H
+
+#include "qfield_core_export.h"
+
+#include <QImage>
+#include <QObject>
+#include <QThreadPool>
+#include <QVariantMap>
+
+class GnssPositionInformation;
+
+/**
+ * \brief Post-processes captured photos in a single pass.
+ *
+ * A photo is decoded at most once, resized and stamped in memory, encoded at most once,
+ * and its metadata, the original one merged with new EXIF and XMP tags, is written in
+ * the same pass before the file is replaced. The operations applied are described by a
+ * map with the following optional keys:
+ *
+ * - maximumWidthHeight: the maximum width and height of the photo
+ * - stampText: the text stamped onto the photo
+ * - stampStyling: the styling of the stamp, see drawStamp()
+ * - positionInformation: a GnssPositionInformation the photo is geotagged with
+ * - tags: EXIF and XMP tags written to the photo, by key
+ *
+ * Photos are processed one at a time on a worker thread, with a bounded number of
+ * pending photos so that memory use stays in check while shooting in a row.
+ * \ingroup core
+ */
+class QFIELD_CORE_EXPORT PhotoPipeline : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY( int pendingCount READ pendingCount NOTIFY pendingCountChanged )
+
+  public:
+    //! Maximum number of photos waiting to be or being processed
+    static constexpr int MaximumPendingCount = 8;
+
+    explicit PhotoPipeline( QObject *parent = nullptr );
+    ~PhotoPipeline() override;
+
+    //! Returns the number of photos waiting to be or being processed
+    int pendingCount() const { return mPendingCount; }
+
+    /**
+     * Queues the photo at \a imagePath for processing with a given set of \a operations.
+     * \returns FALSE if too many photos are pending, in which case nothing is queued
+     */
+    Q_INVOKABLE bool process( const QString &imagePath, const QVariantMap &operations );
+
+    /**
+     * Processes the photo at \a imagePath with a given set of \a operations on the calling thread.
+     * \returns TRUE on success
+     */
+    Q_INVOKABLE static bool processNow( const QString &imagePath, const QVariantMap &operations );
+
+    //! Returns the EXIF and XMP tags describing a \a positionInformation
+    static QVariantMap positionTags( const GnssPositionInformation &positionInformation );
+
+    /**
+     * Returns the textual representation of a tag \a value, as read by the EXIF value type of the tag \a key.
+     * Rational coordinates are written as degrees, minutes and seconds.
+     */
+    static QString exifValueString( const QString &key, const QVariant &value );
+
+    /**
+     * Draws a \a text stamp onto an \a image. The \a styling map supports the fontSize, color,
+     * backgroundColor, accentColor, padding, position (bottomLeft, bottomRight, topLeft or
+     * topRight) and shadow keys.
+     */
+    static void drawStamp( QImage &image, const QString &text, const QVariantMap &styling = QVariantMap() );
+
+  signals:
+    void pendingCountChanged();
+
+    //! Emitted once the photo at \a imagePath has been processed
+    void processed( const QString &imagePath, bool success );
+
+  private:
+    QThreadPool mThreadPool;
+    int mPendingCount = 0;
+};
+
+#endif // PHOTOPIPELINE_H
@@ -0,0 +1,240 @@
+/***************************************************************************
+  egenioussframeparser.cpp - EgenioussFrameParser
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "egenioussframeparser.h"
+
+#include <QtEndian>
+
+#include <algorithm>
+#include <cstring>
+
+char *EgenioussFrameParser::prepareWrite( qsizetype size )
+{
+  if ( mReadOffset == mWriteOffset )
+  {
+    mReadOffset = 0;
+    mWriteOffset = 0;
+  }
+
+  if ( mBuffer.size() - mWriteOffset < size )
+  {
+    // Only the tail of a partial frame is left ahead of the read offset, moving it is cheap
+    if ( mReadOffset > 0 )
+    {
+      std::memmove( mBuffer.data(), mBuffer.constData() + mReadOffset, mWriteOffset - mReadOffset );
+      mWriteOffset -= mReadOffset;
+      mReadOffset = 0;
+    }
+
+    if ( mBuffer.size() - mWriteOffset < size )
+      mBuffer.resize( std::max( mWriteOffset + size, mBuffer.size() * 2 ) );
+  }
+
+  return mBuffer.data() + mWriteOffset;
+}
+
+void EgenioussFrameParser::commitWrite( qsizetype size )
+{
+  Q_ASSERT( mWriteOffset + size <= mBuffer.size() );
+  mWriteOffset += size;
+}
+
+void EgenioussFrameParser::append( QByteArrayView data )
+{
+  std::memcpy( prepareWrite( data.size() ), data.data(), data.size() );
+  commitWrite( data.size() );
+}
+
+bool EgenioussFrameParser::nextPayload( QByteArrayView &payload )
+{
+  while ( mReadOffset < mWriteOffset )
+  {
+    const char *data = mBuffer.constData() + mReadOffset;
+    const qsizetype available = mWriteOffset - mReadOffset;
+
+    if ( static_cast<quint8>( data[0] ) != StartByte )
+    {
+      const char *start = static_cast<const char *>( std::memchr( data, StartByte, available ) );
+      const qsizetype skipped = start ? start - data : available;
+      mReadOffset += skipped;
+      mDiscardedBytes += skipped;
+      continue;
+    }
+
+    if ( available < HeaderSize )
+      return false;
+
+    const quint32 payloadLength = qFromLittleEndian<quint32>( data + 4 );
+    if ( payloadLength == 0 || payloadLength > MaximumPayloadSize )
+    {
+      // Not an actual frame, look for the next start byte
+      mReadOffset++;
+      mDiscardedBytes++;
+      continue;
+    }
+
+    if ( available < HeaderSize + payloadLength )
+      return false;
+
+    payload = QByteArrayView( data + HeaderSize, payloadLength );
+    mReadOffset += HeaderSize + payloadLength;
+    return true;
+  }
+
+  return false;
+}
+
+void EgenioussFrameParser::clear()
+{
+  mReadOffset = 0;
+  mWriteOffset = 0;
+}
+
+namespace
+{
+  const char *skipWhitespace( const char *it, const char *end )
+  {
+    while ( it != end && ( *it == ' ' || *it == '\t' || *it == '\n' || *it == '\r' ) )
+      ++it;
+    return it;
+  }
+
+  //! Returns the position following the string starting at \a it, nullptr if it isn't terminated
+  const char *skipString( const char *it, const char *end )
+  {
+    for ( ++it; it != end; ++it )
+    {
+      if ( *it == '\\' )
+      {
+        if ( ++it == end )
+          return nullptr;
+      }
+      else if ( *it == '"' )
+      {
+        return it + 1;
+      }
+    }
+    return nullptr;
+  }
+
+  //! Returns the position following the value starting at \a it, nullptr if it isn't well-formed
+  const char *skipValue( const char *it, const char *end )
+  {
+    if ( it == end )
+      return nullptr;
+
+    if ( *it == '"' )
+      return skipString( it, end );
+
+    if ( *it == '{' || *it == '[' )
+    {
+      int depth = 0;
+      while ( it != end )
+      {
+        switch ( *it )
+        {
+          case '"':
+            it = skipString( it, end );
+            if ( !it )
+              return nullptr;
+            continue;
+          case '{':
+          case '[':
+            depth++;
+            break;
+          case '}':
+          case ']':
+            if ( --depth == 0 )
+              return it + 1;
+            break;
+          default:
+            break;
+        }
+        ++it;
+      }
+      return nullptr;
+    }
+
+    // Numbers and literals
+    const char *begin = it;
+    while ( it != end && *it != ',' && *it != '}' && *it != ']' && *it != ' ' && *it != '\t' && *it != '\n' && *it != '\r' )
+      ++it;
+    return it != begin ? it : nullptr;
+  }
+} // namespace
+
+bool EgenioussFrameParser::parseFix( QByteArrayView payload, Fix &fix )
+{
+  const char *it = payload.data();
+  const char *end = it + payload.size();
+
+  it = skipWhitespace( it, end );
+  if ( it == end || *it != '{' )
+    return false;
+
+  it = skipWhitespace( it + 1, end );
+  if ( it != end && *it == '}' )
+    return skipWhitespace( it + 1, end ) == end;
+
+  while ( true )
+  {
+    if ( it == end || *it != '"' )
+      return false;
+
+    const char *keyBegin = it + 1;
+    it = skipString( it, end );
+    if ( !it )
+      return false;
+    const QByteArrayView key( keyBegin, it - 1 - keyBegin );
+
+    it = skipWhitespace( it, end );
+    if ( it == end || *it != ':' )
+      return false;
+
+    const char *valueBegin = skipWhitespace( it + 1, end );
+    it = skipValue( valueBegin, end );
+    if ( !it )
+      return false;
+
+    double *field = nullptr;
+    if ( key == "lat" )
+      field = &fix.latitude;
+    else if ( key == "lon" )
+      field = &fix.longitude;
+    else if ( key == "alt" )
+      field = &fix.altitude;
+    else if ( key == "utc" )
+      field = &fix.utc;
+    else if ( key == "q" )
+      field = &fix.quality;
+
+    if ( field )
+    {
+      // Like QJsonValue::toDouble(), values which aren't numbers read as 0
+      bool ok = false;
+      const double value = QByteArrayView( valueBegin, it - valueBegin ).toDouble( &ok );
+      *field = ok ? value : 0;
+    }
+
+    it = skipWhitespace( it, end );
+    if ( it == end )
+      return false;
+    if ( *it == '}' )
+      return skipWhitespace( it + 1, end ) == end;
+    if ( *it != ',' )
+      return false;
+    it = skipWhitespace( it + 1, end );
+  }
+}
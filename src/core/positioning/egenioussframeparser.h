@@ -0,0 +1,98 @@
+/***************************************************************************
+  egenioussframeparser.h - EgenioussFrameParser
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef EGENIOUSSFRAMEPARSER_H
+#define EGENIOUSSFRAMEPARSER_H
+
+#include "qfield_core_export.h"
+
+#include <QByteArray>
+#include <QByteArrayView>
+
+/**
+ * \brief Reassembles the frames streamed by the eGeniouss service and decodes their payload.
+ *
+ * Frames start with a 0xFE byte, carry the length of their JSON payload as a little endian
+ * 32 bit integer at offset 4 and their payload from offset 8. Data is written as it arrives,
+ * frames straddling several reads being completed by the following ones. Bytes which can't
+ * be the start of a frame are discarded up to the next start byte.
+ *
+ * Payloads are handed out as views into the reassembly buffer, which is only compacted when
+ * its free space runs out, so that complete frames are never copied.
+ * \ingroup core
+ */
+class QFIELD_CORE_EXPORT EgenioussFrameParser
+{
+  public:
+    //! Position fields of a payload, missing fields being left to 0
+    struct Fix
+    {
+        double latitude = 0;
+        double longitude = 0;
+        double altitude = 0;
+        //! Nanoseconds since epoch
+        double utc = 0;
+        double quality = 0;
+    };
+
+    static constexpr quint8 StartByte = 0xFE;
+    static constexpr qsizetype HeaderSize = 8;
+    //! Frames announcing a larger payload are considered corrupted
+    static constexpr quint32 MaximumPayloadSize = 64 * 1024;
+
+    /**
+     * Returns a pointer to at least \a size bytes of free space at the end of the buffer, to be
+     * followed by commitWrite() with the number of bytes actually written.
+     * \note invalidates the payloads returned by nextPayload()
+     */
+    char *prepareWrite( qsizetype size );
+
+    //! Appends the \a size bytes written after prepareWrite() to the buffered data
+    void commitWrite( qsizetype size );
+
+    //! Appends \a data to the buffered data
+    void append( QByteArrayView data );
+
+    /**
+     * Extracts the next complete frame from the buffered data into \a payload, discarding any invalid
+     * data preceding it. The payload remains valid until the next write.
+     * \returns FALSE if no complete frame is buffered
+     */
+    bool nextPayload( QByteArrayView &payload );
+
+    //! Returns the number of buffered bytes which were not extracted yet
+    qsizetype bufferedSize() const { return mWriteOffset - mReadOffset; }
+
+    //! Returns the total number of bytes discarded while looking for the start of a frame
+    quint64 discardedBytes() const { return mDiscardedBytes; }
+
+    //! Discards the buffered data
+    void clear();
+
+    /**
+     * Extracts the position fields of a JSON \a payload into \a fix in a single pass, without building
+     * a document. Payloads are expected to hold a flat object, values of other fields are skipped over.
+     * \returns FALSE if the payload isn't a well-formed JSON object
+     */
+    static bool parseFix( QByteArrayView payload, Fix &fix );
+
+  private:
+    QByteArray mBuffer;
+    qsizetype mReadOffset = 0;
+    qsizetype mWriteOffset = 0;
+    quint64 mDiscardedBytes = 0;
+};
+
+#endif // EGENIOUSSFRAMEPARSER_H
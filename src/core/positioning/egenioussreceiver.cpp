@@ -17,10 +17,10 @@
 #include "egenioussreceiver.h"
 
 #include <QHostAddress>
-#include <QJsonDocument>
-#include <QJsonValue>
 #include <QTimeZone>
 
+#include <algorithm>
+
 QLatin1String EgenioussReceiver::identifier = QLatin1String( "egeniouss" );
 
 EgenioussReceiver::EgenioussReceiver( QObject *parent )
@@ -41,6 +41,7 @@ EgenioussReceiver::~EgenioussReceiver()
 
 void EgenioussReceiver::handleConnectDevice()
 {
+  mParser.clear();
   mTcpSocket->connectToHost( mAddress, mPort, QTcpSocket::ReadWrite );
 }
 
@@ -53,56 +54,66 @@ GnssPositionDetails EgenioussReceiver::details() const
 {
   GnssPositionDetails detailsList;
 
-  if ( mPayload.isEmpty() )
+  if ( !mHasFix )
   {
     return detailsList;
   }
 
-  detailsList.append( "q", mPayload.value( "q" ).toDouble() );
+  detailsList.append( "q", mFix.quality );
 
   return detailsList;
 }
 
 void EgenioussReceiver::onReadyRead()
 {
-  const int minimumDataSize = 9;
-  const uint8_t validStartByte = 0xFE;
-  const int payloadHeaderSize = 8;
+  const quint64 discardedBytes = mParser.discardedBytes();
+  bool parseFailed = false;
 
-  QByteArray mReceivedData = mTcpSocket->readAll();
-  if ( mReceivedData.size() < minimumDataSize )
+  // Read straight into the parser's buffer, extracting frames every chunk to keep it small
+  while ( mTcpSocket->bytesAvailable() > 0 )
   {
-    mLastError = tr( "Received data is too short to process" );
-    emit lastErrorChanged( mLastError );
-    return;
+    const qint64 size = std::min( mTcpSocket->bytesAvailable(), ReadChunkSize );
+    const qint64 read = mTcpSocket->read( mParser.prepareWrite( size ), size );
+    if ( read <= 0 )
+    {
+      break;
+    }
+    mParser.commitWrite( read );
+
+    QByteArrayView payload;
+    while ( mParser.nextPayload( payload ) )
+    {
+      EgenioussFrameParser::Fix fix;
+      if ( !EgenioussFrameParser::parseFix( payload, fix ) )
+      {
+        parseFailed = true;
+        continue;
+      }
+      processFix( fix );
+    }
   }
-  if ( static_cast<uint8_t>( mReceivedData[0] ) != validStartByte )
+
+  // Partial frames are simply waiting for the rest of their data
+  if ( mParser.discardedBytes() != discardedBytes )
   {
     mLastError = tr( "Invalid start byte" );
     emit lastErrorChanged( mLastError );
-    return;
   }
-  uint32_t payloadLength;
-  QDataStream dataStream( mReceivedData.mid( 4, 4 ) );
-  dataStream.setByteOrder( QDataStream::LittleEndian );
-  dataStream >> payloadLength;
-  if ( mReceivedData.size() < payloadHeaderSize + payloadLength )
-  {
-    mLastError = tr( "Received data is too short to contain the payload" );
-    emit lastErrorChanged( mLastError );
-    return;
-  }
-  QJsonDocument jsonDoc = QJsonDocument::fromJson( mReceivedData.mid( payloadHeaderSize, payloadLength ) );
-  if ( jsonDoc.isNull() || !jsonDoc.isObject() )
+  if ( parseFailed )
   {
     mLastError = tr( "Failed to parse JSON" );
     emit lastErrorChanged( mLastError );
-    return;
   }
-  mPayload = jsonDoc.object();
-  const double latitude = mPayload.value( "lat" ).toDouble() == 0 ? std::numeric_limits<double>::quiet_NaN() : mPayload.value( "lat" ).toDouble();
-  const double longitude = mPayload.value( "lon" ).toDouble() == 0 ? std::numeric_limits<double>::quiet_NaN() : mPayload.value( "lon" ).toDouble();
-  const double elevation = mPayload.value( "alt" ).toDouble() == 0 ? std::numeric_limits<double>::quiet_NaN() : mPayload.value( "alt" ).toDouble();
+}
+
+void EgenioussReceiver::processFix( const EgenioussFrameParser::Fix &fix )
+{
+  mFix = fix;
+  mHasFix = true;
+
+  const double latitude = fix.latitude == 0 ? std::numeric_limits<double>::quiet_NaN() : fix.latitude;
+  const double longitude = fix.longitude == 0 ? std::numeric_limits<double>::quiet_NaN() : fix.longitude;
+  const double elevation = fix.altitude == 0 ? std::numeric_limits<double>::quiet_NaN() : fix.altitude;
   mLastGnssPositionInformation = GnssPositionInformation(
     latitude,
     longitude,
@@ -115,7 +126,7 @@ void EgenioussReceiver::onReadyRead()
     0,
     std::numeric_limits<double>::quiet_NaN(),
     std::numeric_limits<double>::quiet_NaN(),
-    QDateTime::fromMSecsSinceEpoch( mPayload.value( "utc" ).toDouble() / 1e6, QTimeZone( QTimeZone::Initialization::UTC ) ),
+    QDateTime::fromMSecsSinceEpoch( fix.utc / 1e6, QTimeZone( QTimeZone::Initialization::UTC ) ),
     QChar(),
     0,
     1 );
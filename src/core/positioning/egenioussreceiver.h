@@ -18,8 +18,8 @@
 #define EGENIOUSSRECEIVER_H
 
 #include "abstractgnssreceiver.h"
+#include "egenioussframeparser.h"
 
-#include <QJsonObject>
 #include <QTcpSocket>
 
 /**
@@ -46,11 +46,17 @@ class EgenioussReceiver : public AbstractGnssReceiver
     void handleError( QAbstractSocket::SocketError error );
 
   private:
-    void processReceivedData();
+    //! Updates the last position information from a decoded \a fix
+    void processFix( const EgenioussFrameParser::Fix &fix );
+
+    //! Maximum number of bytes read from the socket before extracting frames
+    static constexpr qint64 ReadChunkSize = 64 * 1024;
 
   private:
     QTcpSocket *mTcpSocket = nullptr;
-    QJsonObject mPayload;
+    EgenioussFrameParser mParser;
+    EgenioussFrameParser::Fix mFix;
+    bool mHasFix = false;
     const QHostAddress::SpecialAddress mAddress = QHostAddress::LocalHost;
     const int mPort = 1235;
 };
@@ -14,6 +14,7 @@
  *                                                                         *
  ***************************************************************************/
 
+#include "featurequeryexecutor.h"
 #include "geofencer.h"
 
 #include <qgsgeometryengine.h>
@@ -26,16 +27,15 @@ Geofencer::Geofencer( QObject *parent )
 
 Geofencer::~Geofencer()
 {
+  cleanupGatherer();
 }
 
 void Geofencer::cleanupGatherer()
 {
-  if ( mGatherer )
+  if ( mGathererTicket )
   {
-    disconnect( mGatherer, &QThread::finished, this, &Geofencer::processAreas );
-    connect( mGatherer, &QThread::finished, mGatherer, &QObject::deleteLater );
-    mGatherer->stop();
-    mGatherer = nullptr;
+    FeatureQueryExecutor::instance()->cancel( mGathererTicket );
+    mGathererTicket = 0;
   }
 }
 
@@ -57,21 +57,38 @@ void Geofencer::gatherAreas()
 
   cleanupGatherer();
 
-  mGatherer = new FeatureExpressionValuesGatherer( mAreasLayer, mAreasLayer->displayExpression(), request );
-  connect( mGatherer, &QThread::finished, this, &Geofencer::processAreas );
-  mGatherer->start();
+  auto gatherer = std::make_shared<FeatureExpressionValuesGatherer>( mAreasLayer, mAreasLayer->displayExpression(), request );
+
+  FeatureQueryExecutor::Query query;
+  query.key = gatherer->key();
+  query.layers << mAreasLayer;
+  query.priority = FeatureQueryExecutor::Priority::Background;
+
+  mGathererTicket = FeatureQueryExecutor::instance()->submit<QVector<FeatureExpressionValuesGatherer::Entry>>(
+    query,
+    [gatherer]( QgsFeedback *feedback ) { return gatherer->gather( feedback ); },
+    this,
+    [this]( const QVector<FeatureExpressionValuesGatherer::Entry> &areas ) {
+      mGathererTicket = 0;
+      processAreas( areas );
+    } );
 }
 
-void Geofencer::processAreas()
+void Geofencer::processAreas( const QVector<FeatureExpressionValuesGatherer::Entry> &areas )
 {
-  if ( !mGatherer )
-    return;
+  mAreas = areas;
 
-  mAreas.clear();
-
-  mAreas = mGatherer->entries();
-  mGatherer->deleteLater();
-  mGatherer = nullptr;
+  mAreasIndex = QgsSpatialIndex();
+  mAreasEngines.clear();
+  mAreasEngines.resize( mAreas.size() );
+  for ( int i = 0; i < mAreas.size(); i++ )
+  {
+    const QgsGeometry geometry = mAreas.at( i ).feature.geometry();
+    if ( !geometry.isNull() )
+    {
+      mAreasIndex.addFeature( i, geometry.boundingBox() );
+    }
+  }
 
   if ( mActive )
   {
@@ -80,19 +97,40 @@ void Geofencer::processAreas()
   }
 }
 
+bool Geofencer::isWithinArea( int index )
+{
+  std::unique_ptr<QgsGeometryEngine> &geometryEngine = mAreasEngines[index];
+  if ( !geometryEngine )
+  {
+    geometryEngine.reset( QgsGeometry::createGeometryEngine( mAreas.at( index ).feature.geometry().constGet() ) );
+    geometryEngine->prepareGeometry();
+  }
+
+  return geometryEngine->contains( &mPosition );
+}
+
 void Geofencer::checkWithin()
 {
   int isWithinIndex = -1;
   if ( mActive && !mAreas.isEmpty() && !mPosition.isEmpty() )
   {
-    std::unique_ptr<QgsGeometryEngine> geometryEngine;
-    geometryEngine.reset( QgsGeometry::createGeometryEngine( &mPosition ) );
-    for ( int i = 0; i < mAreas.size(); i++ )
+    // Positions tend to stay within the same area, check it first
+    if ( mIsWithinIndex > -1 && mIsWithinIndex < mAreas.size() && isWithinArea( mIsWithinIndex ) )
+    {
+      isWithinIndex = mIsWithinIndex;
+    }
+    else
     {
-      if ( geometryEngine->within( mAreas.at( i ).feature.geometry().get() ) )
+      QList<QgsFeatureId> candidates = mAreasIndex.intersects( QgsRectangle( mPosition.x(), mPosition.y(), mPosition.x(), mPosition.y() ) );
+      // Keep the areas order to match the first overlapping area
+      std::sort( candidates.begin(), candidates.end() );
+      for ( const QgsFeatureId candidate : std::as_const( candidates ) )
       {
-        isWithinIndex = i;
-        break;
+        if ( isWithinArea( static_cast<int>( candidate ) ) )
+        {
+          isWithinIndex = static_cast<int>( candidate );
+          break;
+        }
       }
     }
   }
@@ -22,9 +22,14 @@
 #include <QObject>
 #include <QTimer>
 #include <qgscoordinatereferencesystem.h>
+#include <qgsgeometryengine.h>
 #include <qgspoint.h>
+#include <qgsspatialindex.h>
 #include <qgsvectorlayer.h>
 
+#include <memory>
+#include <vector>
+
 /**
  * This class provides an interface to manage geofencing of areas as well as
  * providing feedback whenever the position trespasses into or out of those
@@ -155,11 +160,17 @@ class Geofencer : public QObject
   private:
     void cleanupGatherer();
     void gatherAreas();
-    void processAreas();
+    void processAreas( const QVector<FeatureExpressionValuesGatherer::Entry> &areas );
 
     void checkWithin();
     void checkAlert();
 
+    /**
+     * Returns TRUE if the current position is within the area at \a index.
+     * The area geometry engine is prepared on first use.
+     */
+    bool isWithinArea( int index );
+
     bool mActive = false;
     Behaviors mBehavior = AlertWhenInsideGeofencedArea;
 
@@ -168,13 +179,16 @@ class Geofencer : public QObject
 
     QPointer<QgsVectorLayer> mAreasLayer;
     QList<FeatureExpressionValuesGatherer::Entry> mAreas;
+    QgsSpatialIndex mAreasIndex;
+    std::vector<std::unique_ptr<QgsGeometryEngine>> mAreasEngines;
 
     bool mIsAlerting = false;
 
     int mIsWithinIndex = -1;
     int mLastWithinIndex = -1;
 
-    FeatureExpressionValuesGatherer *mGatherer = nullptr;
+    //! Ticket of the areas query submitted to the FeatureQueryExecutor, 0 when none is pending
+    quint64 mGathererTicket = 0;
 };
 
 #endif // GEOFENCER_H
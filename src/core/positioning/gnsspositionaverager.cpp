@@ -0,0 +1,131 @@
+/***************************************************************************
+  gnsspositionaverager.cpp - GnssPositionAverager
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "gnsspositionaverager.h"
+
+#include <QObject>
+#include <cmath>
+
+// Minimum number of positions required before outliers are rejected, so the spread estimate is meaningful
+#define OUTLIER_REJECTION_MINIMUM_COUNT 5
+
+// Approximate length of a degree of latitude in meters
+#define METERS_PER_DEGREE 111320.0
+
+void GnssPositionAverager::RunningStatistic::add( double value )
+{
+  if ( std::isnan( value ) )
+    return;
+
+  count++;
+  const double delta = value - runningMean;
+  runningMean += delta / count;
+  m2 += delta * ( value - runningMean );
+}
+
+double GnssPositionAverager::RunningStatistic::mean( double defaultValue ) const
+{
+  return count > 0 ? runningMean : defaultValue;
+}
+
+double GnssPositionAverager::RunningStatistic::variance() const
+{
+  return count > 1 ? m2 / ( count - 1 ) : std::numeric_limits<double>::quiet_NaN();
+}
+
+void GnssPositionAverager::reset()
+{
+  *this = GnssPositionAverager();
+}
+
+bool GnssPositionAverager::addPositionInformation( const GnssPositionInformation &positionInformation )
+{
+  if ( mOutlierRejection && mCount >= OUTLIER_REJECTION_MINIMUM_COUNT )
+  {
+    const double standardDeviation = horizontalStandardDeviation();
+    if ( standardDeviation > 0 && horizontalDistanceToMean( positionInformation ) > mOutlierThreshold * standardDeviation )
+    {
+      mRejectedCount++;
+      return false;
+    }
+  }
+
+  if ( mCount == 0 )
+  {
+    mFirstPositionInformation = positionInformation;
+  }
+  mLastPositionInformation = positionInformation;
+  mCount++;
+
+  mLatitude.add( positionInformation.latitude() );
+  mLongitude.add( positionInformation.longitude() );
+  mElevation.add( positionInformation.elevation() );
+  mSpeed.add( positionInformation.speed() );
+  mDirection.add( positionInformation.direction() );
+  mPdop.add( positionInformation.pdop() );
+  mHdop.add( positionInformation.hdop() );
+  mVdop.add( positionInformation.vdop() );
+  mHacc.add( positionInformation.hacc() );
+  mVacc.add( positionInformation.vacc() );
+  mVerticalSpeed.add( positionInformation.verticalSpeed() );
+  mMagneticVariation.add( positionInformation.magneticVariation() );
+
+  return true;
+}
+
+GnssPositionInformation GnssPositionAverager::averagedPositionInformation() const
+{
+  if ( mCount == 0 )
+    return GnssPositionInformation();
+
+  const QString sourceName = QStringLiteral( "%1 (%2)" ).arg( mFirstPositionInformation.sourceName(), QObject::tr( "averaged" ) );
+  const QList<QgsSatelliteInfo> satellitesInView = mFirstPositionInformation.satellitesInView();
+
+  return GnssPositionInformation( mLatitude.mean(), mLongitude.mean(), mElevation.mean(),
+                                  mSpeed.mean(), mDirection.mean(), satellitesInView,
+                                  mPdop.mean( 0 ), mHdop.mean( 0 ), mVdop.mean( 0 ),
+                                  mHacc.mean(), mVacc.mean(), mLastPositionInformation.utcDateTime(),
+                                  mFirstPositionInformation.fixMode(), mFirstPositionInformation.fixType(), mFirstPositionInformation.quality(),
+                                  static_cast<int>( satellitesInView.size() ), mFirstPositionInformation.status(), mFirstPositionInformation.satPrn(), mFirstPositionInformation.satInfoComplete(),
+                                  mVerticalSpeed.mean(), mMagneticVariation.mean(), mCount, sourceName,
+                                  mLastPositionInformation.imuCorrection(), mLastPositionInformation.orientation() );
+}
+
+double GnssPositionAverager::horizontalStandardDeviation() const
+{
+  const double latitudeVariance = mLatitude.variance();
+  const double longitudeVariance = mLongitude.variance();
+  if ( std::isnan( latitudeVariance ) || std::isnan( longitudeVariance ) )
+    return std::numeric_limits<double>::quiet_NaN();
+
+  const double longitudeScale = std::cos( mLatitude.mean() * M_PI / 180.0 );
+  return std::sqrt( latitudeVariance + longitudeVariance * longitudeScale * longitudeScale ) * METERS_PER_DEGREE;
+}
+
+double GnssPositionAverager::verticalStandardDeviation() const
+{
+  const double elevationVariance = mElevation.variance();
+  return std::isnan( elevationVariance ) ? elevationVariance : std::sqrt( elevationVariance );
+}
+
+double GnssPositionAverager::horizontalDistanceToMean( const GnssPositionInformation &positionInformation ) const
+{
+  if ( std::isnan( positionInformation.latitude() ) || std::isnan( positionInformation.longitude() ) )
+    return 0.0;
+
+  const double dy = ( positionInformation.latitude() - mLatitude.mean() ) * METERS_PER_DEGREE;
+  const double dx = ( positionInformation.longitude() - mLongitude.mean() ) * METERS_PER_DEGREE * std::cos( mLatitude.mean() * M_PI / 180.0 );
+  return std::sqrt( dx * dx + dy * dy );
+}
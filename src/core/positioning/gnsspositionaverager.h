@@ -0,0 +1,109 @@
+/***************************************************************************
+  gnsspositionaverager.h - GnssPositionAverager
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef GNSSPOSITIONAVERAGER_H
+#define GNSSPOSITIONAVERAGER_H
+
+#include "gnsspositioninformation.h"
+#include "qfield_core_export.h"
+
+/**
+ * Computes a running average of position information in constant time and memory
+ * per added position using Welford's online algorithm, with optional rejection of
+ * positions lying too far from the running mean.
+ * \ingroup core
+ */
+class QFIELD_CORE_EXPORT GnssPositionAverager
+{
+  public:
+    GnssPositionAverager() = default;
+
+    //! Clears all accumulated positions
+    void reset();
+
+    /**
+     * Accumulates a \a positionInformation.
+     * \returns FALSE if the position was rejected as an outlier
+     */
+    bool addPositionInformation( const GnssPositionInformation &positionInformation );
+
+    //! Returns the number of accumulated positions
+    int count() const { return mCount; }
+
+    //! Returns the number of positions rejected as outliers since the last reset
+    int rejectedCount() const { return mRejectedCount; }
+
+    //! Returns the averaged position information
+    GnssPositionInformation averagedPositionInformation() const;
+
+    //! Returns the standard deviation in meters of the accumulated horizontal positions
+    double horizontalStandardDeviation() const;
+
+    //! Returns the standard deviation in meters of the accumulated elevations
+    double verticalStandardDeviation() const;
+
+    //! Returns whether positions beyond outlierThreshold standard deviations from the running mean are rejected
+    bool outlierRejection() const { return mOutlierRejection; }
+
+    //! Sets whether positions beyond outlierThreshold standard deviations from the running mean are rejected
+    void setOutlierRejection( bool outlierRejection ) { mOutlierRejection = outlierRejection; }
+
+    //! Returns the number of standard deviations from the running mean beyond which positions are rejected
+    double outlierThreshold() const { return mOutlierThreshold; }
+
+    //! Sets the number of standard deviations from the running mean beyond which positions are rejected
+    void setOutlierThreshold( double outlierThreshold ) { mOutlierThreshold = outlierThreshold; }
+
+  private:
+    /**
+     * Running mean and sum of squared differences of a single value, NaN values are skipped.
+     */
+    struct RunningStatistic
+    {
+        void add( double value );
+        double mean( double defaultValue = std::numeric_limits<double>::quiet_NaN() ) const;
+        double variance() const;
+
+        int count = 0;
+        double runningMean = 0.0;
+        double m2 = 0.0;
+    };
+
+    double horizontalDistanceToMean( const GnssPositionInformation &positionInformation ) const;
+
+    int mCount = 0;
+    int mRejectedCount = 0;
+
+    bool mOutlierRejection = false;
+    double mOutlierThreshold = 3.0;
+
+    RunningStatistic mLatitude;
+    RunningStatistic mLongitude;
+    RunningStatistic mElevation;
+    RunningStatistic mSpeed;
+    RunningStatistic mDirection;
+    RunningStatistic mPdop;
+    RunningStatistic mHdop;
+    RunningStatistic mVdop;
+    RunningStatistic mHacc;
+    RunningStatistic mVacc;
+    RunningStatistic mVerticalSpeed;
+    RunningStatistic mMagneticVariation;
+
+    GnssPositionInformation mFirstPositionInformation;
+    GnssPositionInformation mLastPositionInformation;
+};
+
+#endif // GNSSPOSITIONAVERAGER_H
@@ -0,0 +1,189 @@
+/***************************************************************************
+  gnsssession.cpp - GnssSessionWriter, GnssSessionReader
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "gnsssession.h"
+
+#include <QTimeZone>
+
+#include <algorithm>
+#include <cstring>
+#include <limits>
+
+namespace
+{
+  constexpr char SessionMagic[8] = { 'G', 'N', 'S', 'S', 'S', 'E', 'S', 'S' };
+  constexpr quint32 SessionVersion = 1;
+
+  enum RecordFlag : quint8
+  {
+    SatInfoComplete = 1,
+    ImuCorrection = 1 << 1,
+  };
+
+  bool isValidHeader( const GnssSessionHeader &header )
+  {
+    return std::memcmp( header.magic, SessionMagic, sizeof( SessionMagic ) ) == 0 && header.version == SessionVersion && header.recordSize == sizeof( GnssSessionRecord );
+  }
+} // namespace
+
+GnssSessionWriter::~GnssSessionWriter()
+{
+  close();
+}
+
+bool GnssSessionWriter::open( const QString &path )
+{
+  close();
+
+  mFile.setFileName( path );
+  if ( !mFile.open( QIODevice::ReadWrite ) )
+    return false;
+
+  GnssSessionHeader header;
+  const qint64 size = mFile.size();
+  if ( size < static_cast<qint64>( sizeof( header ) ) || mFile.read( reinterpret_cast<char *>( &header ), sizeof( header ) ) != sizeof( header ) || !isValidHeader( header ) )
+  {
+    // The header is written along with the first record, which names the source
+    mFile.resize( 0 );
+  }
+  else
+  {
+    // Drop a record left incomplete by an interrupted write
+    const qint64 recordsSize = ( size - static_cast<qint64>( sizeof( header ) ) ) / sizeof( GnssSessionRecord ) * sizeof( GnssSessionRecord );
+    mFile.resize( sizeof( header ) + recordsSize );
+  }
+
+  return mFile.seek( mFile.size() );
+}
+
+void GnssSessionWriter::close()
+{
+  if ( mFile.isOpen() )
+    mFile.close();
+}
+
+bool GnssSessionWriter::write( const GnssPositionInformation &positionInformation )
+{
+  if ( !mFile.isOpen() )
+    return false;
+
+  if ( mFile.pos() == 0 )
+  {
+    GnssSessionHeader header;
+    std::memset( &header, 0, sizeof( header ) );
+    std::memcpy( header.magic, SessionMagic, sizeof( SessionMagic ) );
+    header.version = SessionVersion;
+    header.recordSize = sizeof( GnssSessionRecord );
+    const QByteArray sourceName = positionInformation.sourceName().toUtf8().left( GnssSessionHeader::MaximumSourceNameSize - 1 );
+    std::memcpy( header.sourceName, sourceName.constData(), sourceName.size() );
+    mFile.write( reinterpret_cast<const char *>( &header ), sizeof( header ) );
+  }
+
+  GnssSessionRecord record;
+  std::memset( &record, 0, sizeof( record ) );
+  record.utcDateTime = positionInformation.utcDateTime().isValid() ? positionInformation.utcDateTime().toMSecsSinceEpoch() : std::numeric_limits<qint64>::lowest();
+  record.latitude = positionInformation.latitude();
+  record.longitude = positionInformation.longitude();
+  record.elevation = positionInformation.elevation();
+  record.speed = positionInformation.speed();
+  record.direction = positionInformation.direction();
+  record.pdop = positionInformation.pdop();
+  record.hdop = positionInformation.hdop();
+  record.vdop = positionInformation.vdop();
+  record.hacc = positionInformation.hacc();
+  record.vacc = positionInformation.vacc();
+  record.verticalSpeed = positionInformation.verticalSpeed();
+  record.magneticVariation = positionInformation.magneticVariation();
+  record.orientation = positionInformation.orientation();
+  record.fixType = positionInformation.fixType();
+  record.quality = positionInformation.quality();
+  record.satellitesUsed = positionInformation.satellitesUsed();
+  record.averagedCount = positionInformation.averagedCount();
+  record.fixMode = positionInformation.fixMode().unicode();
+  record.status = positionInformation.status().unicode();
+  record.flags = ( positionInformation.satInfoComplete() ? SatInfoComplete : 0 ) | ( positionInformation.imuCorrection() ? ImuCorrection : 0 );
+
+  const QList<int> satPrn = positionInformation.satPrn();
+  record.satPrnCount = static_cast<quint8>( std::min<qsizetype>( satPrn.size(), GnssSessionRecord::MaximumSatPrnCount ) );
+  for ( int i = 0; i < record.satPrnCount; ++i )
+    record.satPrn[i] = static_cast<qint16>( satPrn.at( i ) );
+
+  // A single write per position, nothing is left in the buffers if the process gets killed
+  const bool written = mFile.write( reinterpret_cast<const char *>( &record ), sizeof( record ) ) == sizeof( record );
+  mFile.flush();
+  return written;
+}
+
+GnssSessionReader::GnssSessionReader( const QString &path )
+  : mFile( path )
+{
+  if ( !mFile.open( QIODevice::ReadOnly ) )
+    return;
+
+  const qint64 size = mFile.size();
+  if ( size < static_cast<qint64>( sizeof( GnssSessionHeader ) ) )
+    return;
+
+  const uchar *data = mFile.map( 0, size );
+  if ( !data )
+  {
+    mData = mFile.readAll();
+    data = reinterpret_cast<const uchar *>( mData.constData() );
+  }
+
+  GnssSessionHeader header;
+  std::memcpy( &header, data, sizeof( header ) );
+  if ( !isValidHeader( header ) )
+    return;
+
+  mSourceName = QString::fromUtf8( header.sourceName, qstrnlen( header.sourceName, GnssSessionHeader::MaximumSourceNameSize ) );
+  mRecords = data + sizeof( header );
+  // A record being written by the positioning service is left out until complete
+  mCount = ( size - static_cast<qint64>( sizeof( header ) ) ) / static_cast<qint64>( sizeof( GnssSessionRecord ) );
+  mValid = true;
+}
+
+GnssPositionInformation GnssSessionReader::positionInformation( qsizetype index ) const
+{
+  if ( index < 0 || index >= mCount )
+    return GnssPositionInformation();
+
+  // Records of a mapped file aren't guaranteed to be aligned
+  GnssSessionRecord record;
+  std::memcpy( &record, mRecords + index * sizeof( GnssSessionRecord ), sizeof( record ) );
+
+  QList<int> satPrn;
+  satPrn.reserve( record.satPrnCount );
+  for ( int i = 0; i < std::min<int>( record.satPrnCount, GnssSessionRecord::MaximumSatPrnCount ); ++i )
+    satPrn << record.satPrn[i];
+
+  const QDateTime utcDateTime = record.utcDateTime != std::numeric_limits<qint64>::lowest() ? QDateTime::fromMSecsSinceEpoch( record.utcDateTime, QTimeZone( QTimeZone::Initialization::UTC ) ) : QDateTime();
+
+  return GnssPositionInformation( record.latitude, record.longitude, record.elevation, record.speed, record.direction,
+                                  QList<QgsSatelliteInfo>(), record.pdop, record.hdop, record.vdop, record.hacc, record.vacc,
+                                  utcDateTime, QChar( record.fixMode ), record.fixType, record.quality, record.satellitesUsed,
+                                  QChar( record.status ), satPrn, record.flags & SatInfoComplete, record.verticalSpeed,
+                                  record.magneticVariation, record.averagedCount, mSourceName, record.flags & ImuCorrection,
+                                  record.orientation );
+}
+
+QList<GnssPositionInformation> GnssSessionReader::positionInformationList() const
+{
+  QList<GnssPositionInformation> positionInformationList;
+  positionInformationList.reserve( mCount );
+  for ( qsizetype i = 0; i < mCount; ++i )
+    positionInformationList << positionInformation( i );
+  return positionInformationList;
+}
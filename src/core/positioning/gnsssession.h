@@ -0,0 +1,143 @@
+/***************************************************************************
+  gnsssession.h - GnssSessionWriter, GnssSessionReader
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef GNSSSESSION_H
+#define GNSSSESSION_H
+
+#include "gnsspositioninformation.h"
+#include "qfield_core_export.h"
+
+#include <QByteArray>
+#include <QFile>
+
+/**
+ * \brief Fixed size record of a position in a GNSS session file.
+ *
+ * Session files start with a GnssSessionHeader followed by records written in the byte
+ * order of the device. Satellites in view aren't recorded, only the PRNs of the satellites
+ * used for the fix.
+ * \ingroup core
+ */
+struct GnssSessionRecord
+{
+    static constexpr int MaximumSatPrnCount = 29;
+
+    //! Milliseconds since epoch, or the lowest qint64 for an invalid date time
+    qint64 utcDateTime;
+    double latitude;
+    double longitude;
+    double elevation;
+    double speed;
+    double direction;
+    double pdop;
+    double hdop;
+    double vdop;
+    double hacc;
+    double vacc;
+    double verticalSpeed;
+    double magneticVariation;
+    double orientation;
+    qint32 fixType;
+    qint32 quality;
+    qint32 satellitesUsed;
+    qint32 averagedCount;
+    quint16 fixMode;
+    quint16 status;
+    quint8 flags;
+    quint8 satPrnCount;
+    qint16 satPrn[MaximumSatPrnCount];
+};
+static_assert( sizeof( GnssSessionRecord ) == 192, "GNSS session records must keep their size" );
+
+//! Header of a GNSS session file
+struct GnssSessionHeader
+{
+    static constexpr int MaximumSourceNameSize = 48;
+
+    char magic[8];
+    quint32 version;
+    quint32 recordSize;
+    //! UTF-8 name of the source of the first record, NUL padded
+    char sourceName[MaximumSourceNameSize];
+};
+static_assert( sizeof( GnssSessionHeader ) == 64, "GNSS session headers must keep their size" );
+
+/**
+ * \brief Appends positions to a GNSS session file.
+ *
+ * Every position is written as soon as it is received, a session interrupted by the
+ * termination of the process only losing the record being written.
+ * \ingroup core
+ */
+class QFIELD_CORE_EXPORT GnssSessionWriter
+{
+  public:
+    GnssSessionWriter() = default;
+    ~GnssSessionWriter();
+
+    /**
+     * Opens the session file at \a path, appending to it if it holds a session already.
+     * \returns FALSE if the file couldn't be opened
+     */
+    bool open( const QString &path );
+
+    //! Closes the session file
+    void close();
+
+    //! Returns whether a session file is open
+    bool isOpen() const { return mFile.isOpen(); }
+
+    //! Appends a \a positionInformation to the session
+    bool write( const GnssPositionInformation &positionInformation );
+
+  private:
+    QFile mFile;
+};
+
+/**
+ * \brief Reads the positions of a GNSS session file.
+ *
+ * The file is memory-mapped, positions being decoded on demand so that sessions
+ * of any length can be read in chunks without being loaded at once.
+ * \ingroup core
+ */
+class QFIELD_CORE_EXPORT GnssSessionReader
+{
+  public:
+    explicit GnssSessionReader( const QString &path );
+
+    //! Returns whether the file holds a session
+    bool isValid() const { return mValid; }
+
+    //! Returns the number of positions in the session
+    qsizetype count() const { return mCount; }
+
+    //! Returns the position at \a index
+    GnssPositionInformation positionInformation( qsizetype index ) const;
+
+    //! Returns all the positions of the session
+    QList<GnssPositionInformation> positionInformationList() const;
+
+  private:
+    QFile mFile;
+    //! Records, mapped into memory or read into mData when mapping isn't possible
+    const uchar *mRecords = nullptr;
+    QByteArray mData;
+    qsizetype mCount = 0;
+    QString mSourceName;
+    bool mValid = false;
+};
+
+#endif // GNSSSESSION_H
@@ -73,6 +73,11 @@ void NmeaGnssReceiver::stateChanged( const QgsGpsInformation &info )
       mLastGnssPositionInformation = mCurrentNmeaGnssPositionInformation;
     }
 
+    if ( mLogSession.isOpen() )
+    {
+      mLogSession.write( mLastGnssPositionInformation );
+    }
+
     emit lastGnssPositionInformationChanged( mLastGnssPositionInformation );
   }
 
@@ -90,7 +95,12 @@ void NmeaGnssReceiver::nmeaSentenceReceived( const QString &substring )
 {
   if ( mLogFile.isOpen() )
   {
-    mLogStream << substring << Qt::endl;
+    mLogStream << substring << '\n';
+    if ( mLogFlushTimer.elapsed() >= LogFlushInterval )
+    {
+      mLogStream.flush();
+      mLogFlushTimer.restart();
+    }
   }
 
   if ( substring.startsWith( "$INS.NAVI" ) )
@@ -104,15 +114,20 @@ void NmeaGnssReceiver::handleStartLogging()
   const QStringList appDataDirs = PlatformUtilities::instance()->appDataDirs();
   if ( !appDataDirs.isEmpty() )
   {
-    mLogFile.setFileName( QStringLiteral( "%1/logs/nmea-%2.log" ).arg( appDataDirs.at( 0 ), QDateTime::currentDateTime().toString( QStringLiteral( "yyyy-MM-ddThh:mm:ss" ) ) ) );
+    const QString logPath = QStringLiteral( "%1/logs/nmea-%2" ).arg( appDataDirs.at( 0 ), QDateTime::currentDateTime().toString( QStringLiteral( "yyyy-MM-ddThh:mm:ss" ) ) );
+    mLogFile.setFileName( QStringLiteral( "%1.log" ).arg( logPath ) );
     mLogFile.open( QIODevice::WriteOnly );
     mLogStream.setDevice( &mLogFile );
+    mLogFlushTimer.start();
+    mLogSession.open( QStringLiteral( "%1.gnss" ).arg( logPath ) );
   }
 }
 
 void NmeaGnssReceiver::handleStopLogging()
 {
+  mLogStream.flush();
   mLogFile.close();
+  mLogSession.close();
 }
 
 GnssPositionDetails NmeaGnssReceiver::details() const
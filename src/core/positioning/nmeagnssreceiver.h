@@ -17,8 +17,10 @@
 #define NMEAGNSSRECEIVER_H
 
 #include "abstractgnssreceiver.h"
+#include "gnsssession.h"
 #include "qgsnmeaconnection.h"
 
+#include <QElapsedTimer>
 #include <QFile>
 #include <QObject>
 
@@ -55,8 +57,14 @@ class NmeaGnssReceiver : public AbstractGnssReceiver
 
     QTime mLastGnssPositionUtcTime;
 
+    //! Maximum number of milliseconds logged sentences are buffered before being written
+    static constexpr qint64 LogFlushInterval = 1000;
+
     QFile mLogFile;
     QTextStream mLogStream;
+    QElapsedTimer mLogFlushTimer;
+    //! Session recording the positions decoded from the logged sentences
+    GnssSessionWriter mLogSession;
 
     GnssPositionInformation mCurrentNmeaGnssPositionInformation;
 
@@ -81,6 +81,7 @@ void Positioning::setupSource()
   connect( mPositioningSourceReplica.data(), SIGNAL( deviceSocketStateStringChanged() ), this, SIGNAL( deviceSocketStateStringChanged() ) );
   connect( mPositioningSourceReplica.data(), SIGNAL( averagedPositionChanged() ), this, SIGNAL( averagedPositionChanged() ) );
   connect( mPositioningSourceReplica.data(), SIGNAL( averagedPositionCountChanged() ), this, SIGNAL( averagedPositionCountChanged() ) );
+  connect( mPositioningSourceReplica.data(), SIGNAL( averagedPositionOutlierRejectionChanged() ), this, SIGNAL( averagedPositionOutlierRejectionChanged() ) );
   connect( mPositioningSourceReplica.data(), SIGNAL( elevationCorrectionModeChanged() ), this, SIGNAL( elevationCorrectionModeChanged() ) );
   connect( mPositioningSourceReplica.data(), SIGNAL( antennaHeightChanged() ), this, SIGNAL( antennaHeightChanged() ) );
   connect( mPositioningSourceReplica.data(), SIGNAL( orientationChanged() ), this, SIGNAL( orientationChanged() ) );
@@ -336,6 +337,29 @@ void Positioning::setAveragedPosition( bool averaged )
   }
 }
 
+double Positioning::averagedPositionStandardDeviation() const
+{
+  return isSourceAvailable() ? mPositioningSourceReplica->property( "averagedPositionStandardDeviation" ).toDouble() : std::numeric_limits<double>::quiet_NaN();
+}
+
+bool Positioning::averagedPositionOutlierRejection() const
+{
+  return ( isSourceAvailable() ? mPositioningSourceReplica->property( "averagedPositionOutlierRejection" ) : mPropertiesToSync.value( "averagedPositionOutlierRejection", false ) ).toBool();
+}
+
+void Positioning::setAveragedPositionOutlierRejection( bool rejection )
+{
+  if ( isSourceAvailable() )
+  {
+    mPositioningSourceReplica->setProperty( "averagedPositionOutlierRejection", rejection );
+  }
+  else
+  {
+    mPropertiesToSync["averagedPositionOutlierRejection"] = rejection;
+    emit averagedPositionOutlierRejectionChanged();
+  }
+}
+
 bool Positioning::logging() const
 {
   return ( isSourceAvailable() ? mPositioningSourceReplica->property( "logging" ) : mPropertiesToSync.value( "logging", false ) ).toBool();
@@ -56,6 +56,8 @@ class Positioning : public QObject
 
     Q_PROPERTY( bool averagedPosition READ averagedPosition WRITE setAveragedPosition NOTIFY averagedPositionChanged )
     Q_PROPERTY( int averagedPositionCount READ averagedPositionCount NOTIFY averagedPositionCountChanged )
+    Q_PROPERTY( double averagedPositionStandardDeviation READ averagedPositionStandardDeviation NOTIFY averagedPositionCountChanged )
+    Q_PROPERTY( bool averagedPositionOutlierRejection READ averagedPositionOutlierRejection WRITE setAveragedPositionOutlierRejection NOTIFY averagedPositionOutlierRejectionChanged )
 
     Q_PROPERTY( PositioningSource::ElevationCorrectionMode elevationCorrectionMode READ elevationCorrectionMode WRITE setElevationCorrectionMode NOTIFY elevationCorrectionModeChanged )
     Q_PROPERTY( double antennaHeight READ antennaHeight WRITE setAntennaHeight NOTIFY antennaHeightChanged )
@@ -65,6 +67,7 @@ class Positioning : public QObject
     Q_PROPERTY( bool logging READ logging WRITE setLogging NOTIFY loggingChanged )
 
     Q_PROPERTY( bool backgroundMode READ backgroundMode WRITE setBackgroundMode NOTIFY backgroundModeChanged )
+    Q_PROPERTY( QString backgroundSessionFilePath READ backgroundSessionFilePath CONSTANT )
 
   public:
     explicit Positioning( QObject *parent = nullptr );
@@ -176,6 +179,22 @@ class Positioning : public QObject
      */
     int averagedPositionCount() const;
 
+    /**
+     * Returns the horizontal standard deviation in meters of the collected position informations from which the averaged position is calculated.
+     * \note When less than two positions have been collected, the value is NaN.
+     */
+    double averagedPositionStandardDeviation() const;
+
+    /**
+     * Returns whether incoming positions lying beyond three standard deviations from the averaged position are discarded.
+     */
+    bool averagedPositionOutlierRejection() const;
+
+    /**
+     * Sets whether incoming positions lying beyond three standard deviations from the averaged position are discarded.
+     */
+    void setAveragedPositionOutlierRejection( bool rejection );
+
     /**
      * Returns the current elevation correction mode.
      * \note Some modes depends on device capabilities.
@@ -238,6 +257,12 @@ class Positioning : public QObject
      */
     Q_INVOKABLE QList<GnssPositionInformation> getBackgroundPositionInformation() const;
 
+    /**
+     * Returns the path of the GNSS session file collecting position information while background mode is active.
+     * \see TrackingModel::replayPositionInformationSession()
+     */
+    QString backgroundSessionFilePath() const { return PositioningSource::backgroundSessionFilePath; }
+
   signals:
     void activeChanged();
     void validChanged();
@@ -249,6 +274,7 @@ class Positioning : public QObject
     void positionInformationChanged();
     void averagedPositionChanged();
     void averagedPositionCountChanged();
+    void averagedPositionOutlierRejectionChanged();
     void projectedPositionChanged();
     void elevationCorrectionModeChanged();
     void antennaHeightChanged();
@@ -30,6 +30,7 @@
 #include <QStandardPaths>
 
 QString PositioningSource::backgroundFilePath = QStringLiteral( "%1/positioning.background" ).arg( QStandardPaths::writableLocation( QStandardPaths::AppDataLocation ) );
+QString PositioningSource::backgroundSessionFilePath = QStringLiteral( "%1.gnss" ).arg( PositioningSource::backgroundFilePath );
 
 PositioningSource::PositioningSource( QObject *parent )
   : QObject( parent )
@@ -108,19 +109,26 @@ void PositioningSource::setAveragedPosition( bool averaged )
     return;
 
   mAveragedPosition = averaged;
+  mPositionAverager.reset();
   if ( mAveragedPosition )
   {
-    mCollectedPositionInformations << mPositionInformation;
-  }
-  else
-  {
-    mCollectedPositionInformations.clear();
+    mPositionAverager.addPositionInformation( mPositionInformation );
   }
 
   emit averagedPositionCountChanged();
   emit averagedPositionChanged();
 }
 
+void PositioningSource::setAveragedPositionOutlierRejection( bool rejection )
+{
+  if ( mPositionAverager.outlierRejection() == rejection )
+    return;
+
+  mPositionAverager.setOutlierRejection( rejection );
+
+  emit averagedPositionOutlierRejectionChanged();
+}
+
 void PositioningSource::setLogging( bool logging )
 {
   if ( mLogging == logging )
@@ -152,11 +160,16 @@ void PositioningSource::setBackgroundMode( bool backgroundMode )
 
   if ( mBackgroundMode )
   {
-    if ( QFile::exists( QStringLiteral( "%1.information" ).arg( backgroundFilePath ) ) )
+    if ( QFile::exists( backgroundSessionFilePath ) )
     {
       // Remove previously collected position information
-      QFile::remove( QStringLiteral( "%1.information" ).arg( backgroundFilePath ) );
+      QFile::remove( backgroundSessionFilePath );
     }
+    mBackgroundSession.open( backgroundSessionFilePath );
+  }
+  else
+  {
+    mBackgroundSession.close();
   }
 
   emit backgroundModeChanged();
@@ -164,23 +177,8 @@ void PositioningSource::setBackgroundMode( bool backgroundMode )
 
 QList<GnssPositionInformation> PositioningSource::getBackgroundPositionInformation() const
 {
-  QList<GnssPositionInformation> positionInformationList;
-
-  QFile file( QStringLiteral( "%1.information" ).arg( backgroundFilePath ) );
-  if ( file.exists() )
-  {
-    file.open( QFile::ReadOnly );
-    QDataStream stream( &file );
-    while ( !stream.atEnd() )
-    {
-      GnssPositionInformation positionInformation;
-      stream >> positionInformation;
-      positionInformationList << positionInformation;
-    }
-    file.close();
-  }
-
-  return std::move( positionInformationList );
+  GnssSessionReader session( backgroundSessionFilePath );
+  return session.positionInformationList();
 }
 
 void PositioningSource::setElevationCorrectionMode( ElevationCorrectionMode elevationCorrectionMode )
@@ -312,8 +310,9 @@ void PositioningSource::lastGnssPositionInformationChanged( const GnssPositionIn
 
   if ( mAveragedPosition )
   {
-    mCollectedPositionInformations << positionInformation;
-    mPositionInformation = PositioningUtils::averagedPositionInformation( mCollectedPositionInformations );
+    if ( !mPositionAverager.addPositionInformation( positionInformation ) )
+      return;
+    mPositionInformation = mPositionAverager.averagedPositionInformation();
   }
   else
   {
@@ -330,11 +329,7 @@ void PositioningSource::lastGnssPositionInformationChanged( const GnssPositionIn
   }
   else
   {
-    QFile file( QStringLiteral( "%1.information" ).arg( backgroundFilePath ) );
-    file.open( QFile::Append );
-    QDataStream stream( &file );
-    stream << mPositionInformation;
-    file.close();
+    mBackgroundSession.write( mPositionInformation );
   }
 }
 
@@ -18,7 +18,9 @@
 #define POSITIONINGSOURCE_H
 
 #include "abstractgnssreceiver.h"
+#include "gnsspositionaverager.h"
 #include "gnsspositioninformation.h"
+#include "gnsssession.h"
 
 #include <QCompass>
 #include <QObject>
@@ -46,6 +48,8 @@ class PositioningSource : public QObject
 
     Q_PROPERTY( bool averagedPosition READ averagedPosition WRITE setAveragedPosition NOTIFY averagedPositionChanged )
     Q_PROPERTY( int averagedPositionCount READ averagedPositionCount NOTIFY averagedPositionCountChanged )
+    Q_PROPERTY( double averagedPositionStandardDeviation READ averagedPositionStandardDeviation NOTIFY averagedPositionCountChanged )
+    Q_PROPERTY( bool averagedPositionOutlierRejection READ averagedPositionOutlierRejection WRITE setAveragedPositionOutlierRejection NOTIFY averagedPositionOutlierRejectionChanged )
 
     Q_PROPERTY( ElevationCorrectionMode elevationCorrectionMode READ elevationCorrectionMode WRITE setElevationCorrectionMode NOTIFY elevationCorrectionModeChanged )
     Q_PROPERTY( double antennaHeight READ antennaHeight WRITE setAntennaHeight NOTIFY antennaHeightChanged )
@@ -153,7 +157,23 @@ class PositioningSource : public QObject
      * Returns the current number of collected position informations from which the averaged position is calculated.
      * \note When averaged position is off, the value is zero.
      */
-    int averagedPositionCount() const { return static_cast<int>( mCollectedPositionInformations.size() ); }
+    int averagedPositionCount() const { return mPositionAverager.count(); }
+
+    /**
+     * Returns the horizontal standard deviation in meters of the collected position informations from which the averaged position is calculated.
+     * \note When less than two positions have been collected, the value is NaN.
+     */
+    double averagedPositionStandardDeviation() const { return mPositionAverager.horizontalStandardDeviation(); }
+
+    /**
+     * Returns whether incoming positions lying beyond three standard deviations from the averaged position are discarded.
+     */
+    bool averagedPositionOutlierRejection() const { return mPositionAverager.outlierRejection(); }
+
+    /**
+     * Sets whether incoming positions lying beyond three standard deviations from the averaged position are discarded.
+     */
+    void setAveragedPositionOutlierRejection( bool rejection );
 
     /**
      * Returns the current elevation correction mode.
@@ -212,6 +232,7 @@ class PositioningSource : public QObject
 
     /**
      * Returns a list of position information collected while background mode is active.
+     * \note Long sessions are better replayed in chunks from the backgroundSessionFilePath session file
      * \see backgroundMode()
      * \see setBackgroundMode()
      */
@@ -219,6 +240,9 @@ class PositioningSource : public QObject
 
     static QString backgroundFilePath;
 
+    //! Path of the GNSS session file collecting position information while background mode is active
+    static QString backgroundSessionFilePath;
+
   signals:
     void activeChanged();
     void validChanged();
@@ -230,6 +254,7 @@ class PositioningSource : public QObject
     void positionInformationChanged();
     void averagedPositionChanged();
     void averagedPositionCountChanged();
+    void averagedPositionOutlierRejectionChanged();
     void elevationCorrectionModeChanged();
     void antennaHeightChanged();
     void orientationChanged();
@@ -255,7 +280,7 @@ class PositioningSource : public QObject
     bool mValid = false;
 
     GnssPositionInformation mPositionInformation;
-    QList<GnssPositionInformation> mCollectedPositionInformations;
+    GnssPositionAverager mPositionAverager;
 
     bool mAveragedPosition = false;
 
@@ -265,6 +290,7 @@ class PositioningSource : public QObject
     bool mLogging = false;
 
     bool mBackgroundMode = false;
+    GnssSessionWriter mBackgroundSession;
 
     AbstractGnssReceiver *mReceiver = nullptr;
 
@@ -6,6 +6,323 @@
 #include <QDebug>
 #include <QTextStream>
 #include <QRegularExpression>
+#include <QCryptographicHash>
+#include <QDirIterator>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QRunnable>
+#include <QSaveFile>
+#include <QSet>
+#include <qgssqliteutils.h>
+#include <sqlite3.h>
+
+#include <algorithm>
+
+static const QString sManifestFileName = QStringLiteral("manifest.json");
+static const QString sChunksDirectoryName = QStringLiteral(".chunks");
+static const QString sStagingDirectoryName = QStringLiteral(".staging");
+//! Number of database pages copied per online backup step, between which cancellation is checked
+static const int sSnapshotStepPages = 1024;
+
+static QJsonObject readManifest(const QString &backupPath)
+{
+    QFile file(backupPath + "/" + sManifestFileName);
+    if (!file.open(QIODevice::ReadOnly))
+        return QJsonObject();
+
+    return QJsonDocument::fromJson(file.readAll()).object();
+}
+
+/**
+ * Creates a backup on a worker thread, storing the chunks of the project files
+ * and writing the manifest of the backup once all of them are stored.
+ */
+class BackupJob : public QObject, public QRunnable
+{
+    Q_OBJECT
+
+public:
+    BackupJob(const QString &projectPath, const QStringList &gpkgFiles, const QString &backupPath, const std::shared_ptr<std::atomic<bool>> &canceled)
+        : mProjectPath(projectPath)
+        , mGpkgFiles(gpkgFiles)
+        , mBackupPath(backupPath)
+        , mChunksDirectory(QFileInfo(backupPath).absolutePath() + "/" + sChunksDirectoryName)
+        , mCanceled(canceled)
+    {
+        setAutoDelete(true);
+    }
+
+    void run() override
+    {
+        QString error;
+        if (!createBackup(error))
+        {
+            // Chunks stored by this backup are referenced by no other backup
+            for (const QString &chunkPath : std::as_const(mWrittenChunks))
+                QFile::remove(chunkPath);
+            QDir(mBackupPath).removeRecursively();
+            if (error.isEmpty())
+                error = tr("Backup canceled");
+        }
+
+        emit finished(mBackupPath, error);
+    }
+
+signals:
+    void progress(const QString &message, int progress);
+    void finished(const QString &backupPath, const QString &error);
+
+private:
+    bool createBackup(QString &error)
+    {
+        if (!QDir().mkpath(mBackupPath) || !QDir().mkpath(mChunksDirectory))
+        {
+            error = tr("Could not create backup directory: %1").arg(mBackupPath);
+            return false;
+        }
+
+        const QDir projectDir = QFileInfo(mProjectPath).absoluteDir();
+        const QMap<QString, QJsonObject> previousFiles = previousBackupFiles();
+
+        QStringList files;
+        files << mProjectPath << mGpkgFiles;
+        for (const QString &file : std::as_const(files))
+        {
+            // Databases are read twice, once to snapshot them and once to store the snapshot
+            const qint64 size = QFileInfo(file).size() + QFileInfo(file + "-wal").size();
+            mTotalBytes += file == mProjectPath ? size : 2 * size;
+        }
+
+        QJsonArray fileEntries;
+        QSet<QString> entryPaths;
+        for (int i = 0; i < files.size(); ++i)
+        {
+            const QString file = files.at(i);
+            const QFileInfo fileInfo(file);
+            const QFileInfo walInfo(file + "-wal");
+            const bool isDatabase = file != mProjectPath;
+            mMessage = isDatabase ? tr("Backing up GPKG file %1 of %2...").arg(i).arg(mGpkgFiles.size()) : tr("Backing up project file...");
+
+            // Files outside the project directory are stored under data/, a restore never writes outside its destination
+            const QString relativePath = projectDir.relativeFilePath(fileInfo.absoluteFilePath());
+            const bool outOfTree = relativePath.startsWith("..") || QFileInfo(relativePath).isAbsolute();
+            QString path = outOfTree ? QStringLiteral("data/%1").arg(fileInfo.fileName()) : relativePath;
+            for (int suffix = 1; entryPaths.contains(path); ++suffix)
+                path = QStringLiteral("data/%1_%2").arg(suffix).arg(fileInfo.fileName());
+            entryPaths.insert(path);
+            const qint64 size = fileInfo.size();
+            const QString modified = fileInfo.lastModified().toString(Qt::ISODateWithMs);
+            const qint64 walSize = walInfo.exists() ? walInfo.size() : 0;
+            const QString walModified = walInfo.exists() ? walInfo.lastModified().toString(Qt::ISODateWithMs) : QString();
+
+            QJsonObject entry;
+            entry["path"] = path;
+            if (outOfTree)
+                entry["source"] = fileInfo.absoluteFilePath();
+            entry["project"] = !isDatabase;
+            entry["size"] = size;
+            entry["modified"] = modified;
+            entry["walSize"] = walSize;
+            entry["walModified"] = walModified;
+
+            // Files untouched since the previous backup share its chunks without being read again
+            const QJsonObject previousEntry = previousFiles.value(outOfTree ? fileInfo.absoluteFilePath() : path);
+            const QJsonArray previousChunks = previousEntry.value("chunks").toArray();
+            const bool unchanged = !previousEntry.isEmpty()
+                                   && previousEntry.value("size").toInteger() == size && previousEntry.value("modified").toString() == modified
+                                   && previousEntry.value("walSize").toInteger() == walSize && previousEntry.value("walModified").toString() == walModified
+                                   && std::all_of(previousChunks.begin(), previousChunks.end(), [this](const QJsonValue &hash) {
+                                          return QFile::exists(ProjectBackupManager::chunkFilePath(mChunksDirectory, hash.toString()));
+                                      });
+
+            QJsonArray chunks;
+            if (unchanged)
+            {
+                chunks = previousChunks;
+                addProgress(isDatabase ? 2 * (size + walSize) : size);
+            }
+            else if (isDatabase)
+            {
+                const QString stagingDirectory = QFileInfo(mBackupPath).absolutePath() + "/" + sStagingDirectoryName;
+                const QString snapshotPath = stagingDirectory + "/" + QFileInfo(mBackupPath).fileName() + ".gpkg";
+                QDir().mkpath(stagingDirectory);
+
+                const qint64 snapshotWeight = size + walSize;
+                const bool stored = snapshotDatabase(file, snapshotPath, snapshotWeight, error) && storeChunks(snapshotPath, chunks, error);
+                const qint64 snapshotSize = QFileInfo(snapshotPath).size();
+                for (const QString &suffix : { QString(), QStringLiteral("-journal"), QStringLiteral("-wal"), QStringLiteral("-shm") })
+                    QFile::remove(snapshotPath + suffix);
+                if (!stored)
+                    return false;
+
+                // The snapshot size differs from the one of the database and its WAL
+                addProgress(snapshotWeight - snapshotSize);
+            }
+            else if (!storeChunks(file, chunks, error))
+            {
+                return false;
+            }
+
+            entry["chunks"] = chunks;
+            fileEntries << entry;
+        }
+
+        QJsonObject manifest;
+        manifest["version"] = 1;
+        manifest["project"] = QFileInfo(mProjectPath).absoluteFilePath();
+        manifest["created"] = QDateTime::currentDateTime().toString(Qt::ISODate);
+        manifest["files"] = fileEntries;
+
+        // The manifest is written last, a backup without one is incomplete
+        QSaveFile manifestFile(mBackupPath + "/" + sManifestFileName);
+        if (!manifestFile.open(QIODevice::WriteOnly) || manifestFile.write(QJsonDocument(manifest).toJson()) < 0 || !manifestFile.commit())
+        {
+            error = tr("Could not write backup manifest: %1").arg(mBackupPath);
+            return false;
+        }
+
+        return true;
+    }
+
+    //! Returns the file entries of the latest complete backup of the same project, by source path for files outside the project directory and by path otherwise
+    QMap<QString, QJsonObject> previousBackupFiles() const
+    {
+        QMap<QString, QJsonObject> files;
+        const QString projectName = QFileInfo(mProjectPath).baseName();
+        const QDir backupDir(QFileInfo(mBackupPath).absolutePath());
+        const QStringList backups = backupDir.entryList({ projectName + "_*" }, QDir::Dirs | QDir::NoDotAndDotDot, QDir::Time);
+        for (const QString &backup : backups)
+        {
+            const QJsonObject manifest = readManifest(backupDir.absoluteFilePath(backup));
+            if (manifest["project"].toString() != QFileInfo(mProjectPath).absoluteFilePath())
+                continue;
+
+            const QJsonArray entries = manifest["files"].toArray();
+            for (const QJsonValue &entry : entries)
+            {
+                const QJsonObject object = entry.toObject();
+                files.insert(object.contains("source") ? object["source"].toString() : object["path"].toString(), object);
+            }
+            break;
+        }
+        return files;
+    }
+
+    bool snapshotDatabase(const QString &path, const QString &snapshotPath, qint64 weight, QString &error)
+    {
+        QFile::remove(snapshotPath);
+
+        sqlite3_database_unique_ptr source;
+        sqlite3_database_unique_ptr snapshot;
+        if (source.open_v2(path, SQLITE_OPEN_READWRITE, nullptr) != SQLITE_OK)
+        {
+            error = tr("Could not open GPKG file %1: %2").arg(path, source.errorMessage());
+            return false;
+        }
+        if (snapshot.open_v2(snapshotPath, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE, nullptr) != SQLITE_OK)
+        {
+            error = tr("Could not create snapshot of GPKG file %1: %2").arg(path, snapshot.errorMessage());
+            return false;
+        }
+
+        // Pages changed by other connections during the backup make it restart, yielding a consistent snapshot
+        sqlite3_backup *backup = sqlite3_backup_init(snapshot.get(), "main", source.get(), "main");
+        if (!backup)
+        {
+            error = tr("Could not snapshot GPKG file %1: %2").arg(path, snapshot.errorMessage());
+            return false;
+        }
+
+        qint64 reported = 0;
+        int status = SQLITE_OK;
+        while (!*mCanceled)
+        {
+            status = sqlite3_backup_step(backup, sSnapshotStepPages);
+            const int pageCount = sqlite3_backup_pagecount(backup);
+            if (pageCount > 0)
+            {
+                const qint64 done = weight * (pageCount - sqlite3_backup_remaining(backup)) / pageCount;
+                addProgress(done - reported);
+                reported = done;
+            }
+
+            if (status == SQLITE_BUSY || status == SQLITE_LOCKED)
+                sqlite3_sleep(50);
+            else if (status != SQLITE_OK)
+                break;
+        }
+        sqlite3_backup_finish(backup);
+
+        if (*mCanceled)
+            return false;
+
+        addProgress(weight - reported);
+        if (status != SQLITE_DONE)
+        {
+            error = tr("Could not snapshot GPKG file %1: %2").arg(path, QString::fromUtf8(sqlite3_errstr(status)));
+            return false;
+        }
+        return true;
+    }
+
+    bool storeChunks(const QString &path, QJsonArray &chunks, QString &error)
+    {
+        QFile file(path);
+        if (!file.open(QIODevice::ReadOnly))
+        {
+            error = tr("Could not read file: %1").arg(path);
+            return false;
+        }
+
+        while (!file.atEnd())
+        {
+            if (*mCanceled)
+                return false;
+
+            const QByteArray data = file.read(ProjectBackupManager::ChunkSize);
+            const QString hash = QCryptographicHash::hash(data, QCryptographicHash::Sha256).toHex();
+            const QString chunkPath = ProjectBackupManager::chunkFilePath(mChunksDirectory, hash);
+            if (!QFile::exists(chunkPath))
+            {
+                QDir().mkpath(QFileInfo(chunkPath).absolutePath());
+                QSaveFile chunkFile(chunkPath);
+                if (!chunkFile.open(QIODevice::WriteOnly) || chunkFile.write(data) != data.size() || !chunkFile.commit())
+                {
+                    error = tr("Could not write backup chunk: %1").arg(chunkPath);
+                    return false;
+                }
+                mWrittenChunks << chunkPath;
+            }
+
+            chunks << hash;
+            addProgress(data.size());
+        }
+        return true;
+    }
+
+    void addProgress(qint64 bytes)
+    {
+        mProcessedBytes += bytes;
+        const int percent = mTotalBytes > 0 ? static_cast<int>(std::clamp<qint64>(mProcessedBytes * 100 / mTotalBytes, 0, 99)) : 0;
+        if (percent != mPercent)
+        {
+            mPercent = percent;
+            emit progress(mMessage, percent);
+        }
+    }
+
+    QString mProjectPath;
+    QStringList mGpkgFiles;
+    QString mBackupPath;
+    QString mChunksDirectory;
+    std::shared_ptr<std::atomic<bool>> mCanceled;
+
+    QStringList mWrittenChunks;
+    QString mMessage;
+    qint64 mTotalBytes = 0;
+    qint64 mProcessedBytes = 0;
+    int mPercent = -1;
+};
 
 ProjectBackupManager::ProjectBackupManager(QObject *parent)
     : QObject(parent)
@@ -20,74 +337,75 @@ ProjectBackupManager::ProjectBackupManager(QObject *parent)
     {
         dir.mkpath(mBackupDirectory);
     }
+
+    // Backups are created one at a time
+    mThreadPool.setMaxThreadCount(1);
+}
+
+ProjectBackupManager::~ProjectBackupManager()
+{
+    cancelBackup();
+    mThreadPool.waitForDone();
 }
 
 bool ProjectBackupManager::createBackup(const QString &projectPath, BackupMode mode)
 {
+    if (isBusy())
+    {
+        emit backupError(tr("A backup is already being created"));
+        return false;
+    }
+
     QFileInfo projectInfo(projectPath);
     if (!projectInfo.exists())
     {
         emit backupError(tr("Project file does not exist: %1").arg(projectPath));
         return false;
     }
-    
+
     // Create backup name with timestamp
     QString backupName = createBackupName(projectPath);
     QString backupPath = mBackupDirectory + "/" + backupName;
-    
-    // Create backup directory
-    QDir backupDir(backupPath);
-    if (!backupDir.exists() && !backupDir.mkpath("."))
-    {
-        emit backupError(tr("Could not create backup directory: %1").arg(backupPath));
-        return false;
-    }
 
-    // Always copy the project file
-    QString projectFileName = projectInfo.fileName();
-    QString destProjectPath = backupPath + "/" + projectFileName;
-    
+    const QStringList gpkgFiles = mode == ProjectAndGpkg ? findAssociatedGpkgFiles(projectPath) : QStringList();
+
+    mCanceled = std::make_shared<std::atomic<bool>>(false);
+    emit busyChanged();
+
+    BackupJob *job = new BackupJob(projectInfo.absoluteFilePath(), gpkgFiles, backupPath, mCanceled);
+    connect(job, &BackupJob::progress, this, &ProjectBackupManager::backupProgress, Qt::QueuedConnection);
+    connect(job, &BackupJob::finished, this, &ProjectBackupManager::onBackupFinished, Qt::QueuedConnection);
+
     emit backupProgress(tr("Copying project file..."), 0);
-    if (!copyFile(projectPath, destProjectPath))
+    mThreadPool.start(job);
+    return true;
+}
+
+void ProjectBackupManager::cancelBackup()
+{
+    if (mCanceled)
+        *mCanceled = true;
+}
+
+void ProjectBackupManager::onBackupFinished(const QString &backupPath, const QString &error)
+{
+    mCanceled.reset();
+    emit busyChanged();
+
+    if (mGarbagePending)
     {
-        emit backupError(tr("Failed to copy project file"));
-        return false;
+        mGarbagePending = false;
+        collectGarbage();
     }
 
-    // If mode is ProjectAndGpkg, also backup GPKG files
-    if (mode == ProjectAndGpkg)
+    if (!error.isEmpty())
     {
-        QStringList gpkgFiles = findAssociatedGpkgFiles(projectPath);
-        if (!gpkgFiles.isEmpty())
-        {
-            QString dataDir = backupPath + "/data";
-            if (!QDir().mkpath(dataDir))
-            {
-                emit backupError(tr("Could not create data directory for GPKG files"));
-                return false;
-            }
-
-            int total = gpkgFiles.size();
-            for (int i = 0; i < gpkgFiles.size(); ++i)
-            {
-                QString gpkgFile = gpkgFiles[i];
-                QFileInfo gpkgInfo(gpkgFile);
-                QString destGpkgPath = dataDir + "/" + gpkgInfo.fileName();
-                
-                emit backupProgress(tr("Copying GPKG file %1 of %2...").arg(i + 1).arg(total), (i * 100) / total);
-                
-                if (!copyFile(gpkgFile, destGpkgPath))
-                {
-                    emit backupError(tr("Failed to copy GPKG file: %1").arg(gpkgFile));
-                    return false;
-                }
-            }
-        }
+        emit backupError(error);
+        return;
     }
-    
+
     emit backupProgress(tr("Backup completed"), 100);
     emit backupCreated(backupPath);
-    return true;
 }
 
 bool ProjectBackupManager::restoreBackup(const QString &backupPath, const QString &destinationPath)
@@ -98,7 +416,12 @@ bool ProjectBackupManager::restoreBackup(const QString &backupPath, const QStrin
         emit backupError(tr("Backup directory does not exist: %1").arg(backupPath));
         return false;
     }
-    
+
+    const QJsonObject manifest = readManifest(backupPath);
+    if (!manifest.isEmpty())
+        return restoreManifest(backupPath, manifest, destinationPath);
+
+    // Backups created before the chunk store hold plain copies of the files
     QDir destDir(destinationPath);
     if (destDir.exists())
     {
@@ -109,21 +432,85 @@ bool ProjectBackupManager::restoreBackup(const QString &backupPath, const QStrin
             return false;
         }
     }
-    
+
     // Create destination directory
     if (!destDir.mkpath("."))
     {
         emit backupError(tr("Could not create destination directory: %1").arg(destinationPath));
         return false;
     }
-    
+
     // Copy backup to destination
     if (!copyDirectory(backupPath, destinationPath))
     {
         emit backupError(tr("Failed to restore backup files"));
         return false;
     }
-    
+
+    emit backupRestored(destinationPath);
+    return true;
+}
+
+bool ProjectBackupManager::restoreManifest(const QString &backupPath, const QJsonObject &manifest, const QString &destinationPath)
+{
+    const QString chunksDirectory = QFileInfo(backupPath).absolutePath() + "/" + sChunksDirectoryName;
+    const QFileInfo destinationInfo(destinationPath);
+    const bool isProjectFile = destinationInfo.isFile() || destinationInfo.suffix().compare("qgs", Qt::CaseInsensitive) == 0 || destinationInfo.suffix().compare("qgz", Qt::CaseInsensitive) == 0;
+    const QDir destDir(isProjectFile ? destinationInfo.absolutePath() : destinationInfo.absoluteFilePath());
+    if (!destDir.mkpath("."))
+    {
+        emit backupError(tr("Could not create destination directory: %1").arg(destDir.absolutePath()));
+        return false;
+    }
+
+    const QJsonArray entries = manifest["files"].toArray();
+    for (int i = 0; i < entries.size(); ++i)
+    {
+        const QJsonObject entry = entries.at(i).toObject();
+        const QString path = entry["path"].toString();
+        // Absolute paths of earlier manifests are restored under data/ like out of tree files are now stored
+        QString targetPath = QDir::cleanPath(destDir.absoluteFilePath(QFileInfo(path).isRelative() ? path : QStringLiteral("data/%1").arg(QFileInfo(path).fileName())));
+        if (entry["project"].toBool() && isProjectFile)
+            targetPath = destinationInfo.absoluteFilePath();
+        else if (!targetPath.startsWith(QDir::cleanPath(destDir.absolutePath()) + "/"))
+        {
+            emit backupError(tr("Backup file is outside of the destination: %1").arg(path));
+            return false;
+        }
+
+        emit backupProgress(tr("Restoring file %1 of %2...").arg(i + 1).arg(entries.size()), (i * 100) / entries.size());
+
+        QDir().mkpath(QFileInfo(targetPath).absolutePath());
+        QSaveFile file(targetPath);
+        if (!file.open(QIODevice::WriteOnly))
+        {
+            emit backupError(tr("Could not write file: %1").arg(targetPath));
+            return false;
+        }
+
+        const QJsonArray chunks = entry["chunks"].toArray();
+        for (const QJsonValue &hash : chunks)
+        {
+            QFile chunk(chunkFilePath(chunksDirectory, hash.toString()));
+            if (!chunk.open(QIODevice::ReadOnly) || file.write(chunk.readAll()) != chunk.size())
+            {
+                file.cancelWriting();
+                emit backupError(tr("Backup is missing data for file: %1").arg(path));
+                return false;
+            }
+        }
+
+        // A WAL left over from the replaced database would be applied on top of the restored one
+        QFile::remove(targetPath + "-wal");
+        QFile::remove(targetPath + "-shm");
+        if (!file.commit())
+        {
+            emit backupError(tr("Could not write file: %1").arg(targetPath));
+            return false;
+        }
+    }
+
+    emit backupProgress(tr("Restore completed"), 100);
     emit backupRestored(destinationPath);
     return true;
 }
@@ -139,7 +526,44 @@ QStringList ProjectBackupManager::listBackups(const QString &projectName)
 
 bool ProjectBackupManager::deleteBackup(const QString &backupPath)
 {
-    return removeDirectory(backupPath);
+    if (!removeDirectory(backupPath))
+        return false;
+
+    // Chunks stored by a backup being created are not referenced by a manifest yet
+    if (isBusy())
+        mGarbagePending = true;
+    else
+        collectGarbage();
+    return true;
+}
+
+QString ProjectBackupManager::chunkFilePath(const QString &chunksDirectory, const QString &hash)
+{
+    return QStringLiteral("%1/%2/%3").arg(chunksDirectory, hash.left(2), hash);
+}
+
+void ProjectBackupManager::collectGarbage() const
+{
+    QSet<QString> referencedChunks;
+    QDir backupDir(mBackupDirectory);
+    foreach(const QString &backup, backupDir.entryList(QDir::Dirs | QDir::NoDotAndDotDot))
+    {
+        const QJsonArray entries = readManifest(backupDir.absoluteFilePath(backup))["files"].toArray();
+        for (const QJsonValue &entry : entries)
+        {
+            const QJsonArray chunks = entry.toObject()["chunks"].toArray();
+            for (const QJsonValue &hash : chunks)
+                referencedChunks.insert(hash.toString());
+        }
+    }
+
+    QDirIterator it(mBackupDirectory + "/" + sChunksDirectoryName, QDir::Files, QDirIterator::Subdirectories);
+    while (it.hasNext())
+    {
+        it.next();
+        if (!referencedChunks.contains(it.fileName()))
+            QFile::remove(it.filePath());
+    }
 }
 
 QString ProjectBackupManager::createBackupName(const QString &projectPath) const
@@ -148,7 +572,11 @@ QString ProjectBackupManager::createBackupName(const QString &projectPath) const
     QString projectName = projectInfo.baseName();
     QString timestamp = QDateTime::currentDateTime().toString("yyyy-MM-dd_HH-mm-ss");
     
-    return QString("%1_%2").arg(projectName, timestamp);
+    // Backups created within the same second must not share a directory
+    QString backupName = QString("%1_%2").arg(projectName, timestamp);
+    for (int suffix = 2; QFileInfo::exists(mBackupDirectory + "/" + backupName); ++suffix)
+        backupName = QString("%1_%2_%3").arg(projectName, timestamp).arg(suffix);
+    return backupName;
 }
 
 bool ProjectBackupManager::copyDirectory(const QString &source, const QString &destination) const
@@ -216,15 +644,6 @@ bool ProjectBackupManager::removeDirectory(const QString &path) const
     return dir.rmdir(path);
 }
 
-bool ProjectBackupManager::copyFile(const QString &source, const QString &destination) const
-{
-    if (QFile::exists(destination))
-    {
-        QFile::remove(destination);
-    }
-    return QFile::copy(source, destination);
-}
-
 QStringList ProjectBackupManager::findAssociatedGpkgFiles(const QString &projectPath) const
 {
     QStringList gpkgFiles;
@@ -256,4 +675,6 @@ QStringList ProjectBackupManager::findAssociatedGpkgFiles(const QString &project
     }
     
     return gpkgFiles;
-} 
\ No newline at end of file
+} 
+
+#include "projectbackupmanager.moc"
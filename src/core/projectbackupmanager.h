@@ -5,11 +5,28 @@
 #include <QString>
 #include <QDateTime>
 #include <QDir>
+#include <QJsonObject>
+#include <QThreadPool>
 
+#include <atomic>
+#include <memory>
+
+/**
+ * Creates and restores backups of a project and its GeoPackage files.
+ *
+ * Backups are incremental: files are split into fixed size chunks stored once
+ * in a content-addressed chunk store shared by all backups, each backup only
+ * holding a manifest listing the chunks of its files. GeoPackages are snapshotted
+ * with the SQLite online backup API so that databases being edited are captured
+ * consistently, and files left untouched since the previous backup of a project
+ * reuse its chunks without being read again. Backups run on a worker thread.
+ */
 class ProjectBackupManager : public QObject
 {
     Q_OBJECT
-    
+
+    Q_PROPERTY(bool busy READ isBusy NOTIFY busyChanged)
+
 public:
     enum BackupMode {
         ProjectOnly,      // Only backup the project file
@@ -17,29 +34,62 @@ public:
     };
     Q_ENUM(BackupMode)
 
+    //! Size of the chunks files are split into, a multiple of every SQLite page size
+    static constexpr int ChunkSize = 256 * 1024;
+
     explicit ProjectBackupManager(QObject *parent = nullptr);
-    
+    ~ProjectBackupManager() override;
+
+    /**
+     * Starts creating a backup of the project at \a projectPath on a worker thread.
+     * Progress is reported through backupProgress(), completion through backupCreated()
+     * or backupError().
+     * \returns FALSE if the project doesn't exist or another backup is being created
+     */
     Q_INVOKABLE bool createBackup(const QString &projectPath, BackupMode mode = ProjectOnly);
+
+    //! Cancels the backup being created, chunks it stored so far are discarded
+    Q_INVOKABLE void cancelBackup();
+
+    /**
+     * Restores the backup at \a backupPath. If \a destinationPath is a project file, the project
+     * file is restored to it and its data next to it, otherwise everything is restored into the
+     * \a destinationPath directory.
+     */
     Q_INVOKABLE bool restoreBackup(const QString &backupPath, const QString &destinationPath);
     Q_INVOKABLE QStringList listBackups(const QString &projectName);
     Q_INVOKABLE bool deleteBackup(const QString &backupPath);
-    
+
+    //! Returns TRUE while a backup is being created
+    bool isBusy() const { return static_cast<bool>(mCanceled); }
+
     QString getBackupDirectory() const { return mBackupDirectory; }
     void setBackupDirectory(const QString &path) { mBackupDirectory = path; }
-    
+
+    //! Returns the path of the chunk with a given \a hash in the chunk store at \a chunksDirectory
+    static QString chunkFilePath(const QString &chunksDirectory, const QString &hash);
+
 private:
     QString mBackupDirectory;
     QString createBackupName(const QString &projectPath) const;
     bool copyDirectory(const QString &source, const QString &destination) const;
     bool removeDirectory(const QString &path) const;
     QStringList findAssociatedGpkgFiles(const QString &projectPath) const;
-    bool copyFile(const QString &source, const QString &destination) const;
-    
+    bool restoreManifest(const QString &backupPath, const QJsonObject &manifest, const QString &destinationPath);
+    void collectGarbage() const;
+    void onBackupFinished(const QString &backupPath, const QString &error);
+
+    QThreadPool mThreadPool;
+    //! Cancellation flag of the backup being created, null when idle
+    std::shared_ptr<std::atomic<bool>> mCanceled;
+    bool mGarbagePending = false;
+
 signals:
     void backupCreated(const QString &path);
     void backupRestored(const QString &path);
     void backupError(const QString &error);
     void backupProgress(const QString &message, int progress);
+    void busyChanged();
 };
 
-#endif // PROJECTBACKUPMANAGER_H 
\ No newline at end of file
+#endif // PROJECTBACKUPMANAGER_H
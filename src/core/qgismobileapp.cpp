@@ -54,8 +54,11 @@
 #include "expressionvariablemodel.h"
 #include "featurechecklistmodel.h"
 #include "featurehistory.h"
+#include "featurecountcache.h"
+#include "featuresearchindex.h"
 #include "featurelistextentcontroller.h"
 #include "featurelistmodel.h"
+#include "featurequeryjob.h"
 #include "featurelistmodelselection.h"
 #include "featuremodel.h"
 #include "featureutils.h"
@@ -72,6 +75,7 @@
 #include "layerresolver.h"
 #include "layertreemapcanvasbridge.h"
 #include "layertreemodel.h"
+#include "lazylayermanager.h"
 #include "layerutils.h"
 #include "legendimageprovider.h"
 #include "linepolygonshape.h"
@@ -81,12 +85,15 @@
 #include "maptoscreen.h"
 #include "messagelogmodel.h"
 #include "modelhelper.h"
+#include "municipalityutils.h"
 #include "navigation.h"
 #include "navigationmodel.h"
 #include "nearfieldreader.h"
+#include "offlinepackdownloader.h"
 #include "orderedrelationmodel.h"
 #include "parametizedimage.h"
 #include "permissions.h"
+#include "photopipeline.h"
 #include "platformutilities.h"
 #include "positioning.h"
 #include "positioningdevicemodel.h"
@@ -118,6 +125,7 @@
 #include "rubberbandshape.h"
 #include "scalebarmeasurement.h"
 #include "sensorlistmodel.h"
+#include "sigpachierarchyindex.h"
 #include "snappingresult.h"
 #include "snappingutils.h"
 #include "stringutils.h"
@@ -255,6 +263,7 @@ QgisMobileapp::QgisMobileapp( QgsApplication *app, QObject *parent )
   app->setPalette( palette );
 
   mMessageLogModel = new MessageLogModel( this );
+  mMessageLogModel->setLogFilePath( PlatformUtilities::instance()->systemLocalDataLocation( QStringLiteral( "logs" ) ) + QStringLiteral( "/messages.log" ) );
 
   QSettings settings;
   if ( PlatformUtilities::instance()->capabilities() & PlatformUtilities::AdjustBrightness )
@@ -316,8 +325,34 @@ QgisMobileapp::QgisMobileapp( QgsApplication *app, QObject *parent )
   mGpkgFlusher = std::make_unique<QgsGpkgFlusher>( mProject );
   mLayerObserver = std::make_unique<LayerObserver>( mProject );
   mFeatureHistory = std::make_unique<FeatureHistory>( mProject, mTrackingModel );
+  mFeatureSearchIndex = std::make_unique<FeatureSearchIndex>( mProject, mLayerObserver.get() );
+  mFeatureCountCache = std::make_unique<FeatureCountCache>( mProject, mLayerObserver.get() );
   mClipboardManager = std::make_unique<ClipboardManager>( this );
+  mLazyLayerManager = std::make_unique<LazyLayerManager>( mProject );
+
+  // Basemap tiles are read through a persistent store so that visited areas and
+  // downloaded offline packs keep rendering without network coverage
+  mTileStore = std::make_unique<TileStore>( PlatformUtilities::instance()->systemLocalDataLocation( QStringLiteral( "tilestore" ) ) + QStringLiteral( "/tiles.sqlite" ) );
+  const QStringList tileSources = {
+    QStringLiteral( "sigpac-hubcloud.es/mvt/" ),
+    QStringLiteral( "tile.openstreetmap.org/" ),
+    QStringLiteral( "www.google.cn/maps/vt" ),
+    QStringLiteral( "www.ign.es/wms-inspire/" ),
+    QStringLiteral( "ovc.catastro.meh.es/Cartografia/WMS/" ),
+    QStringLiteral( "wms.mapa.gob.es/sigpac/" ),
+    QStringLiteral( "www.juntadeandalucia.es/institutodeestadisticaycartografia/geoserver-ieca/bca/" ),
+    // Also keeps the capabilities of the lazily instantiated layers at hand across sessions
+    QStringLiteral( "sigpac-hubcloud.es/wms" ),
+    QStringLiteral( "wms.mapama.gob.es/sig/" ),
+    QStringLiteral( "wmts.mapama.gob.es/sig/" ),
+    QStringLiteral( "servicios.idee.es/wms-inspire/" ),
+  };
+  for ( const QString &tileSource : tileSources )
+    mTileStore->addSource( tileSource );
+  mTileStore->install();
+
   mFlatLayerTree = new FlatLayerTreeModel( mProject->layerTreeRoot(), mProject, this );
+  mFlatLayerTree->setFeatureCountCache( mFeatureCountCache.get() );
   mLegendImageProvider = new LegendImageProvider( mFlatLayerTree->layerTreeModel() );
   mLocalFilesImageProvider = new LocalFilesImageProvider();
   mProjectsImageProvider = new ProjectsImageProvider();
@@ -360,6 +395,9 @@ QgisMobileapp::QgisMobileapp( QgsApplication *app, QObject *parent )
   mMapCanvas->mapSettings()->setProject( mProject );
   mBookmarkModel->setMapSettings( mMapCanvas->mapSettings() );
 
+  if ( LocatorModelSuperBridge *locatorBridge = rootObjects().first()->findChild<LocatorModelSuperBridge *>( QStringLiteral( "locatorBridge" ) ) )
+    locatorBridge->setFeatureSearchIndex( mFeatureSearchIndex.get() );
+
   mFlatLayerTree->layerTreeModel()->setLegendMapViewData( mMapCanvas->mapSettings()->outputDpi() * mMapCanvas->mapSettings()->mapSettings().mapUnitsPerPixel(),
                                                           static_cast<int>( std::round( mMapCanvas->mapSettings()->outputDpi() ) ), mMapCanvas->mapSettings()->mapSettings().scale() );
 
@@ -472,7 +510,10 @@ void QgisMobileapp::initDeclarative( QQmlEngine *engine )
   qmlRegisterType<FeatureListModel>( "org.qfield", 1, 0, "FeatureListModel" );
   qmlRegisterType<FeatureListModelSelection>( "org.qfield", 1, 0, "FeatureListModelSelection" );
   qmlRegisterType<FeatureListExtentController>( "org.qfield", 1, 0, "FeaturelistExtentController" );
+  qmlRegisterUncreatableType<FeatureQueryJob>( "org.qfield", 1, 0, "FeatureQueryJob", "FeatureQueryJob is only provided by the FeatureUtils asynchronous functions" );
   qmlRegisterType<Geometry>( "org.qfield", 1, 0, "Geometry" );
+  qmlRegisterType<OfflinePackDownloader>( "org.qfield", 1, 0, "OfflinePackDownloader" );
+  qmlRegisterUncreatableType<TileStore>( "org.qfield", 1, 0, "TileStore", "The TileStore is provided by the application" );
   qmlRegisterType<ModelHelper>( "org.qfield", 1, 0, "ModelHelper" );
   qmlRegisterType<RubberbandShape>( "org.qfield", 1, 0, "RubberbandShape" );
   qmlRegisterType<RubberbandModel>( "org.qfield", 1, 0, "RubberbandModel" );
@@ -484,6 +525,7 @@ void QgisMobileapp::initDeclarative( QQmlEngine *engine )
   qmlRegisterUncreatableType<GridAnnotation>( "org.qfield", 1, 0, "GridAnnotation", "" );
 
   qmlRegisterType<Geofencer>( "org.qfield", 1, 0, "Geofencer" );
+  qmlRegisterType<SigpacHierarchyIndex>( "org.qfield", 1, 0, "SigpacHierarchyIndex" );
   qmlRegisterType<DigitizingLogger>( "org.qfield", 1, 0, "DigitizingLogger" );
   qmlRegisterType<AttributeFormModel>( "org.qfield", 1, 0, "AttributeFormModel" );
   qmlRegisterType<FeatureModel>( "org.qfield", 1, 0, "FeatureModel" );
@@ -496,6 +538,7 @@ void QgisMobileapp::initDeclarative( QQmlEngine *engine )
   qmlRegisterType<DistanceArea>( "org.qfield", 1, 0, "DistanceArea" );
   qmlRegisterType<FocusStack>( "org.qfield", 1, 0, "FocusStack" );
   qmlRegisterType<ParametizedImage>( "org.qfield", 1, 0, "ParametizedImage" );
+  qmlRegisterType<PhotoPipeline>( "org.qfield", 1, 0, "PhotoPipeline" );
   qmlRegisterType<PrintLayoutListModel>( "org.qfield", 1, 0, "PrintLayoutListModel" );
   qmlRegisterType<VertexModel>( "org.qfield", 1, 0, "VertexModel" );
   qmlRegisterType<MapToScreen>( "org.qfield", 1, 0, "MapToScreen" );
@@ -564,6 +607,7 @@ void QgisMobileapp::initDeclarative( QQmlEngine *engine )
   REGISTER_SINGLETON( "org.qfield", FeatureUtils, "FeatureUtils" );
   REGISTER_SINGLETON( "org.qfield", FileUtils, "FileUtils" );
   REGISTER_SINGLETON( "org.qfield", LayerUtils, "LayerUtils" );
+  REGISTER_SINGLETON( "org.qfield", MunicipalityUtils, "MunicipalityUtils" );
   REGISTER_SINGLETON( "org.qfield", RelationUtils, "RelationUtils" );
   REGISTER_SINGLETON( "org.qfield", StringUtils, "StringUtils" );
   REGISTER_SINGLETON( "org.qfield", UrlUtils, "UrlUtils" );
@@ -579,6 +623,7 @@ void QgisMobileapp::initDeclarative( QQmlEngine *engine )
   qmlRegisterUncreatableType<TrackingModel>( "org.qfield", 1, 0, "TrackingModel", "The TrackingModel is available as context property `trackingModel`." );
   qmlRegisterUncreatableType<QgsGpkgFlusher>( "org.qfield", 1, 0, "QgsGpkgFlusher", "The gpkgFlusher is available as context property `gpkgFlusher`" );
   qmlRegisterUncreatableType<LayerObserver>( "org.qfield", 1, 0, "LayerObserver", "" );
+  qmlRegisterUncreatableType<FeatureSearchIndex>( "org.qfield", 1, 0, "FeatureSearchIndex", "The FeatureSearchIndex is available as context property `featureSearchIndex`." );
   qmlRegisterUncreatableType<DeltaFileWrapper>( "org.qfield", 1, 0, "DeltaFileWrapper", "" );
   qmlRegisterUncreatableType<BookmarkModel>( "org.qfield", 1, 0, "BookmarkModel", "The BookmarkModel is available as context property `bookmarkModel`" );
   qmlRegisterUncreatableType<MessageLogModel>( "org.qfield", 1, 0, "MessageLogModel", "The MessageLogModel is available as context property `messageLogModel`." );
@@ -622,7 +667,9 @@ void QgisMobileapp::registerGlobalVariables()
   rootContext()->setContextProperty( "gpkgFlusher", mGpkgFlusher.get() );
   rootContext()->setContextProperty( "layerObserver", mLayerObserver.get() );
   rootContext()->setContextProperty( "featureHistory", mFeatureHistory.get() );
+  rootContext()->setContextProperty( "featureSearchIndex", mFeatureSearchIndex.get() );
   rootContext()->setContextProperty( "clipboardManager", mClipboardManager.get() );
+  rootContext()->setContextProperty( "tileStore", mTileStore.get() );
   rootContext()->setContextProperty( "messageLogModel", mMessageLogModel );
   rootContext()->setContextProperty( "drawingTemplateModel", mDrawingTemplateModel );
   rootContext()->setContextProperty( "qfieldAuthRequestHandler", mAuthRequestHandler );
@@ -1163,58 +1210,9 @@ void QgisMobileapp::readProjectFile()
   }
 
   // Add all the required basemaps to every project, regardless of whether it's a project file or a datasheet
-  // Create the basemap layers
-  QgsRasterLayer *osmLayer = new QgsRasterLayer( QStringLiteral( "type=xyz&tilePixelRatio=1&url=https://tile.openstreetmap.org/%7Bz%7D/%7Bx%7D/%7By%7D.png&zmax=19&zmin=0&crs=EPSG3857" ), QStringLiteral( "OpenStreetMap" ), QLatin1String( "wms" ) );
-  
-  // Only create Google Satellite if we're not skipping hardcoded layers
-  QgsRasterLayer *satelliteLayer = nullptr;
-  if (!mSkipHardcodedLayers) {
-    satelliteLayer = new QgsRasterLayer( QStringLiteral( "crs=EPSG:3857&format&type=xyz&url=http://www.google.cn/maps/vt?lyrs=s@189%26gl=cn%26x%3D{x}%26y%3D{y}%26z%3D{z}&zmax=21&zmin=0" ), QStringLiteral( "Google Satellite" ), QLatin1String( "wms" ) );
-  } else {
-    QgsMessageLog::logMessage(
-      QStringLiteral("Skipping creation of Google Satellite layer due to skipHardcodedLayers flag"),
-      QStringLiteral("SIGPACGO"),
-      Qgis::Info
-    );
-  }
-  
-  // Add IGN (Instituto Geográfico Nacional) map
-  QgsRasterLayer *ignLayer = new QgsRasterLayer(
-      QStringLiteral( "contextualWMSLegend=0&crs=EPSG:4326&dpiMode=7&featureCount=10&format=image/png&layers=mtn_rasterizado&styles&tilePixelRatio=0&url=https://www.ign.es/wms-inspire/mapa-raster" ),
-      QStringLiteral( "Esp IGN 1:25.000" ),
-      QLatin1String( "wms" ) );
-  
-  QgsRasterLayer *catastroLayer = new QgsRasterLayer(
-      QStringLiteral( "contextualWMSLegend=1&crs=EPSG:4326&dpiMode=7&featureCount=10&format=image/png&layers=Catastro&styles=Default&tilePixelRatio=0&url=http://ovc.catastro.meh.es/Cartografia/WMS/ServidorWMS.aspx" ),
-      QStringLiteral( "Catastro" ),
-      QLatin1String( "wms" ) );
-  
-  // Add Junta de Andalucía BCA layer (renamed to Andalucía 1:10.000)
-  QgsRasterLayer *bcaLayer = new QgsRasterLayer(
-      QStringLiteral( "contextualWMSLegend=0&crs=EPSG:4326&dpiMode=7&featureCount=10&format=image/png&layers=00_BCA&styles=default-style-00_BCA&tilePixelRatio=0&url=http://www.juntadeandalucia.es/institutodeestadisticaycartografia/geoserver-ieca/bca/wms" ),
-      QStringLiteral( "Andalucía 1:10.000" ),
-      QLatin1String( "wms" ) );
-  
-  // Add Recintos SIGPAC FEGA layer
-  QgsRasterLayer *sigpacLayer = nullptr;
-  if (!mSkipHardcodedLayers) {
-    sigpacLayer = new QgsRasterLayer(
-        QStringLiteral( "contextualWMSLegend=1&crs=EPSG:4326&dpiMode=7&featureCount=10&format=image/png&layers=AU.Sigpac:recinto&styles=recinto&tilePixelRatio=0&url=https://wms.mapa.gob.es/sigpac/wms" ),
-        QStringLiteral( "Recintos SIGPAC FEGA" ),
-        QLatin1String( "wms" ) );
-  } else {
-    QgsMessageLog::logMessage(
-      QStringLiteral("Skipping creation of Recintos SIGPAC FEGA layer due to skipHardcodedLayers flag"),
-      QStringLiteral("SIGPACGO"),
-      Qgis::Info
-    );
-  }
-  
-  // Add flood risk WMS layer
-  QgsRasterLayer *floodRiskLayer = new QgsRasterLayer(
-      QStringLiteral( "contextualWMSLegend=1&crs=EPSG:3857&dpiMode=7&featureCount=10&format=image/png&layers=NZ.RiskZone&styles&tilePixelRatio=0&url=https://wms.mapama.gob.es/sig/Agua/Riesgo/RiesgoAct_100/wms.aspx" ),
-      QStringLiteral( "Riesgo inundación T100" ),
-      QLatin1String( "wms" ) );
+  // Remote layers are added as placeholders, their data providers are only created once they are
+  // made visible so that opening a project does not wait on the capabilities of every remote service
+  mLazyLayerManager->setPaused( true );
   
   // Create layer groups in the desired order - Data Collection first, then Sentinel, then Spain GIS Services, then Utils, then Basemaps
   // COMPLETELY DISABLED: Data Collection group is not needed and causes issues
@@ -1507,25 +1505,12 @@ void QgisMobileapp::readProjectFile()
         ndviUrl += scriptParams;
       }
       
-      QgsRasterLayer *ndviLayer = new QgsRasterLayer(
-          ndviUrl,
-          QStringLiteral("Sentinel %1").arg(ndviLayerId),
-          QLatin1String("wms"));
+      QgsMapLayer *ndviLayer = mLazyLayerManager->addLayer( sentinelGroup, LazyLayerManager::LayerType::Raster, ndviUrl, QStringLiteral("Sentinel %1").arg(ndviLayerId) );
       
-      if (ndviLayer->isValid())
-      {
-        mProject->addMapLayer(ndviLayer, false);
-        sentinelGroup->addLayer(ndviLayer);
-        
-        // Set layer visibility based on style
-        QgsLayerTreeLayer* treeLayer = sentinelGroup->findLayer(ndviLayer->id());
-        if (treeLayer) {
-          treeLayer->setItemVisibilityChecked(ndviStyle != "OFF");
-        }
-      }
-      else
-      {
-        delete ndviLayer;
+      // Set layer visibility based on style
+      QgsLayerTreeLayer* treeLayer = sentinelGroup->findLayer(ndviLayer->id());
+      if (treeLayer) {
+        treeLayer->setItemVisibilityChecked(ndviStyle != "OFF");
       }
     }
     
@@ -1561,25 +1546,12 @@ void QgisMobileapp::readProjectFile()
         falseColorUrl += scriptParams;
       }
       
-      QgsRasterLayer *falseColorLayer = new QgsRasterLayer(
-          falseColorUrl,
-          QStringLiteral("Sentinel %1").arg(falseColorLayerId),
-          QLatin1String("wms"));
+      QgsMapLayer *falseColorLayer = mLazyLayerManager->addLayer( sentinelGroup, LazyLayerManager::LayerType::Raster, falseColorUrl, QStringLiteral("Sentinel %1").arg(falseColorLayerId) );
       
-      if (falseColorLayer->isValid())
-      {
-        mProject->addMapLayer(falseColorLayer, false);
-        sentinelGroup->addLayer(falseColorLayer);
-        
-        // Set layer visibility based on style
-        QgsLayerTreeLayer* treeLayer = sentinelGroup->findLayer(falseColorLayer->id());
-        if (treeLayer) {
-          treeLayer->setItemVisibilityChecked(falseColorStyle != "OFF");
-        }
-      }
-      else
-      {
-        delete falseColorLayer;
+      // Set layer visibility based on style
+      QgsLayerTreeLayer* treeLayer = sentinelGroup->findLayer(falseColorLayer->id());
+      if (treeLayer) {
+        treeLayer->setItemVisibilityChecked(falseColorStyle != "OFF");
       }
     }
     
@@ -1615,25 +1587,12 @@ void QgisMobileapp::readProjectFile()
         trueColorUrl += scriptParams;
       }
       
-      QgsRasterLayer *trueColorLayer = new QgsRasterLayer(
-          trueColorUrl,
-          QStringLiteral("Sentinel %1").arg(trueColorLayerId),
-          QLatin1String("wms"));
+      QgsMapLayer *trueColorLayer = mLazyLayerManager->addLayer( sentinelGroup, LazyLayerManager::LayerType::Raster, trueColorUrl, QStringLiteral("Sentinel %1").arg(trueColorLayerId) );
       
-      if (trueColorLayer->isValid())
-      {
-        mProject->addMapLayer(trueColorLayer, false);
-        sentinelGroup->addLayer(trueColorLayer);
-        
-        // Set layer visibility based on style
-        QgsLayerTreeLayer* treeLayer = sentinelGroup->findLayer(trueColorLayer->id());
-        if (treeLayer) {
-          treeLayer->setItemVisibilityChecked(trueColorStyle != "OFF");
-        }
-      }
-      else
-      {
-        delete trueColorLayer;
+      // Set layer visibility based on style
+      QgsLayerTreeLayer* treeLayer = sentinelGroup->findLayer(trueColorLayer->id());
+      if (treeLayer) {
+        treeLayer->setItemVisibilityChecked(trueColorStyle != "OFF");
       }
     }
     
@@ -1667,25 +1626,12 @@ void QgisMobileapp::readProjectFile()
         custom1LayerUrl += bboxParams;
       }
       
-      QgsRasterLayer *custom1Layer = new QgsRasterLayer(
-          custom1LayerUrl,
-          QStringLiteral("Sentinel %1").arg(custom1LayerId),
-          QLatin1String("wms"));
+      QgsMapLayer *custom1Layer = mLazyLayerManager->addLayer( sentinelGroup, LazyLayerManager::LayerType::Raster, custom1LayerUrl, QStringLiteral("Sentinel %1").arg(custom1LayerId) );
       
-      if (custom1Layer->isValid())
-      {
-        mProject->addMapLayer(custom1Layer, false);
-        sentinelGroup->addLayer(custom1Layer);
-        
-        // Set layer visibility based on style
-        QgsLayerTreeLayer* treeLayer = sentinelGroup->findLayer(custom1Layer->id());
-        if (treeLayer) {
-          treeLayer->setItemVisibilityChecked(custom1Style != "OFF");
-        }
-      }
-      else
-      {
-        delete custom1Layer;
+      // Set layer visibility based on style
+      QgsLayerTreeLayer* treeLayer = sentinelGroup->findLayer(custom1Layer->id());
+      if (treeLayer) {
+        treeLayer->setItemVisibilityChecked(custom1Style != "OFF");
       }
     }
     
@@ -1717,25 +1663,12 @@ void QgisMobileapp::readProjectFile()
         custom2LayerUrl += bboxParams;
       }
       
-      QgsRasterLayer *custom2Layer = new QgsRasterLayer(
-          custom2LayerUrl,
-          QStringLiteral("Sentinel %1").arg(custom2LayerId),
-          QLatin1String("wms"));
+      QgsMapLayer *custom2Layer = mLazyLayerManager->addLayer( sentinelGroup, LazyLayerManager::LayerType::Raster, custom2LayerUrl, QStringLiteral("Sentinel %1").arg(custom2LayerId) );
       
-      if (custom2Layer->isValid())
-      {
-        mProject->addMapLayer(custom2Layer, false);
-        sentinelGroup->addLayer(custom2Layer);
-        
-        // Set layer visibility based on style
-        QgsLayerTreeLayer* treeLayer = sentinelGroup->findLayer(custom2Layer->id());
-        if (treeLayer) {
-          treeLayer->setItemVisibilityChecked(custom2Style != "OFF");
-        }
-      }
-      else
-      {
-        delete custom2Layer;
+      // Set layer visibility based on style
+      QgsLayerTreeLayer* treeLayer = sentinelGroup->findLayer(custom2Layer->id());
+      if (treeLayer) {
+        treeLayer->setItemVisibilityChecked(custom2Style != "OFF");
       }
     }
     
@@ -1746,27 +1679,31 @@ void QgisMobileapp::readProjectFile()
   // Now create the basemaps group after Sentinel group
   QgsLayerTreeGroup *basemapsGroup = mProject->layerTreeRoot()->addGroup("Mapas Base");
   
-  // Add basemap layers to the project and to the Basemaps group in the requested order
-  mProject->addMapLayer(ignLayer, false);
-  mProject->addMapLayer(bcaLayer, false);
-  mProject->addMapLayer(satelliteLayer, false);
-  mProject->addMapLayer(osmLayer, false);
-  basemapsGroup->addLayer(ignLayer);
-  basemapsGroup->addLayer(bcaLayer);
-  basemapsGroup->addLayer(satelliteLayer);
-  basemapsGroup->addLayer(osmLayer);
-  
-  // Create and add the cultivo layer as the first layer in Spain GIS Services
-  QgsVectorTileLayer *cultivoLayer = new QgsVectorTileLayer(
-      QStringLiteral( "type=xyz&url=https://sigpac-hubcloud.es/mvt/cultivo_declarado@3857@pbf/%7Bz%7D/%7Bx%7D/%7By%7D.pbf&zmax=14&zmin=0&http-header:referer=" ),
-      QStringLiteral( "cultivos declarados" ) );
-  
-  // Create and add TeselaRECINTOS FEGA layer
-  QgsVectorTileLayer *teselaRecintosLayer = nullptr;
+  // Add basemap layers to the Basemaps group in the requested order, starting with the IGN (Instituto Geográfico Nacional) map
+  mLazyLayerManager->addLayer( basemapsGroup, LazyLayerManager::LayerType::Raster, QStringLiteral( "contextualWMSLegend=0&crs=EPSG:4326&dpiMode=7&featureCount=10&format=image/png&layers=mtn_rasterizado&styles&tilePixelRatio=0&url=https://www.ign.es/wms-inspire/mapa-raster" ), QStringLiteral( "Esp IGN 1:25.000" ) );
+  
+  // Add Junta de Andalucía BCA layer (renamed to Andalucía 1:10.000)
+  mLazyLayerManager->addLayer( basemapsGroup, LazyLayerManager::LayerType::Raster, QStringLiteral( "contextualWMSLegend=0&crs=EPSG:4326&dpiMode=7&featureCount=10&format=image/png&layers=00_BCA&styles=default-style-00_BCA&tilePixelRatio=0&url=http://www.juntadeandalucia.es/institutodeestadisticaycartografia/geoserver-ieca/bca/wms" ), QStringLiteral( "Andalucía 1:10.000" ) );
+  
+  // Only create Google Satellite if we're not skipping hardcoded layers
+  QgsMapLayer *satelliteLayer = nullptr;
+  if (!mSkipHardcodedLayers) {
+    satelliteLayer = mLazyLayerManager->addLayer( basemapsGroup, LazyLayerManager::LayerType::Raster, QStringLiteral( "crs=EPSG:3857&format&type=xyz&url=http://www.google.cn/maps/vt?lyrs=s@189%26gl=cn%26x%3D{x}%26y%3D{y}%26z%3D{z}&zmax=21&zmin=0" ), QStringLiteral( "Google Satellite" ) );
+  } else {
+    QgsMessageLog::logMessage(
+      QStringLiteral("Skipping creation of Google Satellite layer due to skipHardcodedLayers flag"),
+      QStringLiteral("SIGPACGO"),
+      Qgis::Info
+    );
+  }
+  
+  // Add OpenStreetMap layer
+  mLazyLayerManager->addLayer( basemapsGroup, LazyLayerManager::LayerType::Raster, QStringLiteral( "type=xyz&tilePixelRatio=1&url=https://tile.openstreetmap.org/%7Bz%7D/%7Bx%7D/%7By%7D.png&zmax=19&zmin=0&crs=EPSG3857" ), QStringLiteral( "OpenStreetMap" ) );
+  
+  // Create and add TeselaRECINTOS FEGA layer to the Spain GIS VectorTiles group
+  QgsMapLayer *teselaRecintosLayer = nullptr;
   if (!mSkipHardcodedLayers) {
-    teselaRecintosLayer = new QgsVectorTileLayer(
-        QStringLiteral( "type=xyz&url=https://sigpac-hubcloud.es/mvt/recinto@3857@pbf/%7Bz%7D/%7Bx%7D/%7By%7D.pbf&zmax=14&zmin=0&http-header:referer=" ),
-        QStringLiteral( "TeselaRECINTOS FEGA" ) );
+    teselaRecintosLayer = mLazyLayerManager->addLayer( spainGisVectorTilesGroup, LazyLayerManager::LayerType::VectorTile, QStringLiteral( "type=xyz&url=https://sigpac-hubcloud.es/mvt/recinto@3857@pbf/%7Bz%7D/%7Bx%7D/%7By%7D.pbf&zmax=14&zmin=0&http-header:referer=" ), QStringLiteral( "TeselaRECINTOS FEGA" ) );
   } else {
     QgsMessageLog::logMessage(
       QStringLiteral("Skipping creation of TeselaRECINTOS FEGA layer due to skipHardcodedLayers flag"),
@@ -1775,131 +1712,44 @@ void QgisMobileapp::readProjectFile()
     );
   }
   
-  // Add vector tile layers to the project and to the Spain GIS VectorTiles group
-  mProject->addMapLayer(cultivoLayer, false);
+  // Create and add the cultivo layer
+  mLazyLayerManager->addLayer( spainGisVectorTilesGroup, LazyLayerManager::LayerType::VectorTile, QStringLiteral( "type=xyz&url=https://sigpac-hubcloud.es/mvt/cultivo_declarado@3857@pbf/%7Bz%7D/%7Bx%7D/%7By%7D.pbf&zmax=14&zmin=0&http-header:referer=" ), QStringLiteral( "cultivos declarados" ) );
   
-  // Only add TeselaRECINTOS if it exists
-  if (teselaRecintosLayer) {
-    mProject->addMapLayer(teselaRecintosLayer, false);
-    spainGisVectorTilesGroup->addLayer(teselaRecintosLayer);
+  // Add Recintos SIGPAC FEGA and Catastro layers to the Spain GIS Base Layers group
+  QgsMapLayer *sigpacLayer = nullptr;
+  if (!mSkipHardcodedLayers) {
+    sigpacLayer = mLazyLayerManager->addLayer( spainGisBaseLayersGroup, LazyLayerManager::LayerType::Raster, QStringLiteral( "contextualWMSLegend=1&crs=EPSG:4326&dpiMode=7&featureCount=10&format=image/png&layers=AU.Sigpac:recinto&styles=recinto&tilePixelRatio=0&url=https://wms.mapa.gob.es/sigpac/wms" ), QStringLiteral( "Recintos SIGPAC FEGA" ) );
+  } else {
+    QgsMessageLog::logMessage(
+      QStringLiteral("Skipping creation of Recintos SIGPAC FEGA layer due to skipHardcodedLayers flag"),
+      QStringLiteral("SIGPACGO"),
+      Qgis::Info
+    );
   }
   
-  spainGisVectorTilesGroup->addLayer(cultivoLayer);
+  mLazyLayerManager->addLayer( spainGisBaseLayersGroup, LazyLayerManager::LayerType::Raster, QStringLiteral( "contextualWMSLegend=1&crs=EPSG:4326&dpiMode=7&featureCount=10&format=image/png&layers=Catastro&styles=Default&tilePixelRatio=0&url=http://ovc.catastro.meh.es/Cartografia/WMS/ServidorWMS.aspx" ), QStringLiteral( "Catastro" ) );
   
-  // Add Spain GIS Services layers to the project and to the Spain GIS Services group
-  // Only add SIGPAC layer if it exists
-  if (sigpacLayer) {
-    mProject->addMapLayer(sigpacLayer, false);
-    spainGisBaseLayersGroup->addLayer(sigpacLayer);
-  }
-  
-  mProject->addMapLayer(catastroLayer, false);
-  spainGisBaseLayersGroup->addLayer(catastroLayer);
-  
-  // Create and add the Zonas Vul Nitratos 2023 layer
-  QgsRasterLayer *zonasVulLayer = new QgsRasterLayer(
-      QStringLiteral( "contextualWMSLegend=1&crs=EPSG:3857&dpiMode=7&featureCount=10&format=image/png&layers=AM.NitrateVulnerableZone&styles&tilePixelRatio=0&url=https://wms.mapama.gob.es/sig/agua/ZonasVulnerables/2023/wms.aspx" ),
-      QStringLiteral( "Zonas Vul Nitratos 2023" ),
-      QLatin1String( "wms" ) );
-  
-  // Create and add IGN WMS layers
-  QgsRasterLayer *puntosAcotadosLayer = new QgsRasterLayer(
-      QStringLiteral( "contextualWMSLegend=1&crs=EPSG:4258&dpiMode=7&featureCount=10&format=image/png&layers=EL.SpotElevation&styles=puntosacotados&tilePixelRatio=0&url=https://servicios.idee.es/wms-inspire/mdt" ),
-      QStringLiteral( "IGN: puntos acotados" ),
-      QLatin1String( "wms" ) );
-      
-  QgsRasterLayer *curvasNivelLayer = new QgsRasterLayer(
-      QStringLiteral( "contextualWMSLegend=1&crs=EPSG:4258&dpiMode=7&featureCount=10&format=image/png&layers=EL.ContourLine&styles=curvasnivel&tilePixelRatio=0&url=https://servicios.idee.es/wms-inspire/mdt" ),
-      QStringLiteral( "Curvas de nivel" ),
-      QLatin1String( "wms" ) );
-      
-  QgsRasterLayer *modeloDigitalTerrenoLayer = new QgsRasterLayer(
-      QStringLiteral( "contextualWMSLegend=1&crs=EPSG:4258&dpiMode=7&featureCount=10&format=image/png&layers=EL.ElevationGridCoverage&styles=EL.ElevationGridCoverage.Default&tilePixelRatio=0&url=https://servicios.idee.es/wms-inspire/mdt" ),
-      QStringLiteral( "Modelo digital terreno" ),
-      QLatin1String( "wms" ) );
-      
-  QgsRasterLayer *hidrografiaLayer = new QgsRasterLayer(
-      QStringLiteral( "contextualWMSLegend=1&crs=EPSG:4258&dpiMode=7&featureCount=10&format=image/png&tilePixelRatio=0&url=https://servicios.idee.es/wms-inspire/hidrografia&layers=HY.PhysicalWaters.HydroPointOfInterest&layers=HY.PhysicalWaters.ManMadeObject&layers=HY.PhysicalWaters.LandWaterBoundary&layers=HY.Network&layers=HY.PhysicalWaters.Waterbodies&layers=HY.PhysicalWaters.Wetland&layers=HY.PhysicalWaters.Catchments&styles=&styles=&styles=&styles=&styles=&styles=&styles=" ),
-      QStringLiteral( "Hidrografía España" ),
-      QLatin1String( "wms" ) );
-      
-  // Create and add climate WMS layers
-  QgsRasterLayer *etpMediaAnualLayer = new QgsRasterLayer(
-      QStringLiteral( "contextualWMSLegend=1&crs=EPSG:4230&dpiMode=7&featureCount=10&format=image/png&layers=Evapotranspiración&styles=default&tilePixelRatio=0&url=https://wms.mapama.gob.es/sig/Agricultura/CaractAgroClimaticas/wms.aspx" ),
-      QStringLiteral( "ETP media anual" ),
-      QLatin1String( "wms" ) );
-      
-  QgsRasterLayer *temperaturaMaximaLayer = new QgsRasterLayer(
-      QStringLiteral( "contextualWMSLegend=1&crs=EPSG:4230&dpiMode=7&featureCount=10&format=image/png&layers=Temperatura máxima&styles&tilePixelRatio=0&url=https://wms.mapama.gob.es/sig/Agricultura/CaractAgroClimaticas/wms.aspx" ),
-      QStringLiteral( "Temperatura máxima" ),
-      QLatin1String( "wms" ) );
-      
-  QgsRasterLayer *temperaturaMediaLayer = new QgsRasterLayer(
-      QStringLiteral( "contextualWMSLegend=1&crs=EPSG:4230&dpiMode=7&featureCount=10&format=image/png&layers=Temperatura media anual&styles&tilePixelRatio=0&url=https://wms.mapama.gob.es/sig/Agricultura/CaractAgroClimaticas/wms.aspx" ),
-      QStringLiteral( "Temperatura media" ),
-      QLatin1String( "wms" ) );
-      
-  QgsRasterLayer *temperaturaMinimaLayer = new QgsRasterLayer(
-      QStringLiteral( "contextualWMSLegend=1&crs=EPSG:4230&dpiMode=7&featureCount=10&format=image/png&layers=Temperatura mínima&styles&tilePixelRatio=0&url=https://wms.mapama.gob.es/sig/Agricultura/CaractAgroClimaticas/wms.aspx" ),
-      QStringLiteral( "Temperatura mínima" ),
-      QLatin1String( "wms" ) );
-      
-  QgsRasterLayer *clasificacionClimaticaLayer = new QgsRasterLayer(
-      QStringLiteral( "contextualWMSLegend=1&crs=EPSG:4230&dpiMode=7&featureCount=10&format=image/png&layers=Clasificación climáticos&styles=default&tilePixelRatio=0&url=https://wms.mapama.gob.es/sig/Agricultura/CaractAgroClimaticas/wms.aspx" ),
-      QStringLiteral( "Clasif. clim J. Papadakis" ),
-      QLatin1String( "wms" ) );
-      
-  QgsRasterLayer *necesidadesRiegoLayer = new QgsRasterLayer(
-      QStringLiteral( "allowTemporalUpdates=true&contextualWMSLegend=1&crs=EPSG:4326&dpiMode=7&featureCount=10&format=image/png&layers=necesidades_riego&styles&temporalSource=provider&tilePixelRatio=0&timeDimensionExtent=2014-01-01T00:00:00.000Z/2023-01-01T00:00:00.000Z/P1Y&type=wmst&url=https://wmts.mapama.gob.es/sig/desarrollorural/necesidades_riego/ows" ),
-      QStringLiteral( "Necesidades de riego" ),
-      QLatin1String( "wms" ) );
-      
-  QgsRasterLayer *protectedSitesLayer = new QgsRasterLayer(
-      QStringLiteral( "contextualWMSLegend=1&crs=EPSG:4326&dpiMode=7&featureCount=10&format=image/png&layers=PS.ProtectedSite&styles=PS.ProtectedSite.Default&tilePixelRatio=0&url=https://wms.mapama.gob.es/sig/Biodiversidad/ENP/wms.aspx" ),
-      QStringLiteral( "Protected Sites Default Style" ),
-      QLatin1String( "wms" ) );
-      
-  // Create and add Cultivo Declarado 2024 layer for Spain GIS Services
-  QgsRasterLayer *cultivoDeclarado2024Layer = new QgsRasterLayer(
-      QStringLiteral( "contextualWMSLegend=1&crs=EPSG:4326&dpiMode=7&featureCount=10&format=image/png&layers=AU.Sigpac:cultivo_declarado&styles&tilePixelRatio=0&url=https://sigpac-hubcloud.es/wms" ),
-      QStringLiteral( "Cultivo Declarado 2024" ),
-      QLatin1String( "wms" ) );
-  
-  // Add layers to the Utils group
-  mProject->addMapLayer(floodRiskLayer, false);
-  mProject->addMapLayer(zonasVulLayer, false);
-  mProject->addMapLayer(puntosAcotadosLayer, false);
-  mProject->addMapLayer(curvasNivelLayer, false);
-  mProject->addMapLayer(modeloDigitalTerrenoLayer, false);
-  mProject->addMapLayer(hidrografiaLayer, false);
-  mProject->addMapLayer(etpMediaAnualLayer, false);
-  mProject->addMapLayer(temperaturaMaximaLayer, false);
-  mProject->addMapLayer(temperaturaMediaLayer, false);
-  mProject->addMapLayer(temperaturaMinimaLayer, false);
-  mProject->addMapLayer(clasificacionClimaticaLayer, false);
-  mProject->addMapLayer(necesidadesRiegoLayer, false);
-  mProject->addMapLayer(protectedSitesLayer, false);
-  utilsGroup->addLayer(floodRiskLayer);
-  utilsGroup->addLayer(zonasVulLayer);
-  utilsGroup->addLayer(puntosAcotadosLayer);
-  utilsGroup->addLayer(curvasNivelLayer);
-  utilsGroup->addLayer(modeloDigitalTerrenoLayer);
-  utilsGroup->addLayer(hidrografiaLayer);
-  utilsGroup->addLayer(etpMediaAnualLayer);
-  utilsGroup->addLayer(temperaturaMaximaLayer);
-  utilsGroup->addLayer(temperaturaMediaLayer);
-  utilsGroup->addLayer(temperaturaMinimaLayer);
-  utilsGroup->addLayer(clasificacionClimaticaLayer);
-  utilsGroup->addLayer(necesidadesRiegoLayer);
-  utilsGroup->addLayer(protectedSitesLayer);
+  // Add flood risk, nitrates, IGN and climate WMS layers to the Utils group
+  mLazyLayerManager->addLayer( utilsGroup, LazyLayerManager::LayerType::Raster, QStringLiteral( "contextualWMSLegend=1&crs=EPSG:3857&dpiMode=7&featureCount=10&format=image/png&layers=NZ.RiskZone&styles&tilePixelRatio=0&url=https://wms.mapama.gob.es/sig/Agua/Riesgo/RiesgoAct_100/wms.aspx" ), QStringLiteral( "Riesgo inundación T100" ) );
+  mLazyLayerManager->addLayer( utilsGroup, LazyLayerManager::LayerType::Raster, QStringLiteral( "contextualWMSLegend=1&crs=EPSG:3857&dpiMode=7&featureCount=10&format=image/png&layers=AM.NitrateVulnerableZone&styles&tilePixelRatio=0&url=https://wms.mapama.gob.es/sig/agua/ZonasVulnerables/2023/wms.aspx" ), QStringLiteral( "Zonas Vul Nitratos 2023" ) );
+  mLazyLayerManager->addLayer( utilsGroup, LazyLayerManager::LayerType::Raster, QStringLiteral( "contextualWMSLegend=1&crs=EPSG:4258&dpiMode=7&featureCount=10&format=image/png&layers=EL.SpotElevation&styles=puntosacotados&tilePixelRatio=0&url=https://servicios.idee.es/wms-inspire/mdt" ), QStringLiteral( "IGN: puntos acotados" ) );
+  mLazyLayerManager->addLayer( utilsGroup, LazyLayerManager::LayerType::Raster, QStringLiteral( "contextualWMSLegend=1&crs=EPSG:4258&dpiMode=7&featureCount=10&format=image/png&layers=EL.ContourLine&styles=curvasnivel&tilePixelRatio=0&url=https://servicios.idee.es/wms-inspire/mdt" ), QStringLiteral( "Curvas de nivel" ) );
+  mLazyLayerManager->addLayer( utilsGroup, LazyLayerManager::LayerType::Raster, QStringLiteral( "contextualWMSLegend=1&crs=EPSG:4258&dpiMode=7&featureCount=10&format=image/png&layers=EL.ElevationGridCoverage&styles=EL.ElevationGridCoverage.Default&tilePixelRatio=0&url=https://servicios.idee.es/wms-inspire/mdt" ), QStringLiteral( "Modelo digital terreno" ) );
+  mLazyLayerManager->addLayer( utilsGroup, LazyLayerManager::LayerType::Raster, QStringLiteral( "contextualWMSLegend=1&crs=EPSG:4258&dpiMode=7&featureCount=10&format=image/png&tilePixelRatio=0&url=https://servicios.idee.es/wms-inspire/hidrografia&layers=HY.PhysicalWaters.HydroPointOfInterest&layers=HY.PhysicalWaters.ManMadeObject&layers=HY.PhysicalWaters.LandWaterBoundary&layers=HY.Network&layers=HY.PhysicalWaters.Waterbodies&layers=HY.PhysicalWaters.Wetland&layers=HY.PhysicalWaters.Catchments&styles=&styles=&styles=&styles=&styles=&styles=&styles=" ), QStringLiteral( "Hidrografía España" ) );
+  mLazyLayerManager->addLayer( utilsGroup, LazyLayerManager::LayerType::Raster, QStringLiteral( "contextualWMSLegend=1&crs=EPSG:4230&dpiMode=7&featureCount=10&format=image/png&layers=Evapotranspiración&styles=default&tilePixelRatio=0&url=https://wms.mapama.gob.es/sig/Agricultura/CaractAgroClimaticas/wms.aspx" ), QStringLiteral( "ETP media anual" ) );
+  mLazyLayerManager->addLayer( utilsGroup, LazyLayerManager::LayerType::Raster, QStringLiteral( "contextualWMSLegend=1&crs=EPSG:4230&dpiMode=7&featureCount=10&format=image/png&layers=Temperatura máxima&styles&tilePixelRatio=0&url=https://wms.mapama.gob.es/sig/Agricultura/CaractAgroClimaticas/wms.aspx" ), QStringLiteral( "Temperatura máxima" ) );
+  mLazyLayerManager->addLayer( utilsGroup, LazyLayerManager::LayerType::Raster, QStringLiteral( "contextualWMSLegend=1&crs=EPSG:4230&dpiMode=7&featureCount=10&format=image/png&layers=Temperatura media anual&styles&tilePixelRatio=0&url=https://wms.mapama.gob.es/sig/Agricultura/CaractAgroClimaticas/wms.aspx" ), QStringLiteral( "Temperatura media" ) );
+  mLazyLayerManager->addLayer( utilsGroup, LazyLayerManager::LayerType::Raster, QStringLiteral( "contextualWMSLegend=1&crs=EPSG:4230&dpiMode=7&featureCount=10&format=image/png&layers=Temperatura mínima&styles&tilePixelRatio=0&url=https://wms.mapama.gob.es/sig/Agricultura/CaractAgroClimaticas/wms.aspx" ), QStringLiteral( "Temperatura mínima" ) );
+  mLazyLayerManager->addLayer( utilsGroup, LazyLayerManager::LayerType::Raster, QStringLiteral( "contextualWMSLegend=1&crs=EPSG:4230&dpiMode=7&featureCount=10&format=image/png&layers=Clasificación climáticos&styles=default&tilePixelRatio=0&url=https://wms.mapama.gob.es/sig/Agricultura/CaractAgroClimaticas/wms.aspx" ), QStringLiteral( "Clasif. clim J. Papadakis" ) );
+  mLazyLayerManager->addLayer( utilsGroup, LazyLayerManager::LayerType::Raster, QStringLiteral( "allowTemporalUpdates=true&contextualWMSLegend=1&crs=EPSG:4326&dpiMode=7&featureCount=10&format=image/png&layers=necesidades_riego&styles&temporalSource=provider&tilePixelRatio=0&timeDimensionExtent=2014-01-01T00:00:00.000Z/2023-01-01T00:00:00.000Z/P1Y&type=wmst&url=https://wmts.mapama.gob.es/sig/desarrollorural/necesidades_riego/ows" ), QStringLiteral( "Necesidades de riego" ) );
+  mLazyLayerManager->addLayer( utilsGroup, LazyLayerManager::LayerType::Raster, QStringLiteral( "contextualWMSLegend=1&crs=EPSG:4326&dpiMode=7&featureCount=10&format=image/png&layers=PS.ProtectedSite&styles=PS.ProtectedSite.Default&tilePixelRatio=0&url=https://wms.mapama.gob.es/sig/Biodiversidad/ENP/wms.aspx" ), QStringLiteral( "Protected Sites Default Style" ) );
   
   // Create empty pointer variables for code that might reference them later
   QgsVectorLayer *datosPuntoLayer = nullptr;
   QgsVectorLayer *datosRasterLayer = nullptr;
 
-  // Add Cultivo Declarado layer to the project and to the Spain GIS Base Layers group
-  mProject->addMapLayer(cultivoDeclarado2024Layer, false);
-  spainGisBaseLayersGroup->addLayer(cultivoDeclarado2024Layer);
+  // Add Cultivo Declarado layer to the Spain GIS Base Layers group
+  mLazyLayerManager->addLayer( spainGisBaseLayersGroup, LazyLayerManager::LayerType::Raster, QStringLiteral( "contextualWMSLegend=1&crs=EPSG:4326&dpiMode=7&featureCount=10&format=image/png&layers=AU.Sigpac:cultivo_declarado&styles&tilePixelRatio=0&url=https://sigpac-hubcloud.es/wms" ), QStringLiteral( "Cultivo Declarado 2024" ) );
   
   // Set TeselaRecintos FEGA opacity to 50% with safety check
   if (teselaRecintosLayer)
@@ -2305,6 +2155,9 @@ void QgisMobileapp::readProjectFile()
   // Now restore layer visibility states for custom layers AFTER all other setup is done
   // The mSkipHardcodedLayers flag is now a member variable and used internally
   restoreLayerVisibilityState();
+
+  // With visibility settled, instantiate the remote layers which ended up visible
+  mLazyLayerManager->setPaused( false );
   
   // Only emit the loadProjectEnded signal at the very end
   // This ensures all our visibility states are set before UI updates
@@ -2637,6 +2490,40 @@ void QgisMobileapp::clearProject()
   mProject->clear();
 }
 
+bool QgisMobileapp::restoreProjectBackup( ProjectBackupManager *backupManager, const QString &backupPath )
+{
+  if ( !backupManager || mProjectFilePath.isEmpty() )
+    return false;
+
+  const QString projectFilePath = mProjectFilePath;
+  const QString projectFileName = mProjectFileName;
+
+  QStringList databasePaths;
+  const QList<QgsMapLayer *> layers = mProject->mapLayers().values();
+  for ( QgsMapLayer *layer : layers )
+  {
+    for ( const QString &path : getGpkgFilesFromLayer( qobject_cast<QgsVectorLayer *>( layer ) ) )
+    {
+      if ( !databasePaths.contains( path ) )
+        databasePaths << path;
+    }
+  }
+
+  // Databases replaced while open would be corrupted by the connections left to them
+  if ( mMapCanvas )
+    mMapCanvas->stopRendering();
+  for ( const QString &path : std::as_const( databasePaths ) )
+    mGpkgFlusher->stop( path );
+  clearProject();
+
+  const bool restored = backupManager->restoreBackup( backupPath, projectFilePath );
+
+  for ( const QString &path : std::as_const( databasePaths ) )
+    mGpkgFlusher->start( path );
+  loadProjectFile( projectFilePath, projectFileName );
+  return restored;
+}
+
 void QgisMobileapp::saveProjectPreviewImage()
 {
   if ( !mProjectFilePath.isEmpty() && mMapCanvas && !mMapCanvas->isRendering() )
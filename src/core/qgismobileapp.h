@@ -39,6 +39,7 @@
 #include "qgsgpkgflusher.h"
 #include "screendimmer.h"
 #include "settings.h"
+#include "tilestore.h"
 
 class AppInterface;
 class AppMissingGridHandler;
@@ -54,8 +55,12 @@ class TrackingModel;
 class LocatorFiltersModel;
 class QgsProject;
 class LayerObserver;
+class LazyLayerManager;
 class FeatureHistory;
+class FeatureCountCache;
+class FeatureSearchIndex;
 class MessageLogModel;
+class ProjectBackupManager;
 class QgsPrintLayout;
 
 #define REGISTER_SINGLETON( uri, _class, name ) qmlRegisterSingletonType<_class>( uri, 1, 0, name, []( QQmlEngine *engine, QJSEngine *scriptEngine ) -> QObject * { Q_UNUSED(engine); Q_UNUSED(scriptEngine); return new _class(); } )
@@ -209,6 +214,13 @@ class QFIELD_CORE_EXPORT QgisMobileapp : public QQmlApplicationEngine
      */
     Q_INVOKABLE void clearProject();
 
+    /**
+     * Restores the backup at \a backupPath over the currently opened project using \a backupManager.
+     * The project is closed beforehand, so that neither its layers nor the GeoPackage flusher hold
+     * the databases being replaced open, and reopened once restored.
+     */
+    bool restoreProjectBackup( ProjectBackupManager *backupManager, const QString &backupPath );
+
     static void initDeclarative( QQmlEngine *engine );
 
     void loadTestingData(); // Only for desktop builds - will be removed
@@ -302,7 +314,11 @@ class QFIELD_CORE_EXPORT QgisMobileapp : public QQmlApplicationEngine
     std::unique_ptr<QgsGpkgFlusher> mGpkgFlusher;
     std::unique_ptr<LayerObserver> mLayerObserver;
     std::unique_ptr<FeatureHistory> mFeatureHistory;
+    std::unique_ptr<FeatureSearchIndex> mFeatureSearchIndex;
+    std::unique_ptr<FeatureCountCache> mFeatureCountCache;
     std::unique_ptr<ClipboardManager> mClipboardManager;
+    std::unique_ptr<TileStore> mTileStore;
+    std::unique_ptr<LazyLayerManager> mLazyLayerManager;
 
     QFieldAppAuthRequestHandler *mAuthRequestHandler = nullptr;
 
@@ -1,28 +1,70 @@
 #include "qgsflusher.h"
+#include <QDateTime>
+#include <QElapsedTimer>
 #include <QFileInfo>
 #include <QMutexLocker>
 #include <qgsmessagelog.h>
-#include <qgssqliteutils.h>
 #include <sqlite3.h>
 
+#include <algorithm>
+
 // Make sure SQLITE constants are defined
 #ifndef SQLITE_OPEN_READWRITE
 #define SQLITE_OPEN_READWRITE 0x00000002
 #endif
 
+//! Delay between the last change and its flush
+static const int sFlushDelay = 500;
+//! Delay between the last change and its flush for files receiving frequent changes
+static const int sBusyFlushDelay = 2000;
+//! Time spent waiting on other connections by RESTART and TRUNCATE checkpoints
+static const int sBusyTimeout = 100;
+//! Time after which connections to files which are not flushed anymore are closed
+static const qint64 sIdleConnectionTimeout = 60000;
+//! Window over which flush requests are counted to estimate the write rate
+static const qint64 sWriteRateWindow = 60000;
+
+Flusher::~Flusher()
+{
+  qDeleteAll( mScheduledFlushes );
+}
+
+Flusher::CheckpointMode Flusher::checkpointMode( qint64 walBytes, int writeRate )
+{
+  if ( walBytes < LargeWalSize )
+    return CheckpointMode::Passive;
+
+  // While editing is ongoing the WAL is only reset once oversized, and not truncated since it will grow again
+  if ( writeRate >= BusyWriteRate )
+    return walBytes >= OversizedWalSize ? CheckpointMode::Restart : CheckpointMode::Passive;
+
+  return CheckpointMode::Truncate;
+}
+
+Flusher::Metrics Flusher::metrics( const QString &fileName ) const
+{
+  QMutexLocker<QMutex> locker( &mMutex );
+  return mMetrics.value( fileName );
+}
+
 void Flusher::scheduleFlush( const QString &filename )
 {
   if ( mStoppedFlushes.value( filename, false ) )
     return;
 
-  // Use shorter delay for critical files
-  int delayMs = 250; // Default to shorter delay for all files
-  
-  // For any other file, use the previous 500ms delay
-  if (!filename.contains("Mis_Datos.gpkg", Qt::CaseInsensitive)) {
-    delayMs = 500;
+  int writeRate = 0;
+  {
+    QMutexLocker<QMutex> locker( &mMutex );
+    const qint64 now = QDateTime::currentMSecsSinceEpoch();
+    QList<qint64> &requestTimes = mRequestTimes[filename];
+    requestTimes << now;
+    while ( requestTimes.first() < now - sWriteRateWindow )
+      requestTimes.removeFirst();
+    writeRate = static_cast<int>( requestTimes.size() );
   }
 
+  const int delayMs = writeRate >= BusyWriteRate ? sBusyFlushDelay : sFlushDelay;
+
   if ( mScheduledFlushes.contains( filename ) )
   {
     mScheduledFlushes.value( filename )->start( delayMs );
@@ -35,6 +77,14 @@ void Flusher::scheduleFlush( const QString &filename )
     mScheduledFlushes.insert( filename, timer );
     timer->start( delayMs );
   }
+
+  if ( !mIdleTimer )
+  {
+    mIdleTimer = new QTimer( this );
+    connect( mIdleTimer, &QTimer::timeout, this, &Flusher::closeIdleConnections );
+  }
+  if ( !mIdleTimer->isActive() )
+    mIdleTimer->start( sIdleConnectionTimeout );
 }
 
 void Flusher::flush( const QString &filename )
@@ -45,92 +95,109 @@ void Flusher::flush( const QString &filename )
   QMutexLocker<QMutex> locker( &mMutex );
 
   // Check if the file exists and is accessible before attempting to open it
-  QFileInfo fileInfo(filename);
-  if (!fileInfo.exists() || !fileInfo.isReadable() || !fileInfo.isWritable()) 
+  QFileInfo fileInfo( filename );
+  if ( !fileInfo.exists() || !fileInfo.isReadable() || !fileInfo.isWritable() )
   {
     // Only log critical errors with Qgis::Critical level
     QgsMessageLog::logMessage( QObject::tr( "Cannot flush database - file not accessible: %1" ).arg( filename ), QString(), Qgis::Critical );
-    if ( mScheduledFlushes.contains(filename) )
-    {
-      // Use shorter retry for critical files
-      int retryDelayMs = filename.contains("Mis_Datos.gpkg", Qt::CaseInsensitive) ? 500 : 1000;
-      
-      // Re-schedule for later if file might become available
-      mScheduledFlushes[filename]->start( retryDelayMs );
-    }
+    mConnections.remove( filename );
+    // Re-schedule for later if file might become available
+    retryFlush( filename, 1000 );
     return;
   }
 
   // Add extra try-catch to prevent crashes on Android
-  try 
+  try
   {
-    sqlite3_database_unique_ptr db;
-    int status = db.open_v2( filename, SQLITE_OPEN_READWRITE, nullptr );
-    if ( status != SQLITE_OK )
+    Connection *conn = connection( filename );
+    if ( !conn )
     {
-      // Only log critical errors with Qgis::Critical level
-      QgsMessageLog::logMessage( QObject::tr( "There was an error opening the database <b>%1</b>: %2" ).arg( filename, db.errorMessage() ), QString(), Qgis::Critical );
-      
       // If we can't open the database, try again later rather than crashing
-      if ( mScheduledFlushes.contains(filename) )
-      {
-        // Use shorter retry for critical files
-        int retryDelayMs = filename.contains("Mis_Datos.gpkg", Qt::CaseInsensitive) ? 500 : 1000;
-        
-        mScheduledFlushes[filename]->start( retryDelayMs );
-      }
+      retryFlush( filename, 1000 );
       return;
     }
 
-    QString error;
-    // Add PRAGMA to optimize SQLite on Android
-    db.exec( "PRAGMA journal_mode=WAL;", error );
-    db.exec( "PRAGMA synchronous=NORMAL;", error );
-    db.exec( "PRAGMA wal_checkpoint;", error );
+    Metrics &metrics = mMetrics[filename];
+    const QList<qint64> requestTimes = mRequestTimes.value( filename );
+    const qint64 windowStart = QDateTime::currentMSecsSinceEpoch() - sWriteRateWindow;
+    metrics.writeRate = static_cast<int>( std::count_if( requestTimes.begin(), requestTimes.end(), [windowStart]( qint64 time ) { return time >= windowStart; } ) );
+    metrics.walBytes = QFileInfo( filename + QStringLiteral( "-wal" ) ).size();
 
-    if ( error.isEmpty() )
-    {
-      if ( mScheduledFlushes.contains(filename) )
+    CheckpointMode mode = checkpointMode( metrics.walBytes, metrics.writeRate );
+    auto sqliteMode = []( CheckpointMode mode ) {
+      switch ( mode )
       {
-        delete mScheduledFlushes[filename];
-        mScheduledFlushes.remove( filename );
+        case CheckpointMode::Restart:
+          return SQLITE_CHECKPOINT_RESTART;
+        case CheckpointMode::Truncate:
+          return SQLITE_CHECKPOINT_TRUNCATE;
+        case CheckpointMode::Passive:
+          break;
       }
+      return SQLITE_CHECKPOINT_PASSIVE;
+    };
+
+    QElapsedTimer timer;
+    timer.start();
+    int logFrames = 0;
+    int checkpointedFrames = 0;
+    int status = sqlite3_wal_checkpoint_v2( conn->database.get(), nullptr, sqliteMode( mode ), &logFrames, &checkpointedFrames );
+    if ( status == SQLITE_BUSY && mode != CheckpointMode::Passive )
+    {
+      // Other connections kept the WAL from being reset, write back as much as possible
+      mode = CheckpointMode::Passive;
+      status = sqlite3_wal_checkpoint_v2( conn->database.get(), nullptr, SQLITE_CHECKPOINT_PASSIVE, &logFrames, &checkpointedFrames );
     }
-    else
+    conn->lastUsed = QDateTime::currentMSecsSinceEpoch();
+
+    if ( status != SQLITE_OK )
     {
       // Only log critical errors with Qgis::Critical level
-      QgsMessageLog::logMessage( QObject::tr( "Could not flush database %1 (%2) " ).arg( filename, error ), QString(), Qgis::Critical );
-      if ( mScheduledFlushes.contains(filename) )
-      {
-        // Use shorter retry for critical files
-        int retryDelayMs = filename.contains("Mis_Datos.gpkg", Qt::CaseInsensitive) ? 500 : 1000;
-        
-        mScheduledFlushes[filename]->start( retryDelayMs );
-      }
+      QgsMessageLog::logMessage( QObject::tr( "Could not flush database %1 (%2) " ).arg( filename, QString::fromUtf8( sqlite3_errmsg( conn->database.get() ) ) ), QString(), Qgis::Critical );
+      retryFlush( filename, 1000 );
+      return;
+    }
+
+    // Frame counts cover the whole WAL, they start over once a writer restarted it
+    logFrames = std::max( logFrames, 0 );
+    checkpointedFrames = std::max( checkpointedFrames, 0 );
+    if ( logFrames < conn->logFrames || checkpointedFrames < conn->checkpointedFrames )
+      conn->checkpointedFrames = 0;
+
+    metrics.checkpointLatency = timer.elapsed();
+    metrics.pagesWritten += checkpointedFrames - conn->checkpointedFrames;
+    metrics.checkpointCount++;
+    metrics.lastMode = mode;
+
+    const bool restarted = mode != CheckpointMode::Passive;
+    conn->logFrames = restarted ? 0 : logFrames;
+    conn->checkpointedFrames = restarted ? 0 : checkpointedFrames;
+
+    if ( checkpointedFrames < logFrames )
+    {
+      // Readers still use older frames, write back the remaining ones later
+      retryFlush( filename, 1000 );
+    }
+    else if ( mScheduledFlushes.contains( filename ) )
+    {
+      delete mScheduledFlushes.take( filename );
     }
   }
-  catch (const std::exception& e)
+  catch ( const std::exception &e )
   {
     // Only log critical errors with Qgis::Critical level
     QgsMessageLog::logMessage( QObject::tr( "Exception while flushing database %1: %2" ).arg( filename, e.what() ), QString(), Qgis::Critical );
-    // Try again later
-    if ( mScheduledFlushes.contains(filename) )
-    {
-      // Use shorter retry for critical files, but longer overall since this was an exception
-      int retryDelayMs = filename.contains("Mis_Datos.gpkg", Qt::CaseInsensitive) ? 1000 : 2000;
-      
-      mScheduledFlushes[filename]->start( retryDelayMs );
-    }
+    // Try again later with an increased delay since this was an exception
+    mConnections.remove( filename );
+    retryFlush( filename, 2000 );
   }
-  catch (...)
+  catch ( ... )
   {
     // Only log critical errors with Qgis::Critical level
     QgsMessageLog::logMessage( QObject::tr( "Unknown exception while flushing database %1" ).arg( filename ), QString(), Qgis::Critical );
     // Try again later with an increased delay
-    if ( mScheduledFlushes.contains(filename) )
-    {
-      mScheduledFlushes[filename]->start( 2000 );
-    }
+    mConnections.remove( filename );
+    retryFlush( filename, 2000 );
   }
 
   // No need to unlock explicitly - QMutexLocker will do it automatically
@@ -138,15 +205,20 @@ void Flusher::flush( const QString &filename )
 
 void Flusher::stop( const QString &fileName )
 {
-  if ( !mScheduledFlushes.contains( fileName ) )
-    return;
+  if ( mScheduledFlushes.contains( fileName ) )
+  {
+    QTimer *timer = mScheduledFlushes.take( fileName );
+    timer->stop();
+    timer->deleteLater();
 
-  mScheduledFlushes.value( fileName )->stop();
-  mScheduledFlushes.remove( fileName );
+    flush( fileName );
 
-  flush( fileName );
+    mStoppedFlushes.insert( fileName, true );
+  }
 
-  mStoppedFlushes.insert( fileName, true );
+  // The file might get replaced while stopped, don't keep it open
+  QMutexLocker<QMutex> locker( &mMutex );
+  mConnections.remove( fileName );
 }
 
 void Flusher::start( const QString &fileName )
@@ -157,4 +229,54 @@ void Flusher::start( const QString &fileName )
 bool Flusher::isStopped( const QString &fileName ) const
 {
   return mStoppedFlushes.value( fileName, false );
-} 
\ No newline at end of file
+}
+
+Flusher::Connection *Flusher::connection( const QString &filename )
+{
+  if ( std::shared_ptr<Connection> conn = mConnections.value( filename ) )
+    return conn.get();
+
+  std::shared_ptr<Connection> conn = std::make_shared<Connection>();
+  const int status = conn->database.open_v2( filename, SQLITE_OPEN_READWRITE, nullptr );
+  if ( status != SQLITE_OK )
+  {
+    // Only log critical errors with Qgis::Critical level
+    QgsMessageLog::logMessage( QObject::tr( "There was an error opening the database <b>%1</b>: %2" ).arg( filename, conn->database.errorMessage() ), QString(), Qgis::Critical );
+    return nullptr;
+  }
+
+  // Connection settings only need to be applied once per connection
+  QString error;
+  sqlite3_busy_timeout( conn->database.get(), sBusyTimeout );
+  conn->database.exec( "PRAGMA journal_mode=WAL;", error );
+  conn->database.exec( "PRAGMA synchronous=NORMAL;", error );
+  if ( !error.isEmpty() )
+    QgsMessageLog::logMessage( QObject::tr( "Could not configure database %1 (%2)" ).arg( filename, error ), QString(), Qgis::Warning );
+
+  conn->lastUsed = QDateTime::currentMSecsSinceEpoch();
+  mConnections.insert( filename, conn );
+  return conn.get();
+}
+
+void Flusher::closeIdleConnections()
+{
+  QMutexLocker<QMutex> locker( &mMutex );
+
+  const qint64 idleSince = QDateTime::currentMSecsSinceEpoch() - sIdleConnectionTimeout;
+  for ( auto it = mConnections.begin(); it != mConnections.end(); )
+  {
+    if ( it.value()->lastUsed < idleSince && !mScheduledFlushes.contains( it.key() ) )
+      it = mConnections.erase( it );
+    else
+      ++it;
+  }
+
+  if ( mConnections.isEmpty() )
+    mIdleTimer->stop();
+}
+
+void Flusher::retryFlush( const QString &filename, int delayMs )
+{
+  if ( mScheduledFlushes.contains( filename ) )
+    mScheduledFlushes.value( filename )->start( delayMs );
+}
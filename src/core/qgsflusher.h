@@ -1,27 +1,79 @@
 #ifndef QGSFLUSHER_H
 #define QGSFLUSHER_H
 
-#include <QObject>
+#include <QList>
 #include <QMap>
-#include <QTimer>
 #include <QMutex>
+#include <QObject>
 #include <QString>
+#include <QTimer>
+#include <qgssqliteutils.h>
+
+#include <memory>
 
 /**
  * \brief The Flusher class handles SQLite flush operations for GeoPackage files.
- * 
- * This class schedules and executes flush operations for SQLite databases,
- * particularly GeoPackage files. It includes safety mechanisms to prevent crashes
- * on Android and other platforms by implementing delays and error checking.
+ *
+ * This class schedules and executes WAL checkpoints for SQLite databases,
+ * particularly GeoPackage files. A single connection is kept open per file while
+ * it is being edited, so that consecutive flushes don't pay for reopening the
+ * database. The checkpoint mode is chosen from the size of the WAL file and the
+ * rate at which flushes are requested, busy editing sessions are never blocked
+ * while quiet periods are used to reset and truncate grown WAL files.
  */
 class Flusher : public QObject
 {
     Q_OBJECT
 
+  public:
+    //! SQLite checkpoint modes used by the flusher
+    enum class CheckpointMode
+    {
+      Passive,  //!< Checkpoints as many frames as possible without waiting on readers or writers
+      Restart,  //!< Checkpoints all frames and makes the next writer restart the WAL from its beginning
+      Truncate, //!< Like Restart, and truncates the WAL file to zero bytes
+    };
+
+    //! Flush statistics gathered for a single file
+    struct Metrics
+    {
+        //! Size of the WAL file before the last checkpoint, in bytes
+        qint64 walBytes = 0;
+        //! Duration of the last checkpoint, in milliseconds, or -1 if none was performed yet
+        qint64 checkpointLatency = -1;
+        //! Number of database pages written back by checkpoints
+        qint64 pagesWritten = 0;
+        //! Number of checkpoints performed
+        int checkpointCount = 0;
+        //! Mode of the last checkpoint
+        CheckpointMode lastMode = CheckpointMode::Passive;
+        //! Number of flushes requested during the last minute
+        int writeRate = 0;
+    };
+
+    //! WAL size above which the WAL gets reset once editing calms down
+    static constexpr qint64 LargeWalSize = 4 * 1024 * 1024;
+    //! WAL size above which the WAL gets reset even while editing is ongoing
+    static constexpr qint64 OversizedWalSize = 32 * 1024 * 1024;
+    //! Number of flush requests per minute above which a file is considered busy
+    static constexpr int BusyWriteRate = 12;
+
+    ~Flusher() override;
+
+    /**
+     * Returns the checkpoint mode to use for a WAL of \a walBytes with \a writeRate
+     * flushes requested during the last minute.
+     */
+    static CheckpointMode checkpointMode( qint64 walBytes, int writeRate );
+
+    //! Returns the flush statistics of a given \a fileName
+    Metrics metrics( const QString &fileName ) const;
+
   public slots:
     /**
      * Schedules a new flush for the given \a filename after 500ms.
      * If a new flush is scheduled for the same file before the actual flush is performed, the timer is reset to wait another 500ms.
+     * Files receiving frequent changes wait up to 2 seconds, so that bursts of edits are coalesced into a single checkpoint.
      */
     void scheduleFlush( const QString &filename );
 
@@ -32,6 +84,7 @@ class Flusher : public QObject
 
     /**
      * Immediately performs a flush for a given \a fileName and returns. If the flusher is stopped, flush for that \a fileName would be ignored.
+     * The connection to the file is closed, so that it can be safely replaced.
      */
     void stop( const QString &fileName );
 
@@ -46,9 +99,26 @@ class Flusher : public QObject
     bool isStopped( const QString &fileName ) const;
 
   private:
-    QMutex mMutex;
+    struct Connection
+    {
+        sqlite3_database_unique_ptr database;
+        qint64 lastUsed = 0;
+        //! Frame counts reported by the previous checkpoint, to only account for newly written pages
+        int logFrames = 0;
+        int checkpointedFrames = 0;
+    };
+
+    Connection *connection( const QString &filename );
+    void closeIdleConnections();
+    void retryFlush( const QString &filename, int delayMs );
+
+    mutable QMutex mMutex;
     QMap<QString, QTimer *> mScheduledFlushes;
     QMap<QString, bool> mStoppedFlushes;
+    QMap<QString, std::shared_ptr<Connection>> mConnections;
+    QMap<QString, Metrics> mMetrics;
+    QMap<QString, QList<qint64>> mRequestTimes;
+    QTimer *mIdleTimer = nullptr;
 };
 
-#endif // QGSFLUSHER_H 
\ No newline at end of file
+#endif // QGSFLUSHER_H
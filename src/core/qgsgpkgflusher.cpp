@@ -35,6 +35,7 @@ QgsGpkgFlusher::QgsGpkgFlusher( QgsProject *project )
   mFlusher = new Flusher();
   mFlusher->moveToThread( &mFlusherThread );
   connect( this, &QgsGpkgFlusher::requestFlush, mFlusher, &Flusher::scheduleFlush );
+  connect( &mFlusherThread, &QThread::finished, mFlusher, &QObject::deleteLater );
   mFlusherThread.start();
 }
 
@@ -121,3 +122,31 @@ bool QgsGpkgFlusher::isStopped( const QString &fileName ) const
 {
   return mFlusher->isStopped( fileName );
 }
+
+QVariantMap QgsGpkgFlusher::metrics( const QString &fileName ) const
+{
+  const Flusher::Metrics metrics = mFlusher->metrics( fileName );
+
+  QString checkpointMode;
+  switch ( metrics.lastMode )
+  {
+    case Flusher::CheckpointMode::Passive:
+      checkpointMode = QStringLiteral( "passive" );
+      break;
+    case Flusher::CheckpointMode::Restart:
+      checkpointMode = QStringLiteral( "restart" );
+      break;
+    case Flusher::CheckpointMode::Truncate:
+      checkpointMode = QStringLiteral( "truncate" );
+      break;
+  }
+
+  QVariantMap map;
+  map.insert( QStringLiteral( "walBytes" ), metrics.walBytes );
+  map.insert( QStringLiteral( "checkpointLatency" ), metrics.checkpointLatency );
+  map.insert( QStringLiteral( "checkpointMode" ), checkpointMode );
+  map.insert( QStringLiteral( "pagesWritten" ), metrics.pagesWritten );
+  map.insert( QStringLiteral( "checkpointCount" ), metrics.checkpointCount );
+  map.insert( QStringLiteral( "writeRate" ), metrics.writeRate );
+  return map;
+}
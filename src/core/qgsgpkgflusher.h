@@ -20,6 +20,7 @@
 
 #include <QObject>
 #include <QThread>
+#include <QVariantMap>
 #include <qgsmaplayer.h>
 
 class QgsProject;
@@ -57,6 +58,14 @@ class QgsGpkgFlusher : public QObject
      */
     bool isStopped( const QString &fileName ) const;
 
+    /**
+     * Returns the flush statistics of a given \a fileName: the size of its WAL file before the last
+     * checkpoint (walBytes), the duration and mode of the last checkpoint (checkpointLatency and
+     * checkpointMode), the number of pages written back (pagesWritten), the number of checkpoints
+     * performed (checkpointCount) and the number of flushes requested during the last minute (writeRate).
+     */
+    Q_INVOKABLE QVariantMap metrics( const QString &fileName ) const;
+
   signals:
 
     /**
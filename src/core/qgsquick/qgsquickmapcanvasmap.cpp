@@ -16,6 +16,7 @@
 #include "qgsquickmapcanvasmap.h"
 #include "qgsquickmapsettings.h"
 
+#include <QPainter>
 #include <QQuickWindow>
 #include <QSGSimpleTextureNode>
 #include <QScreen>
@@ -31,6 +32,31 @@
 #include <qgsproject.h>
 #include <qgsvectorlayer.h>
 
+#include <cmath>
+
+//! Size in device pixels of the tiles rendered in tiled rendering mode
+static const int sTileSize = 512;
+//! Number of scale steps per zoom level used to quantize the tile grid scale
+static const double sTileScaleSteps = 65536.0;
+//! Tile cache capacity in kilobytes
+static const int sTileCacheSize = 96 * 1024;
+//! Maximum number of tiles covering an extent, beyond which tiling is pointless
+static const int sMaximumTileCount = 256;
+
+/**
+ * Disconnects \a job from \a receiver and cancels it without blocking, the job
+ * deletes itself once its rendering threads are done.
+ */
+static void cancelRenderJob( QgsMapRendererJob *job, QObject *receiver )
+{
+  QObject::disconnect( job, nullptr, receiver, nullptr );
+
+  if ( !job->isActive() )
+    job->deleteLater();
+  else
+    QObject::connect( job, &QgsMapRendererJob::finished, job, &QObject::deleteLater );
+  job->cancelWithoutBlocking();
+}
 
 QgsQuickMapCanvasMap::QgsQuickMapCanvasMap( QQuickItem *parent )
   : QQuickItem( parent )
@@ -45,6 +71,8 @@ QgsQuickMapCanvasMap::QgsQuickMapCanvasMap( QQuickItem *parent )
   connect( mMapSettings.get(), &QgsQuickMapSettings::rotationChanged, this, &QgsQuickMapCanvasMap::onRotationChanged );
   connect( mMapSettings.get(), &QgsQuickMapSettings::layersChanged, this, &QgsQuickMapCanvasMap::onLayersChanged );
   connect( mMapSettings.get(), &QgsQuickMapSettings::temporalStateChanged, this, &QgsQuickMapCanvasMap::onTemporalStateChanged );
+  connect( mMapSettings.get(), &QgsQuickMapSettings::destinationCrsChanged, this, &QgsQuickMapCanvasMap::onDestinationCrsChanged );
+  connect( mMapSettings.get(), &QgsQuickMapSettings::backgroundColorChanged, this, &QgsQuickMapCanvasMap::invalidateTiles );
 
   connect( this, &QgsQuickMapCanvasMap::renderStarting, this, &QgsQuickMapCanvasMap::isRenderingChanged );
   connect( this, &QgsQuickMapCanvasMap::mapCanvasRefreshed, this, &QgsQuickMapCanvasMap::isRenderingChanged );
@@ -52,6 +80,7 @@ QgsQuickMapCanvasMap::QgsQuickMapCanvasMap( QQuickItem *parent )
   mMapUpdateTimer.setSingleShot( false );
   mMapUpdateTimer.setInterval( 250 );
   mRefreshTimer.setSingleShot( true );
+  mTileCache.setMaxCost( sTileCacheSize );
   setTransformOrigin( QQuickItem::Center );
   setFlags( QQuickItem::ItemHasContents );
 }
@@ -104,13 +133,9 @@ void QgsQuickMapCanvasMap::pan( QPointF oldPos, QPointF newPos )
   mMapSettings->setExtent( extent );
 }
 
-void QgsQuickMapCanvasMap::refreshMap()
+QgsMapSettings QgsQuickMapCanvasMap::prepareMapSettings() const
 {
-  stopRendering(); // if any...
-
   QgsMapSettings mapSettings = mMapSettings->mapSettings();
-  if ( !mapSettings.hasValidSettings() )
-    return;
 
   if ( !qgsDoubleNear( mQuality, 1.0 ) )
   {
@@ -143,6 +168,32 @@ void QgsQuickMapCanvasMap::refreshMap()
   // with incremental rendering - enables updates of partially rendered layers (good for WMTS, XYZ layers)
   mapSettings.setFlag( Qgis::MapSettingsFlag::RenderPartialOutput, mIncrementalRendering );
 
+  return mapSettings;
+}
+
+void QgsQuickMapCanvasMap::refreshMap()
+{
+  if ( useTiles() )
+  {
+    refreshTiles();
+    return;
+  }
+
+  stopRendering(); // if any...
+
+  if ( mTilesDisplayed )
+  {
+    // Fall back on the last composed tiles until the new image is ready
+    mTilesDisplayed = false;
+    mDirty = true;
+    updateTransform();
+  }
+
+  if ( !mMapSettings->mapSettings().hasValidSettings() )
+    return;
+
+  const QgsMapSettings mapSettings = prepareMapSettings();
+
   // create the renderer job
   Q_ASSERT( !mJob );
   mJob = new QgsMapRendererParallelJob( mapSettings );
@@ -236,9 +287,11 @@ void QgsQuickMapCanvasMap::layerRepaintRequested( bool deferred )
 
   if ( !mFreeze )
   {
+    invalidateLayerTiles( qobject_cast<QgsMapLayer *>( sender() ) );
+
     if ( deferred || mForceDeferredLayersRepaint )
     {
-      if ( !mJob && !mRefreshTimer.isActive() )
+      if ( !isRendering() && !mRefreshTimer.isActive() )
       {
         mSilentRefresh = true;
         refresh();
@@ -281,6 +334,7 @@ void QgsQuickMapCanvasMap::onScreenChanged( QScreen *screen )
       mMapSettings->setDevicePixelRatio( screen->devicePixelRatio() );
     }
     mMapSettings->setOutputDpi( screen->physicalDotsPerInch() );
+    invalidateTiles();
   }
 }
 
@@ -303,12 +357,24 @@ void QgsQuickMapCanvasMap::onRotationChanged()
 void QgsQuickMapCanvasMap::onTemporalStateChanged()
 {
   clearTemporalCache();
+  invalidateTiles();
 
   // And trigger a new rendering job
   refresh();
 }
 void QgsQuickMapCanvasMap::updateTransform()
 {
+  if ( mTilesDisplayed )
+  {
+    // Tiles are positioned against the current extent in updatePaintNode()
+    setScale( 1.0 );
+    setRotation( 0.0 );
+    setX( 0.0 );
+    setY( 0.0 );
+    update();
+    return;
+  }
+
   QgsRectangle imageExtent = mImageMapSettings.extent();
   QgsRectangle newExtent = mMapSettings->mapSettings().extent();
 
@@ -362,6 +428,7 @@ void QgsQuickMapCanvasMap::setQuality( double quality )
     return;
 
   mQuality = quality;
+  invalidateTiles();
 
   emit qualityChanged();
 
@@ -397,6 +464,48 @@ void QgsQuickMapCanvasMap::setRightMargin( double rightMargin )
   emit rightMarginChanged();
 }
 
+bool QgsQuickMapCanvasMap::tiledRendering() const
+{
+  return mTiledRendering;
+}
+
+void QgsQuickMapCanvasMap::setTiledRendering( bool tiledRendering )
+{
+  if ( mTiledRendering == tiledRendering )
+    return;
+
+  mTiledRendering = tiledRendering;
+  if ( !mTiledRendering )
+  {
+    cancelTileJob();
+    mTileQueue.clear();
+    mTileCache.clear();
+  }
+
+  emit tiledRenderingChanged();
+
+  // And trigger a new rendering job
+  refresh();
+}
+
+double QgsQuickMapCanvasMap::overscan() const
+{
+  return mOverscan;
+}
+
+void QgsQuickMapCanvasMap::setOverscan( double overscan )
+{
+  overscan = std::clamp( overscan, 0.0, 1.0 );
+  if ( mOverscan == overscan )
+    return;
+
+  mOverscan = overscan;
+  emit overscanChanged();
+
+  if ( mTilesDisplayed )
+    refresh();
+}
+
 bool QgsQuickMapCanvasMap::forceDeferredLayersRepaint() const
 {
   return mForceDeferredLayersRepaint;
@@ -433,11 +542,22 @@ void QgsQuickMapCanvasMap::setFreeze( bool freeze )
 
 bool QgsQuickMapCanvasMap::isRendering() const
 {
-  return mJob;
+  return mJob || mTileJob;
 }
 
 QSGNode *QgsQuickMapCanvasMap::updatePaintNode( QSGNode *oldNode, QQuickItem::UpdatePaintNodeData * )
 {
+  if ( mTilesDisplayed )
+    return updateTilesPaintNode( oldNode );
+
+  if ( !mTileNodes.isEmpty() )
+  {
+    // Switching back from tiled rendering, the old node holds the tile nodes
+    delete oldNode;
+    oldNode = nullptr;
+    mTileNodes.clear();
+  }
+
   if ( mDirty )
   {
     delete oldNode;
@@ -504,6 +624,9 @@ void QgsQuickMapCanvasMap::onLayersChanged()
   }
   mLayerConnections.clear();
 
+  invalidateTiles();
+  updateLayerExtents();
+
   const QList<QgsMapLayer *> layers = mMapSettings->layers();
   for ( QgsMapLayer *layer : layers )
   {
@@ -513,6 +636,12 @@ void QgsQuickMapCanvasMap::onLayersChanged()
   refresh();
 }
 
+void QgsQuickMapCanvasMap::onDestinationCrsChanged()
+{
+  invalidateTiles();
+  updateLayerExtents();
+}
+
 void QgsQuickMapCanvasMap::destroyJob( QgsMapRendererJob *job )
 {
   job->cancel();
@@ -525,16 +654,12 @@ void QgsQuickMapCanvasMap::stopRendering()
   {
     mMapUpdateTimer.stop();
 
-    disconnect( mJob, &QgsMapRendererJob::renderingLayersFinished, this, &QgsQuickMapCanvasMap::renderJobUpdated );
-    disconnect( mJob, &QgsMapRendererJob::finished, this, &QgsQuickMapCanvasMap::renderJobFinished );
-
-    if ( !mJob->isActive() )
-      mJob->deleteLater();
-    else
-      connect( mJob, &QgsMapRendererJob::finished, mJob, &QObject::deleteLater );
-    mJob->cancelWithoutBlocking();
+    cancelRenderJob( mJob, this );
     mJob = nullptr;
   }
+
+  cancelTileJob();
+  mTileQueue.clear();
 }
 
 void QgsQuickMapCanvasMap::zoomToFullExtent()
@@ -604,3 +729,355 @@ void QgsQuickMapCanvasMap::clearTemporalCache()
     }
   }
 }
+
+bool QgsQuickMapCanvasMap::useTiles() const
+{
+  return mTiledRendering && qgsDoubleNear( mMapSettings->rotation(), 0.0 );
+}
+
+void QgsQuickMapCanvasMap::invalidateTiles()
+{
+  mTileRevision++;
+}
+
+void QgsQuickMapCanvasMap::invalidateLayerTiles( QgsMapLayer *layer )
+{
+  if ( !layer )
+  {
+    invalidateTiles();
+    return;
+  }
+
+  // Features removed from the edges of a layer are only covered by its previous extent
+  QgsRectangle extent = mMapSettings->mapSettings().layerExtentToOutputExtent( layer, layer->extent() );
+  const QgsRectangle previousExtent = mLayerExtents.value( layer->id() );
+  mLayerExtents.insert( layer->id(), extent );
+  if ( !previousExtent.isNull() )
+    extent.combineExtentWith( previousExtent );
+
+  if ( extent.isNull() || !extent.isFinite() )
+  {
+    invalidateTiles();
+    return;
+  }
+
+  // Symbols and labels of features close to a tile spill over it
+  auto isAffected = [this, &extent]( const TileKey &key ) {
+    return tileExtent( key ).buffered( tileMapSize( key.scale ) / 2 ).intersects( extent );
+  };
+
+  const QList<TileKey> keys = mTileCache.keys();
+  for ( const TileKey &key : keys )
+  {
+    if ( isAffected( key ) )
+      mTileCache.object( key )->revision = 0;
+  }
+
+  if ( mTileJob && isAffected( mTileJobKey ) )
+    mTileJobRevision = 0;
+}
+
+void QgsQuickMapCanvasMap::updateLayerExtents()
+{
+  mLayerExtents.clear();
+
+  // Without a previous extent, the tiles of features removed from the edges of a layer would be left outdated
+  const QgsMapSettings mapSettings = mMapSettings->mapSettings();
+  const QList<QgsMapLayer *> layers = mMapSettings->layers();
+  for ( QgsMapLayer *layer : layers )
+  {
+    if ( layer )
+      mLayerExtents.insert( layer->id(), mapSettings.layerExtentToOutputExtent( layer, layer->extent() ) );
+  }
+}
+
+qint64 QgsQuickMapCanvasMap::tileScale() const
+{
+  // Quantize the resolution so that pans, which can slightly alter it, keep hitting the same grid
+  return qRound64( std::log2( mMapSettings->mapSettings().mapUnitsPerPixel() ) * sTileScaleSteps );
+}
+
+double QgsQuickMapCanvasMap::tileMapSize( qint64 scale ) const
+{
+  return std::exp2( static_cast<double>( scale ) / sTileScaleSteps ) * sTileSize;
+}
+
+QgsRectangle QgsQuickMapCanvasMap::tileExtent( const TileKey &key ) const
+{
+  const double size = tileMapSize( key.scale );
+  return QgsRectangle( key.column * size, key.row * size, ( key.column + 1 ) * size, ( key.row + 1 ) * size );
+}
+
+QList<QgsQuickMapCanvasMap::TileKey> QgsQuickMapCanvasMap::tilesForExtent( const QgsRectangle &extent, qint64 scale ) const
+{
+  QList<TileKey> tiles;
+  if ( extent.isEmpty() )
+    return tiles;
+
+  const double size = tileMapSize( scale );
+  const qint64 firstColumn = static_cast<qint64>( std::floor( extent.xMinimum() / size ) );
+  const qint64 lastColumn = static_cast<qint64>( std::floor( extent.xMaximum() / size ) );
+  const qint64 firstRow = static_cast<qint64>( std::floor( extent.yMinimum() / size ) );
+  const qint64 lastRow = static_cast<qint64>( std::floor( extent.yMaximum() / size ) );
+  if ( ( lastColumn - firstColumn + 1 ) * ( lastRow - firstRow + 1 ) > sMaximumTileCount )
+    return tiles;
+
+  for ( qint64 row = firstRow; row <= lastRow; row++ )
+  {
+    for ( qint64 column = firstColumn; column <= lastColumn; column++ )
+    {
+      tiles << TileKey { scale, column, row };
+    }
+  }
+  return tiles;
+}
+
+void QgsQuickMapCanvasMap::refreshTiles()
+{
+  if ( mJob )
+  {
+    mMapUpdateTimer.stop();
+    cancelRenderJob( mJob, this );
+    mJob = nullptr;
+  }
+
+  const QgsMapSettings mapSettings = mMapSettings->mapSettings();
+  if ( !mapSettings.hasValidSettings() )
+    return;
+
+  if ( !mTilesDisplayed )
+  {
+    mTilesDisplayed = true;
+    updateTransform();
+  }
+
+  const qint64 scale = tileScale();
+  mTileScale = scale;
+
+  if ( mTileJob && ( mTileJobKey.scale != scale || mTileJobRevision != mTileRevision ) )
+    cancelTileJob();
+
+  const QgsRectangle extent = mapSettings.visibleExtent();
+  const double xMargin = extent.width() * mOverscan;
+  const double yMargin = extent.height() * mOverscan;
+  const QgsRectangle overscannedExtent( extent.xMinimum() - xMargin, extent.yMinimum() - yMargin, extent.xMaximum() + xMargin, extent.yMaximum() + yMargin );
+
+  // Render the tiles closest to the center of the map first, the visible ones thus preceding the overscan margin
+  QList<TileKey> tiles = tilesForExtent( overscannedExtent, scale );
+  const QgsPointXY center = extent.center();
+  std::sort( tiles.begin(), tiles.end(), [this, &center]( const TileKey &a, const TileKey &b ) {
+    return tileExtent( a ).center().sqrDist( center ) < tileExtent( b ).center().sqrDist( center );
+  } );
+
+  mTileQueue.clear();
+  for ( const TileKey &key : std::as_const( tiles ) )
+  {
+    if ( mTileJob && mTileJobKey == key )
+      continue;
+
+    // Looking the tile up also marks it as recently used
+    const Tile *tile = mTileCache.object( key );
+    if ( !tile || tile->revision != mTileRevision )
+      mTileQueue << key;
+  }
+
+  update();
+
+  if ( mTileJob )
+    return;
+
+  if ( mTileQueue.isEmpty() )
+  {
+    composeTiledImage();
+    if ( !mSilentRefresh )
+      emit mapCanvasRefreshed();
+    else
+      mSilentRefresh = false;
+    return;
+  }
+
+  renderNextTile();
+
+  if ( !mSilentRefresh )
+  {
+    emit renderStarting();
+  }
+}
+
+void QgsQuickMapCanvasMap::renderNextTile()
+{
+  Q_ASSERT( !mTileJob );
+  if ( mTileQueue.isEmpty() )
+    return;
+
+  const TileKey key = mTileQueue.takeFirst();
+
+  const int tilePixels = static_cast<int>( std::ceil( sTileSize * mQuality ) );
+  QgsMapSettings mapSettings = prepareMapSettings();
+  mapSettings.setOutputSize( QSize( tilePixels, tilePixels ) );
+  mapSettings.setExtent( tileExtent( key ) );
+  // tiles are small enough to be shown once complete
+  mapSettings.setFlag( Qgis::MapSettingsFlag::RenderPartialOutput, false );
+
+  mTileJob = new QgsMapRendererParallelJob( mapSettings );
+  mTileJobKey = key;
+  mTileJobRevision = mTileRevision;
+  connect( mTileJob, &QgsMapRendererJob::finished, this, &QgsQuickMapCanvasMap::tileJobFinished );
+  mTileJob->start();
+}
+
+void QgsQuickMapCanvasMap::cancelTileJob()
+{
+  if ( !mTileJob )
+    return;
+
+  cancelRenderJob( mTileJob, this );
+  mTileJob = nullptr;
+}
+
+void QgsQuickMapCanvasMap::tileJobFinished()
+{
+  if ( !mTileJob )
+    return;
+
+  const QgsMapRendererJob::Errors errors = mTileJob->errors();
+  for ( const QgsMapRendererJob::Error &error : errors )
+  {
+    QgsMessageLog::logMessage( QStringLiteral( "%1 :: %2" ).arg( error.layerID, error.message ), tr( "Rendering" ) );
+  }
+
+  // An outdated tile is still kept, it will be displayed until its replacement is rendered
+  Tile *tile = new Tile { mTileJob->renderedImage(), mTileJobRevision };
+  mTileCache.insert( mTileJobKey, tile, std::max<qsizetype>( 1, tile->image.sizeInBytes() / 1024 ) );
+
+  // now we are in a slot called from mTileJob - do not delete it immediately
+  mTileJob->deleteLater();
+  mTileJob = nullptr;
+
+  update();
+
+  if ( !mTileQueue.isEmpty() )
+  {
+    renderNextTile();
+    return;
+  }
+
+  composeTiledImage();
+  if ( !mSilentRefresh )
+  {
+    emit mapCanvasRefreshed();
+  }
+  else
+  {
+    mSilentRefresh = false;
+  }
+
+  if ( mDeferredRefreshPending )
+  {
+    mDeferredRefreshPending = false;
+    mSilentRefresh = true;
+    refresh();
+  }
+}
+
+void QgsQuickMapCanvasMap::composeTiledImage()
+{
+  const QgsMapSettings mapSettings = mMapSettings->mapSettings();
+  if ( !mapSettings.hasValidSettings() )
+    return;
+
+  QImage image( mapSettings.outputSize(), QImage::Format_ARGB32_Premultiplied );
+  image.fill( Qt::transparent );
+
+  QPainter painter( &image );
+  painter.setRenderHint( QPainter::SmoothPixmapTransform );
+  const QgsMapToPixel &mapToPixel = mapSettings.mapToPixel();
+  const QList<TileKey> tiles = tilesForExtent( mapSettings.visibleExtent(), mTileScale );
+  for ( const TileKey &key : tiles )
+  {
+    const Tile *tile = mTileCache.object( key );
+    if ( !tile )
+      continue;
+
+    const QgsRectangle extent = tileExtent( key );
+    const QPointF topLeft = mapToPixel.transform( extent.xMinimum(), extent.yMaximum() ).toQPointF();
+    const QPointF bottomRight = mapToPixel.transform( extent.xMaximum(), extent.yMinimum() ).toQPointF();
+    painter.drawImage( QRectF( topLeft, bottomRight ), tile->image );
+  }
+  painter.end();
+
+  mImage = image;
+  mImageMapSettings = mapSettings;
+  mPreviousTileScale = mTileScale;
+}
+
+QSGNode *QgsQuickMapCanvasMap::updateTilesPaintNode( QSGNode *oldNode )
+{
+  QSGNode *root = oldNode;
+  if ( !root || mTileNodes.isEmpty() )
+  {
+    // Either the first tiled paint or a leftover single image node
+    delete root;
+    root = new QSGNode();
+    mTileNodes.clear();
+  }
+
+  const QgsMapSettings mapSettings = mMapSettings->mapSettings();
+  const QgsRectangle visibleExtent = mapSettings.visibleExtent();
+
+  // Tiles of the last completely rendered scale are laid underneath while the current scale is incomplete
+  QList<TileKey> tiles = tilesForExtent( visibleExtent, mTileScale );
+  bool complete = true;
+  for ( const TileKey &key : std::as_const( tiles ) )
+  {
+    if ( !mTileCache.contains( key ) )
+    {
+      complete = false;
+      break;
+    }
+  }
+  if ( !complete && mPreviousTileScale != mTileScale )
+    tiles = tilesForExtent( visibleExtent, mPreviousTileScale ) + tiles;
+
+  while ( QSGNode *child = root->firstChild() )
+    root->removeChildNode( child );
+
+  QHash<TileKey, TileNode> tileNodes;
+  for ( const TileKey &key : std::as_const( tiles ) )
+  {
+    const Tile *tile = mTileCache.object( key );
+    if ( !tile || tile->image.isNull() )
+      continue;
+
+    TileNode tileNode = mTileNodes.take( key );
+    if ( tileNode.node && tileNode.imageKey != tile->image.cacheKey() )
+    {
+      delete tileNode.node;
+      tileNode.node = nullptr;
+    }
+
+    if ( !tileNode.node )
+    {
+      tileNode.node = new QSGSimpleTextureNode();
+      tileNode.node->setFiltering( QSGTexture::Linear );
+      tileNode.node->setTexture( window()->createTextureFromImage( tile->image ) );
+      tileNode.node->setOwnsTexture( true );
+      tileNode.imageKey = tile->image.cacheKey();
+    }
+
+    const QgsRectangle extent = tileExtent( key );
+    const QPointF topLeft = mMapSettings->coordinateToScreen( QgsPoint( extent.xMinimum(), extent.yMaximum() ) );
+    const QPointF bottomRight = mMapSettings->coordinateToScreen( QgsPoint( extent.xMaximum(), extent.yMinimum() ) );
+    tileNode.node->setRect( QRectF( topLeft, bottomRight ) );
+
+    root->appendChildNode( tileNode.node );
+    tileNodes.insert( key, tileNode );
+  }
+
+  // Nodes of tiles no longer displayed
+  for ( const TileNode &tileNode : std::as_const( mTileNodes ) )
+    delete tileNode.node;
+  mTileNodes = tileNodes;
+
+  return root;
+}
@@ -18,7 +18,9 @@
 
 #include "qgsquickmapsettings.h"
 
+#include <QCache>
 #include <QFutureSynchronizer>
+#include <QHash>
 #include <QQuickItem>
 #include <QTimer>
 #include <qgsmapsettings.h>
@@ -29,6 +31,7 @@
 class QgsMapRendererParallelJob;
 class QgsMapRendererCache;
 class QgsLabelingResults;
+class QSGSimpleTextureNode;
 
 /**
  * This class implements a visual Qt Quick Item that does map rendering
@@ -108,6 +111,24 @@ class QgsQuickMapCanvasMap : public QQuickItem
      */
     Q_PROPERTY( double forceDeferredLayersRepaint READ forceDeferredLayersRepaint WRITE setForceDeferredLayersRepaint NOTIFY forceDeferredLayersRepaintChanged )
 
+    /**
+     * When the tiledRendering property is set to true, the map is rendered as a grid of tiles
+     * kept in a least recently used cache. Panning then only renders the tiles newly exposed
+     * and zooming shows the tiles of the previous scale until the new ones are ready.
+     *
+     * Tiled rendering is only used while the map is not rotated. Labels are placed per tile and
+     * can therefore be cut at tile edges.
+     */
+    Q_PROPERTY( bool tiledRendering READ tiledRendering WRITE setTiledRendering NOTIFY tiledRenderingChanged )
+
+    /**
+     * The margin, expressed as a ratio of the map canvas size, rendered around the visible
+     * extent in tiled rendering mode so that short pans do not reveal empty areas.
+     *
+     * By default, the value is set to 0.25. The value is clamped between 0.0 and 1.0.
+     */
+    Q_PROPERTY( double overscan READ overscan WRITE setOverscan NOTIFY overscanChanged )
+
   public:
     //! Create map canvas map
     explicit QgsQuickMapCanvasMap( QQuickItem *parent = nullptr );
@@ -151,6 +172,18 @@ class QgsQuickMapCanvasMap : public QQuickItem
     //!\copydoc QgsQuickMapCanvasMap::forceDeferredLayersRepaint
     void setForceDeferredLayersRepaint( bool deferred );
 
+    //!\copydoc QgsQuickMapCanvasMap::tiledRendering
+    bool tiledRendering() const;
+
+    //!\copydoc QgsQuickMapCanvasMap::tiledRendering
+    void setTiledRendering( bool tiledRendering );
+
+    //!\copydoc QgsQuickMapCanvasMap::overscan
+    double overscan() const;
+
+    //!\copydoc QgsQuickMapCanvasMap::overscan
+    void setOverscan( double overscan );
+
     //!\copydoc QgsQuickMapCanvasMap::bottomMargin
     double bottomMargin() const;
 
@@ -198,6 +231,12 @@ class QgsQuickMapCanvasMap : public QQuickItem
     //!\copydoc QgsQuickMapCanvasMap::forceDeferredLayersRepaint
     void forceDeferredLayersRepaintChanged();
 
+    //!\copydoc QgsQuickMapCanvasMap::tiledRendering
+    void tiledRenderingChanged();
+
+    //!\copydoc QgsQuickMapCanvasMap::overscan
+    void overscanChanged();
+
     //!\copydoc QgsQuickMapCanvasMap::bottomMargin
     void bottomMarginChanged();
 
@@ -242,9 +281,36 @@ class QgsQuickMapCanvasMap : public QQuickItem
     void onExtentChanged();
     void onRotationChanged();
     void onLayersChanged();
+    void onDestinationCrsChanged();
     void onTemporalStateChanged();
+    void tileJobFinished();
 
   private:
+    //! Identifies a tile of the grid anchored at the map origin for a given (quantized) scale
+    struct TileKey
+    {
+        qint64 scale = 0;
+        qint64 column = 0;
+        qint64 row = 0;
+
+        bool operator==( const TileKey &other ) const { return scale == other.scale && column == other.column && row == other.row; }
+        friend size_t qHash( const TileKey &key, size_t seed = 0 ) { return qHashMulti( seed, key.scale, key.column, key.row ); }
+    };
+
+    //! A rendered tile along with the layer-set revision it was rendered for, 0 once one of its layers changed
+    struct Tile
+    {
+        QImage image;
+        quint64 revision = 0;
+    };
+
+    //! A scene graph node displaying a tile, along with the image it was created from
+    struct TileNode
+    {
+        QSGSimpleTextureNode *node = nullptr;
+        qint64 imageKey = 0;
+    };
+
     /**
      * Should only be called by stopRendering()!
      */
@@ -254,6 +320,24 @@ class QgsQuickMapCanvasMap : public QQuickItem
     void zoomToFullExtent();
     void clearTemporalCache();
 
+    //! Returns TRUE if the map should currently be rendered as tiles
+    bool useTiles() const;
+    //! Marks all cached tiles as outdated, they remain displayed until re-rendered
+    void invalidateTiles();
+    //! Marks the cached tiles covering the current or previous extent of a \a layer as outdated, all of them without a layer
+    void invalidateLayerTiles( QgsMapLayer *layer );
+    //! Records the current extents of the layers, which their next repaint invalidates along with their new ones
+    void updateLayerExtents();
+    void refreshTiles();
+    void renderNextTile();
+    void cancelTileJob();
+    void composeTiledImage();
+    qint64 tileScale() const;
+    double tileMapSize( qint64 scale ) const;
+    QgsRectangle tileExtent( const TileKey &key ) const;
+    QList<TileKey> tilesForExtent( const QgsRectangle &extent, qint64 scale ) const;
+    QSGNode *updateTilesPaintNode( QSGNode *oldNode );
+
     std::unique_ptr<QgsQuickMapSettings> mMapSettings;
     bool mPinching = false;
     QPoint mPinchStartPoint;
@@ -273,6 +357,23 @@ class QgsQuickMapCanvasMap : public QQuickItem
     double mQuality = 1.0;
     bool mForceDeferredLayersRepaint = false;
 
+    bool mTiledRendering = false;
+    double mOverscan = 0.25;
+    QCache<TileKey, Tile> mTileCache;
+    quint64 mTileRevision = 1;
+    qint64 mTileScale = 0;
+    //! The last scale for which all visible tiles were rendered
+    qint64 mPreviousTileScale = 0;
+    QList<TileKey> mTileQueue;
+    QgsMapRendererParallelJob *mTileJob = nullptr;
+    TileKey mTileJobKey;
+    quint64 mTileJobRevision = 0;
+    //! Extents in destination CRS of the layers as of their last repaint, by layer id
+    QHash<QString, QgsRectangle> mLayerExtents;
+    bool mTilesDisplayed = false;
+    //! Nodes of the tiles currently displayed, only accessed from updatePaintNode()
+    QHash<TileKey, TileNode> mTileNodes;
+
     QQuickWindow *mWindow = nullptr;
 };
 
@@ -14,6 +14,7 @@
  *                                                                         *
  ***************************************************************************/
 
+#include "featurequeryexecutor.h"
 #include "referencingfeaturelistmodel.h"
 
 #include <qgsmessagelog.h>
@@ -24,6 +25,12 @@ ReferencingFeatureListModel::ReferencingFeatureListModel( QObject *parent )
 {
 }
 
+ReferencingFeatureListModel::~ReferencingFeatureListModel()
+{
+  if ( mGathererTicket )
+    FeatureQueryExecutor::instance()->cancel( mGathererTicket );
+}
+
 QHash<int, QByteArray> ReferencingFeatureListModel::roleNames() const
 {
   QHash<int, QByteArray> roles = QAbstractItemModel::roleNames();
@@ -151,12 +158,11 @@ bool ReferencingFeatureListModel::parentPrimariesAvailable() const
   return mParentPrimariesAvailable;
 }
 
-void ReferencingFeatureListModel::updateModel()
+void ReferencingFeatureListModel::updateModel( const QList<Entry> &entries )
 {
   beginResetModel();
 
-  if ( mGatherer )
-    mEntries = mGatherer->entries();
+  mEntries = entries;
 
   sortEntries();
 
@@ -164,17 +170,6 @@ void ReferencingFeatureListModel::updateModel()
   emit modelUpdated();
 }
 
-void ReferencingFeatureListModel::gathererThreadFinished()
-{
-  //ignore spooky signals from ancestor threads
-  if ( sender() != mGatherer )
-    return;
-
-  mGatherer->deleteLater();
-  mGatherer = nullptr;
-  emit isLoadingChanged();
-}
-
 void ReferencingFeatureListModel::reload()
 {
   if ( !mRelation.isValid() || !mFeature.isValid() )
@@ -184,23 +179,31 @@ void ReferencingFeatureListModel::reload()
   {
     bool wasLoading = false;
 
-    if ( mGatherer )
+    if ( mGathererTicket )
     {
-      // Send the gatherer thread to the graveyard:
-      //   forget about it, tell it to stop and delete when finished
-      disconnect( mGatherer, &FeatureGatherer::collectedValues, this, &ReferencingFeatureListModel::updateModel );
-      disconnect( mGatherer, &FeatureGatherer::finished, this, &ReferencingFeatureListModel::gathererThreadFinished );
-      connect( mGatherer, &FeatureGatherer::finished, mGatherer, &FeatureGatherer::deleteLater );
-      mGatherer->stop();
+      // Forget about the pending query, it stops unless another model waits for the same features
+      FeatureQueryExecutor::instance()->cancel( mGathererTicket );
       wasLoading = true;
     }
 
-    mGatherer = new FeatureGatherer( mFeature, mRelation, mNmRelation );
+    auto gatherer = std::make_shared<FeatureGatherer>( mFeature, mRelation, mNmRelation );
+
+    FeatureQueryExecutor::Query query;
+    query.key = gatherer->key();
+    query.layers << mRelation.referencingLayer();
+    if ( mNmRelation.isValid() )
+      query.layers << mNmRelation.referencedLayer();
 
-    connect( mGatherer, &FeatureGatherer::collectedValues, this, &ReferencingFeatureListModel::updateModel );
-    connect( mGatherer, &FeatureGatherer::finished, this, &ReferencingFeatureListModel::gathererThreadFinished );
+    mGathererTicket = FeatureQueryExecutor::instance()->submit<QList<Entry>>(
+      query,
+      [gatherer]( QgsFeedback *feedback ) { return gatherer->gather( feedback ); },
+      this,
+      [this]( const QList<Entry> &entries ) {
+        mGathererTicket = 0;
+        updateModel( entries );
+        emit isLoadingChanged();
+      } );
 
-    mGatherer->start();
     if ( !wasLoading )
       emit isLoadingChanged();
   }
@@ -275,7 +278,7 @@ int ReferencingFeatureListModel::getFeatureIdRow( QgsFeatureId featureId )
 
 bool ReferencingFeatureListModel::isLoading() const
 {
-  return mGatherer;
+  return mGathererTicket != 0;
 }
 
 bool ReferencingFeatureListModel::checkParentPrimaries()
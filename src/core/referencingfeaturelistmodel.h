@@ -25,7 +25,8 @@
 //used for gatherer
 #include "qfield_core_export.h"
 
-#include <QThread>
+#include <qgsfeedback.h>
+#include <qgsvectorlayerfeatureiterator.h>
 
 class QgsVectorLayer;
 class FeatureGatherer;
@@ -48,6 +49,7 @@ class QFIELD_CORE_EXPORT ReferencingFeatureListModel : public QAbstractItemModel
 
   public:
     explicit ReferencingFeatureListModel( QObject *parent = nullptr );
+    ~ReferencingFeatureListModel() override;
 
     enum ReferencedFeatureListRoles
     {
@@ -165,10 +167,6 @@ class QFIELD_CORE_EXPORT ReferencingFeatureListModel : public QAbstractItemModel
     void isLoadingChanged();
     void modelUpdated();
 
-  private slots:
-    void updateModel();
-    void gathererThreadFinished();
-
   private:
     struct Entry
     {
@@ -193,7 +191,10 @@ class QFIELD_CORE_EXPORT ReferencingFeatureListModel : public QAbstractItemModel
     QgsRelation mNmRelation;
     bool mParentPrimariesAvailable = false;
 
-    FeatureGatherer *mGatherer = nullptr;
+    //! Ticket of the gathering query submitted to the FeatureQueryExecutor, 0 when none is pending
+    quint64 mGathererTicket = 0;
+
+    void updateModel( const QList<Entry> &entries );
 
     //! Checks if the parent pk(s) is not null
     bool checkParentPrimaries();
@@ -205,22 +206,20 @@ class QFIELD_CORE_EXPORT ReferencingFeatureListModel : public QAbstractItemModel
     friend class TestReferencingFeatureListModel;
 };
 
-class FeatureGatherer : public QThread
+/**
+ * Gathers the features referencing a feature through a relation, along with the features
+ * they reference through a second relation for many-to-many relations.
+ * Gathering runs synchronously, gatherers are meant to be handed to the FeatureQueryExecutor.
+ * \ingroup core
+ */
+class FeatureGatherer
 {
-    Q_OBJECT
-
   public:
     FeatureGatherer( QgsFeature &feature, QgsRelation relation, QgsRelation nmRelation = QgsRelation() )
       : mFeature( feature )
       , mRelation( relation )
       , mNmRelation( nmRelation )
     {
-    }
-
-    void run() override
-    {
-      mWasCanceled = false;
-
       const bool featureIsNew = std::numeric_limits<QgsFeatureId>::min() == mFeature.id();
       if ( featureIsNew )
       {
@@ -239,68 +238,84 @@ class FeatureGatherer : public QThread
         }
       }
 
-      QgsFeatureIterator relatedFeaturesIt = mRelation.getRelatedFeatures( mFeature );
-      QgsExpressionContext context = mRelation.referencingLayer()->createExpressionContext();
-      QgsExpression expression( mRelation.referencingLayer()->displayExpression() );
+      // Layers are only read through sources snapshotted here, on the thread owning them
+      mRequest = mRelation.getRelatedFeaturesRequest( mFeature );
+      mSource.reset( new QgsVectorLayerFeatureSource( mRelation.referencingLayer() ) );
+      mContext = mRelation.referencingLayer()->createExpressionContext();
+      mExpression = QgsExpression( mRelation.referencingLayer()->displayExpression() );
+
+      if ( mNmRelation.isValid() )
+      {
+        mNmSource.reset( new QgsVectorLayerFeatureSource( mNmRelation.referencedLayer() ) );
+        mNmContext = mNmRelation.referencedLayer()->createExpressionContext();
+        mNmExpression = QgsExpression( mNmRelation.referencedLayer()->displayExpression() );
+      }
+    }
+
+    /**
+     * Gathers the entries of the related features, stopping early when the \a feedback
+     * is canceled. Can be called from any thread, one call at a time.
+     */
+    QList<ReferencingFeatureListModel::Entry> gather( QgsFeedback *feedback = nullptr )
+    {
+      QList<ReferencingFeatureListModel::Entry> entries;
+
+      QgsFeatureRequest request( mRequest );
+      if ( feedback )
+        request.setFeedback( feedback );
+
+      QgsFeatureIterator relatedFeaturesIt = mSource->getFeatures( request );
 
       QgsFeature childFeature;
       QString displayString;
       while ( relatedFeaturesIt.nextFeature( childFeature ) )
       {
-        context.setFeature( childFeature );
-        displayString = expression.evaluate( &context ).toString();
+        mContext.setFeature( childFeature );
+        displayString = mExpression.evaluate( &mContext ).toString();
 
         QgsFeature nmFeature;
         QString nmDisplayString;
-        if ( mNmRelation.isValid() )
+        if ( mNmSource )
         {
-          QgsExpressionContext nmContext = mNmRelation.referencedLayer()->createExpressionContext();
-          QgsExpression nmExpression( mNmRelation.referencedLayer()->displayExpression() );
-
-          nmFeature = mNmRelation.getReferencedFeature( childFeature );
-          nmContext.setFeature( nmFeature );
-          nmDisplayString = nmExpression.evaluate( &nmContext ).toString();
+          mNmSource->getFeatures( mNmRelation.getReferencedFeatureRequest( childFeature ) ).nextFeature( nmFeature );
+          mNmContext.setFeature( nmFeature );
+          nmDisplayString = mNmExpression.evaluate( &mNmContext ).toString();
         }
 
-        //test sleep(1);
-        mEntries.append( ReferencingFeatureListModel::Entry( displayString, childFeature, nmDisplayString, nmFeature ) );
+        entries.append( ReferencingFeatureListModel::Entry( displayString, childFeature, nmDisplayString, nmFeature ) );
 
-        if ( mWasCanceled )
-          return;
+        if ( feedback && feedback->isCanceled() )
+          break;
       }
 
-      emit collectedValues();
+      return entries;
     }
 
-    //! Informs the gatherer to immediately stop collecting values
-    void stop()
+    //! Returns a key describing what is gathered, identical for gatherers returning identical entries
+    QString key() const
     {
-      mWasCanceled = true;
+      QStringList parts;
+      parts << mRelation.id()
+            << mNmRelation.id()
+            << mRequest.filterExpression()
+            << mExpression.expression()
+            << mNmExpression.expression();
+      return parts.join( QChar( 0x1f ) );
     }
 
-    //! \returns true if collection was canceled before completion
-    bool wasCanceled() const { return mWasCanceled; }
-
-    //! \returns the list of entries
-    QList<ReferencingFeatureListModel::Entry> entries() const { return mEntries; }
-
-  signals:
-
-    /**
-     * Emitted when values have been collected
-     * \param values list of unique matching string values
-     */
-    void collectedValues();
-
   private:
-    QList<ReferencingFeatureListModel::Entry> mEntries;
-
     QgsFeature mFeature;
     QgsRelation mRelation;
     QgsRelation mNmRelation;
 
     QgsFeatureRequest mRequest;
-    bool mWasCanceled = false;
+    std::unique_ptr<QgsVectorLayerFeatureSource> mSource;
+    QgsExpressionContext mContext;
+    QgsExpression mExpression;
+
+    std::unique_ptr<QgsVectorLayerFeatureSource> mNmSource;
+    QgsExpressionContext mNmContext;
+    QgsExpression mNmExpression;
 };
 
 #endif // REFERENCINGFEATURELISTMODEL_H
@@ -0,0 +1,135 @@
+/***************************************************************************
+  ringbuffer.h - RingBuffer
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef RINGBUFFER_H
+#define RINGBUFFER_H
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+
+/**
+ * \brief A bounded lock-free queue which any number of threads can push to and pop from.
+ *
+ * Each slot carries a sequence number telling whether it is ready to be written or read,
+ * producers and consumers only contend on a single atomic position each. Pushing to a
+ * full buffer fails instead of blocking or growing it.
+ * \ingroup core
+ */
+template<typename T>
+class RingBuffer
+{
+  public:
+    //! Creates a ring buffer holding at least \a capacity items, rounded up to a power of two
+    explicit RingBuffer( std::size_t capacity )
+    {
+      std::size_t size = 2;
+      while ( size < capacity )
+        size <<= 1;
+
+      mCells = std::make_unique<Cell[]>( size );
+      mMask = size - 1;
+      for ( std::size_t i = 0; i < size; ++i )
+        mCells[i].sequence.store( i, std::memory_order_relaxed );
+    }
+
+    RingBuffer( const RingBuffer & ) = delete;
+    RingBuffer &operator=( const RingBuffer & ) = delete;
+
+    //! Returns the number of items the buffer holds
+    std::size_t capacity() const { return mMask + 1; }
+
+    /**
+     * Pushes a \a value to the buffer.
+     * \returns FALSE if the buffer is full, in which case the value is discarded
+     */
+    bool push( T value )
+    {
+      Cell *cell = nullptr;
+      std::size_t position = mEnqueuePosition.load( std::memory_order_relaxed );
+      for ( ;; )
+      {
+        cell = &mCells[position & mMask];
+        const std::size_t sequence = cell->sequence.load( std::memory_order_acquire );
+        const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>( sequence ) - static_cast<std::ptrdiff_t>( position );
+        if ( difference == 0 )
+        {
+          if ( mEnqueuePosition.compare_exchange_weak( position, position + 1, std::memory_order_relaxed ) )
+            break;
+        }
+        else if ( difference < 0 )
+        {
+          return false;
+        }
+        else
+        {
+          position = mEnqueuePosition.load( std::memory_order_relaxed );
+        }
+      }
+
+      cell->value = std::move( value );
+      cell->sequence.store( position + 1, std::memory_order_release );
+      return true;
+    }
+
+    /**
+     * Pops the oldest item of the buffer into \a value.
+     * \returns FALSE if the buffer is empty
+     */
+    bool pop( T &value )
+    {
+      Cell *cell = nullptr;
+      std::size_t position = mDequeuePosition.load( std::memory_order_relaxed );
+      for ( ;; )
+      {
+        cell = &mCells[position & mMask];
+        const std::size_t sequence = cell->sequence.load( std::memory_order_acquire );
+        const std::ptrdiff_t difference = static_cast<std::ptrdiff_t>( sequence ) - static_cast<std::ptrdiff_t>( position + 1 );
+        if ( difference == 0 )
+        {
+          if ( mDequeuePosition.compare_exchange_weak( position, position + 1, std::memory_order_relaxed ) )
+            break;
+        }
+        else if ( difference < 0 )
+        {
+          return false;
+        }
+        else
+        {
+          position = mDequeuePosition.load( std::memory_order_relaxed );
+        }
+      }
+
+      value = std::move( cell->value );
+      // Don't keep the popped value alive until the slot gets reused
+      cell->value = T();
+      cell->sequence.store( position + mMask + 1, std::memory_order_release );
+      return true;
+    }
+
+  private:
+    struct Cell
+    {
+        std::atomic<std::size_t> sequence { 0 };
+        T value;
+    };
+
+    std::unique_ptr<Cell[]> mCells;
+    std::size_t mMask = 0;
+    alignas( 64 ) std::atomic<std::size_t> mEnqueuePosition { 0 };
+    alignas( 64 ) std::atomic<std::size_t> mDequeuePosition { 0 };
+};
+
+#endif // RINGBUFFER_H
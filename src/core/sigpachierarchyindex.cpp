@@ -0,0 +1,453 @@
+/***************************************************************************
+  sigpachierarchyindex.cpp - SigpacHierarchyIndex
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "sigpachierarchyindex.h"
+#include "layerobserver.h"
+
+#include <QDataStream>
+#include <QDateTime>
+#include <QFile>
+#include <QFileInfo>
+#include <QSaveFile>
+#include <qgscoordinatetransform.h>
+#include <qgsproject.h>
+#include <qgsproviderregistry.h>
+
+static const quint32 sIndexFileMagic = 0x53484958; // "SHIX"
+static const quint32 sIndexFileVersion = 1;
+
+// Alternative field names used by the different SIGPAC recinto layer flavors, ordered from province to recinto
+static const QList<QStringList> sCodeFieldNames = {
+  { QStringLiteral( "CD_PROV" ), QStringLiteral( "provincia" ) },
+  { QStringLiteral( "CD_MUN" ), QStringLiteral( "municipio" ) },
+  { QStringLiteral( "CD_POL" ), QStringLiteral( "poligono" ) },
+  { QStringLiteral( "CD_PARCELA" ), QStringLiteral( "parcela" ) },
+  { QStringLiteral( "CD_RECINTO" ), QStringLiteral( "recinto" ) },
+};
+
+QDataStream &operator<<( QDataStream &stream, const SigpacHierarchyNode &node )
+{
+  stream << node.extent.xMinimum() << node.extent.yMinimum() << node.extent.xMaximum() << node.extent.yMaximum();
+  stream << static_cast<qint64>( node.featureId ) << node.children;
+  return stream;
+}
+
+QDataStream &operator>>( QDataStream &stream, SigpacHierarchyNode &node )
+{
+  double xMinimum, yMinimum, xMaximum, yMaximum;
+  qint64 featureId;
+  stream >> xMinimum >> yMinimum >> xMaximum >> yMaximum >> featureId >> node.children;
+  node.extent = QgsRectangle( xMinimum, yMinimum, xMaximum, yMaximum, false );
+  node.featureId = featureId;
+  return stream;
+}
+
+namespace
+{
+  //! Inserts a \a feature below the \a root at the path of its codes read from \a fieldIndexes, as far as they are valid
+  void insertFeature( SigpacHierarchyNode &root, const QgsFeature &feature, const QList<int> &fieldIndexes )
+  {
+    if ( !feature.hasGeometry() )
+      return;
+
+    const QgsRectangle boundingBox = feature.geometry().boundingBox();
+    SigpacHierarchyNode *node = &root;
+    node->extent.combineExtentWith( boundingBox );
+
+    for ( const int fieldIndex : fieldIndexes )
+    {
+      bool ok = false;
+      const int code = feature.attribute( fieldIndex ).toInt( &ok );
+      if ( !ok )
+        return;
+
+      node = &node->children[code];
+      node->extent.combineExtentWith( boundingBox );
+    }
+
+    node->featureId = feature.id();
+  }
+
+  //! Removes the leaf at a given \a path below the \a root, along with the nodes left empty, and shrinks the extents above it
+  void removePath( SigpacHierarchyNode &root, const QList<int> &path )
+  {
+    QList<SigpacHierarchyNode *> nodes { &root };
+    for ( const int code : path )
+    {
+      auto it = nodes.last()->children.find( code );
+      if ( it == nodes.last()->children.end() )
+        return;
+      nodes << &it.value();
+    }
+
+    nodes.last()->featureId = FID_NULL;
+    nodes.last()->extent = QgsRectangle();
+    for ( int i = path.size(); i >= 0; i-- )
+    {
+      SigpacHierarchyNode *node = nodes.at( i );
+      if ( i > 0 && node->featureId == FID_NULL && node->children.isEmpty() )
+      {
+        nodes.at( i - 1 )->children.remove( path.at( i - 1 ) );
+        continue;
+      }
+
+      if ( node->featureId == FID_NULL )
+      {
+        QgsRectangle extent;
+        for ( auto it = node->children.constBegin(); it != node->children.constEnd(); ++it )
+          extent.combineExtentWith( it->extent );
+        node->extent = extent;
+      }
+    }
+  }
+
+  //! Returns the paths below the \a root of the leaves holding one of the given \a fids
+  QList<QList<int>> leafPaths( const SigpacHierarchyNode &root, const QgsFeatureIds &fids )
+  {
+    QList<QList<int>> paths;
+    QList<QPair<const SigpacHierarchyNode *, QList<int>>> stack { qMakePair( &root, QList<int>() ) };
+    while ( !stack.isEmpty() )
+    {
+      const QPair<const SigpacHierarchyNode *, QList<int>> current = stack.takeLast();
+      if ( current.first->featureId != FID_NULL && fids.contains( current.first->featureId ) )
+        paths << current.second;
+
+      for ( auto it = current.first->children.constBegin(); it != current.first->children.constEnd(); ++it )
+        stack << qMakePair( &it.value(), current.second + QList<int> { it.key() } );
+    }
+    return paths;
+  }
+} // namespace
+
+
+SigpacHierarchyIndexBuilder::SigpacHierarchyIndexBuilder( QgsVectorLayer *layer, const QString &indexFilePath )
+  : mSource( new QgsVectorLayerFeatureSource( layer ) )
+  , mIndexFilePath( indexFilePath )
+{
+  const QStringList fieldNames = SigpacHierarchyIndex::codeFieldNames( layer );
+  for ( const QString &fieldName : fieldNames )
+  {
+    mFieldIndexes << layer->fields().lookupField( fieldName );
+  }
+
+  if ( !mIndexFilePath.isEmpty() )
+  {
+    // The index is only reused while the data source and its write-ahead log are untouched
+    const QVariantMap parts = QgsProviderRegistry::instance()->decodeUri( layer->providerType(), layer->source() );
+    const QString path = parts.value( QStringLiteral( "path" ) ).toString();
+    const QFileInfo fileInfo( path );
+    const QFileInfo walFileInfo( QStringLiteral( "%1-wal" ).arg( path ) );
+    mSourceStamp = QStringLiteral( "%1|%2|%3|%4" ).arg( QString::number( fileInfo.size() ), QString::number( fileInfo.lastModified().toMSecsSinceEpoch() ), QString::number( walFileInfo.exists() ? walFileInfo.lastModified().toMSecsSinceEpoch() : 0 ), layer->subsetString() );
+  }
+}
+
+void SigpacHierarchyIndexBuilder::run()
+{
+  if ( readIndexFile() )
+    return;
+
+  QgsFeatureRequest request;
+  request.setSubsetOfAttributes( mFieldIndexes );
+
+  QgsFeatureIterator iterator = mSource->getFeatures( request );
+  QgsFeature feature;
+  while ( iterator.nextFeature( feature ) )
+  {
+    if ( wasCanceled() )
+      return;
+
+    insertFeature( mRoot, feature, mFieldIndexes );
+  }
+
+  if ( !wasCanceled() )
+  {
+    writeIndexFile();
+  }
+}
+
+void SigpacHierarchyIndexBuilder::stop()
+{
+  QMutexLocker locker( &mCancelMutex );
+  mWasCanceled = true;
+}
+
+bool SigpacHierarchyIndexBuilder::wasCanceled() const
+{
+  QMutexLocker locker( &mCancelMutex );
+  return mWasCanceled;
+}
+
+bool SigpacHierarchyIndexBuilder::readIndexFile()
+{
+  if ( mIndexFilePath.isEmpty() )
+    return false;
+
+  QFile file( mIndexFilePath );
+  if ( !file.open( QIODevice::ReadOnly ) )
+    return false;
+
+  QDataStream stream( &file );
+  stream.setVersion( QDataStream::Qt_6_0 );
+
+  quint32 magic = 0;
+  quint32 version = 0;
+  QString sourceStamp;
+  stream >> magic >> version >> sourceStamp;
+  if ( stream.status() != QDataStream::Ok || magic != sIndexFileMagic || version != sIndexFileVersion || sourceStamp != mSourceStamp )
+    return false;
+
+  SigpacHierarchyNode root;
+  stream >> root;
+  if ( stream.status() != QDataStream::Ok )
+    return false;
+
+  mRoot = root;
+  return true;
+}
+
+void SigpacHierarchyIndexBuilder::writeIndexFile() const
+{
+  if ( mIndexFilePath.isEmpty() )
+    return;
+
+  QSaveFile file( mIndexFilePath );
+  if ( !file.open( QIODevice::WriteOnly ) )
+    return;
+
+  QDataStream stream( &file );
+  stream.setVersion( QDataStream::Qt_6_0 );
+  stream << sIndexFileMagic << sIndexFileVersion << mSourceStamp << mRoot;
+  file.commit();
+}
+
+
+SigpacHierarchyIndex::SigpacHierarchyIndex( QObject *parent )
+  : QObject( parent )
+{
+}
+
+SigpacHierarchyIndex::~SigpacHierarchyIndex()
+{
+  cleanupBuilder();
+}
+
+void SigpacHierarchyIndex::setVectorLayer( QgsVectorLayer *layer )
+{
+  if ( mVectorLayer == layer )
+    return;
+
+  mVectorLayer = layer;
+  emit vectorLayerChanged();
+
+  cleanupBuilder();
+
+  mRoot = SigpacHierarchyNode();
+  if ( mReady )
+  {
+    mReady = false;
+    emit readyChanged();
+  }
+
+  build();
+}
+
+void SigpacHierarchyIndex::setLayerObserver( LayerObserver *layerObserver )
+{
+  if ( mLayerObserver == layerObserver )
+    return;
+
+  if ( mLayerObserver )
+    disconnect( mLayerObserver, &LayerObserver::featuresCommitted, this, &SigpacHierarchyIndex::onFeaturesCommitted );
+
+  mLayerObserver = layerObserver;
+
+  if ( mLayerObserver )
+    connect( mLayerObserver, &LayerObserver::featuresCommitted, this, &SigpacHierarchyIndex::onFeaturesCommitted );
+
+  emit layerObserverChanged();
+}
+
+void SigpacHierarchyIndex::build()
+{
+  cleanupBuilder();
+
+  if ( !mVectorLayer || !mVectorLayer->isValid() || codeFieldNames( mVectorLayer ).isEmpty() )
+    return;
+
+  QString indexFilePath;
+  const QVariantMap parts = QgsProviderRegistry::instance()->decodeUri( mVectorLayer->providerType(), mVectorLayer->source() );
+  const QString path = parts.value( QStringLiteral( "path" ) ).toString();
+  if ( !path.isEmpty() && QFileInfo( QFileInfo( path ).absolutePath() ).isWritable() )
+  {
+    const QString layerName = parts.value( QStringLiteral( "layerName" ) ).toString();
+    indexFilePath = QStringLiteral( "%1.%2.sigpacindex" ).arg( path, layerName.isEmpty() ? QStringLiteral( "default" ) : layerName );
+  }
+
+  mBuilder = new SigpacHierarchyIndexBuilder( mVectorLayer, indexFilePath );
+  connect( mBuilder, &QThread::finished, this, &SigpacHierarchyIndex::builderFinished );
+  mBuilder->start();
+}
+
+void SigpacHierarchyIndex::onFeaturesCommitted( const QString &layerId, const QgsFeatureIds &addedFids, const QgsFeatureIds &changedFids, const QgsFeatureIds &deletedFids )
+{
+  if ( !mVectorLayer || mVectorLayer->id() != layerId )
+    return;
+
+  // A pending build may have missed the commit, large commits are quicker to rebuild
+  const QgsFeatureIds fids = addedFids | changedFids | deletedFids;
+  if ( mBuilder || !mReady || fids.size() > MaximumPatchedFeatures )
+  {
+    build();
+    return;
+  }
+
+  // The persisted index is left as is, the changed data source no longer matching its stamp
+  const QList<QList<int>> paths = leafPaths( mRoot, changedFids | deletedFids );
+  for ( const QList<int> &path : paths )
+    removePath( mRoot, path );
+
+  QList<int> fieldIndexes;
+  const QStringList fieldNames = codeFieldNames( mVectorLayer );
+  for ( const QString &fieldName : fieldNames )
+    fieldIndexes << mVectorLayer->fields().lookupField( fieldName );
+
+  QgsFeatureRequest request( ( addedFids | changedFids ) - deletedFids );
+  request.setSubsetOfAttributes( fieldIndexes );
+  QgsFeatureIterator iterator = mVectorLayer->getFeatures( request );
+  QgsFeature feature;
+  while ( iterator.nextFeature( feature ) )
+    insertFeature( mRoot, feature, fieldIndexes );
+}
+
+void SigpacHierarchyIndex::cleanupBuilder()
+{
+  if ( mBuilder )
+  {
+    disconnect( mBuilder, &QThread::finished, this, &SigpacHierarchyIndex::builderFinished );
+    connect( mBuilder, &QThread::finished, mBuilder, &QObject::deleteLater );
+    mBuilder->stop();
+    mBuilder = nullptr;
+  }
+}
+
+void SigpacHierarchyIndex::builderFinished()
+{
+  if ( !mBuilder )
+    return;
+
+  mRoot = mBuilder->root();
+  mBuilder->deleteLater();
+  mBuilder = nullptr;
+
+  if ( !mReady )
+  {
+    mReady = true;
+    emit readyChanged();
+  }
+}
+
+QStringList SigpacHierarchyIndex::codeFieldNames( const QgsVectorLayer *layer )
+{
+  QStringList fieldNames;
+  if ( !layer )
+    return fieldNames;
+
+  const QgsFields fields = layer->fields();
+  for ( const QStringList &alternatives : sCodeFieldNames )
+  {
+    auto match = std::find_if( alternatives.constBegin(), alternatives.constEnd(), [&fields]( const QString &name ) { return fields.lookupField( name ) >= 0; } );
+    if ( match == alternatives.constEnd() )
+      return QStringList();
+
+    fieldNames << *match;
+  }
+
+  return fieldNames;
+}
+
+const SigpacHierarchyNode *SigpacHierarchyIndex::node( const QVariantList &path ) const
+{
+  const SigpacHierarchyNode *node = &mRoot;
+  for ( const QVariant &code : path )
+  {
+    auto it = node->children.constFind( code.toInt() );
+    if ( it == node->children.constEnd() )
+      return nullptr;
+
+    node = &it.value();
+  }
+
+  return node;
+}
+
+QVariantList SigpacHierarchyIndex::values( const QVariantList &path ) const
+{
+  QVariantList codes;
+  if ( const SigpacHierarchyNode *parent = node( path ) )
+  {
+    const QList<int> keys = parent->children.keys();
+    codes.reserve( keys.size() );
+    for ( const int key : keys )
+    {
+      codes << key;
+    }
+  }
+
+  return codes;
+}
+
+QgsRectangle SigpacHierarchyIndex::extent( const QVariantList &path, const QgsCoordinateReferenceSystem &destinationCrs ) const
+{
+  const SigpacHierarchyNode *parent = node( path );
+  if ( !parent || parent->extent.isNull() )
+    return QgsRectangle();
+
+  if ( !destinationCrs.isValid() || !mVectorLayer || destinationCrs == mVectorLayer->crs() )
+    return parent->extent;
+
+  try
+  {
+    QgsCoordinateTransform transform( mVectorLayer->crs(), destinationCrs, QgsProject::instance()->transformContext() );
+    return transform.transformBoundingBox( parent->extent );
+  }
+  catch ( const QgsCsException & )
+  {
+    return QgsRectangle();
+  }
+}
+
+QVariantList SigpacHierarchyIndex::featureIds( const QVariantList &path ) const
+{
+  QVariantList ids;
+  const SigpacHierarchyNode *parent = node( path );
+  if ( !parent )
+    return ids;
+
+  QList<const SigpacHierarchyNode *> stack { parent };
+  while ( !stack.isEmpty() )
+  {
+    const SigpacHierarchyNode *current = stack.takeLast();
+    if ( current->featureId != FID_NULL )
+    {
+      ids << current->featureId;
+    }
+    for ( auto it = current->children.constBegin(); it != current->children.constEnd(); ++it )
+    {
+      stack << &it.value();
+    }
+  }
+
+  return ids;
+}
@@ -0,0 +1,166 @@
+/***************************************************************************
+  sigpachierarchyindex.h - SigpacHierarchyIndex
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef SIGPACHIERARCHYINDEX_H
+#define SIGPACHIERARCHYINDEX_H
+
+#include <QMap>
+#include <QMutex>
+#include <QObject>
+#include <QPointer>
+#include <QThread>
+#include <qgsrectangle.h>
+#include <qgsvectorlayer.h>
+#include <qgsvectorlayerfeatureiterator.h>
+
+#include <memory>
+
+class LayerObserver;
+class QDataStream;
+
+/**
+ * A node of the SIGPAC code hierarchy holding the extent of all features below it.
+ * Leaf nodes (recintos) also hold the identifier of their feature.
+ * \ingroup core
+ */
+struct SigpacHierarchyNode
+{
+    QgsRectangle extent;
+    QgsFeatureId featureId = FID_NULL;
+    QMap<int, SigpacHierarchyNode> children;
+};
+
+QDataStream &operator<<( QDataStream &stream, const SigpacHierarchyNode &node );
+QDataStream &operator>>( QDataStream &stream, SigpacHierarchyNode &node );
+
+/**
+ * Builds the SIGPAC code hierarchy of a recinto layer in a background thread, reusing
+ * the index persisted next to the layer's data source when it is still up to date.
+ * \ingroup core
+ */
+class SigpacHierarchyIndexBuilder : public QThread
+{
+    Q_OBJECT
+
+  public:
+    SigpacHierarchyIndexBuilder( QgsVectorLayer *layer, const QString &indexFilePath );
+
+    void run() override;
+
+    //! Informs the builder to immediately stop
+    void stop();
+
+    //! Returns the built hierarchy root
+    SigpacHierarchyNode root() const { return mRoot; }
+
+  private:
+    bool readIndexFile();
+    void writeIndexFile() const;
+    bool wasCanceled() const;
+
+    std::unique_ptr<QgsVectorLayerFeatureSource> mSource;
+    QList<int> mFieldIndexes;
+    QString mIndexFilePath;
+    QString mSourceStamp;
+
+    SigpacHierarchyNode mRoot;
+
+    bool mWasCanceled = false;
+    mutable QMutex mCancelMutex;
+};
+
+/**
+ * Provides instant drilling through the province, municipality, polygon, parcel and recinto
+ * codes of a SIGPAC recinto layer from an in-memory prefix tree.
+ *
+ * Commits reported by the layer observer are patched into the tree, the entries of the
+ * modified and deleted features being replaced by the ones of their committed state.
+ * \ingroup core
+ */
+class SigpacHierarchyIndex : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY( QgsVectorLayer *vectorLayer READ vectorLayer WRITE setVectorLayer NOTIFY vectorLayerChanged )
+    Q_PROPERTY( LayerObserver *layerObserver READ layerObserver WRITE setLayerObserver NOTIFY layerObserverChanged )
+    Q_PROPERTY( bool ready READ ready NOTIFY readyChanged )
+
+  public:
+    explicit SigpacHierarchyIndex( QObject *parent = nullptr );
+    ~SigpacHierarchyIndex() override;
+
+    //! Returns the recinto layer being indexed
+    QgsVectorLayer *vectorLayer() const { return mVectorLayer.data(); }
+
+    //! Sets the recinto layer to be indexed, the index is built in the background
+    void setVectorLayer( QgsVectorLayer *layer );
+
+    //! Returns the layer observer reporting the commits to patch into the index
+    LayerObserver *layerObserver() const { return mLayerObserver.data(); }
+
+    //! Sets the layer observer reporting the commits to patch into the index
+    void setLayerObserver( LayerObserver *layerObserver );
+
+    //! Returns TRUE once the index has been built and can be queried
+    bool ready() const { return mReady; }
+
+    /**
+     * Returns the sorted codes found directly below a given \a path of codes. An empty path
+     * returns the provinces, a province returns its municipalities, etc.
+     */
+    Q_INVOKABLE QVariantList values( const QVariantList &path = QVariantList() ) const;
+
+    /**
+     * Returns the extent of all the features below a given \a path of codes, transformed
+     * into the \a destinationCrs when valid.
+     */
+    Q_INVOKABLE QgsRectangle extent( const QVariantList &path, const QgsCoordinateReferenceSystem &destinationCrs = QgsCoordinateReferenceSystem() ) const;
+
+    //! Returns the identifiers of all the features below a given \a path of codes
+    Q_INVOKABLE QVariantList featureIds( const QVariantList &path ) const;
+
+    /**
+     * Returns the names of the fields holding the province, municipality, polygon, parcel and
+     * recinto codes in \a layer, or an empty list if the layer is not a SIGPAC recinto layer.
+     */
+    static QStringList codeFieldNames( const QgsVectorLayer *layer );
+
+  signals:
+    void vectorLayerChanged();
+    void layerObserverChanged();
+    void readyChanged();
+
+  private slots:
+    void builderFinished();
+    void onFeaturesCommitted( const QString &layerId, const QgsFeatureIds &addedFids, const QgsFeatureIds &changedFids, const QgsFeatureIds &deletedFids );
+
+  private:
+    //! Maximum number of features a commit touches for them to be patched into the index rather than rebuilding it
+    static constexpr int MaximumPatchedFeatures = 500;
+
+    //! Builds the index of the vector layer in the background, the current one being served meanwhile
+    void build();
+    void cleanupBuilder();
+    const SigpacHierarchyNode *node( const QVariantList &path ) const;
+
+    QPointer<QgsVectorLayer> mVectorLayer;
+    QPointer<LayerObserver> mLayerObserver;
+    SigpacHierarchyNode mRoot;
+    bool mReady = false;
+
+    SigpacHierarchyIndexBuilder *mBuilder = nullptr;
+};
+
+#endif // SIGPACHIERARCHYINDEX_H
@@ -0,0 +1,554 @@
+/***************************************************************************
+  tilestore.cpp - TileStore
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "tilestore.h"
+
+#include <QDateTime>
+#include <QDir>
+#include <QFileInfo>
+#include <QMutexLocker>
+#include <QNetworkInformation>
+#include <QNetworkReply>
+#include <QNetworkRequest>
+#include <QThread>
+#include <qgsmessagelog.h>
+#include <qgsnetworkaccessmanager.h>
+
+#include <sqlite3.h>
+
+//! Largest reply written back to the store, anything bigger is unlikely to be a tile
+static const qint64 sMaximumTileSize = 4 * 1024 * 1024;
+//! Minimum delay in seconds between two last access updates of a given tile
+static const qint64 sAccessResolution = 60 * 60;
+//! Share of the maximum size the store is brought back to when evicting
+static const double sEvictionRatio = 0.9;
+
+TileStore::TileStore( const QString &path, qint64 maximumSize, QObject *parent )
+  : QObject( parent )
+  , mPath( path )
+  , mMaximumSize( maximumSize )
+{
+  QDir().mkpath( QFileInfo( path ).absolutePath() );
+
+  int status = mDatabase.open_v2( path, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_FULLMUTEX, nullptr );
+  if ( status != SQLITE_OK )
+  {
+    QgsMessageLog::logMessage( tr( "Could not open the tile store %1: %2" ).arg( path, mDatabase.errorMessage() ), QStringLiteral( "SIGPACGO" ), Qgis::Warning );
+    mDatabase.reset();
+    return;
+  }
+
+  QString error;
+  mDatabase.exec( QStringLiteral( "PRAGMA journal_mode=WAL;" ), error );
+  mDatabase.exec( QStringLiteral( "PRAGMA synchronous=NORMAL;" ), error );
+  status = mDatabase.exec( QStringLiteral( "CREATE TABLE IF NOT EXISTS tiles ("
+                                           " url TEXT PRIMARY KEY,"
+                                           " content_type TEXT,"
+                                           " data BLOB NOT NULL,"
+                                           " size INTEGER NOT NULL,"
+                                           " created INTEGER NOT NULL,"
+                                           " last_access INTEGER NOT NULL,"
+                                           " pinned INTEGER NOT NULL DEFAULT 0 );"
+                                           "CREATE INDEX IF NOT EXISTS tiles_eviction ON tiles ( pinned, last_access );"
+                                           "CREATE TABLE IF NOT EXISTS pack_tiles ("
+                                           " pack TEXT NOT NULL,"
+                                           " url TEXT NOT NULL,"
+                                           " PRIMARY KEY ( pack, url ) );"
+                                           "CREATE INDEX IF NOT EXISTS pack_tiles_url ON pack_tiles ( url );" ),
+                           error );
+  if ( status != SQLITE_OK )
+  {
+    QgsMessageLog::logMessage( tr( "Could not initialize the tile store %1: %2" ).arg( path, error ), QStringLiteral( "SIGPACGO" ), Qgis::Warning );
+    mDatabase.reset();
+    return;
+  }
+
+  sqlite3_statement_unique_ptr statement = mDatabase.prepare( QStringLiteral( "SELECT COALESCE( SUM( size ), 0 ) FROM tiles" ), status );
+  if ( status == SQLITE_OK && statement.step() == SQLITE_ROW )
+    mSize = statement.columnAsInt64( 0 );
+}
+
+TileStore::~TileStore()
+{
+  uninstall();
+
+  QWriteLocker locker( &mReadDatabasesLock );
+  qDeleteAll( mReadDatabases );
+  mReadDatabases.clear();
+}
+
+bool TileStore::isValid() const
+{
+  return static_cast<bool>( mDatabase );
+}
+
+qint64 TileStore::size() const
+{
+  return mSize;
+}
+
+qint64 TileStore::maximumSize() const
+{
+  return mMaximumSize;
+}
+
+void TileStore::setMaximumSize( qint64 maximumSize )
+{
+  {
+    QMutexLocker locker( &mWriteMutex );
+    if ( mMaximumSize == maximumSize )
+      return;
+
+    mMaximumSize = maximumSize;
+    evict();
+  }
+
+  emit maximumSizeChanged();
+  emit sizeChanged();
+}
+
+qint64 TileStore::maximumAge() const
+{
+  return mMaximumAge;
+}
+
+void TileStore::setMaximumAge( qint64 maximumAge )
+{
+  mMaximumAge = maximumAge;
+}
+
+TileStore::NetworkReachability TileStore::networkReachability() const
+{
+  return mNetworkReachability;
+}
+
+void TileStore::setNetworkReachability( NetworkReachability networkReachability )
+{
+  mNetworkReachability = networkReachability;
+}
+
+void TileStore::addSource( const QString &urlPrefix )
+{
+  QWriteLocker locker( &mSourcesLock );
+  if ( !mSources.contains( urlPrefix ) )
+    mSources << urlPrefix;
+}
+
+bool TileStore::isSourceUrl( const QUrl &url ) const
+{
+  if ( url.scheme() != QLatin1String( "http" ) && url.scheme() != QLatin1String( "https" ) )
+    return false;
+
+  // Sources are registered without scheme so that http and https requests share tiles
+  const QString location = url.toString( QUrl::RemoveScheme | QUrl::FullyEncoded ).mid( 2 );
+  QReadLocker locker( &mSourcesLock );
+  for ( const QString &source : mSources )
+  {
+    if ( location.startsWith( source, Qt::CaseInsensitive ) )
+      return true;
+  }
+  return false;
+}
+
+QString TileStore::tileKey( const QUrl &url )
+{
+  return url.adjusted( QUrl::RemoveFragment ).toString( QUrl::FullyEncoded );
+}
+
+sqlite3_database_unique_ptr *TileStore::readDatabase() const
+{
+  if ( !mDatabase )
+    return nullptr;
+
+  QThread *thread = QThread::currentThread();
+  {
+    QReadLocker locker( &mReadDatabasesLock );
+    if ( sqlite3_database_unique_ptr *database = mReadDatabases.value( thread ) )
+      return database;
+  }
+
+  // Readers of a database in WAL mode neither block each other nor the writer
+  std::unique_ptr<sqlite3_database_unique_ptr> database = std::make_unique<sqlite3_database_unique_ptr>();
+  if ( database->open_v2( mPath, SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX, nullptr ) != SQLITE_OK )
+  {
+    QgsMessageLog::logMessage( tr( "Could not open a read connection to the tile store %1: %2" ).arg( mPath, database->errorMessage() ), QStringLiteral( "SIGPACGO" ), Qgis::Warning );
+    return nullptr;
+  }
+  sqlite3_busy_timeout( database->get(), 1000 );
+
+  // Threads of a pool come and go, their connection goes with them
+  connect( thread, &QThread::finished, this, [this, thread] {
+    QWriteLocker locker( &mReadDatabasesLock );
+    delete mReadDatabases.take( thread );
+  }, Qt::DirectConnection );
+
+  QWriteLocker locker( &mReadDatabasesLock );
+  mReadDatabases.insert( thread, database.get() );
+  return database.release();
+}
+
+bool TileStore::tile( const QUrl &url, QByteArray &data, QString &contentType, bool *fresh )
+{
+  sqlite3_database_unique_ptr *database = readDatabase();
+  if ( !database )
+    return false;
+
+  const QString key = tileKey( url );
+  int status = SQLITE_OK;
+  sqlite3_statement_unique_ptr statement = database->prepare( QStringLiteral( "SELECT data, content_type, created, last_access, pinned FROM tiles WHERE url = ?" ), status );
+  if ( status != SQLITE_OK )
+    return false;
+
+  const QByteArray keyUtf8 = key.toUtf8();
+  sqlite3_bind_text( statement.get(), 1, keyUtf8.constData(), static_cast<int>( keyUtf8.size() ), SQLITE_STATIC );
+  if ( statement.step() != SQLITE_ROW )
+    return false;
+
+  data = QByteArray( static_cast<const char *>( sqlite3_column_blob( statement.get(), 0 ) ), sqlite3_column_bytes( statement.get(), 0 ) );
+  contentType = statement.columnAsText( 1 );
+  const qint64 created = statement.columnAsInt64( 2 );
+  const qint64 lastAccess = statement.columnAsInt64( 3 );
+  const bool pinned = statement.columnAsInt64( 4 ) != 0;
+  statement.reset();
+
+  const qint64 now = QDateTime::currentSecsSinceEpoch();
+  if ( fresh )
+    *fresh = pinned || now - created <= mMaximumAge;
+
+  // Keeping the access time coarse avoids turning every tile read into a write
+  if ( now - lastAccess > sAccessResolution )
+  {
+    QMutexLocker locker( &mWriteMutex );
+    sqlite3_statement_unique_ptr update = mDatabase.prepare( QStringLiteral( "UPDATE tiles SET last_access = ? WHERE url = ?" ), status );
+    if ( status == SQLITE_OK )
+    {
+      sqlite3_bind_int64( update.get(), 1, now );
+      sqlite3_bind_text( update.get(), 2, keyUtf8.constData(), static_cast<int>( keyUtf8.size() ), SQLITE_STATIC );
+      update.step();
+    }
+  }
+
+  return true;
+}
+
+bool TileStore::contains( const QUrl &url ) const
+{
+  sqlite3_database_unique_ptr *database = readDatabase();
+  if ( !database )
+    return false;
+
+  int status = SQLITE_OK;
+  sqlite3_statement_unique_ptr statement = database->prepare( QStringLiteral( "SELECT 1 FROM tiles WHERE url = ?" ), status );
+  if ( status != SQLITE_OK )
+    return false;
+
+  const QByteArray keyUtf8 = tileKey( url ).toUtf8();
+  sqlite3_bind_text( statement.get(), 1, keyUtf8.constData(), static_cast<int>( keyUtf8.size() ), SQLITE_STATIC );
+  return statement.step() == SQLITE_ROW;
+}
+
+bool TileStore::insertTile( const QUrl &url, const QByteArray &data, const QString &contentType, const QString &pack )
+{
+  bool packAdded = false;
+  {
+    QMutexLocker locker( &mWriteMutex );
+    if ( !mDatabase || data.isEmpty() )
+      return false;
+
+    const QByteArray keyUtf8 = tileKey( url ).toUtf8();
+    const QByteArray contentTypeUtf8 = contentType.toUtf8();
+    const QByteArray packUtf8 = pack.toUtf8();
+    const qint64 now = QDateTime::currentSecsSinceEpoch();
+    QString error;
+    int status = SQLITE_OK;
+
+    mDatabase.exec( QStringLiteral( "BEGIN;" ), error );
+
+    qint64 previousSize = 0;
+    sqlite3_statement_unique_ptr statement = mDatabase.prepare( QStringLiteral( "SELECT size FROM tiles WHERE url = ?" ), status );
+    if ( status == SQLITE_OK )
+    {
+      sqlite3_bind_text( statement.get(), 1, keyUtf8.constData(), static_cast<int>( keyUtf8.size() ), SQLITE_STATIC );
+      if ( statement.step() == SQLITE_ROW )
+        previousSize = statement.columnAsInt64( 0 );
+    }
+
+    if ( !pack.isEmpty() )
+    {
+      statement = mDatabase.prepare( QStringLiteral( "SELECT 1 FROM pack_tiles WHERE pack = ? LIMIT 1" ), status );
+      if ( status == SQLITE_OK )
+      {
+        sqlite3_bind_text( statement.get(), 1, packUtf8.constData(), static_cast<int>( packUtf8.size() ), SQLITE_STATIC );
+        packAdded = statement.step() != SQLITE_ROW;
+      }
+
+      statement = mDatabase.prepare( QStringLiteral( "INSERT OR IGNORE INTO pack_tiles ( pack, url ) VALUES ( ?, ? )" ), status );
+      if ( status == SQLITE_OK )
+      {
+        sqlite3_bind_text( statement.get(), 1, packUtf8.constData(), static_cast<int>( packUtf8.size() ), SQLITE_STATIC );
+        sqlite3_bind_text( statement.get(), 2, keyUtf8.constData(), static_cast<int>( keyUtf8.size() ), SQLITE_STATIC );
+        statement.step();
+      }
+    }
+
+    statement = mDatabase.prepare( QStringLiteral( "INSERT OR REPLACE INTO tiles ( url, content_type, data, size, created, last_access, pinned )"
+                                                   " VALUES ( ?1, ?2, ?3, ?4, ?5, ?5, EXISTS ( SELECT 1 FROM pack_tiles WHERE url = ?1 ) )" ),
+                                   status );
+    if ( status == SQLITE_OK )
+    {
+      sqlite3_bind_text( statement.get(), 1, keyUtf8.constData(), static_cast<int>( keyUtf8.size() ), SQLITE_STATIC );
+      sqlite3_bind_text( statement.get(), 2, contentTypeUtf8.constData(), static_cast<int>( contentTypeUtf8.size() ), SQLITE_STATIC );
+      sqlite3_bind_blob( statement.get(), 3, data.constData(), static_cast<int>( data.size() ), SQLITE_STATIC );
+      sqlite3_bind_int64( statement.get(), 4, data.size() );
+      sqlite3_bind_int64( statement.get(), 5, now );
+      status = statement.step() == SQLITE_DONE ? SQLITE_OK : SQLITE_ERROR;
+    }
+    statement.reset();
+
+    if ( status != SQLITE_OK )
+    {
+      mDatabase.exec( QStringLiteral( "ROLLBACK;" ), error );
+      return false;
+    }
+
+    mDatabase.exec( QStringLiteral( "COMMIT;" ), error );
+    mSize += data.size() - previousSize;
+    evict();
+  }
+
+  emit sizeChanged();
+  if ( packAdded )
+    emit packsChanged();
+  return true;
+}
+
+void TileStore::evict()
+{
+  if ( !mDatabase || mSize <= mMaximumSize )
+    return;
+
+  // Pinned tiles do not count against the maximum size
+  int status = SQLITE_OK;
+  qint64 unpinnedSize = 0;
+  sqlite3_statement_unique_ptr statement = mDatabase.prepare( QStringLiteral( "SELECT COALESCE( SUM( size ), 0 ) FROM tiles WHERE pinned = 0" ), status );
+  if ( status == SQLITE_OK && statement.step() == SQLITE_ROW )
+    unpinnedSize = statement.columnAsInt64( 0 );
+  if ( unpinnedSize <= mMaximumSize )
+    return;
+
+  // Evict down to a lower watermark so that a full store does not evict on every insert
+  const qint64 target = static_cast<qint64>( mMaximumSize * sEvictionRatio );
+  QStringList evicted;
+  qint64 evictedSize = 0;
+  statement = mDatabase.prepare( QStringLiteral( "SELECT url, size FROM tiles WHERE pinned = 0 ORDER BY last_access ASC" ), status );
+  if ( status != SQLITE_OK )
+    return;
+
+  while ( unpinnedSize - evictedSize > target && statement.step() == SQLITE_ROW )
+  {
+    evicted << statement.columnAsText( 0 );
+    evictedSize += statement.columnAsInt64( 1 );
+  }
+  statement.reset();
+
+  QString error;
+  mDatabase.exec( QStringLiteral( "BEGIN;" ), error );
+  statement = mDatabase.prepare( QStringLiteral( "DELETE FROM tiles WHERE url = ?" ), status );
+  if ( status == SQLITE_OK )
+  {
+    for ( const QString &url : std::as_const( evicted ) )
+    {
+      const QByteArray urlUtf8 = url.toUtf8();
+      sqlite3_reset( statement.get() );
+      sqlite3_bind_text( statement.get(), 1, urlUtf8.constData(), static_cast<int>( urlUtf8.size() ), SQLITE_STATIC );
+      sqlite3_step( statement.get() );
+    }
+  }
+  statement.reset();
+  mDatabase.exec( QStringLiteral( "COMMIT;" ), error );
+  mSize -= evictedSize;
+}
+
+QStringList TileStore::packs() const
+{
+  QStringList packs;
+  sqlite3_database_unique_ptr *database = readDatabase();
+  if ( !database )
+    return packs;
+
+  int status = SQLITE_OK;
+  sqlite3_statement_unique_ptr statement = database->prepare( QStringLiteral( "SELECT DISTINCT pack FROM pack_tiles ORDER BY pack" ), status );
+  if ( status != SQLITE_OK )
+    return packs;
+
+  while ( statement.step() == SQLITE_ROW )
+    packs << statement.columnAsText( 0 );
+  return packs;
+}
+
+int TileStore::packTileCount( const QString &pack ) const
+{
+  sqlite3_database_unique_ptr *database = readDatabase();
+  if ( !database )
+    return 0;
+
+  int status = SQLITE_OK;
+  sqlite3_statement_unique_ptr statement = database->prepare( QStringLiteral( "SELECT COUNT(*) FROM pack_tiles WHERE pack = ?" ), status );
+  if ( status != SQLITE_OK )
+    return 0;
+
+  const QByteArray packUtf8 = pack.toUtf8();
+  sqlite3_bind_text( statement.get(), 1, packUtf8.constData(), static_cast<int>( packUtf8.size() ), SQLITE_STATIC );
+  return statement.step() == SQLITE_ROW ? static_cast<int>( statement.columnAsInt64( 0 ) ) : 0;
+}
+
+void TileStore::removePack( const QString &pack )
+{
+  {
+    QMutexLocker locker( &mWriteMutex );
+    if ( !mDatabase )
+      return;
+
+    int status = SQLITE_OK;
+    QString error;
+    mDatabase.exec( QStringLiteral( "BEGIN;" ), error );
+    sqlite3_statement_unique_ptr statement = mDatabase.prepare( QStringLiteral( "DELETE FROM pack_tiles WHERE pack = ?" ), status );
+    if ( status == SQLITE_OK )
+    {
+      const QByteArray packUtf8 = pack.toUtf8();
+      sqlite3_bind_text( statement.get(), 1, packUtf8.constData(), static_cast<int>( packUtf8.size() ), SQLITE_STATIC );
+      statement.step();
+    }
+    statement.reset();
+    mDatabase.exec( QStringLiteral( "UPDATE tiles SET pinned = 0 WHERE pinned = 1 AND url NOT IN ( SELECT url FROM pack_tiles );" ), error );
+    mDatabase.exec( QStringLiteral( "COMMIT;" ), error );
+    evict();
+  }
+
+  emit packsChanged();
+  emit sizeChanged();
+}
+
+void TileStore::clear()
+{
+  {
+    QMutexLocker locker( &mWriteMutex );
+    if ( !mDatabase )
+      return;
+
+    QString error;
+    mDatabase.exec( QStringLiteral( "DELETE FROM tiles WHERE pinned = 0;" ), error );
+
+    int status = SQLITE_OK;
+    sqlite3_statement_unique_ptr statement = mDatabase.prepare( QStringLiteral( "SELECT COALESCE( SUM( size ), 0 ) FROM tiles" ), status );
+    if ( status == SQLITE_OK && statement.step() == SQLITE_ROW )
+      mSize = statement.columnAsInt64( 0 );
+  }
+
+  emit sizeChanged();
+}
+
+void TileStore::install()
+{
+  if ( !mDatabase || !mRequestPreprocessorId.isEmpty() )
+    return;
+
+  // Tells whether stale tiles can be refreshed, the backend is shared by all threads
+  QNetworkInformation::loadDefaultBackend();
+
+  mRequestPreprocessorId = QgsNetworkAccessManager::setRequestPreprocessor( [this]( QNetworkRequest *request ) { preprocessRequest( request ); } );
+  mReplyPreprocessorId = QgsNetworkAccessManager::setReplyPreprocessor( [this]( const QNetworkRequest &request, QNetworkReply *reply ) { preprocessReply( request, reply ); } );
+}
+
+void TileStore::uninstall()
+{
+  if ( mRequestPreprocessorId.isEmpty() )
+    return;
+
+  QgsNetworkAccessManager::removeRequestPreprocessor( mRequestPreprocessorId );
+  QgsNetworkAccessManager::removeReplyPreprocessor( mReplyPreprocessorId );
+  mRequestPreprocessorId.clear();
+  mReplyPreprocessorId.clear();
+}
+
+bool TileStore::isNetworkReachable() const
+{
+  switch ( mNetworkReachability.load() )
+  {
+    case NetworkReachability::Reachable:
+      return true;
+    case NetworkReachability::Unreachable:
+      return false;
+    case NetworkReachability::Detected:
+      break;
+  }
+
+  // Without a backend telling otherwise, the network is assumed to be reachable
+  const QNetworkInformation *information = QNetworkInformation::instance();
+  if ( !information )
+    return true;
+
+  const QNetworkInformation::Reachability reachability = information->reachability();
+  return reachability == QNetworkInformation::Reachability::Online || reachability == QNetworkInformation::Reachability::Unknown;
+}
+
+void TileStore::preprocessRequest( QNetworkRequest *request )
+{
+  if ( !isSourceUrl( request->url() ) )
+    return;
+
+  QByteArray data;
+  QString contentType;
+  bool fresh = false;
+  if ( !tile( request->url(), data, contentType, &fresh ) )
+    return;
+
+  // Stale tiles are refreshed from the network, unless it can't be reached
+  if ( !fresh && isNetworkReachable() )
+    return;
+
+  // The request is answered from memory by the network access manager through a data URL,
+  // the tile isn't copied into the network cache
+  request->setUrl( QUrl( QStringLiteral( "data:%1;base64,%2" ).arg( contentType.isEmpty() ? QStringLiteral( "application/octet-stream" ) : contentType, QString::fromLatin1( data.toBase64() ) ) ) );
+}
+
+void TileStore::preprocessReply( const QNetworkRequest &request, QNetworkReply *reply )
+{
+  if ( reply->operation() != QNetworkAccessManager::GetOperation || !isSourceUrl( request.url() ) )
+    return;
+
+  // Offline pack downloads store their tiles pinned on their own
+  if ( request.attribute( static_cast<QNetworkRequest::Attribute>( QgsNetworkRequestParameters::AttributeInitiatorClass ) ).toString() == QLatin1String( "OfflinePackDownloader" ) )
+    return;
+
+  // The reply is peeked at once complete, before the consumer reads it out
+  connect( reply, &QNetworkReply::finished, reply, [this, reply] {
+    if ( reply->error() != QNetworkReply::NoError
+         || reply->attribute( QNetworkRequest::SourceIsFromCacheAttribute ).toBool()
+         || reply->attribute( QNetworkRequest::HttpStatusCodeAttribute ).toInt() != 200 )
+      return;
+
+    const qint64 available = reply->bytesAvailable();
+    if ( available <= 0 || available > sMaximumTileSize )
+      return;
+
+    // A consumer reading progressively leaves a partial buffer behind, which must not be stored
+    const QVariant contentLength = reply->header( QNetworkRequest::ContentLengthHeader );
+    if ( contentLength.isValid() && contentLength.toLongLong() != available )
+      return;
+
+    insertTile( reply->request().url(), reply->peek( available ), reply->header( QNetworkRequest::ContentTypeHeader ).toString() );
+  } );
+}
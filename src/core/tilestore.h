@@ -0,0 +1,186 @@
+/***************************************************************************
+  tilestore.h - TileStore
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef TILESTORE_H
+#define TILESTORE_H
+
+#include "qfield_core_export.h"
+
+#include <QHash>
+#include <QMutex>
+#include <QObject>
+#include <QReadWriteLock>
+#include <qgssqliteutils.h>
+
+#include <atomic>
+
+/**
+ * \brief A persistent, size-bounded SQLite store of basemap tiles.
+ *
+ * Tiles are keyed by their fully encoded request URL, which covers XYZ raster and
+ * vector tiles as well as tiled WMS GetMap requests. Tiles belonging to an offline
+ * pack are pinned and never evicted, other tiles are evicted least recently used
+ * first once the store exceeds its maximum size.
+ *
+ * Once installed, the store hooks into QgsNetworkAccessManager: GET requests matching
+ * one of the registered source prefixes are served from the store when a fresh tile is
+ * available, or any stored tile while the network is unreachable, and successful network
+ * replies are written back to it. The store is thread-safe as requests are issued from
+ * rendering threads: each thread looks tiles up through its own read connection to the
+ * database in WAL mode, only writes are serialized through a single writer connection.
+ * \ingroup core
+ */
+class QFIELD_CORE_EXPORT TileStore : public QObject
+{
+    Q_OBJECT
+
+    Q_PROPERTY( qint64 size READ size NOTIFY sizeChanged )
+    Q_PROPERTY( qint64 maximumSize READ maximumSize WRITE setMaximumSize NOTIFY maximumSizeChanged )
+    Q_PROPERTY( QStringList packs READ packs NOTIFY packsChanged )
+
+  public:
+    //! Source of the network reachability deciding whether stale tiles are refreshed
+    enum class NetworkReachability
+    {
+      Detected,    //!< Reported by QNetworkInformation, assumed reachable without a backend
+      Reachable,   //!< Always considered reachable
+      Unreachable, //!< Always considered unreachable
+    };
+    Q_ENUM( NetworkReachability )
+
+    //! Default maximum size of the store in bytes, pinned tiles excluded
+    static constexpr qint64 DefaultMaximumSize = 512LL * 1024 * 1024;
+    //! Age in seconds after which an unpinned tile is refreshed from the network when possible
+    static constexpr qint64 DefaultMaximumAge = 30LL * 24 * 60 * 60;
+
+    /**
+     * Opens or creates a store at \a path. Use isValid() to check the outcome.
+     */
+    explicit TileStore( const QString &path, qint64 maximumSize = DefaultMaximumSize, QObject *parent = nullptr );
+    ~TileStore() override;
+
+    //! Returns TRUE if the underlying database could be opened
+    bool isValid() const;
+
+    //! Returns the path of the underlying database
+    QString path() const { return mPath; }
+
+    //! Returns the total size in bytes of the tiles held by the store
+    qint64 size() const;
+
+    //! Returns the maximum size in bytes of the unpinned tiles held by the store
+    qint64 maximumSize() const;
+
+    //! Sets the maximum size in bytes of the unpinned tiles held by the store
+    void setMaximumSize( qint64 maximumSize );
+
+    //! Returns the age in seconds after which unpinned tiles are only served while the network is unreachable
+    qint64 maximumAge() const;
+
+    //! Sets the age in seconds after which unpinned tiles are only served while the network is unreachable
+    void setMaximumAge( qint64 maximumAge );
+
+    //! Returns how the network reachability is determined
+    NetworkReachability networkReachability() const;
+
+    /**
+     * Sets how the network reachability is determined, overriding the detected reachability
+     * allows serving stale tiles as is on a network known to be unusable.
+     */
+    void setNetworkReachability( NetworkReachability networkReachability );
+
+    /**
+     * Registers a URL prefix whose requests are read through and written back to the store.
+     */
+    void addSource( const QString &urlPrefix );
+
+    //! Returns TRUE if \a url matches one of the registered sources
+    bool isSourceUrl( const QUrl &url ) const;
+
+    /**
+     * Looks up the tile stored for \a url.
+     * \param url the tile request URL
+     * \param data receives the tile content
+     * \param contentType receives the tile content type
+     * \param fresh if not NULLPTR, receives whether the tile is pinned or younger than the maximum age
+     * \returns TRUE if the tile was found
+     */
+    bool tile( const QUrl &url, QByteArray &data, QString &contentType, bool *fresh = nullptr );
+
+    //! Returns TRUE if a tile is stored for \a url
+    bool contains( const QUrl &url ) const;
+
+    /**
+     * Stores a tile \a data of a given \a contentType for \a url. When \a pack is not empty,
+     * the tile is pinned to that offline pack.
+     */
+    bool insertTile( const QUrl &url, const QByteArray &data, const QString &contentType, const QString &pack = QString() );
+
+    //! Returns the names of the offline packs held by the store
+    QStringList packs() const;
+
+    //! Returns the number of tiles pinned by the offline \a pack
+    Q_INVOKABLE int packTileCount( const QString &pack ) const;
+
+    /**
+     * Removes the offline \a pack, its tiles remain as regular evictable tiles.
+     */
+    Q_INVOKABLE void removePack( const QString &pack );
+
+    //! Removes all tiles which are not pinned by an offline pack
+    Q_INVOKABLE void clear();
+
+    /**
+     * Installs the network hooks reading through and writing back to this store.
+     * Only one store can be installed at a time.
+     */
+    void install();
+
+    //! Removes the network hooks installed by install()
+    void uninstall();
+
+  signals:
+    void sizeChanged();
+    void maximumSizeChanged();
+    void packsChanged();
+
+  private:
+    static QString tileKey( const QUrl &url );
+    bool isNetworkReachable() const;
+    //! Returns the read connection of the calling thread, opened on first use, or NULLPTR on failure
+    sqlite3_database_unique_ptr *readDatabase() const;
+    //! Evicts tiles beyond the maximum size, the write mutex must be held
+    void evict();
+    void preprocessRequest( QNetworkRequest *request );
+    void preprocessReply( const QNetworkRequest &request, QNetworkReply *reply );
+
+    QString mPath;
+    //! Serializes the writes, all going through mDatabase
+    mutable QMutex mWriteMutex;
+    sqlite3_database_unique_ptr mDatabase;
+    mutable QReadWriteLock mReadDatabasesLock;
+    mutable QHash<QThread *, sqlite3_database_unique_ptr *> mReadDatabases;
+    std::atomic<qint64> mSize = 0;
+    std::atomic<qint64> mMaximumSize = DefaultMaximumSize;
+    std::atomic<qint64> mMaximumAge = DefaultMaximumAge;
+    std::atomic<NetworkReachability> mNetworkReachability = NetworkReachability::Detected;
+    mutable QReadWriteLock mSourcesLock;
+    QStringList mSources;
+
+    QString mRequestPreprocessorId;
+    QString mReplyPreprocessorId;
+};
+
+#endif // TILESTORE_H
@@ -18,7 +18,15 @@
 #include "rubberbandmodel.h"
 #include "tracker.h"
 
+#include <QDataStream>
+#include <QDir>
+#include <QFile>
+#include <QStandardPaths>
 #include <qgsdistancearea.h>
+#include <qgslinestring.h>
+#include <qgsgeometrycollection.h>
+#include <qgsmessagelog.h>
+#include <qgspolygon.h>
 #include <qgsproject.h>
 #include <qgssensormanager.h>
 
@@ -27,6 +35,8 @@
 Tracker::Tracker( QgsVectorLayer *vectorLayer )
   : mVectorLayer( vectorLayer )
 {
+  mFlushTimer.setSingleShot( true );
+  connect( &mFlushTimer, &QTimer::timeout, this, &Tracker::flush );
 }
 
 void Tracker::setVisible( bool visible )
@@ -145,6 +155,24 @@ void Tracker::setConjunction( bool conjunction )
   emit conjunctionChanged();
 }
 
+void Tracker::setFlushVertexCount( int flushVertexCount )
+{
+  if ( mFlushVertexCount == flushVertexCount )
+    return;
+
+  mFlushVertexCount = flushVertexCount;
+  emit flushVertexCountChanged();
+}
+
+void Tracker::setFlushInterval( double flushInterval )
+{
+  if ( mFlushInterval == flushInterval )
+    return;
+
+  mFlushInterval = flushInterval;
+  emit flushIntervalChanged();
+}
+
 void Tracker::setMeasureType( MeasureType type )
 {
   if ( mMeasureType == type )
@@ -192,21 +220,17 @@ void Tracker::positionReceived()
 
   if ( mRubberbandModel->vertexCount() > 1 && ( !qgsDoubleNear( mMinimumDistance, 0.0 ) || !qgsDoubleNear( mMaximumDistance, 0.0 ) ) )
   {
-    QVector<QgsPointXY> points = mRubberbandModel->flatPointSequence( QgsProject::instance()->crs() );
-
-    auto pointIt = points.constEnd() - 1;
-
-    QVector<QgsPointXY> flatPoints;
-
-    flatPoints << *pointIt;
-    pointIt--;
-    flatPoints << *pointIt;
+    // Only the last two vertices matter, avoid transforming the whole track on every position received
+    const QgsPoint currentPoint = mRubberbandModel->currentCoordinate();
+    const QgsPoint lastPoint = mRubberbandModel->lastCoordinate();
 
     QgsDistanceArea distanceArea;
     distanceArea.setEllipsoid( QgsProject::instance()->ellipsoid() );
     distanceArea.setSourceCrs( QgsProject::instance()->crs(), QgsProject::instance()->transformContext() );
     try
     {
+      QgsCoordinateTransform ct( mRubberbandModel->crs(), QgsProject::instance()->crs(), QgsProject::instance()->transformContext() );
+      const QVector<QgsPointXY> flatPoints { ct.transform( currentPoint.x(), currentPoint.y() ), ct.transform( lastPoint.x(), lastPoint.y() ) };
       mCurrentDistance = distanceArea.measureLine( flatPoints );
     }
     catch ( const QgsException & )
@@ -297,6 +321,9 @@ void Tracker::stop()
   //track last position
   trackPosition();
 
+  //write buffered vertices
+  flush();
+
   mIsActive = false;
   emit isActiveChanged();
 
@@ -312,9 +339,15 @@ void Tracker::stop()
 
 void Tracker::processPositionInformation( const GnssPositionInformation &positionInformation, const QgsPoint &projectedPosition )
 {
-  if ( !mIsActive && !mIsReplaying )
+  // Live positions would be mixed up with the replayed ones
+  if ( !mIsActive || mIsReplaying )
     return;
 
+  updatePosition( positionInformation, projectedPosition );
+}
+
+void Tracker::updatePosition( const GnssPositionInformation &positionInformation, const QgsPoint &projectedPosition )
+{
   mLastDevicePositionTimestamp = positionInformation.utcDateTime();
 
   double measureValue = 0.0;
@@ -355,28 +388,48 @@ void Tracker::processPositionInformation( const GnssPositionInformation &positio
 
 void Tracker::replayPositionInformationList( const QList<GnssPositionInformation> &positionInformationList, QgsQuickCoordinateTransformer *coordinateTransformer )
 {
-  const qint64 startTime = QDateTime::currentMSecsSinceEpoch();
+  beginReplay();
+  for ( const GnssPositionInformation &positionInformation : positionInformationList )
+  {
+    replayPositionInformation( positionInformation,
+                               coordinateTransformer ? coordinateTransformer->transformPosition( QgsPoint( positionInformation.longitude(), positionInformation.latitude(), positionInformation.elevation() ) ) : QgsPoint() );
+  }
+  endReplay();
+}
+
+void Tracker::beginReplay()
+{
+  mReplayTimer.start();
 
   mIsReplaying = true;
   emit isReplayingChanged();
 
-  const Qgis::GeometryType geometryType = mRubberbandModel->geometryType();
-  const bool isPointGeometry = geometryType == Qgis::GeometryType::Point;
-  mFeatureModel->setBatchMode( isPointGeometry );
+  mFeatureModel->setBatchMode( mRubberbandModel->geometryType() == Qgis::GeometryType::Point );
 
   connect( mRubberbandModel, &RubberbandModel::currentCoordinateChanged, this, &Tracker::positionReceived );
-  for ( const GnssPositionInformation &positionInformation : positionInformationList )
+}
+
+void Tracker::replayPositionInformation( const GnssPositionInformation &positionInformation, const QgsPoint &projectedPosition )
+{
+  if ( !mIsReplaying )
+    return;
+
+  if ( mRubberbandModel->geometryType() == Qgis::GeometryType::Point )
   {
-    if ( isPointGeometry )
-    {
-      mFeatureModel->setPositionInformation( positionInformation );
-    }
-    processPositionInformation( positionInformation,
-                                coordinateTransformer ? coordinateTransformer->transformPosition( QgsPoint( positionInformation.longitude(), positionInformation.latitude(), positionInformation.elevation() ) ) : QgsPoint() );
+    mFeatureModel->setPositionInformation( positionInformation );
   }
+  updatePosition( positionInformation, projectedPosition );
+}
+
+void Tracker::endReplay()
+{
+  if ( !mIsReplaying )
+    return;
+
   disconnect( mRubberbandModel, &RubberbandModel::currentCoordinateChanged, this, &Tracker::positionReceived );
 
   mFeatureModel->setBatchMode( false );
+  const Qgis::GeometryType geometryType = mRubberbandModel->geometryType();
   const int vertexCount = mRubberbandModel->vertexCount();
   if ( ( geometryType == Qgis::GeometryType::Line && vertexCount > 2 ) || ( geometryType == Qgis::GeometryType::Polygon && vertexCount > 3 ) )
   {
@@ -391,6 +444,8 @@ void Tracker::replayPositionInformationList( const QList<GnssPositionInformation
     {
       mFeatureModel->save();
     }
+    mUnflushedVertexCount = 0;
+    clearRecoveryFile();
   }
 
   mIsReplaying = false;
@@ -403,8 +458,7 @@ void Tracker::replayPositionInformationList( const QList<GnssPositionInformation
     start();
   }
 
-  const qint64 endTime = QDateTime::currentMSecsSinceEpoch();
-  qInfo() << QStringLiteral( "Tracker position information replay duration: %1ms" ).arg( endTime - startTime );
+  qInfo() << QStringLiteral( "Tracker position information replay duration: %1ms" ).arg( mReplayTimer.elapsed() );
 }
 
 void Tracker::suspendUntilReplay()
@@ -438,18 +492,187 @@ void Tracker::rubberbandModelVertexCountChanged()
     {
       if ( ( geometryType == Qgis::GeometryType::Line && vertexCount > 2 ) || ( geometryType == Qgis::GeometryType::Polygon && vertexCount > 3 ) )
       {
-        mFeatureModel->applyGeometry();
         if ( ( geometryType == Qgis::GeometryType::Line && vertexCount == 3 ) || ( geometryType == Qgis::GeometryType::Polygon && vertexCount == 4 ) )
         {
+          mFeatureModel->applyGeometry();
           mFeatureModel->create();
           mFeature = mFeatureModel->feature();
+          mUnflushedVertexCount = 0;
+          clearRecoveryFile();
           emit featureCreated();
         }
         else
         {
-          mFeatureModel->save();
+          // Saving rewrites the whole geometry, buffer vertices to keep the cost per position constant on long tracks
+          mUnflushedVertexCount++;
+          if ( mUnflushedVertexCount >= mFlushVertexCount )
+          {
+            flush();
+          }
+          else
+          {
+            appendRecoveryVertex();
+            if ( !mFlushTimer.isActive() && mFlushInterval > 0 )
+            {
+              mFlushTimer.start( static_cast<int>( mFlushInterval * 1000 ) );
+            }
+          }
         }
       }
     }
   }
 }
+
+void Tracker::flush()
+{
+  mFlushTimer.stop();
+
+  if ( mUnflushedVertexCount == 0 || !mFeatureModel || !mRubberbandModel )
+    return;
+
+  mFeatureModel->applyGeometry();
+  mFeatureModel->save();
+
+  mUnflushedVertexCount = 0;
+  clearRecoveryFile();
+}
+
+QString Tracker::recoveryFilePath( const QgsVectorLayer *layer )
+{
+  const QString dirPath = QStandardPaths::writableLocation( QStandardPaths::AppDataLocation );
+  QDir().mkpath( dirPath );
+  return QStringLiteral( "%1/tracker_%2.tail" ).arg( dirPath, layer->id() );
+}
+
+void Tracker::appendRecoveryVertex()
+{
+  if ( !mVectorLayer || mFeature.id() == FID_NULL )
+    return;
+
+  QgsPoint point = mRubberbandModel->lastCoordinate();
+  try
+  {
+    QgsCoordinateTransform ct( mRubberbandModel->crs(), mVectorLayer->crs(), QgsProject::instance()->transformContext() );
+    const QgsPointXY transformedPoint = ct.transform( point.x(), point.y() );
+    point.setX( transformedPoint.x() );
+    point.setY( transformedPoint.y() );
+  }
+  catch ( const QgsException & )
+  {
+    return;
+  }
+
+  writeRecoveryVertex( mVectorLayer, mFeature.id(), point );
+}
+
+bool Tracker::writeRecoveryVertex( const QgsVectorLayer *layer, QgsFeatureId fid, const QgsPoint &point )
+{
+  if ( !layer || fid == FID_NULL )
+    return false;
+
+  QFile file( recoveryFilePath( layer ) );
+  if ( !file.open( QIODevice::WriteOnly | QIODevice::Append ) )
+    return false;
+
+  QDataStream stream( &file );
+  if ( file.size() == 0 )
+  {
+    stream << static_cast<qint64>( fid );
+  }
+
+  stream << point.x() << point.y() << point.z() << point.m();
+  return stream.status() == QDataStream::Ok;
+}
+
+void Tracker::clearRecoveryFile()
+{
+  if ( !mVectorLayer )
+    return;
+
+  QFile::remove( recoveryFilePath( mVectorLayer ) );
+}
+
+bool Tracker::recoverUnflushedVertices( QgsVectorLayer *layer )
+{
+  if ( !layer )
+    return false;
+
+  QFile file( recoveryFilePath( layer ) );
+  if ( !file.exists() || !file.open( QIODevice::ReadOnly ) )
+    return false;
+
+  QDataStream stream( &file );
+  qint64 fid = FID_NULL;
+  stream >> fid;
+
+  QgsPointSequence points;
+  while ( !stream.atEnd() )
+  {
+    double x, y, z, m;
+    stream >> x >> y >> z >> m;
+    if ( stream.status() != QDataStream::Ok )
+    {
+      // A vertex partially written when the application was terminated
+      break;
+    }
+    points << QgsPoint( x, y, z, m );
+  }
+  file.close();
+  file.remove();
+
+  if ( fid == FID_NULL || points.isEmpty() )
+    return false;
+
+  QgsFeature feature = layer->getFeature( fid );
+  if ( !feature.isValid() || feature.geometry().isNull() )
+    return false;
+
+  QgsGeometry geometry = feature.geometry();
+  QgsAbstractGeometry *abstractGeometry = geometry.get();
+  if ( QgsGeometryCollection *collection = qgsgeometry_cast<QgsGeometryCollection *>( abstractGeometry ) )
+  {
+    abstractGeometry = collection->geometryN( collection->numGeometries() - 1 );
+  }
+
+  if ( QgsLineString *line = qgsgeometry_cast<QgsLineString *>( abstractGeometry ) )
+  {
+    for ( const QgsPoint &point : std::as_const( points ) )
+    {
+      line->addVertex( point );
+    }
+  }
+  else if ( QgsPolygon *polygon = qgsgeometry_cast<QgsPolygon *>( abstractGeometry ) )
+  {
+    const QgsLineString *exteriorRing = qgsgeometry_cast<const QgsLineString *>( polygon->exteriorRing() );
+    if ( !exteriorRing )
+      return false;
+
+    std::unique_ptr<QgsLineString> ring( exteriorRing->clone() );
+    ring->deleteVertex( QgsVertexId( 0, 0, ring->numPoints() - 1 ) );
+    for ( const QgsPoint &point : std::as_const( points ) )
+    {
+      ring->addVertex( point );
+    }
+    ring->close();
+    polygon->setExteriorRing( ring.release() );
+  }
+  else
+  {
+    return false;
+  }
+
+  const bool wasEditing = layer->isEditable();
+  if ( !wasEditing && !layer->startEditing() )
+    return false;
+
+  layer->changeGeometry( fid, geometry );
+
+  if ( !wasEditing && !layer->commitChanges() )
+  {
+    layer->rollBack();
+    return false;
+  }
+
+  QgsMessageLog::logMessage( tr( "Recovered %1 unsaved tracked vertices on layer \"%2\"" ).arg( points.size() ).arg( layer->name() ), QStringLiteral( "SIGPACGO" ), Qgis::Info );
+  return true;
+}
@@ -18,6 +18,7 @@
 
 #include "gnsspositioninformation.h"
 
+#include <QElapsedTimer>
 #include <QPointer>
 #include <QTimer>
 #include <qgspoint.h>
@@ -55,6 +56,9 @@ class Tracker : public QObject
 
     Q_PROPERTY( QDateTime startPositionTimestamp READ startPositionTimestamp WRITE setStartPositionTimestamp NOTIFY startPositionTimestampChanged )
 
+    Q_PROPERTY( int flushVertexCount READ flushVertexCount WRITE setFlushVertexCount NOTIFY flushVertexCountChanged )
+    Q_PROPERTY( double flushInterval READ flushInterval WRITE setFlushInterval NOTIFY flushIntervalChanged )
+
   public:
     enum MeasureType
     {
@@ -112,6 +116,16 @@ class Tracker : public QObject
     //! Sets the timestamp of the first recorded point
     void setStartPositionTimestamp( const QDateTime &startPositionTimestamp ) { mStartPositionTimestamp = startPositionTimestamp; }
 
+    //! Returns the number of tracked vertices buffered before the line or polygon track geometry is written to the layer
+    int flushVertexCount() const { return mFlushVertexCount; }
+    //! Sets the number of tracked vertices buffered before the line or polygon track geometry is written to the layer, 1 writes every vertex
+    void setFlushVertexCount( int flushVertexCount );
+
+    //! Returns the maximum time interval in seconds during which tracked vertices stay buffered before being written to the layer
+    double flushInterval() const { return mFlushInterval; }
+    //! Sets the maximum time interval in seconds during which tracked vertices stay buffered before being written to the layer, 0 disables the time limit
+    void setFlushInterval( double flushInterval );
+
     //! Returns the current layer
     QgsVectorLayer *vectorLayer() const { return mVectorLayer.data(); }
     //! Sets the current layer
@@ -152,8 +166,42 @@ class Tracker : public QObject
     //! Replays a list of position information taking into account the tracker settings
     void replayPositionInformationList( const QList<GnssPositionInformation> &positionInformationList, QgsQuickCoordinateTransformer *coordinateTransformer = nullptr );
 
+    /**
+     * Starts replaying position information, which can then be spread over several event loop iterations.
+     * Live position information is ignored until the replay is ended.
+     * \see replayPositionInformation()
+     * \see endReplay()
+     */
+    void beginReplay();
+
+    //! Replays a \a positionInformation and its \a projectedPosition taking into account the tracker settings
+    void replayPositionInformation( const GnssPositionInformation &positionInformation, const QgsPoint &projectedPosition );
+
+    //! Ends replaying position information, writing the replayed track and resuming a suspended tracker
+    void endReplay();
+
     void suspendUntilReplay();
 
+    //! Writes the buffered track vertices to the layer
+    Q_INVOKABLE void flush();
+
+    /**
+     * Appends the vertices of a line or polygon track that were buffered but not yet written to the \a layer
+     * when the application was last terminated.
+     * \returns TRUE if vertices were recovered
+     */
+    static bool recoverUnflushedVertices( QgsVectorLayer *layer );
+
+    /**
+     * Appends a \a point, in the CRS of the \a layer, to the vertices of the track feature \a fid
+     * buffered but not yet written to the \a layer.
+     * \returns TRUE if the vertex could be written
+     */
+    static bool writeRecoveryVertex( const QgsVectorLayer *layer, QgsFeatureId fid, const QgsPoint &point );
+
+    //! Returns the file path storing the buffered vertices of a track on \a layer
+    static QString recoveryFilePath( const QgsVectorLayer *layer );
+
   signals:
     void isActiveChanged();
     void isSuspendedChanged();
@@ -175,6 +223,9 @@ class Tracker : public QObject
 
     void startPositionTimestampChanged();
 
+    void flushVertexCountChanged();
+    void flushIntervalChanged();
+
   private slots:
     void positionReceived();
     void sensorDataReceived();
@@ -183,9 +234,18 @@ class Tracker : public QObject
   private:
     void trackPosition();
 
+    //! Updates the current position of the track
+    void updatePosition( const GnssPositionInformation &positionInformation, const QgsPoint &projectedPosition );
+
+    //! Appends the last tracked vertex to the recovery file
+    void appendRecoveryVertex();
+    //! Removes the recovery file once the buffered vertices have been written to the layer
+    void clearRecoveryFile();
+
     bool mIsActive = false;
     bool mIsSuspended = false;
     bool mIsReplaying = false;
+    QElapsedTimer mReplayTimer;
 
     RubberbandModel *mRubberbandModel = nullptr;
     FeatureModel *mFeatureModel = nullptr;
@@ -212,6 +272,11 @@ class Tracker : public QObject
     QDateTime mLastVertexPositionTimestamp;
 
     MeasureType mMeasureType = Tracker::SecondsSinceStart;
+
+    int mFlushVertexCount = 10;
+    double mFlushInterval = 15.0;
+    int mUnflushedVertexCount = 0;
+    QTimer mFlushTimer;
 };
 
 #endif // TRACKER_H
@@ -14,8 +14,12 @@
  *                                                                         *
  ***************************************************************************/
 
+#include "gnsssession.h"
+#include "qgsquickcoordinatetransformer.h"
 #include "trackingmodel.h"
 
+#include <QElapsedTimer>
+#include <QTimer>
 #include <qgsproject.h>
 #include <qgsvectorlayerutils.h>
 
@@ -176,6 +180,73 @@ void TrackingModel::replayPositionInformationList( const QList<GnssPositionInfor
   }
 }
 
+void TrackingModel::replayPositionInformationSession( const QString &path, QgsQuickCoordinateTransformer *coordinateTransformer )
+{
+  if ( mSessionReplay )
+  {
+    // The ongoing replay already covers the suspended trackers
+    return;
+  }
+
+  mSessionReplay = std::make_unique<SessionReplay>();
+  mSessionReplay->session = std::make_unique<GnssSessionReader>( path );
+  mSessionReplay->coordinateTransformer = coordinateTransformer;
+  for ( Tracker *tracker : std::as_const( mTrackers ) )
+  {
+    if ( tracker->isSuspended() )
+    {
+      tracker->beginReplay();
+      mSessionReplay->trackers << tracker;
+    }
+  }
+
+  emit replayProgressChanged( 0.0 );
+  QTimer::singleShot( 0, this, &TrackingModel::replaySessionSlice );
+}
+
+void TrackingModel::replaySessionSlice()
+{
+  if ( !mSessionReplay )
+    return;
+
+  SessionReplay *replay = mSessionReplay.get();
+  const qsizetype count = replay->session->count();
+
+  QElapsedTimer timer;
+  timer.start();
+  while ( replay->position < count && timer.elapsed() < ReplaySliceDuration )
+  {
+    const GnssPositionInformation positionInformation = replay->session->positionInformation( replay->position++ );
+    const QgsPoint projectedPosition = replay->coordinateTransformer ? replay->coordinateTransformer->transformPosition( QgsPoint( positionInformation.longitude(), positionInformation.latitude(), positionInformation.elevation() ) ) : QgsPoint();
+    for ( const QPointer<Tracker> &tracker : std::as_const( replay->trackers ) )
+    {
+      if ( tracker )
+      {
+        tracker->replayPositionInformation( positionInformation, projectedPosition );
+      }
+    }
+  }
+
+  if ( replay->position < count )
+  {
+    emit replayProgressChanged( static_cast<double>( replay->position ) / count );
+    QTimer::singleShot( 0, this, &TrackingModel::replaySessionSlice );
+    return;
+  }
+
+  const std::unique_ptr<SessionReplay> finishedReplay = std::move( mSessionReplay );
+  for ( const QPointer<Tracker> &tracker : std::as_const( finishedReplay->trackers ) )
+  {
+    if ( tracker )
+    {
+      tracker->endReplay();
+    }
+  }
+
+  emit replayProgressChanged( 1.0 );
+  emit replayFinished();
+}
+
 void TrackingModel::suspendUntilReplay()
 {
   for ( int i = 0; i < mTrackers.size(); i++ )
@@ -207,6 +278,9 @@ void TrackingModel::createProjectTrackers( QgsProject *project )
   {
     if ( QgsVectorLayer *vl = qobject_cast<QgsVectorLayer *>( layer ) )
     {
+      // Vertices buffered by a tracking session that was interrupted before they could be written
+      Tracker::recoverUnflushedVertices( vl );
+
       const bool trackingSessionActive = layer->customProperty( "QFieldSync/tracking_session_active", false ).toBool();
       if ( trackingSessionActive )
       {
@@ -19,7 +19,11 @@
 #include "tracker.h"
 
 #include <QAbstractItemModel>
+#include <QPointer>
 
+#include <memory>
+
+class GnssSessionReader;
 class QgsQuickCoordinateTransformer;
 class RubberbandModel;
 class Track;
@@ -71,6 +75,16 @@ class TrackingModel : public QAbstractItemModel
     //! Replays a list of position information for all active trackers
     Q_INVOKABLE void replayPositionInformationList( const QList<GnssPositionInformation> &positionInformationList, QgsQuickCoordinateTransformer *coordinateTransformer = nullptr );
 
+    /**
+     * Replays the position information of the GNSS session file at \a path for all suspended trackers.
+     * The session is replayed in slices of at most ReplaySliceDuration milliseconds, letting the event
+     * loop run in between. replayProgressChanged() is emitted after each slice, replayFinished() once done.
+     */
+    Q_INVOKABLE void replayPositionInformationSession( const QString &path, QgsQuickCoordinateTransformer *coordinateTransformer = nullptr );
+
+    //! Maximum number of milliseconds spent replaying a session before letting the event loop run
+    static constexpr qint64 ReplaySliceDuration = 40;
+
     Q_INVOKABLE void suspendUntilReplay();
 
     void reset();
@@ -89,8 +103,26 @@ class TrackingModel : public QAbstractItemModel
 
     void trackingSetupRequested( QModelIndex trackerIndex, bool skipSettings );
 
+    //! Emitted while replaying a session with the \a progress of the replay, between 0 and 1
+    void replayProgressChanged( double progress );
+
+    //! Emitted once a session has been replayed
+    void replayFinished();
+
   private:
+    //! Replays the next slice of the session being replayed
+    void replaySessionSlice();
+
+    struct SessionReplay
+    {
+        std::unique_ptr<GnssSessionReader> session;
+        qsizetype position = 0;
+        QPointer<QgsQuickCoordinateTransformer> coordinateTransformer;
+        QList<QPointer<Tracker>> trackers;
+    };
+
     QList<Tracker *> mTrackers;
+    std::unique_ptr<SessionReplay> mSessionReplay;
     QList<Tracker *>::const_iterator trackerIterator( QgsVectorLayer *layer )
     {
       return std::find_if( mTrackers.constBegin(), mTrackers.constEnd(), [layer]( const Tracker *tracker ) { return tracker->vectorLayer() == layer; } );
@@ -215,6 +215,29 @@ QList<QgsFeature> FeatureUtils::getFilteredFeatures( QgsVectorLayer *layer, cons
   return filteredFeatures;
 }
 
+FeatureQueryJob *FeatureUtils::getUniqueValuesAsync( QgsVectorLayer *layer, const QString &fieldName, const QString &filterExpression )
+{
+  // Parentless objects returned to QML are owned by the JavaScript engine
+  FeatureQueryJob *job = new FeatureQueryJob( FeatureQueryJob::QueryType::UniqueValues, layer, fieldName, filterExpression );
+  if ( !job->start() )
+  {
+    delete job;
+    return nullptr;
+  }
+  return job;
+}
+
+FeatureQueryJob *FeatureUtils::getFilteredFeaturesAsync( QgsVectorLayer *layer, const QString &filterExpression, int limit )
+{
+  FeatureQueryJob *job = new FeatureQueryJob( FeatureQueryJob::QueryType::Features, layer, QString(), filterExpression, limit );
+  if ( !job->start() )
+  {
+    delete job;
+    return nullptr;
+  }
+  return job;
+}
+
 QgsFeature FeatureUtils::getFeatureById( QgsVectorLayer *layer, int featureId )
 {
   QgsFeature feature;
@@ -16,6 +16,7 @@
 #ifndef FEATUREUTILS_H
 #define FEATUREUTILS_H
 
+#include "featurequeryjob.h"
 #include "qfield_core_export.h"
 
 #include <QObject>
@@ -90,6 +91,26 @@ class QFIELD_CORE_EXPORT FeatureUtils : public QObject
      * \returns a list of features
      */
     static Q_INVOKABLE QList<QgsFeature> getFilteredFeatures( QgsVectorLayer *layer, const QString &filterExpression );
+
+    /**
+     * Starts collecting the unique values for a given field in a vector layer in the background.
+     * \param layer the vector layer
+     * \param fieldName the name of the field
+     * \param filterExpression an optional filter expression
+     * \returns a running job streaming the values, or NULLPTR if the query could not be started
+     * \see getUniqueValuesFiltered()
+     */
+    static Q_INVOKABLE FeatureQueryJob *getUniqueValuesAsync( QgsVectorLayer *layer, const QString &fieldName, const QString &filterExpression = QString() );
+
+    /**
+     * Starts collecting features filtered by an expression in the background.
+     * \param layer the vector layer
+     * \param filterExpression the filter expression
+     * \param limit the maximum number of features collected, a negative value meaning no limit
+     * \returns a running job streaming the features, or NULLPTR if the query could not be started
+     * \see getFilteredFeatures()
+     */
+    static Q_INVOKABLE FeatureQueryJob *getFilteredFeaturesAsync( QgsVectorLayer *layer, const QString &filterExpression, int limit = -1 );
     
     /**
      * Returns a feature by its ID.
@@ -16,23 +16,27 @@
 
 #include "fileutils.h"
 #include "gnsspositioninformation.h"
+#include "photopipeline.h"
 
 #include <QDebug>
 #include <QDir>
 #include <QDirIterator>
 #include <QFileInfo>
-#include <QImage>
 #include <QImageReader>
 #include <QMimeDatabase>
-#include <QPainter>
 #include <QPainterPath>
 #include <qgis.h>
-#include <qgsexiftools.h>
 #include <qgsfileutils.h>
 #include <qgsrendercontext.h>
 #include <qgstextformat.h>
 #include <qgstextrenderer.h>
 
+#ifdef Q_OS_WIN
+#include <io.h>
+#else
+#include <unistd.h>
+#endif
+
 FileUtils::FileUtils( QObject *parent )
   : QObject( parent )
 {
@@ -212,188 +216,29 @@ QString FileUtils::fileEtag( const QString &fileName, int partSize )
   return QString();
 }
 
-void FileUtils::restrictImageSize( const QString &imagePath, int maximumWidthHeight )
+bool FileUtils::syncFile( QFile &file )
 {
-  if ( !QFileInfo::exists( imagePath ) )
-  {
-    return;
-  }
-
-  QVariantMap metadata = QgsExifTools::readTags( imagePath );
-  QImage img( imagePath );
-  if ( !img.isNull() && ( img.width() > maximumWidthHeight || img.height() > maximumWidthHeight ) )
-  {
-    QImage scaledImage = img.width() > img.height()
-                           ? img.scaledToWidth( maximumWidthHeight, Qt::SmoothTransformation )
-                           : img.scaledToHeight( maximumWidthHeight, Qt::SmoothTransformation );
-    scaledImage.save( imagePath, nullptr, 90 );
+  if ( !file.flush() )
+    return false;
+
+#ifdef Q_OS_WIN
+  return _commit( file.handle() ) == 0;
+#else
+  return fsync( file.handle() ) == 0;
+#endif
+}
 
-    for ( const QString &key : metadata.keys() )
-    {
-      QgsExifTools::tagImage( imagePath, key, metadata[key] );
-    }
-  }
+void FileUtils::restrictImageSize( const QString &imagePath, int maximumWidthHeight )
+{
+  PhotoPipeline::processNow( imagePath, { { QStringLiteral( "maximumWidthHeight" ), maximumWidthHeight } } );
 }
 
 void FileUtils::addImageMetadata( const QString &imagePath, const GnssPositionInformation &positionInformation )
 {
-  if ( !QFileInfo::exists( imagePath ) )
-  {
-    return;
-  }
-
-  QVariantMap metadata;
-  if ( positionInformation.latitudeValid() && positionInformation.longitudeValid() )
-  {
-    metadata["Exif.GPSInfo.GPSLatitude"] = std::abs( positionInformation.latitude() );
-    metadata["Exif.GPSInfo.GPSLatitudeRef"] = positionInformation.latitude() >= 0 ? "N" : "S";
-    metadata["Exif.GPSInfo.GPSLongitude"] = std::abs( positionInformation.longitude() );
-    metadata["Exif.GPSInfo.GPSLongitudeRef"] = positionInformation.longitude() >= 0 ? "E" : "W";
-    if ( positionInformation.elevationValid() )
-    {
-      metadata["Exif.GPSInfo.GPSAltitude"] = std::abs( positionInformation.elevation() );
-      metadata["Exif.GPSInfo.GPSAltitudeRef"] = positionInformation.elevation() >= 0 ? "1" : "0";
-    }
-  }
-  if ( positionInformation.orientationValid() )
-  {
-    metadata["Exif.GPSInfo.GPSImgDirection"] = positionInformation.orientation();
-    metadata["Exif.GPSInfo.GPSImgDirectionRef"] = "M";
-  }
-  if ( positionInformation.speedValid() )
-  {
-    metadata["Exif.GPSInfo.GPSSpeed"] = positionInformation.speed();
-    metadata["Exif.GPSInfo.GPSSpeedRef"] = "K";
-  }
-
-  metadata["Exif.GPSInfo.GPSDateStamp"] = positionInformation.utcDateTime().date();
-  metadata["Exif.GPSInfo.GPSTimeStamp"] = positionInformation.utcDateTime().time();
-
-  metadata["Exif.GPSInfo.GPSSatellites"] = QString::number( positionInformation.satellitesUsed() ).rightJustified( 2, '0' );
-
-  metadata["Exif.Image.Make"] = QStringLiteral( "SIGPACGO" );
-  metadata["Xmp.tiff.Make"] = QStringLiteral( "SIGPACGO" );
-
-  for ( const QString key : metadata.keys() )
-  {
-    QgsExifTools::tagImage( imagePath, key, metadata[key] );
-  }
+  PhotoPipeline::processNow( imagePath, { { QStringLiteral( "tags" ), PhotoPipeline::positionTags( positionInformation ) } } );
 }
 
 void FileUtils::addImageStamp( const QString &imagePath, const QString &text, const QVariantMap &styling )
 {
-  if ( !QFileInfo::exists( imagePath ) || text.isEmpty() )
-  {
-    return;
-  }
-
-  QVariantMap metadata = QgsExifTools::readTags( imagePath );
-  QImage img( imagePath );
-  if ( !img.isNull() )
-  {
-    QPainter painter( &img );
-    painter.setRenderHint( QPainter::Antialiasing );
-
-    // Parse the text to get lines
-    QStringList lines = text.split( QStringLiteral( "\n" ) );
-    
-    // Get styling parameters with defaults if not provided
-    int baseFontSize = styling.value("fontSize", std::min( img.width(), img.height() ) / 40).toInt();
-    QString textColor = styling.value("color", "#FFFFFF").toString(); // Default white text
-    QString bgColor = styling.value("backgroundColor", "#80000000").toString(); // Default semi-transparent black
-    int padding = styling.value("padding", 10).toInt();
-    QString position = styling.value("position", "bottomLeft").toString().toLower();
-    
-    // Create fonts for title and regular text
-    QFont titleFont = painter.font();
-    titleFont.setPixelSize( baseFontSize * 1.2 );
-    titleFont.setBold( true );
-    
-    QFont regularFont = painter.font();
-    regularFont.setPixelSize( baseFontSize );
-    regularFont.setBold( true );
-    
-    // Measure text to determine background rectangle size
-    QFontMetrics titleMetrics(titleFont);
-    QFontMetrics regularMetrics(regularFont);
-    
-    int textWidth = 0;
-    int textHeight = 0;
-    
-    // Calculate total height and maximum width
-    for (int i = 0; i < lines.size(); ++i) {
-      QFont *currentFont = (i == 0 || i == lines.size() - 1) ? &titleFont : &regularFont;
-      QFontMetrics *metrics = (i == 0 || i == lines.size() - 1) ? &titleMetrics : &regularMetrics;
-      
-      textWidth = qMax(textWidth, metrics->horizontalAdvance(lines[i]));
-      textHeight += metrics->height();
-    }
-    
-    // Add padding
-    textWidth += padding * 2;
-    textHeight += padding * 2;
-    
-    // Determine position based on setting
-    int rectX = padding;
-    int rectY = img.height() - textHeight - padding;
-    
-    if (position == "bottomright") {
-      rectX = img.width() - textWidth - padding;
-    } else if (position == "topleft") {
-      rectY = padding;
-    } else if (position == "topright") {
-      rectX = img.width() - textWidth - padding;
-      rectY = padding;
-    }
-    
-    // Parse colors
-    QColor textQColor(textColor);
-    QColor bgQColor(bgColor);
-    QColor accentColor = styling.value("accentColor", "#0078D7").toString(); // Default blue accent
-    
-    // Draw semi-transparent background
-    painter.setBrush(bgQColor);
-    painter.setPen(Qt::NoPen);
-    painter.drawRoundedRect(rectX, rectY, textWidth, textHeight, 10, 10);
-    
-    // Add accent bar on the left
-    painter.setBrush(accentColor);
-    painter.drawRoundedRect(rectX, rectY, 6, textHeight, 3, 3);
-    
-    // Draw text
-    int currentY = rectY + padding;
-    
-    for (int i = 0; i < lines.size(); ++i) {
-      // Use title font for first and last line (date and SIGPACGO line)
-      if (i == 0 || i == lines.size() - 1) {
-        painter.setFont(titleFont);
-        painter.setPen(i == lines.size() - 1 ? accentColor : textQColor);
-      } else {
-        painter.setFont(regularFont);
-        painter.setPen(textQColor);
-      }
-      
-      // Draw text with shadow effect if enabled
-      if (styling.value("shadow", true).toBool()) {
-        painter.setPen(QColor(0, 0, 0, 120));
-        painter.drawText(rectX + padding + 1, currentY + 1, lines[i]);
-      }
-      
-      // Draw actual text
-      painter.setPen(i == lines.size() - 1 ? accentColor : textQColor);
-      painter.drawText(rectX + padding, currentY, lines[i]);
-      
-      // Move to next line
-      currentY += (i == 0 || i == lines.size() - 1) ? 
-                  titleMetrics.height() : regularMetrics.height();
-    }
-
-    img.save( imagePath, nullptr, 90 );
-
-    // Restore metadata
-    for ( const QString &key : metadata.keys() )
-    {
-      QgsExifTools::tagImage( imagePath, key, metadata[key] );
-    }
-  }
+  PhotoPipeline::processNow( imagePath, { { QStringLiteral( "stampText" ), text }, { QStringLiteral( "stampStyling" ), styling } } );
 }
@@ -20,6 +20,7 @@
 #include "qfield_core_export.h"
 
 #include <QCryptographicHash>
+#include <QFile>
 #include <QObject>
 #include <qgsfeedback.h>
 #include <QVariantMap>
@@ -81,6 +82,12 @@ class QFIELD_CORE_EXPORT FileUtils : public QObject
      */
     Q_INVOKABLE static QString fileEtag( const QString &fileName, int partSize = 8 * 1024 * 1024 );
 
+    /**
+     * Flushes the buffered content of an open \a file and asks the operating system to write it to the storage device.
+     * \return TRUE on success
+     */
+    static bool syncFile( QFile &file );
+
   private:
     static int copyRecursivelyPrepare( const QString &sourceFolder, const QString &destFolder, QList<QPair<QString, QString>> &mapping );
 };
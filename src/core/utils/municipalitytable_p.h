@@ -0,0 +1,53 @@
+/***************************************************************************
+  municipalitytable_p.h - MunicipalityTable
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef MUNICIPALITYTABLE_P_H
+#define MUNICIPALITYTABLE_P_H
+
+//
+//  W A R N I N G
+//  -------------
+//
+// This file is not part of the QField API. It exists purely as an
+// implementation detail shared with the generated municipality table.
+//
+
+#include <cstdint>
+#include <iterator>
+
+//! A municipality name stored in its province blob
+struct MunicipalityTableEntry
+{
+    uint16_t municipalityCode;
+    uint16_t nameLength;
+    uint32_t nameOffset;
+};
+
+//! The municipalities of a province, entries are sorted by municipality code
+struct MunicipalityTableProvince
+{
+    const char *names;
+    const MunicipalityTableEntry *entries;
+    int entryCount;
+};
+
+/**
+ * Provinces indexed by their code, generated at build time from municipality_data.json.
+ * Codes without data have a null names blob.
+ */
+extern const MunicipalityTableProvince sMunicipalityTableProvinces[];
+extern const int sMunicipalityTableProvinceCount;
+
+#endif // MUNICIPALITYTABLE_P_H
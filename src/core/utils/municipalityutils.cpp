@@ -0,0 +1,71 @@
+/***************************************************************************
+  municipalityutils.cpp - MunicipalityUtils
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "municipalitytable_p.h"
+#include "municipalityutils.h"
+
+#include <algorithm>
+#include <limits>
+
+static const MunicipalityTableProvince *province( int provinceCode )
+{
+  if ( provinceCode <= 0 || provinceCode >= sMunicipalityTableProvinceCount )
+    return nullptr;
+
+  const MunicipalityTableProvince *province = &sMunicipalityTableProvinces[provinceCode];
+  return province->names ? province : nullptr;
+}
+
+MunicipalityUtils::MunicipalityUtils( QObject *parent )
+  : QObject( parent )
+{
+}
+
+QString MunicipalityUtils::municipalityName( int provinceCode, int municipalityCode )
+{
+  const MunicipalityTableProvince *p = province( provinceCode );
+  if ( !p || municipalityCode < 0 || municipalityCode > std::numeric_limits<uint16_t>::max() )
+    return QString();
+
+  const MunicipalityTableEntry *end = p->entries + p->entryCount;
+  const MunicipalityTableEntry *entry = std::lower_bound( p->entries, end, municipalityCode, []( const MunicipalityTableEntry &entry, int code ) {
+    return entry.municipalityCode < code;
+  } );
+  if ( entry == end || entry->municipalityCode != municipalityCode )
+    return QString();
+
+  return QString::fromUtf8( p->names + entry->nameOffset, entry->nameLength );
+}
+
+QList<int> MunicipalityUtils::municipalityCodes( int provinceCode )
+{
+  QList<int> codes;
+  const MunicipalityTableProvince *p = province( provinceCode );
+  if ( !p )
+    return codes;
+
+  codes.reserve( p->entryCount );
+  for ( int i = 0; i < p->entryCount; i++ )
+    codes << p->entries[i].municipalityCode;
+  return codes;
+}
+
+int MunicipalityUtils::municipalityCount()
+{
+  int count = 0;
+  for ( int i = 0; i < sMunicipalityTableProvinceCount; i++ )
+    count += sMunicipalityTableProvinces[i].entryCount;
+  return count;
+}
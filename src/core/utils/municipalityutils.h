@@ -0,0 +1,48 @@
+/***************************************************************************
+  municipalityutils.h - MunicipalityUtils
+
+ ---------------------
+ begin                : 17.10.2026
+ copyright            : (C) 2026 by SIGPACGO contributors
+ ***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#ifndef MUNICIPALITYUTILS_H
+#define MUNICIPALITYUTILS_H
+
+#include "qfield_core_export.h"
+
+#include <QObject>
+
+/**
+ * Provides the names of SIGPAC municipalities from a table compiled into the
+ * application at build time.
+ * \ingroup core
+ */
+class QFIELD_CORE_EXPORT MunicipalityUtils : public QObject
+{
+    Q_OBJECT
+
+  public:
+    explicit MunicipalityUtils( QObject *parent = nullptr );
+
+    /**
+     * Returns the name of the municipality identified by \a municipalityCode within the
+     * province identified by \a provinceCode, or an empty string if it is unknown.
+     */
+    static Q_INVOKABLE QString municipalityName( int provinceCode, int municipalityCode );
+
+    //! Returns the codes of the municipalities known for the province identified by \a provinceCode
+    static Q_INVOKABLE QList<int> municipalityCodes( int provinceCode );
+
+    //! Returns the total number of municipalities stored in the table
+    static int municipalityCount();
+};
+
+#endif // MUNICIPALITYUTILS_H
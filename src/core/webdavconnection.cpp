@@ -16,9 +16,11 @@
  ***************************************************************************/
 
 
+#include "fileutils.h"
 #include "platformutilities.h"
 #include "webdavconnection.h"
 
+#include <QCryptographicHash>
 #include <QDirIterator>
 #include <QSettings>
 #include <QtWebDAV/qwebdavitem.h>
@@ -94,6 +96,16 @@ void WebdavConnection::setStorePassword( bool storePassword )
   emit storePasswordChanged();
 }
 
+void WebdavConnection::setMaximumConcurrentTransfers( int maximumConcurrentTransfers )
+{
+  maximumConcurrentTransfers = std::max( maximumConcurrentTransfers, 1 );
+  if ( mMaximumConcurrentTransfers == maximumConcurrentTransfers )
+    return;
+
+  mMaximumConcurrentTransfers = maximumConcurrentTransfers;
+  emit maximumConcurrentTransfersChanged();
+}
+
 void WebdavConnection::checkStoredPassword()
 {
   mStoredPassword.clear();
@@ -189,7 +201,7 @@ void WebdavConnection::setupConnection()
 {
   QUrl connectionUrl( mUrl );
   bool isHttps = connectionUrl.scheme() == QStringLiteral( "https" );
-  mWebdavConnection.setConnectionSettings( isHttps ? QWebdav::HTTPS : QWebdav::HTTP, connectionUrl.host(), connectionUrl.path( QUrl::FullyEncoded ), mUsername, !mPassword.isEmpty() ? mPassword : mStoredPassword );
+  mWebdavConnection.setConnectionSettings( isHttps ? QWebdav::HTTPS : QWebdav::HTTP, connectionUrl.host(), connectionUrl.path( QUrl::FullyEncoded ), mUsername, !mPassword.isEmpty() ? mPassword : mStoredPassword, connectionUrl.port() );
 }
 
 void WebdavConnection::fetchAvailablePaths()
@@ -247,16 +259,8 @@ void WebdavConnection::processDirParserFinished()
         }
         else
         {
-          if ( mIsDownloadingPath )
-          {
-            QFileInfo fileInfo( mProcessLocalPath + item.path().mid( mProcessRemotePath.size() ) );
-            if ( !fileInfo.exists() || ( fileInfo.fileTime( QFileDevice::FileModificationTime ) != item.lastModified() ) )
-            {
-              mWebdavItems << item;
-              mBytesTotal += item.size();
-            }
-          }
-          else
+          QFileInfo fileInfo( mProcessLocalPath + item.path().mid( mProcessRemotePath.size() ) );
+          if ( !isLocalFileUpToDate( fileInfo, item ) )
           {
             mWebdavItems << item;
             mBytesTotal += item.size();
@@ -316,7 +320,7 @@ void WebdavConnection::processDirParserFinished()
 
             if ( localFileInfo != mLocalItems.end() )
             {
-              if ( localFileInfo->fileTime( QFileDevice::FileModificationTime ) == item.lastModified() )
+              if ( isLocalFileUpToDate( *localFileInfo, item ) )
               {
                 mLocalItems.remove( localFileInfo - mLocalItems.begin(), 1 );
               }
@@ -355,57 +359,12 @@ void WebdavConnection::processDirParserFinished()
 
 void WebdavConnection::getWebdavItems()
 {
-  if ( !mWebdavItems.isEmpty() )
+  while ( !mWebdavItems.isEmpty() && mActiveTransfers.size() < mMaximumConcurrentTransfers )
   {
-    const QString itemPath = mWebdavItems.first().path();
-    const QDateTime itemLastModified = mWebdavItems.first().lastModified();
-    QNetworkReply *reply = mWebdavConnection.get( itemPath );
-    QTemporaryFile *temporaryFile = new QTemporaryFile( reply );
-    temporaryFile->setFileTemplate( QStringLiteral( "%1%2.XXXXXXXXXXXX" ).arg( mProcessLocalPath, itemPath.mid( mProcessRemotePath.size() ) ) );
-    temporaryFile->open();
-
-    connect( reply, &QNetworkReply::downloadProgress, this, [=]( int bytesReceived, int bytesTotal ) {
-      mCurrentBytesProcessed = bytesReceived;
-      emit progressChanged();
-
-      temporaryFile->write( reply->readAll() );
-    } );
-
-    connect( reply, &QNetworkReply::finished, this, [=]() {
-      mBytesProcessed += mCurrentBytesProcessed;
-      mCurrentBytesProcessed = 0;
-      if ( reply->error() == QNetworkReply::NoError )
-      {
-        QFile file( mProcessLocalPath + itemPath.mid( mProcessRemotePath.size() ) );
-        if ( file.exists() )
-        {
-          // Remove pre-existing file
-          file.remove();
-        }
-
-        temporaryFile->write( reply->readAll() );
-        temporaryFile->setAutoRemove( false );
-        temporaryFile->rename( mProcessLocalPath + itemPath.mid( mProcessRemotePath.size() ) );
-        temporaryFile->close();
-        delete temporaryFile;
-
-        // Attach last modified date value coming from the server (cannot be done via QTemporaryFile)
-        file.open( QFile::Append );
-        file.setFileTime( itemLastModified, QFileDevice::FileModificationTime );
-        file.setFileTime( itemLastModified, QFileDevice::FileAccessTime );
-        file.close();
-      }
-      else
-      {
-        mLastError = tr( "Failed to download file %1 due to network error (%2)" ).arg( itemPath ).arg( reply->error() );
-      }
-
-      mWebdavItems.removeFirst();
-      getWebdavItems();
-      reply->deleteLater();
-    } );
+    getWebdavItem( mWebdavItems.takeFirst() );
   }
-  else
+
+  if ( mWebdavItems.isEmpty() && mActiveTransfers.isEmpty() )
   {
     if ( mIsImportingPath )
     {
@@ -438,6 +397,124 @@ void WebdavConnection::getWebdavItems()
   }
 }
 
+void WebdavConnection::getWebdavItem( const QWebdavItem &item )
+{
+  const QString itemPath = item.path();
+  const QDateTime itemLastModified = item.lastModified();
+  const QString localFilePath = mProcessLocalPath + itemPath.mid( mProcessRemotePath.size() );
+  const QString partialFilePath = partialDownloadPath( localFilePath, item );
+
+  // Partial downloads of previous versions of the item can't be resumed anymore
+  const QFileInfo localFileInfo( localFilePath );
+  const QStringList partialFileNames = localFileInfo.dir().entryList( { QStringLiteral( "%1.*.part" ).arg( localFileInfo.fileName() ) }, QDir::Files );
+  for ( const QString &partialFileName : partialFileNames )
+  {
+    if ( partialFileName != QFileInfo( partialFilePath ).fileName() )
+      localFileInfo.dir().remove( partialFileName );
+  }
+
+  // Resume where an interrupted download of the same version of the item stopped
+  QFile *partialFile = new QFile( partialFilePath );
+  qint64 resumeFrom = partialFile->exists() ? partialFile->size() : 0;
+  if ( resumeFrom >= item.size() )
+    resumeFrom = 0;
+  partialFile->open( resumeFrom > 0 ? QFile::Append : QFile::WriteOnly | QFile::Truncate );
+
+  QNetworkReply *reply = mWebdavConnection.get( itemPath, partialFile, static_cast<quint64>( resumeFrom ) );
+  partialFile->setParent( reply );
+  mActiveTransfers.insert( reply, resumeFrom );
+  emit progressChanged();
+
+  connect( reply, &QNetworkReply::metaDataChanged, this, [=]() {
+    // Servers ignoring the range request send the whole file again
+    if ( resumeFrom > 0 && reply->attribute( QNetworkRequest::HttpStatusCodeAttribute ).toInt() != 206 )
+    {
+      partialFile->resize( 0 );
+    }
+  } );
+
+  connect( reply, &QNetworkReply::downloadProgress, this, [=]( qint64, qint64 ) {
+    mActiveTransfers[reply] = partialFile->size();
+    emit progressChanged();
+  } );
+
+  connect( reply, &QNetworkReply::finished, this, [=]() {
+    mActiveTransfers.remove( reply );
+    mBytesProcessed += item.size();
+    emit progressChanged();
+
+    if ( reply->error() == QNetworkReply::NoError )
+    {
+      partialFile->write( reply->readAll() );
+      partialFile->close();
+
+      QFile file( localFilePath );
+      if ( file.exists() )
+      {
+        // Remove pre-existing file
+        file.remove();
+      }
+      QFile::rename( partialFilePath, localFilePath );
+
+      // Attach last modified date value coming from the server
+      file.open( QFile::Append );
+      file.setFileTime( itemLastModified, QFileDevice::FileModificationTime );
+      file.setFileTime( itemLastModified, QFileDevice::FileAccessTime );
+      file.close();
+    }
+    else
+    {
+      partialFile->write( reply->readAll() );
+      partialFile->close();
+      if ( reply->attribute( QNetworkRequest::HttpStatusCodeAttribute ).toInt() == 416 )
+      {
+        // The partial download doesn't match the remote file, start over next time
+        QFile::remove( partialFilePath );
+      }
+
+      if ( reply->error() != QNetworkReply::OperationCanceledError )
+      {
+        mLastError = tr( "Failed to download file %1 due to network error (%2)" ).arg( itemPath ).arg( reply->error() );
+      }
+    }
+
+    reply->deleteLater();
+    getWebdavItems();
+  } );
+}
+
+bool WebdavConnection::isLocalFileUpToDate( const QFileInfo &fileInfo, const QWebdavItem &item )
+{
+  if ( !fileInfo.exists() || fileInfo.size() != item.size() )
+    return false;
+
+  if ( fileInfo.fileTime( QFileDevice::FileModificationTime ) == item.lastModified() )
+    return true;
+
+  // Only hash local files when the entity tag is a content hash, which not all servers provide
+  QString entityTag = item.entityTag().toLower();
+  if ( entityTag.startsWith( QStringLiteral( "w/" ) ) )
+    entityTag = entityTag.mid( 2 );
+  entityTag.remove( QChar( '"' ) );
+
+  static const QRegularExpression md5Expression( QStringLiteral( "^[0-9a-f]{32}(-[0-9]+)?$" ) );
+  if ( !md5Expression.match( entityTag ).hasMatch() || FileUtils::fileEtag( fileInfo.absoluteFilePath() ) != entityTag )
+    return false;
+
+  // Align the modification time so that the next comparison doesn't need to hash the file again
+  QFile file( fileInfo.absoluteFilePath() );
+  file.open( QFile::Append );
+  file.setFileTime( item.lastModified(), QFileDevice::FileModificationTime );
+  file.close();
+  return true;
+}
+
+QString WebdavConnection::partialDownloadPath( const QString &localFilePath, const QWebdavItem &item )
+{
+  const QString version = QStringLiteral( "%1|%2|%3" ).arg( item.entityTag(), item.lastModified().toString( Qt::ISODateWithMs ) ).arg( item.size() );
+  return QStringLiteral( "%1.%2.part" ).arg( localFilePath, QCryptographicHash::hash( version.toUtf8(), QCryptographicHash::Md5 ).toHex().left( 12 ) );
+}
+
 QVariantMap WebdavConnection::importHistory()
 {
   // Collect imported folders
@@ -514,13 +591,12 @@ void WebdavConnection::putLocalItems()
 {
   if ( !mWebdavMkDirs.isEmpty() )
   {
+    // Directories are created one at a time, parents first
     const QString dirPath = mWebdavMkDirs.first();
 
     QNetworkReply *reply = mWebdavConnection.mkdir( dirPath );
 
     connect( reply, &QNetworkReply::finished, this, [=]() {
-      mBytesProcessed += mCurrentBytesProcessed;
-      mCurrentBytesProcessed = 0;
       emit progressChanged();
       if ( reply->error() != QNetworkReply::NoError )
       {
@@ -529,42 +605,17 @@ void WebdavConnection::putLocalItems()
 
       mWebdavMkDirs.removeFirst();
       putLocalItems();
-    } );
-  }
-  else if ( !mLocalItems.isEmpty() )
-  {
-    const QString itemPath = mLocalItems.first().absoluteFilePath();
-    const QString remoteItemPath = mProcessRemotePath + itemPath.mid( mProcessLocalPath.size() ).replace( QDir::separator(), "/" );
-
-    QFile *file = new QFile( itemPath );
-    file->open( QFile::ReadOnly );
-    QNetworkReply *reply = mWebdavConnection.put( remoteItemPath, file );
-    file->setParent( reply );
-
-    connect( reply, &QNetworkReply::uploadProgress, this, [=]( int bytesSent, int bytesTotal ) {
-      mCurrentBytesProcessed = bytesSent;
-      emit progressChanged();
-    } );
-
-    connect( reply, &QNetworkReply::finished, this, [=]() {
-      mBytesProcessed += mCurrentBytesProcessed;
-      mCurrentBytesProcessed = 0;
-      emit progressChanged();
-      if ( reply->error() != QNetworkReply::NoError )
-      {
-        mLastError = tr( "Failed to upload file %1 due to network error (%2)" ).arg( remoteItemPath ).arg( reply->error() );
-      }
-
-      mWebdavLastModified << remoteItemPath;
-
-      mLocalItems.removeFirst();
-      putLocalItems();
       reply->deleteLater();
     } );
   }
   else
   {
-    if ( mIsUploadingPath )
+    while ( !mLocalItems.isEmpty() && mActiveTransfers.size() < mMaximumConcurrentTransfers )
+    {
+      putLocalItem( mLocalItems.takeFirst() );
+    }
+
+    if ( mLocalItems.isEmpty() && mActiveTransfers.isEmpty() && mIsUploadingPath )
     {
       if ( !mWebdavLastModified.isEmpty() )
       {
@@ -579,6 +630,56 @@ void WebdavConnection::putLocalItems()
   }
 }
 
+void WebdavConnection::putLocalItem( const QFileInfo &fileInfo )
+{
+  const QString itemPath = fileInfo.absoluteFilePath();
+  const QString remoteItemPath = mProcessRemotePath + QString( itemPath ).mid( mProcessLocalPath.size() ).replace( QDir::separator(), "/" );
+  const qint64 itemSize = fileInfo.size();
+
+  QFile *file = new QFile( itemPath );
+  file->open( QFile::ReadOnly );
+  QNetworkReply *reply = mWebdavConnection.put( remoteItemPath, file );
+  file->setParent( reply );
+  mActiveTransfers.insert( reply, 0 );
+
+  connect( reply, &QNetworkReply::uploadProgress, this, [=]( qint64 bytesSent, qint64 ) {
+    mActiveTransfers[reply] = bytesSent;
+    emit progressChanged();
+  } );
+
+  connect( reply, &QNetworkReply::finished, this, [=]() {
+    mActiveTransfers.remove( reply );
+    mBytesProcessed += itemSize;
+    emit progressChanged();
+    if ( reply->error() == QNetworkReply::NoError )
+    {
+      mWebdavLastModified << remoteItemPath;
+    }
+    else if ( reply->error() != QNetworkReply::OperationCanceledError )
+    {
+      mLastError = tr( "Failed to upload file %1 due to network error (%2)" ).arg( remoteItemPath ).arg( reply->error() );
+    }
+
+    reply->deleteLater();
+    putLocalItems();
+  } );
+}
+
+void WebdavConnection::abortTransfers()
+{
+  mWebdavItems.clear();
+  mLocalItems.clear();
+  mWebdavMkDirs.clear();
+
+  // Partial downloads are kept on disk and resumed by the next download
+  const QList<QNetworkReply *> replies = mActiveTransfers.keys();
+  for ( QNetworkReply *reply : replies )
+  {
+    reply->abort();
+  }
+  mActiveTransfers.clear();
+}
+
 void WebdavConnection::importPath( const QString &remotePath, const QString &localPath )
 {
   if ( mUrl.isEmpty() || mUsername.isEmpty() || ( mPassword.isEmpty() && mStoredPassword.isEmpty() ) )
@@ -693,11 +794,13 @@ void WebdavConnection::uploadPath( const QString &localPath )
       if ( fi.isDir() )
       {
         mLocalItems.clear();
+        const QRegularExpression partialDownloadExpression( QStringLiteral( "\\.[0-9a-f]{12}\\.part$" ) );
         QDirIterator it( mProcessLocalPath, QDir::Files | QDir::NoDotAndDotDot, QDirIterator::Subdirectories );
         while ( it.hasNext() )
         {
           it.next();
-          if ( it.fileName() != QStringLiteral( "qfield_webdav_configuration.json" ) )
+          // Skip the configuration and partial downloads
+          if ( it.fileName() != QStringLiteral( "qfield_webdav_configuration.json" ) && !partialDownloadExpression.match( it.fileName() ).hasMatch() )
           {
             mLocalItems << it.fileInfo();
           }
@@ -731,7 +834,12 @@ void WebdavConnection::confirmRequest()
 
 void WebdavConnection::cancelRequest()
 {
-  if ( mIsDownloadingPath )
+  if ( mIsImportingPath )
+  {
+    mIsImportingPath = false;
+    emit isImportingPathChanged();
+  }
+  else if ( mIsDownloadingPath )
   {
     mIsDownloadingPath = false;
     emit isDownloadingPathChanged();
@@ -741,13 +849,20 @@ void WebdavConnection::cancelRequest()
     mIsUploadingPath = false;
     emit isUploadingPathChanged();
   }
+
+  abortTransfers();
 }
 
 double WebdavConnection::progress() const
 {
   if ( ( mIsImportingPath || mIsDownloadingPath || mIsUploadingPath ) && mBytesTotal > 0 )
   {
-    return static_cast<double>( mBytesProcessed + mCurrentBytesProcessed ) / mBytesTotal;
+    qint64 bytesProcessed = mBytesProcessed;
+    for ( const qint64 bytes : mActiveTransfers )
+    {
+      bytesProcessed += bytes;
+    }
+    return static_cast<double>( bytesProcessed ) / mBytesTotal;
   }
 
   return 0;
@@ -18,6 +18,7 @@
 #ifndef WEBDAVCONNECTION_H
 #define WEBDAVCONNECTION_H
 
+#include <QHash>
 #include <QObject>
 #include <QtWebDAV/qwebdav.h>
 #include <QtWebDAV/qwebdavdirparser.h>
@@ -43,6 +44,8 @@ class WebdavConnection : public QObject
     Q_PROPERTY( bool isDownloadingPath READ isDownloadingPath NOTIFY isDownloadingPathChanged )
     Q_PROPERTY( bool isUploadingPath READ isUploadingPath NOTIFY isUploadingPathChanged )
 
+    Q_PROPERTY( int maximumConcurrentTransfers READ maximumConcurrentTransfers WRITE setMaximumConcurrentTransfers NOTIFY maximumConcurrentTransfersChanged )
+
     Q_PROPERTY( QStringList availablePaths READ availablePaths NOTIFY availablePathsChanged )
     Q_PROPERTY( double progress READ progress NOTIFY progressChanged )
     Q_PROPERTY( QString lastError READ lastError NOTIFY lastErrorChanged )
@@ -69,6 +72,16 @@ class WebdavConnection : public QObject
 
     bool isPasswordStored() const { return !mStoredPassword.isEmpty(); }
 
+    /**
+     * Returns the maximum number of files downloaded or uploaded at the same time.
+     */
+    int maximumConcurrentTransfers() const { return mMaximumConcurrentTransfers; }
+
+    /**
+     * Sets the maximum number of files downloaded or uploaded at the same time.
+     */
+    void setMaximumConcurrentTransfers( int maximumConcurrentTransfers );
+
     QStringList availablePaths() const { return mIsFetchingAvailablePaths ? QStringList() : mAvailablePaths; }
 
     bool isFetchingAvailablePaths() const { return mIsFetchingAvailablePaths; }
@@ -101,6 +114,7 @@ class WebdavConnection : public QObject
     void usernameChanged();
     void passwordChanged();
     void storePasswordChanged();
+    void maximumConcurrentTransfersChanged();
     void isPasswordStoredChanged();
     void isFetchingAvailablePathsChanged();
     void isImportingPathChanged();
@@ -124,7 +138,22 @@ class WebdavConnection : public QObject
     void applyStoredPassword();
     void setupConnection();
     void getWebdavItems();
+    void getWebdavItem( const QWebdavItem &item );
     void putLocalItems();
+    void putLocalItem( const QFileInfo &fileInfo );
+    void abortTransfers();
+
+    /**
+     * Returns TRUE if the local file matches a remote \a item, comparing size and modification
+     * time first, then the content hash when the server provides one as entity tag.
+     */
+    static bool isLocalFileUpToDate( const QFileInfo &fileInfo, const QWebdavItem &item );
+
+    /**
+     * Returns the path of the partial download of a remote \a item to \a localFilePath.
+     * The path is specific to the item version, so that stale partial downloads are never resumed.
+     */
+    static QString partialDownloadPath( const QString &localFilePath, const QWebdavItem &item );
 
     QString mUrl;
     QString mUsername;
@@ -140,6 +169,7 @@ class WebdavConnection : public QObject
     bool mIsDownloadingPath = false;
     bool mIsUploadingPath = false;
 
+    int mMaximumConcurrentTransfers = 4;
     QList<QWebdavItem> mWebdavItems;
     QList<QString> mWebdavMkDirs;
     QList<QFileInfo> mLocalItems;
@@ -147,7 +177,8 @@ class WebdavConnection : public QObject
 
     QString mProcessRemotePath;
     QString mProcessLocalPath;
-    qint64 mCurrentBytesProcessed = 0;
+    //! Bytes processed by the transfers in flight
+    QHash<QNetworkReply *, qint64> mActiveTransfers;
     qint64 mBytesProcessed = 0;
     qint64 mBytesTotal = 0;
 
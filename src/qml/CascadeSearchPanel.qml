@@ -71,6 +71,23 @@ Drawer {
     // Store the final filtered features
     property var filteredFeatures: []
     
+    // Hierarchical index of the SIGPAC codes, built in the background once per layer
+    SigpacHierarchyIndex {
+        id: hierarchyIndex
+        vectorLayer: cascadeSearchPanel.vectorLayer
+        layerObserver: mainWindow.layerObserverAlias
+    }
+    
+    // Returns the list of selected codes, from province down to the deepest selected level
+    function selectionPath() {
+        var path = [];
+        var selections = [selectedProvince, selectedMunicipality, selectedPolygon, selectedParcel];
+        for (var i = 0; i < selections.length && selections[i] !== null; i++) {
+            path.push(selections[i]);
+        }
+        return path;
+    }
+    
     // Province name mapping
     property var provinceNames: ({
         1: "ÁLAVA",
@@ -125,9 +142,6 @@ Drawer {
         50: "ZARAGOZA"
     })
     
-    // Municipality names for the current province
-    property var municipalityNames: ({})
-    
     // Compact UI settings
     property int maxVisibleItems: 3
     property int itemHeight: 36
@@ -189,7 +203,7 @@ Drawer {
     
     // Helper function to get municipality name from code
     function getMunicipalityName(code) {
-        return municipalityNames[code] || "";
+        return selectedProvince ? MunicipalityUtils.municipalityName(selectedProvince, code) : "";
     }
     
     // Helper function to format municipality display
@@ -271,11 +285,15 @@ Drawer {
         polygonValues = [];
         parcelValues = [];
         
+        if (resultsQuery) {
+            // onFinished() no longer reaches a query dropped here, the search state is reset with it
+            resultsQuery.cancel();
+            resultsQuery = null;
+            isSearching = false;
+            busyIndicator.running = false;
+        }
         filteredFeatures = [];
         
-        // Reset municipality names
-        municipalityNames = {};
-        
         // Reset the models
         provinceModel.clear();
         municipalityModel.clear();
@@ -331,12 +349,14 @@ Drawer {
     
     Timer {
         id: loadProvincesTimer
-        interval: 100
+        interval: hierarchyIndex.ready ? 0 : 100
         repeat: false
         
         onTriggered: {
             // Get unique province values using the detected field name
-            provinceValues = FeatureUtils.getUniqueValues(vectorLayer, getFieldName("CD_PROV"));
+            provinceValues = hierarchyIndex.ready
+                ? hierarchyIndex.values([])
+                : FeatureUtils.getUniqueValues(vectorLayer, getFieldName("CD_PROV"));
             
             // Sort numerically
             provinceValues.sort(function(a, b) { return a - b; });
@@ -364,8439 +384,24 @@ Drawer {
         isSearching = true;
         busyIndicator.running = true;
         
-        // Reset municipality names for the new province
-        municipalityNames = {};
-        
-        // Load municipality names for the selected province
-        loadMunicipalityNames(selectedProvince);
-        
         // Use a timer to avoid blocking the UI
         loadMunicipalitiesTimer.start();
     }
     
-    // Function to load municipality names for a province
-    function loadMunicipalityNames(provinceCode) {
-        if (provinceCode === 1) {
-            municipalityNames = {
-                "1": "ALEGRÍA-DULANTZI",
-                "2": "AMURRIO",
-                "3": "ARAMAIO",
-                "4": "ARTZINIEGA",
-                "6": "ARMIÑON",
-                "8": "ARRAZUA-UBARRUNDIA",
-                "9": "ASPARRENA",
-                "10": "AYALA/AIARA",
-                "11": "BAÑOS DE EBRO/MAÑUETA",
-                "13": "BARRUNDIA",
-                "14": "BERANTEVILLA",
-                "16": "BERNEDO",
-                "17": "CAMPEZO/KANPEZU",
-                "18": "ZIGOITIA",
-                "19": "KRIPAN",
-                "20": "KUARTANGO",
-                "21": "ELBURGO/BURGELU",
-                "22": "ELCIEGO",
-                "23": "ELVILLAR/BILAR",
-                "26": "IRUÑA OKA/IRUÑA DE OCA",
-                "27": "IRURAIZ-GAUNA",
-                "28": "LABASTIDA",
-                "30": "LAGRÁN",
-                "31": "LAGUARDIA",
-                "32": "LANCIEGO/LANTZIEGO",
-                "33": "LAPUEBLA DE LABARCA",
-                "34": "LEZA",
-                "35": "LANTARÓN",
-                "36": "LLODIO",
-                "37": "ARRAIA-MAEZTU",
-                "39": "MOREDA DE ÁLAVA",
-                "41": "NAVARIDAS",
-                "42": "OKONDO",
-                "43": "OYÓN-OION",
-                "44": "PEÑACERRADA-URIZAHARRA",
-                "46": "RIBERA ALTA",
-                "47": "RIBERA BAJA/ERRIBERA BEITIA",
-                "49": "AÑANA",
-                "51": "SALVATIERRA/AGURAIN",
-                "52": "SAMANIEGO",
-                "53": "SAN MILLÁN/DONEMILIAGA",
-                "54": "URKABUSTAIZ",
-                "55": "VALDEGOVÍA",
-                "56": "HARANA/VALLE DE ARANA",
-                "57": "VILLABUENA DE ÁLAVA/ESKUERNAGA",
-                "58": "LEGUTIANO",
-                "59": "VITORIA-GASTEIZ",
-                "60": "YÉCORA/IEKORA",
-                "61": "ZALDUONDO",
-                "62": "ZAMBRANA",
-                "63": "ZUIA",
-                "64": "COMUNIDAD DE LAÑO PIPAON Y PEÑACERRADA",
-                "65": "PARZONERIA DE ENTZIA",
-            };
-        }
-         else if (provinceCode === 2) {
-            municipalityNames = {
-                "1": "ABENGIBRE",
-                "2": "ALATOZ",
-                "4": "ALBATANA",
-                "5": "ALBOREA",
-                "6": "ALCADOZO",
-                "7": "ALCALA DEL JUCAR",
-                "8": "ALCARAZ",
-                "9": "ALMANSA",
-                "10": "ALPERA",
-                "11": "AYNA",
-                "12": "BALAZOTE",
-                "13": "BALSA DE VES",
-                "14": "EL BALLESTERO",
-                "15": "BARRAX",
-                "16": "BIENSERVIDA",
-                "17": "BOGARRA",
-                "18": "BONETE",
-                "19": "EL BONILLO",
-                "20": "CARCELEN",
-                "21": "CASAS DE JUAN NUÑEZ",
-                "22": "CASAS DE LAZARO",
-                "23": "CASAS DE VES",
-                "24": "CASAS IBAÑEZ",
-                "25": "CAUDETE",
-                "26": "CENIZATE",
-                "27": "CORRAL-RUBIO",
-                "28": "COTILLAS",
-                "29": "CHINCHILLA DE MONTE-ARAGON",
-                "30": "ELCHE DE LA SIERRA",
-                "31": "FEREZ",
-                "32": "FUENSANTA",
-                "33": "FUENTE-ALAMO",
-                "34": "FUENTEALBILLA",
-                "35": "LA GINETA",
-                "36": "GOLOSALVO",
-                "37": "HELLIN",
-                "38": "LA HERRERA",
-                "39": "HIGUERUELA",
-                "40": "HOYA-GONZALO",
-                "41": "JORQUERA",
-                "42": "LETUR",
-                "43": "LEZUZA",
-                "44": "LIETOR",
-                "45": "MADRIGUERAS",
-                "46": "MAHORA",
-                "47": "MASEGOSO",
-                "48": "MINAYA",
-                "49": "MOLINICOS",
-                "50": "MONTALVOS",
-                "51": "MONTEALEGRE DEL CASTILLO",
-                "52": "MOTILLEJA",
-                "53": "MUNERA",
-                "54": "NAVAS DE JORQUERA",
-                "55": "NERPIO",
-                "56": "ONTUR",
-                "57": "OSSA DE MONTIEL",
-                "58": "PATERNA DEL MADERA",
-                "59": "PEÑASCOSA",
-                "60": "PEÑAS DE SAN PEDRO",
-                "61": "PETROLA",
-                "62": "POVEDILLA",
-                "63": "POZOHONDO",
-                "64": "POZO-LORENTE",
-                "65": "POZUELO",
-                "66": "LA RECUEJA",
-                "67": "RIOPAR",
-                "68": "ROBLEDO",
-                "69": "LA RODA",
-                "70": "SALOBRE",
-                "71": "SAN PEDRO",
-                "72": "SOCOVOS",
-                "73": "TARAZONA DE LA MANCHA",
-                "74": "TOBARRA",
-                "75": "VALDEGANGA",
-                "76": "VIANOS",
-                "77": "VILLA DE VES",
-                "78": "VILLALGORDO DEL JUCAR",
-                "79": "VILLAMALEA",
-                "80": "VILLAPALACIOS",
-                "81": "VILLARROBLEDO",
-                "82": "VILLATOYA",
-                "83": "VILLAVALIENTE",
-                "84": "VILLAVERDE DE GUADALIMAR",
-                "85": "VIVEROS",
-                "86": "YESTE",
-                "87": "POZO CAÑADA",
-                "900": "ALBACETE",
-            };
-        }
-        else if (provinceCode === 3) {
-            municipalityNames = {
-                "1": "ADSUBIA",
-                "2": "AGOST",
-                "3": "AGRES",
-                "4": "AIGUES",
-                "5": "ALBATERA",
-                "6": "ALCALALI",
-                "7": "ALCOCER DE PLANES",
-                "8": "ALCOLEJA",
-                "9": "ALCOY/ALCOI",
-                "10": "ALFAFARA",
-                "11": "L`ALFAS DEL PI",
-                "12": "ALGORFA",
-                "13": "ALGUEÑA",
-                "15": "ALMORADI",
-                "16": "ALMUDAINA",
-                "17": "L'ALQUERIA D'ASNAR",
-                "18": "ALTEA",
-                "19": "ASPE",
-                "20": "BALONES",
-                "21": "BANYERES DE MARIOLA",
-                "22": "BENASAU",
-                "23": "BENEIXAMA",
-                "24": "BENEJUZAR",
-                "25": "BENFERRI",
-                "26": "BENIARBEIG",
-                "27": "BENIARDA",
-                "28": "BENIARRES",
-                "29": "BENIGEMBLA",
-                "30": "BENIDOLEIG",
-                "31": "BENIDORM",
-                "32": "BENIFALLIM",
-                "33": "BENIFATO",
-                "34": "BENIJOFAR",
-                "35": "BENILLOBA",
-                "36": "BENILLUP",
-                "37": "BENIMANTELL",
-                "38": "BENIMARFULL",
-                "39": "BENIMASSOT",
-                "40": "BENIMELI",
-                "41": "BENISSA",
-                "42": "BENITACHELL / EL POBLE NOU",
-                "43": "BIAR",
-                "44": "BIGASTRO",
-                "45": "BOLULLA",
-                "46": "BUSOT",
-                "47": "CALP",
-                "48": "CALLOSA D'EN SARRIA",
-                "49": "CALLOSA DE SEGURA",
-                "50": "EL CAMPELLO",
-                "51": "CAMPO DE MIRRA / EL CAMP DE MI",
-                "52": "CAÑADA",
-                "53": "CASTALLA",
-                "54": "CASTELL DE CASTELLS",
-                "55": "CATRAL",
-                "56": "COCENTAINA",
-                "57": "CONFRIDES",
-                "58": "COX",
-                "59": "CREVILLENT",
-                "60": "QUATRETONDETA",
-                "61": "DAYA NUEVA",
-                "62": "DAYA VIEJA",
-                "63": "DENIA",
-                "64": "DOLORES",
-                "65": "ELCHE/ELX",
-                "66": "ELDA",
-                "67": "FACHECA",
-                "68": "FAMORCA",
-                "69": "FINESTRAT",
-                "70": "FORMENTERA DEL SEGURA",
-                "71": "GATA DE GORGOS",
-                "72": "GAIANES",
-                "73": "GORGA",
-                "74": "GRANJA DE ROCAMORA",
-                "75": "EL CASTELL DE GUADALEST",
-                "76": "GUARDAMAR DEL SEGURA",
-                "77": "EL FONDO DE LES NEUS / HONDON",
-                "78": "HONDON DE LOS FRAILES",
-                "79": "IBI",
-                "80": "JACARILLA",
-                "81": "XALO",
-                "82": "JAVEA/XABIA",
-                "83": "JIJONA/XIXONA",
-                "84": "LORCHA/L'ORXA",
-                "85": "LLIBER",
-                "86": "MILLENA",
-                "88": "MONFORTE DEL CID",
-                "89": "MONOVAR/MONOVER",
-                "90": "MUTXAMEL",
-                "91": "MURLA",
-                "92": "MURO DE ALCOY",
-                "93": "NOVELDA",
-                "94": "LA NUCIA",
-                "95": "ONDARA",
-                "96": "ONIL",
-                "97": "ORBA",
-                "98": "ORXETA",
-                "99": "ORIHUELA",
-                "100": "PARCENT",
-                "101": "PEDREGUER",
-                "102": "PEGO",
-                "103": "PENAGUILA",
-                "104": "PETRER",
-                "105": "EL PINOS / PINOSO",
-                "106": "PLANES",
-                "107": "POLOP",
-                "109": "RAFAL",
-                "110": "EL RAFOL D'ALMUNIA",
-                "111": "REDOVAN",
-                "112": "RELLEU",
-                "113": "ROJALES",
-                "114": "LA ROMANA",
-                "115": "SAGRA",
-                "116": "SALINAS",
-                "117": "SANET Y NEGRALS",
-                "118": "SAN FULGENCIO",
-                "119": "SANT JOAN D'ALACANT",
-                "120": "SAN MIGUEL DE SALINAS",
-                "121": "SANTA POLA",
-                "122": "SAN VICENTE DEL RASPEIG / SANT",
-                "123": "SAX",
-                "124": "SELLA",
-                "125": "SENIJA",
-                "126": "ELS POBLETS",
-                "127": "TARBENA",
-                "128": "TEULADA",
-                "129": "TIBI",
-                "130": "TOLLOS",
-                "131": "TORMOS",
-                "132": "TORREMANZANAS / LA TORRE DE",
-                "133": "TORREVIEJA",
-                "134": "LA VALL D' ALCALA",
-                "135": "LA VALL D' EBO",
-                "136": "VALL DE GALLINERA",
-                "137": "LA VALL DE LAGUAR",
-                "138": "EL VERGER",
-                "139": "VILLAJOYOSA / LA VILA JOIOSA",
-                "140": "VILLENA",
-                "141": "LOS MONTESINOS",
-                "142": "PILAR DE LA HORADADA",
-                "143": "SAN ISIDRO",
-                "900": "ALICANTE/ALACANT",
-            };
-        }
-        else if (provinceCode === 4) {
-            municipalityNames = {
-                "1": "ABLA",
-                "2": "ABRUCENA",
-                "3": "ADRA",
-                "4": "ALBANCHEZ",
-                "5": "ALBOLODUY",
-                "6": "ALBOX",
-                "7": "ALCOLEA",
-                "8": "ALCONTAR",
-                "9": "ALCUDIA DE MONTEAGUD",
-                "10": "ALHABIA",
-                "11": "ALHAMA DE ALMERIA",
-                "12": "ALICU",
-                "14": "ALMOCITA",
-                "15": "ALSODUX",
-                "16": "ANTAS",
-                "17": "ARBOLEAS",
-                "18": "ARMUÑA DEL ALMANZORA",
-                "19": "BACARES",
-                "20": "BAYARCAL",
-                "21": "BAYARQUE",
-                "22": "BEDAR",
-                "23": "BEIRES",
-                "24": "BENAHADUX",
-                "26": "BENITAGLA",
-                "27": "BENIZALON",
-                "28": "BENTARIQUE",
-                "29": "BERJA",
-                "30": "CANJAYAR",
-                "31": "CANTORIA",
-                "32": "CARBONERAS",
-                "33": "CASTRO DE FILABRES",
-                "34": "COBDAR",
-                "35": "CUEVAS DEL ALMANZORA",
-                "36": "CHERCOS",
-                "37": "CHIRIVEL",
-                "38": "DALIAS",
-                "40": "LAS TRES VILLAS",
-                "41": "ENIX",
-                "43": "FELIX",
-                "44": "FINES",
-                "45": "FIÑANA",
-                "46": "FONDON",
-                "47": "GADOR",
-                "48": "LOS GALLARDOS",
-                "49": "GARRUCHA",
-                "50": "GERGAL",
-                "51": "HUECIJA",
-                "52": "HUERCAL DE ALMERIA",
-                "53": "HUERCAL-OVERA",
-                "54": "ILLAR",
-                "55": "INSTINCION",
-                "56": "LAROYA",
-                "57": "LAUJAR DE ANDARAX",
-                "58": "LIJAR",
-                "59": "LUBRIN",
-                "60": "LUCAINENA DE LAS TORRES",
-                "61": "LUCAR",
-                "62": "MACAEL",
-                "63": "MARIA",
-                "64": "MOJACAR",
-                "65": "NACIMIENTO",
-                "66": "NIJAR",
-                "67": "OHANES",
-                "68": "OLULA DE CASTRO",
-                "69": "OLULA DEL RIO",
-                "70": "ORIA",
-                "71": "PADULES",
-                "72": "PARTALOA",
-                "73": "PATERNA DEL RIO",
-                "74": "PECHINA",
-                "75": "PULPI",
-                "76": "PURCHENA",
-                "77": "RAGOL",
-                "78": "RIOJA",
-                "79": "ROQUETAS DE MAR",
-                "80": "SANTA CRUZ",
-                "81": "SANTA FE DE MONDUJAR",
-                "82": "SENES",
-                "83": "SERON",
-                "84": "SIERRO",
-                "85": "SOMONTIN",
-                "86": "SORBAS",
-                "87": "SUFLI",
-                "88": "TABERNAS",
-                "89": "TABERNO",
-                "90": "TAHAL",
-                "91": "TERQUE",
-                "92": "TIJOLA",
-                "93": "TURRE",
-                "94": "TURRILLAS",
-                "95": "ULEILA DEL CAMPO",
-                "96": "URRACAL",
-                "97": "VELEFIQUE",
-                "98": "VELEZ BLANCO",
-                "99": "VELEZ RUBIO",
-                "100": "VERA",
-                "101": "VIATOR",
-                "102": "VICAR",
-                "103": "ZURGENA",
-                "104": "EL EJIDO",
-                "105": "LA MOJONERA",
-                "106": "BALANEGRA",
-                "900": "ALMERIA",
-            };
-        }
-        else if (provinceCode === 5) {
-            municipalityNames = {
-                "1": "ADANERO",
-                "2": "LA ADRADA",
-                "5": "ALBORNOS",
-                "7": "ALDEANUEVA DE SANTA CRUZ",
-                "8": "ALDEASECA",
-                "10": "LA ALDEHUELA",
-                "12": "AMAVIDA",
-                "13": "EL ARENAL",
-                "14": "ARENAS DE SAN PEDRO",
-                "15": "AREVALILLO",
-                "16": "AREVALO",
-                "17": "AVEINTE",
-                "18": "AVELLANEDA",
-                "21": "EL BARCO DE AVILA",
-                "22": "BARRACO",
-                "23": "BARROMAN",
-                "24": "BECEDAS",
-                "25": "BECEDILLAS",
-                "26": "BERCIAL DE ZAPARDIEL",
-                "27": "LAS BERLANAS",
-                "29": "BERNUY-ZAPARDIEL",
-                "30": "BERROCALEJO DE ARAGONA",
-                "33": "BLASCOMILLAN",
-                "34": "BLASCONUÑO DE MATACABRAS",
-                "35": "BLASCOSANCHO",
-                "36": "EL BOHODON",
-                "37": "BOHOYO",
-                "38": "BONILLA DE LA SIERRA",
-                "39": "BRABOS",
-                "40": "BULARROS",
-                "41": "BURGOHONDO",
-                "42": "CABEZAS DE ALAMBRE",
-                "43": "CABEZAS DEL POZO",
-                "44": "CABEZAS DEL VILLAR",
-                "45": "CABIZUELA",
-                "46": "CANALES",
-                "47": "CANDELEDA",
-                "48": "CANTIVEROS",
-                "49": "CARDEÑOSA",
-                "51": "LA CARRERA",
-                "52": "CASAS DEL PUERTO",
-                "53": "CASASOLA",
-                "54": "CASAVIEJA",
-                "55": "CASILLAS",
-                "56": "CASTELLANOS DEL ZAPARDIEL",
-                "57": "CEBREROS",
-                "58": "CEPEDA LA MORA",
-                "59": "CILLAN",
-                "60": "CISLA",
-                "61": "LA COLILLA",
-                "62": "COLLADO DE CONTRERAS",
-                "63": "COLLADO DEL MIRON",
-                "64": "CONSTANZANA",
-                "65": "CRESPOS",
-                "66": "CUEVAS DEL VALLE",
-                "67": "CHAMARTIN",
-                "69": "DONJIMENO",
-                "70": "DONVIDAS",
-                "72": "ESPINOSA DE LOS CABALLEROS",
-                "73": "FLORES DE AVILA",
-                "74": "FONTIVEROS",
-                "75": "FRESNEDILLA",
-                "76": "EL FRESNO",
-                "77": "FUENTE EL SAUZ",
-                "78": "FUENTES DE AÑO",
-                "79": "GALLEGOS DE ALTAMIROS",
-                "80": "GALLEGOS DE SOBRINOS",
-                "81": "GARGANTA DEL VILLAR",
-                "82": "GAVILANES",
-                "83": "GEMUÑO",
-                "84": "GILBUENA",
-                "85": "GILGARCIA",
-                "86": "GIMIALCON",
-                "87": "GOTARRENDURA",
-                "88": "GRANDES Y SAN MARTIN",
-                "89": "GUISANDO",
-                "90": "GUTIERRE MUÑOZ",
-                "92": "HERNANSANCHO",
-                "93": "EL HERRADON",
-                "94": "HERRERO DE SUSO",
-                "95": "HIGUERA DE LAS DUEÑAS",
-                "96": "LA HIJA DE DIOS",
-                "97": "LA HORCAJADA",
-                "99": "HORCAJO DE LAS TORRES",
-                "100": "EL HORNILLO",
-                "101": "HOYOCASERO",
-                "102": "EL HOYO DE PINARES",
-                "103": "HOYORREDONDO",
-                "104": "HOYOS DEL COLLADO",
-                "105": "HOYOS DEL ESPINO",
-                "106": "HOYOS DE MIGUEL MUÑOZ",
-                "107": "HURTUMPASCUAL",
-                "108": "JUNCIANA",
-                "109": "LANGA",
-                "110": "LANZAHITA",
-                "112": "EL LOSAR",
-                "113": "LOS LLANOS DE TORMES",
-                "114": "MADRIGAL DE LAS ALTAS TORRES",
-                "115": "MAELLO",
-                "116": "MALPARTIDA DE CORNEJA",
-                "117": "MAMBLAS",
-                "118": "MANCERA DE ARRIBA",
-                "119": "MANJABALAGO Y ORTIGOSA RIOALMA",
-                "120": "MARLIN",
-                "121": "MARTIHERRERO",
-                "122": "MARTINEZ",
-                "123": "MEDIANA DE VOLTOYA",
-                "124": "MEDINILLA",
-                "125": "MENGAMUÑOZ",
-                "126": "MESEGAR DE CORNEJA",
-                "127": "MIJARES",
-                "128": "MINGORRIA",
-                "129": "EL MIRON",
-                "130": "MIRONCILLO",
-                "131": "MIRUEÑA DE LOS INFANZONES",
-                "132": "MOMBELTRAN",
-                "133": "MONSALUPE",
-                "134": "MORALEJA DE MATACABRAS",
-                "135": "MUÑANA",
-                "136": "MUÑICO",
-                "138": "MUÑOGALINDO",
-                "139": "MUÑOGRANDE",
-                "140": "MUÑOMER DEL PECO",
-                "141": "MUÑOPEPE",
-                "142": "MUÑOSANCHO",
-                "143": "MUÑOTELLO",
-                "144": "NARRILLOS DEL ALAMO",
-                "145": "NARRILLOS DEL REBOLLAR",
-                "147": "NARROS DEL CASTILLO",
-                "148": "NARROS DEL PUERTO",
-                "149": "NARROS DE SALDUEÑA",
-                "151": "NAVACEPEDILLA DE CORNEJA",
-                "152": "NAVA DE AREVALO",
-                "153": "NAVA DEL BARCO",
-                "154": "NAVADIJOS",
-                "155": "NAVAESCURIAL",
-                "156": "NAVAHONDILLA",
-                "157": "NAVALACRUZ",
-                "158": "NAVALMORAL",
-                "159": "NAVALONGUILLA",
-                "160": "NAVALOSA",
-                "161": "NAVALPERAL DE PINARES",
-                "162": "NAVALPERAL DE TORMES",
-                "163": "NAVALUENGA",
-                "164": "NAVAQUESERA",
-                "165": "NAVARREDONDA DE GREDOS",
-                "166": "NAVARREDONDILLA",
-                "167": "NAVARREVISCA",
-                "168": "LAS NAVAS DEL MARQUES",
-                "169": "NAVATALGORDO",
-                "170": "NAVATEJARES",
-                "171": "NEILA DE SAN MIGUEL",
-                "172": "NIHARRA",
-                "173": "OJOS-ALBOS",
-                "174": "ORBITA",
-                "175": "EL OSO",
-                "176": "PADIERNOS",
-                "177": "PAJARES DE ADAJA",
-                "178": "PALACIOS DE GODA",
-                "179": "PAPATRIGO",
-                "180": "EL PARRAL",
-                "181": "PASCUALCOBO",
-                "182": "PEDRO BERNARDO",
-                "183": "PEDRO RODRIGUEZ",
-                "184": "PEGUERINOS",
-                "185": "PEÑALBA DE AVILA",
-                "186": "PIEDRAHITA",
-                "187": "PIEDRALAVES",
-                "188": "POVEDA",
-                "189": "POYALES DEL HOYO",
-                "190": "POZANCO",
-                "191": "PRADOSEGAR",
-                "192": "PUERTO CASTILLA",
-                "193": "RASUEROS",
-                "194": "RIOCABADO",
-                "195": "RIOFRIO",
-                "196": "RIVILLA DE BARAJAS",
-                "197": "SALOBRAL",
-                "198": "SALVADIOS",
-                "199": "SAN BARTOLOME DE BEJAR",
-                "200": "SAN BARTOLOME DE CORNEJA",
-                "201": "SAN BARTOLOME DE PINARES",
-                "204": "SANCHIDRIAN",
-                "205": "SANCHORREJA",
-                "206": "SAN ESTEBAN DE LOS PATOS",
-                "207": "SAN ESTEBAN DEL VALLE",
-                "208": "SAN ESTEBAN DE ZAPARDIEL",
-                "209": "SAN GARCIA DE INGELMOS",
-                "210": "SAN JUAN DE LA ENCINILLA",
-                "211": "SAN JUAN DE LA NAVA",
-                "212": "SAN JUAN DEL MOLINILLO",
-                "213": "SAN JUAN DEL OLMO",
-                "214": "SAN LORENZO DE TORMES",
-                "215": "SAN MARTIN DE LA VEGA DEL ALBE",
-                "216": "SAN MARTIN DEL PIMPOLLAR",
-                "217": "SAN MIGUEL DE CORNEJA",
-                "218": "SAN MIGUEL DE SERREZUELA",
-                "219": "SAN PASCUAL",
-                "220": "SAN PEDRO DEL ARROYO",
-                "221": "SANTA CRUZ DEL VALLE",
-                "222": "SANTA CRUZ DE PINARES",
-                "224": "SANTA MARIA DEL ARROYO",
-                "225": "SANTA MARIA DEL BERROCAL",
-                "226": "SANTA MARIA DE LOS CABALLEROS",
-                "227": "SANTA MARIA DEL TIETAR",
-                "228": "SANTIAGO DEL COLLADO",
-                "229": "SANTO DOMINGO DE LAS POSADAS",
-                "230": "SANTO TOME DE ZABARCOS",
-                "231": "SAN VICENTE DE AREVALO",
-                "232": "LA SERRADA",
-                "233": "SERRANILLOS",
-                "234": "SIGERES",
-                "235": "SINLABAJOS",
-                "236": "SOLANA DE AVILA",
-                "237": "SOLANA DE RIOALMAR",
-                "238": "SOLOSANCHO",
-                "239": "SOTALVO",
-                "240": "SOTILLO DE LA ADRADA",
-                "241": "EL TIEMBLO",
-                "242": "TIÑOSILLOS",
-                "243": "TOLBAÑOS",
-                "244": "TORMELLAS",
-                "245": "TORNADIZOS DE AVILA",
-                "246": "LA TORRE",
-                "247": "TORTOLES",
-                "249": "UMBRIAS",
-                "251": "VADILLO DE LA SIERRA",
-                "252": "VALDECASA",
-                "253": "VEGA DE SANTA MARIA",
-                "254": "VELAYOS",
-                "256": "VILLAFLOR",
-                "257": "VILLAFRANCA DE LA SIERRA",
-                "258": "VILLANUEVA DE GOMEZ",
-                "259": "VILLANUEVA DEL ACERAL",
-                "260": "VILLANUEVA DEL CAMPILLO",
-                "261": "VILLAR DE CORNEJA",
-                "262": "VILLAREJO DEL VALLE",
-                "263": "VILLATORO",
-                "264": "VIÑEGRA DE MORAÑA",
-                "265": "VITA",
-                "266": "ZAPARDIEL DE LA CAÑADA",
-                "267": "ZAPARDIEL DE LA RIBERA",
-                "269": "SAN JUAN DE GREDOS",
-                "270": "SANTA MARIA DEL CUBILLO",
-                "272": "DIEGO DEL CARPIO",
-                "273": "SANTIAGO DE TORMES",
-                "274": "VILLANUEVA DE AVILA",
-                "900": "AVILA",
-            };
-        }
-        else if (provinceCode === 6) {
-            municipalityNames = {
-                "1": "ACEDERA",
-                "2": "ACEUCHAL",
-                "3": "AHILLONES",
-                "4": "ALANGE",
-                "5": "LA ALBUERA",
-                "6": "ALBURQUERQUE",
-                "7": "ALCONCHEL",
-                "8": "ALCONERA",
-                "9": "ALJUCEN",
-                "10": "ALMENDRAL",
-                "11": "ALMENDRALEJO",
-                "12": "ARROYO DE SAN SERVAN",
-                "13": "ATALAYA",
-                "14": "AZUAGA",
-                "16": "BARCARROTA",
-                "17": "BATERNO",
-                "18": "BENQUERENCIA DE LA SERENA",
-                "19": "BERLANGA",
-                "20": "BIENVENIDA",
-                "21": "BODONAL DE LA SIERRA",
-                "22": "BURGUILLOS DEL CERRO",
-                "23": "CABEZA DEL BUEY",
-                "24": "CABEZA LA VACA",
-                "25": "CALAMONTE",
-                "26": "CALERA DE LEON",
-                "27": "CALZADILLA DE LOS BARROS",
-                "28": "CAMPANARIO",
-                "29": "CAMPILLO DE LLERENA",
-                "30": "CAPILLA",
-                "31": "CARMONITA",
-                "32": "EL CARRASCALEJO",
-                "33": "CASAS DE DON PEDRO",
-                "34": "CASAS DE REINA",
-                "35": "CASTILBLANCO",
-                "36": "CASTUERA",
-                "37": "LA CODOSERA",
-                "38": "CORDOBILLA DE LACARA",
-                "39": "LA CORONADA",
-                "40": "CORTE DE PELEAS",
-                "41": "CRISTINA",
-                "42": "CHELES",
-                "43": "DON ALVARO",
-                "44": "DON BENITO",
-                "45": "ENTRIN BAJO",
-                "46": "ESPARRAGALEJO",
-                "47": "ESPARRAGOSA DE LA SERENA",
-                "48": "ESPARRAGOSA DE LARES",
-                "49": "FERIA",
-                "50": "FREGENAL DE LA SIERRA",
-                "51": "FUENLABRADA DE LOS MONTES",
-                "52": "FUENTE DE CANTOS",
-                "53": "FUENTE DEL ARCO",
-                "54": "FUENTE DEL MAESTRE",
-                "55": "FUENTES DE LEON",
-                "56": "GARBAYUELA",
-                "57": "GARLITOS",
-                "58": "LA GARROVILLA",
-                "59": "GRANJA DE TORREHERMOSA",
-                "60": "GUAREÑA",
-                "61": "LA HABA",
-                "62": "HELECHOSA",
-                "63": "HERRERA DEL DUQUE",
-                "64": "HIGUERA DE LA SERENA",
-                "65": "HIGUERA DE LLERENA",
-                "66": "HIGUERA DE VARGAS",
-                "67": "HIGUERA LA REAL",
-                "68": "HINOJOSA DEL VALLE",
-                "69": "HORNACHOS",
-                "70": "JEREZ DE LOS CABALLEROS",
-                "71": "LA LAPA",
-                "72": "LOBON",
-                "73": "LLERA",
-                "74": "LLERENA",
-                "75": "MAGACELA",
-                "76": "MAGUILLA",
-                "77": "MALCOCINADO",
-                "78": "MALPARTIDA DE LA SERENA",
-                "79": "MANCHITA",
-                "80": "MEDELLIN",
-                "81": "MEDINA DE LAS TORRES",
-                "82": "MENGABRIL",
-                "83": "MERIDA",
-                "84": "MIRANDILLA",
-                "85": "MONESTERIO",
-                "86": "MONTEMOLIN",
-                "87": "MONTERRUBIO DE LA SERENA",
-                "88": "MONTIJO",
-                "89": "LA MORERA",
-                "90": "LA NAVA DE SANTIAGO",
-                "91": "NAVALVILLAR DE PELA",
-                "92": "NOGALES",
-                "93": "OLIVA DE LA FRONTERA",
-                "94": "OLIVA DE MERIDA",
-                "95": "OLIVENZA",
-                "96": "ORELLANA DE LA SIERRA",
-                "97": "ORELLANA LA VIEJA",
-                "98": "PALOMAS",
-                "99": "LA PARRA",
-                "100": "PEÑALSORDO",
-                "101": "PERALEDA DEL ZAUCEJO",
-                "102": "PUEBLA DE ALCOCER",
-                "103": "PUEBLA DE LA CALZADA",
-                "104": "PUEBLA DE LA REINA",
-                "105": "PUEBLA DEL MAESTRE",
-                "106": "PUEBLA DEL PRIOR",
-                "107": "PUEBLA DE OBANDO",
-                "108": "PUEBLA DE SANCHO PEREZ",
-                "109": "QUINTANA DE LA SERENA",
-                "110": "REINA",
-                "111": "RENA",
-                "112": "RETAMAL",
-                "113": "RIBERA DEL FRESNO",
-                "114": "RISCO",
-                "115": "LA ROCA DE LA SIERRA",
-                "116": "SALVALEON",
-                "117": "SALVATIERRA DE LOS BARROS",
-                "118": "SANCTI-SPIRITUS",
-                "119": "SAN PEDRO DE MERIDA",
-                "120": "SANTA AMALIA",
-                "121": "SANTA MARTA",
-                "122": "LOS SANTOS DE MAIMONA",
-                "123": "SAN VICENTE DE ALCANTARA",
-                "124": "SEGURA DE LEON",
-                "125": "SIRUELA",
-                "126": "SOLANA DE LOS BARROS",
-                "127": "TALARRUBIAS",
-                "128": "TALAVERA LA REAL",
-                "129": "TALIGA",
-                "130": "TAMUREJO",
-                "131": "TORRE DE MIGUEL SESMERO",
-                "132": "TORREMAYOR",
-                "133": "TORREMEGIA",
-                "134": "TRASIERRA",
-                "135": "TRUJILLANOS",
-                "136": "USAGRE",
-                "137": "VALDECABALLEROS",
-                "138": "VALDETORRES",
-                "139": "VALENCIA DE LAS TORRES",
-                "140": "VALENCIA DE MOMBUEY",
-                "141": "VALENCIA DEL VENTOSO",
-                "142": "VALVERDE DE BURGUILLOS",
-                "143": "VALVERDE DE LEGANES",
-                "144": "VALVERDE DE LLERENA",
-                "145": "VALVERDE DE MERIDA",
-                "146": "VALLE DE LA SERENA",
-                "147": "VALLE DE MATAMOROS",
-                "148": "VALLE DE SANTA ANA",
-                "149": "VILLAFRANCA DE LOS BARROS",
-                "150": "VILLAGARCIA DE LA TORRE",
-                "151": "VILLAGONZALO",
-                "152": "VILLALBA DE LOS BARROS",
-                "153": "VILLANUEVA DE LA SERENA",
-                "154": "VILLANUEVA DEL FRESNO",
-                "155": "VILLAR DEL REY",
-                "156": "VILLAR DE RENA",
-                "157": "VILLARTA DE LOS MONTES",
-                "158": "ZAFRA",
-                "159": "ZAHINOS",
-                "160": "ZALAMEA DE LA SERENA",
-                "161": "ZARZA-CAPILLA",
-                "162": "LA ZARZA",
-                "165": "GUADIANA DEL CAUDILLO",
-                "167": "PUEBLONUEVO",
-                "169": "VALDELACALZADA",
-                "900": "BADAJOZ",
-            };
-        }
-        else if (provinceCode === 7) {
-            municipalityNames = {
-                "1": "ALARO",
-                "2": "ALAIOR",
-                "3": "ALCUDIA",
-                "4": "ALGAIDA",
-                "5": "ANDRATX",
-                "6": "ARTA",
-                "7": "BANYALBUFAR",
-                "8": "BINISSALEM",
-                "9": "BUGER",
-                "10": "BUNYOLA",
-                "11": "CALVIA",
-                "12": "CAMPANET",
-                "13": "CAMPOS",
-                "14": "CAPDEPERA",
-                "15": "CIUTADELLA DE MENORCA",
-                "16": "CONSELL",
-                "17": "COSTITX",
-                "18": "DEIA",
-                "19": "ESCORCA",
-                "20": "ESPORLES",
-                "21": "ESTELLENCS",
-                "22": "FELANITX",
-                "23": "FERRERIES",
-                "24": "FORMENTERA",
-                "25": "FORNALUTX",
-                "26": "EIVISSA",
-                "27": "INCA",
-                "28": "LLORET DE VISTALEGRE",
-                "29": "LLOSETA",
-                "30": "LLUBI",
-                "31": "LLUCMAJOR",
-                "32": "MAO/MAHON",
-                "33": "MANACOR",
-                "34": "MANCOR DE LA VALL",
-                "35": "MARIA DE LA SALUT",
-                "36": "MARRATXI",
-                "37": "ES MERCADAL",
-                "38": "MONTUIRI",
-                "39": "MURO",
-                "40": "PALMA DE MALLORCA",
-                "41": "PETRA",
-                "42": "POLLENÇA",
-                "43": "PORRERES",
-                "44": "SA POBLA",
-                "45": "PUIGPUNYENT",
-                "46": "SANT ANTONI DE PORTMANY",
-                "47": "SENCELLES",
-                "48": "SANT JOSEP DE SA TALAIA",
-                "49": "SANT JOAN",
-                "50": "SANT JOAN DE LABRITJA",
-                "51": "SANT LLORENC DES CARDASSAR",
-                "52": "SANT LLUIS",
-                "53": "SANTA EUGENIA",
-                "54": "SANTA EULARIA DES RIU",
-                "55": "SANTA MARGALIDA",
-                "56": "SANTA MARIA DEL CAMI",
-                "57": "SANTANYI",
-                "58": "SELVA",
-                "59": "SES SALINES",
-                "60": "SINEU",
-                "61": "SOLLER",
-                "62": "SON SERVERA",
-                "63": "VALLDEMOSSA",
-                "64": "ES CASTELL",
-                "65": "VILAFRANCA BONANY",
-                "66": "ARIANY",
-                "67": "ES MIGJORN GRAN",
-            };
-        }
-        else if (provinceCode === 8) {
-            municipalityNames = {
-                "1": "ABRERA",
-                "2": "AGUILAR DE SEGARRA",
-                "3": "ALELLA",
-                "4": "ALPENS",
-                "5": "L' AMETLLA DEL VALLES",
-                "6": "ARENYS DE MAR",
-                "7": "ARENYS DE MUNT",
-                "8": "ARGENÇOLA",
-                "9": "ARGENTONA",
-                "10": "ARTES",
-                "11": "AVIA",
-                "12": "AVINYO",
-                "13": "AVINYONET DEL PENEDES",
-                "14": "AIGUAFREDA",
-                "15": "BADALONA",
-                "16": "BAGA",
-                "17": "BALENYA",
-                "18": "BALSARENY",
-                "20": "BEGUES",
-                "21": "BELLPRAT",
-                "22": "BERGA",
-                "23": "BIGUES I RIELLS",
-                "24": "BORREDA",
-                "25": "EL BRUC",
-                "26": "EL BRULL",
-                "27": "LES CABANYES",
-                "28": "CABRERA D'ANOIA",
-                "29": "CABRERA DE MAR",
-                "30": "CABRILS",
-                "31": "CALAF",
-                "32": "CALDES D'ESTRAC",
-                "33": "CALDES DE MONTBUI",
-                "34": "CALDERS",
-                "35": "CALELLA",
-                "36": "CALONGE DE SEGARRA",
-                "37": "CALLUS",
-                "38": "CAMPINS",
-                "39": "CANET DE MAR",
-                "40": "CANOVELLES",
-                "41": "CANOVES I SAMALUS",
-                "42": "CANYELLES",
-                "43": "CAPELLADES",
-                "44": "CAPOLAT",
-                "45": "CARDEDEU",
-                "46": "CARDONA",
-                "47": "CARME",
-                "48": "CASSERRES",
-                "49": "CASTELLAR DEL RIU",
-                "50": "CASTELLAR DEL VALLES",
-                "51": "CASTELLAR DE N'HUG",
-                "52": "CASTELLBELL I EL VILAR",
-                "53": "CASTELLBISBAL",
-                "54": "CASTELLCIR",
-                "55": "CASTELLDEFELS",
-                "56": "CASTELL DE L'ARENY",
-                "57": "CASTELLET I LA GORNAL",
-                "58": "CASTELLFOLLIT DEL BOIX",
-                "59": "CASTELLFOLLIT DE RIUBREGOS",
-                "60": "CASTELLGALI",
-                "61": "CASTELLNOU DE BAGES",
-                "62": "CASTELLOLI",
-                "63": "CASTELLTERÇOL",
-                "64": "CASTELLVI DE LA MARCA",
-                "65": "CASTELLVI DE ROSANES",
-                "66": "CENTELLES",
-                "67": "CERVELLO",
-                "68": "COLLBATO",
-                "69": "COLLSUSPINA",
-                "70": "COPONS",
-                "71": "CORBERA DE LLOBREGAT",
-                "72": "CORNELLA DE LLOBREGAT",
-                "73": "CUBELLES",
-                "74": "DOSRIUS",
-                "75": "ESPARREGUERA",
-                "76": "ESPLUGUES DE LLOBREGAT",
-                "77": "L' ESPUNYOLA",
-                "78": "L' ESTANY",
-                "79": "FIGOLS",
-                "80": "FOGARS DE MONTCLUS",
-                "81": "FOGARS DE LA SELVA",
-                "82": "FOLGUEROLES",
-                "83": "FONOLLOSA",
-                "84": "FONT-RUBI",
-                "85": "LES FRANQUESES DEL VALLES",
-                "86": "GALLIFA",
-                "87": "LA GARRIGA",
-                "88": "GAVA",
-                "89": "GAIA",
-                "90": "GELIDA",
-                "91": "GIRONELLA",
-                "92": "GISCLARENY",
-                "93": "LA GRANADA",
-                "94": "GRANERA",
-                "95": "GRANOLLERS",
-                "96": "GUALBA",
-                "97": "SANT SALVADOR DE GUARDIOLA",
-                "98": "GUARDIOLA DE BERGUEDA",
-                "99": "GURB",
-                "100": "L'HOSPITALET DE LLOBREGAT",
-                "101": "IGUALADA",
-                "102": "JORBA",
-                "103": "LA LLACUNA",
-                "104": "LA LLAGOSTA",
-                "105": "LLINARS DEL VALLES",
-                "106": "LLIÇA D' AMUNT",
-                "107": "LLIÇA DE VALL",
-                "108": "LLUÇA",
-                "109": "MALGRAT DE MAR",
-                "110": "MALLA",
-                "111": "MANLLEU",
-                "112": "MANRESA",
-                "113": "MARTORELL",
-                "114": "MARTORELLES",
-                "115": "LES MASIES DE RODA",
-                "116": "LES MASIES DE VOLTREGA",
-                "117": "EL MASNOU",
-                "118": "MASQUEFA",
-                "119": "MATADEPERA",
-                "120": "MATARO",
-                "121": "MEDIONA",
-                "122": "MOLINS DE REI",
-                "123": "MOLLET DEL VALLES",
-                "124": "MONTCADA I REIXAC",
-                "125": "MONTGAT",
-                "126": "MONISTROL DE MONTSERRAT",
-                "127": "MONISTROL DE CALDERS",
-                "128": "MUNTANYOLA",
-                "129": "MONTCLAR",
-                "130": "MONTESQUIU",
-                "131": "MONTMAJOR",
-                "132": "MONTMANEU",
-                "133": "FIGARO I MONTMANY",
-                "134": "MONTMELO",
-                "135": "MONTORNES DEL VALLES",
-                "136": "MONTSENY",
-                "137": "MOIA",
-                "138": "MURA",
-                "139": "NAVARCLES",
-                "140": "NAVAS",
-                "141": "LA NOU DE BERGUEDA",
-                "142": "ODENA",
-                "143": "OLVAN",
-                "144": "OLERDOLA",
-                "145": "OLESA DE BONESVALLS",
-                "146": "OLESA DE MONTSERRAT",
-                "147": "OLIVELLA",
-                "148": "OLOST",
-                "149": "ORIS",
-                "150": "ORISTA",
-                "151": "ORPI",
-                "152": "ORRIUS",
-                "153": "PACS DEL PENEDES",
-                "154": "PALAFOLLS",
-                "155": "PALAU-SOLITA I PLEGAMANS",
-                "156": "PALLEJA",
-                "157": "EL PAPIOL",
-                "158": "PARETS DE VALLES",
-                "159": "PERAFITA",
-                "160": "PIERA",
-                "161": "ELS HOSTALETS DE PIEROLA",
-                "162": "PINEDA DE MAR",
-                "163": "EL PLA DEL PENEDES",
-                "164": "LA POBLA DE CLARAMUNT",
-                "165": "LA POBLA DE LILLET",
-                "166": "POLINYA",
-                "167": "PONTONS",
-                "168": "EL PRAT DE LLOBREGAT",
-                "169": "ELS PRATS DE REI",
-                "170": "PRATS DE LLUÇANES",
-                "171": "PREMIA DE MAR",
-                "173": "PUIGDALBER",
-                "174": "PUIG-REIG",
-                "175": "PUJALT",
-                "176": "LA QUAR",
-                "177": "RAJADELL",
-                "178": "RELLINARS",
-                "179": "RIPOLLET",
-                "180": "LA ROCA DEL VALLES",
-                "181": "EL PONT DE VILOMARA I ROCAFORT",
-                "182": "RODA DE TER",
-                "183": "RUBI",
-                "184": "RUBIO",
-                "185": "RUPIT I PRUIT",
-                "186": "SABADELL",
-                "187": "SAGAS",
-                "188": "SANT PERE SALLAVINERA",
-                "189": "SALDES",
-                "190": "SALLENT",
-                "191": "SANTPEDOR",
-                "192": "SANT ISCLE DE VALLALTA",
-                "193": "SANT ADRIA DE BESOS",
-                "194": "SANT AGUSTI DE LLUÇANES",
-                "195": "SANT ANDREU DE LA BARCA",
-                "196": "SANT ANDREU DE LLAVANERES",
-                "197": "SANT ANTONI DE VILAMAJOR",
-                "198": "SANT BARTOMEU DEL GRAU",
-                "199": "SANT BOI DE LLOBREGAT",
-                "200": "SANT BOI DE LLUÇANES",
-                "201": "SANT CELONI",
-                "202": "SANT CEBRIA DE VALLALTA",
-                "203": "SANT CLIMENT DE LLOBREGAT",
-                "204": "SANT CUGAT DEL VALLES",
-                "205": "SANT CUGAT DE SESGARRIGUES",
-                "206": "SANT ESTEVE DE PALAUTORDERA",
-                "207": "SANT ESTEVE SESROVIRES",
-                "208": "SANT FOST DE CAMPSENTELLES",
-                "209": "SANT FELIU DE CODINES",
-                "210": "SANT FELIU DE LLOBREGAT",
-                "211": "SANT FELIU SASSERRA",
-                "212": "SANT FRUITOS DE BAGES",
-                "213": "VILASSAR DE DALT",
-                "214": "SANT HIPOLIT DE VOLTREGA",
-                "215": "SANT JAUME DE FRONTANYA",
-                "216": "SANT JOAN DESPI",
-                "217": "VILASSAR DE MAR",
-                "218": "SANT JULIA DE VILATORTA",
-                "219": "SANT JUST DESVERN",
-                "220": "SANT LLORENÇ D' HORTONS",
-                "221": "SANT LLORENÇ SAVALL",
-                "222": "SANT MARTI DE CENTELLES",
-                "223": "SANT MARTI D'ALBARS",
-                "224": "CALLDETENES",
-                "225": "SANT JOAN DE VILATORRADA",
-                "226": "SANT MARTI DE TOUS",
-                "227": "SANT MARTI SARROCA",
-                "228": "SANT MARTI DE SESGUEIOLES",
-                "229": "SANT MATEU DE BAGES",
-                "230": "PREMIA DE DALT",
-                "231": "SANT PERE DE RIBES",
-                "232": "SANT PERE DE RIUDEBITLLES",
-                "233": "SANT PERE DE TORELLO",
-                "234": "SANT PERE DE VILAMAJOR",
-                "235": "SANT POL DE MAR",
-                "236": "SANT QUINTI DE MEDIONA",
-                "237": "SANT QUIRZE DE BESORA",
-                "238": "SANT QUIRZE DEL VALLES",
-                "239": "SANT QUIRZE DE SAFAJA",
-                "240": "SANT SADURNI D'ANOIA",
-                "241": "SANT SADURNI D'OSORMOR",
-                "242": "MARGANELL",
-                "243": "SANTA CECILIA DE VOLTREGA",
-                "244": "SANTA COLOMA DE CERVELLO",
-                "245": "SANTA COLOMA DE GRAMENET",
-                "246": "SANTA EUGENIA DE BERGA",
-                "247": "SANTA EULALIA DE RIUPRIMER",
-                "248": "SANTA EULALIA DE RONÇANA",
-                "249": "SANTA FE DEL PENEDES",
-                "250": "SANTA MARGARIDA DE MONTBUI",
-                "251": "SANTA MARGARIDA I ELS MONJOS",
-                "252": "BARBERA DEL VALLES",
-                "253": "SANTA MARIA DE BESORA",
-                "254": "ESQUIROL, L'",
-                "255": "SANTA MARIA DE MERLES",
-                "256": "SANTA MARIA DE MARTORELLES",
-                "257": "SANTA MARIA DE MIRALLES",
-                "258": "SANTA MARIA D'OLO",
-                "259": "SANTA MARIA DE PALAUTORDERA",
-                "260": "SANTA PERPETUA DE MOGODA",
-                "261": "SANTA SUSANNA",
-                "262": "SANT VICENÇ DE CASTELLET",
-                "263": "SANT VICENÇ DELS HORTS",
-                "264": "SANT VICENÇ DE MONTALT",
-                "265": "SANT VICENÇ DE TORELLO",
-                "266": "CERDANYOLA DEL VALLES",
-                "267": "SENTMENAT",
-                "268": "CERCS",
-                "269": "SEVA",
-                "270": "SITGES",
-                "271": "SOBREMUNT",
-                "272": "SORA",
-                "273": "SUBIRATS",
-                "274": "SURIA",
-                "275": "TAVERNOLES",
-                "276": "TAGAMANENT",
-                "277": "TALAMANCA",
-                "278": "TARADELL",
-                "279": "TERRASSA",
-                "280": "TAVERTET",
-                "281": "TEIA",
-                "282": "TIANA",
-                "283": "TONA",
-                "284": "TORDERA",
-                "285": "TORELLO",
-                "286": "LA TORRE DE CLARAMUNT",
-                "287": "TORRELAVIT",
-                "288": "TORRELLES DE FOIX",
-                "289": "TORRELLES DE LLOBREGAT",
-                "290": "ULLASTRELL",
-                "291": "VACARISSES",
-                "292": "VALLBONA D'ANOIA",
-                "293": "VALLCEBRE",
-                "295": "VALLGORGUINA",
-                "296": "VALLIRANA",
-                "297": "VALLROMANES",
-                "298": "VECIANA",
-                "299": "VIC",
-                "300": "VILADA",
-                "301": "VILADECAVALLS",
-                "302": "VILADECANS",
-                "303": "VILANOVA DEL CAMI",
-                "304": "VILANOVA DE SAU",
-                "305": "VILOBI DEL PENEDES",
-                "306": "VILAFRANCA DEL PENEDES",
-                "307": "VILALBA SASSERRA",
-                "308": "VILANOVA I LA GELTRU",
-                "309": "VIVER I SERRATEIX",
-                "310": "VILANOVA DEL VALLES",
-                "311": "SANT JULIA DE CERDANYOLA",
-                "312": "BADIA DEL VALLES",
-                "313": "LA PALMA DE CERVELLO",
-                "900": "BARCELONA",
-            };
-        }
-        else if (provinceCode === 9) {
-            municipalityNames = {
-                "1": "ABAJAS",
-                "3": "ADRADA DE HAZA",
-                "6": "AGUAS CANDIDAS",
-                "7": "AGUILAR DE BUREBA",
-                "9": "ALBILLOS",
-                "10": "ALCOCERO DE MOLA",
-                "11": "ALFOZ DE BRICIA",
-                "12": "ALFOZ DE SANTA GADEA",
-                "13": "ALTABLE",
-                "14": "LOS ALTOS",
-                "16": "AMEYUGO",
-                "17": "ANGUIX",
-                "18": "ARANDA DE DUERO",
-                "19": "ARANDILLA",
-                "20": "ARAUZO DE MIEL",
-                "21": "ARAUZO DE SALCE",
-                "22": "ARAUZO DE TORRE",
-                "23": "ARCOS",
-                "24": "ARENILLAS DE RIOPISUERGA",
-                "26": "ARIJA",
-                "27": "ARLANZON",
-                "28": "ARRAYA DE OCA",
-                "30": "ATAPUERCA",
-                "31": "LOS AUSINES",
-                "33": "AVELLANOSA DE MUÑO",
-                "34": "BAHABON DE ESGUEVA",
-                "35": "LOS BALBASES",
-                "36": "BAÑOS DE VALDEARADOS",
-                "37": "BAÑUELOS DE BUREBA",
-                "38": "BARBADILLO DE HERREROS",
-                "39": "BARBADILLO DEL MERCADO",
-                "40": "BARBADILLO DEL PEZ",
-                "42": "BARRIO DE MUÑO",
-                "44": "LOS BARRIOS DE BUREBA",
-                "45": "BARRIOS DE COLINA",
-                "47": "BASCONCILLOS DEL TOZO",
-                "48": "BASCUÑANA",
-                "49": "BELBIMBRE",
-                "50": "BELORADO",
-                "52": "BERBERANA",
-                "53": "BERLANGAS DE ROA",
-                "54": "BERZOSA DE BUREBA",
-                "56": "BOZOO",
-                "57": "BRAZACORTA",
-                "58": "BRIVIESCA",
-                "59": "BUGEDO",
-                "60": "BUNIEL",
-                "62": "BUSTO DE BUREBA",
-                "63": "CABAÑES DE ESGUEVA",
-                "64": "CABEZON DE LA SIERRA",
-                "65": "CABIA",
-                "66": "CALERUEGA",
-                "68": "CAMPILLO DE ARANDA",
-                "69": "CAMPOLARA",
-                "70": "CANICOSA DE LA SIERRA",
-                "71": "CANTABRANA",
-                "73": "CARAZO",
-                "74": "CARCEDO DE BUREBA",
-                "75": "CARCEDO DE BURGOS",
-                "76": "CARDEÑADIJO",
-                "77": "CARDEÑAJIMENO",
-                "78": "CARDEÑUELA DE RIO PICO",
-                "79": "CARRIAS",
-                "80": "CASCAJARES DE BUREBA",
-                "81": "CASCAJARES DE LA SIERRA",
-                "82": "CASTELLANOS DE CASTRO",
-                "85": "CASTILDELGADO",
-                "86": "CASTIL DE PEONES",
-                "87": "CASTRILLO DE LA REINA",
-                "88": "CASTRILLO DE LA VEGA",
-                "89": "CASTRILLO DEL VAL",
-                "91": "CASTRILLO DE RIOPISUERGA",
-                "93": "CASTRILLO MOTA DE JUDIOS",
-                "94": "CASTROJERIZ",
-                "96": "CAYUELA",
-                "97": "CEBRECOS",
-                "98": "CELADA DEL CAMINO",
-                "101": "CEREZO DE RIOTIRON",
-                "103": "CERRATON DE JUARROS",
-                "104": "CIADONCHA",
-                "105": "CILLAPERLATA",
-                "106": "CILLERUELO DE ABAJO",
-                "107": "CILLERUELO DE ARRIBA",
-                "108": "CIRUELOS DE CERVERA",
-                "111": "COGOLLOS",
-                "112": "CONDADO DE TREVIÑO",
-                "113": "CONTRERAS",
-                "115": "CORUÑA DEL CONDE",
-                "116": "COVARRUBIAS",
-                "117": "CUBILLO DEL CAMPO",
-                "118": "CUBO DE BUREBA",
-                "120": "LA CUEVA DE ROA",
-                "122": "CUEVAS DE SAN CLEMENTE",
-                "123": "ENCIO",
-                "125": "ESPINOSA DE CERVERA",
-                "126": "ESPINOSA DEL CAMINO",
-                "127": "ESPINOSA DE LOS MONTEROS",
-                "128": "ESTEPAR",
-                "130": "FONTIOSO",
-                "131": "FRANDOVINEZ",
-                "132": "FRESNEDA DE LA SIERRA",
-                "133": "FRESNEÑA",
-                "134": "FRESNILLO DE LAS DUEÑAS",
-                "135": "FRESNO DE RIOTIRON",
-                "136": "FRESNO DE RODILLA",
-                "137": "FRIAS",
-                "138": "FUENTEBUREBA",
-                "139": "FUENTECEN",
-                "140": "FUENTELCESPED",
-                "141": "FUENTELISENDO",
-                "142": "FUENTEMOLINOS",
-                "143": "FUENTENEBRO",
-                "144": "FUENTESPINA",
-                "146": "GALBARROS",
-                "147": "LA GALLEGA",
-                "151": "GRIJALBA",
-                "152": "GRISALEÑA",
-                "154": "GUMIEL DE IZAN",
-                "155": "GUMIEL DEL MERCADO",
-                "157": "HACINAS",
-                "158": "HAZA",
-                "162": "HONTANAS",
-                "163": "HONTANGAS",
-                "165": "HONTORIA DE LA CANTERA",
-                "166": "HONTORIA DEL PINAR",
-                "167": "HONTORIA DE VALDEARADOS",
-                "169": "LAS HORMAZAS",
-                "170": "HORNILLOS DEL CAMINO",
-                "171": "LA HORRA",
-                "172": "HORTIGUELA",
-                "173": "HOYALES DE ROA",
-                "175": "HUERMECES",
-                "176": "HUERTA DE ARRIBA",
-                "177": "HUERTA DE REY",
-                "178": "HUMADA",
-                "179": "HURONES",
-                "180": "IBEAS DE JUARROS",
-                "181": "IBRILLOS",
-                "182": "IGLESIARRUBIA",
-                "183": "IGLESIAS",
-                "184": "ISAR",
-                "185": "ITERO DEL CASTILLO",
-                "186": "JARAMILLO DE LA FUENTE",
-                "187": "JARAMILLO QUEMADO",
-                "191": "VALLE DE LOSA",
-                "192": "JUNTA DE TRASLALOMA",
-                "193": "JUNTA DE VILLALBA DE LOSA",
-                "194": "JURISDICCION DE LARA",
-                "195": "JURISDICCION DE SAN ZADORNIL",
-                "197": "LERMA",
-                "199": "LLANO DE BUREBA",
-                "200": "MADRIGAL DEL MONTE",
-                "201": "MADRIGALEJO DEL MONTE",
-                "202": "MAHAMUD",
-                "203": "MAMBRILLA DE CASTREJON",
-                "204": "MAMBRILLAS DE LARA",
-                "205": "MAMOLAR",
-                "206": "MANCILES",
-                "211": "MAZUELA",
-                "213": "MECERREYES",
-                "214": "MEDINA DE POMAR",
-                "216": "MELGAR DE FERNAMENTAL",
-                "218": "MERINDAD DE CUESTA URRIA",
-                "219": "MERINDAD DE MONTIJA",
-                "220": "MERINDAD DE SOTOSCUEVA",
-                "221": "MERINDAD DE VALDEPORRES",
-                "222": "MERINDAD DE VALDIVIELSO",
-                "223": "MILAGROS",
-                "224": "MIRANDA DE EBRO",
-                "225": "MIRAVECHE",
-                "226": "MODUBAR DE LA EMPAREDADA",
-                "228": "MONASTERIO DE LA SIERRA",
-                "229": "MONASTERIO DE RODILLA",
-                "230": "MONCALVILLO",
-                "231": "MONTERRUBIO DE LA DEMANDA",
-                "232": "MONTORIO",
-                "233": "MORADILLO DE ROA",
-                "235": "NAVA DE ROA",
-                "236": "NAVAS DE BUREBA",
-                "237": "NEBREDA",
-                "238": "NEILA",
-                "241": "OLMEDILLO DE ROA",
-                "242": "OLMILLOS DE MUÑO",
-                "245": "OÑA",
-                "246": "OQUILLAS",
-                "248": "ORBANEJA-RIO PICO",
-                "250": "PADILLA DE ABAJO",
-                "251": "PADILLA DE ARRIBA",
-                "252": "PADRONES DE BUREBA",
-                "254": "PALACIOS DE LA SIERRA",
-                "255": "PALACIOS DE RIOPISUERGA",
-                "256": "PALAZUELOS DE LA SIERRA",
-                "257": "PALAZUELOS DE MUÑO",
-                "258": "PAMPLIEGA",
-                "259": "PANCORBO",
-                "261": "PARDILLA",
-                "263": "PARTIDO DE LA SIERRA DE TOBALI",
-                "264": "PEDROSA DE DUERO",
-                "265": "PEDROSA DEL PARAMO",
-                "266": "PEDROSA DEL PRINCIPE",
-                "267": "PEDROSA DE RIO-URBEL",
-                "269": "PEÑARANDA DE DUERO",
-                "270": "PERAL DE ARLANZA",
-                "273": "PIERNIGAS",
-                "274": "PINEDA DE LA SIERRA",
-                "275": "PINEDA-TRASMONTE",
-                "276": "PINILLA DE LOS BARRUECOS",
-                "277": "PINILLA DE LOS MOROS",
-                "278": "PINILLA-TRASMONTE",
-                "280": "POZA DE LA SAL",
-                "281": "PRADANOS DE BUREBA",
-                "282": "PRADOLUENGO",
-                "283": "PRESENCIO",
-                "284": "LA PUEBLA DE ARGANZON",
-                "285": "PUENTEDURA",
-                "287": "QUEMADA",
-                "288": "QUINTANABUREBA",
-                "289": "QUINTANA DEL PIDIO",
-                "290": "ALFOZ DE QUINTANADUEÑAS",
-                "291": "QUINTANAELEZ",
-                "296": "QUINTANAORTUÑO",
-                "297": "QUINTANAPALLA",
-                "298": "QUINTANAR DE LA SIERRA",
-                "301": "QUINTANAVIDES",
-                "303": "QUINTANILLA DEL AGUA-TORDUELES",
-                "304": "QUINTANILLA DE LA MATA",
-                "305": "QUINTANILLA DEL COCO",
-                "307": "LAS QUINTANILLAS",
-                "308": "QUINTANILLA SAN-GARCIA",
-                "311": "QUINTANILLA-VIVAR",
-                "312": "RABANERA DEL PINAR",
-                "313": "RABANOS",
-                "314": "RABE DE LAS CALZADAS",
-                "316": "REBOLLEDO DE LA TORRE",
-                "317": "REDECILLA DEL CAMINO",
-                "318": "REDECILLA DEL CAMPO",
-                "319": "REGUMIEL DE LA SIERRA",
-                "320": "REINOSO",
-                "322": "RETUERTA",
-                "323": "LA REVILLA",
-                "325": "REVILLA DEL CAMPO",
-                "326": "REVILLARRUZ",
-                "327": "REVILLA-VALLEJERA",
-                "328": "REZMONDO",
-                "329": "RIOCAVADO DE LA SIERRA",
-                "331": "VALLE DE LAS NAVAS",
-                "332": "ROA",
-                "334": "ROJAS",
-                "336": "ROYUELA DE RIO FRANCO",
-                "337": "RUBENA",
-                "338": "RUBLACEDO DE ABAJO",
-                "339": "RUCANDIO",
-                "340": "SALAS DE BUREBA",
-                "341": "SALAS DE LOS INFANTES",
-                "343": "SALDAÑA DE BURGOS",
-                "345": "SALINILLAS DE BUREBA",
-                "346": "SAN ADRIAN DE JUARROS",
-                "348": "SAN JUAN DEL MONTE",
-                "349": "SAN MAMES DE BURGOS",
-                "350": "SAN MARTIN DE RUBIALES",
-                "351": "SAN MILLAN DE LARA",
-                "354": "SANTA CECILIA",
-                "356": "SANTA CRUZ DE LA SALCEDA",
-                "357": "SANTA CRUZ DEL VALLE URBION",
-                "358": "SANTA GADEA DEL CID",
-                "359": "SANTA INES",
-                "361": "SANTA MARIA DEL CAMPO",
-                "362": "SANTA MARIA DEL INVIERNO",
-                "363": "SANTA MARIA DE MERCADILLO",
-                "364": "SANTA MARIA-RIBARREDONDA",
-                "366": "SANTA OLALLA DE BUREBA",
-                "367": "SANTIBAÑEZ DE ESGUEVA",
-                "368": "SANTIBAÑEZ DEL VAL",
-                "369": "VALLE DE SANTIBAÑEZ",
-                "370": "SANTO DOMINGO DE SILOS",
-                "372": "SAN VICENTE DEL VALLE",
-                "373": "SARGENTES DE LA LORA",
-                "374": "SARRACIN",
-                "375": "SASAMON",
-                "376": "VALLE DE SEDANO",
-                "377": "LA SEQUERA DE HAZA",
-                "378": "SOLARANA",
-                "380": "SORDILLOS",
-                "381": "SOTILLO DE LA RIBERA",
-                "384": "SOTRAGERO",
-                "385": "SOTRESGUDO",
-                "386": "SUSINOS DEL PARAMO",
-                "387": "TAMARON",
-                "389": "TARDAJOS",
-                "390": "TEJADA",
-                "392": "TERRADILLOS DE ESGUEVA",
-                "393": "TINIEBLAS",
-                "394": "TOBAR",
-                "396": "TORDOMAR",
-                "398": "TORRECILLA DEL MONTE",
-                "399": "TORREGALINDO",
-                "400": "TORRELARA",
-                "401": "TORREPADRE",
-                "402": "TORRESANDINO",
-                "403": "TORTOLES DE ESGUEVA",
-                "404": "TOSANTOS",
-                "406": "TRESPADERNE",
-                "407": "TUBILLA DEL AGUA",
-                "408": "TUBILLA DEL LAGO",
-                "409": "MERINDAD DE RIO UBIERNA",
-                "410": "URBEL DEL CASTILLO",
-                "412": "VADOCONDES",
-                "415": "VALDEANDE",
-                "417": "VALDEZATE",
-                "418": "VALDORROS",
-                "419": "VALMALA",
-                "420": "VALLARTA DE BUREBA",
-                "421": "VALLE DE MANZANEDO",
-                "422": "VALLE DE MENA",
-                "423": "VALLE DE OCA",
-                "424": "VALLE DE TOBALINA",
-                "425": "VALLE DE VALDEBEZANA",
-                "426": "VALLE DE VALDELAGUNA",
-                "427": "VALLE DE VALDELUCIO",
-                "428": "VALLE DE ZAMANZAS",
-                "429": "VALLEGERA",
-                "430": "VALLES DE PALENZUELA",
-                "431": "VALLUERCANES",
-                "433": "LA VID Y BARRIOS",
-                "434": "LA VID DE BUREBA",
-                "435": "VILEÑA",
-                "436": "VILORIA DE RIOJA",
-                "437": "VILVIESTRE DEL PINAR",
-                "439": "VILLADIEGO",
-                "440": "VILLAESCUSA DE ROA",
-                "441": "VILLAESCUSA LA SOMBRIA",
-                "442": "VILLAESPASA",
-                "443": "VILLAFRANCA MONTES DE OCA",
-                "445": "VILLAFRUELA",
-                "446": "VILLAGALIJO",
-                "447": "VILLAGONZALO-PEDERNALES",
-                "450": "VILLAHOZ",
-                "451": "VILLALBA DE DUERO",
-                "452": "VILLALBILLA DE BURGOS",
-                "453": "VILLALBILLA DE GUMIEL",
-                "455": "VILLALDEMIRO",
-                "456": "VILLALMANZO",
-                "458": "VILLAMAYOR DE LOS MONTES",
-                "459": "VILLAMAYOR DE TREVIÑO",
-                "460": "VILLAMBISTIA",
-                "461": "VILLAMEDIANILLA",
-                "462": "VILLAMIEL DE LA SIERRA",
-                "463": "VILLANGOMEZ",
-                "464": "VILLANUEVA DE ARGAÑO",
-                "465": "VILLANUEVA DE CARAZO",
-                "466": "VILLANUEVA DE GUMIEL",
-                "470": "VILLANUEVA DE TEBA",
-                "471": "VILLAQUIRAN DE LA PUEBLA",
-                "472": "VILLAQUIRAN DE LOS INFANTES",
-                "473": "MERINDAD CAST. VIE VILLARCAYO",
-                "474": "VILLARIEZO",
-                "477": "VILLASANDINO",
-                "480": "VILLASUR DE HERREROS",
-                "481": "VILLATUELDA",
-                "483": "VILLAVERDE DEL MONTE",
-                "484": "VILLAVERDE-MOGINA",
-                "488": "VILLAYERNO MORQUILLAS",
-                "489": "VILLAZOPEQUE",
-                "490": "VILLEGAS",
-                "493": "VILLORUEBO",
-                "496": "VIZCAINOS",
-                "498": "ZAEL",
-                "500": "ZARZOSA DE RIOPISUERGA",
-                "501": "ZAZUAR",
-                "503": "ZUÑEDA",
-                "900": "BURGOS",
-            };
-        }
-        else if (provinceCode === 10) {
-            municipalityNames = {
-                "1": "ABADIA",
-                "2": "ABERTURA",
-                "3": "ACEBO",
-                "4": "ACEHUCHE",
-                "5": "ACEITUNA",
-                "6": "AHIGAL",
-                "7": "ALBALA",
-                "8": "ALCANTARA",
-                "9": "ALCOLLARIN",
-                "10": "ALCUESCAR",
-                "11": "ALDEACENTENERA",
-                "12": "ALDEA CANO",
-                "13": "LA ALDEA DEL OBISPO",
-                "14": "ALDEANUEVA DE LA VERA",
-                "15": "ALDEANUEVA DEL CAMINO",
-                "16": "ALDEHUELA DEL JERTE",
-                "17": "ALIA",
-                "18": "ALISEDA",
-                "19": "ALMARAZ",
-                "20": "ALMOHARIN",
-                "22": "ARROYO DE LA LUZ",
-                "23": "ARROYOMOLINOS DE LA VERA",
-                "24": "ARROYOMOLINOS",
-                "25": "BAÑOS DE MONTEMAYOR",
-                "26": "BARRADO",
-                "27": "BELVIS DE MONROY",
-                "28": "BENQUERENCIA",
-                "29": "BERROCALEJO",
-                "30": "BERZOCANA",
-                "31": "BOHONAL DE IBOR",
-                "32": "BOTIJA",
-                "33": "BROZAS",
-                "34": "CABAÑAS DEL CASTILLO",
-                "35": "CABEZABELLOSA",
-                "36": "CABEZUELA DEL VALLE",
-                "37": "CABRERO",
-                "39": "CACHORRILLA",
-                "40": "CADALSO",
-                "41": "CALZADILLA",
-                "42": "CAMINOMORISCO",
-                "43": "CAMPILLO DE DELEITOSA",
-                "44": "CAMPO LUGAR",
-                "45": "CAÑAMERO",
-                "46": "CAÑAVERAL",
-                "47": "CARBAJO",
-                "48": "CARCABOSO",
-                "49": "CARRASCALEJO",
-                "50": "CASAR DE CACERES",
-                "51": "CASAR DE PALOMERO",
-                "52": "CASARES DE LAS HURDES",
-                "53": "CASAS DE DON ANTONIO",
-                "54": "CASAS DE DON GOMEZ",
-                "55": "CASAS DEL CASTAÑAR",
-                "56": "CASAS DEL MONTE",
-                "57": "CASAS DE MILLAN",
-                "58": "CASAS DE MIRAVETE",
-                "59": "CASATEJADA",
-                "60": "CASILLAS DE CORIA",
-                "61": "CASTAÑAR DE IBOR",
-                "62": "CECLAVIN",
-                "63": "CEDILLO",
-                "64": "CEREZO",
-                "65": "CILLEROS",
-                "66": "COLLADO DE LA VERA",
-                "67": "CONQUISTA DE LA SIERRA",
-                "68": "CORIA",
-                "69": "CUACOS DE YUSTE",
-                "70": "LA CUMBRE",
-                "71": "DELEITOSA",
-                "72": "DESCARGAMARIA",
-                "73": "ELJAS",
-                "74": "ESCURIAL",
-                "76": "FRESNEDOSO DE IBOR",
-                "77": "GALISTEO",
-                "78": "GARCIAZ",
-                "79": "LA GARGANTA",
-                "80": "GARGANTA LA OLLA",
-                "81": "GARGANTILLA",
-                "82": "GARGUERA",
-                "83": "GARROVILLAS DE ALCONETAR",
-                "84": "GARVIN",
-                "85": "GATA",
-                "86": "EL GORDO",
-                "88": "LA GRANJA",
-                "90": "GUADALUPE",
-                "91": "GUIJO DE CORIA",
-                "92": "GUIJO DE GALISTEO",
-                "93": "GUIJO DE GRANADILLA",
-                "94": "GUIJO DE SANTA BARBARA",
-                "95": "HERGUIJUELA",
-                "96": "HERNAN-PEREZ",
-                "97": "HERRERA DE ALCANTARA",
-                "98": "HERRERUELA",
-                "99": "HERVAS",
-                "100": "HIGUERA",
-                "101": "HINOJAL",
-                "102": "HOLGUERA",
-                "103": "HOYOS",
-                "104": "HUELAGA",
-                "105": "IBAHERNANDO",
-                "106": "JARAICEJO",
-                "107": "JARAIZ DE LA VERA",
-                "108": "JARANDILLA DE LA VERA",
-                "109": "JARILLA",
-                "110": "JERTE",
-                "111": "LADRILLAR",
-                "112": "LOGROSAN",
-                "113": "LOSAR DE LA VERA",
-                "114": "MADRIGAL DE LA VERA",
-                "115": "MADRIGALEJO",
-                "116": "MADROÑERA",
-                "117": "MAJADAS",
-                "118": "MALPARTIDA DE CACERES",
-                "119": "MALPARTIDA DE PLASENCIA",
-                "120": "MARCHAGAZ",
-                "121": "MATA DE ALCANTARA",
-                "122": "MEMBRIO",
-                "123": "MESAS DE IBOR",
-                "124": "MIAJADAS",
-                "125": "MILLANES",
-                "126": "MIRABEL",
-                "127": "MOHEDAS DE GRANADILLA",
-                "128": "MONROY",
-                "129": "MONTANCHEZ",
-                "130": "MONTEHERMOSO",
-                "131": "MORALEJA",
-                "132": "MORCILLO",
-                "133": "NAVACONCEJO",
-                "134": "NAVALMORAL DE LA MATA",
-                "135": "NAVALVILLAR DE IBOR",
-                "136": "NAVAS DEL MADROÑO",
-                "137": "NAVEZUELAS",
-                "138": "NUÑOMORAL",
-                "139": "OLIVA DE PLASENCIA",
-                "140": "PALOMERO",
-                "141": "PASARON DE LA VERA",
-                "142": "PEDROSO DE ACIM",
-                "143": "PERALEDA DE LA MATA",
-                "144": "PERALEDA DE SAN ROMAN",
-                "145": "PERALES DEL PUERTO",
-                "146": "PESCUEZA",
-                "147": "LA PESGA",
-                "148": "PIEDRAS ALBAS",
-                "149": "PINOFRANQUEADO",
-                "150": "PIORNAL",
-                "151": "PLASENCIA",
-                "152": "PLASENZUELA",
-                "153": "PORTAJE",
-                "154": "PORTEZUELO",
-                "155": "POZUELO DE ZARZON",
-                "156": "PUERTO DE SANTA CRUZ",
-                "157": "REBOLLAR",
-                "158": "RIOLOBOS",
-                "159": "ROBLEDILLO DE GATA",
-                "160": "ROBLEDILLO DE LA VERA",
-                "161": "ROBLEDILLO DE TRUJILLO",
-                "162": "ROBLEDOLLANO",
-                "163": "ROMANGORDO",
-                "164": "RUANES",
-                "165": "SALORINO",
-                "166": "SALVATIERRA DE SANTIAGO",
-                "167": "SAN MARTIN DE TREVEJO",
-                "168": "SANTA ANA",
-                "169": "SANTA CRUZ DE LA SIERRA",
-                "170": "SANTA CRUZ DE PANIAGUA",
-                "171": "SANTA MARTA DE MAGASCA",
-                "172": "SANTIAGO DE ALCANTARA",
-                "173": "SANTIAGO DEL CAMPO",
-                "174": "SANTIBAÑEZ EL ALTO",
-                "175": "SANTIBAÑEZ EL BAJO",
-                "176": "SAUCEDILLA",
-                "177": "SEGURA DE TORO",
-                "178": "SERRADILLA",
-                "179": "SERREJON",
-                "180": "SIERRA DE FUENTES",
-                "181": "TALAVAN",
-                "183": "TALAVERUELA DE LA VERA",
-                "184": "TALAYUELA",
-                "185": "TEJEDA DE TIETAR",
-                "186": "TORIL",
-                "187": "TORNAVACAS",
-                "188": "EL TORNO",
-                "189": "TORRECILLA DE LOS ANGELES",
-                "190": "TORRECILLAS DE LA TIESA",
-                "191": "TORRE DE DON MIGUEL",
-                "192": "TORRE DE SANTA MARIA",
-                "193": "TORREJONCILLO",
-                "194": "TORREJON EL RUBIO",
-                "195": "TORREMENGA",
-                "196": "TORREMOCHA",
-                "197": "TORREORGAZ",
-                "198": "TORREQUEMADA",
-                "199": "TRUJILLO",
-                "200": "VALDASTILLAS",
-                "201": "VALDECAÑAS DE TAJO",
-                "202": "VALDEFUENTES",
-                "203": "VALDEHUNCAR",
-                "204": "VALDELACASA DE TAJO",
-                "205": "VALDEMORALES",
-                "206": "VALDEOBISPO",
-                "207": "VALENCIA DE ALCANTARA",
-                "208": "VALVERDE DE LA VERA",
-                "209": "VALVERDE DEL FRESNO",
-                "210": "VIANDAR DE LA VERA",
-                "211": "VILLA DEL CAMPO",
-                "212": "VILLA DEL REY",
-                "213": "VILLAMESIAS",
-                "214": "VILLAMIEL",
-                "215": "VILLANUEVA DE LA SIERRA",
-                "216": "VILLANUEVA DE LA VERA",
-                "217": "VILLAR DEL PEDROSO",
-                "218": "VILLAR DE PLASENCIA",
-                "219": "VILLASBUENAS DE GATA",
-                "220": "ZARZA DE GRANADILLA",
-                "221": "ZARZA DE MONTANCHEZ",
-                "222": "ZARZA LA MAYOR",
-                "223": "ZORITA",
-                "224": "ALAGON DEL RIO",
-                "225": "VEGAVIANA",
-                "226": "TIETAR",
-                "227": "PUEBLONUEVO DE MIRAMONTES",
-                "900": "CACERES",
-                "901": "ROSALEJO",
-            };
-        }
-        else if (provinceCode === 11) {
-            municipalityNames = {
-                "1": "ALCALA DE LOS GAZULES",
-                "2": "ALCALA DEL VALLE",
-                "3": "ALGAR",
-                "4": "ALGECIRAS",
-                "5": "ALGODONALES",
-                "6": "ARCOS DE LA FRONTERA",
-                "7": "BARBATE",
-                "8": "LOS BARRIOS",
-                "9": "BENAOCAZ",
-                "10": "BORNOS",
-                "11": "EL BOSQUE",
-                "13": "CASTELLAR DE LA FRONTERA",
-                "14": "CONIL DE LA FRONTERA",
-                "15": "CHICLANA DE LA FRONTERA",
-                "16": "CHIPIONA",
-                "17": "ESPERA",
-                "18": "EL GASTOR",
-                "19": "GRAZALEMA",
-                "20": "JEREZ DE LA FRONTERA",
-                "21": "JIMENA DE LA FRONTERA",
-                "22": "LA LINEA DE LA CONCEPCION",
-                "23": "MEDINA-SIDONIA",
-                "24": "OLVERA",
-                "25": "PATERNA DE RIVERA",
-                "26": "PRADO DEL REY",
-                "27": "EL PUERTO DE SANTA MARIA",
-                "28": "PUERTO REAL",
-                "29": "PUERTO SERRANO",
-                "30": "ROTA",
-                "31": "SAN FERNANDO",
-                "32": "SANLUCAR DE BARRAMEDA",
-                "33": "SAN ROQUE",
-                "34": "SETENIL DE LAS BODEGAS",
-                "35": "TARIFA",
-                "36": "TORRE-ALHAQUIME",
-                "37": "TREBUJENA",
-                "38": "UBRIQUE",
-                "39": "VEJER DE LA FRONTERA",
-                "40": "VILLALUENGA DEL ROSARIO",
-                "41": "VILLAMARTIN",
-                "42": "ZAHARA DE LA SIERRA",
-                "43": "BENALUP-CASAS VIEJAS",
-                "44": "SAN JOSE DEL VALLE",
-                "900": "CADIZ",
-            };
-        }
-        else if (provinceCode === 12) {
-            municipalityNames = {
-                "1": "ATZENETA DEL MAESTRAT",
-                "2": "AIN",
-                "3": "ALBOCASSER",
-                "4": "ALCALA DE XIVERT",
-                "5": "L'ALCORA",
-                "6": "ALCUDIA DE VEO",
-                "7": "ALFONDEGUILLA",
-                "8": "ALGIMIA DE ALMONACID",
-                "9": "ALMAZORA / ALMASSORA",
-                "10": "ALMEDIJAR",
-                "11": "ALMENARA",
-                "12": "ALTURA",
-                "13": "ARAÑUEL",
-                "14": "ARES DEL MAESTRAT",
-                "15": "ARGELITA",
-                "16": "ARTANA",
-                "17": "AYODAR",
-                "18": "AZUEBAR",
-                "20": "BARRACAS",
-                "21": "BETXI",
-                "22": "BEJIS",
-                "24": "BENAFER",
-                "25": "BENAFIGOS",
-                "26": "BENASAL",
-                "27": "BENICARLO",
-                "28": "BENICASIM / BENICASSIM",
-                "29": "BENLLOCH",
-                "31": "BORRIOL",
-                "32": "BORRIANA / BURRIANA",
-                "33": "CABANES",
-                "34": "CALIG",
-                "36": "CANET LO ROIG",
-                "37": "CASTELL DE CABRES",
-                "38": "CASTELLFORT",
-                "39": "CASTELLNOVO",
-                "41": "CASTILLO DE VILLAMALEFA",
-                "42": "CATI",
-                "43": "CAUDIEL",
-                "44": "CERVERA DEL MAESTRE",
-                "45": "CINCTORRES",
-                "46": "CIRAT",
-                "48": "CORTES DE ARENOSO",
-                "49": "COSTUR",
-                "50": "COVES DE VINROMA LES",
-                "51": "CULLA",
-                "52": "CHERT / XERT",
-                "53": "CHILCHES/XILXES",
-                "55": "CHODOS / XODOS",
-                "56": "CHOVAR",
-                "57": "ESLIDA",
-                "58": "ESPADILLA",
-                "59": "FANZARA",
-                "60": "FIGUEROLES",
-                "61": "FORCALL",
-                "63": "FUENTE LA REINA",
-                "64": "FUENTES DE AYODAR",
-                "65": "GAIBIEL",
-                "67": "GELDO",
-                "68": "HERBES",
-                "69": "HIGUERAS",
-                "70": "LA JANA",
-                "71": "JERICA",
-                "72": "LUCENA DEL CID",
-                "73": "LUDIENTE",
-                "74": "LA LLOSA",
-                "75": "LA MATA",
-                "76": "MATET",
-                "77": "MONCOFA",
-                "78": "MONTAN",
-                "79": "MONTANEJOS",
-                "80": "MORELLA",
-                "81": "NAVAJAS",
-                "82": "NULES",
-                "83": "OLOCAU DEL REY",
-                "84": "ONDA",
-                "85": "ORPESA/OROPESA DEL MAR",
-                "87": "PALANQUES",
-                "88": "PAVIAS",
-                "89": "PENISCOLA / PEÑISCOLA",
-                "90": "PINA DE MONTALGRAO",
-                "91": "PORTELL DE MORELLA",
-                "92": "PUEBLA DE ARENOSO",
-                "93": "LA POBLA DE BENIFASSA",
-                "94": "LA POBLA TORNESA",
-                "95": "RIBESALBES",
-                "96": "ROSSELL",
-                "97": "SACAÑET",
-                "98": "LA SALZADELLA",
-                "99": "SANT JORDI/SAN JORGE",
-                "100": "SANT MATEU",
-                "101": "SAN RAFAEL DEL RIO",
-                "102": "SANTA MAGDALENA DE PULPIS",
-                "103": "LA SERRATELLA",
-                "104": "SEGORBE",
-                "105": "SIERRA-ENGARCERAN",
-                "106": "SONEJA",
-                "107": "SOT DE FERRER",
-                "108": "SUERAS",
-                "109": "TALES",
-                "110": "TERESA",
-                "111": "TIRIG",
-                "112": "TODOLELLA",
-                "113": "TOGA",
-                "114": "TORAS",
-                "115": "EL TORO",
-                "116": "TORRALBA DEL PINAR",
-                "117": "TORREBLANCA",
-                "118": "TORRECHIVA",
-                "119": "LA TORRE D'EN BESORA",
-                "120": "TORRE D'EN DOMENEC",
-                "121": "TRAIGUERA",
-                "122": "USERAS / LES USERES",
-                "123": "VALLAT",
-                "124": "VALL D'ALBA",
-                "125": "VALL DE ALMONACID",
-                "126": "LA VALL D'UIXO",
-                "127": "VALLIBONA",
-                "128": "VILAFAMES",
-                "129": "VILAFRANCA/VILLAFRANCA DEL CID",
-                "130": "VILLAHERMOSA DEL RIO",
-                "131": "VILLAMALUR",
-                "132": "VILANOVA D'ALCOLEA",
-                "133": "VILLANUEVA DE VIVER",
-                "134": "VILAR DE CANES",
-                "135": "VILA-REAL",
-                "136": "LA VILAVELLA",
-                "137": "VILLORES",
-                "138": "VINAROS",
-                "139": "VISTABELLA DEL MAESTRAZGO",
-                "140": "VIVER",
-                "141": "ZORITA DEL MAESTRAZGO",
-                "142": "ZUCAINA",
-                "143": "ALQUERIAS DEL NIÑO PERDIDO",
-                "144": "SANT JOAN DE MORO",
-                "900": "CASTELLO DE LA PLANA",
-            };
-        }
-        else if (provinceCode === 13) {
-            municipalityNames = {
-                "1": "ABENOJAR",
-                "2": "AGUDO",
-                "3": "ALAMILLO",
-                "4": "ALBALADEJO",
-                "5": "ALCAZAR DE SAN JUAN",
-                "6": "ALCOBA",
-                "7": "ALCOLEA DE CALATRAVA",
-                "8": "ALCUBILLAS",
-                "9": "ALDEA DEL REY",
-                "10": "ALHAMBRA",
-                "11": "ALMADEN",
-                "12": "ALMADENEJOS",
-                "13": "ALMAGRO",
-                "14": "ALMEDINA",
-                "15": "ALMODOVAR DEL CAMPO",
-                "16": "ALMURADIEL",
-                "17": "ANCHURAS",
-                "18": "ARENAS DE SAN JUAN",
-                "19": "ARGAMASILLA DE ALBA",
-                "20": "ARGAMASILLA DE CALATRAVA",
-                "21": "ARROBA DE LOS MONTES",
-                "22": "BALLESTEROS DE CALATRAVA",
-                "23": "BOLAÑOS DE CALATRAVA",
-                "24": "BRAZATORTAS",
-                "25": "CABEZARADOS",
-                "26": "CABEZARRUBIAS DEL PUERTO",
-                "27": "CALZADA DE CALATRAVA",
-                "28": "CAMPO DE CRIPTANA",
-                "29": "CAÑADA DE CALATRAVA",
-                "30": "CARACUEL DE CALATRAVA",
-                "31": "CARRION DE CALATRAVA",
-                "32": "CARRIZOSA",
-                "33": "CASTELLAR DE SANTIAGO",
-                "35": "CORRAL DE CALATRAVA",
-                "36": "LOS CORTIJOS",
-                "37": "COZAR",
-                "38": "CHILLON",
-                "39": "DAIMIEL",
-                "40": "FERNAN CABALLERO",
-                "41": "FONTANAREJO",
-                "42": "FUENCALIENTE",
-                "43": "FUENLLANA",
-                "44": "FUENTE EL FRESNO",
-                "45": "GRANATULA DE CALATRAVA",
-                "46": "GUADALMEZ",
-                "47": "HERENCIA",
-                "48": "HINOJOSAS DE CALATRAVA",
-                "49": "HORCAJO DE LOS MONTES",
-                "50": "LAS LABORES",
-                "51": "LUCIANA",
-                "52": "MALAGON",
-                "53": "MANZANARES",
-                "54": "MEMBRILLA",
-                "55": "MESTANZA",
-                "56": "MIGUELTURRA",
-                "57": "MONTIEL",
-                "58": "MORAL DE CALATRAVA",
-                "59": "NAVALPINO",
-                "60": "NAVAS DE ESTENA",
-                "61": "PEDRO MUÑOZ",
-                "62": "PICON",
-                "63": "PIEDRABUENA",
-                "64": "POBLETE",
-                "65": "PORZUNA",
-                "66": "POZUELO DE CALATRAVA",
-                "67": "LOS POZUELOS DE CVA",
-                "68": "PUEBLA DE DON RODRIGO",
-                "69": "PUEBLA DEL PRINCIPE",
-                "70": "PUERTO LAPICE",
-                "71": "PUERTOLLANO",
-                "72": "RETUERTA DEL BULLAQUE",
-                "73": "SACERUELA",
-                "74": "SAN CARLOS DEL VALLE",
-                "75": "SAN LORENZO DE CALATRAVA",
-                "76": "SANTA CRUZ DE LOS CAÑAMOS",
-                "77": "SANTA CRUZ DE MUDELA",
-                "78": "SOCUELLAMOS",
-                "79": "LA SOLANA",
-                "80": "SOLANA DEL PINO",
-                "81": "TERRINCHES",
-                "82": "TOMELLOSO",
-                "83": "TORRALBA DE CALATRAVA",
-                "84": "TORRE DE JUAN ABAD",
-                "85": "TORRENUEVA",
-                "86": "VALDEMANCO DEL ESTERA",
-                "87": "VALDEPEÑAS",
-                "88": "VALENZUELA DE CALATRAVA",
-                "89": "VILLAHERMOSA",
-                "90": "VILLAMANRIQUE",
-                "91": "VILLAMAYOR DE CALATRAVA",
-                "92": "VILLANUEVA DE LA FUENTE",
-                "93": "VILLANUEVA INFANTES",
-                "94": "VILLANUEVA DE SAN CARLOS",
-                "95": "VILLAR DEL POZO",
-                "96": "VILLARRUBIA DE LOS OJOS",
-                "97": "VILLARTA DE SAN JUAN",
-                "98": "VISO DEL MARQUES",
-                "99": "EL ROBLEDO",
-                "100": "RUIDERA",
-                "101": "ARENALES DE SAN GREGORIO",
-                "102": "LLANOS DEL CAUDILLO",
-                "900": "CIUDAD REAL",
-            };
-        }
-        else if (provinceCode === 14) {
-            municipalityNames = {
-                "1": "ADAMUZ",
-                "2": "AGUILAR",
-                "3": "ALCARACEJOS",
-                "4": "ALMEDINILLA",
-                "5": "ALMODOVAR DEL RIO",
-                "6": "AÑORA",
-                "7": "BAENA",
-                "8": "BELALCAZAR",
-                "9": "BELMEZ",
-                "10": "BENAMEJI",
-                "11": "BLAZQUEZ",
-                "12": "BUJALANCE",
-                "13": "CABRA",
-                "14": "CAÑETE DE LAS TORRES",
-                "15": "CARCABUEY",
-                "16": "CARDEÑA",
-                "17": "LA CARLOTA",
-                "18": "EL CARPIO",
-                "19": "CASTRO DEL RIO",
-                "20": "CONQUISTA",
-                "22": "DOÑA MENCIA",
-                "23": "DOS TORRES",
-                "24": "ENCINAS REALES",
-                "25": "ESPEJO",
-                "26": "ESPIEL",
-                "27": "FERNAN NUÑEZ",
-                "28": "FUENTE LA LANCHA",
-                "29": "FUENTE OBEJUNA",
-                "30": "FUENTE PALMERA",
-                "31": "FUENTE TOJAR",
-                "32": "LA GRANJUELA",
-                "33": "GUADALCAZAR",
-                "34": "GUIJO",
-                "35": "HINOJOSA DEL DUQUE",
-                "36": "HORNACHUELOS",
-                "37": "IZNAJAR",
-                "38": "LUCENA",
-                "39": "LUQUE",
-                "40": "MONTALBAN DE CORDOBA",
-                "41": "MONTEMAYOR",
-                "42": "MONTILLA",
-                "43": "MONTORO",
-                "44": "MONTURQUE",
-                "45": "MORILES",
-                "46": "NUEVA CARTEYA",
-                "47": "OBEJO",
-                "48": "PALENCIANA",
-                "49": "PALMA DEL RIO",
-                "50": "PEDRO ABAD",
-                "51": "PEDROCHE",
-                "52": "PEÑARROYA PUEBLONUEVO",
-                "53": "POSADAS",
-                "54": "POZOBLANCO",
-                "55": "PRIEGO DE CORDOBA",
-                "56": "PUENTE GENIL",
-                "57": "LA RAMBLA",
-                "58": "RUTE",
-                "59": "SAN SEBASTIAN DE LOS BALLESTER",
-                "60": "SANTAELLA",
-                "61": "SANTA EUFEMIA",
-                "62": "TORRECAMPO",
-                "63": "VALENZUELA",
-                "64": "VALSEQUILLO",
-                "65": "LA VICTORIA",
-                "66": "VILLA DEL RIO",
-                "67": "VILLAFRANCA DE CORDOBA",
-                "68": "VILLAHARTA",
-                "69": "VILLANUEVA DE CORDOBA",
-                "70": "VILLANUEVA DEL DUQUE",
-                "71": "VILLANUEVA DEL REY",
-                "72": "VILLARALTO",
-                "73": "VILLAVICIOSA DE CORDOBA",
-                "74": "EL VISO",
-                "75": "ZUHEROS",
-                "900": "CORDOBA",
-            };
-        }
-        else if (provinceCode === 15) {
-            municipalityNames = {
-                "1": "ABEGONDO",
-                "2": "AMES",
-                "3": "ARANGA",
-                "4": "ARES",
-                "5": "ARTEIXO",
-                "6": "ARZUA",
-                "7": "A BAÑA",
-                "8": "BERGONDO",
-                "9": "BETANZOS",
-                "10": "BOIMORTO",
-                "11": "BOIRO",
-                "12": "BOQUEIXON",
-                "13": "BRION",
-                "14": "CABANA DE BERGANTIÑOS",
-                "15": "CABANAS",
-                "16": "CAMARIÑAS",
-                "17": "CAMBRE",
-                "18": "A CAPELA",
-                "19": "CARBALLO",
-                "20": "CARNOTA",
-                "21": "CARRAL",
-                "22": "CEDEIRA",
-                "23": "CEE",
-                "24": "CERCEDA",
-                "25": "CERDIDO",
-                "26": "CESURAS",
-                "27": "COIROS",
-                "28": "CORCUBION",
-                "29": "CORISTANCO",
-                "31": "CULLEREDO",
-                "32": "CURTIS",
-                "33": "DODRO",
-                "34": "DUMBRIA",
-                "36": "FENE",
-                "37": "FERROL",
-                "38": "FISTERRA",
-                "39": "FRADES",
-                "40": "IRIXOA",
-                "41": "LAXE",
-                "42": "A LARACHA",
-                "43": "LOUSAME",
-                "44": "MALPICA DE BERGANTIÑOS",
-                "45": "MAÑON",
-                "46": "MAZARICOS",
-                "47": "MELIDE",
-                "48": "MESIA",
-                "49": "MIÑO",
-                "50": "MOECHE",
-                "51": "MONFERO",
-                "52": "MUGARDOS",
-                "53": "MUXIA",
-                "54": "MUROS",
-                "55": "NARON",
-                "56": "NEDA",
-                "57": "NEGREIRA",
-                "58": "NOIA",
-                "59": "OLEIROS",
-                "60": "ORDES",
-                "61": "OROSO",
-                "62": "ORTIGUEIRA",
-                "63": "OUTES",
-                "64": "OZA DOS RIOS",
-                "65": "PADERNE",
-                "66": "PADRON",
-                "67": "O PINO",
-                "68": "A POBRA DO CARAMIÑAL",
-                "69": "PONTECESO",
-                "70": "PONTEDEUME",
-                "71": "PONTES GARCIA RODRIGUEZ AS",
-                "72": "PORTO DO SON",
-                "73": "RIANXO",
-                "74": "RIBEIRA",
-                "75": "ROIS",
-                "76": "SADA",
-                "77": "SAN SADURNIÑO",
-                "78": "SANTA COMBA",
-                "79": "SANTIAGO DE COMPOSTELA",
-                "80": "SANTISO",
-                "81": "SOBRADO",
-                "82": "AS SOMOZAS",
-                "83": "TEO",
-                "84": "TOQUES",
-                "85": "TORDOIA",
-                "86": "TOURO",
-                "87": "TRAZO",
-                "88": "VALDOVIÑO",
-                "89": "VAL DO DUBRA",
-                "90": "VEDRA",
-                "91": "VILASANTAR",
-                "92": "VILARMAIOR",
-                "93": "VIMIANZO",
-                "94": "ZAS",
-                "95": "CARIÑO",
-                "900": "A CORUÑA",
-            };
-        }
-        else if (provinceCode === 16) {
-            municipalityNames = {
-                "1": "ABIA DE LA OBISPALIA",
-                "2": "EL ACEBRON",
-                "3": "ALARCON",
-                "4": "ALBALADEJO DEL CUENDE",
-                "5": "ALBALATE DE LAS NOGUERAS",
-                "6": "ALBENDEA",
-                "7": "LA ALBERCA DE ZANCARA",
-                "8": "ALCALA DE LA VEGA",
-                "9": "ALCANTUD",
-                "10": "ALCAZAR DEL REY",
-                "11": "ALCOHUJATE",
-                "12": "ALCONCHEL DE LA ESTRELLA",
-                "13": "ALGARRA",
-                "14": "ALIAGUILLA",
-                "15": "LA ALMARCHA",
-                "16": "ALMENDROS",
-                "17": "ALMODOVAR DEL PINAR",
-                "18": "ALMONACID DEL MARQUESADO",
-                "19": "ALTAREJOS",
-                "20": "ARANDILLA DEL ARROYO",
-                "21": "ARCAS",
-                "22": "CHILLARON DE CUENCA",
-                "23": "ARCOS DE LA SIERRA",
-                "24": "ARGUISUELAS",
-                "25": "ARRANCACEPAS",
-                "26": "ATALAYA DEL CAÑAVATE",
-                "27": "BARAJAS DE MELO",
-                "29": "BARCHIN DEL HOYO",
-                "30": "BASCUÑANA DE SAN PEDRO",
-                "31": "BEAMUD",
-                "32": "BELINCHON",
-                "33": "BELMONTE",
-                "34": "BELMONTEJO",
-                "35": "BETETA",
-                "37": "BONICHES",
-                "39": "BUCIEGAS",
-                "40": "BUENACHE DE ALARCON",
-                "41": "BUENACHE DE LA SIERRA",
-                "42": "BUENDIA",
-                "43": "CAMPILLO DE ALTOBUEY",
-                "44": "CAMPILLOS-PARAVIENTOS",
-                "45": "CAMPILLOS-SIERRA",
-                "46": "CANALEJAS DEL ARROYO",
-                "47": "CAÑADA DEL HOYO",
-                "48": "CAÑADAJUNCOSA",
-                "49": "CAÑAMARES",
-                "50": "EL CAÑAVATE",
-                "51": "CAÑAVERAS",
-                "52": "CAÑAVERUELAS",
-                "53": "CAÑETE",
-                "54": "CAÑIZARES",
-                "56": "CARBONERAS DEL GUADAZAON",
-                "57": "CARDENETE",
-                "58": "CARRASCOSA",
-                "59": "CARRASCOSA DE HARO",
-                "60": "CAMPOS DEL PARAISO",
-                "61": "CASAS DE BENITEZ",
-                "62": "CASAS DE FERNANDO ALONSO",
-                "63": "CASAS DE GARCIMOLINA",
-                "64": "CASAS DE GUIJARRO",
-                "65": "CASAS DE HARO",
-                "66": "CASAS DE LOS PINOS",
-                "67": "CASASIMARRO",
-                "68": "CASTEJON",
-                "69": "CASTILLEJO DE INIESTA",
-                "71": "CASTILLEJO-SIERRA",
-                "72": "CASTILLO-ALBARAÑEZ",
-                "73": "CASTILLO DE GARCIMUÑOZ",
-                "74": "CERVERA DEL LLANO",
-                "75": "LA CIERVA",
-                "80": "CUEVA DEL HIERRO",
-                "84": "CHUMILLAS",
-                "85": "ENGUIDANOS",
-                "86": "FRESNEDA DE ALTAREJOS",
-                "87": "FRESNEDA DE LA SIERRA",
-                "88": "LA FRONTERA",
-                "89": "FUENTE DE PEDRO NAHARRO",
-                "90": "FUENTELESPINO DE HARO",
-                "91": "FUENTELESPINO DE MOYA",
-                "92": "FUENTES",
-                "95": "FUERTESCUSA",
-                "96": "GABALDON",
-                "97": "GARABALLA",
-                "98": "EL VALLE DE ALTOMIRA",
-                "99": "GASCUEÑA",
-                "100": "GRAJA DE CAMPALBO",
-                "101": "GRAJA DE INIESTA",
-                "102": "HENAREJOS",
-                "103": "EL HERRUMBLAR",
-                "104": "LA HINOJOSA",
-                "105": "LOS HINOJOSOS",
-                "106": "EL HITO",
-                "107": "HONRUBIA",
-                "108": "HONTANAYA",
-                "109": "HONTECILLAS",
-                "111": "HORCAJO DE SANTIAGO",
-                "112": "HUELAMO",
-                "113": "HUELVES",
-                "114": "HUERGUINA",
-                "115": "HUERTA DE LA OBISPALIA",
-                "116": "HUERTA DEL MARQUESADO",
-                "117": "HUETE",
-                "118": "INIESTA",
-                "119": "FUENTENAVA DE JABAGA",
-                "121": "LAGUNA DEL MARQUESADO",
-                "122": "LAGUNASECA",
-                "123": "LANDETE",
-                "124": "LEDAÑA",
-                "125": "LEGANIEL",
-                "127": "LAS MAJADAS",
-                "128": "MARIANA",
-                "129": "MASEGOSA",
-                "132": "LAS MESAS",
-                "133": "MINGLANILLA",
-                "134": "MIRA",
-                "137": "MONREAL DEL LLANO",
-                "138": "MONTALBANEJO",
-                "139": "MONTALBO",
-                "140": "MONTEAGUDO DE LAS SALINAS",
-                "141": "MOTA DE ALTAREJOS",
-                "142": "MOTA DEL CUERVO",
-                "143": "MOTILLA DEL PALANCAR",
-                "144": "MOYA",
-                "146": "NARBONETA",
-                "148": "OLIVARES DE JUCAR",
-                "149": "OLMEDA DE LA CUESTA",
-                "150": "OLMEDA DEL REY",
-                "151": "OLMEDILLA DE ALARCON",
-                "152": "OLMEDILLA DE ELIZ",
-                "154": "OSA DE LA VEGA",
-                "155": "PAJARON",
-                "156": "PAJARONCILLO",
-                "157": "PALOMARES DEL CAMPO",
-                "158": "PALOMERA",
-                "159": "PARACUELLOS",
-                "160": "PAREDES",
-                "161": "LA PARRA DE LAS VEGAS",
-                "162": "EL PEDERNOSO",
-                "163": "LAS PEDROÑERAS",
-                "164": "EL PERAL",
-                "165": "LA PERALEJA",
-                "166": "LA PESQUERA",
-                "167": "EL PICAZO",
-                "168": "PINAREJO",
-                "169": "PINEDA DE GIGUELA",
-                "170": "PIQUERAS DEL CASTILLO",
-                "171": "PORTALRUBIO DE GUADAMEJUD",
-                "172": "PORTILLA",
-                "174": "POYATOS",
-                "175": "POZOAMARGO",
-                "176": "POZORRUBIO DE SANTIAGO",
-                "177": "POZORRUBIELOS DE LA MANCHA",
-                "178": "EL POZUELO",
-                "179": "PRIEGO",
-                "180": "EL PROVENCIO",
-                "181": "PUEBLA DE ALMENARA",
-                "182": "PUEBLA DEL SALVADOR",
-                "183": "QUINTANAR DEL REY",
-                "184": "RADA DE HARO",
-                "185": "REILLO",
-                "189": "ROZALEN DEL MONTE",
-                "193": "SACEDA-TRASIERRA",
-                "195": "SAELICES",
-                "196": "SALINAS DEL MANZANO",
-                "197": "SALMERONCILLOS",
-                "198": "SALVACAÑETE",
-                "199": "SAN CLEMENTE",
-                "200": "SAN LORENZO DE LA PARRILLA",
-                "201": "SAN MARTIN DE BONICHES",
-                "202": "SAN PEDRO PALMICHES",
-                "203": "SANTA CRUZ DE MOYA",
-                "204": "SANTA MARIA DEL CAMPO RUS",
-                "205": "SANTA MARIA DE LOS LLANOS",
-                "206": "SANTA MARIA DEL VAL",
-                "207": "SISANTE",
-                "208": "SOLERA DE GABALDON",
-                "210": "SOTORRIBAS",
-                "211": "TALAYUELAS",
-                "212": "TARANCON",
-                "213": "TEBAR",
-                "214": "TEJADILLOS",
-                "215": "TINAJAS",
-                "218": "TORRALBA",
-                "220": "TORREJONCILLO DEL REY",
-                "221": "TORRUBIA DEL CAMPO",
-                "222": "TORRUBIA DEL CASTILLO",
-                "224": "TRAGACETE",
-                "225": "TRESJUNCOS",
-                "226": "TRIBALDOS",
-                "227": "UCLES",
-                "228": "UÑA",
-                "230": "LOS VALDECOLMENAS",
-                "232": "VALDETORTOLA",
-                "233": "VALDEMECA",
-                "234": "VALDEMORILLO DE LA SIERRA",
-                "236": "VALDEMORO-SIERRA",
-                "237": "VALDEOLIVAS",
-                "238": "LAS VALERAS",
-                "240": "VALHERMOSO DE LA FUENTE",
-                "243": "VALSALOBRE",
-                "245": "VALVERDE DE JUCAR",
-                "246": "VALVERDEJO",
-                "247": "VARA DE REY",
-                "248": "VEGA DEL CODORNO",
-                "249": "VELLISCA",
-                "252": "VILLACONEJOS DE TRABAQUE",
-                "253": "VILLAESCUSA DE HARO",
-                "254": "VILLAGARCIA DEL LLANO",
-                "255": "VILLALBA DE LA SIERRA",
-                "256": "VILLALBA DEL REY",
-                "257": "VILLALGORDO DEL MARQUESADO",
-                "258": "VILLALPARDO",
-                "259": "VILLAMAYOR DE SANTIAGO",
-                "260": "VILLANUEVA DE GUADAMEJUD",
-                "261": "VILLANUEVA DE LA JARA",
-                "263": "VILLAR DE CAÑAS",
-                "264": "VILLAR DE DOMINGO GARCIA",
-                "265": "VILLAR DE LA ENCINA",
-                "268": "VILLAR DEL HUMO",
-                "269": "VILLAR DEL INFANTADO",
-                "270": "VILLAR Y VELASCO",
-                "273": "VILLAR DE OLALLA",
-                "274": "VILLAREJO DE FUENTES",
-                "275": "VILLAREJO DE LA PEÑUELA",
-                "276": "VILLAS DE LA VENTOSA",
-                "277": "VILLAREJO-PERIESTEBAN",
-                "280": "VILLARES DEL SAZ",
-                "281": "VILLARRUBIO",
-                "282": "VILLARTA",
-                "283": "VILLAVERDE Y PASACONSOL",
-                "284": "VILLORA",
-                "285": "VINDEL",
-                "286": "YEMEDA",
-                "287": "ZAFRA DE ZANCARA",
-                "288": "ZAFRILLA",
-                "289": "ZARZA DE TAJO",
-                "290": "ZARZUELA",
-                "900": "CUENCA",
-            };
-        }
-        else if (provinceCode === 17) {
-            municipalityNames = {
-                "1": "AGULLANA",
-                "2": "AIGUAVIVA",
-                "3": "ALBANYA",
-                "4": "ALBONS",
-                "5": "EL FAR D'EMPORDA",
-                "6": "ALP",
-                "7": "AMER",
-                "8": "ANGLES",
-                "9": "ARBUCIES",
-                "10": "ARGELAGUER",
-                "11": "L'ARMENTERA",
-                "12": "AVINYONET PUIGVENTOS",
-                "14": "BEGUR",
-                "15": "LA VAJOL",
-                "16": "BANYOLES",
-                "17": "LA VALL D'EN BAS",
-                "18": "BASCARA",
-                "21": "BELLCAIRE EMPORDA",
-                "22": "BESALU",
-                "23": "BESCANO",
-                "24": "BEUDA",
-                "25": "LA BISBAL EMPORDA",
-                "26": "BLANES",
-                "27": "BOLVIR",
-                "28": "BORDILS",
-                "29": "BORRASSA",
-                "30": "BREDA",
-                "31": "BRUNYOLA",
-                "32": "BOADELLA I LES ESCAULES",
-                "33": "CABANES",
-                "34": "CABANELLES",
-                "35": "CADAQUES",
-                "36": "FONTANALS CERDANYA",
-                "37": "CALDES MALAVELLA",
-                "38": "CALONGE",
-                "39": "CAMOS",
-                "40": "CAMPDEVANOL",
-                "41": "CAMPELLES",
-                "42": "CAMPLLONG",
-                "43": "CAMPRODON",
-                "44": "CANET D'ADRI",
-                "45": "CANTALLOPS",
-                "46": "CAPMANY",
-                "47": "QUERALBS",
-                "49": "CASSA SELVA",
-                "51": "CASTELLFOLLIT ROCA",
-                "52": "CASTELLO D'EMPURIES",
-                "53": "CASTELL-PLATJA D'ARO",
-                "54": "CELRA",
-                "55": "CERVIA TER",
-                "56": "CISTELLA",
-                "57": "SIURANA EMPORDA",
-                "59": "COLERA",
-                "60": "COLOMERS",
-                "61": "CORNELLA DEL TERRI",
-                "62": "CORÇA",
-                "63": "CRESPIA",
-                "64": "CRUNLLES, MONELLS I SANT SADURNI DE L'HEURA",
-                "65": "DARNIUS",
-                "66": "DAS",
-                "68": "L'ESCALA",
-                "69": "ESPINELVES",
-                "70": "ESPOLLA",
-                "71": "ESPONELLA",
-                "72": "FIGUERES",
-                "73": "FLAÇA",
-                "74": "FOIXA",
-                "75": "FONTANILLES",
-                "76": "FONTCOBERTA",
-                "77": "FORALLAC",
-                "78": "FORNELLS SELVA",
-                "79": "FORTIA",
-                "81": "GARRIGAS",
-                "82": "GARRIGOLES",
-                "83": "GARRIGUELLA",
-                "84": "GER",
-                "85": "GIRONA",
-                "86": "GOMBREN",
-                "87": "GUALTA",
-                "88": "GUILS CERDANYA",
-                "89": "HOSTALRIC",
-                "90": "ISOVOL",
-                "91": "JAFRE",
-                "93": "LA JONQUERA",
-                "94": "JUIA",
-                "95": "LLADO",
-                "96": "LLAGOSTERA",
-                "97": "LLAMBILLES",
-                "98": "LLANARS",
-                "99": "LLANÇA",
-                "100": "LLERS",
-                "101": "LLIVIA",
-                "102": "LLORET DE MAR",
-                "103": "LES LLOSSES",
-                "104": "MADREMANYA",
-                "105": "MERANGES",
-                "106": "MASARAC",
-                "107": "MASSANES",
-                "108": "MAÇANET CABRENYS",
-                "109": "MAÇANET SELVA",
-                "110": "MAIA MONTCAL",
-                "112": "MIERES",
-                "113": "MOLLET PERALADA",
-                "114": "MOLLO",
-                "116": "MONTAGUT I OIX",
-                "117": "MONT-RAS",
-                "118": "NAVATA",
-                "119": "OGASSA",
-                "121": "OLOT",
-                "122": "ORDIS",
-                "123": "OSOR",
-                "124": "PALAFRUGELL",
-                "125": "PALAMOS",
-                "126": "PALAU DE SANTA EULALIA",
-                "127": "PALAU SAVERDERA",
-                "129": "PALAU SATOR",
-                "131": "PALOL REVARDIT",
-                "132": "PALS",
-                "133": "PARDINES",
-                "134": "PARLAVA",
-                "136": "PAU",
-                "137": "PEDRET MARZA",
-                "138": "LA PERA",
-                "140": "PERALADA",
-                "142": "LES PLANES D'HOSTOLES",
-                "143": "PLANOLES",
-                "144": "PONT DE MOLINS",
-                "145": "PONTOS",
-                "146": "PORQUERES",
-                "147": "PORTBOU",
-                "148": "LES PRESES",
-                "149": "EL PORT SELVA",
-                "150": "PUIGCERDA",
-                "151": "QUART",
-                "152": "RABOS",
-                "153": "REGENCOS",
-                "154": "RIBES FRESER",
-                "155": "RIELLS I VIABREA",
-                "156": "RIPOLL",
-                "157": "RIUDARENES",
-                "158": "RIUDAURA",
-                "159": "RIUDELLOTS SELVA",
-                "160": "RIUMORS",
-                "161": "ROSES",
-                "162": "RUPIA",
-                "163": "SALES DE LLIERCA",
-                "164": "SALT",
-                "166": "SANT ANDREU SALOU",
-                "167": "SANT CLIMENT SESCEBES",
-                "169": "SANT FELIU DE BUIXALLEU",
-                "170": "SANT FELIU DE GUIXOLS",
-                "171": "SANT FELIU DE PALLEROLS",
-                "172": "SANT FERRIOL",
-                "173": "SANT GREGORI",
-                "174": "SANT HILARI SACALM",
-                "175": "SANT JAUME DE LLIERCA",
-                "176": "SANT JORDI DESVALLS",
-                "177": "SANT JOAN DE LES ABADESSES",
-                "178": "SANT JOAN DE MOLLET",
-                "179": "SANT JULIA DE RAMIS",
-                "180": "SANT LLORENC DE LA MUGA",
-                "181": "SANT MARTI DE LLEMENA",
-                "182": "SANT MARTI VELL",
-                "183": "SANT MIQUEL DE CAMPMAJOR",
-                "184": "SANT MIQUEL DE FLUVIA",
-                "185": "SANT MORI",
-                "186": "SANT PAU DE SEGURIES",
-                "187": "SANT PERE PESCADOR",
-                "191": "SANTA COLOMA DE FARNERS",
-                "192": "SANTA CRISTINA D'ARO",
-                "194": "SANTA LLOGAIA D'ALGUEMA",
-                "195": "SANT ANIOL DE FINESTRES",
-                "196": "SANTA PAU",
-                "197": "SANT JOAN LES FONTS",
-                "198": "SARRIA DE TER",
-                "199": "SAUS, CAMALLERA I LLAMPAIES",
-                "200": "LA SELVA DE MAR",
-                "201": "LA CELLERA TER",
-                "202": "SERINYA",
-                "203": "SERRA DARO",
-                "204": "SETCASES",
-                "205": "SILS",
-                "206": "SUSQUEDA",
-                "207": "LA TALLADA EMPORDA",
-                "209": "TERRADES",
-                "210": "TORRENT",
-                "211": "TORROELLA FLUVIA",
-                "212": "TORROELLA MONTGRI",
-                "213": "TORTELLA",
-                "214": "TOSES",
-                "215": "TOSSA DE MAR",
-                "216": "ULTRAMORT",
-                "217": "ULLA",
-                "218": "ULLASTRET",
-                "220": "URUS",
-                "221": "LA VALL BIANYA",
-                "222": "VALLFOGONA RIPOLLES",
-                "223": "VALL-LLOBREGA",
-                "224": "VENTALLO",
-                "225": "VERGES",
-                "226": "VIDRA",
-                "227": "VIDRERES",
-                "228": "VILABERTRAN",
-                "229": "VILABLAREIX",
-                "230": "VILADASENS",
-                "231": "VILADAMAT",
-                "232": "VILADEMULS",
-                "234": "VILADRAU",
-                "235": "VILAFANT",
-                "236": "VILAUR",
-                "237": "VILAJUÏGA",
-                "238": "VILALLONGA TER",
-                "240": "VILAMACOLUM",
-                "241": "VILAMALLA",
-                "242": "VILAMANISCLE",
-                "243": "VILANANT",
-                "245": "VILA-SACRA",
-                "247": "VILOPRIU",
-                "248": "VILOBI ONYAR",
-                "249": "BIURE",
-                "251": "SANT JULIA DEL LLOR I BONMATI",
-            };
-        }
-        else if (provinceCode === 18) {
-            municipalityNames = {
-                "2": "AGRON",
-                "3": "ALAMEDILLA",
-                "4": "ALBOLOTE",
-                "5": "ALBONDON",
-                "6": "ALBUÑAN",
-                "7": "ALBUÑOL",
-                "8": "ALBUÑUELAS",
-                "11": "ALDEIRE",
-                "12": "ALFACAR",
-                "13": "ALGARINEJO",
-                "14": "ALHAMA DE GRANADA",
-                "15": "ALHENDIN",
-                "16": "ALICUN DE ORTEGA",
-                "17": "ALMEGIJAR",
-                "18": "ALMUÑECAR",
-                "19": "ALQUIFE",
-                "20": "VEGAS DEL GENIL",
-                "21": "ARENAS DEL REY",
-                "22": "ARMILLA",
-                "23": "ATARFE",
-                "24": "BAZA",
-                "25": "BEAS DE GRANADA",
-                "26": "BEAS DE GUADIX",
-                "28": "BENALUA",
-                "29": "BENALUA DE LAS VILLAS",
-                "30": "BENAMAUREL",
-                "31": "BERCHULES",
-                "33": "BUBION",
-                "34": "BUSQUISTAR",
-                "35": "CACIN",
-                "36": "CADIAR",
-                "37": "CAJAR",
-                "38": "CALICASAS",
-                "39": "CAMPOTEJAR",
-                "40": "CANILES",
-                "41": "CAÑAR",
-                "43": "CAPILEIRA",
-                "44": "CARATAUNAS",
-                "45": "CASTARAS",
-                "46": "CASTILLEJAR",
-                "47": "CASTRIL",
-                "48": "CENES DE LA VEGA",
-                "49": "CIJUELA",
-                "50": "COGOLLOS DE GUADIX",
-                "51": "COGOLLOS VEGA",
-                "52": "COLOMERA",
-                "53": "VILLAMENA",
-                "54": "CORTES DE BAZA",
-                "55": "CORTES Y GRAENA",
-                "57": "CULLAR",
-                "58": "CULLAR VEGA",
-                "59": "VALLE DEL ZALABI",
-                "60": "CHAUCHINA",
-                "62": "CHIMENEAS",
-                "63": "LECRIN",
-                "64": "CHURRIANA DE LA VEGA",
-                "65": "DARRO",
-                "66": "DEHESAS DE GUADIX",
-                "68": "DEIFONTES",
-                "69": "DIEZMA",
-                "70": "DILAR",
-                "71": "DOLAR",
-                "72": "DUDAR",
-                "73": "DURCAL",
-                "74": "ESCUZAR",
-                "76": "FERREIRA",
-                "78": "FONELAS",
-                "80": "FREILA",
-                "81": "FUENTE VAQUEROS",
-                "83": "LAS GABIAS",
-                "84": "GALERA",
-                "85": "GOBERNADOR",
-                "86": "GOJAR",
-                "87": "GOR",
-                "88": "GORAFE",
-                "90": "GUADAHORTUNA",
-                "91": "GUADIX",
-                "92": "LOS GUAJARES",
-                "95": "GUALCHOS",
-                "96": "GUEJAR SIERRA",
-                "97": "GUEVEJAR",
-                "98": "HUELAGO",
-                "99": "HUENEJA",
-                "100": "HUESCAR",
-                "101": "HUETOR SANTILLAN",
-                "102": "HUETOR TAJAR",
-                "103": "HUETOR VEGA",
-                "104": "ILLORA",
-                "105": "EL PINAR",
-                "106": "ITRABO",
-                "107": "IZNALLOZ",
-                "108": "JATAR",
-                "109": "JAYENA",
-                "110": "JEREZ DEL MARQUESADO",
-                "111": "JETE",
-                "113": "JUN",
-                "114": "JUVILES",
-                "116": "LACALAHORRA",
-                "117": "LACHAR",
-                "118": "LANJARON",
-                "119": "LANTEIRA",
-                "120": "NEVADA",
-                "121": "LENTEJI",
-                "122": "LOBRAS",
-                "123": "LOJA",
-                "124": "LUGROS",
-                "125": "LUJAR",
-                "127": "LA MALAHA",
-                "128": "MARACENA",
-                "129": "MARCHAL",
-                "130": "ALPUJARRA DE LA SIERRA",
-                "132": "EL VALLE",
-                "133": "MOCLIN",
-                "134": "MOLVIZAR",
-                "135": "MONACHIL",
-                "137": "MONTEFRIO",
-                "138": "MONTEJICAR",
-                "139": "MONTILLANA",
-                "140": "MORALEDA DE ZAFAYONA",
-                "141": "MORELABOR",
-                "142": "MOTRIL",
-                "144": "MURTAS",
-                "146": "NIGUELAS",
-                "147": "NIVAR",
-                "148": "OGIJARES",
-                "149": "ORCE",
-                "150": "ORGIVA",
-                "151": "OTIVAR",
-                "152": "VILLA DE OTURA",
-                "153": "PADUL",
-                "154": "PAMPANEIRA",
-                "155": "PEDRO MARTINEZ",
-                "156": "PELIGROS",
-                "157": "LA PEZA",
-                "160": "PINOS GENIL",
-                "161": "PINOS PUENTE",
-                "162": "PIÑAR",
-                "163": "LA TAHA",
-                "164": "POLICAR",
-                "165": "POLOPOS",
-                "166": "PORTUGOS",
-                "167": "PUEBLA DE DON FADRIQUE",
-                "168": "PULIANAS",
-                "170": "PURULLENA",
-                "171": "QUENTAR",
-                "173": "RUBITE",
-                "174": "SALAR",
-                "176": "SALOBREÑA",
-                "177": "SANTA CRUZ DEL COMERCIO",
-                "178": "SANTA FE",
-                "179": "SOPORTUJAR",
-                "180": "SORVILAN",
-                "181": "TORRE CARDELA",
-                "182": "TORVIZCON",
-                "183": "TREVELEZ",
-                "185": "TURON",
-                "186": "UGIJAR",
-                "187": "VALOR",
-                "188": "VELEZ DE BENAUDALLA",
-                "189": "VENTAS DE HUELMA",
-                "191": "VILLANUEVA DE LAS TORRES",
-                "192": "VILLANUEVA MESIA",
-                "193": "VIZNAR",
-                "196": "ZAFARRAYA",
-                "197": "LA ZUBIA",
-                "198": "ZUJAR",
-                "199": "CUEVAS CAMPO",
-                "200": "ZAGRA",
-                "202": "DEHESAS VIEJAS",
-                "204": "DOMINGO PEREZ DE GRANADA",
-                "900": "GRANADA",
-            };
-        }
-        else if (provinceCode === 19) {
-            municipalityNames = {
-                "1": "ABANADES",
-                "2": "ABLANQUE",
-                "3": "ADOBES",
-                "5": "ALAMINOS",
-                "6": "ALARILLA",
-                "7": "ALBALATE DE ZORITA",
-                "8": "ALBARES",
-                "9": "ALBENDIEGO",
-                "11": "ALCOCER",
-                "12": "ALCOLEA DE LAS PEÑAS",
-                "13": "ALCOLEA DEL PINAR",
-                "15": "ALCOROCHES",
-                "18": "ALDEANUEVA DE GUADALAJARA",
-                "20": "ALGAR DE MESA",
-                "21": "ALGORA",
-                "22": "ALHONDIGA",
-                "23": "ALIQUE",
-                "24": "ALMADRONES",
-                "26": "ALMOGUERA",
-                "27": "ALMONACID DE ZORITA",
-                "28": "ALOCEN",
-                "29": "ALOVERA",
-                "32": "ALUSTANTE",
-                "36": "ANGON",
-                "37": "ANGUITA",
-                "38": "ANQUELA DEL DUCADO",
-                "39": "ANQUELA DEL PEDREGAL",
-                "41": "ARANZUEQUE",
-                "42": "ARBANCON",
-                "43": "ARBETETA",
-                "45": "ARGECILLA",
-                "46": "ARMALLONES",
-                "47": "ARMUÑA DE TAJUÑA",
-                "48": "ARROYO DE LAS FRAGUAS",
-                "50": "ATANZON",
-                "51": "ATIENZA",
-                "52": "AUÑON",
-                "54": "AZUQUECA DE HENARES",
-                "55": "BAIDES",
-                "58": "BAÑOS DE TAJO",
-                "59": "BAÑUELOS",
-                "60": "BARRIOPEDRO",
-                "62": "BERNINCHES",
-                "64": "LA BODERA",
-                "65": "BRIHUEGA",
-                "66": "BUDIA",
-                "67": "BUJALARO",
-                "69": "BUSTARES",
-                "70": "CABANILLAS DEL CAMPO",
-                "72": "CAMPILLO DE DUEÑAS",
-                "73": "CAMPILLO DE RANAS",
-                "74": "CAMPISABALOS",
-                "77": "CANREDONDO",
-                "78": "CANTALOJAS",
-                "79": "CAÑIZAR",
-                "81": "EL CARDOSO DE LA SIERRA",
-                "84": "CASA DE UCEDA",
-                "85": "EL CASAR",
-                "87": "CASAS DE SAN GALINDO",
-                "88": "CASPUEÑAS",
-                "89": "CASTEJON DE HENARES",
-                "90": "CASTELLAR DE LA MUELA",
-                "92": "CASTILFORTE",
-                "94": "CASTILNUEVO",
-                "95": "CENDEJAS DE ENMEDIO",
-                "96": "CENDEJAS DE LA TORRE",
-                "97": "CENTENERA",
-                "101": "CIFUENTES",
-                "103": "CINCOVILLAS",
-                "104": "CIRUELAS",
-                "105": "CIRUELOS DEL PINAR",
-                "107": "COBETA",
-                "109": "COGOLLOR",
-                "110": "COGOLLUDO",
-                "113": "CONDEMIOS DE ABAJO",
-                "114": "CONDEMIOS DE ARRIBA",
-                "115": "CONGOSTRINA",
-                "116": "COPERNAL",
-                "118": "CORDUENTE",
-                "122": "EL CUBILLO DE UCEDA",
-                "124": "CHECA",
-                "125": "CHEQUILLA",
-                "126": "CHILOECHES",
-                "127": "CHILLARON DEL REY",
-                "128": "DRIEBES",
-                "129": "DURON",
-                "130": "EMBID",
-                "131": "ESCAMILLA",
-                "132": "ESCARICHE",
-                "133": "ESCOPETE",
-                "134": "ESPINOSA DE HENARES",
-                "135": "ESPLEGARES",
-                "136": "ESTABLES",
-                "137": "ESTRIEGANA",
-                "138": "FONTANAR",
-                "139": "FUEMBELLIDA",
-                "140": "FUENCEMILLAN",
-                "142": "FUENTELAHIGUERA DE ALBATAGES",
-                "143": "FUENTELENCINA",
-                "144": "FUENTELSAZ",
-                "145": "FUENTELVIEJO",
-                "146": "FUENTENOVILLA",
-                "148": "GAJANEJOS",
-                "149": "GALAPAGOS",
-                "150": "GALVE DE SORBE",
-                "154": "GASCUEÑA DE BORNOVA",
-                "158": "HENCHE",
-                "159": "HERAS DE AYUSO",
-                "160": "HERRERIA",
-                "161": "HIENDELAENCINA",
-                "162": "HIJES",
-                "164": "HITA",
-                "165": "HOMBRADOS",
-                "168": "HONTOBA",
-                "169": "HORCHE",
-                "171": "LA HORTEZUELA DE OCEN",
-                "172": "LA HUERCE",
-                "173": "HUERMECES DEL CERRO",
-                "174": "HUERTAHERNANDO",
-                "177": "HUEVA",
-                "178": "HUMANES DE MOHERNANDO",
-                "179": "ILLANA",
-                "181": "INIESTOLA",
-                "182": "INVIERNAS LAS",
-                "184": "IRUESTE",
-                "185": "JADRAQUE",
-                "186": "JIRUEQUE",
-                "190": "LEDANCA",
-                "191": "LORANCA DE TAJUÑA",
-                "192": "LUPIANA",
-                "193": "LUZAGA",
-                "194": "LUZON",
-                "196": "MAJAELRAYO",
-                "197": "MALAGA DEL FRESNO",
-                "198": "MALAGUILLA",
-                "199": "MANDAYONA",
-                "200": "MANTIEL",
-                "201": "MARANCHON",
-                "202": "MARCHAMALO",
-                "203": "MASEGOSO DE TAJUÑA",
-                "204": "MATARRUBIA",
-                "205": "MATILLAS",
-                "206": "MAZARETE",
-                "207": "MAZUECOS",
-                "208": "MEDRANDA",
-                "209": "MEGINA",
-                "210": "MEMBRILLERA",
-                "212": "MIEDES DE ATIENZA",
-                "213": "LA MIERLA",
-                "214": "MILMARCOS",
-                "215": "MILLANA",
-                "216": "LA MIÑOSA",
-                "217": "MIRABUENO",
-                "218": "MIRALRIO",
-                "219": "MOCHALES",
-                "220": "MOHERNANDO",
-                "221": "MOLINA DE ARAGON",
-                "222": "MONASTERIO",
-                "223": "MONDEJAR",
-                "224": "MONTARRON",
-                "226": "MORATILLA DE LOS MELEROS",
-                "227": "MORENILLA",
-                "230": "MUDUEX",
-                "233": "NAVAS DE JADRAQUE",
-                "234": "NEGREDO",
-                "235": "OCENTEJO",
-                "236": "EL OLIVAR",
-                "237": "OLMEDA DE COBETA",
-                "238": "LA OLMEDA DE JADRAQUE",
-                "241": "EL ORDIAL",
-                "242": "OREA",
-                "249": "PALMACES DE JADRAQUE",
-                "250": "PARDOS",
-                "251": "PAREDES DE SIGUENZA",
-                "252": "PAREJA",
-                "253": "PASTRANA",
-                "254": "EL PEDREGAL",
-                "257": "PEÑALEN",
-                "258": "PEÑALVER",
-                "259": "PERALEJOS DE LAS TRUCHAS",
-                "260": "PERALVECHE",
-                "261": "PINILLA DE JADRAQUE",
-                "262": "PINILLA DE MOLINA",
-                "263": "PIOZ",
-                "264": "PIQUERAS",
-                "265": "EL POBO DE DUEÑAS",
-                "266": "POVEDA DE LA SIERRA",
-                "269": "POZO DE ALMOGUERA",
-                "270": "POZO DE GUADALAJARA",
-                "271": "PRADENA DE ATIENZA",
-                "272": "PRADOS REDONDOS",
-                "273": "PUEBLA DE BELEÑA",
-                "274": "PUEBLA DE VALLES",
-                "276": "QUER",
-                "278": "REBOLLOSA DE JADRAQUE",
-                "279": "EL RECUENCO",
-                "281": "RENERA",
-                "282": "RETIENDAS",
-                "283": "RIBA DE SAELICES",
-                "286": "RILLO DE GALLO",
-                "287": "RIOFRIO DEL LLANO",
-                "289": "ROBLEDILLO DE MOHERNANDO",
-                "290": "ROBLEDO DE CORPES",
-                "292": "ROMANILLOS DE ATIENZA",
-                "293": "ROMANONES",
-                "294": "RUEDA DE LA SIERRA",
-                "296": "SACECORBO",
-                "297": "SACEDON",
-                "298": "SAELICES DE LA SAL",
-                "299": "SALMERON",
-                "300": "SAN ANDRES DEL CONGOSTO",
-                "301": "SAN ANDRES DEL REY",
-                "303": "SANTIUSTE",
-                "304": "SAUCA",
-                "305": "SAYATON",
-                "306": "SELAS",
-                "307": "SEMILLAS",
-                "308": "SETILES",
-                "309": "SIENES",
-                "310": "SIGUENZA",
-                "311": "SOLANILLOS DEL EXTREMO",
-                "312": "SOMOLINOS",
-                "313": "EL SOTILLO",
-                "315": "SOTODOSOS",
-                "316": "TAMAJON",
-                "318": "TARAGUDO",
-                "319": "TARAVILLA",
-                "320": "TARTANEDO",
-                "321": "TENDILLA",
-                "323": "TERZAGA",
-                "324": "TIERZO",
-                "325": "LA TOBA",
-                "327": "TORDELRABANO",
-                "328": "TORDELLEGO",
-                "329": "TORDESILOS",
-                "331": "TORIJA",
-                "335": "TORRECUADRADA DE MOLINA",
-                "336": "TORRECUADRADILLA",
-                "337": "TORRE DEL BURGO",
-                "338": "TORREJON DEL REY",
-                "339": "TORREMOCHA DE JADRAQUE",
-                "340": "TORREMOCHA DEL CAMPO",
-                "341": "TORREMOCHA DEL PINAR",
-                "342": "TORREMOCHUELA",
-                "345": "TORRUBIA",
-                "346": "TORTOLA DE HENARES",
-                "348": "TORTUERA",
-                "349": "TORTUERO",
-                "350": "TRAID",
-                "351": "TRIJUEQUE",
-                "352": "TRILLO",
-                "354": "UCEDA",
-                "355": "UJADOS",
-                "357": "UTANDE",
-                "358": "VALDARACHAS",
-                "359": "VALDEARENAS",
-                "360": "VALDEAVELLANO",
-                "361": "VALDEAVERUELO",
-                "362": "VALDECONCHA",
-                "363": "VALDEGRUDAS",
-                "365": "VALDELCUBO",
-                "367": "VALDENUÑO FERNANDEZ",
-                "368": "VALDEPEÑAS DE LA SIERRA",
-                "369": "VALDERREBOLLO",
-                "372": "VALDESOTOS",
-                "374": "VALFERMOSO DE TAJUÑA",
-                "375": "VALHERMOSO",
-                "376": "VALTABLADO DEL RIO",
-                "377": "VALVERDE DE LOS ARROYOS",
-                "380": "VIANA DE JADRAQUE",
-                "384": "VILLANUEVA DE ALCORON",
-                "385": "VILLANUEVA DE ARGECILLA",
-                "386": "VILLANUEVA DE LA TORRE",
-                "389": "VILLARES DE JADRAQUE",
-                "390": "VILLASECA DE HENARES",
-                "391": "VILLASECA DE UCEDA",
-                "394": "VILLEL DE MESA",
-                "395": "VIÑUELAS",
-                "396": "YEBES",
-                "397": "YEBRA",
-                "399": "YELAMOS DE ABAJO",
-                "400": "YELAMOS DE ARRIBA",
-                "401": "YUNQUERA DE HENARES",
-                "402": "LA YUNTA",
-                "403": "ZAOREJAS",
-                "404": "ZARZUELA DE JADRAQUE",
-                "405": "ZORITA DE LOS CANES",
-                "900": "GUADALAJARA",
-            };
-        }
-        else if (provinceCode === 20) {
-            municipalityNames = {
-                "1": "ABALTZISKETA",
-                "2": "ADUNA",
-                "3": "AIZARNAZABAL",
-                "4": "ALBIZTUR",
-                "5": "ALEGIA",
-                "6": "ALKIZA",
-                "7": "ALTZO",
-                "8": "AMEZKETA",
-                "9": "ANDOAIN",
-                "10": "ANOETA",
-                "11": "ANTZUOLA",
-                "12": "ARAMA",
-                "13": "ARETXABALETA",
-                "14": "ASTEASU",
-                "15": "ATAUN",
-                "16": "AIA",
-                "17": "AZKOITIA",
-                "18": "AZPEITIA",
-                "19": "BEASAIN",
-                "20": "BEIZAMA",
-                "21": "BELAUNTZA",
-                "22": "BERASTEGI",
-                "23": "BERROBI",
-                "24": "BIDEGOIAN",
-                "25": "ZEGAMA",
-                "26": "ZERAIN",
-                "27": "ZESTOA",
-                "28": "ZIZURKIL",
-                "29": "DEBA",
-                "30": "EIBAR",
-                "31": "ELDUAIN",
-                "32": "ELGOIBAR",
-                "33": "ELGETA",
-                "34": "ESKORIATZA",
-                "35": "EZKIO-ITSASO",
-                "36": "HONDARRIBIA",
-                "37": "GAINTZA",
-                "38": "GABIRIA",
-                "39": "GETARIA",
-                "40": "HERNANI",
-                "41": "HERNIALDE",
-                "42": "IBARRA",
-                "43": "IDIAZABAL",
-                "44": "IKAZTEGIETA",
-                "45": "IRUN",
-                "46": "IRURA",
-                "47": "ITSASONDO",
-                "48": "LARRAUL",
-                "49": "LAZKAO",
-                "50": "LEABURU",
-                "51": "LEGAZPI",
-                "52": "LEGORRETA",
-                "53": "LEZO",
-                "54": "LIZARTZA",
-                "55": "ARRASATE/MONDRAGÓN",
-                "56": "MUTRIKU",
-                "57": "MUTILOA",
-                "58": "OLABERRIA",
-                "59": "OÑATI",
-                "60": "OREXA",
-                "61": "ORIO",
-                "62": "ORMAIZTEGI",
-                "63": "OIARTZUN",
-                "64": "PASAIA",
-                "65": "SORALUZE/PLACENCIA DE LAS ARMAS",
-                "66": "ERREZIL",
-                "67": "ERRENTERIA",
-                "68": "LEINTZ-GATZAGA",
-                "69": "DONOSTIA-SAN SEBASTIÁN",
-                "70": "SEGURA",
-                "71": "TOLOSA",
-                "72": "URNIETA",
-                "73": "USURBIL",
-                "74": "BERGARA",
-                "75": "VILLABONA",
-                "76": "ORDIZIA",
-                "77": "URRETXU",
-                "78": "ZALDIBIA",
-                "79": "ZARAUTZ",
-                "80": "ZUMARRAGA",
-                "81": "ZUMAIA",
-                "82": "MENDARO",
-                "83": "LASARTE-ORIA",
-                "84": "ASTIGARRAGA",
-                "85": "BALIARRAIN",
-                "86": "ORENDAIN",
-                "87": "ALTZAGA",
-                "88": "GAZTELU",
-                "98": "ALZANIA",
-                "99": "SIERRA DE ARALAR",
-            };
-        }
-        else if (provinceCode === 21) {
-            municipalityNames = {
-                "1": "ALAJAR",
-                "2": "ALJARAQUE",
-                "3": "EL ALMENDRO",
-                "4": "ALMONASTER LA REAL",
-                "5": "ALMONTE",
-                "6": "ALOSNO",
-                "7": "ARACENA",
-                "8": "AROCHE",
-                "9": "ARROYOMOLINOS DE LEON",
-                "10": "AYAMONTE",
-                "11": "BEAS",
-                "12": "BERROCAL",
-                "13": "BOLLULLOS PAR DEL CONDADO",
-                "14": "BONARES",
-                "15": "CABEZAS RUBIAS",
-                "16": "CALA",
-                "17": "CALAÑAS",
-                "18": "EL CAMPILLO",
-                "19": "CAMPOFRIO",
-                "20": "CAÑAVERAL DE LEON",
-                "21": "CARTAYA",
-                "22": "CASTAÑO DEL ROBLEDO",
-                "23": "EL CERRO DEL ANDEVALO",
-                "24": "CORTECONCEPCION",
-                "25": "CORTEGANA",
-                "26": "CORTELAZOR",
-                "27": "CUMBRES DE ENMEDIO",
-                "28": "CUMBRES DE SAN BARTOLOME",
-                "29": "CUMBRES MAYORES",
-                "30": "CHUCENA",
-                "31": "ENCINASOLA",
-                "32": "ESCACENA DEL CAMPO",
-                "33": "FUENTEHERIDOS",
-                "34": "GALAROZA",
-                "35": "GIBRALEON",
-                "36": "LA GRANADA DE RIOTINTO",
-                "37": "EL GRANADO",
-                "38": "HIGUERA DE LA SIERRA",
-                "39": "HINOJALES",
-                "40": "HINOJOS",
-                "42": "ISLA CRISTINA",
-                "43": "JABUGO",
-                "44": "LEPE",
-                "45": "LINARES DE LA SIERRA",
-                "46": "LUCENA DEL PUERTO",
-                "47": "MANZANILLA",
-                "48": "MARINES LOS",
-                "49": "MINAS DE RIOTINTO",
-                "50": "MOGUER",
-                "51": "LA NAVA",
-                "52": "NERVA",
-                "53": "NIEBLA",
-                "54": "LA PALMA DEL CONDADO",
-                "55": "PALOS DE LA FRONTERA",
-                "56": "PATERNA DEL CAMPO",
-                "57": "PAYMOGO",
-                "58": "PUEBLA DE GUZMAN",
-                "59": "PUERTO MORAL",
-                "60": "ROCIANA DEL CONDADO",
-                "61": "ROSAL DE LA FRONTERA",
-                "62": "SAN BARTOLOME TORRE",
-                "63": "SAN JUAN DEL PUERTO",
-                "64": "SANLUCAR DE GUADIANA",
-                "65": "SAN SILVESTRE DE GUZMAN",
-                "66": "SANTA ANA LA REAL",
-                "67": "SANTA BARBARA DE CASA",
-                "68": "SANTA OLALLA DEL CALA",
-                "69": "TRIGUEROS",
-                "70": "VALDELARCO",
-                "71": "VALVERDE DEL CAMINO",
-                "72": "VILLABLANCA",
-                "73": "VILLALBA DEL ALCOR",
-                "74": "VILLANUEVA DE LAS CRUCES",
-                "75": "VILLANUEVA DE LOS CASTILLEJOS",
-                "76": "VILLARRASA",
-                "77": "ZALAMEA LA REAL",
-                "78": "ZUFRE",
-                "79": "PUNTA UMBRIA",
-                "900": "HUELVA",
-            };
-        }
-        else if (provinceCode === 22) {
-            municipalityNames = {
-                "1": "ABIEGO",
-                "2": "ABIZANDA",
-                "5": "ADAHUESCA",
-                "7": "AGUERO",
-                "9": "AINSA-SOBRARBE",
-                "10": "AISA",
-                "11": "ALBALATE DE CINCA",
-                "12": "ALBALATILLO",
-                "13": "ALBELDA",
-                "15": "ALBERO ALTO",
-                "16": "ALBERO BAJO",
-                "18": "ALBERUELA DE TUBO",
-                "19": "ALCALA DE GURREA",
-                "20": "ALCALA DEL OBISPO",
-                "21": "ALCAMPELL",
-                "22": "ALCOLEA DE CINCA",
-                "23": "ALCUBIERRE",
-                "24": "ALERRE",
-                "25": "ALFANTEGA",
-                "27": "ALMUDEVAR",
-                "28": "ALMUNIA DE SAN JUAN",
-                "29": "ALMUNIENTE",
-                "30": "ALQUEZAR",
-                "31": "ALTORRICON",
-                "32": "ANGUES",
-                "34": "ANSO",
-                "35": "ANTILLON",
-                "38": "CALDEARENAS",
-                "39": "ARAGUES DEL PUERTO",
-                "44": "AREN",
-                "45": "ARGAVIESO",
-                "46": "ARGUIS",
-                "49": "AYERBE",
-                "50": "AZANUY-ALINS",
-                "51": "AZARA",
-                "52": "AZLOR",
-                "53": "BAELLS",
-                "54": "BAILO",
-                "55": "BALDELLOU",
-                "56": "BALLOBAR",
-                "59": "BANASTAS",
-                "61": "BARBASTRO",
-                "63": "BARBUES",
-                "64": "BARBUÑALES",
-                "65": "BARCABO",
-                "67": "BELVER",
-                "68": "BENABARRE",
-                "69": "BENASQUE",
-                "71": "BERANUY",
-                "72": "BERBEGAL",
-                "73": "CANAL DE BERDUN",
-                "79": "BIELSA",
-                "80": "BIERGE",
-                "81": "BIESCAS",
-                "82": "BINACED",
-                "83": "BINEFAR",
-                "85": "BISAURRI",
-                "86": "BISCARRUES",
-                "87": "BLECUA Y TORRES",
-                "88": "LA SOTONERA",
-                "89": "BOLTAÑA",
-                "90": "BONANSA",
-                "92": "BORAU",
-                "94": "BROTO",
-                "102": "CAMPO",
-                "103": "CAMPORRELLS",
-                "104": "CANDASNOS",
-                "105": "CANFRANC",
-                "106": "CAPDESASO",
-                "107": "CAPELLA",
-                "109": "CASBAS DE HUESCA",
-                "112": "CASTEJON DEL PUENTE",
-                "113": "CASTEJON DE MONEGROS",
-                "115": "CASTEJON DE SOS",
-                "116": "CASTELFLORITE",
-                "117": "CASTIELLO DE JACA",
-                "118": "CASTIGALEU",
-                "120": "CASTILLAZUELO",
-                "121": "CASTILLONROY",
-                "123": "COLUNGO",
-                "132": "CHALAMERA",
-                "133": "CHIA",
-                "134": "CHIMILLAS",
-                "140": "ESPLUS",
-                "144": "ESTADA",
-                "145": "ESTADILLA",
-                "147": "ESTOPIÑAN DEL CASTILLO",
-                "149": "FANLO",
-                "152": "FISCAL",
-                "153": "FONZ",
-                "154": "FORADADA DE TOSCAR",
-                "155": "FRAGA",
-                "160": "GISTAIN",
-                "161": "EL GRADO",
-                "162": "GRAÑEN",
-                "163": "GRAUS",
-                "167": "GURREA DE GALLEGO",
-                "168": "VALLE DE HECHO",
-                "169": "HOZ Y COSTEAN",
-                "170": "HOZ DE JACA",
-                "171": "SANTA MARIA DE DULCIS",
-                "172": "HUERTO",
-                "174": "IBIECA",
-                "175": "IGRIES",
-                "176": "ILCHE",
-                "178": "JACA",
-                "179": "JASA",
-                "185": "LABUERDA",
-                "189": "LALUENGA",
-                "190": "LALUEZA",
-                "191": "LANAJA",
-                "193": "LAPERDIGUERA",
-                "196": "LASCELLAS-PONZANO",
-                "197": "LASCUARRE",
-                "198": "LASPAULES",
-                "199": "LASPUÑA",
-                "205": "LOARRE",
-                "206": "LOPORZANO",
-                "207": "LOSCORRALES",
-                "208": "LUPIÑEN-ORTILLA",
-                "215": "MONESMA Y CAJIGAR",
-                "216": "MONFLORITE-LASCASAS",
-                "217": "MONTANUY",
-                "218": "MONZON",
-                "222": "NAVAL",
-                "226": "NOVALES",
-                "227": "NUENO",
-                "230": "OLVENA",
-                "231": "ONTIÑENA",
-                "235": "OSSO",
-                "236": "PALO",
-                "239": "PANTICOSA",
-                "241": "PEÑALBA",
-                "242": "PERALTA DE ALCOFEA",
-                "243": "PERALTA DE CALASANZ",
-                "244": "PERALTILLA",
-                "245": "PERARRUA",
-                "246": "PERTUSA",
-                "249": "PIRACES",
-                "250": "PLAN",
-                "252": "POLEÑINO",
-                "253": "SAN MIGUEL DEL CINCA",
-                "255": "POZAN DE VERO",
-                "256": "LA PUEBLA DE CASTRO",
-                "259": "PUENTE DE MONTAÑANA",
-                "260": "PUERTOLAS",
-                "261": "PUEYO DE ARAGUAS",
-                "264": "PUEYO DE SANTA CRUZ",
-                "266": "QUICENA",
-                "270": "PEÑAS DE RIGLOS",
-                "271": "ROBRES",
-                "272": "ISABENA",
-                "275": "SABIÑANIGO",
-                "276": "SAHUN",
-                "277": "SALAS ALTAS",
-                "278": "SALAS BAJAS",
-                "279": "SALILLAS",
-                "282": "SALLENT DE GALLEGO",
-                "283": "SAN ESTEBAN DE LITERA",
-                "284": "SANGARREN",
-                "285": "SAN JUAN DE PLAN",
-                "286": "SANTA CILIA",
-                "287": "SANTA CRUZ DE LA SEROS",
-                "288": "PUENTE LA REINA",
-                "291": "SANTA LIESTRA Y SAN QUILEZ",
-                "294": "SARIÑENA",
-                "298": "SECASTILLA",
-                "299": "SEIRA",
-                "301": "SENA",
-                "303": "SENES DE ALCUBIERRE",
-                "305": "SESA",
-                "306": "SESUE",
-                "309": "SIETAMO",
-                "313": "SOPEIRA",
-                "315": "TAMARITE DE LITERA",
-                "316": "TARDIENTA",
-                "317": "TELLA-SIN",
-                "318": "TIERZ",
-                "320": "TOLVA",
-                "321": "TORLA",
-                "323": "TORRALBA DE ARAGON",
-                "324": "TORRE LA RIBERA",
-                "325": "TORRENTE DE CINCA",
-                "326": "TORRES DE ALCANADRE",
-                "327": "TORRES DE BARBUES",
-                "332": "TRAMACED",
-                "336": "VALFARTA",
-                "337": "VALLE DE BARDAGI",
-                "338": "VALLE DE LIERP",
-                "339": "VELILLA DE CINCA",
-                "341": "VIACAMP Y LITERA",
-                "342": "VICIEN",
-                "343": "VILLANOVA",
-                "344": "VILLANUA",
-                "345": "VILLANUEVA DE SIGENA",
-                "347": "YEBRA DE BASA",
-                "348": "YESERO",
-                "349": "ZAIDIN",
-                "350": "LA FUEVA",
-                "351": "VENCILLON",
-                "901": "HUESCA",
-            };
-        }
-        else if (provinceCode === 23) {
-            municipalityNames = {
-                "1": "ALBANCHEZ DE MAGINA",
-                "2": "ALCALA LA REAL",
-                "3": "ALCAUDETE",
-                "4": "ALDEAQUEMADA",
-                "5": "ANDUJAR",
-                "6": "ARJONA",
-                "7": "ARJONILLA",
-                "8": "ARQUILLOS",
-                "9": "BAEZA",
-                "10": "BAILEN",
-                "11": "BAÑOS DE LA ENCINA",
-                "12": "BEAS DE SEGURA",
-                "13": "BEDMAR-GARCIEZ",
-                "14": "BEGIJAR",
-                "15": "BELMEZ DE LA MORALEDA",
-                "16": "BENATAE",
-                "17": "CABRA DEL SANTO CRISTO",
-                "18": "CAMBIL",
-                "19": "CAMPILLO DE ARENAS",
-                "20": "CANENA",
-                "21": "CARBONEROS",
-                "23": "CARCHELES",
-                "24": "LA CAROLINA",
-                "25": "CASTELLAR",
-                "26": "CASTILLO DE LOCUBIN",
-                "27": "CAZALILLA",
-                "28": "CAZORLA",
-                "29": "CHICLANA DE SEGURA",
-                "30": "CHILLUEVAR",
-                "31": "ESCAÑUELA",
-                "32": "ESPELUY",
-                "33": "FRAILES",
-                "34": "FUENSANTA DE MARTOS",
-                "35": "FUERTE DEL REY",
-                "37": "GENAVE",
-                "38": "LA GUARDIA DE JAEN",
-                "39": "GUARROMAN",
-                "40": "LAHIGUERA",
-                "41": "HIGUERA DE CALATRAVA",
-                "42": "HINOJARES",
-                "43": "HORNOS DE SEGURA",
-                "44": "HUELMA-SOLERA",
-                "45": "HUESA",
-                "46": "IBROS",
-                "47": "LA IRUELA",
-                "48": "IZNATORAF",
-                "49": "JABALQUINTO",
-                "51": "JAMILENA",
-                "52": "JIMENA",
-                "53": "JODAR",
-                "54": "LARVA",
-                "55": "LINARES",
-                "56": "LOPERA",
-                "57": "LUPION",
-                "58": "MANCHA REAL",
-                "59": "MARMOLEJO",
-                "60": "MARTOS",
-                "61": "MENGIBAR",
-                "62": "MONTIZON",
-                "63": "NAVAS DE SAN JUAN",
-                "64": "NOALEJO",
-                "65": "ORCERA",
-                "66": "PEAL DE BECERRO",
-                "67": "PEGALAJAR",
-                "69": "PORCUNA",
-                "70": "POZO ALCON",
-                "71": "PUENTE GENAVE",
-                "72": "LA PUERTA DE SEGURA",
-                "73": "QUESADA",
-                "74": "RUS",
-                "75": "SABIOTE",
-                "76": "SANTA ELENA",
-                "77": "SANTIAGO DE CALATRAVA",
-                "78": "SANTIAGO-PONTONES",
-                "79": "SANTISTEBAN DEL PUERTO",
-                "80": "SANTO TOME",
-                "81": "SEGURA DE LA SIERRA",
-                "82": "SILES",
-                "84": "SORIHUELA DEL GUADALIMAR",
-                "85": "TORREBLASCOPEDRO",
-                "86": "TORREDELCAMPO",
-                "87": "TORREDONJIMENO",
-                "88": "TORREPEROGIL",
-                "90": "TORRES",
-                "91": "TORRES DE ALBANCHEZ",
-                "92": "UBEDA",
-                "93": "VALDEPEÑAS DE JAEN",
-                "94": "VILCHES",
-                "95": "VILLACARRILLO",
-                "96": "VILLANUEVA DE LA REINA",
-                "97": "VILLANUEVA DEL ARZOBISPO",
-                "98": "VILLARDOMPARDO",
-                "99": "LOS VILLARES",
-                "100": "VILLATORRES",
-                "101": "VILLARRODRIGO",
-                "102": "ARROYO DEL OJANCO",
-                "900": "JAEN",
-            };
-        }
-        else if (provinceCode === 24) {
-            municipalityNames = {
-                "1": "ACEBEDO",
-                "2": "ALGADEFE",
-                "3": "ALIJA DEL INFANTADO",
-                "4": "ALMANZA",
-                "5": "LA ANTIGUA",
-                "6": "ARDON",
-                "7": "ARGANZA",
-                "9": "ASTORGA",
-                "10": "BALBOA",
-                "11": "LA BAÑEZA",
-                "12": "BARJAS",
-                "13": "LOS BARRIOS DE LUNA",
-                "15": "BEMBIBRE",
-                "16": "BENAVIDES",
-                "17": "BENUZA",
-                "18": "BERCIANOS DEL PARAMO",
-                "19": "BERCIANOS DEL REAL CAMINO",
-                "20": "BERLANGA DEL BIERZO",
-                "21": "BOCA DE HUERGANO",
-                "22": "BOÑAR",
-                "23": "BORRENES",
-                "24": "BRAZUELO",
-                "25": "EL BURGO RANERO",
-                "26": "BURON",
-                "27": "BUSTILLO DEL PARAMO",
-                "28": "CABAÑAS RARAS",
-                "29": "CABREROS DEL RIO",
-                "30": "CABRILLANES",
-                "31": "CACABELOS",
-                "32": "CALZADA DEL COTO",
-                "33": "CAMPAZAS",
-                "35": "CAMPO DE VILLAVIDEL",
-                "36": "CAMPONARAYA",
-                "38": "CANDIN",
-                "39": "CARMENES",
-                "40": "CARRACEDELO",
-                "41": "CARRIZO",
-                "42": "CARROCERA",
-                "43": "CARUCEDO",
-                "44": "CASTILFALE",
-                "45": "CASTRILLO DE CABRERA",
-                "46": "CASTRILLO DE LA VALDUERNA",
-                "48": "CASTROCALBON",
-                "49": "CASTROCONTRIGO",
-                "51": "CASTROPODAME",
-                "52": "CASTROTIERRA",
-                "53": "CEA",
-                "54": "CEBANICO",
-                "55": "CEBRONES DEL RIO",
-                "56": "CIMANES DE LA VEGA",
-                "57": "CIMANES DEL TEJAR",
-                "58": "CISTIERNA",
-                "59": "CONGOSTO",
-                "60": "CORBILLOS DE LOS OTEROS",
-                "61": "CORULLON",
-                "62": "CREMENES",
-                "63": "CUADROS",
-                "64": "CUBILLAS DE LOS OTEROS",
-                "65": "CUBILLAS DE RUEDA",
-                "66": "CUBILLOS DEL SIL",
-                "67": "CHOZAS DE ABAJO",
-                "68": "DESTRIANA",
-                "69": "ENCINEDO",
-                "70": "LA ERCINA",
-                "71": "ESCOBAR DE CAMPOS",
-                "72": "FABERO",
-                "73": "FOLGOSO DE LA RIBERA",
-                "75": "FRESNO DE LA VEGA",
-                "76": "FUENTES DE CARBAJAL",
-                "78": "GARRAFE DE TORIO",
-                "79": "GORDALIZA DEL PINO",
-                "80": "GORDONCILLO",
-                "81": "GRADEFES",
-                "82": "GRAJAL DE CAMPOS",
-                "83": "GUSENDOS DE LOS OTEROS",
-                "84": "HOSPITAL DE ORBIGO",
-                "85": "IGUEÑA",
-                "86": "IZAGRE",
-                "88": "JOARILLA DE LAS MATAS",
-                "89": "LAGUNA DALGA",
-                "90": "LAGUNA DE NEGRILLOS",
-                "92": "LUCILLO",
-                "93": "LUYEGO",
-                "94": "LLAMAS DE LA RIBERA",
-                "95": "MAGAZ DE CEPEDA",
-                "96": "MANSILLA DE LAS MULAS",
-                "97": "MANSILLA MAYOR",
-                "98": "MARAÑA",
-                "99": "MATADEON DE LOS OTEROS",
-                "100": "MATALLANA",
-                "101": "MATANZA",
-                "102": "MOLINASECA",
-                "103": "MURIAS DE PAREDES",
-                "104": "NOCEDA",
-                "105": "OENCIA",
-                "106": "LAS OMAÑAS",
-                "107": "ONZONILLA",
-                "108": "OSEJA DE SAJAMBRE",
-                "109": "PAJARES DE LOS OTEROS",
-                "110": "PALACIOS DE LA VALDUERNA",
-                "111": "PALACIOS DEL SIL",
-                "113": "PARAMO DEL SIL",
-                "115": "PERANZANES",
-                "116": "POBLADURA DE PELAYO GARCIA",
-                "117": "LA POLA DE GORDON",
-                "118": "PONFERRADA",
-                "119": "POSADA DE VALDEON",
-                "120": "POZUELO DEL PARAMO",
-                "121": "PRADO DE LA GUZPEÑA",
-                "122": "PRIARANZA DEL BIERZO",
-                "123": "PRIORO",
-                "124": "PUEBLA DE LILLO",
-                "125": "PUENTE DE DOMINGO FLOREZ",
-                "126": "QUINTANA DEL CASTILLO",
-                "127": "QUINTANA DEL MARCO",
-                "128": "QUINTANA Y CONGOSTO",
-                "130": "REGUERAS DE ARRIBA",
-                "132": "REYERO",
-                "133": "RIAÑO",
-                "134": "RIEGO DE LA VEGA",
-                "135": "RIELLO",
-                "136": "RIOSECO DE TAPIA",
-                "137": "LA ROBLA",
-                "138": "VILLAMANIN",
-                "139": "ROPERUELOS DEL PARAMO",
-                "140": "SABERO",
-                "142": "SAHAGUN",
-                "144": "SAN ADRIAN DEL VALLE",
-                "145": "SAN ANDRES DEL RABANEDO",
-                "146": "SANCEDO",
-                "147": "SAN CRISTOBAL DE LA POLANTERA",
-                "148": "SAN EMILIANO",
-                "149": "SAN ESTEBAN DE LOS NOGALES",
-                "151": "SAN JUSTO DE LA VEGA",
-                "152": "SAN MILLAN DE LOS CABALLEROS",
-                "153": "SAN PEDRO BERCIANOS",
-                "154": "SANTA COLOMBA DE CURUEÑO",
-                "155": "SANTA COLOMBA DE SOMOZA",
-                "156": "SANTA CRISTINA DE VALMADRIGAL",
-                "157": "SANTA ELENA DE JAMUZ",
-                "158": "SANTA MARIA DE LA ISLA",
-                "159": "SANTA MARIA DEL MONTE DE CEA",
-                "160": "SANTA MARIA DEL PARAMO",
-                "161": "SANTA MARIA DE ORDAS",
-                "162": "SANTA MARINA DEL REY",
-                "163": "SANTAS MARTAS",
-                "164": "SANTIAGO MILLAS",
-                "165": "SANTOVENIA DE LA VALDONCINA",
-                "166": "SARIEGOS",
-                "167": "SENA DE LUNA",
-                "168": "SOBRADO",
-                "169": "SOTO DE LA VEGA",
-                "170": "SOTO Y AMIO",
-                "171": "TORAL DE LOS GUZMANES",
-                "172": "TORENO",
-                "173": "TORRE DEL BIERZO",
-                "174": "TRABADELO",
-                "175": "TRUCHAS",
-                "176": "TURCIA",
-                "177": "URDIALES DEL PARAMO",
-                "178": "VALDEFRESNO",
-                "179": "VALDEFUENTES DEL PARAMO",
-                "180": "VALDELUGUEROS",
-                "181": "VALDEMORA",
-                "182": "VALDEPIELAGO",
-                "183": "VALDEPOLO",
-                "184": "VALDERAS",
-                "185": "VALDERREY",
-                "186": "VALDERRUEDA",
-                "187": "VALDESAMARIO",
-                "188": "VAL DE SAN LORENZO",
-                "190": "VALDEVIMBRE",
-                "191": "VALENCIA DE DON JUAN",
-                "192": "VALVERDE DE LA VIRGEN",
-                "193": "VALVERDE-ENRIQUE",
-                "194": "VALLECILLO",
-                "196": "LA VECILLA",
-                "197": "VEGACERVERA",
-                "199": "VEGA DE ESPINAREDA",
-                "200": "VEGA DE INFANZONES",
-                "201": "VEGA DE VALCARCE",
-                "203": "VEGAQUEMADA",
-                "205": "VEGAS DEL CONDADO",
-                "206": "VILLABLINO",
-                "207": "VILLABRAZ",
-                "209": "VILLADANGOS DEL PARAMO",
-                "210": "TORAL DE LOS VADOS",
-                "211": "VILLADEMOR DE LA VEGA",
-                "213": "VILLAFRANCA DEL BIERZO",
-                "214": "VILLAGATON",
-                "215": "VILLAMANDOS",
-                "216": "VILLAMAÑAN",
-                "217": "VILLAMARTIN DE DON SANCHO",
-                "218": "VILLAMEJIL",
-                "219": "VILLAMOL",
-                "220": "VILLAMONTAN DE LA VALDUERNA",
-                "221": "VILLAMORATIEL DE LAS MATAS",
-                "222": "VILLANUEVA DE LAS MANZANAS",
-                "223": "VILLAOBISPO",
-                "224": "VILLAORNATE Y CASTRO",
-                "225": "VILLAQUEJIDA",
-                "226": "VILLAQUILAMBRE",
-                "227": "VILLAREJO DE ORBIGO",
-                "228": "VILLARES DE ORBIGO",
-                "229": "VILLASABARIEGO",
-                "230": "VILLASELAN",
-                "231": "VILLATURIEL",
-                "233": "VILLAZALA",
-                "234": "VILLAZANZO DE VALDERADUEY",
-                "235": "ZOTES DEL PARAMO",
-                "900": "LEON",
-            };
-        }
-        else if (provinceCode === 25) {
-            municipalityNames = {
-                "1": "ABELLA DE LA CONCA",
-                "2": "AGER",
-                "3": "AGRAMUNT",
-                "4": "ELS ALAMUS",
-                "5": "ALAS I CERC",
-                "6": "L'ALBAGES",
-                "7": "ALBATARREC",
-                "8": "ALBESA",
-                "9": "L'ALBI",
-                "10": "ALCANO",
-                "11": "ALCARRAS",
-                "12": "ALCOLETGE",
-                "13": "ALFARRAS",
-                "14": "ALFES",
-                "15": "ALGERRI",
-                "16": "ALGUAIRE",
-                "17": "ALINS",
-                "19": "ALMACELLES",
-                "20": "ALMATRET",
-                "21": "ALMENAR",
-                "22": "ALOS DE BALAGUER",
-                "23": "ALPICAT",
-                "25": "ANGLESOLA",
-                "26": "LES VALLS DE VALIRA",
-                "28": "MONTFERRER I CASTELLBO",
-                "31": "ELS PLANS DE SIO",
-                "32": "ARBECA",
-                "36": "ARRES",
-                "39": "ARSEGUEL",
-                "40": "ARTESA DE LLEIDA",
-                "41": "ARTESA DE SEGRE",
-                "43": "LA SENTIU DE SIO",
-                "44": "ASPA",
-                "45": "AVELLANES I SANTA LINYA",
-                "46": "AITONA",
-                "49": "BALAGUER",
-                "50": "BARBENS",
-                "51": "LA BARONIA DE RIALB",
-                "52": "VALL DE BOI",
-                "53": "BASSELLA",
-                "54": "BAUSEN",
-                "55": "BELIANES",
-                "56": "BELLCAIRE D'URGELL",
-                "57": "BELL.LLOC D'URGELL",
-                "58": "BELLMUNT",
-                "59": "BELLPUIG",
-                "60": "BELLVER DE CERDANYA",
-                "61": "BELLVIS",
-                "63": "BENAVENT DE SEGRIA",
-                "67": "BIOSCA",
-                "68": "BOVERA",
-                "69": "ES BORDES",
-                "70": "LES BORGES BLANQUES",
-                "71": "BOSSOST",
-                "72": "CABANABONA",
-                "73": "CABO",
-                "74": "CAMARASA",
-                "75": "CANEJAN",
-                "76": "CASTELLAR DE LA RIBERA",
-                "79": "CASTELLDANS",
-                "80": "CASTELLNOU DE SEANA",
-                "81": "CASTELLO DE FARFANYA",
-                "82": "CASTELLSERA",
-                "83": "CAVA",
-                "84": "CERVERA",
-                "85": "CERVIA DE LES GARRIGUES",
-                "86": "CIUTADILLA",
-                "89": "CLARIANA DE CARDENER",
-                "90": "CONCA DE DALT",
-                "91": "EL COGUL",
-                "92": "COLL DE NARGO",
-                "94": "CORBINS",
-                "95": "CUBELLS",
-                "102": "L'ESPLUGA CALVA",
-                "104": "ESPOT",
-                "107": "ESTARAS",
-                "108": "ESTERRI D'ANEU",
-                "109": "ESTERRI DE CARDOS",
-                "110": "ESTAMARIU",
-                "111": "FARRERA",
-                "112": "FIGOLS I ALINYA",
-                "117": "LA FLORESTA",
-                "118": "FONDARELLA",
-                "120": "FORADADA",
-                "122": "LA FULIOLA",
-                "123": "FULLEDA",
-                "126": "BAIX PALLARS",
-                "128": "GOLMES",
-                "129": "GOSOL",
-                "130": "LA GRANADELLA",
-                "131": "LA GRANJA D'ESCARP",
-                "132": "GRANYANELLA",
-                "133": "GRANYENA DE SEGARRA",
-                "134": "GRANYENA DE GARRIGUES",
-                "136": "CASTELL DE MUR",
-                "138": "GUIMERA",
-                "139": "GUISSONA",
-                "140": "GUIXERS",
-                "142": "IVARS DE NOGUERA",
-                "143": "IVARS D`URGELL",
-                "144": "IVORRA",
-                "146": "ISONA I CONCA DELLA",
-                "147": "JOSA I TUIXEN",
-                "148": "LA GUINGUETA D'ANEU",
-                "149": "JUNCOSA",
-                "150": "JUNEDA",
-                "152": "LES",
-                "153": "LINYOLA",
-                "154": "LLADORRE",
-                "155": "LLADURS",
-                "157": "LLARDECANS",
-                "158": "LLAVORSI",
-                "159": "LLES DE CERDANYA",
-                "162": "LLIMIANA",
-                "163": "LLOBERA",
-                "164": "MALDA",
-                "166": "MASSALCOREIG",
-                "167": "MASSOTERES",
-                "168": "MAIALS",
-                "169": "MENARGUENS",
-                "170": "MIRALCAMP",
-                "171": "LA MOLSOSA",
-                "172": "MOLLERUSSA",
-                "174": "MONTGAI",
-                "177": "MONTELLA I MARTINET",
-                "178": "MONTOLIU DE SEGARRA",
-                "179": "MONTOLIU DE LLEIDA",
-                "180": "MONTORNES DE SEGARRA",
-                "183": "NALEC",
-                "184": "NAVES",
-                "185": "LES VALLS D'AGUILAR",
-                "186": "ODEN",
-                "187": "OLIANA",
-                "188": "OLIOLA",
-                "189": "OLIUS",
-                "190": "LES OLUGES",
-                "191": "ELS OMELLONS",
-                "192": "ELS OMELLS DE NA GAIA",
-                "194": "ORGANYA",
-                "196": "OS DE BALAGUER",
-                "197": "OSSO DE SIO",
-                "198": "EL PALAU D'ANGLESOLA",
-                "203": "LA COMA I LA PEDRA",
-                "204": "PENELLES",
-                "206": "PERAMOLA",
-                "207": "PINELL DE SOLSONES",
-                "208": "PINOS",
-                "209": "RIBERA D'URGELLET",
-                "210": "EL POAL",
-                "211": "LA POBLA DE CERVOLES",
-                "212": "BELLAGUARDA",
-                "213": "LA POBLA DE SEGUR",
-                "215": "PONTS",
-                "216": "EL PONT DE SUERT",
-                "217": "LA PORTELLA",
-                "218": "PRATS I SANSOR",
-                "219": "PREIXANA",
-                "220": "PREIXENS",
-                "222": "PRULLANS",
-                "223": "PUIGGROS",
-                "224": "PUIGVERD D'AGRAMUNT",
-                "225": "PUIGVERD DE LLEIDA",
-                "226": "RIALP",
-                "227": "VALL DE CARDOS",
-                "228": "RINER",
-                "229": "RIU DE CERDANYA",
-                "232": "ROSSELLO",
-                "233": "NAUT ARAN",
-                "234": "SALAS DE PALLARS",
-                "235": "SANAUJA",
-                "236": "SANT GUIM DE FREIXENET",
-                "237": "SANT LLORENÇ DE MORUNYS",
-                "238": "SANT RAMON",
-                "240": "RIBERA D`ONDARA",
-                "241": "GAVET DE LA CONCA",
-                "242": "SANT ESTEVE DE LA SARGA",
-                "243": "SANT GUIM DE LA PLANA",
-                "244": "SANT MARTI DE RIUCORB",
-                "249": "SARROCA DE LLEIDA",
-                "250": "SARROCA DE BELLERA",
-                "251": "SENTERADA",
-                "252": "LA SEU D'URGELL",
-                "254": "SEROS",
-                "255": "SIDAMON",
-                "256": "EL SOLERAS",
-                "257": "SOLSONA",
-                "259": "SORIGUERA",
-                "261": "SORT",
-                "262": "SOSES",
-                "263": "SUDANELL",
-                "264": "SUNYER",
-                "268": "TALARN",
-                "269": "TALAVERA",
-                "272": "TARREGA",
-                "273": "TARRES",
-                "274": "TARROJA DE SEGARRA",
-                "275": "TERMENS",
-                "276": "TIRVIA",
-                "277": "TIURANA",
-                "278": "EL PONT DE BAR",
-                "279": "TORA",
-                "281": "ELS TORMS",
-                "282": "TORNABOUS",
-                "283": "TORREBESSES",
-                "284": "LA TORRE DE CABDELLA",
-                "285": "TORREFARRERA",
-                "286": "TORREFETA I FLOREJACS",
-                "287": "TORREGROSSA",
-                "288": "TORRELAMEU",
-                "289": "TORRES DE SEGRE",
-                "290": "TORRE-SERONA",
-                "295": "TREMP",
-                "299": "ALT ANEU",
-                "300": "VALLBONA DE LES MONGES",
-                "301": "VALLFOGONA DE BALAGUER",
-                "302": "LA VANSA I FORNOLS",
-                "303": "VERDU",
-                "304": "VIELHA E MIJARAN",
-                "306": "VILAGRASSA",
-                "307": "VILALLER",
-                "309": "VILAMOS",
-                "310": "VILANOVA DE BELLPUIG",
-                "311": "VILANOVA DE L'AGUDA",
-                "312": "VILANOVA DE MEIA",
-                "313": "VILANOVA DE SEGRIA",
-                "314": "VILA-SANA",
-                "316": "EL VILOSELL",
-                "317": "VILANOVA DE LA BARCA",
-                "319": "VINAIXA",
-                "321": "GIMENELLS I PLA DE LA FONT",
-                "900": "LLEIDA",
-            };
-        }
-        else if (provinceCode === 26) {
-            municipalityNames = {
-                "1": "ABALOS",
-                "2": "AGONCILLO",
-                "3": "AGUILAR DEL RIO ALHAMA",
-                "4": "AJAMIL DE CAMEROS",
-                "5": "ALBELDA DE IREGUA",
-                "6": "ALBERITE",
-                "7": "ALCANADRE",
-                "8": "ALDEANUEVA DE EBRO",
-                "9": "ALESANCO",
-                "10": "ALESON",
-                "11": "ALFARO",
-                "12": "ALMARZA DE CAMEROS",
-                "13": "ANGUCIANA",
-                "14": "ANGUIANO",
-                "15": "ARENZANA DE ABAJO",
-                "16": "ARENZANA DE ARRIBA",
-                "17": "ARNEDILLO",
-                "18": "ARNEDO",
-                "19": "ARRUBAL",
-                "20": "AUSEJO",
-                "21": "AUTOL",
-                "22": "AZOFRA",
-                "23": "BADARAN",
-                "24": "BAÑARES",
-                "25": "BAÑOS DE RIOJA",
-                "26": "BAÑOS DE RIO TOBIA",
-                "27": "BERCEO",
-                "28": "BERGASA",
-                "29": "BERGASILLAS BAJERA",
-                "30": "BEZARES",
-                "31": "BOBADILLA",
-                "32": "BRIEVA DE CAMEROS",
-                "33": "BRIÑAS",
-                "34": "BRIONES",
-                "35": "CABEZON DE CAMEROS",
-                "36": "CALAHORRA",
-                "37": "CAMPROVIN",
-                "38": "CANALES DE LA SIERRA",
-                "39": "CANILLAS DE RIO TUERTO",
-                "40": "CAÑAS",
-                "41": "CARDENAS",
-                "42": "CASALARREINA",
-                "43": "CASTAÑARES DE RIOJA",
-                "44": "CASTROVIEJO",
-                "45": "CELLORIGO",
-                "46": "CENICERO",
-                "47": "CERVERA DEL RIO ALHAMA",
-                "48": "CIDAMON",
-                "49": "CIHURI",
-                "50": "CIRUEÑA",
-                "51": "CLAVIJO",
-                "52": "CORDOVIN",
-                "53": "CORERA",
-                "54": "CORNAGO",
-                "55": "CORPORALES",
-                "56": "CUZCURRITA DE RIO TIRON",
-                "57": "DAROCA DE RIOJA",
-                "58": "ENCISO",
-                "59": "ENTRENA",
-                "60": "ESTOLLO",
-                "61": "EZCARAY",
-                "62": "FONCEA",
-                "63": "FONZALECHE",
-                "64": "FUENMAYOR",
-                "65": "GALBARRULI",
-                "66": "GALILEA",
-                "67": "GALLINERO DE CAMEROS",
-                "68": "GIMILEO",
-                "69": "GRAÑON",
-                "70": "GRAVALOS",
-                "71": "HARO",
-                "72": "HERCE",
-                "73": "HERRAMELLURI",
-                "74": "HERVIAS",
-                "75": "HORMILLA",
-                "76": "HORMILLEJA",
-                "77": "HORNILLOS DE CAMEROS",
-                "78": "HORNOS DE MONCALVILLO",
-                "79": "HUERCANOS",
-                "80": "IGEA",
-                "81": "JALON DE CAMEROS",
-                "82": "LAGUNA DE CAMEROS",
-                "83": "LAGUNILLA DEL JUBERA",
-                "84": "LARDERO",
-                "86": "LEDESMA DE LA COGOLLA",
-                "87": "LEIVA",
-                "88": "LEZA DE RIO LEZA",
-                "91": "LUMBRERAS",
-                "92": "MANJARRES",
-                "93": "MANSILLA",
-                "94": "MANZANARES DE RIOJA",
-                "95": "MATUTE",
-                "96": "MEDRANO",
-                "97": "OCON",
-                "99": "MUNILLA",
-                "100": "MURILLO DE RIO LEZA",
-                "101": "MURO DE AGUAS",
-                "102": "MURO EN CAMEROS",
-                "103": "NAJERA",
-                "104": "NALDA",
-                "105": "NAVAJUN",
-                "106": "NAVARRETE",
-                "107": "NESTARES",
-                "108": "NIEVA DE CAMEROS",
-                "109": "OCHANDURI",
-                "110": "OJACASTRO",
-                "111": "OLLAURI",
-                "112": "ORTIGOSA DE CAMEROS",
-                "113": "PAZUENGOS",
-                "114": "PEDROSO",
-                "115": "PINILLOS",
-                "117": "PRADEJON",
-                "118": "PRADILLO",
-                "119": "PREJANO",
-                "120": "QUEL",
-                "121": "RABANERA",
-                "122": "EL RASILLO DE CAMEROS",
-                "123": "EL REDAL",
-                "124": "RIBAFRECHA",
-                "125": "RINCON DE SOTO",
-                "126": "ROBRES DEL CASTILLO",
-                "127": "RODEZNO",
-                "128": "SAJAZARRA",
-                "129": "SAN ASENSIO",
-                "130": "SAN MILLAN DE LA COGOLLA",
-                "131": "SAN MILLAN DE YECORA",
-                "132": "SAN ROMAN DE CAMEROS",
-                "134": "SANTA COLOMA",
-                "135": "SANTA ENGRACIA DEL JUBERA",
-                "136": "SANTA EULALIA BAJERA",
-                "138": "SANTO DOMINGO DE LA CALZADA",
-                "139": "SAN TORCUATO",
-                "140": "SANTURDE DE RIOJA",
-                "141": "SANTURDEJO",
-                "142": "SAN VICENTE DE LA SONSIERRA",
-                "143": "SOJUELA",
-                "144": "SORZANO",
-                "145": "SOTES",
-                "146": "SOTO EN CAMEROS",
-                "147": "TERROBA",
-                "148": "TIRGO",
-                "149": "TOBIA",
-                "150": "TORMANTOS",
-                "151": "TORRECILLA EN CAMEROS",
-                "152": "TORRECILLA SOBRE ALESANCO",
-                "153": "TORRE EN CAMEROS",
-                "154": "TORREMONTALBO",
-                "155": "TREVIANA",
-                "157": "TRICIO",
-                "158": "TUDELILLA",
-                "160": "URUÑUELA",
-                "161": "VALDEMADERA",
-                "162": "VALGAÑON",
-                "163": "VENTOSA",
-                "164": "VENTROSA",
-                "165": "VIGUERA",
-                "167": "VILLALBA DE RIOJA",
-                "168": "VILLALOBAR DE RIOJA",
-                "169": "VILLAMEDIANA DE IREGUA",
-                "170": "VILLANUEVA DE CAMEROS",
-                "171": "EL VILLAR DE ARNEDO",
-                "172": "VILLAR DE TORRE",
-                "173": "VILLAREJO",
-                "174": "VILLARROYA",
-                "175": "VILLARTA-QUINTANA",
-                "176": "VILLAVELAYO",
-                "177": "VILLAVERDE DE RIOJA",
-                "178": "VILLOSLADA DE CAMEROS",
-                "179": "VINIEGRA DE ABAJO",
-                "180": "VINIEGRA DE ARRIBA",
-                "181": "ZARRATON",
-                "182": "ZARZOSA",
-                "184": "ZORRAQUIN",
-                "900": "LOGROÑO",
-            };
-        }
-        else if (provinceCode === 27) {
-            municipalityNames = {
-                "1": "ABADIN",
-                "2": "ALFOZ",
-                "3": "ANTAS DE ULLA",
-                "4": "BALEIRA",
-                "5": "BARREIROS",
-                "6": "BECERREA",
-                "7": "BEGONTE",
-                "8": "BOVEDA",
-                "9": "CARBALLEDO",
-                "10": "CASTRO DE REI",
-                "11": "CASTROVERDE",
-                "12": "CERVANTES",
-                "13": "CERVO",
-                "14": "O CORGO",
-                "15": "COSPEITO",
-                "16": "CHANTADA",
-                "17": "FOLGOSO DO COUREL",
-                "18": "A FONSAGRADA",
-                "19": "FOZ",
-                "20": "FRIOL",
-                "21": "XERMADE",
-                "22": "GUITIRIZ",
-                "23": "GUNTIN",
-                "24": "O INCIO",
-                "25": "XOVE",
-                "26": "LANCARA",
-                "27": "LOURENZA",
-                "29": "MEIRA",
-                "30": "MONDOÑEDO",
-                "31": "MONFORTE DE LEMOS",
-                "32": "MONTERROSO",
-                "33": "MURAS",
-                "34": "NAVIA DE SUARNA",
-                "35": "NEGUEIRA DE MUÑIZ",
-                "36": "BARALLA",
-                "37": "AS NOGAIS",
-                "38": "OUROL",
-                "39": "OUTEIRO DE REI",
-                "40": "PALAS DE REI",
-                "41": "PANTON",
-                "42": "PARADELA",
-                "43": "O PARAMO",
-                "44": "A PASTORIZA",
-                "45": "PEDRAFITA DO CEBREIRO",
-                "46": "POL",
-                "47": "A POBRA DO BROLLON",
-                "48": "A PONTENOVA",
-                "49": "PORTOMARIN",
-                "50": "QUIROGA",
-                "51": "RIBADEO",
-                "52": "RIBAS DE SIL",
-                "53": "RIBEIRA DE PIQUIN",
-                "54": "RIOTORTO",
-                "55": "SAMOS",
-                "56": "RABADE",
-                "57": "SARRIA",
-                "58": "O SAVIÑAO",
-                "59": "SOBER",
-                "60": "TABOADA",
-                "61": "TRABADA",
-                "62": "TRIACASTELA",
-                "63": "O VALADOURO",
-                "64": "O VICEDO",
-                "65": "VILALBA",
-                "67": "VIVEIRO",
-                "68": "BURELA",
-                "900": "LUGO",
-            };
-        }
-        else if (provinceCode === 28) {
-            municipalityNames = {
-                "1": "LA ACEBEDA",
-                "2": "AJALVIR",
-                "3": "ALAMEDA DEL VALLE",
-                "4": "EL ALAMO",
-                "5": "ALCALA DE HENARES",
-                "6": "ALCOBENDAS",
-                "7": "ALCORCON",
-                "8": "ALDEA DEL FRESNO",
-                "9": "ALGETE",
-                "10": "ALPEDRETE",
-                "11": "AMBITE",
-                "12": "ANCHUELO",
-                "13": "ARANJUEZ",
-                "14": "ARGANDA DEL REY",
-                "15": "ARROYOMOLINOS",
-                "16": "EL ATAZAR",
-                "17": "BATRES",
-                "18": "BECERRIL DE LA SIERRA",
-                "19": "BELMONTE DE TAJO",
-                "20": "EL BERRUECO",
-                "21": "BERZOSA DE LOZOYA",
-                "22": "BOADILLA DEL MONTE",
-                "23": "EL BOALO",
-                "24": "BRAOJOS",
-                "25": "BREA DE TAJO",
-                "26": "BRUNETE",
-                "27": "BUITRAGO DEL LOZOYA",
-                "28": "BUSTARVIEJO",
-                "29": "CABANILLAS DE LA SIERRA",
-                "30": "LA CABRERA",
-                "31": "CADALSO DE LOS VIDRIOS",
-                "32": "CAMARMA DE ESTERUELAS",
-                "33": "CAMPO REAL",
-                "34": "CANENCIA",
-                "35": "CARABAÑA",
-                "36": "CASARRUBUELOS",
-                "37": "CENICIENTOS",
-                "38": "CERCEDILLA",
-                "39": "CERVERA DE BUITRAGO",
-                "40": "CIEMPOZUELOS",
-                "41": "COBEÑA",
-                "42": "COLMENAR DEL ARROYO",
-                "43": "COLMENAR DE OREJA",
-                "44": "COLMENAREJO",
-                "45": "COLMENAR VIEJO",
-                "46": "COLLADO-MEDIANO",
-                "47": "COLLADO VILLALBA",
-                "48": "CORPA",
-                "49": "COSLADA",
-                "50": "CUBAS DE LA SAGRA",
-                "51": "CHAPINERIA",
-                "52": "CHINCHON",
-                "53": "DAGANZO DE ARRIBA",
-                "54": "EL ESCORIAL",
-                "55": "ESTREMERA",
-                "56": "FRESNEDILLAS",
-                "57": "FRESNO DE TOROTE",
-                "58": "FUENLABRADA",
-                "59": "FUENTE EL SAZ DE JARAMA",
-                "60": "FUENTIDUEÑA DE TAJO",
-                "61": "GALAPAGAR",
-                "62": "GARGANTA DE LOS MONTES",
-                "63": "GARGANTILLA DE LOZOYA",
-                "64": "GASCONES",
-                "65": "GETAFE",
-                "66": "GRIÑON",
-                "67": "GUADALIX DE LA SIERRA",
-                "68": "GUADARRAMA",
-                "69": "LA HIRUELA",
-                "70": "HORCAJO DE LA SIERRA-AOSLOS",
-                "71": "HORCAJUELO DE LA SIERRA",
-                "72": "HOYO DE MANZANARES",
-                "73": "HUMANES DE MADRID",
-                "74": "LEGANES",
-                "75": "LOECHES",
-                "76": "LOZOYA",
-                "77": "LOZOYUELA-NAVAS-SIETEIGLESIAS",
-                "78": "MADARCOS",
-                "80": "MAJADAHONDA",
-                "82": "MANZANARES EL REAL",
-                "83": "MECO",
-                "84": "MEJORADA DEL CAMPO",
-                "85": "MIRAFLORES DE LA SIERRA",
-                "86": "EL MOLAR",
-                "87": "LOS MOLINOS",
-                "88": "MONTEJO DE LA SIERRA",
-                "89": "MORALEJA DE ENMEDIO",
-                "90": "MORALZARZAL",
-                "91": "MORATA DE TAJUÑA",
-                "92": "MOSTOLES",
-                "93": "NAVACERRADA",
-                "94": "NAVALAFUENTE",
-                "95": "NAVALAGAMELLA",
-                "96": "NAVALCARNERO",
-                "97": "NAVARREDONDA Y SAN MAMES",
-                "99": "NAVAS DEL REY",
-                "100": "NUEVO BAZTAN",
-                "101": "OLMEDA DE LAS FUENTES",
-                "102": "ORUSCO",
-                "104": "PARACUELLOS DE JARAMA",
-                "106": "PARLA",
-                "107": "PATONES",
-                "108": "PEDREZUELA",
-                "109": "PELAYOS DE LA PRESA",
-                "110": "PERALES DE TAJUÑA",
-                "111": "PEZUELA DE LAS TORRES",
-                "112": "PINILLA DEL VALLE",
-                "113": "PINTO",
-                "114": "PIÑUECAR",
-                "115": "POZUELO DE ALARCON",
-                "116": "POZUELO DEL REY",
-                "117": "PRADENA DEL RINCON",
-                "118": "PUEBLA DE LA SIERRA",
-                "119": "QUIJORNA",
-                "120": "RASCAFRIA",
-                "121": "REDUEÑA",
-                "122": "RIBATEJADA",
-                "123": "RIVAS-VACIAMADRID",
-                "124": "ROBLEDILLO DE LA JARA",
-                "125": "ROBLEDO DE CHAVELA",
-                "126": "ROBREGORDO",
-                "127": "LAS ROZAS DE MADRID",
-                "128": "ROZAS DE PUERTO REAL",
-                "129": "SAN AGUSTIN DEL GUADALIX",
-                "130": "SAN FERNANDO DE HENARES",
-                "131": "SAN LORENZO DE EL ESCORIAL",
-                "132": "SAN MARTIN DE LA VEGA",
-                "133": "SAN MARTIN DE VALDEIGLESIAS",
-                "134": "SAN SEBASTIAN DE LOS REYES",
-                "135": "SANTA MARIA DE LA ALAMEDA",
-                "136": "SANTORCAZ",
-                "137": "LOS SANTOS DE LA HUMOSA",
-                "138": "LA SERNA DEL MONTE",
-                "140": "SERRANILLOS DEL VALLE",
-                "141": "SEVILLA LA NUEVA",
-                "143": "SOMOSIERRA",
-                "144": "SOTO DEL REAL",
-                "145": "TALAMANCA DE JARAMA",
-                "146": "TIELMES",
-                "147": "TITULCIA",
-                "148": "TORREJON DE ARDOZ",
-                "149": "TORREJON DE LA CALZADA",
-                "150": "TORREJON DE VELASCO",
-                "151": "TORRELAGUNA",
-                "152": "TORRELODONES",
-                "153": "TORREMOCHA DE JARAMA",
-                "154": "TORRES DE LA ALAMEDA",
-                "155": "VALDARACETE",
-                "156": "VALDEAVERO",
-                "157": "VALDELAGUNA",
-                "158": "VALDEMANCO",
-                "159": "VALDEMAQUEDA",
-                "160": "VALDEMORILLO",
-                "161": "VALDEMORO",
-                "162": "VALDEOLMOS-ALALPARDO",
-                "163": "VALDEPIELAGOS",
-                "164": "VALDETORRES DE JARAMA",
-                "165": "VALDILECHA",
-                "166": "VALVERDE DE ALCALA",
-                "167": "VELILLA DE SAN ANTONIO",
-                "168": "EL VELLON",
-                "169": "VENTURADA",
-                "170": "VILLACONEJOS",
-                "171": "VILLA DEL PRADO",
-                "172": "VILLALBILLA",
-                "173": "VILLAMANRIQUE DE TAJO",
-                "174": "VILLAMANTA",
-                "175": "VILLAMANTILLA",
-                "176": "VILLANUEVA DE LA CAÑADA",
-                "177": "VILLANUEVA DEL PARDILLO",
-                "178": "VILLANUEVA DE PERALES",
-                "179": "VILLAR DEL OLMO",
-                "180": "VILLAREJO DE SALVANES",
-                "181": "VILLAVICIOSA DE ODON",
-                "182": "VILLAVIEJA DE LOZOYA",
-                "183": "ZARZALEJO",
-                "184": "TRES CANTOS",
-                "185": "PUENTES VIEJAS",
-                "900": "MADRID",
-            };
-        }
-        else if (provinceCode === 29) {
-            municipalityNames = {
-                "1": "ALAMEDA",
-                "2": "ALCAUCIN",
-                "3": "ALFARNATE",
-                "4": "ALFARNATEJO",
-                "5": "ALGARROBO",
-                "6": "ALGATOCIN",
-                "7": "ALHAURIN DE LA TORRE",
-                "8": "ALHAURIN EL GRANDE",
-                "9": "ALMACHAR",
-                "10": "ALMARGEN",
-                "11": "ALMOGIA",
-                "12": "ALORA",
-                "13": "ALOZAINA",
-                "14": "ALPANDEIRE",
-                "15": "ANTEQUERA",
-                "16": "ARCHEZ",
-                "17": "ARCHIDONA",
-                "18": "ARDALES",
-                "19": "ARENAS",
-                "20": "ARRIATE",
-                "21": "ATAJATE",
-                "22": "BENADALID",
-                "23": "BENAHAVIS",
-                "24": "BENALAURIA",
-                "25": "BENALMADENA",
-                "26": "BENAMARGOSA",
-                "27": "BENAMOCARRA",
-                "28": "BENAOJAN",
-                "29": "BENARRABA",
-                "30": "EL BORGE",
-                "31": "EL BURGO",
-                "32": "CAMPILLOS",
-                "33": "CANILLAS DE ACEITUNO",
-                "34": "CANILLAS DE ALBAIDA",
-                "35": "CAÑETE LA REAL",
-                "36": "CARRATRACA",
-                "37": "CARTAJIMA",
-                "38": "CARTAMA",
-                "39": "CASABERMEJA",
-                "40": "CASARABONELA",
-                "41": "CASARES",
-                "42": "COIN",
-                "43": "COLMENAR",
-                "44": "COMARES",
-                "45": "COMPETA",
-                "46": "CORTES DE LA FRONTERA",
-                "47": "CUEVAS BAJAS",
-                "48": "CUEVAS DEL BECERRO",
-                "49": "CUEVAS DE SAN MARCOS",
-                "50": "CUTAR",
-                "51": "ESTEPONA",
-                "52": "FARAJAN",
-                "53": "FRIGILIANA",
-                "54": "FUENGIROLA",
-                "55": "FUENTE DE PIEDRA",
-                "56": "GAUCIN",
-                "57": "GENALGUACIL",
-                "58": "GUARO",
-                "59": "HUMILLADERO",
-                "60": "IGUALEJA",
-                "61": "ISTAN",
-                "62": "IZNATE",
-                "63": "JIMERA DE LIBAR",
-                "64": "JUBRIQUE",
-                "65": "JUZCAR",
-                "66": "MACHARAVIAYA",
-                "68": "MANILVA",
-                "69": "MARBELLA",
-                "70": "MIJAS",
-                "71": "MOCLINEJO",
-                "72": "MOLLINA",
-                "73": "MONDA",
-                "74": "MONTEJAQUE",
-                "75": "NERJA",
-                "76": "OJEN",
-                "77": "PARAUTA",
-                "79": "PERIANA",
-                "80": "PIZARRA",
-                "81": "PUJERRA",
-                "82": "RINCON DE LA VICTORIA",
-                "83": "RIOGORDO",
-                "84": "RONDA",
-                "85": "SALARES",
-                "86": "SAYALONGA",
-                "87": "SEDELLA",
-                "88": "SIERRA DE YEGUAS",
-                "89": "TEBA",
-                "90": "TOLOX",
-                "91": "TORROX",
-                "92": "TOTALAN",
-                "93": "VALLE DE ABDALAJIS",
-                "94": "VELEZ-MALAGA",
-                "95": "VILLANUEVA DE ALGAIDAS",
-                "96": "VILLANUEVA DEL ROSARIO",
-                "97": "VILLANUEVA DEL TRABUCO",
-                "98": "VILLANUEVA DE TAPIA",
-                "99": "VIÑUELA",
-                "100": "YUNQUERA",
-                "101": "MONTECORTO",
-                "102": "VILLANUEVA DE LA CONCEPCION",
-                "103": "TORREMOLINOS",
-                "104": "SERRATO",
-                "900": "MALAGA",
-            };
-        }
-        else if (provinceCode === 30) {
-            municipalityNames = {
-                "1": "ABANILLA",
-                "2": "ABARAN",
-                "3": "AGUILAS",
-                "4": "ALBUDEITE",
-                "5": "ALCANTARILLA",
-                "6": "ALEDO",
-                "7": "ALGUAZAS",
-                "8": "ALHAMA DE MURCIA",
-                "9": "ARCHENA",
-                "10": "BENIEL",
-                "11": "BLANCA",
-                "12": "BULLAS",
-                "13": "CALASPARRA",
-                "14": "CAMPOS DEL RIO",
-                "15": "CARAVACA DE LA CRUZ",
-                "16": "CARTAGENA",
-                "17": "CEHEGIN",
-                "18": "CEUTI",
-                "19": "CIEZA",
-                "20": "FORTUNA",
-                "21": "FUENTE-ALAMO",
-                "22": "JUMILLA",
-                "23": "LIBRILLA",
-                "24": "LORCA",
-                "25": "LORQUI",
-                "26": "MAZARRON",
-                "27": "MOLINA DE SEGURA",
-                "28": "MORATALLA",
-                "29": "MULA",
-                "30": "MURCIA",
-                "31": "OJOS",
-                "32": "PLIEGO",
-                "33": "PUERTO-LUMBRERAS",
-                "34": "RICOTE",
-                "35": "SAN JAVIER",
-                "36": "SAN PEDRO DEL PINATAR",
-                "37": "TORRE-PACHECO",
-                "38": "LAS TORRES DE COTILLAS",
-                "39": "TOTANA",
-                "40": "ULEA",
-                "41": "LA UNION",
-                "42": "VILLANUEVA DEL RIO SEGURA",
-                "43": "YECLA",
-                "44": "SANTOMERA",
-                "45": "LOS ALCAZARES",
-            };
-        }
-        else if (provinceCode === 31) {
-            municipalityNames = {
-                "1": "ABÁIGAR",
-                "2": "ABÁRZUZA",
-                "3": "ABAURREGAINA/ABAURREA ALTA",
-                "4": "ABAURREPEA/ABAURREA BAJA",
-                "5": "ABERIN",
-                "6": "ABLITAS",
-                "7": "ADIÓS",
-                "8": "AGUILAR DE CODÉS",
-                "9": "AIBAR O OIBAR",
-                "10": "ALTSASU/ALSASUA",
-                "11": "ALLÍN",
-                "12": "ALLO",
-                "13": "AMÉSCOA BAJA",
-                "14": "ANCÍN",
-                "15": "ANDOSILLA",
-                "16": "ANSOÁIN",
-                "17": "ANUE",
-                "18": "AÑORBE",
-                "19": "AOIZ O AGOITZ",
-                "20": "ARAITZ",
-                "21": "ARANARACHE",
-                "22": "ARANTZA",
-                "23": "ARANGUREN",
-                "24": "ARANO",
-                "25": "ARAKIL",
-                "26": "ARAS",
-                "27": "ARBIZU",
-                "28": "ARCE O ARTZI",
-                "29": "LOS ARCOS",
-                "30": "ARELLANO",
-                "31": "ARESO",
-                "32": "ARGUEDAS",
-                "33": "ARIA",
-                "34": "ARIBE",
-                "35": "ARMAÑANZAS",
-                "36": "ARRÓNIZ",
-                "37": "ARRUAZU",
-                "38": "ARTAJONA",
-                "39": "ARTAZU",
-                "40": "ATEZ",
-                "41": "AYEGUI",
-                "42": "AZAGRA",
-                "43": "AZUELO",
-                "44": "BAKAIKU",
-                "45": "BARÁSOAIN",
-                "46": "BARBARIN",
-                "47": "BARGOTA",
-                "48": "BARILLAS",
-                "49": "BASABURUA",
-                "50": "BAZTAN",
-                "51": "BEIRE",
-                "52": "BELASCOÁIN",
-                "53": "BERBINZANA",
-                "54": "BERTIZARANA",
-                "55": "BETELU",
-                "56": "BIURRUN-OLCOZ",
-                "57": "BUÑUEL",
-                "58": "AURITZ/BURGUETE",
-                "59": "BURGUI O BURGI",
-                "60": "BURLADA O BURLATA",
-                "61": "EL BUSTO",
-                "62": "CABANILLAS",
-                "63": "CABREDO",
-                "64": "CADREITA",
-                "65": "CAPARROSO",
-                "66": "CÁRCAR",
-                "67": "CARCASTILLO",
-                "68": "CASCANTE",
-                "69": "CÁSEDA",
-                "70": "CASTEJÓN",
-                "71": "CASTILLO-NUEVO",
-                "72": "CINTRUÉNIGO",
-                "73": "ZIORDIA",
-                "74": "CIRAUQUI",
-                "75": "CIRIZA",
-                "76": "CIZUR",
-                "77": "CORELLA",
-                "78": "CORTES",
-                "79": "DESOJO",
-                "80": "DICASTILLO",
-                "81": "DONAMARIA",
-                "82": "ETXALAR",
-                "83": "ECHARRI",
-                "84": "ETXARRI-ARANATZ",
-                "85": "ETXAURI",
-                "86": "EGÜÉS",
-                "87": "ELGORRIAGA",
-                "88": "NOÁIN (VALLE DE ELORZ) O NOAIN (ELORTZIBAR)",
-                "89": "ENÉRIZ",
-                "90": "ERATSUN",
-                "91": "ERGOIENA",
-                "92": "ERRO",
-                "93": "EZCÁROZ O EZKAROZE",
-                "94": "ESLAVA",
-                "95": "ESPARZA",
-                "96": "ESPRONCEDA",
-                "97": "ESTELLA O LIZARRA",
-                "98": "ESTERIBAR",
-                "99": "ETAYO",
-                "100": "EULATE",
-                "101": "EZCABARTE",
-                "102": "EZKURRA",
-                "103": "EZPROGUI",
-                "104": "FALCES",
-                "105": "FITERO",
-                "106": "FONTELLAS",
-                "107": "FUNES",
-                "108": "FUSTIÑANA",
-                "109": "GALAR",
-                "110": "GALLIPIENZO",
-                "111": "GALLUÉS O GALOZE",
-                "112": "GARAIOA",
-                "113": "GARDE",
-                "114": "GARÍNOAIN",
-                "115": "GARRALDA",
-                "116": "GENEVILLA",
-                "117": "GOIZUETA",
-                "118": "GOÑI",
-                "119": "GÜESA O GORZA",
-                "120": "GUESÁLAZ",
-                "121": "GUIRGUILLANO",
-                "122": "HUARTE O UHARTE",
-                "123": "UHARTE-ARAKIL",
-                "124": "IBARGOITI",
-                "125": "IGÚZQUIZA",
-                "126": "IMOTZ",
-                "127": "IRAÑETA",
-                "128": "ISABA O IZABA",
-                "129": "ITUREN",
-                "130": "ITURMENDI",
-                "131": "IZA",
-                "132": "IZAGAONDOA",
-                "133": "IZALZU O ITZALTZU",
-                "134": "JAURRIETA",
-                "135": "JAVIER",
-                "136": "JUSLAPEÑA",
-                "137": "LABAIEN",
-                "138": "LAKUNTZA",
-                "139": "LANA",
-                "140": "LANTZ",
-                "141": "LAPOBLACIÓN",
-                "142": "LARRAGA",
-                "143": "LARRAONA",
-                "144": "LARRAUN",
-                "145": "LAZAGURRÍA",
-                "146": "LEACHE",
-                "147": "LEGARDA",
-                "148": "LEGARIA",
-                "149": "LEITZA",
-                "150": "LEOZ",
-                "151": "LERGA",
-                "152": "LERÍN",
-                "153": "LESAKA",
-                "154": "LEZÁUN",
-                "155": "LIÉDENA",
-                "156": "LIZOÁIN",
-                "157": "LODOSA",
-                "158": "LÓNGUIDA O LONGIDA",
-                "159": "LUMBIER",
-                "160": "LUQUIN",
-                "161": "MAÑERU",
-                "162": "MARAÑÓN",
-                "163": "MARCILLA",
-                "164": "MÉLIDA",
-                "165": "MENDAVIA",
-                "166": "MENDAZA",
-                "167": "MENDIGORRÍA",
-                "168": "METAUTEN",
-                "169": "MILAGRO",
-                "170": "MIRAFUENTES",
-                "171": "MIRANDA DE ARGA",
-                "172": "MONREAL",
-                "173": "MONTEAGUDO",
-                "174": "MORENTIN",
-                "175": "MUÉS",
-                "176": "MURCHANTE",
-                "177": "MURIETA",
-                "178": "MURILLO EL CUENDE",
-                "179": "MURILLO EL FRUTO",
-                "180": "MURUZÁBAL",
-                "181": "NAVASCUÉS",
-                "182": "NAZAR",
-                "183": "OBANOS",
-                "184": "OCO",
-                "185": "OCHAGAVÍA",
-                "186": "ODIETA",
-                "187": "OITZ",
-                "188": "OLÁIBAR",
-                "189": "OLAZTI/OLAZAGUTÍA",
-                "190": "OLEJUA",
-                "191": "OLITE",
-                "192": "OLÓRIZ",
-                "193": "OLZA",
-                "194": "OLLO",
-                "195": "ORBAITZETA",
-                "196": "ORBARA",
-                "197": "ORÍSOAIN",
-                "198": "ORONZ",
-                "199": "OROZ-BETELU",
-                "200": "OTEIZA",
-                "201": "PAMPLONA O IRUÑA",
-                "202": "PERALTA",
-                "203": "PETILLA DE ARAGÓN",
-                "204": "PIEDRAMILLERA",
-                "205": "PITILLAS",
-                "206": "PUENTE LA REINA O GARES",
-                "207": "PUEYO",
-                "208": "RIBAFORADA",
-                "209": "ROMANZADO",
-                "210": "RONCAL O ERRONKARI",
-                "211": "ORREAGA/RONCESVALLES",
-                "212": "SADA",
-                "213": "SALDÍAS",
-                "214": "SALINAS DE ORO",
-                "215": "SAN ADRIÁN",
-                "216": "SANGÜESA O ZANGOZA",
-                "217": "SAN MARTÍN DE UNX",
-                "219": "SANSOL",
-                "220": "SANTACARA",
-                "221": "DONEZTEBE/SANTESTEBAN",
-                "222": "SARRIÉS O SARTZE",
-                "223": "SARTAGUDA",
-                "224": "SESMA",
-                "225": "SORLADA",
-                "226": "SUNBILLA",
-                "227": "TAFALLA",
-                "228": "TIEBAS-MURUARTE DE RETA",
-                "229": "TIRAPU",
-                "230": "TORRALBA DEL RÍO",
-                "231": "TORRES DEL RÍO",
-                "232": "TUDELA",
-                "233": "TULEBRAS",
-                "234": "ÚCAR",
-                "235": "UJUÉ",
-                "236": "ULTZAMA",
-                "237": "UNCITI",
-                "238": "UNZUÉ",
-                "239": "URDAZUBI/URDAX",
-                "240": "URDIAIN",
-                "241": "URRAÚL ALTO",
-                "242": "URRAÚL BAJO",
-                "243": "URROZ-VILLA",
-                "244": "URROTZ",
-                "245": "URZAINQUI",
-                "246": "UTERGA",
-                "247": "UZTÁRROZ O UZTARROZE",
-                "248": "LUZAIDE/VALCARLOS",
-                "249": "VALTIERRA",
-                "250": "BERA/VERA DE BIDASOA",
-                "251": "VIANA",
-                "252": "VIDÁNGOZ O BIDANKOZE",
-                "253": "BIDAURRETA",
-                "254": "VILLAFRANCA",
-                "255": "VILLAMAYOR DE MONJARDÍN",
-                "256": "HIRIBERRI/VILLANUEVA DE AEZKOA",
-                "257": "VILLATUERTA",
-                "258": "VILLAVA O ATARRABIA",
-                "259": "IGANTZI",
-                "260": "YERRI",
-                "261": "YESA",
-                "262": "ZABALZA",
-                "263": "ZUBIETA",
-                "264": "ZUGARRAMURDI",
-                "265": "ZÚÑIGA",
-                "502": "FACERÍA 2",
-                "508": "FACERÍA 8",
-                "509": "FACERÍA 9",
-                "510": "FACERÍA 10",
-                "511": "FACERÍA 11",
-                "514": "FACERÍA 14",
-                "515": "FACERÍA 15",
-                "516": "FACERÍA 16",
-                "517": "FACERÍA 17",
-                "518": "FACERÍA 18 \"REMENDÍA\"",
-                "521": "FACERÍA 21",
-                "522": "FACERÍA 22",
-                "523": "MONTE COMÚN DE LAS AMÉSCOAS",
-                "524": "FACERÍA 24 \"LARRAIZA",
-                "526": "FACERÍA 26",
-                "527": "FACERÍA 27",
-                "528": "FACERÍA 28",
-                "529": "FACERÍA 29 \"ARAMBELTZ\"",
-                "530": "FACERÍA 30 \"SAMINDIETA\"",
-                "531": "FACERÍA 31",
-                "532": "FACERÍA 32",
-                "535": "FACERÍA 35",
-                "536": "FACERÍA 36",
-                "537": "FACERÍA 37",
-                "538": "FACERÍA 38",
-                "539": "FACERÍA 39",
-                "540": "FACERÍA 40",
-                "541": "FACERÍA 41",
-                "542": "FACERÍA 42",
-                "543": "FACERÍA 43",
-                "544": "FACERÍA 44",
-                "545": "FACERÍA 45",
-                "546": "FACERÍA 46",
-                "549": "FACERÍA 49",
-                "550": "FACERÍA 50",
-                "552": "FACERÍA 52",
-                "553": "FACERÍA 53",
-                "555": "FACERÍA 55",
-                "556": "FACERÍA 56",
-                "562": "FACERÍA 62",
-                "563": "FACERÍA 63",
-                "565": "FACERÍA 65",
-                "567": "FACERÍA 67",
-                "570": "FACERÍA 70",
-                "571": "FACERÍA 71",
-                "574": "FACERÍA 74",
-                "575": "FACERÍA 75",
-                "576": "FACERÍA 76",
-                "579": "FACERÍA 79",
-                "581": "FACERÍA 81",
-                "582": "FACERÍA 82",
-                "583": "FACERÍA 83",
-                "584": "FACERÍA 84",
-                "585": "FACERÍA 85",
-                "586": "FACERÍA 86",
-                "587": "FACERÍA 87",
-                "588": "FACERÍA 88",
-                "591": "FACERÍA 91",
-                "592": "FACERÍA 92",
-                "603": "FACERÍA 103",
-                "604": "FACERÍA 104",
-                "605": "FACERÍA 105",
-                "606": "FACERÍA 106",
-                "607": "FACERÍA 107",
-                "608": "FACERÍA 108",
-                "690": "BARDENAS REALES",
-                "691": "SIERRA DE ANDÍA",
-                "692": "SIERRA DE ARALAR",
-                "693": "SIERRA DE LÓQUIZ",
-                "694": "SIERRA DE URBASA",
-                "901": "BARAÑÁIN",
-                "902": "BERRIOPLANO",
-                "903": "BERRIOZAR",
-                "904": "IRURTZUN",
-                "905": "BERIÁIN",
-                "906": "ORCOYEN",
-                "907": "ZIZUR MAYOR O ZIZUR NAGUSIA",
-                "908": "LEKUNBERRI",
-            };
-        }
-        else if (provinceCode === 32) {
-            municipalityNames = {
-                "2": "ALLARIZ",
-                "3": "AMOEIRO",
-                "4": "A ARNOIA",
-                "5": "AVION",
-                "6": "BALTAR",
-                "7": "BANDE",
-                "8": "BAÑOS DE MOLGAS",
-                "9": "BARBADAS",
-                "10": "O BARCO DE VALDEORRAS",
-                "11": "BEADE",
-                "12": "BEARIZ",
-                "13": "OS BLANCOS",
-                "14": "BOBORAS",
-                "15": "A BOLA",
-                "16": "O BOLO",
-                "17": "CALVOS DE RANDIN",
-                "18": "CARBALLEDA",
-                "19": "CARBALLEDA DE AVIA",
-                "20": "O CARBALLIÑO",
-                "21": "CARTELLE",
-                "22": "CASTRELO DO VAL",
-                "23": "CASTRELO DE MIÑO",
-                "24": "CASTRO CALDELAS",
-                "25": "CELANOVA",
-                "26": "CENLLE",
-                "27": "COLES",
-                "28": "CORTEGADA",
-                "29": "CUALEDRO",
-                "30": "CHANDREXA DE QUEIXA",
-                "31": "ENTRIMO",
-                "32": "ESGOS",
-                "33": "XINZO DE LIMIA",
-                "34": "GOMESENDE",
-                "35": "A GUDIÑA",
-                "36": "O IRIXO",
-                "37": "XUNQUEIRA DE AMBIA",
-                "38": "XUNQUEIRA DE ESPADANEDO",
-                "39": "LAROUCO",
-                "40": "LAZA",
-                "41": "LEIRO",
-                "42": "LOBEIRA",
-                "43": "LOBIOS",
-                "44": "MACEDA",
-                "45": "MANZANEDA",
-                "46": "MASIDE",
-                "47": "MELON",
-                "48": "A MERCA",
-                "49": "A MEZQUITA",
-                "50": "MONTEDERRAMO",
-                "51": "MONTERREI",
-                "52": "MUIÑOS",
-                "53": "NOGUEIRA DE RAMUIN",
-                "54": "OIMBRA",
-                "56": "PADERNE DE ALLARIZ",
-                "57": "PADRENDA",
-                "58": "PARADA DE SIL",
-                "59": "O PEREIRO DE AGUIAR",
-                "60": "A PEROXA",
-                "61": "PETIN",
-                "62": "PIÑOR",
-                "63": "PORQUEIRA",
-                "64": "A POBRA DE TRIVES",
-                "65": "PONTEDEVA",
-                "66": "PUNXIN",
-                "67": "QUINTELA DE LEIRADO",
-                "68": "RAIRIZ DE VEIGA",
-                "69": "RAMIRAS",
-                "70": "RIBADAVIA",
-                "71": "SAN XOAN DE RIO",
-                "72": "RIOS",
-                "73": "A RUA",
-                "74": "RUBIA",
-                "75": "SAN AMARO",
-                "76": "SAN CIBRAO DAS VIÑAS",
-                "77": "SAN CRISTOVO DE CEA",
-                "78": "SANDIAS",
-                "79": "SARREAUS",
-                "80": "TABOADELA",
-                "81": "A TEIXEIRA",
-                "82": "TOEN",
-                "83": "TRASMIRAS",
-                "84": "A VEIGA",
-                "85": "VEREA",
-                "86": "VERIN",
-                "87": "VIANA DO BOLO",
-                "88": "VILAMARIN",
-                "89": "VILAMARTIN DE VALDEORRAS",
-                "90": "VILAR DE BARRIO",
-                "91": "VILAR DE SANTOS",
-                "92": "VILARDEVOS",
-                "93": "VILARIÑO DE CONSO",
-                "900": "OURENSE",
-            };
-        }
-        else if (provinceCode === 33) {
-            municipalityNames = {
-                "1": "ALLANDE",
-                "2": "ALLER",
-                "3": "AMIEVA",
-                "4": "AVILES",
-                "5": "BELMONTE DE MIRANDA",
-                "6": "BIMENES",
-                "7": "BOAL",
-                "8": "CABRALES",
-                "9": "CABRANES",
-                "10": "CANDAMO",
-                "11": "CANGAS DE NARCEA",
-                "12": "CANGAS DE ONIS",
-                "13": "CARAVIA",
-                "14": "CARREÑO",
-                "15": "CASO",
-                "16": "CASTRILLON",
-                "17": "CASTROPOL",
-                "18": "COAÑA",
-                "19": "COLUNGA",
-                "20": "CORVERA DE ASTURIAS",
-                "21": "CUDILLERO",
-                "22": "DEGAÑA",
-                "23": "EL FRANCO",
-                "24": "GIJON",
-                "25": "GOZON",
-                "26": "GRADO",
-                "27": "GRANDAS DE SALIME",
-                "28": "IBIAS",
-                "29": "ILLANO",
-                "30": "ILLAS",
-                "31": "LANGREO",
-                "32": "LAVIANA",
-                "33": "LENA",
-                "34": "VALDES",
-                "35": "LLANERA",
-                "36": "LLANES",
-                "37": "MIERES",
-                "38": "MORCIN",
-                "39": "MUROS DE NALON",
-                "40": "NAVA",
-                "41": "NAVIA",
-                "42": "NOREÑA",
-                "43": "ONIS",
-                "45": "PARRES",
-                "46": "PEÑAMELLERA ALTA",
-                "47": "PEÑAMELLERA BAJA",
-                "48": "PESOZ",
-                "49": "PILOÑA",
-                "50": "PONGA",
-                "51": "PRAVIA",
-                "52": "PROAZA",
-                "53": "QUIROS",
-                "54": "LAS REGUERAS",
-                "55": "RIBADEDEVA",
-                "56": "RIBADESELLA",
-                "57": "RIBERA DE ARRIBA",
-                "58": "RIOSA",
-                "59": "SALAS",
-                "60": "SAN MARTIN DEL REY AURELIO",
-                "61": "SAN MARTIN DE OSCOS",
-                "62": "SANTA EULALIA DE OSCOS",
-                "63": "SAN TIRSO DE ABRES",
-                "64": "SANTO ADRIANO",
-                "65": "SARIEGO",
-                "66": "SIERO",
-                "67": "SOBRESCOBIO",
-                "68": "SOMIEDO",
-                "69": "SOTO DEL BARCO",
-                "70": "TAPIA DE CASARIEGO",
-                "71": "TARAMUNDI",
-                "72": "TEVERGA",
-                "73": "TINEO",
-                "74": "VEGADEO",
-                "75": "VILLANUEVA DE OSCOS",
-                "76": "VILLAVICIOSA",
-                "77": "VILLAYON",
-                "78": "YERNES Y TAMEZA",
-                "900": "OVIEDO",
-            };
-        }
-        else if (provinceCode === 34) {
-            municipalityNames = {
-                "1": "ABARCA",
-                "3": "ABIA DE LAS TORRES",
-                "4": "AGUILAR DE CAMPOO",
-                "5": "ALAR DEL REY",
-                "6": "ALBA DE CERRATO",
-                "9": "AMAYUELAS DE ARRIBA",
-                "10": "AMPUDIA",
-                "11": "AMUSCO",
-                "12": "ANTIGUEDAD",
-                "15": "ARCONADA",
-                "17": "ASTUDILLO",
-                "18": "AUTILLA DEL PINO",
-                "19": "AUTILLO DE CAMPOS",
-                "20": "AYUELA",
-                "22": "BALTANAS",
-                "23": "VENTA BAÑOS",
-                "24": "BAQUERIN DE CAMPOS",
-                "25": "BARCENA DE CAMPOS",
-                "27": "BARRUELO DE SANTULLAN",
-                "28": "BASCONES DE OJEDA",
-                "29": "BECERRIL DE CAMPOS",
-                "31": "BELMONTE DE CAMPOS",
-                "32": "BERZOSILLA",
-                "33": "BOADA DE CAMPOS",
-                "34": "BOADILLA DEL CAMINO",
-                "35": "BOADILLA DE RIOSECO",
-                "36": "BRAÑOSERA",
-                "37": "BUENAVISTA DE VALDAVIA",
-                "38": "BUSTILLO DE LA VEGA",
-                "39": "BUSTILLO DEL PARAMO DE CARRION",
-                "41": "CALAHORRA DE BOEDO",
-                "42": "CALZADA DE LOS MOLINOS",
-                "45": "CAPILLAS",
-                "46": "CARDEÑOSA DE VOLPEJERA",
-                "47": "CARRION DE LOS CONDES",
-                "48": "CASTIL DE VELA",
-                "49": "CASTREJON DE LA PEÑA",
-                "50": "CASTRILLO DE DON JUAN",
-                "51": "CASTRILLO DE ONIELO",
-                "52": "CASTRILLO DE VILLAVEGA",
-                "53": "CASTROMOCHO",
-                "56": "CERVATOS DE LA CUEZA",
-                "57": "CERVERA DE PISUERGA",
-                "58": "CEVICO DE LA TORRE",
-                "59": "CEVICO NAVERO",
-                "60": "CISNEROS",
-                "61": "COBOS DE CERRATO",
-                "62": "COLLAZOS DE BOEDO",
-                "63": "CONGOSTO DE VALDAVIA",
-                "64": "CORDOVILLA LA REAL",
-                "66": "CUBILLAS DE CERRATO",
-                "67": "DEHESA DE MONTEJO",
-                "68": "DEHESA DE ROMANOS",
-                "69": "DUEÑAS",
-                "70": "ESPINOSA DE CERRATO",
-                "71": "ESPINOSA DE VILLAGONZALO",
-                "72": "FRECHILLA",
-                "73": "FRESNO DEL RIO",
-                "74": "FROMISTA",
-                "76": "FUENTES DE NAVA",
-                "77": "FUENTES DE VALDEPERO",
-                "79": "GRIJOTA",
-                "80": "GUARDO",
-                "81": "GUAZA DE CAMPOS",
-                "82": "HERMEDES DE CERRATO",
-                "83": "HERRERA DE PISUERGA",
-                "84": "HERRERA DE VALDECAÑAS",
-                "86": "HONTORIA DE CERRATO",
-                "87": "HORNILLOS DE CERRATO",
-                "88": "HUSILLOS",
-                "89": "ITERO DE LA VEGA",
-                "90": "LOMA DE UCIEZA",
-                "91": "LAGARTOS",
-                "92": "LANTADILLA",
-                "93": "LAVID DE OJEDA",
-                "94": "LEDIGOS",
-                "96": "LOMAS",
-                "98": "MAGAZ",
-                "99": "MANQUILLOS",
-                "100": "MANTINOS",
-                "101": "MARCILLA DE CAMPOS",
-                "102": "MAZARIEGOS",
-                "103": "MAZUECOS DE VALDEGINATE",
-                "104": "MELGAR DE YUSO",
-                "106": "MENESES DE CAMPOS",
-                "107": "MICIECES DE OJEDA",
-                "108": "MONZON DE CAMPOS",
-                "109": "MORATINOS",
-                "110": "MUDA",
-                "112": "NOGAL DE LAS HUERTAS",
-                "113": "OLEA DE BOEDO",
-                "114": "OLMOS DE OJEDA",
-                "116": "OSORNILLO",
-                "117": "OSORNO LA MAYOR",
-                "121": "PALENZUELA",
-                "122": "PARAMO DE BOEDO",
-                "123": "PAREDES DE NAVA",
-                "124": "PAYO DE OJEDA",
-                "125": "PEDRAZA DE CAMPOS",
-                "126": "PEDROSA DE LA VEGA",
-                "127": "PERALES",
-                "129": "PINO DEL RIO",
-                "130": "PIÑA DE CAMPOS",
-                "131": "POBLACION DE ARROYO",
-                "132": "POBLACION DE CAMPOS",
-                "133": "POBLACION DE CERRATO",
-                "134": "POLENTINOS",
-                "135": "POMAR DE VALDIVIA",
-                "136": "POZA DE LA VEGA",
-                "137": "POZO DE URAMA",
-                "139": "PRADANOS DE OJEDA",
-                "140": "LA PUEBLA DE VALDAVIA",
-                "141": "QUINTANA DEL PUENTE",
-                "143": "QUINTANILLA DE ONSOÑA",
-                "146": "REINOSO DE CERRATO",
-                "147": "RENEDO DE LA VEGA",
-                "149": "REQUENA DE CAMPOS",
-                "151": "RESPENDA DE LA PEÑA",
-                "152": "REVENGA DE CAMPOS",
-                "154": "REVILLA DE COLLAZOS",
-                "155": "RIBAS DE CAMPOS",
-                "156": "RIBEROS DE LA CUEZA",
-                "157": "SALDAÑA",
-                "158": "SALINAS DE PISUERGA",
-                "159": "SAN CEBRIAN DE CAMPOS",
-                "160": "SAN CEBRIAN DE MUDA",
-                "161": "SAN CRISTOBAL DE BOEDO",
-                "163": "SAN MAMES DE CAMPOS",
-                "165": "SAN ROMAN DE LA CUBA",
-                "166": "LA PERNIA",
-                "167": "SANTA CECILIA DEL ALCOR",
-                "168": "SANTA CRUZ DE BOEDO",
-                "169": "SANTERVAS DE LA VEGA",
-                "170": "SANTIBAÑEZ DE ECLA",
-                "171": "SANTIBAÑEZ DE LA PEÑA",
-                "174": "SANTOYO",
-                "175": "LA SERNA",
-                "176": "SOTOBAÑADO Y PRIORATO",
-                "177": "SOTO DE CERRATO",
-                "178": "TABANERA DE CERRATO",
-                "179": "TABANERA DE VALDAVIA",
-                "180": "TAMARA",
-                "181": "TARIEGO",
-                "182": "TORQUEMADA",
-                "184": "TORREMORMOJON",
-                "185": "TRIOLLO",
-                "186": "VALBUENA DE PISUERGA",
-                "189": "VALDEOLMILLOS",
-                "190": "VALDERRABANO",
-                "192": "VALDE UCIEZA",
-                "196": "VALLE DE CERRATO",
-                "199": "VELILLA DEL RIO CARRION",
-                "201": "VERTAVILLO",
-                "202": "VILLABASTA",
-                "204": "VILLACIDALER",
-                "205": "VILLACONANCIO",
-                "206": "VILLADA",
-                "208": "VILLAELES DE VALDAVIA",
-                "210": "VILLAHAN",
-                "211": "VILLAHERREROS",
-                "213": "VILLALACO",
-                "214": "VILLALBA DE GUARDO",
-                "215": "VILLALCAZAR DE SIRGA",
-                "216": "VILLALCON",
-                "217": "VILLALOBON",
-                "218": "VILLALUENGA DE LA VEGA",
-                "219": "VALLE DEL RETORTILLO",
-                "220": "VILLAMARTIN DE CAMPOS",
-                "221": "VILLAMEDIANA",
-                "222": "VILLAMERIEL",
-                "223": "VILLAMORONTA",
-                "224": "VILLAMUERA DE LA CUEZA",
-                "225": "VILLAMURIEL DE CERRATO",
-                "228": "VILLANUEVA DEL REBOLLAR",
-                "229": "VILLANUÑO DE VALDAVIA",
-                "230": "VILLAPROVEDO",
-                "231": "VILLARMENTERO DE CAMPOS",
-                "232": "VILLARRABE",
-                "233": "VILLARRAMIEL",
-                "234": "VILLASARRACINO",
-                "235": "VILLASILA DE VALDAVIA",
-                "237": "VILLATURDE",
-                "238": "VILLAUMBRALES",
-                "239": "VILLAVIUDAS",
-                "241": "VILLERIAS",
-                "242": "VILLODRE",
-                "243": "VILLODRIGO",
-                "244": "VILLOLDO",
-                "246": "VILLOTA DEL PARAMO",
-                "247": "VILLOVIECO",
-                "900": "PALENCIA",
-            };
-        }
-        else if (provinceCode === 35) {
-            municipalityNames = {
-                "1": "AGAETE",
-                "2": "AGUIMES",
-                "3": "ANTIGUA",
-                "4": "ARRECIFE",
-                "5": "ARTENARA",
-                "6": "ARUCAS",
-                "7": "BETANCURIA",
-                "8": "FIRGAS",
-                "9": "GALDAR",
-                "10": "GUIA",
-                "11": "HARIA",
-                "12": "INGENIO",
-                "13": "MOGAN",
-                "14": "MOYA",
-                "15": "LA OLIVA",
-                "16": "PAJARA",
-                "17": "LAS PALMAS DE GRAN CANARIA",
-                "18": "PUERTO ROSARIO",
-                "19": "S.BARTOLOME LANZAROTE",
-                "20": "S.BARTOLOME TIRAJANA",
-                "21": "LA ALDEA DE SAN NICOLAS",
-                "22": "SANTA BRIGIDA",
-                "23": "SANTA LUCIA DE TIRAJANA",
-                "24": "TEGUISE",
-                "25": "TEJEDA",
-                "26": "TELDE",
-                "27": "TEROR",
-                "28": "TIAS",
-                "29": "TINAJO",
-                "30": "TUINEJE",
-                "31": "VALSEQUILLO",
-                "32": "VALLESECO",
-                "33": "VEGA S.MATEO",
-                "34": "YAIZA",
-            };
-        }
-        else if (provinceCode === 36) {
-            municipalityNames = {
-                "1": "ARBO",
-                "2": "BARRO",
-                "3": "BAIONA",
-                "4": "BUEU",
-                "5": "CALDAS DE REIS",
-                "6": "CAMBADOS",
-                "7": "CAMPO LAMEIRO",
-                "8": "CANGAS",
-                "9": "A CAÑIZA",
-                "10": "CATOIRA",
-                "11": "CERDEDO",
-                "12": "COTOBADE",
-                "13": "O COVELO",
-                "14": "CRECENTE",
-                "15": "CUNTIS",
-                "16": "DOZON",
-                "17": "A ESTRADA",
-                "18": "FORCAREI",
-                "19": "FORNELOS DE MONTES",
-                "20": "AGOLADA",
-                "21": "GONDOMAR",
-                "22": "O GROVE",
-                "23": "A GUARDA",
-                "24": "LALIN",
-                "25": "A LAMA",
-                "26": "MARIN",
-                "27": "MEAÑO",
-                "28": "MEIS",
-                "29": "MOAÑA",
-                "30": "MONDARIZ",
-                "31": "MONDARIZ-BALNEARIO",
-                "32": "MORAÑA",
-                "33": "MOS",
-                "34": "AS NEVES",
-                "35": "NIGRAN",
-                "36": "OIA",
-                "37": "PAZOS DE BORBEN",
-                "39": "O PORRIÑO",
-                "40": "PORTAS",
-                "41": "POIO",
-                "42": "PONTEAREAS",
-                "43": "PONTE-CALDELAS",
-                "44": "PONTECESURES",
-                "45": "REDONDELA",
-                "46": "RIBADUMIA",
-                "47": "RODEIRO",
-                "48": "O ROSAL",
-                "49": "SALCEDA DE CASELAS",
-                "50": "SALVATERRA DE MIÑO",
-                "51": "SANXENXO",
-                "52": "SILLEDA",
-                "53": "SOUTOMAIOR",
-                "54": "TOMIÑO",
-                "55": "TUI",
-                "56": "VALGA",
-                "57": "VIGO",
-                "58": "VILABOA",
-                "59": "VILA DE CRUCES",
-                "60": "VILAGARCIA DE AROUSA",
-                "61": "VILANOVA DE AROUSA",
-                "62": "ILLA DE AROUSA",
-                "900": "PONTEVEDRA",
-            };
-        }
-        else if (provinceCode === 37) {
-            municipalityNames = {
-                "1": "ABUSEJO",
-                "2": "AGALLAS",
-                "3": "AHIGAL DE LOS ACEITEROS",
-                "4": "AHIGAL DE VILLARINO",
-                "5": "LA ALAMEDA DE GARDON",
-                "6": "LA ALAMEDILLA",
-                "7": "ALARAZ",
-                "8": "ALBA DE TORMES",
-                "9": "ALBA DE YELTES",
-                "10": "LA ALBERCA",
-                "11": "LA ALBERGUERIA DE ARGAÑAN",
-                "12": "ALCONADA",
-                "13": "ALDEACIPRESTE",
-                "14": "ALDEADAVILA DE LA RIBERA",
-                "15": "ALDEA DEL OBISPO",
-                "16": "ALDEALENGUA",
-                "17": "ALDEANUEVA DE FIGUEROA",
-                "18": "ALDEANUEVA DE LA SIERRA",
-                "19": "ALDEARRODRIGO",
-                "20": "ALDEARRUBIA",
-                "21": "ALDEASECA DE ALBA",
-                "22": "ALDEASECA DE LA FRONTERA",
-                "23": "ALDEATEJADA",
-                "24": "ALDEAVIEJA DE TORMES",
-                "25": "ALDEHUELA DE LA BOVEDA",
-                "26": "ALDEHUELA DE YELTES",
-                "27": "ALMENARA DE TORMES",
-                "28": "ALMENDRA",
-                "29": "ANAYA DE ALBA",
-                "30": "AÑOVER DE TORMES",
-                "31": "ARABAYONA",
-                "32": "ARAPILES",
-                "33": "ARCEDIANO",
-                "34": "EL ARCO",
-                "35": "ARMENTEROS",
-                "36": "SAN MIGUEL DE ROBLEDO",
-                "37": "LA ATALAYA",
-                "38": "BABILAFUENTE",
-                "39": "BAÑOBAREZ",
-                "40": "BARBADILLO",
-                "41": "BARBALOS",
-                "42": "BARCEO",
-                "44": "BARRUECOPARDO",
-                "45": "LA BASTIDA",
-                "46": "BEJAR",
-                "47": "BELEÑA",
-                "49": "BERMELLAR",
-                "50": "BERROCAL DE HUEBRA",
-                "51": "BERROCAL DE SALVATIERRA",
-                "52": "BOADA",
-                "54": "EL BODON",
-                "55": "BOGAJO",
-                "56": "LA BOUZA",
-                "57": "BOVEDA DEL RIO ALMAR",
-                "58": "BRINCONES",
-                "59": "BUENAMADRE",
-                "60": "BUENAVISTA",
-                "61": "EL CABACO",
-                "62": "CABEZABELLOSA DE LA CALZADA",
-                "63": "LA CABEZA DE BEJAR",
-                "65": "CABEZA DEL CABALLO",
-                "67": "CABRERIZOS",
-                "68": "CABRILLAS",
-                "69": "CALVARRASA DE ABAJO",
-                "70": "CALVARRASA DE ARRIBA",
-                "71": "LA CALZADA DE BEJAR",
-                "72": "CALZADA DE DON DIEGO",
-                "73": "CALZADA DE VALDUNCIEL",
-                "74": "CAMPILLO DE AZABA",
-                "77": "EL CAMPO DE PEÑARANDA",
-                "78": "CANDELARIO",
-                "79": "CANILLAS DE ABAJO",
-                "80": "CANTAGALLO",
-                "81": "CANTALAPIEDRA",
-                "82": "CANTALPINO",
-                "83": "CANTARACILLO",
-                "85": "CARBAJOSA DE LA SAGRADA",
-                "86": "CARPIO DE AZABA",
-                "87": "CARRASCAL DE BARREGAS",
-                "88": "CARRASCAL DEL OBISPO",
-                "89": "CASAFRANCA",
-                "90": "LAS CASAS DEL CONDE",
-                "91": "CASILLAS DE FLORES",
-                "92": "CASTELLANOS DE MORISCOS",
-                "96": "CASTILLEJO DE MARTIN VIEJO",
-                "97": "CASTRAZ",
-                "98": "CEPEDA",
-                "99": "CERECEDA DE LA SIERRA",
-                "100": "CEREZAL DE PEÑAHORCADA",
-                "101": "CERRALBO",
-                "102": "EL CERRO",
-                "103": "CESPEDOSA",
-                "104": "CILLEROS DE LA BASTIDA",
-                "106": "CIPEREZ",
-                "107": "CIUDAD-RODRIGO",
-                "108": "COCA DE ALBA",
-                "109": "COLMENAR DE MONTEMAYOR",
-                "110": "CORDOVILLA",
-                "112": "CRISTOBAL",
-                "113": "EL CUBO DE DON SANCHO",
-                "114": "CHAGARCIA-MEDIANERO",
-                "115": "DIOS LE GUARDE",
-                "116": "DOÑINOS DE LEDESMA",
-                "117": "DOÑINOS DE SALAMANCA",
-                "118": "EJEME",
-                "119": "LA ENCINA",
-                "120": "ENCINA DE SAN SILVESTRE",
-                "121": "ENCINAS DE ABAJO",
-                "122": "ENCINAS DE ARRIBA",
-                "123": "ENCINASOLA DE LOS COMENDADORES",
-                "124": "ENDRINAL",
-                "125": "ESCURIAL DE LA SIERRA",
-                "126": "ESPADAÑA",
-                "127": "ESPEJA",
-                "128": "ESPINO DE LA ORBADA",
-                "129": "FLORIDA DE LIEBANA",
-                "130": "FORFOLEDA",
-                "131": "FRADES DE LA SIERRA",
-                "132": "LA FREGENEDA",
-                "133": "FRESNEDOSO",
-                "134": "FRESNO-ALHANDIGA",
-                "135": "LA FUENTE DE SAN ESTEBAN",
-                "136": "FUENTEGUINALDO",
-                "137": "FUENTELIANTE",
-                "138": "FUENTERROBLE DE SALVATIERRA",
-                "139": "FUENTES DE BEJAR",
-                "140": "FUENTES DE OÑORO",
-                "141": "GAJATES",
-                "142": "GALINDO Y PERAHUY",
-                "143": "GALINDUSTE",
-                "144": "GALISANCHO",
-                "145": "GALLEGOS DE ARGAÑAN",
-                "146": "GALLEGOS DE SOLMIRON",
-                "147": "GARCIBUEY",
-                "148": "GARCIHERNANDEZ",
-                "149": "GARCIRREY",
-                "151": "GEJUELO DEL BARRO",
-                "152": "GOLPEJAS",
-                "153": "GOMECELLO",
-                "155": "GUADRAMIRO",
-                "156": "GUIJO DE AVILA",
-                "157": "GUIJUELO",
-                "158": "HERGUIJUELA DE CIUDAD-RODRIGO",
-                "159": "HERGUIJUELA DE LA SIERRA",
-                "160": "HERGUIJUELA DEL CAMPO",
-                "161": "HINOJOSA DE DUERO",
-                "162": "HORCAJO DE MONTEMAYOR",
-                "163": "HORCAJO-MEDIANERO",
-                "164": "LA HOYA",
-                "165": "HUERTA",
-                "166": "IRUELOS",
-                "167": "ITUERO DE AZABA",
-                "168": "JUZBADO",
-                "169": "LAGUNILLA",
-                "170": "LARRODRIGO",
-                "171": "LEDESMA",
-                "172": "LEDRADA",
-                "173": "LINARES DE RIOFRIO",
-                "174": "LUMBRALES",
-                "175": "MACOTERA",
-                "176": "MACHACON",
-                "177": "MADROÑAL",
-                "178": "EL MAILLO",
-                "179": "MALPARTIDA",
-                "180": "MANCERA DE ABAJO",
-                "181": "EL MANZANO",
-                "182": "MARTIAGO",
-                "183": "MARTINAMOR",
-                "184": "MARTIN DE YELTES",
-                "185": "MASUECO",
-                "186": "CASTELLANOS DE VILLIQUERA",
-                "187": "LA MATA DE LEDESMA",
-                "188": "MATILLA DE LOS CAÑOS DEL RIO",
-                "189": "LA MAYA",
-                "190": "MEMBRIBE",
-                "191": "MIEZA",
-                "192": "MILANO",
-                "193": "MIRANDA DE AZAN",
-                "194": "MIRANDA DEL CASTAÑAR",
-                "195": "MOGARRAZ",
-                "196": "MOLINILLO",
-                "197": "MONFORTE DE LA SIERRA",
-                "198": "MONLEON",
-                "199": "MONLERAS",
-                "200": "MONSAGRO",
-                "201": "MONTEJO",
-                "202": "MONTEMAYOR DEL RIO",
-                "203": "MONTERRUBIO DE LA ARMUÑA",
-                "204": "MONTERRUBIO DE LA SIERRA",
-                "205": "MORASVERDES",
-                "206": "MORILLE",
-                "207": "MORIÑIGO",
-                "208": "MORISCOS",
-                "209": "MORONTA",
-                "210": "MOZARBEZ",
-                "212": "NARROS DE MATALAYEGUA",
-                "213": "NAVACARROS",
-                "214": "NAVA BEJAR",
-                "215": "NAVA DE FRANCIA",
-                "216": "NAVA DE SOTROBAL",
-                "217": "NAVALES",
-                "218": "NAVALMORAL DE BEJAR",
-                "219": "NAVAMORALES",
-                "220": "NAVARREDONDA DE LA RINCONADA",
-                "222": "NAVASFRIAS",
-                "223": "NEGRILLA DE PALENCIA",
-                "224": "OLMEDO DE CAMACES",
-                "225": "LA ORBADA",
-                "226": "PAJARES DE LA LAGUNA",
-                "227": "PALACIOS DEL ARZOBISPO",
-                "229": "PALACIOSRUBIOS",
-                "230": "PALENCIA DE NEGRILLA",
-                "232": "PARADA DE ARRIBA",
-                "233": "PARADA DE RUBIALES",
-                "234": "PARADINAS DE SAN JUAN",
-                "235": "PASTORES",
-                "236": "EL PAYO",
-                "237": "PEDRAZA DE ALBA",
-                "238": "PEDROSILLO DE ALBA",
-                "239": "PEDROSILLO DE LOS AIRES",
-                "240": "PEDROSILLO EL RALO",
-                "241": "EL PEDROSO DE LA ARMUÑA",
-                "242": "PELABRAVO",
-                "243": "PELARRODRIGUEZ",
-                "244": "PELAYOS",
-                "245": "LA PEÑA",
-                "246": "PEÑACABALLERA",
-                "247": "PEÑAPARDA",
-                "248": "PEÑARANDA DE BRACAMONTE",
-                "249": "PEÑARANDILLA",
-                "250": "PERALEJOS DE ABAJO",
-                "251": "PERALEJOS DE ARRIBA",
-                "252": "PEREÑA",
-                "253": "PEROMINGO",
-                "254": "PINEDAS",
-                "255": "EL PINO DE TORMES",
-                "256": "PITIEGUA",
-                "257": "PIZARRAL",
-                "258": "POVEDA DE LAS CINTAS",
-                "259": "POZOS DE HINOJO",
-                "260": "PUEBLA DE AZABA",
-                "261": "PUEBLA DE SAN MEDEL",
-                "262": "PUEBLA DE YELTES",
-                "263": "PUENTE DEL CONGOSTO",
-                "264": "PUERTAS",
-                "265": "PUERTO DE BEJAR",
-                "266": "PUERTO SEGURO",
-                "267": "RAGAMA",
-                "268": "LA REDONDA",
-                "269": "RETORTILLO",
-                "270": "LA RINCONADA DE LA SIERRA",
-                "271": "ROBLEDA",
-                "272": "ROBLIZA DE COJOS",
-                "273": "ROLLAN",
-                "274": "SAELICES EL CHICO",
-                "275": "LA SAGRADA",
-                "277": "SALDEANA",
-                "278": "SALMORAL",
-                "279": "SALVATIERRA DE TORMES",
-                "280": "SAN CRISTOBAL",
-                "281": "SANCTI-SPIRITUS",
-                "282": "SANCHON DE LA RIBERA",
-                "283": "SANCHON DE LA SAGRADA",
-                "284": "SANCHOTELLO",
-                "285": "SANDO",
-                "286": "SAN ESTEBAN DE LA SIERRA",
-                "287": "SAN FELICES DE LOS GALLEGOS",
-                "288": "SAN MARTIN DEL CASTAÑAR",
-                "289": "SAN MIGUEL DE VALERO",
-                "290": "SAN MORALES",
-                "291": "SAN MUÑOZ",
-                "292": "SAN PEDRO DEL VALLE",
-                "293": "SAN PEDRO DE ROZADOS",
-                "294": "SAN PELAYO DE GUAREÑA",
-                "295": "SANTA MARIA DE SANDO",
-                "296": "SANTA MARTA DE TORMES",
-                "298": "SANTIAGO DE LA PUEBLA",
-                "299": "SANTIBAÑEZ DE BEJAR",
-                "300": "SANTIBAÑEZ DE LA SIERRA",
-                "301": "SANTIZ",
-                "302": "LOS SANTOS",
-                "303": "SARDON DE LOS FRAILES",
-                "304": "SAUCELLE",
-                "305": "EL SAHUGO",
-                "306": "SEPULCRO-HILARIO",
-                "307": "SEQUEROS",
-                "308": "SERRADILLA DEL ARROYO",
-                "309": "SERRADILLA DEL LLANO",
-                "311": "LA SIERPE",
-                "312": "SIETEIGLESIAS DE TORMES",
-                "313": "SOBRADILLO",
-                "314": "SORIHUELA",
-                "315": "SOTOSERRANO",
-                "316": "TABERA DE ABAJO",
-                "317": "LA TALA",
-                "318": "TAMAMES",
-                "319": "TARAZONA DE GUAREÑA",
-                "320": "TARDAGUILA",
-                "321": "EL TEJADO",
-                "323": "TEJEDA Y SEGOYUELA",
-                "324": "TENEBRON",
-                "325": "TERRADILLOS",
-                "326": "TOPAS",
-                "327": "TORDILLOS",
-                "328": "EL TORNADIZO",
-                "330": "TORRESMENUDAS",
-                "331": "TRABANCA",
-                "332": "TREMEDAL DE TORMES",
-                "333": "VALDECARROS",
-                "334": "VALDEFUENTES DE SANGUSIN",
-                "335": "VALDEHIJADEROS",
-                "336": "VALDELACASA",
-                "337": "VALDELAGEVE",
-                "338": "VALDELOSA",
-                "339": "VALDEMIERQUE",
-                "340": "VALDERRODRIGO",
-                "341": "VALDUNCIEL",
-                "342": "VALERO",
-                "343": "VALSALABROSO",
-                "344": "VALVERDE DE VALDELACASA",
-                "345": "VALVERDON",
-                "346": "VALLEJERA DE RIOFRIO",
-                "347": "VECINOS",
-                "348": "VEGA DE TIRADOS",
-                "349": "LAS VEGUILLAS",
-                "350": "LA VELLES",
-                "351": "VENTOSA DEL RIO ALMAR",
-                "352": "LA VIDOLA",
-                "353": "VILVESTRE",
-                "354": "VILLAFLORES",
-                "355": "VILLAGONZALO DE TORMES",
-                "356": "VILLALBA DE LOS LLANOS",
-                "357": "VILLAMAYOR",
-                "358": "VILLANUEVA DEL CONDE",
-                "359": "VILLAR DE ARGAÑAN",
-                "360": "VILLAR DE CIERVO",
-                "361": "VILLAR DE GALLIMAZO",
-                "362": "VILLAR DE LA YEGUA",
-                "363": "VILLAR DE PERALONSO",
-                "364": "VILLAR DE SAMANIEGO",
-                "365": "VILLARES DE LA REINA",
-                "366": "VILLARES DE YELTES",
-                "367": "VILLARINO",
-                "368": "VILLARMAYOR",
-                "369": "VILLARMUERTO",
-                "370": "VILLASBUENAS",
-                "371": "VILLASDARDO",
-                "372": "VILLASECO DE LOS GAMITOS",
-                "373": "VILLASECO DE LOS REYES",
-                "374": "VILLASRUBIAS",
-                "375": "VILLAVERDE DE GUAREÑA",
-                "376": "VILLAVIEJA DE YELTES",
-                "377": "VILLORIA",
-                "378": "VILLORUELA",
-                "379": "VITIGUDINO",
-                "380": "YECLA DE YELTES",
-                "381": "ZAMARRA",
-                "382": "ZAMAYON",
-                "383": "ZARAPICOS",
-                "384": "ZARZA DE PUMAREDA",
-                "385": "ZORITA DE LA FRONTERA",
-                "900": "SALAMANCA",
-            };
-        }
-        else if (provinceCode === 38) {
-            municipalityNames = {
-                "1": "ADEJE",
-                "2": "AGULO",
-                "3": "ALAJERO",
-                "4": "ARAFO",
-                "5": "ARICO",
-                "6": "ARONA",
-                "7": "BARLOVENTO",
-                "8": "BREÑA ALTA",
-                "9": "BREÑA BAJA",
-                "10": "BUENAVISTA DEL NORTE",
-                "11": "CANDELARIA",
-                "12": "FASNIA",
-                "13": "FRONTERA",
-                "14": "FUENCALIENTE DE LA PALMA",
-                "15": "GARACHICO",
-                "16": "GARAFIA",
-                "17": "GRANADILLA DE ABONA",
-                "18": "LA GUANCHA",
-                "19": "GUIA ISORA",
-                "20": "GUIMAR",
-                "21": "HERMIGUA",
-                "22": "ICOD DE LOS VINOS",
-                "23": "LA LAGUNA",
-                "24": "LOS LLANOS DE ARIDANE",
-                "25": "LA MATANZA DE ACENTEJO",
-                "26": "LA OROTAVA",
-                "27": "EL PASO",
-                "28": "PUERTO DE LA CRUZ",
-                "29": "PUNTAGORDA",
-                "30": "PUNTALLANA",
-                "31": "LOS REALEJOS",
-                "32": "EL ROSARIO",
-                "33": "SAN ANDRES Y SAUCES",
-                "34": "SAN JUAN DE LA RAMBLA",
-                "35": "SAN MIGUEL",
-                "36": "SAN SEBASTIAN DE LA GOMERA",
-                "37": "SANTA CRUZ DE LA PALMA",
-                "39": "SANTA URSULA",
-                "40": "SANTIAGO DEL TEIDE",
-                "41": "SAUZAL",
-                "42": "LOS SILOS",
-                "43": "TACORONTE",
-                "44": "TANQUE",
-                "45": "TAZACORTE",
-                "46": "TEGUESTE",
-                "47": "TIJARAFE",
-                "48": "VALVERDE",
-                "49": "VALLE GRAN REY",
-                "50": "VALLEHERMOSO",
-                "51": "LA VICTORIA DE ACENTEJO",
-                "52": "VILAFLOR",
-                "53": "VILLA DE MAZO",
-                "54": "EL PINAR DE EL HIERRO",
-                "900": "SANTA CRUZ TENERIFE",
-            };
-        }
-        else if (provinceCode === 39) {
-            municipalityNames = {
-                "1": "ALFOZ DE LLOREDO",
-                "2": "AMPUERO",
-                "3": "ANIEVAS",
-                "4": "ARENAS DE IGUÑA",
-                "5": "ARGOÑOS",
-                "6": "ARNUERO",
-                "7": "ARREDONDO",
-                "8": "EL ASTILLERO",
-                "9": "BARCENA DE CICERO",
-                "10": "BARCENA DE PIE DE CONCHA",
-                "11": "BAREYO",
-                "12": "CABEZON DE LA SAL",
-                "13": "CABEZON DE LIEBANA",
-                "14": "CABUERNIGA",
-                "15": "CAMALEÑO",
-                "16": "CAMARGO",
-                "17": "CAMPOO DE YUSO",
-                "18": "CARTES",
-                "19": "CASTAÑEDA",
-                "20": "CASTRO URDIALES",
-                "21": "CIEZA",
-                "22": "CILLORIGO DE LIEBANA",
-                "23": "COLINDRES",
-                "24": "COMILLAS",
-                "25": "CORRALES DE BUELNA",
-                "26": "CORVERA DE TORANZO",
-                "27": "CAMPOO DE ENMEDIO",
-                "28": "ENTRAMBASAGUAS",
-                "29": "ESCALANTE",
-                "30": "GURIEZO",
-                "31": "HAZAS DE CESTO",
-                "32": "HERMANDAD DE CAMPOO DE SUSO",
-                "33": "HERRERIAS",
-                "34": "LAMASON",
-                "35": "LAREDO",
-                "36": "LIENDO",
-                "37": "LIERGANES",
-                "38": "LIMPIAS",
-                "39": "LUENA",
-                "40": "MARINA DE CUDEYO",
-                "41": "MAZCUERRAS",
-                "42": "MEDIO CUDEYO",
-                "43": "MERUELO",
-                "44": "MIENGO",
-                "45": "MIERA",
-                "46": "MOLLEDO",
-                "47": "NOJA",
-                "48": "PENAGOS",
-                "49": "PEÑARRUBIA",
-                "50": "PESAGUERO",
-                "51": "PESQUERA",
-                "52": "PIELAGOS",
-                "53": "POLACIONES",
-                "54": "POLANCO",
-                "55": "POTES",
-                "56": "PUENTE VIESGO",
-                "57": "RAMALES DE LA VICTORIA",
-                "58": "RASINES",
-                "59": "REINOSA",
-                "60": "REOCIN",
-                "61": "RIBAMONTAN AL MAR",
-                "62": "RIBAMONTAN AL MONTE",
-                "63": "RIONANSA",
-                "64": "RIOTUERTO",
-                "65": "LAS ROZAS",
-                "66": "RUENTE",
-                "67": "RUESGA",
-                "68": "RUILOBA",
-                "69": "SAN FELICES DE BUELNA",
-                "70": "SAN MIGUEL DE AGUAYO",
-                "71": "SAN PEDRO DEL ROMERAL",
-                "72": "SAN ROQUE DE RIOMIERA",
-                "73": "SANTA CRUZ DE BEZANA",
-                "74": "SANTA MARIA DE CAYON",
-                "76": "SANTILLANA DEL MAR",
-                "77": "SANTIURDE DE REINOSA",
-                "78": "SANTIURDE DE TORANZO",
-                "79": "SANTOÑA",
-                "80": "SAN VICENTE DE LA BARQUERA",
-                "81": "SARO",
-                "82": "SELAYA",
-                "83": "SOBA",
-                "84": "SOLORZANO",
-                "85": "SUANCES",
-                "86": "LOS TOJOS",
-                "87": "TORRELAVEGA",
-                "88": "TRESVISO",
-                "89": "TUDANCA",
-                "90": "UDIAS",
-                "91": "VALDALIGA",
-                "92": "VALDEOLEA",
-                "93": "VALDEPRADO DEL RIO",
-                "94": "VALDERREDIBLE",
-                "95": "VAL DE SAN VICENTE",
-                "96": "VEGA DE LIEBANA",
-                "97": "VEGA DE PAS",
-                "98": "VILLACARRIEDO",
-                "99": "VILLAESCUSA",
-                "100": "VILLAFUFRE",
-                "101": "VALLE DE VILLAVERDE",
-                "102": "VOTO",
-                "103": "COMUNIDAD CAMPOO-CABUERNIGA",
-                "900": "SANTANDER",
-            };
-        }
-        else if (provinceCode === 40) {
-            municipalityNames = {
-                "1": "ABADES",
-                "2": "ADRADA DE PIRON",
-                "3": "ADRADOS",
-                "4": "AGUILAFUENTE",
-                "5": "ALCONADA DE MADERUELO",
-                "6": "ALDEALCORVO",
-                "7": "ALDEALENGUA DE PEDRAZA",
-                "8": "ALDEALENGUA DE SANTA MARIA",
-                "9": "ALDEANUEVA DE LA SERREZUELA",
-                "10": "ALDEANUEVA DEL CODONAL",
-                "12": "ALDEA REAL",
-                "13": "ALDEASOÑA",
-                "14": "ALDEHORNO",
-                "15": "ALDEHUELA DE CODONAL",
-                "17": "ALDEONTE",
-                "18": "ANAYA",
-                "19": "AÑE",
-                "21": "ARAHUETES",
-                "22": "ARCONES",
-                "23": "AREVALILLO DE CEGA",
-                "24": "ARMUÑA",
-                "26": "AYLLON",
-                "28": "BARBOLLA",
-                "29": "BASARDILLA",
-                "31": "BERCIAL",
-                "32": "BERCIMUEL",
-                "33": "BERNARDOS",
-                "35": "BERNUY DE PORREROS",
-                "36": "BOCEGUILLAS",
-                "37": "BRIEVA",
-                "38": "CABALLAR",
-                "39": "CABAÑAS DE POLENDOS",
-                "40": "CABEZUELA",
-                "41": "CALABAZAS",
-                "43": "CAMPO DE SAN PEDRO",
-                "44": "CANTALEJO",
-                "45": "CANTIMPALOS",
-                "47": "CARBONERO EL MAYOR",
-                "48": "CARRASCAL DEL RIO",
-                "50": "CASLA",
-                "51": "CASTILLEJO DE MESLEON",
-                "53": "CASTRO DE FUENTIDUEÑA",
-                "54": "CASTROJIMENO",
-                "55": "CASTROSERNA DE ABAJO",
-                "57": "CASTROSERRACIN",
-                "58": "CEDILLO DE LA TORRE",
-                "59": "CEREZO DE ABAJO",
-                "60": "CEREZO DE ARRIBA",
-                "61": "CILLERUELO DE SAN MAMES",
-                "63": "COBOS DE FUENTIDUEÑA",
-                "65": "COCA",
-                "66": "CODORNIZ",
-                "67": "COLLADO HERMOSO",
-                "68": "CONDADO DE CASTILNOVO",
-                "69": "CORRAL DE AYLLON",
-                "70": "COZUELOS FUENTIDUEÑA",
-                "71": "CUBILLO",
-                "72": "CUELLAR",
-                "74": "CUEVAS PROVA",
-                "75": "CHAÑE",
-                "78": "DOMINGO GARCIA",
-                "79": "DONHIERRO",
-                "81": "DURUELO",
-                "82": "ENCINAS",
-                "83": "ENCINILLAS",
-                "84": "ESCALONA DEL PRADO",
-                "85": "ESCARABAJOSA DE CABEZAS",
-                "86": "ESCOBAR DE POLENDOS",
-                "87": "EL ESPINAR",
-                "88": "ESPIRDO",
-                "91": "FRESNEDA DE CUELLAR",
-                "92": "FRESNO DE CANTESPINO",
-                "93": "FRESNO DE LA FUENTE",
-                "94": "FRUMALES",
-                "95": "FUENTE DE SANTA CRUZ",
-                "96": "FUENTE EL OLMO DE FUENTIDUEÑA",
-                "97": "FUENTE EL OLMO DE ISCAR",
-                "100": "FUENTEPELAYO",
-                "101": "FUENTEPIÑEL",
-                "102": "FUENTERREBOLLO",
-                "103": "FUENTESAUCO DE FUENTIDUEÑA",
-                "105": "FUENTESOTO",
-                "106": "FUENTIDUEÑA",
-                "107": "GALLEGOS",
-                "108": "GARCILLAN",
-                "109": "GOMEZSERRACIN",
-                "111": "GRAJERA",
-                "114": "HONRUBIA DE LA CUESTA",
-                "115": "HONTALBILLA",
-                "116": "HONTANARES DE ERESMA",
-                "119": "LOS HUERTOS",
-                "120": "ITUERO Y LAMA",
-                "122": "JUARROS DE RIOMOROS",
-                "123": "JUARROS DE VOLTOYA",
-                "124": "LABAJOS",
-                "125": "LAGUNA DE CONTRERAS",
-                "127": "LANGUILLA",
-                "128": "LASTRAS DE CUELLAR",
-                "129": "LASTRAS DEL POZO",
-                "130": "LA LASTRILLA",
-                "131": "LA LOSA",
-                "134": "MADERUELO",
-                "137": "MARAZOLEJA",
-                "138": "MARAZUELA",
-                "139": "MARTIN MIGUEL",
-                "140": "MARTIN MUÑOZ DE LA DEHESA",
-                "141": "MARTIN MUÑOZ DE LAS POSADAS",
-                "142": "MARUGAN",
-                "143": "MATABUENA",
-                "144": "MATA DE CUELLAR",
-                "145": "LA MATILLA",
-                "146": "MELQUE",
-                "147": "MEMBIBRE DE LA HOZ",
-                "148": "MIGUELAÑEZ",
-                "150": "MONTEJO DE AREVALO",
-                "151": "MONTEJO DE LA VEGA DE LA SERRE",
-                "152": "MONTERRUBIO",
-                "154": "MORAL DE HORNUEZ",
-                "157": "MOZONCILLO",
-                "158": "MUÑOPEDRO",
-                "159": "MUÑOVEROS",
-                "162": "NAVA DE LA ASUNCION",
-                "163": "NAVAFRIA",
-                "164": "NAVALILLA",
-                "165": "NAVALMANZANO",
-                "166": "NAVARES DE AYUSO",
-                "167": "NAVARES DE ENMEDIO",
-                "168": "NAVARES DE LAS CUEVAS",
-                "169": "NAVAS DE ORO",
-                "170": "NAVAS DE SAN ANTONIO",
-                "172": "NIEVA",
-                "174": "OLOMBRADA",
-                "175": "OREJANA",
-                "176": "ORTIGOSA DEL MONTE",
-                "177": "ORTIGOSA DE PESTAÑO",
-                "178": "OTERO DE HERREROS",
-                "180": "PAJAREJOS",
-                "182": "PALAZUELOS DE ERESMA",
-                "184": "PEDRAZA",
-                "185": "PELAYOS DEL ARROYO",
-                "187": "PEROSILLO",
-                "188": "PINAREJOS",
-                "189": "PINARNEGRILLO",
-                "191": "PRADALES",
-                "192": "PRADENA",
-                "193": "PUEBLA DE PEDRAZA",
-                "194": "RAPARIEGOS",
-                "195": "REBOLLO",
-                "196": "REMONDO",
-                "198": "RIAGUAS DE SAN BARTOLOME",
-                "200": "RIAZA",
-                "201": "RIBOTA",
-                "202": "RIOFRIO DE RIAZA",
-                "203": "RODA DE ERESMA",
-                "204": "SACRAMENIA",
-                "207": "SAMBOAL",
-                "208": "SAN CRISTOBAL DE CUELLAR",
-                "209": "SAN CRISTOBAL DE LA VEGA",
-                "210": "SANCHONUÑO",
-                "211": "SANGARCIA",
-                "212": "REAL SITIO DE SAN ILDEFONSO",
-                "213": "SAN MARTIN Y MUDRIAN",
-                "214": "SAN MIGUEL DE BERNUY",
-                "215": "SAN PEDRO DE GAILLOS",
-                "217": "SANTA MARIA LA REAL DE NIEVA",
-                "218": "SANTA MARTA DEL CERRO",
-                "220": "SANTIUSTE DE PEDRAZA",
-                "221": "SANTIUSTE DE SAN JUAN BAUTISTA",
-                "222": "SANTO DOMINGO DE PIRON",
-                "223": "SANTO TOME DEL PUERTO",
-                "224": "SAUQUILLO DE CABEZAS",
-                "225": "SEBULCOR",
-                "227": "SEPULVEDA",
-                "228": "SEQUERA DE FRESNO",
-                "232": "SOTILLO",
-                "233": "SOTOSALBOS",
-                "234": "TABANERA LA LUENGA",
-                "236": "TOLOCIRIO",
-                "237": "TORREADRADA",
-                "238": "TORRECABALLEROS",
-                "239": "TORRECILLA DEL PINAR",
-                "240": "TORREIGLESIAS",
-                "241": "TORRE VAL DE SAN PEDRO",
-                "242": "TRESCASAS",
-                "243": "TUREGANO",
-                "245": "URUEÑAS",
-                "246": "VALDEPRADOS",
-                "248": "VALDEVACAS DE MONTEJO",
-                "249": "VALDEVACAS Y GUIJAR",
-                "251": "VALSECA",
-                "252": "VALTIENDAS",
-                "253": "VALVERDE DEL MAJANO",
-                "255": "VALLE DE TABLADILLO",
-                "256": "VALLELADO",
-                "257": "VALLERUELA DE PEDRAZA",
-                "258": "VALLERUELA DE SEPULVEDA",
-                "260": "VEGANZONES",
-                "261": "VEGAS DE MATUTE",
-                "262": "VENTOSILLA Y TEJADILLA",
-                "263": "VILLACASTIN",
-                "268": "VILLAVERDE DE ISCAR Y CASTREJO",
-                "269": "VILLAVERDE DE MONTEJO Y VILLAV",
-                "270": "VILLEGUILLO",
-                "272": "YANGUAS DE ERESMA",
-                "274": "ZARZUELA DEL MONTE",
-                "275": "ZARZUELA DEL PINAR",
-                "279": "NAVAS DE RIOFRIO",
-                "280": "SAN CRISTOBAL DE SEGOVIA",
-                "900": "SEGOVIA",
-            };
-        }
-        else if (provinceCode === 41) {
-            municipalityNames = {
-                "1": "AGUADULCE",
-                "2": "ALANIS",
-                "3": "ALBAIDA DEL ALJARAFE",
-                "4": "ALCALA DE GUADAIRA",
-                "5": "ALCALA DEL RIO",
-                "6": "ALCOLEA DEL RIO",
-                "7": "ALGABA",
-                "8": "ALGAMITAS",
-                "9": "ALMADEN DE LA PLATA",
-                "10": "ALMENSILLA",
-                "11": "ARAHAL",
-                "12": "AZNALCAZAR",
-                "13": "AZNALCOLLAR",
-                "14": "BADOLATOSA",
-                "15": "BENACAZON",
-                "16": "BOLLULLOS DE LA MITACION",
-                "17": "BORMUJOS",
-                "18": "BRENES",
-                "19": "BURGUILLOS",
-                "20": "LAS CABEZAS DE SAN JUAN",
-                "21": "CAMAS",
-                "22": "LA CAMPANA",
-                "23": "CANTILLANA",
-                "24": "CARMONA",
-                "25": "CARRION DE LOS CESPEDES",
-                "26": "CASARICHE",
-                "27": "CASTILBLANCO DE LOS ARROYOS",
-                "28": "CASTILLEJA DE GUZMAN",
-                "29": "CASTILLEJA DE LA CUESTA",
-                "30": "CASTILLEJA DEL CAMPO",
-                "31": "EL CASTILLO DE LAS GUARDAS",
-                "32": "CAZALLA DE LA SIERRA",
-                "33": "CONSTANTINA",
-                "34": "CORIA DEL RIO",
-                "35": "CORIPE",
-                "36": "EL CORONIL",
-                "37": "LOS CORRALES",
-                "38": "DOS HERMANAS",
-                "39": "ECIJA",
-                "40": "ESPARTINAS",
-                "41": "ESTEPA",
-                "42": "FUENTES DE ANDALUCIA",
-                "43": "EL GARROBO",
-                "44": "GELVES",
-                "45": "GERENA",
-                "46": "GILENA",
-                "47": "GINES",
-                "48": "GUADALCANAL",
-                "49": "GUILLENA",
-                "50": "HERRERA",
-                "51": "HUEVAR DEL ALJARAFE",
-                "52": "LANTEJUELA",
-                "53": "LEBRIJA",
-                "54": "LORA DE ESTEPA",
-                "55": "LORA DEL RIO",
-                "56": "LA LUISIANA",
-                "57": "EL MADROÑO",
-                "58": "MAIRENA DEL ALCOR",
-                "59": "MAIRENA DEL ALJARAFE",
-                "60": "MARCHENA",
-                "61": "MARINALEDA",
-                "62": "MARTIN DE LA JARA",
-                "63": "LOS MOLARES",
-                "64": "MONTELLANO",
-                "65": "MORON DE LA FRONTERA",
-                "66": "LAS NAVAS DE LA CONCEPCION",
-                "67": "OLIVARES",
-                "68": "OSUNA",
-                "69": "LOS PALACIOS Y VILLAFRANCA",
-                "70": "PALOMARES DEL RIO",
-                "71": "PARADAS",
-                "72": "PEDRERA",
-                "73": "EL PEDROSO",
-                "74": "PEÑAFLOR",
-                "75": "PILAS",
-                "76": "PRUNA",
-                "77": "LA PUEBLA DE CAZALLA",
-                "78": "LA PUEBLA DE LOS INFANTES",
-                "79": "LA PUEBLA DEL RIO",
-                "80": "EL REAL DE LA JARA",
-                "81": "LA RINCONADA",
-                "82": "LA RODA DE ANDALUCIA",
-                "83": "EL RONQUILLO",
-                "84": "EL RUBIO",
-                "85": "SALTERAS",
-                "86": "SAN JUAN DE AZNALFARACHE",
-                "87": "SANLUCAR LA MAYOR",
-                "88": "SAN NICOLAS DEL PUERTO",
-                "89": "SANTIPONCE",
-                "90": "EL SAUCEJO",
-                "92": "TOCINA",
-                "93": "TOMARES",
-                "94": "UMBRETE",
-                "95": "UTRERA",
-                "96": "VALENCINA DE LA CONCEPCION",
-                "97": "VILLAMANRIQUE DE LA CONDESA",
-                "98": "VILLANUEVA DEL ARISCAL",
-                "99": "VILLANUEVA DEL RIO Y MINAS",
-                "100": "VILLANUEVA DE SAN JUAN",
-                "101": "VILLAVERDE DEL RIO",
-                "102": "EL VISO DEL ALCOR",
-                "103": "CAÑADA ROSAL",
-                "104": "ISLA MAYOR",
-                "105": "EL CUERVO DE SEVILLA",
-                "900": "SEVILLA",
-            };
-        }
-        else if (provinceCode === 42) {
-            municipalityNames = {
-                "2": "ABEJAR",
-                "5": "ADRADAS",
-                "6": "AGREDA",
-                "12": "ALCONABA",
-                "14": "ALCUBILLA DE AVELLANEDA",
-                "15": "ALCUBILLA DE LAS PEÑAS",
-                "18": "ALDEALAFUENTE",
-                "19": "ALDEALICES",
-                "20": "ALDEALPOZO",
-                "21": "ALDEALSEÑOR",
-                "24": "ALDEHUELA DE PERIAÑEZ",
-                "25": "LAS ALDEHUELAS",
-                "26": "ALENTISQUE",
-                "27": "ALIUD",
-                "28": "ALMAJANO",
-                "29": "ALMALUEZ",
-                "31": "ALMARZA",
-                "32": "ALMAZAN",
-                "33": "ALMAZUL",
-                "34": "ALMENAR DE SORIA",
-                "35": "ALPANSEQUE",
-                "38": "ARANCON",
-                "39": "ARCOS DE JALON",
-                "40": "ARENILLAS",
-                "41": "AREVALO DE LA SIERRA",
-                "45": "AUSEJO DE LA SIERRA",
-                "47": "BARAHONA",
-                "48": "BARCA",
-                "49": "BARCONES",
-                "51": "BAYUBAS DE ABAJO",
-                "52": "BAYUBAS DE ARRIBA",
-                "55": "BERATON",
-                "56": "BERLANGA DE DUERO",
-                "58": "BLACOS",
-                "59": "BLIECOS",
-                "64": "BORJABAD",
-                "65": "BOROBIA",
-                "68": "BUBEROS",
-                "70": "BUITRAGO",
-                "71": "BURGO DE OSMA-CIUDAD DE OSMA",
-                "72": "CABREJAS DEL CAMPO",
-                "73": "CABREJAS DEL PINAR",
-                "75": "CALATAÑAZOR",
-                "77": "CALTOJAR",
-                "79": "CANDILICHERA",
-                "81": "CAÑAMAQUE",
-                "82": "CARABANTES",
-                "83": "CARACENA",
-                "86": "CARRASCOSA DE ABAJO",
-                "88": "CARRASCOSA DE LA SIERRA",
-                "89": "CASAREJOS",
-                "92": "CASTILFRIO DE LA SIERRA",
-                "93": "CASTILRUIZ",
-                "94": "CASTILLEJO DE ROBLEDO",
-                "95": "CENTENERA DE ANDALUZ",
-                "96": "CERBON",
-                "97": "CIDONES",
-                "98": "CIGUDOSA",
-                "99": "CIHUELA",
-                "100": "CIRIA",
-                "102": "CIRUJALES DEL RIO",
-                "107": "COSCURITA",
-                "108": "COVALEDA",
-                "109": "CUBILLA",
-                "111": "CUBO DE LA SOLANA",
-                "114": "CUEVA DE AGREDA",
-                "120": "DEVANOS",
-                "121": "DEZA",
-                "124": "DURUELO DE LA SIERRA",
-                "125": "ESCOBOSA DE ALMAZAN",
-                "126": "ESPEJA DE SAN MARCELINO",
-                "127": "ESPEJON",
-                "128": "ESTEPA DE SAN JUAN",
-                "132": "FRECHILLA DE ALMAZAN",
-                "133": "FRESNO DE CARACENA",
-                "135": "FUENTEARMEGIL",
-                "137": "FUENTECAMBRON",
-                "139": "FUENTECANTOS",
-                "142": "FUENTELMONJE",
-                "143": "FUENTELSAZ DE SORIA",
-                "144": "FUENTEPINILLA",
-                "146": "FUENTES DE MAGAÑA",
-                "147": "FUENTESTRUN",
-                "150": "GARRAY",
-                "151": "GOLMAYO",
-                "152": "GOMARA",
-                "153": "GORMAZ",
-                "154": "HERRERA DE SORIA",
-                "157": "HINOJOSA DEL CAMPO",
-                "169": "LANGA DE DUERO",
-                "172": "LICERAS",
-                "175": "LOSILLA",
-                "178": "MAGAÑA",
-                "179": "MAJAN",
-                "182": "MATALEBRERAS",
-                "183": "MATAMALA DE ALMAZAN",
-                "187": "MEDINACELI",
-                "190": "MIÑO DE MEDINACELI",
-                "191": "MIÑO DE SAN ESTEBAN",
-                "193": "MOLINOS DE DUERO",
-                "194": "MOMBLONA",
-                "195": "MONTEAGUDO DE LAS VICARIAS",
-                "196": "MONTEJO DE TIERMES",
-                "197": "MONTENEGRO DE CAMEROS",
-                "201": "MORON DE ALMAZAN",
-                "202": "MURIEL DE LA FUENTE",
-                "203": "MURIEL VIEJO",
-                "205": "NAFRIA DE UCERO",
-                "207": "NARROS",
-                "209": "NAVALENO",
-                "210": "NEPAS",
-                "213": "NOLAY",
-                "216": "NOVIERCAS",
-                "219": "OLVEGA",
-                "220": "ONCALA",
-                "228": "PINILLA DEL CAMPO",
-                "232": "PORTILLO DE SORIA",
-                "233": "LA POVEDA DE SORIA",
-                "234": "POZALMURO",
-                "236": "QUINTANA REDONDA",
-                "237": "QUINTANAS DE GORMAZ",
-                "241": "LA QUIÑONERIA",
-                "242": "LOS RABANOS",
-                "244": "REBOLLAR",
-                "246": "RECUERDA",
-                "248": "RELLO",
-                "249": "RENIEBLAS",
-                "250": "RETORTILLO DE SORIA",
-                "252": "REZNOS",
-                "253": "LA RIBA DE ESCALOTE",
-                "254": "RIOSECO DE SORIA",
-                "255": "ROLLAMIENTA",
-                "257": "EL ROYO",
-                "259": "SALDUERO",
-                "263": "SAN ESTEBAN DE GORMAZ",
-                "264": "SAN FELICES",
-                "265": "SAN LEONARDO DE YAGUE",
-                "266": "SAN PEDRO MANRIQUE",
-                "267": "SANTA CRUZ DE YANGUAS",
-                "268": "SANTA MARIA DE HUERTA",
-                "269": "SANTA MARIA DE LAS HOYAS",
-                "274": "SERON DE NAJIMA",
-                "275": "SOLIEDRA",
-                "278": "SOTILLO DEL RINCON",
-                "280": "SUELLACABRAS",
-                "281": "TAJAHUERCE",
-                "282": "TAJUECO",
-                "283": "TALVEILA",
-                "287": "TARDELCUENDE",
-                "289": "TARODA",
-                "290": "TEJADO",
-                "292": "TORLENGUA",
-                "295": "TORREBLACOS",
-                "298": "TORRUBIA DE SORIA",
-                "299": "TREVAGO",
-                "300": "UCERO",
-                "302": "VADILLO",
-                "304": "VALDEAVELLANO DE TERA",
-                "305": "VALDEGEÑA",
-                "306": "VALDELAGUA DEL CERRO",
-                "307": "VALDEMALUQUE",
-                "309": "VALDENEBRO",
-                "310": "VALDEPRADO",
-                "311": "VALDERRODILLA",
-                "313": "VALTAJEROS",
-                "318": "VELAMAZAN",
-                "319": "VELILLA DE LA SIERRA",
-                "320": "VELILLA DE LOS AJOS",
-                "325": "VIANA DE DUERO",
-                "328": "VILLACIERVOS",
-                "330": "VILLANUEVA DE GORMAZ",
-                "331": "VILLAR DEL ALA",
-                "332": "VILLAR DEL CAMPO",
-                "333": "VILLAR DEL RIO",
-                "335": "LOS VILLARES DE SORIA",
-                "337": "VILLASAYAS",
-                "338": "VILLASECA DE ARCIEL",
-                "340": "VINUESA",
-                "341": "VIZMANOS",
-                "342": "VOZMEDIANO",
-                "343": "YANGUAS",
-                "344": "YELO",
-                "900": "SORIA",
-            };
-        }
-        else if (provinceCode === 43) {
-            municipalityNames = {
-                "1": "AIGUAMURCIA",
-                "2": "ALBINYANA",
-                "3": "L'ALBIOL",
-                "4": "ALCANAR",
-                "5": "ALCOVER",
-                "6": "ALDOVER",
-                "7": "L'ALEIXAR",
-                "8": "ALFARA DE CARLES",
-                "9": "ALFORJA",
-                "10": "ALIO",
-                "11": "ALMOSTER",
-                "12": "ALTAFULLA",
-                "13": "L'AMETLLA DE MAR",
-                "14": "AMPOSTA",
-                "15": "ARBOLI",
-                "16": "L'ARBOÇ",
-                "17": "L'ARGENTERA",
-                "18": "ARNES",
-                "19": "ASCO",
-                "20": "BANYERES DEL PENEDES",
-                "21": "BARBERA DE LA CONCA",
-                "22": "BATEA",
-                "23": "BELLMUNT DEL PRIORAT",
-                "24": "BELLVEI",
-                "25": "BENIFALLET",
-                "26": "BENISSANET",
-                "27": "LA BISBAL DE FALSET",
-                "28": "LA BISBAL DEL PENEDES",
-                "29": "BLANCAFORT",
-                "30": "BONASTRE",
-                "31": "LES BORGES DEL CAMP",
-                "32": "BOT",
-                "33": "BOTARELL",
-                "34": "BRAFIM",
-                "35": "CABACES",
-                "36": "CABRA DEL CAMP",
-                "37": "CALAFELL",
-                "38": "CAMBRILS",
-                "39": "LA CANONJA",
-                "40": "CAPAFONTS",
-                "41": "CAPÇANES",
-                "42": "CASERES",
-                "43": "CASTELLVELL DEL CAMP",
-                "44": "EL CATLLAR",
-                "45": "LA SENIA",
-                "46": "COLLDEJOU",
-                "47": "CONESA",
-                "48": "CONSTANTI",
-                "49": "CORBERA D'EBRE",
-                "50": "CORNUDELLA DE MONTSANT",
-                "51": "CREIXELL",
-                "52": "CUNIT",
-                "53": "XERTA",
-                "54": "DUESAIGUES",
-                "55": "L'ESPLUGA",
-                "56": "FALSET",
-                "57": "LA FATARELLA",
-                "58": "LA FEBRO",
-                "59": "LA FIGUERA",
-                "60": "FIGUEROLA DEL CAMP",
-                "61": "FLIX",
-                "62": "FORES",
-                "63": "FREGINALS",
-                "64": "LA GALERA",
-                "65": "GANDESA",
-                "66": "GARCIA",
-                "67": "ELS GARIDELLS",
-                "68": "GINESTAR",
-                "69": "GODALL",
-                "70": "GRATALLOPS",
-                "71": "ELS GUIAMETS",
-                "72": "HORTA DE SANT JOAN",
-                "73": "EL LLOAR",
-                "74": "LLORAC",
-                "75": "LLORENÇ DEL PENEDES",
-                "76": "MARGALEF",
-                "77": "MARÇA",
-                "78": "MAS DE BARBERANS",
-                "79": "MASDENVERGE",
-                "80": "MASLLORENÇ",
-                "81": "LA MASO",
-                "82": "MASPUJOLS",
-                "83": "EL MASROIG",
-                "84": "EL MILA",
-                "85": "MIRAVET",
-                "86": "EL MOLAR",
-                "87": "MONTBLANC",
-                "89": "MONTBRIO DEL CAMP",
-                "90": "MONTFERRI",
-                "91": "EL MONTMELL",
-                "92": "MONT-RAL",
-                "93": "MONT-ROIG DEL CAMP",
-                "94": "MORA D'EBRE",
-                "95": "MORA LA NOVA",
-                "96": "EL MORELL",
-                "97": "LA MORERA DE MONTSANT",
-                "99": "LA NOU DE GAIA",
-                "100": "NULLES",
-                "101": "LA PALMA D'EBRE",
-                "102": "PALLARESOS ELS",
-                "103": "PASSANANT I BELLTALL",
-                "104": "PAULS",
-                "105": "PERAFORT",
-                "106": "EL PERELLO",
-                "107": "LES PILES",
-                "108": "EL PINELL DE BRAI",
-                "109": "PIRA",
-                "110": "EL PLA DE SANTA MARIA",
-                "111": "LA POBLA DE MAFUMET",
-                "112": "LA POBLA DE MASSALUCA",
-                "113": "LA POBLA DE MONTORNES",
-                "114": "POBOLEDA",
-                "115": "EL PONT D'ARMENTERA",
-                "116": "PORRERA",
-                "117": "PRADELL DE LA TEIXETA",
-                "118": "PRADES",
-                "119": "PRAT DE COMTE",
-                "120": "PRATDIP",
-                "121": "PUIGPELAT",
-                "122": "QUEROL",
-                "123": "RASQUERA",
-                "124": "RENAU",
-                "125": "REUS",
-                "126": "LA RIBA",
-                "127": "RIBA-ROJA D'EBRE",
-                "128": "LA RIERA DE GAIA",
-                "129": "RIUDECANYES",
-                "130": "RIUDECOLS",
-                "131": "RIUDOMS",
-                "132": "ROCAFORT DE QUERALT",
-                "133": "RODA DE BERA",
-                "134": "RODONYA",
-                "135": "ROQUETES",
-                "136": "EL ROURELL",
-                "137": "SALOMO",
-                "138": "SANT CARLES DE LA RAPITA",
-                "139": "SANT JAUME DELS DOMENYS",
-                "140": "SANTA BARBARA",
-                "141": "SANTA COLOMA DE QUERALT",
-                "142": "SANTA OLIVA",
-                "143": "PONTILS",
-                "144": "SARRAL",
-                "145": "SAVALLA DEL COMTAT",
-                "146": "LA SECUITA",
-                "147": "LA SELVA DEL CAMP",
-                "148": "SENAN",
-                "149": "SOLIVELLA",
-                "151": "TIVENYS",
-                "152": "TIVISSA",
-                "153": "LA TORRE DE FONTAUBELLA",
-                "154": "LA TORRE DE L'ESPANYOL",
-                "155": "TORREDEMBARRA",
-                "156": "TORROJA DEL PRIORAT",
-                "157": "TORTOSA",
-                "158": "ULLDECONA",
-                "159": "ULLDEMOLINS",
-                "160": "VALLCLARA",
-                "161": "VALLFOGONA DE RIUCORB",
-                "162": "VALLMOLL",
-                "163": "VALLS",
-                "164": "VANDELLOS-L'HOSPITALET DE L'IN",
-                "165": "EL VENDRELL",
-                "166": "VESPELLA DE GAIA",
-                "167": "VILABELLA",
-                "168": "VILALLONGA DEL CAMP",
-                "169": "VILANOVA D'ESCORNALBOU",
-                "170": "VILANOVA DE PRADES",
-                "171": "VILAPLANA",
-                "172": "VILA-RODONA",
-                "173": "VILA-SECA",
-                "174": "VILAVERD",
-                "175": "LA VILELLA ALTA",
-                "176": "LA VILELLA BAIXA",
-                "177": "VILALBA DELS ARCS",
-                "178": "VIMBODI I POBLET",
-                "179": "VINEBRE",
-                "180": "VINYOLS I ELS ARCS",
-                "181": "DELTEBRE",
-                "182": "SANT JAUME D'ENVEJA",
-                "183": "CAMARLES",
-                "184": "L'ALDEA",
-                "185": "SALOU",
-                "186": "L'AMPOLLA",
-                "900": "TARRAGONA",
-            };
-        }
-        else if (provinceCode === 44) {
-            municipalityNames = {
-                "1": "ABABUJ",
-                "2": "ABEJUELA",
-                "3": "AGUATON",
-                "4": "AGUAVIVA",
-                "5": "AGUILAR DEL ALFAMBRA",
-                "6": "ALACON",
-                "7": "ALBA DEL CAMPO",
-                "8": "ALBALATE DEL ARZOBISPO",
-                "9": "ALBARRACIN",
-                "10": "ALBENTOSA",
-                "11": "ALCAINE",
-                "12": "ALCALA DE LA SELVA",
-                "13": "ALCAÑIZ",
-                "14": "ALCORISA",
-                "16": "ALFAMBRA",
-                "17": "ALIAGA",
-                "18": "ALMOHAJA",
-                "19": "ALOBRAS",
-                "20": "ALPEÑES",
-                "21": "ALLEPUZ",
-                "22": "ALLOZA",
-                "23": "ALLUEVA",
-                "24": "ANADON",
-                "25": "ANDORRA",
-                "26": "ARCOS DE LAS SALINAS",
-                "27": "ARENS DE LLEDO",
-                "28": "ARGENTE",
-                "29": "ARIÑO",
-                "31": "AZAILA",
-                "32": "BADENAS",
-                "33": "BAGUENA",
-                "34": "BAÑON",
-                "35": "BARRACHINA",
-                "36": "BEA",
-                "37": "BECEITE",
-                "38": "BELMONTE SAN JOSE",
-                "39": "BELLO",
-                "40": "BERGE",
-                "41": "BEZAS",
-                "42": "BLANCAS",
-                "43": "BLESA",
-                "44": "BORDON",
-                "45": "BRONCHALES",
-                "46": "BUEÑA",
-                "47": "BURBAGUENA",
-                "48": "CABRA DE MORA",
-                "49": "CALACEITE",
-                "50": "CALAMOCHA",
-                "51": "CALANDA",
-                "52": "CALOMARDE",
-                "53": "CAMAÑAS",
-                "54": "CAMARENA DE LA SIERRA",
-                "55": "CAMARILLAS",
-                "56": "CAMINREAL",
-                "59": "CANTAVIEJA",
-                "60": "CAÑADA DE BENATANDUZ",
-                "61": "LA CAÑADA DE VERICH",
-                "62": "CAÑADA VELLIDA",
-                "63": "CAÑIZAR DEL OLIVAR",
-                "64": "CASCANTE DEL RIO",
-                "65": "CASTEJON DE TORNOS",
-                "66": "CASTEL DE CABRA",
-                "67": "CASTELNOU",
-                "68": "CASTELSERAS",
-                "70": "EL CASTELLAR",
-                "71": "CASTELLOTE",
-                "74": "CEDRILLAS",
-                "75": "CELADAS",
-                "76": "CELLA",
-                "77": "LA CEROLLERA",
-                "81": "LA CODOÑERA",
-                "84": "CORBALAN",
-                "86": "CORTES DE ARAGON",
-                "87": "COSA",
-                "88": "CRETAS",
-                "89": "CRIVILLEN",
-                "90": "LA CUBA",
-                "91": "CUBLA",
-                "92": "CUCALON",
-                "94": "EL CUERVO",
-                "95": "CUEVAS DE ALMUDEN",
-                "98": "CUEVAS LABRADAS",
-                "101": "EJULVE",
-                "102": "ESCORIHUELA",
-                "104": "ESCUCHA",
-                "105": "ESTERCUEL",
-                "106": "FERRERUELA DE HUERVA",
-                "107": "FONFRIA",
-                "108": "FORMICHE ALTO",
-                "110": "FORNOLES",
-                "111": "FORTANETE",
-                "112": "FOZ CALANDA",
-                "113": "LA FRESNEDA",
-                "114": "FRIAS DE ALBARRACIN",
-                "115": "FUENFERRADA",
-                "116": "FUENTES CALIENTES",
-                "117": "FUENTES CLARAS",
-                "118": "FUENTES DE RUBIELOS",
-                "119": "FUENTESPALDA",
-                "120": "GALVE",
-                "121": "GARGALLO",
-                "122": "GEA DE ALBARRACIN",
-                "123": "LA GINEBROSA",
-                "125": "GRIEGOS",
-                "126": "GUADALAVIAR",
-                "127": "GUDAR",
-                "128": "HIJAR",
-                "129": "HINOJOSA DE JARQUE",
-                "130": "LA HOZ DE LA VIEJA",
-                "131": "HUESA DEL COMUN",
-                "132": "LA IGLESUELA DEL CID",
-                "133": "JABALOYAS",
-                "134": "JARQUE DE LA VAL",
-                "135": "JATIEL",
-                "136": "JORCAS",
-                "137": "JOSA",
-                "139": "LAGUERUELA",
-                "140": "LANZUELA",
-                "142": "LIBROS",
-                "143": "LIDON",
-                "144": "LINARES DE MORA",
-                "145": "LOSCOS",
-                "148": "LLEDO",
-                "149": "MAICAS",
-                "150": "MANZANERA",
-                "151": "MARTIN DEL RIO",
-                "152": "MAS DE LAS MATAS",
-                "153": "LA MATA DE LOS OLMOS",
-                "154": "MAZALEON",
-                "155": "MEZQUITA DE JARQUE",
-                "157": "MIRAMBEL",
-                "158": "MIRAVETE DE LA SIERRA",
-                "159": "MOLINOS",
-                "160": "MONFORTE DE MOYUELA",
-                "161": "MONREAL DEL CAMPO",
-                "162": "MONROYO",
-                "163": "MONTALBAN",
-                "164": "MONTEAGUDO DEL CASTILLO",
-                "165": "MONTERDE DE ALBARRACIN",
-                "167": "MORA DE RUBIELOS",
-                "168": "MOSCARDON",
-                "169": "MOSQUERUELA",
-                "170": "MUNIESA",
-                "172": "NOGUERA",
-                "173": "NOGUERAS",
-                "174": "NOGUERUELAS",
-                "176": "OBON",
-                "177": "ODON",
-                "178": "OJOS NEGROS",
-                "180": "OLBA",
-                "181": "OLIETE",
-                "182": "LOS OLMOS",
-                "183": "ORIHUELA DEL TREMEDAL",
-                "184": "ORRIOS",
-                "185": "PALOMAR DE ARROYOS",
-                "186": "PANCRUDO",
-                "187": "LAS PARRAS DE CASTELLOTE",
-                "189": "PEÑARROYA DE TASTAVINS",
-                "190": "PERACENSE",
-                "191": "PERALEJOS",
-                "192": "PERALES DEL ALFAMBRA",
-                "194": "PITARQUE",
-                "195": "PLOU",
-                "196": "EL POBO",
-                "198": "LA PORTELLADA",
-                "200": "POZONDON",
-                "201": "POZUEL DEL CAMPO",
-                "202": "LA PUEBLA DE HIJAR",
-                "203": "LA PUEBLA DE VALVERDE",
-                "204": "PUERTOMINGALVO",
-                "205": "RAFALES",
-                "207": "RILLO",
-                "208": "RIODEVA",
-                "209": "RODENAS",
-                "210": "ROYUELA",
-                "211": "RUBIALES",
-                "212": "RUBIELOS DE LA CERIDA",
-                "213": "RUBIELOS DE MORA",
-                "215": "SALCEDILLO",
-                "216": "SALDON",
-                "217": "SAMPER DE CALANDA",
-                "218": "SAN AGUSTIN",
-                "219": "SAN MARTIN DEL RIO",
-                "220": "SANTA CRUZ DE NOGUERAS",
-                "221": "SANTA EULALIA DEL CAMPO",
-                "223": "SARRION",
-                "224": "SEGURA DE LOS BAÑOS",
-                "225": "SENO",
-                "226": "SINGRA",
-                "228": "TERRIENTE",
-                "230": "TORIL Y MASEGOSO",
-                "231": "TORMON",
-                "232": "TORNOS",
-                "233": "TORRALBA DE LOS SISONES",
-                "234": "TORRECILLA DE ALCAÑIZ",
-                "235": "TORRECILLA DEL REBOLLAR",
-                "236": "TORRE DE ARCAS",
-                "237": "TORRE DE LAS ARCAS",
-                "238": "TORRE DEL COMPTE",
-                "239": "TORRELACARCEL",
-                "240": "TORRE LOS NEGROS",
-                "241": "TORREMOCHA DE JILOCA",
-                "242": "TORRES DE ALBARRACIN",
-                "243": "TORREVELILLA",
-                "244": "TORRIJAS",
-                "245": "TORRIJO DEL CAMPO",
-                "247": "TRAMACASTIEL",
-                "248": "TRAMACASTILLA",
-                "249": "TRONCHON",
-                "250": "URREA DE GAEN",
-                "251": "UTRILLAS",
-                "252": "VALACLOCHE",
-                "253": "VALBONA",
-                "254": "VALDEALGORFA",
-                "257": "VALDECUENCA",
-                "258": "VALDELINARES",
-                "259": "VALDELTORMO",
-                "260": "VALDERROBRES",
-                "261": "VALJUNQUERA",
-                "263": "EL VALLECILLO",
-                "264": "VEGUILLAS DE LA SIERRA",
-                "265": "VILLAFRANCA DEL CAMPO",
-                "266": "VILLAHERMOSA DEL CAMPO",
-                "270": "VILLANUEVA DEL REBOLLAR",
-                "271": "VILLAR DEL COBO",
-                "272": "VILLAR DEL SALZ",
-                "274": "VILLARLUENGO",
-                "275": "VILLARQUEMADO",
-                "276": "VILLARROYA DE LOS PINARES",
-                "277": "VILLASTAR",
-                "278": "VILLEL",
-                "279": "VINACEITE",
-                "280": "VISIEDO",
-                "281": "VIVEL DEL RIO MARTIN",
-                "282": "LA ZOMA",
-                "900": "TERUEL",
-            };
-        }
-        else if (provinceCode === 45) {
-            municipalityNames = {
-                "1": "AJOFRIN",
-                "2": "ALAMEDA DE LA SAGRA",
-                "3": "ALBARREAL DE TAJO",
-                "4": "ALCABON",
-                "5": "ALCAÑIZO",
-                "6": "ALCAUDETE DE LA JARA",
-                "7": "ALCOLEA DE TAJO",
-                "8": "ALDEAEN CABO",
-                "9": "ALDEANUEVA DE BARBARROYA",
-                "10": "ALDEANUEVA DE SAN BARTOLOME",
-                "11": "ALMENDRAL DE LA CAÑADA",
-                "12": "ALMONACID DE TOLEDO",
-                "13": "ALMOROX",
-                "14": "AÑOVER DE TAJO",
-                "15": "ARCICOLLAR",
-                "16": "ARGES",
-                "17": "AZUTAN",
-                "18": "BARCIENCE",
-                "19": "BARGAS",
-                "20": "BELVIS DE LA JARA",
-                "21": "BOROX",
-                "22": "BUENAVENTURA",
-                "23": "BURGUILLOS DE TOLEDO",
-                "24": "BURUJON",
-                "25": "CABAÑAS DE LA SAGRA",
-                "26": "CABAÑAS DE YEPES",
-                "27": "CABEZAMESADA",
-                "28": "CALERA Y CHOZAS",
-                "29": "CALERUELA",
-                "30": "LA CALZADA DE OROPESA",
-                "31": "CAMARENA",
-                "32": "CAMARENILLA",
-                "33": "EL CAMPILLO DE LA JARA",
-                "34": "CAMUÑAS",
-                "35": "CARDIEL DE LOS MONTES",
-                "36": "CARMENA",
-                "37": "EL CARPIO DE TAJO",
-                "38": "CARRANQUE",
-                "39": "CARRICHES",
-                "40": "EL CASAR DE ESCALONA",
-                "41": "CASARRUBIOS DEL MONTE",
-                "42": "CASASBUENAS",
-                "43": "CASTILLO DE BAYUELA",
-                "45": "CAZALEGAS",
-                "46": "CEBOLLA",
-                "47": "CEDILLO DEL CONDADO",
-                "48": "LOS CERRALBOS",
-                "49": "CERVERA DE LOS MONTES",
-                "50": "CIRUELOS",
-                "51": "COBEJA",
-                "52": "COBISA",
-                "53": "CONSUEGRA",
-                "54": "CORRAL DE ALMAGUER",
-                "55": "CUERVA",
-                "56": "CHOZAS DE CANALES",
-                "57": "CHUECA",
-                "58": "DOMINGO PEREZ",
-                "59": "DOSBARRIOS",
-                "60": "ERUSTES",
-                "61": "ESCALONA",
-                "62": "ESCALONILLA",
-                "63": "ESPINOSO DEL REY",
-                "64": "ESQUIVIAS",
-                "65": "LA ESTRELLA",
-                "66": "FUENSALIDA",
-                "67": "GALVEZ",
-                "69": "GARCIOTUM",
-                "70": "GERINDOTE",
-                "71": "GUADAMUR",
-                "72": "LA GUARDIA",
-                "73": "LAS HERENCIAS",
-                "74": "HERRERUELA DE OROPESA",
-                "75": "HINOJOSA DE SAN VICENTE",
-                "76": "HONTANAR",
-                "77": "HORMIGOS",
-                "78": "HUECAS",
-                "79": "HUERTA DE VALDECARABANOS",
-                "80": "LA IGLESUELA",
-                "81": "ILLAN DE VACAS",
-                "82": "ILLESCAS",
-                "83": "LAGARTERA",
-                "84": "LAYOS",
-                "85": "LILLO",
-                "86": "LOMINCHAR",
-                "87": "LUCILLOS",
-                "88": "MADRIDEJOS",
-                "89": "MAGAN",
-                "90": "MALPICA DE TAJO",
-                "91": "MANZANEQUE",
-                "92": "MAQUEDA",
-                "93": "MARJALIZA",
-                "94": "MARRUPE",
-                "95": "MASCARAQUE",
-                "96": "LA MATA",
-                "97": "MAZARAMBROZ",
-                "98": "MEJORADA",
-                "99": "MENASALBAS",
-                "100": "MENTRIDA",
-                "101": "MESEGAR DE TAJO",
-                "102": "MIGUEL ESTEBAN",
-                "103": "MOCEJON",
-                "104": "MOHEDAS DE LA JARA",
-                "105": "MONTEARAGON",
-                "106": "MONTESCLAROS",
-                "107": "MORA",
-                "108": "NAMBROCA",
-                "109": "LA NAVA DE RICOMALILLO",
-                "110": "NAVAHERMOSA",
-                "111": "NAVALCAN",
-                "112": "NAVALMORALEJO",
-                "113": "LOS NAVALMORALES",
-                "114": "LOS NAVALUCILLOS",
-                "115": "NAVAMORCUENDE",
-                "116": "NOBLEJAS",
-                "117": "NOEZ",
-                "118": "NOMBELA",
-                "119": "NOVES",
-                "120": "NUMANCIA DE LA SAGRA",
-                "121": "NUÑO GOMEZ",
-                "122": "OCAÑA",
-                "123": "OLIAS DEL REY",
-                "124": "ONTIGOLA",
-                "125": "ORGAZ",
-                "126": "OROPESA",
-                "127": "OTERO",
-                "128": "PALOMEQUE",
-                "129": "PANTOJA",
-                "130": "PAREDES DE ESCALONA",
-                "131": "PARRILLAS",
-                "132": "PELAHUSTAN",
-                "133": "PEPINO",
-                "134": "POLAN",
-                "135": "PORTILLO DE TOLEDO",
-                "136": "LA PUEBLA DE ALMORADIEL",
-                "137": "LA PUEBLA DE MONTALBAN",
-                "138": "LA PUEBLANUEVA",
-                "139": "EL PUENTE DEL ARZOBISPO",
-                "140": "PUERTO DE SAN VICENTE",
-                "141": "PULGAR",
-                "142": "QUERO",
-                "143": "QUINTANAR DE LA ORDEN",
-                "144": "QUISMONDO",
-                "145": "EL REAL DE SAN VICENTE",
-                "146": "RECAS",
-                "147": "RETAMOSO",
-                "148": "RIELVES",
-                "149": "ROBLEDO DEL MAZO",
-                "150": "EL ROMERAL",
-                "151": "SAN BARTOLOME DE LAS ABIERTAS",
-                "152": "SAN MARTIN DE MONTALBAN",
-                "153": "SAN MARTIN DE PUSA",
-                "154": "SAN PABLO DE LOS MONTES",
-                "155": "SAN ROMAN DE LOS MONTES",
-                "156": "SANTA ANA DE PUSA",
-                "157": "SANTA CRUZ DE LA ZARZA",
-                "158": "SANTA CRUZ DEL RETAMAR",
-                "159": "SANTA OLALLA",
-                "160": "SARTAJADA",
-                "161": "SEGURILLA",
-                "162": "SESEÑA",
-                "163": "SEVILLEJA DE LA JARA",
-                "164": "SONSECA",
-                "165": "SOTILLO DE LAS PALOMAS",
-                "166": "TALAVERA DE LA REINA",
-                "167": "TEMBLEQUE",
-                "168": "EL TOBOSO",
-                "170": "TORRALBA DE OROPESA",
-                "171": "TORRECILLA DE LA JARA",
-                "172": "LA TORRE DE ESTEBAN HAMBRAN",
-                "173": "TORRICO",
-                "174": "TORRIJOS",
-                "175": "TOTANES",
-                "176": "TURLEQUE",
-                "177": "UGENA",
-                "178": "URDA",
-                "179": "SANTO DOMINGO-CAUDILLA",
-                "180": "VALDEVERDEJA",
-                "181": "VALMOJADO",
-                "182": "VELADA",
-                "183": "LAS VENTAS CON PEÑA AGUILERA",
-                "184": "LAS VENTAS DE RETAMOSA",
-                "185": "LAS VENTAS DE SAN JULIAN",
-                "186": "VILLACAÑAS",
-                "187": "LA VILLA DE DON FADRIQUE",
-                "188": "VILLAFRANCA DE LOS CABALLEROS",
-                "189": "VILLALUENGA DE LA SAGRA",
-                "190": "VILLAMIEL DE TOLEDO",
-                "191": "VILLAMINAYA",
-                "192": "VILLAMUELAS",
-                "193": "VILLANUEVA DE ALCARDETE",
-                "194": "VILLANUEVA DE BOGAS",
-                "195": "VILLAREJO DE MONTALBAN",
-                "196": "VILLARRUBIA DE SANTIAGO",
-                "197": "VILLASECA DE LA SAGRA",
-                "198": "VILLASEQUILLA",
-                "199": "VILLATOBAS",
-                "200": "EL VISO DE SAN JUAN",
-                "201": "LOS YEBENES",
-                "202": "YELES",
-                "203": "YEPES",
-                "204": "YUNCLER",
-                "205": "YUNCLILLOS",
-                "206": "YUNCOS",
-                "900": "TOLEDO",
-            };
-        }
-        else if (provinceCode === 46) {
-            municipalityNames = {
-                "1": "ADEMUZ",
-                "2": "ADOR",
-                "3": "ATZENETA D'ALBAIDA",
-                "4": "AGULLENT",
-                "5": "ALAQUAS",
-                "6": "ALBAIDA",
-                "7": "ALBAL",
-                "8": "ALBALAT DE LA RIBERA",
-                "9": "ALBALAT DELS SORELLS",
-                "10": "ALBALAT DELS TARONGERS",
-                "11": "ALBERIC",
-                "12": "ALBORACHE",
-                "13": "ALBORAYA",
-                "14": "ALBUIXECH",
-                "15": "ALCASSER",
-                "16": "ALCANTERA DE XUQUER",
-                "17": "ALZIRA",
-                "18": "ALCUBLAS",
-                "19": "L'ALCUDIA",
-                "20": "L'ALCUDIA DE CRESPINS",
-                "21": "ALDAIA",
-                "22": "ALFAFAR",
-                "23": "ALFAUIR",
-                "24": "ALFARA DE LA BARONIA",
-                "25": "ALFARA DEL PATRIARCA",
-                "26": "ALFARP",
-                "27": "ALFARRASI",
-                "28": "ALGAR DE PALANCIA",
-                "29": "ALGEMESI",
-                "30": "ALGIMIA DE ALFARA",
-                "31": "ALGINET",
-                "32": "ALMASSERA",
-                "33": "ALMISERA",
-                "34": "ALMOINES",
-                "35": "ALMUSSAFES",
-                "36": "ALPUENTE",
-                "37": "L'ALQUERIA DE LA COMTESSA",
-                "38": "ANDILLA",
-                "39": "ANNA",
-                "40": "ANTELLA",
-                "41": "ARAS DE LOS OLMOS",
-                "42": "AIELO DE MALFERIT",
-                "43": "AIELO DE RUGAT",
-                "44": "AYORA",
-                "45": "BARXETA",
-                "46": "BARX",
-                "47": "BELGIDA",
-                "48": "BELLREGUARD",
-                "49": "BELLUS",
-                "50": "BENAGEBER",
-                "51": "BENAGUASIL",
-                "52": "BENAVITES",
-                "53": "BENEIXIDA",
-                "54": "BENETUSSER",
-                "55": "BENIARJO",
-                "56": "BENIATJAR",
-                "57": "BENICOLET",
-                "58": "BENIFAIRO DE LES VALLS",
-                "59": "BENIFAIRO DE LA VALLDIGNA",
-                "60": "BENIFAIO",
-                "61": "BENIFLA",
-                "62": "BENIGANIM",
-                "63": "BENIMODO",
-                "64": "BENIMUSLEM",
-                "66": "BENIPARRELL",
-                "68": "BENIRREDRA",
-                "69": "BENISANO",
-                "70": "BENISSODA",
-                "71": "BENISUERA",
-                "72": "BETERA",
-                "73": "BICORP",
-                "74": "BOCAIRENT",
-                "75": "BOLBAITE",
-                "76": "BONREPOS I MIRAMBELL",
-                "77": "BUFALI",
-                "78": "BUGARRA",
-                "79": "BUÑOL",
-                "80": "BURJASSOT",
-                "81": "CALLES",
-                "82": "CAMPORROBLES",
-                "83": "CANALS",
-                "84": "CANET D'EN BERENGUER",
-                "85": "CARCAIXENT",
-                "86": "CARCER",
-                "87": "CARLET",
-                "88": "CARRICOLA",
-                "89": "CASAS ALTAS",
-                "90": "CASAS BAJAS",
-                "91": "CASINOS",
-                "92": "CASTELLO DE RUGAT",
-                "93": "CASTELLONET DE LA CONQUESTA",
-                "94": "CASTIELFABIB",
-                "95": "CATADAU",
-                "96": "CATARROJA",
-                "97": "CAUDETE DE LAS FUENTES",
-                "98": "CERDA",
-                "99": "COFRENTES",
-                "100": "CORBERA",
-                "101": "CORTES DE PALLAS",
-                "102": "COTES",
-                "103": "QUART DE LES VALLS",
-                "104": "QUART DE POBLET",
-                "105": "QUARTELL",
-                "106": "QUATRETONDA",
-                "107": "CULLERA",
-                "108": "CHELVA",
-                "109": "CHELLA",
-                "110": "CHERA",
-                "111": "CHESTE",
-                "112": "XIRIVELLA",
-                "113": "CHIVA",
-                "114": "CHULILLA",
-                "115": "DAIMUS",
-                "116": "DOMEÑO",
-                "117": "DOS AGUAS",
-                "118": "L'ELIANA",
-                "119": "EMPERADOR",
-                "120": "ENGUERA",
-                "121": "L'ENOVA",
-                "122": "ESTIVELLA",
-                "123": "ESTUBENY",
-                "124": "FAURA",
-                "125": "FAVARA",
-                "126": "FONTANARS DELS ALFORINS",
-                "127": "FORTALENY",
-                "128": "FOIOS",
-                "129": "LA FONT D'EN CARROS",
-                "130": "LA FONT DE LA FIGUERA",
-                "131": "FUENTERROBLES",
-                "132": "GAVARDA",
-                "133": "GANDIA",
-                "134": "GENOVES",
-                "135": "GESTALGAR",
-                "136": "GILET",
-                "137": "GODELLA",
-                "138": "GODELLETA",
-                "139": "LA GRANJA DE LA COSTERA",
-                "140": "GUADASSEQUIES",
-                "141": "GUADASSUAR",
-                "142": "GUARDAMAR DE LA SAFOR",
-                "143": "HIGUERUELAS",
-                "144": "JALANCE",
-                "145": "XERACO",
-                "146": "JARAFUEL",
-                "147": "XATIVA",
-                "148": "XERESA",
-                "149": "LLIRIA",
-                "150": "LORIGUILLA",
-                "151": "LOSA DEL OBISPO",
-                "152": "LLUTXENT",
-                "153": "LLOCNOU D'EN FENOLLET",
-                "154": "LLOCNOU DE LA CORONA",
-                "155": "LLOCNOU DE SANT JERONI",
-                "156": "LLANERA DE RANES",
-                "157": "LLAURI",
-                "158": "LLOMBAI",
-                "159": "LA LLOSA DE RANES",
-                "160": "MACASTRE",
-                "161": "MANISES",
-                "162": "MANUEL",
-                "163": "MARINES",
-                "164": "MASSALAVES",
-                "165": "MASSALFASSAR",
-                "166": "MASSAMAGRELL",
-                "167": "MASSANASSA",
-                "168": "MELIANA",
-                "169": "MILLARES",
-                "170": "MIRAMAR",
-                "171": "MISLATA",
-                "172": "MOIXENT / MOGENTE",
-                "173": "MONCADA",
-                "174": "MONTSERRAT",
-                "175": "MONTAVERNER",
-                "176": "MONTESA",
-                "177": "MONTITXELVO/MONTICHELVO",
-                "178": "MONTROI/MONTROY",
-                "179": "MUSEROS",
-                "180": "NAQUERA",
-                "181": "NAVARRES",
-                "182": "NOVELE / NOVETLE",
-                "183": "OLIVA",
-                "184": "OLOCAU",
-                "185": "L'OLLERIA",
-                "186": "ONTINYENT",
-                "187": "OTOS",
-                "188": "PAIPORTA",
-                "189": "PALMA DE GANDIA",
-                "190": "PALMERA",
-                "191": "EL PALOMAR",
-                "192": "PATERNA",
-                "193": "PEDRALBA",
-                "194": "PETRES",
-                "195": "PICANYA",
-                "196": "PICASSENT",
-                "197": "PILES",
-                "198": "PINET",
-                "199": "POLINYA DE XUQUER",
-                "200": "POTRIES",
-                "201": "LA POBLA DE FARNALS",
-                "202": "LA POBLA DEL DUC",
-                "203": "PUEBLA DE SAN MIGUEL",
-                "204": "LA POBLA DE VALLBONA",
-                "205": "LA POBLA LLARGA",
-                "206": "EL PUIG DE SANTA MARIA",
-                "207": "PUÇOL",
-                "208": "QUESA",
-                "209": "RAFELBUNYOL",
-                "210": "RAFELCOFER",
-                "211": "RAFELGUARAF",
-                "212": "RAFOL DE SALEM",
-                "213": "REAL DE GANDIA",
-                "214": "REAL",
-                "215": "REQUENA",
-                "216": "RIBA-ROJA DE TURIA",
-                "217": "RIOLA",
-                "218": "ROCAFORT",
-                "219": "ROTGLA I CORBERA",
-                "220": "ROTOVA",
-                "221": "RUGAT",
-                "222": "SAGUNTO / SAGUNT",
-                "223": "SALEM",
-                "224": "SANT JOANET",
-                "225": "SEDAVI",
-                "226": "SEGART",
-                "227": "SELLENT",
-                "228": "SEMPERE",
-                "229": "SENYERA",
-                "230": "SERRA",
-                "231": "SIETE AGUAS",
-                "232": "SILLA",
-                "233": "SIMAT DE LA VALLDIGNA",
-                "234": "SINARCAS",
-                "235": "SOLLANA",
-                "236": "SOT DE CHERA",
-                "237": "SUECA",
-                "238": "SUMACARCER",
-                "239": "TAVERNES BLANQUES",
-                "240": "TAVERNES DE LA VALLDIGNA",
-                "241": "TERESA DE COFRENTES",
-                "242": "TERRATEIG",
-                "243": "TITAGUAS",
-                "244": "TORREBAJA",
-                "245": "TORRELLA",
-                "246": "TORRENT",
-                "247": "TORRES TORRES",
-                "248": "TOUS",
-                "249": "TUEJAR",
-                "250": "TURIS",
-                "251": "UTIEL",
-                "253": "VALLADA",
-                "254": "VALLANCA",
-                "255": "VALLES",
-                "256": "VENTA DEL MORO",
-                "257": "VILALLONGA/VILLALONGA",
-                "258": "VILAMARXANT",
-                "259": "VILLANUEVA DE CASTELLON",
-                "260": "VILLAR DEL ARZOBISPO",
-                "261": "VILLARGORDO DEL CABRIEL",
-                "262": "VINALESA",
-                "263": "YATOVA",
-                "264": "LA YESA",
-                "265": "ZARRA",
-                "266": "GATOVA",
-                "267": "SAN ANTONIO DE BENAGEBER",
-                "268": "BENICULL DE XUQUER",
-                "900": "VALENCIA",
-            };
-        }
-        else if (provinceCode === 47) {
-            municipalityNames = {
-                "1": "ADALIA",
-                "2": "AGUASAL",
-                "3": "AGUILAR DE CAMPOS",
-                "4": "ALAEJOS",
-                "5": "ALCAZAREN",
-                "6": "ALDEA DE SAN MIGUEL",
-                "7": "ALDEAMAYOR DE SAN MARTIN",
-                "9": "ALMENARA DE ADAJA",
-                "10": "AMUSQUILLO",
-                "11": "ARROYO DE LA ENCOMIENDA",
-                "12": "ATAQUINES",
-                "13": "BAHABON",
-                "14": "BARCIAL DE LA LOMA",
-                "15": "BARRUELO DEL VALLE",
-                "16": "BECILLA DE VALDERADUEY",
-                "17": "BENAFARCES",
-                "18": "BERCERO",
-                "19": "BERCERUELO",
-                "20": "BERRUECES DE CAMPOS",
-                "21": "BOBADILLA DEL CAMPO",
-                "22": "BOCIGAS",
-                "23": "BOCOS DE DUERO",
-                "24": "BOECILLO",
-                "25": "BOLAÑOS DE CAMPOS",
-                "26": "BRAHOJOS DE MEDINA",
-                "27": "BUSTILLO DE CHAVES",
-                "28": "CABEZON DE PISUERGA",
-                "29": "CABEZON DE VALDERADUEY",
-                "30": "CABREROS DEL MONTE",
-                "31": "CAMPASPERO",
-                "32": "EL CAMPILLO",
-                "33": "CAMPORREDONDO",
-                "34": "CANALEJAS DE PEÑAFIEL",
-                "35": "CANILLAS DE ESGUEVA",
-                "36": "CARPIO",
-                "37": "CASASOLA DE ARION",
-                "38": "CASTREJON DE TRABANCOS",
-                "39": "CASTRILLO DE DUERO",
-                "40": "CASTRILLO TEJERIEGO",
-                "41": "CASTROBOL",
-                "42": "CASTRODEZA",
-                "43": "CASTROMEMBIBRE",
-                "44": "CASTROMONTE",
-                "45": "CASTRONUEVO DE ESGUEVA",
-                "46": "CASTRONUÑO",
-                "47": "CASTROPONCE DE VALDERADUEY",
-                "48": "CASTROVERDE DE CERRATO",
-                "49": "CEINOS DE CAMPOS",
-                "50": "CERVILLEGO DE LA CRUZ",
-                "51": "CIGALES",
-                "52": "CIGUÑUELA",
-                "53": "LA CISTERNIGA",
-                "54": "COGECES DE ISCAR",
-                "55": "COGECES DEL MONTE",
-                "56": "CORCOS DEL VALLE",
-                "57": "CORRALES DE DUERO",
-                "58": "CUBILLAS DE SANTA MARTA",
-                "59": "CUENCA DE CAMPOS",
-                "60": "CURIEL DE DUERO",
-                "61": "ENCINAS DE ESGUEVA",
-                "62": "ESGUEVILLAS DE ESGUEVA",
-                "63": "FOMBELLIDA",
-                "64": "FOMPEDRAZA",
-                "65": "FONTIHOYUELO",
-                "66": "FRESNO EL VIEJO",
-                "67": "FUENSALDAÑA",
-                "68": "FUENTE EL SOL",
-                "69": "FUENTE OLMEDO",
-                "70": "GALLEGOS DE HORNIJA",
-                "71": "GATON DE CAMPOS",
-                "72": "GERIA",
-                "74": "HERRIN DE CAMPOS",
-                "75": "HORNILLOS DE ERESMA",
-                "76": "ISCAR",
-                "77": "LAGUNA DE DUERO",
-                "78": "LANGAYO",
-                "79": "LOMOVIEJO",
-                "80": "LLANO DE OLMEDO",
-                "81": "MANZANILLO",
-                "82": "MARZALES",
-                "83": "MATAPOZUELOS",
-                "84": "MATILLA DE LOS CAÑOS",
-                "85": "MAYORGA",
-                "86": "MEDINA DEL CAMPO",
-                "87": "MEDINA DE RIOSECO",
-                "88": "MEGECES",
-                "89": "MELGAR DE ABAJO",
-                "90": "MELGAR DE ARRIBA",
-                "91": "MOJADOS",
-                "92": "MONASTERIO DE VEGA",
-                "93": "MONTEALEGRE DE CAMPOS",
-                "94": "MONTEMAYOR DE PILILLA",
-                "95": "MORAL DE LA REINA",
-                "96": "MORALEJA DE LAS PANADERAS",
-                "97": "MORALES DE CAMPOS",
-                "98": "MOTA DEL MARQUES",
-                "99": "MUCIENTES",
-                "100": "LA MUDARRA",
-                "101": "MURIEL DE ZAPARDIEL",
-                "102": "NAVA DEL REY",
-                "103": "NUEVA VILLA DE LAS TORRES",
-                "104": "OLIVARES DE DUERO",
-                "105": "OLMEDO",
-                "106": "OLMOS DE ESGUEVA",
-                "107": "OLMOS DE PEÑAFIEL",
-                "110": "PALAZUELO DE VEDIJA",
-                "111": "LA PARRILLA",
-                "112": "LA PEDRAJA DE PORTILLO",
-                "113": "PEDRAJAS DE SAN ESTEBAN",
-                "114": "PEDROSA DEL REY",
-                "115": "PEÑAFIEL",
-                "116": "PEÑAFLOR DE HORNIJA",
-                "117": "PESQUERA DE DUERO",
-                "118": "PIÑA DE ESGUEVA",
-                "119": "PIÑEL DE ABAJO",
-                "120": "PIÑEL DE ARRIBA",
-                "122": "POLLOS",
-                "123": "PORTILLO",
-                "124": "POZAL DE GALLINAS",
-                "125": "POZALDEZ",
-                "126": "POZUELO DE LA ORDEN",
-                "127": "PURAS",
-                "128": "QUINTANILLA DE ARRIBA",
-                "129": "QUINTANILLA DEL MOLAR",
-                "130": "QUINTANILLA DE ONESIMO",
-                "131": "QUINTANILLA DE TRIGUEROS",
-                "132": "RABANO",
-                "133": "RAMIRO",
-                "134": "RENEDO DE ESGUEVA",
-                "135": "ROALES DE CAMPOS",
-                "136": "ROBLADILLO",
-                "138": "ROTURAS",
-                "139": "RUBI DE BRACAMONTE",
-                "140": "RUEDA",
-                "141": "SAELICES DE MAYORGA",
-                "142": "SALVADOR DE ZAPARDIEL",
-                "143": "SAN CEBRIAN DE MAZOTE",
-                "144": "SAN LLORENTE DEL VALLE",
-                "145": "SAN MARTIN DE VALVENI",
-                "146": "SAN MIGUEL DEL ARROYO",
-                "147": "SAN MIGUEL DEL PINO",
-                "148": "SAN PABLO DE LA MORALEJA",
-                "149": "SAN PEDRO DE LATARCE",
-                "150": "SAN PELAYO",
-                "151": "SAN ROMAN DE HORNIJA",
-                "152": "SAN SALVADOR",
-                "153": "SANTA EUFEMIA DEL ARROYO",
-                "154": "SANTERVAS DE CAMPOS",
-                "155": "SANTIBAÑEZ DE VALCORBA",
-                "156": "SANTOVENIA DE PISUERGA",
-                "157": "SAN VICENTE DEL PALACIO",
-                "158": "SARDON DE DUERO",
-                "159": "LA SECA",
-                "160": "SERRADA",
-                "161": "SIETE IGLESIAS DE TRABANCOS",
-                "162": "SIMANCAS",
-                "163": "TAMARIZ DE CAMPOS",
-                "164": "TIEDRA",
-                "165": "TORDEHUMOS",
-                "166": "TORDESILLAS",
-                "167": "TORRECILLA DE LA ABADESA",
-                "168": "TORRECILLA DE LA ORDEN",
-                "169": "TORRECILLA DE LA TORRE",
-                "170": "TORRE DE ESGUEVA",
-                "171": "TORRE DE PEÑAFIEL",
-                "172": "TORRELOBATON",
-                "173": "TORRESCARCELA",
-                "174": "TRASPINEDO",
-                "175": "TRIGUEROS DEL VALLE",
-                "176": "TUDELA DE DUERO",
-                "177": "LA UNION DE CAMPOS",
-                "178": "URONES DE CASTROPONCE",
-                "179": "URUEÑA",
-                "180": "VALBUENA DE DUERO",
-                "181": "VALDEARCOS DE LA VEGA",
-                "182": "VALDENEBRO DE LOS VALLES",
-                "183": "VALDESTILLAS",
-                "184": "VALDUNQUILLO",
-                "185": "VALORIA LA BUENA",
-                "186": "VALVERDE DE CAMPOS",
-                "188": "VEGA DE RUIPONCE",
-                "189": "VEGA DE VALDETRONCO",
-                "190": "VELASCALVARO",
-                "191": "VELILLA",
-                "192": "VELLIZA",
-                "193": "VENTOSA DE LA CUESTA",
-                "194": "VIANA DE CEGA",
-                "195": "VILORIA DEL HENAR",
-                "196": "VILLABAÑEZ",
-                "197": "VILLABARUZ DE CAMPOS",
-                "198": "VILLABRAGIMA",
-                "199": "VILLACARRALON",
-                "200": "VILLACID DE CAMPOS",
-                "201": "VILLACO",
-                "204": "VILLAFRADES DE CAMPOS",
-                "205": "VILLAFRANCA DE DUERO",
-                "206": "VILLAFRECHOS",
-                "207": "VILLAFUERTE DE ESGUEVA",
-                "208": "VILLAGARCIA DE CAMPOS",
-                "209": "VILLAGOMEZ LA NUEVA",
-                "210": "VILLALAN DE CAMPOS",
-                "211": "VILLALAR DE LOS COMUNEROS",
-                "212": "VILLALBA DE LA LOMA",
-                "213": "VILLALBA DE LOS ALCORES",
-                "214": "VILLALBARBA",
-                "215": "VILLALON DE CAMPOS",
-                "216": "VILLAMURIEL DE CAMPOS",
-                "217": "VILLAN DE TORDESILLAS",
-                "218": "VILLANUBLA",
-                "219": "VILLANUEVA DE DUERO",
-                "220": "VILLANUEVA DE LA CONDESA",
-                "221": "VILLANUEVA DE LOS CABALLEROS",
-                "222": "VILLANUEVA DE LOS INFANTES",
-                "223": "VILLANUEVA DE SAN MANCIO",
-                "224": "VILLARDEFRADES",
-                "225": "VILLARMENTERO DE ESGUEVA",
-                "226": "VILLASEXMIR",
-                "227": "VILLAVAQUERIN DE CERRATO",
-                "228": "VILLAVELLID",
-                "229": "VILLAVERDE DE MEDINA",
-                "230": "VILLAVICENCIO DE LOS CABALLERO",
-                "231": "WAMBA",
-                "232": "ZARATAN",
-                "233": "LA ZARZA",
-                "900": "VALLADOLID",
-            };
-        }
-        else if (provinceCode === 48) {
-            municipalityNames = {
-                "1": "ABADIÐO",
-                "2": "ABANTO Y CIÉRVANA-ABANTO ZIERBENA",
-                "3": "AMOREBIETA-ETXANO",
-                "4": "AMOROTO",
-                "5": "ARAKALDO",
-                "6": "ARANTZAZU",
-                "7": "MUNITIBAR-ARBATZEGI GERRIKAITZ",
-                "8": "ARTZENTALES",
-                "9": "ARRANKUDIAGA",
-                "10": "ARRIETA",
-                "11": "ARRIGORRIAGA",
-                "12": "BAKIO",
-                "13": "BARAKALDO",
-                "14": "BARRIKA",
-                "15": "BASAURI",
-                "16": "BERANGO",
-                "17": "BERMEO",
-                "18": "BERRIATUA",
-                "19": "BERRIZ",
-                "20": "BILBAO",
-                "21": "BUSTURIA",
-                "22": "KARRANTZA HARANA/VALLE DE CARRANZA",
-                "23": "ARTEA",
-                "24": "ZEANURI",
-                "25": "ZEBERIO",
-                "26": "DIMA",
-                "27": "DURANGO",
-                "28": "EA",
-                "29": "ETXEBARRI ANTEIGLESIA DE SAN ESTEBAN-ETXEBARRI DONEZTEBEKO ELIZATEA",
-                "30": "ETXEBARRIA",
-                "31": "ELANTXOBE",
-                "32": "ELORRIO",
-                "33": "EREÐO",
-                "34": "ERMUA",
-                "35": "FRUIZ",
-                "36": "GALDAKAO",
-                "37": "GALDAMES",
-                "38": "GAMIZ-FIKA",
-                "39": "GARAY",
-                "40": "GATIKA",
-                "41": "GAUTEGIZ ARTEAGA",
-                "42": "GORDEXOLA",
-                "43": "GORLIZ",
-                "44": "GETXO",
-                "45": "G_EÐES",
-                "46": "GERNIKA-LUMO",
-                "47": "GIZABURUAGA",
-                "48": "IBARRANGELU",
-                "49": "ISPASTER",
-                "50": "IZURTZA",
-                "51": "LANESTOSA",
-                "52": "LARRABETZU",
-                "53": "LAUKIZ",
-                "54": "LEIOA",
-                "55": "LEMOA",
-                "56": "LEMOIZ",
-                "57": "LEKEITIO",
-                "58": "MALLABIA",
-                "59": "MAÐARIA",
-                "60": "MARKINA-XEMEIN",
-                "61": "MARURI-JATABE",
-                "62": "MENDATA",
-                "63": "MENDEXA",
-                "64": "MEÐAKA",
-                "65": "UGAO-MIRABALLES",
-                "66": "MORGA",
-                "67": "MUXIKA",
-                "68": "MUNDAKA",
-                "69": "MUNGIA",
-                "70": "AULESTI",
-                "71": "MUSKIZ",
-                "72": "OTXANDIO",
-                "73": "ONDARROA",
-                "74": "URDUÐA-ORDUÐA",
-                "75": "OROZKO",
-                "76": "SUKARRIETA",
-                "77": "PLENTZIA",
-                "78": "PORTUGALETE",
-                "79": "ERRIGOITI",
-                "80": "VALLE DE TRÁPAGA-TRAPAGARAN",
-                "81": "LEZAMA",
-                "82": "SANTURTZI",
-                "83": "ORTUELLA",
-                "84": "SESTAO",
-                "85": "SOPELANA",
-                "86": "SOPUERTA",
-                "87": "TRUCIOS-TURTZIOZ",
-                "88": "UBIDE",
-                "89": "URDULIZ",
-                "90": "BALMASEDA",
-                "91": "ATXONDO",
-                "92": "BEDIA",
-                "93": "AREATZA",
-                "94": "IGORRE",
-                "95": "ZALDIBAR",
-                "96": "ZALLA",
-                "97": "ZARATAMO",
-                "901": "DERIO",
-                "902": "ERANDIO",
-                "903": "LOIU",
-                "904": "SONDIKA",
-                "905": "ZAMUDIO",
-                "906": "FORUA",
-                "907": "KORTEZUBI",
-                "908": "MURUETA",
-                "909": "NABARNIZ",
-                "910": "IURRETA",
-                "911": "AJANGIZ",
-                "912": "ALONSOTEGI",
-                "913": "ZIERBENA",
-                "914": "ARRATZU",
-                "915": "ZIORTZA-BOLIBAR",
-            };
-        }
-        else if (provinceCode === 49) {
-            municipalityNames = {
-                "2": "ABEZAMES",
-                "3": "ALCAÑICES",
-                "4": "ALCUBILLA DE NOGALES",
-                "5": "ALFARAZ DE SAYAGO",
-                "6": "ALGODRE",
-                "7": "ALMARAZ DE DUERO",
-                "8": "ALMEIDA DE SAYAGO",
-                "9": "ANDAVIAS",
-                "10": "ARCENILLAS",
-                "11": "ARCOS DE LA POLVOROSA",
-                "12": "ARGAÑIN",
-                "13": "ARGUJILLO",
-                "15": "ARQUILLINOS",
-                "16": "ARRABALDE",
-                "17": "ASPARIEGOS",
-                "18": "ASTURIANOS",
-                "19": "AYOO DE VIDRIALES",
-                "21": "BARCIAL DEL BARCO",
-                "22": "BELVER DE LOS MONTES",
-                "23": "BENAVENTE",
-                "24": "BENEGILES",
-                "26": "BERMILLO DE SAYAGO",
-                "27": "LA BOVEDA DE TORO",
-                "29": "BRETO",
-                "30": "BRETOCINO",
-                "31": "BRIME DE SOG",
-                "32": "BRIME DE URZ",
-                "33": "BURGANES DE VALVERDE",
-                "34": "BUSTILLO DEL ORO",
-                "35": "CABAÑAS DE SAYAGO",
-                "36": "CALZADILLA DE TERA",
-                "37": "CAMARZANA DE TERA",
-                "38": "CAÑIZAL",
-                "39": "CAÑIZO",
-                "40": "CARBAJALES DE ALBA",
-                "41": "CARBELLINO",
-                "43": "CASASECA DE CAMPEAN",
-                "44": "CASASECA DE LAS CHANAS",
-                "45": "CASTRILLO DE LA GUAREÑA",
-                "46": "CASTROGONZALO",
-                "47": "CASTRONUEVO",
-                "48": "CASTROVERDE DE CAMPOS",
-                "49": "CAZURRA",
-                "51": "CERECINOS DE CAMPOS",
-                "52": "CERECINOS DEL CARRIZAL",
-                "54": "CERNADILLA",
-                "57": "COBREROS",
-                "60": "COOMONTE",
-                "61": "CORESES",
-                "62": "CORRALES DEL VINO",
-                "63": "COTANES DEL MONTE",
-                "64": "CUBILLOS",
-                "65": "CUBO DE BENAVENTE",
-                "66": "EL CUBO DE TIERRA DEL VINO",
-                "67": "CUELGAMURES",
-                "70": "ENTRALA",
-                "72": "ESPADAÑEDO",
-                "74": "FARAMONTANOS DE TABARA",
-                "75": "FARIZA",
-                "76": "FERMOSELLE",
-                "77": "FERRERAS DE ABAJO",
-                "78": "FERRERAS DE ARRIBA",
-                "79": "FERRERUELA",
-                "81": "FIGUERUELA DE ARRIBA",
-                "83": "FONFRIA",
-                "87": "FRESNO DE LA POLVOROSA",
-                "88": "FRESNO DE LA RIBERA",
-                "89": "FRESNO DE SAYAGO",
-                "90": "FRIERA DE VALVERDE",
-                "92": "FUENTE ENCALADA",
-                "93": "FUENTELAPEÑA",
-                "94": "FUENTESAUCO",
-                "95": "FUENTES DE ROPEL",
-                "96": "FUENTESECAS",
-                "97": "FUENTESPREADAS",
-                "98": "GALENDE",
-                "99": "GALLEGOS DEL PAN",
-                "100": "GALLEGOS DEL RIO",
-                "101": "GAMONES",
-                "103": "GEMA",
-                "104": "GRANJA DE MORERUELA",
-                "105": "GRANUCILLO",
-                "106": "GUARRATE",
-                "107": "HERMISENDE",
-                "108": "LA HINIESTA",
-                "109": "JAMBRINA",
-                "110": "JUSTEL",
-                "111": "LOSACINO",
-                "112": "LOSACIO",
-                "113": "LUBIAN",
-                "114": "LUELMO",
-                "115": "EL MADERAL",
-                "116": "MADRIDANOS",
-                "117": "MAHIDE",
-                "118": "MAIRE DE CASTROPONCE",
-                "120": "MALVA",
-                "121": "MANGANESES DE LA LAMPREANA",
-                "122": "MANGANESES DE LA POLVOROSA",
-                "123": "MANZANAL DE ARRIBA",
-                "124": "MANZANAL DEL BARCO",
-                "125": "MANZANAL DE LOS INFANTES",
-                "126": "MATILLA DE ARZON",
-                "127": "MATILLA LA SECA",
-                "128": "MAYALDE",
-                "129": "MELGAR DE TERA",
-                "130": "MICERECES DE TERA",
-                "131": "MILLES DE LA POLVOROSA",
-                "133": "MOLACILLOS",
-                "134": "MOLEZUELAS DE LA CARBALLEDA",
-                "135": "MOMBUEY",
-                "136": "MONFARRACINOS",
-                "137": "MONTAMARTA",
-                "138": "MORAL DE SAYAGO",
-                "139": "MORALEJA DEL VINO",
-                "140": "MORALEJA DE SAYAGO",
-                "141": "MORALES DEL VINO",
-                "142": "MORALES DE REY",
-                "143": "MORALES DE TORO",
-                "144": "MORALES DE VALVERDE",
-                "145": "MORALINA",
-                "146": "MORERUELA DE LOS INFANZONES",
-                "147": "MORERUELA DE TABARA",
-                "148": "MUELAS DE LOS CABALLEROS",
-                "149": "MUELAS DEL PAN",
-                "150": "MUGA DE SAYAGO",
-                "151": "NAVIANOS DE VALVERDE",
-                "152": "OLMILLOS DE CASTRO",
-                "153": "OTERO DE BODAS",
-                "156": "PAJARES DE LA LAMPREANA",
-                "157": "PALACIOS DEL PAN",
-                "158": "PALACIOS DE SANABRIA",
-                "160": "PEDRALBA DE LA PRADERIA",
-                "161": "EL PEGO",
-                "162": "PELEAGONZALO",
-                "163": "PELEAS DE ABAJO",
-                "165": "PEÑAUSENDE",
-                "166": "PEQUE",
-                "167": "EL PERDIGON",
-                "168": "PERERUELA",
-                "169": "PERILLA DE CASTRO",
-                "170": "PIAS",
-                "171": "PIEDRAHITA DE CASTRO",
-                "172": "PINILLA DE TORO",
-                "173": "PINO DEL ORO",
-                "174": "EL PIÑERO",
-                "176": "POBLADURA DEL VALLE",
-                "177": "POBLADURA DE VALDERADUEY",
-                "179": "PORTO",
-                "180": "POZOANTIGUO",
-                "181": "POZUELO DE TABARA",
-                "183": "PRADO",
-                "184": "PUEBLA DE SANABRIA",
-                "185": "PUEBLICA DE VALVERDE",
-                "186": "QUINTANILLA DEL MONTE",
-                "187": "QUINTANILLA DEL OLMO",
-                "188": "QUINTANILLA DE URZ",
-                "189": "QUIRUELAS DE VIDRIALES",
-                "190": "RABANALES",
-                "191": "RABANO DE ALISTE",
-                "192": "REQUEJO",
-                "193": "REVELLINOS",
-                "196": "RIOFRIO DE ALISTE",
-                "197": "RIONEGRO DEL PUENTE",
-                "198": "ROALES",
-                "199": "ROBLEDA-CERVANTES",
-                "200": "ROELOS DE SAYAGO",
-                "201": "ROSINOS DE LA REQUEJADA",
-                "203": "SALCE",
-                "204": "SAMIR DE LOS CAÑOS",
-                "205": "SAN AGUSTIN DEL POZO",
-                "206": "SAN CEBRIAN DE CASTRO",
-                "208": "SAN CRISTOBAL DE ENTREVIÑAS",
-                "209": "SAN ESTEBAN DEL MOLAR",
-                "210": "SAN JUSTO",
-                "212": "SAN MARTIN DE VALDERADUEY",
-                "213": "SAN MIGUEL DE LA RIBERA",
-                "214": "SAN MIGUEL DEL VALLE",
-                "215": "SAN PEDRO DE CEQUE",
-                "216": "SAN PEDRO DE LA NAVE-ALMENDRA",
-                "220": "SANTA CLARA DE AVEDILLO",
-                "222": "SANTA COLOMBA DE LAS MONJAS",
-                "223": "SANTA CRISTINA DE LA POLVOROSA",
-                "224": "SANTA CROYA DE TERA",
-                "225": "SANTA EUFEMIA DEL BARCO",
-                "226": "SANTA MARIA DE LA VEGA",
-                "227": "SANTA MARIA DE VALVERDE",
-                "228": "SANTIBAÑEZ DE TERA",
-                "229": "SANTIBAÑEZ DE VIDRIALES",
-                "230": "SANTOVENIA",
-                "231": "SAN VICENTE DE LA CABEZA",
-                "232": "SAN VITERO",
-                "233": "SANZOLES",
-                "237": "TABARA",
-                "240": "TAPIOLES",
-                "244": "TORO",
-                "245": "LA TORRE DEL VALLE",
-                "247": "TORREGAMONES",
-                "248": "TORRES DEL CARRIZAL",
-                "249": "TRABAZOS",
-                "250": "TREFACIO",
-                "253": "UÑA DE QUINTANA",
-                "254": "VADILLO DE LA GUARE/A",
-                "255": "VALCABADO",
-                "256": "VALDEFINJAS",
-                "257": "VALDESCORRIEL",
-                "259": "VALLESA DE LA GUAREÑA",
-                "260": "VEGA DE TERA",
-                "261": "VEGA DE VILLALOBOS",
-                "262": "VEGALATRAVE",
-                "263": "VENIALBO",
-                "264": "VEZDEMARBAN",
-                "265": "VIDAYANES",
-                "266": "VIDEMALA",
-                "267": "VILLABRAZARO",
-                "268": "VILLABUENA DEL PUENTE",
-                "269": "VILLADEPERA",
-                "270": "VILLAESCUSA",
-                "271": "VILLAFAFILA",
-                "272": "VILLAFERRUEÑA",
-                "273": "VILLAGERIZ",
-                "274": "VILLALAZAN",
-                "275": "VILLALBA DE LA LAMPREANA",
-                "276": "VILLALCAMPO",
-                "277": "VILLALOBOS",
-                "278": "VILLALONSO",
-                "279": "VILLALPANDO",
-                "280": "VILLALUBE",
-                "281": "VILLAMAYOR DE CAMPOS",
-                "284": "VILLAMOR DE LOS ESCUDEROS",
-                "285": "VILLANAZAR",
-                "286": "VILLANUEVA DE AZOAGUE",
-                "287": "VILLANUEVA DE CAMPEAN",
-                "288": "VILLANUEVA DE LAS PERAS",
-                "289": "VILLANUEVA DEL CAMPO",
-                "290": "VILLARALBO",
-                "291": "VILLARDECIERVOS",
-                "292": "VILLAR DE FALLAVES",
-                "293": "VILLAR DEL BUEY",
-                "294": "VILLARDIEGUA DE LA RIBERA",
-                "295": "VILLARDIGA",
-                "296": "VILLARDONDIEGO",
-                "297": "VILLARRIN DE CAMPOS",
-                "298": "VILLASECO DEL PAN",
-                "299": "VILLAVENDIMIO",
-                "300": "VILLAVEZA DEL AGUA",
-                "301": "VILLAVEZA DE VALVERDE",
-                "302": "VIÑAS",
-                "900": "ZAMORA",
-            };
-        }
-        else if (provinceCode === 50) {
-            municipalityNames = {
-                "1": "ABANTO",
-                "2": "ACERED",
-                "3": "AGON",
-                "4": "AGUARON",
-                "5": "AGUILON",
-                "6": "AINZON",
-                "7": "ALADREN",
-                "8": "ALAGON",
-                "9": "ALARBA",
-                "10": "ALBERITE DE SAN JUAN",
-                "11": "ALBETA",
-                "12": "ALBORGE",
-                "13": "ALCALA DE EBRO",
-                "14": "ALCALA DE MONCAYO",
-                "15": "ALCONCHEL DE ARIZA",
-                "16": "ALDEHUELA DE LIESTOS",
-                "17": "ALFAJARIN",
-                "18": "ALFAMEN",
-                "19": "ALFORQUE",
-                "20": "ALHAMA DE ARAGON",
-                "21": "ALMOCHUEL",
-                "22": "LA ALMOLDA",
-                "23": "ALMONACID DE LA CUBA",
-                "24": "ALMONACID DE LA SIERRA",
-                "25": "LA ALMUNIA DE DOÑA GODINA",
-                "26": "ALPARTIR",
-                "27": "AMBEL",
-                "28": "ANENTO",
-                "29": "ANIÑON",
-                "30": "AÑON",
-                "31": "ARANDA DE MONCAYO",
-                "32": "ARANDIGA",
-                "33": "ARDISA",
-                "34": "ARIZA",
-                "35": "ARTIEDA",
-                "36": "ASIN",
-                "37": "ATEA",
-                "38": "ATECA",
-                "39": "AZUARA",
-                "40": "BADULES",
-                "41": "BAGUES",
-                "42": "BALCONCHAN",
-                "43": "BARBOLES",
-                "44": "BARDALLUR",
-                "45": "BELCHITE",
-                "46": "BELMONTE DE GRACIAN",
-                "47": "BERDEJO",
-                "48": "BERRUECO",
-                "49": "BIEL-FUENCALDERAS",
-                "50": "BIJUESCA",
-                "51": "BIOTA",
-                "52": "BISIMBRE",
-                "53": "BOQUIÑENI",
-                "54": "BORDALBA",
-                "55": "BORJA",
-                "56": "BOTORRITA",
-                "57": "BREA",
-                "58": "BUBIERCA",
-                "59": "BUJARALOZ",
-                "60": "BULBUENTE",
-                "61": "BURETA",
-                "62": "EL BURGO DE EBRO",
-                "63": "EL BUSTE",
-                "64": "CABAÑAS DE EBRO",
-                "65": "CABOLAFUENTE",
-                "66": "CADRETE",
-                "67": "CALATAYUD",
-                "68": "CALATORAO",
-                "69": "CALCENA",
-                "70": "CALMARZA",
-                "71": "CAMPILLO DE ARAGON",
-                "72": "CARENAS",
-                "73": "CARIÑENA",
-                "74": "CASPE",
-                "75": "CASTEJON DE ALARBA",
-                "76": "CASTEJON DE LAS ARMAS",
-                "77": "CASTEJON DE VALDEJASA",
-                "78": "CASTILISCAR",
-                "79": "CERVERA DE LA CAÑADA",
-                "80": "CERVERUELA",
-                "81": "CETINA",
-                "82": "CIMBALLA",
-                "83": "CINCO OLIVAS",
-                "84": "CLARES DE RIBOTA",
-                "85": "CODO",
-                "86": "CODOS",
-                "87": "CONTAMINA",
-                "88": "COSUENDA",
-                "89": "CUARTE DE HUERVA",
-                "90": "CUBEL",
-                "91": "LAS CUERLAS",
-                "92": "CHIPRANA",
-                "93": "CHODES",
-                "94": "DAROCA",
-                "95": "EJEA DE LOS CABALLEROS",
-                "96": "EMBID DE ARIZA",
-                "98": "ENCINACORBA",
-                "99": "EPILA",
-                "100": "ERLA",
-                "101": "ESCATRON",
-                "103": "FABARA",
-                "105": "FARLETE",
-                "106": "FAYON",
-                "107": "LOS FAYOS",
-                "108": "FIGUERUELAS",
-                "109": "FOMBUENA",
-                "110": "EL FRAGO",
-                "111": "EL FRASNO",
-                "112": "FRESCANO",
-                "114": "FUENDEJALON",
-                "115": "FUENDETODOS",
-                "116": "FUENTES DE EBRO",
-                "117": "FUENTES DE JILOCA",
-                "118": "GALLOCANTA",
-                "119": "GALLUR",
-                "120": "GELSA",
-                "121": "GODOJOS",
-                "122": "GOTOR",
-                "123": "GRISEL",
-                "124": "GRISEN",
-                "125": "HERRERA DE LOS NAVARROS",
-                "126": "IBDES",
-                "127": "ILLUECA",
-                "129": "ISUERRE",
-                "130": "JARABA",
-                "131": "JARQUE",
-                "132": "JAULIN",
-                "133": "LA JOYOSA",
-                "134": "LAGATA",
-                "135": "LANGA DEL CASTILLO",
-                "136": "LAYANA",
-                "137": "LECERA",
-                "138": "LECIÑENA",
-                "139": "LECHON",
-                "140": "LETUX",
-                "141": "LITAGO",
-                "142": "LITUENIGO",
-                "143": "LOBERA DE ONSELLA",
-                "144": "LONGARES",
-                "145": "LONGAS",
-                "147": "LUCENA DE JALON",
-                "148": "LUCENI",
-                "149": "LUESIA",
-                "150": "LUESMA",
-                "151": "LUMPIAQUE",
-                "152": "LUNA",
-                "153": "MAELLA",
-                "154": "MAGALLON",
-                "155": "MAINAR",
-                "156": "MALANQUILLA",
-                "157": "MALEJAN",
-                "158": "MALON",
-                "160": "MALUENDA",
-                "161": "MALLEN",
-                "162": "MANCHONES",
-                "163": "MARA",
-                "164": "MARIA DE HUERVA",
-                "165": "MEDIANA DE ARAGON",
-                "166": "MEQUINENZA",
-                "167": "MESONES DE ISUELA",
-                "168": "MEZALOCHA",
-                "169": "MIANOS",
-                "170": "MIEDES",
-                "171": "MONEGRILLO",
-                "172": "MONEVA",
-                "173": "MONREAL DE ARIZA",
-                "174": "MONTERDE",
-                "175": "MONTON",
-                "176": "MORATA DE JALON",
-                "177": "MORATA DE JILOCA",
-                "178": "MORES",
-                "179": "MOROS",
-                "180": "MOYUELA",
-                "181": "MOZOTA",
-                "182": "MUEL",
-                "183": "LA MUELA",
-                "184": "MUNEBREGA",
-                "185": "MURERO",
-                "186": "MURILLO DE GALLEGO",
-                "187": "NAVARDUN",
-                "188": "NIGUELLA",
-                "189": "NOMBREVILLA",
-                "190": "NONASPE",
-                "191": "NOVALLAS",
-                "192": "NOVILLAS",
-                "193": "NUEVALOS",
-                "194": "NUEZ DE EBRO",
-                "195": "OLVES",
-                "196": "ORCAJO",
-                "197": "ORERA",
-                "198": "ORES",
-                "199": "OSEJA",
-                "200": "OSERA DE EBRO",
-                "201": "PANIZA",
-                "202": "PARACUELLOS DE JILOCA",
-                "203": "PARACUELLOS DE LA RIBERA",
-                "204": "PASTRIZ",
-                "205": "PEDROLA",
-                "206": "LAS PEDROSAS",
-                "207": "PERDIGUERA",
-                "208": "PIEDRATAJADA",
-                "209": "PINA DE EBRO",
-                "210": "PINSEQUE",
-                "211": "LOS PINTANOS",
-                "212": "PLASENCIA DE JALON",
-                "213": "PLEITAS",
-                "214": "PLENAS",
-                "215": "POMER",
-                "216": "POZUEL DE ARIZA",
-                "217": "POZUELO DE ARAGON",
-                "218": "PRADILLA DE EBRO",
-                "219": "PUEBLA DE ALBORTON",
-                "220": "PUEBLA DE ALFINDEN",
-                "221": "PUENDELUNA",
-                "223": "PURUJOSA",
-                "224": "QUINTO",
-                "225": "REMOLINOS",
-                "226": "RETASCON",
-                "227": "RICLA",
-                "229": "ROMANOS",
-                "230": "RUEDA DE JALON",
-                "231": "RUESCA",
-                "233": "SADABA",
-                "234": "SALILLAS DE JALON",
-                "235": "SALVATIERRA DE ESCA",
-                "236": "SAMPER DEL SALZ",
-                "237": "SAN MARTIN DE LA VIRGEN DEL MO",
-                "238": "SAN MATEO DE GALLEGO",
-                "239": "SANTA CRUZ DE GRIO",
-                "240": "SANTA CRUZ DE MONCAYO",
-                "241": "SANTA EULALIA DE GALLEGO",
-                "242": "SANTED",
-                "243": "SASTAGO",
-                "244": "SABIÑAN",
-                "245": "SEDILES",
-                "246": "SESTRICA",
-                "247": "SIERRA DE LUNA",
-                "248": "SIGUES",
-                "249": "SISAMON",
-                "250": "SOBRADIEL",
-                "251": "SOS DEL REY CATOLICO",
-                "252": "TABUENCA",
-                "253": "TALAMANTES",
-                "254": "TARAZONA",
-                "255": "TAUSTE",
-                "256": "TERRER",
-                "257": "TIERGA",
-                "259": "TOBED",
-                "260": "TORRALBA DE LOS FRAILES",
-                "261": "TORRALBA DE RIBOTA",
-                "262": "TORRALBILLA",
-                "263": "TORREHERMOSA",
-                "264": "TORRELAPAJA",
-                "265": "TORRELLAS",
-                "266": "TORRES DE BERRELLEN",
-                "267": "TORRIJO DE LA CAÑADA",
-                "268": "TOSOS",
-                "269": "TRASMOZ",
-                "270": "TRASOBARES",
-                "271": "UNCASTILLO",
-                "272": "UNDUES DE LERDA",
-                "274": "URREA DE JALON",
-                "275": "URRIES",
-                "276": "USED",
-                "277": "UTEBO",
-                "278": "VALDEHORNA",
-                "279": "VAL DE SAN MARTIN",
-                "280": "VALMADRID",
-                "281": "VALPALMAS",
-                "282": "VALTORRES",
-                "283": "VELILLA DE EBRO",
-                "284": "VELILLA DE JILOCA",
-                "285": "VERA DE MONCAYO",
-                "286": "VIERLAS",
-                "287": "LA VILUEÑA",
-                "288": "VILLADOZ",
-                "289": "VILLAFELICHE",
-                "290": "VILLAFRANCA DE EBRO",
-                "291": "VILLALBA DE PEREJIL",
-                "292": "VILLALENGUA",
-                "293": "VILLANUEVA DE GALLEGO",
-                "294": "VILLANUEVA DE JILOCA",
-                "295": "VILLANUEVA DE HUERVA",
-                "296": "VILLAR DE LOS NAVARROS",
-                "297": "VILLARREAL DE HUERVA",
-                "298": "VILLARROYA DE LA SIERRA",
-                "299": "VILLARROYA DEL CAMPO",
-                "300": "VISTABELLA",
-                "302": "LA ZAIDA",
-                "304": "ZUERA",
-                "305": "MARRACOS",
-                "306": "VILLAMAYOR DE GALLEGO",
-                "900": "ZARAGOZA",
-            };
-        }
-        // Add a default case to handle other provinces
-        else {
-            // If we don't have data for this province, use an empty object
-            municipalityNames = {};
-            console.log("No hay datos de municpio disponibles para la provincia: " + provinceCode);
-        }
-    }
-         
-        
-
-
-    
     Timer {
         id: loadMunicipalitiesTimer
-        interval: 100
+        interval: hierarchyIndex.ready ? 0 : 100
         repeat: false
         
         onTriggered: {
             // Get unique municipality values for the selected province
-            municipalityValues = FeatureUtils.getUniqueValuesFiltered(
-                vectorLayer, 
-                getFieldName("CD_MUN"), 
-                getFieldName("CD_PROV") + " = " + selectedProvince
-            );
+            municipalityValues = hierarchyIndex.ready
+                ? hierarchyIndex.values([selectedProvince])
+                : FeatureUtils.getUniqueValuesFiltered(
+                    vectorLayer, 
+                    getFieldName("CD_MUN"), 
+                    getFieldName("CD_PROV") + " = " + selectedProvince
+                );
             
             // Sort numerically
             municipalityValues.sort(function(a, b) { return a - b; });
@@ -8838,17 +443,19 @@ Drawer {
     
     Timer {
         id: loadPolygonsTimer
-        interval: 100
+        interval: hierarchyIndex.ready ? 0 : 100
         repeat: false
         
         onTriggered: {
             // Get unique polygon values for the selected province and municipality
-            polygonValues = FeatureUtils.getUniqueValuesFiltered(
-                vectorLayer, 
-                getFieldName("CD_POL"), 
-                getFieldName("CD_PROV") + " = " + selectedProvince + 
-                " AND " + getFieldName("CD_MUN") + " = " + selectedMunicipality
-            );
+            polygonValues = hierarchyIndex.ready
+                ? hierarchyIndex.values([selectedProvince, selectedMunicipality])
+                : FeatureUtils.getUniqueValuesFiltered(
+                    vectorLayer, 
+                    getFieldName("CD_POL"), 
+                    getFieldName("CD_PROV") + " = " + selectedProvince + 
+                    " AND " + getFieldName("CD_MUN") + " = " + selectedMunicipality
+                );
             
             // Sort numerically
             polygonValues.sort(function(a, b) { return a - b; });
@@ -8889,18 +496,20 @@ Drawer {
     
     Timer {
         id: loadParcelsTimer
-        interval: 100
+        interval: hierarchyIndex.ready ? 0 : 100
         repeat: false
         
         onTriggered: {
             // Get unique parcel values for the selected province, municipality and polygon
-            parcelValues = FeatureUtils.getUniqueValuesFiltered(
-                vectorLayer, 
-                getFieldName("CD_PARCELA"), 
-                getFieldName("CD_PROV") + " = " + selectedProvince + 
-                " AND " + getFieldName("CD_MUN") + " = " + selectedMunicipality + 
-                " AND " + getFieldName("CD_POL") + " = " + selectedPolygon
-            );
+            parcelValues = hierarchyIndex.ready
+                ? hierarchyIndex.values([selectedProvince, selectedMunicipality, selectedPolygon])
+                : FeatureUtils.getUniqueValuesFiltered(
+                    vectorLayer, 
+                    getFieldName("CD_PARCELA"), 
+                    getFieldName("CD_PROV") + " = " + selectedProvince + 
+                    " AND " + getFieldName("CD_MUN") + " = " + selectedMunicipality + 
+                    " AND " + getFieldName("CD_POL") + " = " + selectedPolygon
+                );
             
             // Sort numerically
             parcelValues.sort(function(a, b) { return a - b; });
@@ -8928,38 +537,53 @@ Drawer {
     function showResults() {
         if (!selectedProvince || !selectedMunicipality) return;
         
+        // Build the filter expression based on selections
+        var filterExpression = getFieldName("CD_PROV") + " = " + selectedProvince + 
+                              " AND " + getFieldName("CD_MUN") + " = " + selectedMunicipality;
+        
+        if (selectedPolygon !== null) {
+            filterExpression += " AND " + getFieldName("CD_POL") + " = " + selectedPolygon;
+            
+            if (selectedParcel !== null) {
+                filterExpression += " AND " + getFieldName("CD_PARCELA") + " = " + selectedParcel;
+            }
+        }
+        
+        // Drop any query still streaming results for a previous selection
+        if (resultsQuery) {
+            resultsQuery.cancel();
+        }
+        
+        filteredFeatures = [];
+        resultsModel.clear();
+        resultsView.visible = true;
+        resultsCountLabel.text = qsTr("%1 Resultados encontrados").arg(0);
+        
+        // Features are gathered in the background and appended as they come in
+        resultsQuery = FeatureUtils.getFilteredFeaturesAsync(vectorLayer, filterExpression);
+        if (!resultsQuery) {
+            isSearching = false;
+            busyIndicator.running = false;
+            return;
+        }
+        
         isSearching = true;
         busyIndicator.running = true;
-        
-        // Use a timer to avoid blocking the UI
-        showResultsTimer.start();
     }
     
-    Timer {
-        id: showResultsTimer
-        interval: 100
-        repeat: false
+    property FeatureQueryJob resultsQuery: null
+    
+    Connections {
+        target: resultsQuery
         
-        onTriggered: {
-            // Build the filter expression based on selections
-            var filterExpression = getFieldName("CD_PROV") + " = " + selectedProvince + 
-                                  " AND " + getFieldName("CD_MUN") + " = " + selectedMunicipality;
-            
-            if (selectedPolygon !== null) {
-                filterExpression += " AND " + getFieldName("CD_POL") + " = " + selectedPolygon;
-                
-                if (selectedParcel !== null) {
-                    filterExpression += " AND " + getFieldName("CD_PARCELA") + " = " + selectedParcel;
-                }
+        function onResultsAdded(chunk) {
+            // Appended in place, copying the gathered features for every chunk is quadratic
+            for (var j = 0; j < chunk.length; j++) {
+                filteredFeatures.push(chunk[j]);
             }
-            
-            // Get the filtered features
-            filteredFeatures = FeatureUtils.getFilteredFeatures(vectorLayer, filterExpression);
-            
-            // Populate the results model
-            resultsModel.clear();
-            for (var i = 0; i < Math.min(filteredFeatures.length, 100); i++) {
-                var feature = filteredFeatures[i];
+            filteredFeaturesChanged();
+            for (var i = 0; i < chunk.length && resultsModel.count < 100; i++) {
+                var feature = chunk[i];
                 resultsModel.append({
                     fid: feature.id,
                     recinto: feature.attributes[getFieldName("CD_RECINTO")] || "",
@@ -8968,14 +592,15 @@ Drawer {
                 });
             }
             
-            // Show the results view
-            resultsView.visible = true;
-            
             // Update the count label
-            resultsCountLabel.text = qsTr("%1 Resultados encontrados").arg(filteredFeatures.length);
-            
-            isSearching = false;
-            busyIndicator.running = false;
+            resultsCountLabel.text = qsTr("%1 Resultados encontrados").arg(resultsQuery.resultCount);
+        }
+        
+        function onFinished() {
+            if (!resultsQuery.canceled) {
+                isSearching = false;
+                busyIndicator.running = false;
+            }
         }
     }
     
@@ -9096,12 +721,14 @@ Drawer {
             // First highlight all features
             highlightFeatures(filteredFeatures);
 
-            // Get the combined extent of all features
-            var extent = FeatureUtils.extentOfFeatures(
-                mapCanvas.mapSettings, 
-                vectorLayer, 
-                filteredFeatures
-            );
+            // Get the combined extent of all features, the index already knows it for the current selection
+            var extent = hierarchyIndex.ready
+                ? hierarchyIndex.extent(selectionPath(), mapCanvas.mapSettings.destinationCrs)
+                : FeatureUtils.extentOfFeatures(
+                    mapCanvas.mapSettings, 
+                    vectorLayer, 
+                    filteredFeatures
+                );
 
             // Ensure the extent is valid
             if (extent && !extent.isNull) {
@@ -213,6 +213,13 @@ Popup {
                 anchors.margins: 6
                 fillMode: VideoOutput.PreserveAspectCrop
               }
+
+              // Only scan the part of the frames shown in the viewfinder, cropped frames overflowing it
+              Binding {
+                target: barcodeDecoder
+                property: "regionOfInterest"
+                value: videoOutput.contentRect.width > 0 && videoOutput.contentRect.height > 0 ? Qt.rect(-videoOutput.contentRect.x / videoOutput.contentRect.width, -videoOutput.contentRect.y / videoOutput.contentRect.height, videoOutput.width / videoOutput.contentRect.width, videoOutput.height / videoOutput.contentRect.height) : Qt.rect(0, 0, 1, 1)
+              }
             }
           }
 
@@ -0,0 +1,289 @@
+import QtQuick
+import QtQuick.Controls
+import QtQuick.Layouts
+import org.qgis
+import org.qfield
+import Theme
+
+/**
+ * \ingroup qml
+ */
+Popup {
+  id: offlinePacksPanel
+
+  parent: mainWindow.contentItem
+  padding: 0
+  width: mainWindow.width - Theme.popupScreenEdgeMargin
+  height: mainWindow.height - Math.max(Theme.popupScreenEdgeMargin * 2, mainWindow.sceneTopMargin * 2 + 4, mainWindow.sceneBottomMargin * 2 + 4)
+  x: Theme.popupScreenEdgeMargin / 2
+  y: (mainWindow.height - height) / 2
+  modal: true
+  closePolicy: downloader.running ? Popup.NoAutoClose : Popup.CloseOnEscape
+
+  property MapSettings mapSettings
+  property TileStore store: tileStore
+
+  //! Returns the web mercator zoom level matching the current map scale
+  function currentZoom() {
+    if (!mapSettings || mapSettings.scale <= 0) {
+      return 12;
+    }
+    return Math.max(0, Math.min(20, Math.round(Math.log(559082264 / mapSettings.scale) / Math.LN2)));
+  }
+
+  onAboutToShow: {
+    if (!downloader.running) {
+      downloader.setExtent(mapSettings.visibleExtent, mapSettings.destinationCrs);
+      downloader.setSourcesFromProject(qgisProject);
+      const zoom = currentZoom();
+      minimumZoomSlider.value = zoom;
+      maximumZoomSlider.value = Math.min(zoom + 4, 20);
+      packName.text = qsTr("Pack %1").arg(new Date().toLocaleString(Qt.locale(), Locale.ShortFormat));
+    }
+  }
+
+  OfflinePackDownloader {
+    id: downloader
+    tileStore: offlinePacksPanel.store
+    name: packName.text.trim()
+    minimumZoom: minimumZoomSlider.value
+    maximumZoom: Math.max(minimumZoomSlider.value, maximumZoomSlider.value)
+
+    onFinished: function (success) {
+      if (success) {
+        displayToast(qsTr("Offline pack %1 downloaded").arg(name));
+      } else if (failedCount > 0) {
+        displayToast(qsTr("Offline pack %1 is missing %n tile(s)", "", failedCount).arg(name), 'warning');
+      } else {
+        displayToast(qsTr("Offline pack %1 download canceled").arg(name));
+      }
+    }
+  }
+
+  Page {
+    focus: true
+    anchors.fill: parent
+
+    header: QfPageHeader {
+      title: qsTr("Offline Maps")
+
+      showApplyButton: false
+      showCancelButton: false
+      showBackButton: true
+
+      onBack: {
+        offlinePacksPanel.close();
+      }
+    }
+
+    ColumnLayout {
+      anchors.fill: parent
+      anchors.bottomMargin: 10
+
+      ScrollView {
+        Layout.fillWidth: true
+        Layout.fillHeight: true
+        padding: 10
+        ScrollBar.horizontal.policy: ScrollBar.AlwaysOff
+        ScrollBar.vertical: QfScrollBar {
+        }
+        contentWidth: offlinePacksGrid.width
+        contentHeight: offlinePacksGrid.height
+        clip: true
+
+        GridLayout {
+          id: offlinePacksGrid
+          width: parent.parent.width
+          Layout.fillWidth: true
+
+          columns: 2
+          columnSpacing: 0
+          rowSpacing: 5
+
+          Label {
+            text: qsTr('New Pack From The Current Extent')
+            font: Theme.strongFont
+            color: Theme.mainColor
+            wrapMode: Text.WordWrap
+            Layout.fillWidth: true
+            Layout.topMargin: 5
+            Layout.columnSpan: 2
+          }
+
+          Rectangle {
+            Layout.fillWidth: true
+            Layout.columnSpan: 2
+            height: 1
+            color: Theme.mainColor
+          }
+
+          Label {
+            text: qsTr("Name")
+            font: Theme.defaultFont
+            wrapMode: Text.WordWrap
+            Layout.fillWidth: true
+          }
+
+          QfTextField {
+            id: packName
+            font: Theme.defaultFont
+            enabled: !downloader.running
+            Layout.preferredWidth: 200
+            Layout.preferredHeight: font.height + 20
+          }
+
+          Label {
+            text: qsTr("Minimum zoom level")
+            font: Theme.defaultFont
+            wrapMode: Text.WordWrap
+            Layout.fillWidth: true
+            Layout.columnSpan: 2
+          }
+
+          QfSlider {
+            id: minimumZoomSlider
+            Layout.fillWidth: true
+            Layout.columnSpan: 2
+            enabled: !downloader.running
+            from: 0
+            to: 20
+            stepSize: 1
+            implicitHeight: 40
+          }
+
+          Label {
+            text: qsTr("Maximum zoom level")
+            font: Theme.defaultFont
+            wrapMode: Text.WordWrap
+            Layout.fillWidth: true
+            Layout.columnSpan: 2
+          }
+
+          QfSlider {
+            id: maximumZoomSlider
+            Layout.fillWidth: true
+            Layout.columnSpan: 2
+            enabled: !downloader.running
+            from: 0
+            to: 20
+            stepSize: 1
+            implicitHeight: 40
+          }
+
+          Label {
+            text: downloader.urlTemplates.length === 0 ? qsTr("No visible basemap of the project can be downloaded.") : downloader.tileCount < 0 ? qsTr("The pack would hold too many tiles, reduce the extent or the maximum zoom level.") : qsTr("%n tile(s) to download.", "", downloader.tileCount)
+            font: Theme.tipFont
+            color: downloader.tileCount < 0 || downloader.urlTemplates.length === 0 ? Theme.errorColor : Theme.secondaryTextColor
+            wrapMode: Text.WordWrap
+            Layout.fillWidth: true
+            Layout.columnSpan: 2
+          }
+
+          Label {
+            visible: downloader.skippedSources.length > 0
+            text: qsTr("Not downloaded as their provider does not permit bulk downloads: %1").arg(downloader.skippedSources.join(", "))
+            font: Theme.tipFont
+            color: Theme.secondaryTextColor
+            wrapMode: Text.WordWrap
+            Layout.fillWidth: true
+            Layout.columnSpan: 2
+          }
+
+          ProgressBar {
+            visible: downloader.running
+            Layout.fillWidth: true
+            Layout.columnSpan: 2
+            from: 0
+            to: 1
+            value: downloader.progress
+          }
+
+          Label {
+            visible: downloader.running
+            text: qsTr("%1% downloaded").arg(Math.floor(downloader.progress * 100))
+            font: Theme.tipFont
+            color: Theme.secondaryTextColor
+            Layout.fillWidth: true
+            Layout.columnSpan: 2
+          }
+
+          Label {
+            text: qsTr('Stored Packs')
+            font: Theme.strongFont
+            color: Theme.mainColor
+            wrapMode: Text.WordWrap
+            Layout.fillWidth: true
+            Layout.topMargin: 15
+            Layout.columnSpan: 2
+          }
+
+          Rectangle {
+            Layout.fillWidth: true
+            Layout.columnSpan: 2
+            height: 1
+            color: Theme.mainColor
+          }
+
+          Repeater {
+            model: store ? store.packs : []
+
+            delegate: RowLayout {
+              Layout.fillWidth: true
+              Layout.columnSpan: 2
+
+              Label {
+                text: qsTr("%1 (%n tile(s))", "", store.packTileCount(modelData)).arg(modelData)
+                font: Theme.defaultFont
+                wrapMode: Text.WordWrap
+                Layout.fillWidth: true
+              }
+
+              QfToolButton {
+                iconSource: Theme.getThemeVectorIcon('ic_delete_forever_white_24dp')
+                iconColor: Theme.mainTextColor
+                bgcolor: "transparent"
+                enabled: !downloader.running
+
+                onClicked: store.removePack(modelData)
+              }
+            }
+          }
+
+          Label {
+            visible: !store || store.packs.length === 0
+            text: qsTr("No offline pack stored yet.")
+            font: Theme.tipFont
+            color: Theme.secondaryTextColor
+            wrapMode: Text.WordWrap
+            Layout.fillWidth: true
+            Layout.columnSpan: 2
+          }
+        }
+      }
+
+      QfButton {
+        Layout.fillWidth: true
+        Layout.leftMargin: 10
+        Layout.rightMargin: 10
+        visible: !downloader.running
+        enabled: downloader.tileCount > 0 && downloader.name !== ""
+        text: qsTr("Download pack")
+        icon.source: Theme.getThemeVectorIcon('ic_map_white_24dp')
+
+        onClicked: downloader.start()
+      }
+
+      QfButton {
+        Layout.fillWidth: true
+        Layout.leftMargin: 10
+        Layout.rightMargin: 10
+        visible: downloader.running
+        text: qsTr("Cancel download")
+        bgcolor: "transparent"
+        color: Theme.mainColor
+
+        onClicked: downloader.cancel()
+      }
+    }
+  }
+}
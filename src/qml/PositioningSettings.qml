@@ -27,6 +27,7 @@ Settings {
   property bool averagedPositioning: false
   property int averagedPositioningMinimumCount: 1
   property bool averagedPositioningAutomaticStop: true
+  property bool averagedPositioningOutlierRejection: false
 
   property real antennaHeight: 0.0
   property bool antennaHeightActivated: false
@@ -65,18 +65,26 @@ Dialog {
             text: qsTr("Create Backup")
             icon.source: "qrc:/themes/sigpacgo/nodpi/ic_backup_white_24dp.svg"
             Layout.fillWidth: true
+            visible: !projectBackupManager.busy
             enabled: !backupProgress.visible
             onClicked: {
                 backupProgress.visible = true;
                 progressLabel.visible = true;
-                if (projectBackupManager.createBackup(
+                // The backup is created in the background, the list is reloaded once it completes
+                projectBackupManager.createBackup(
                     currentProjectPath, 
                     fullBackupMode.checked ? 1 : 0  // ProjectAndGpkg : ProjectOnly
-                )) {
-                    backupListModel.reload();
-                }
+                );
             }
         }
+
+        // Cancel button
+        Button {
+            text: qsTr("Cancel Backup")
+            Layout.fillWidth: true
+            visible: projectBackupManager.busy
+            onClicked: projectBackupManager.cancelBackup()
+        }
         
         // List of backups
         ListView {
@@ -175,11 +183,10 @@ Dialog {
         }
         
         onAccepted: {
-            if (projectBackupManager.restoreBackup(backupPath, currentProjectPath)) {
+            // The project is closed while its files are replaced, and reopened afterwards
+            if (iface.restoreProjectBackup(projectBackupManager, backupPath)) {
                 showToast(qsTr("Backup restored successfully"));
                 backupDialog.close();
-                // Reload the project
-                qgisProject.read(currentProjectPath);
             }
         }
     }
@@ -201,6 +208,10 @@ Dialog {
             }
         }
         
+        function onBackupCreated(path) {
+            backupListModel.reload();
+        }
+        
         function onBackupError(error) {
             toast.show(error);
             backupProgress.visible = false;
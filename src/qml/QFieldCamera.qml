@@ -19,6 +19,8 @@ Popup {
 
   property string currentPath: ''
   property var currentPosition: PositioningUtils.createEmptyGnssPositionInformation()
+  // Photos larger than this are downsized while being processed, 0 keeps their size
+  property int maximumImageWidthHeight: 0
 
   signal finished(string path)
   signal canceled
@@ -220,6 +222,21 @@ Popup {
     positionInformation: currentPosition ? currentPosition : null
   }
 
+  PhotoPipeline {
+    id: photoPipeline
+
+    //! Paths of the accepted photos being processed, each one finished once processed
+    property var acceptedPaths: []
+
+    onProcessed: (imagePath, success) => {
+      const index = acceptedPaths.indexOf(imagePath);
+      if (index >= 0) {
+        acceptedPaths.splice(index, 1);
+        cameraItem.finished(imagePath);
+      }
+    }
+  }
+
   Page {
     width: parent.width
     height: parent.height
@@ -963,17 +980,37 @@ Popup {
                   }
                 } else if (cameraItem.state == "PhotoPreview" || cameraItem.state == "VideoPreview") {
                   if (cameraItem.state == "PhotoPreview") {
+                    if (photoPipeline.acceptedPaths.indexOf(currentPath) >= 0) {
+                      // The accepted photo is still being processed, finished() follows once done
+                      displayToast(qsTr("The photo is still being processed"));
+                      return;
+                    }
+                    let operations = {};
+                    if (cameraItem.maximumImageWidthHeight > 0) {
+                      operations["maximumWidthHeight"] = cameraItem.maximumImageWidthHeight;
+                    }
                     if (cameraSettings.geoTagging && positionSource.active) {
-                      FileUtils.addImageMetadata(currentPath, currentPosition);
-                      // Set the Make to SIGPACGO instead of QField
-                      platformUtilities.setExifTag(currentPath, "Exif.Image.Make", "SIGPACGO");
-                      platformUtilities.setExifTag(currentPath, "Xmp.tiff.Make", "SIGPACGO");
+                      operations["positionInformation"] = currentPosition;
                     }
                     if (cameraSettings.stamping) {
-                      // Apply custom styling to the timestamp
-                      let stampText = stampExpressionEvaluator.evaluate();
-                      // Use only two parameters as per the updated FileUtils.addImageStamp function
-                      FileUtils.addImageStamp(currentPath, stampText);
+                      operations["stampText"] = metadataExpression.evaluate();
+                      operations["stampStyling"] = {
+                        "color": cameraSettings.stampTextColor,
+                        "backgroundColor": cameraSettings.stampBackgroundColor,
+                        "fontSize": cameraSettings.stampFontSize,
+                        "padding": 10,
+                        "position": "bottomLeft"
+                      };
+                    }
+                    if (Object.keys(operations).length > 0) {
+                      // Resizing, geotagging and stamping happen off the UI thread, finished() is emitted once done
+                      if (!photoPipeline.process(currentPath, operations)) {
+                        // Only a full queue holds the photo back, earlier ones being processed meanwhile
+                        displayToast(qsTr("Too many photos are being processed, please try again in a moment"), "warning");
+                        return;
+                      }
+                      photoPipeline.acceptedPaths.push(currentPath);
+                      return;
                     }
                   }
                   cameraItem.finished(currentPath);
@@ -1823,12 +1860,20 @@ Popup {
       anchors.centerIn: parent
       color: cameraSettings.stampTextColor
       font.pixelSize: cameraSettings.stampFontSize
-      text: stampExpressionEvaluator.evaluate()
       wrapMode: Text.WordWrap
       width: parent.width - 20
       horizontalAlignment: Text.AlignLeft
       leftPadding: 10
     }
+
+    // The stamp holds the current time and position, it is refreshed while shown
+    Timer {
+      interval: 1000
+      repeat: true
+      triggeredOnStart: true
+      running: stampBackground.visible && cameraItem.visible
+      onTriggered: dateStamp.text = metadataExpression.evaluate()
+    }
   }
 
   // Improved rectangular accuracy indicator for camera
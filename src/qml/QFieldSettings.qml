@@ -26,6 +26,7 @@ Page {
   property alias enableInfoCollection: registry.enableInfoCollection
   property alias enableMapRotation: registry.enableMapRotation
   property alias quality: registry.quality
+  property alias tiledRendering: registry.tiledRendering
   property alias snapToCommonAngleIsEnabled: registry.snapToCommonAngleIsEnabled
   property alias snapToCommonAngleIsRelative: registry.snapToCommonAngleIsRelative
   property alias snapToCommonAngleDegrees: registry.snapToCommonAngleDegrees
@@ -77,6 +78,7 @@ Page {
     property bool enableInfoCollection: false
     property bool enableMapRotation: true
     property double quality: 1.0
+    property bool tiledRendering: false
     property string sentinelInstanceId: settings ? settings.value("SIGPACGO/Sentinel/InstanceId", "") : ""
     property bool enableSentinelLayers: settings ? settings.valueBool("SIGPACGO/Sentinel/EnableLayers", true) : true
 
@@ -121,6 +123,12 @@ Page {
       settingAlias: "enableMapRotation"
       isVisible: true
     }
+    ListElement {
+      title: qsTr("Renderizado por teselas")
+      description: qsTr("Reutiliza las zonas ya dibujadas al desplazar el mapa. Las etiquetas pueden cortarse en los bordes de las teselas.")
+      settingAlias: "tiledRendering"
+      isVisible: true
+    }
   }
 
   ListModel {
@@ -1441,6 +1449,34 @@ Page {
                 }
               }
 
+              Label {
+                text: qsTr("Descartar posiciones atípicas del promedio")
+                font: Theme.defaultFont
+                color: Theme.mainTextColor
+                wrapMode: Text.WordWrap
+                Layout.fillWidth: true
+                enabled: averagedPositioning.checked
+                visible: averagedPositioning.checked
+                Layout.leftMargin: 8
+
+                MouseArea {
+                  anchors.fill: parent
+                  onClicked: averagedPositioningOutlierRejection.toggle()
+                }
+              }
+
+              QfSwitch {
+                id: averagedPositioningOutlierRejection
+                Layout.preferredWidth: implicitContentWidth
+                Layout.alignment: Qt.AlignTop
+                enabled: averagedPositioning.checked
+                visible: averagedPositioning.checked
+                checked: positioningSettings.averagedPositioningOutlierRejection
+                onCheckedChanged: {
+                  positioningSettings.averagedPositioningOutlierRejection = checked;
+                }
+              }
+
               Label {
                 text: qsTr("Con posición promediada, al digitalizar vértices solo se aceptará un promedio de posiciones recolectadas. Mantenga presionado el botón para recolectar posiciones.")
                 font: Theme.tipFont
@@ -562,6 +562,7 @@ EditorWidgetBase {
     QFieldCamera {
       id: qfieldCamera
       visible: false
+      maximumImageWidthHeight: iface.readProjectNumEntry("qfieldsync", "maximumImageWidthHeight", 0)
 
       Component.onCompleted: {
         if (isVideo) {
@@ -578,12 +579,6 @@ EditorWidgetBase {
         filepath = filepath.replace('{filename}', FileUtils.fileName(path));
         filepath = filepath.replace('{extension}', FileUtils.fileSuffix(path));
         platformUtilities.renameFile(path, prefixToRelativePath + filepath);
-        if (!cameraLoader.isVideo) {
-          var maximumWidhtHeight = iface.readProjectNumEntry("qfieldsync", "maximumImageWidthHeight", 0);
-          if (maximumWidhtHeight > 0) {
-            FileUtils.restrictImageSize(prefixToRelativePath + filepath, maximumWidhtHeight);
-          }
-        }
         valueChangeRequested(filepath, false);
         close();
       }
@@ -602,15 +597,33 @@ EditorWidgetBase {
     target: __resourceSource
     function onResourceReceived(path) {
       if (path) {
-        var maximumWidhtHeight = iface.readProjectNumEntry("qfieldsync", "maximumImageWidthHeight", 0);
-        if (maximumWidhtHeight > 0) {
-          FileUtils.restrictImageSize(prefixToRelativePath + path, maximumWidhtHeight);
+        var maximumWidthHeight = iface.readProjectNumEntry("qfieldsync", "maximumImageWidthHeight", 0);
+        if (maximumWidthHeight > 0) {
+          // The value changes once the resource is resized off the UI thread
+          if (resourcePipeline.process(prefixToRelativePath + path, {
+              "maximumWidthHeight": maximumWidthHeight
+            })) {
+            return;
+          }
+          resourcePipeline.processNow(prefixToRelativePath + path, {
+              "maximumWidthHeight": maximumWidthHeight
+            });
         }
         valueChangeRequested(path, false);
       }
     }
   }
 
+  PhotoPipeline {
+    id: resourcePipeline
+
+    onProcessed: (imagePath, success) => {
+      if (imagePath.startsWith(prefixToRelativePath)) {
+        valueChangeRequested(imagePath.substring(prefixToRelativePath.length), false);
+      }
+    }
+  }
+
   Connections {
     target: __viewStatus
 
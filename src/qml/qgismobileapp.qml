@@ -373,6 +373,7 @@ ApplicationWindow {
 
     elevationCorrectionMode: positioningSettings.elevationCorrectionMode
     antennaHeight: positioningSettings.antennaHeightActivated ? positioningSettings.antennaHeight : 0
+    averagedPositionOutlierRejection: positioningSettings.averagedPositioningOutlierRejection
     logging: positioningSettings.logging
 
     onPositionInformationChanged: {
@@ -414,10 +415,18 @@ ApplicationWindow {
     repeat: false
     onTriggered: {
       mapCanvasMap.freeze('trackerreplay');
-      let list = positionSource.getBackgroundPositionInformation();
-      // Qt bug weirdly returns an empty list on first invokation to source, call twice to insure we've got the actual list
-      list = positionSource.getBackgroundPositionInformation();
-      trackingModel.replayPositionInformationList(list, positionSource.coordinateTransformer);
+      trackingModel.replayPositionInformationSession(positionSource.backgroundSessionFilePath, positionSource.coordinateTransformer);
+    }
+  }
+
+  Connections {
+    target: trackingModel
+
+    function onReplayProgressChanged(progress) {
+      busyOverlay.progress = progress;
+    }
+
+    function onReplayFinished() {
       mapCanvasMap.unfreeze('trackerreplay');
       busyOverlay.state = "hidden";
     }
@@ -673,6 +682,7 @@ ApplicationWindow {
       isMapRotationEnabled: qfieldSettings.enableMapRotation
       incrementalRendering: true
       quality: qfieldSettings.quality
+      tiledRendering: qfieldSettings.tiledRendering
       forceDeferredLayersRepaint: trackings.count > 0
       freehandDigitizing: freehandButton.freehandDigitizing && freehandHandler.active
 
@@ -3758,6 +3768,22 @@ ApplicationWindow {
       }
     }
 
+    MenuItem {
+      text: qsTr("Offline Maps")
+      visible: !!qgisProject
+
+      font: Theme.defaultFont
+      icon.source: Theme.getThemeVectorIcon("ic_map_white_24dp")
+      height: 48
+      leftPadding: Theme.menuItemLeftPadding
+
+      onTriggered: {
+        dashBoard.close();
+        offlinePacksPanel.open();
+        highlighted = false;
+      }
+    }
+
     MenuItem {
       text: qsTr("Create DCIM Folder")
       visible: qgisProject && !!qgisProject.homePath
@@ -6138,6 +6164,11 @@ ApplicationWindow {
     id: trackerSettings
   }
 
+  OfflinePacksPanel {
+    id: offlinePacksPanel
+    mapSettings: mapCanvas.mapSettings
+  }
+
   
 
   
@@ -6555,35 +6586,6 @@ ApplicationWindow {
     // Move the file to the destination folder
     platformUtilities.renameFile(path, qgisProject.homePath + '/' + relativePath);
     
-    // Add metadata and stamping if enabled
-    try {
-      if (standaloneCameraLoader.active && standaloneCameraLoader.item && 
-          standaloneCameraLoader.item.cameraSettings) {
-        let camera = standaloneCameraLoader.item;
-        
-        if (camera.cameraSettings.geoTagging && positionSource.active && camera.currentPosition) {
-          FileUtils.addImageMetadata(qgisProject.homePath + '/' + relativePath, camera.currentPosition);
-          // Set the Make to SIGPACGO
-          platformUtilities.setExifTag(qgisProject.homePath + '/' + relativePath, "Exif.Image.Make", "SIGPACGO");
-          platformUtilities.setExifTag(qgisProject.homePath + '/' + relativePath, "Xmp.tiff.Make", "SIGPACGO");
-        }
-        
-        if (camera.cameraSettings.stamping && camera.stampExpressionEvaluator) {
-          let stampText = camera.stampExpressionEvaluator.evaluate();
-          let styledStamp = {
-            "color": camera.cameraSettings.stampTextColor || "#FFFF00",
-            "backgroundColor": camera.cameraSettings.stampBackgroundColor || "#80000000",
-            "fontSize": camera.cameraSettings.stampFontSize || 24,
-            "padding": 10,
-            "position": "bottomLeft"
-          };
-          FileUtils.addImageStamp(qgisProject.homePath + '/' + relativePath, stampText, styledStamp);
-        }
-      }
-    } catch (e) {
-      console.log("Error applying metadata or stamping: " + e);
-    }
-    
     // Display a toast with the saved location
     displayToast(qsTr("Foto guardada en ") + folderName);
   }
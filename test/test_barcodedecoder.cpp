@@ -0,0 +1,119 @@
+/***************************************************************************
+                        test_barcodedecoder.cpp
+                        --------------------
+  begin                : Oct 2026
+  copyright            : (C) 2026 by SIGPACGO contributors
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "barcodedecoder.h"
+#include "catch2.h"
+
+#include <QImage>
+#include <QVideoFrame>
+
+#include <ZXing/BitMatrix.h>
+#include <ZXing/MultiFormatWriter.h>
+
+#include <cstring>
+
+namespace
+{
+  const QString sText = QStringLiteral( "SIGPACGO" );
+
+  //! Returns a luminance image holding a QR code of sText on its right half
+  QImage barcodeImage()
+  {
+    ZXing::MultiFormatWriter writer( ZXing::BarcodeFormat::QRCode );
+    writer.setMargin( 4 );
+    const ZXing::BitMatrix matrix = writer.encode( sText.toStdWString(), 0, 0 );
+
+    const int moduleSize = 4;
+    const int size = matrix.width() * moduleSize;
+    QImage image( 2 * size, size, QImage::Format_Grayscale8 );
+    image.fill( 255 );
+    for ( int y = 0; y < size; y++ )
+    {
+      uchar *line = image.scanLine( y );
+      for ( int x = 0; x < size; x++ )
+        line[size + x] = matrix.get( x / moduleSize, y / moduleSize ) ? 0 : 255;
+    }
+    return image;
+  }
+
+  //! Returns a video frame of a given pixel \a format holding the luminance \a image
+  QVideoFrame videoFrame( const QImage &image, QVideoFrameFormat::PixelFormat format )
+  {
+    QVideoFrame frame( QVideoFrameFormat( image.size(), format ) );
+    REQUIRE( frame.map( QVideoFrame::WriteOnly ) );
+
+    // Chrominance is left neutral
+    for ( int plane = 1; plane < frame.planeCount(); plane++ )
+      std::memset( frame.bits( plane ), 128, frame.mappedBytes( plane ) );
+
+    for ( int y = 0; y < image.height(); y++ )
+    {
+      const uchar *source = image.constScanLine( y );
+      uchar *line = frame.bits( 0 ) + y * frame.bytesPerLine( 0 );
+      for ( int x = 0; x < image.width(); x++ )
+      {
+        switch ( format )
+        {
+          case QVideoFrameFormat::Format_YUYV:
+            line[2 * x] = source[x];
+            line[2 * x + 1] = 128;
+            break;
+          case QVideoFrameFormat::Format_UYVY:
+            line[2 * x] = 128;
+            line[2 * x + 1] = source[x];
+            break;
+          default:
+            line[x] = source[x];
+            break;
+        }
+      }
+    }
+
+    frame.unmap();
+    return frame;
+  }
+} // namespace
+
+TEST_CASE( "BarcodeDecoder" )
+{
+  const QImage image = barcodeImage();
+  const QRectF left( 0, 0, 0.5, 1 );
+  const QRectF right( 0.5, 0, 0.5, 1 );
+
+  SECTION( "LuminancePlane" )
+  {
+    for ( const QVideoFrameFormat::PixelFormat format : { QVideoFrameFormat::Format_Y8, QVideoFrameFormat::Format_NV12, QVideoFrameFormat::Format_YUV420P } )
+    {
+      const QVideoFrame frame = videoFrame( image, format );
+      REQUIRE( BarcodeDecoder::decodeFrame( frame ) == sText );
+      REQUIRE( BarcodeDecoder::decodeFrame( frame, right ) == sText );
+      REQUIRE( BarcodeDecoder::decodeFrame( frame, left ).isEmpty() );
+    }
+  }
+
+  SECTION( "PixelStride" )
+  {
+    // Packed frames interleave chrominance bytes before or after each luminance one
+    for ( const QVideoFrameFormat::PixelFormat format : { QVideoFrameFormat::Format_YUYV, QVideoFrameFormat::Format_UYVY } )
+    {
+      const QVideoFrame frame = videoFrame( image, format );
+      REQUIRE( frame.bytesPerLine( 0 ) >= 2 * image.width() );
+      REQUIRE( BarcodeDecoder::decodeFrame( frame ) == sText );
+      REQUIRE( BarcodeDecoder::decodeFrame( frame, right ) == sText );
+      REQUIRE( BarcodeDecoder::decodeFrame( frame, left ).isEmpty() );
+    }
+  }
+}
@@ -109,6 +109,7 @@ QJsonDocument normalizeSchema( const QString &json )
     return QJsonDocument();
 
   // normalize non-constant values
+  o.remove( QStringLiteral( "journalGeneration" ) );
   o.insert( QStringLiteral( "id" ), QStringLiteral( "11111111-1111-1111-1111-111111111111" ) );
   o.insert( QStringLiteral( "project" ), QStringLiteral( "projectId" ) );
   o.insert( QStringLiteral( "deltas" ), normalizeDeltasSchema( o.value( QStringLiteral( "deltas" ) ).toArray() ) );
@@ -662,12 +663,58 @@ TEST_CASE( "DeltaFileWrapper" )
     REQUIRE( dfw1.toFile() );
     REQUIRE( getDeltasArray( dfw1.toString() ).size() == 1 );
 
+    DeltaFileWrapper dfw2( project, fileName );
+    REQUIRE( !dfw2.hasError() );
+    REQUIRE( dfw2.count() == 1 );
+
+    REQUIRE( dfw1.compact() );
+
     QFile deltaFile( fileName );
     REQUIRE( deltaFile.open( QIODevice::ReadOnly ) );
     REQUIRE( getDeltasArray( deltaFile.readAll() ).size() == 1 );
   }
 
 
+  SECTION( "Journal" )
+  {
+    QString fileName = workDir.filePath( QUuid::createUuid().toString() );
+    DeltaFileWrapper dfw1( project, fileName );
+    dfw1.addCreate( layer->id(), layer->id(), QStringLiteral( "fid" ), QStringLiteral( "fid" ), QgsFeature( QgsFields(), 100 ) );
+    dfw1.addCreate( layer->id(), layer->id(), QStringLiteral( "fid" ), QStringLiteral( "fid" ), QgsFeature( QgsFields(), 101 ) );
+    dfw1.addDelete( layer->id(), layer->id(), QStringLiteral( "fid" ), QStringLiteral( "fid" ), QgsFeature( QgsFields(), 101 ) );
+
+    REQUIRE( dfw1.toFile() );
+    REQUIRE( dfw1.journalRecordCount() == 3 );
+    REQUIRE( QFileInfo::exists( dfw1.journalFileName() ) );
+
+    // the snapshot is left untouched, the changes only live in the journal
+    QFile deltaFile( fileName );
+    REQUIRE( deltaFile.open( QIODevice::ReadOnly ) );
+    REQUIRE( getDeltasArray( deltaFile.readAll() ).size() == 0 );
+    deltaFile.close();
+
+    DeltaFileWrapper dfw2( project, fileName );
+    REQUIRE( !dfw2.hasError() );
+    REQUIRE( dfw2.count() == 1 );
+    REQUIRE( dfw2.journalRecordCount() == 3 );
+
+    // a truncated tail is ignored on load
+    QFile journalFile( dfw1.journalFileName() );
+    REQUIRE( journalFile.resize( journalFile.size() - 1 ) );
+
+    DeltaFileWrapper dfw3( project, fileName );
+    REQUIRE( !dfw3.hasError() );
+    REQUIRE( dfw3.count() == 2 );
+
+    REQUIRE( dfw2.compact() );
+    REQUIRE( dfw2.journalRecordCount() == 0 );
+    REQUIRE( !QFileInfo::exists( dfw2.journalFileName() ) );
+
+    REQUIRE( deltaFile.open( QIODevice::ReadOnly ) );
+    REQUIRE( getDeltasArray( deltaFile.readAll() ).size() == 1 );
+  }
+
+
   SECTION( "Append" )
   {
     DeltaFileWrapper dfw1( project, workDir.filePath( QUuid::createUuid().toString() ) );
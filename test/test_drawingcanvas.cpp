@@ -0,0 +1,173 @@
+/***************************************************************************
+                        test_drawingcanvas.cpp
+                        --------------------
+  begin                : Oct 2026
+  copyright            : (C) 2026 by SIGPACGO contributors
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#define QFIELDTEST_MAIN
+#include "catch2.h"
+#include "drawingcanvas.h"
+
+#include <QPainter>
+
+namespace
+{
+  //! Item size fitting a 1000x1000 canvas at a zoom factor of 1
+  const QSizeF sItemSize( 1030, 1100 );
+  //! Position of the canvas top left corner within the item
+  const QPointF sCanvasTopLeft( 15, 50 );
+
+  void createCanvas( DrawingCanvas &canvas )
+  {
+    canvas.setSize( sItemSize );
+    canvas.createBlankCanvas( 1000, 1000 );
+  }
+
+  //! Draws a stroke between canvas points \a from and \a to
+  void drawStroke( DrawingCanvas &canvas, const QPointF &from, const QPointF &to, const QColor &color = QColor( 0, 0, 0 ) )
+  {
+    canvas.strokeBegin( sCanvasTopLeft + from, color );
+    canvas.strokeMove( sCanvasTopLeft + ( from + to ) / 2 );
+    canvas.strokeEnd( sCanvasTopLeft + to );
+  }
+
+  //! Draws the \a index th stroke of a sequence of distinct strokes
+  void drawNumberedStroke( DrawingCanvas &canvas, int index )
+  {
+    const double y = 20 + ( index * 23 ) % 940;
+    drawStroke( canvas, QPointF( 10 + ( index * 7 ) % 500, y ), QPointF( 990 - ( index * 11 ) % 500, y + 40 ), QColor::fromHsv( ( index * 37 ) % 360, 255, 200 ) );
+  }
+
+  QImage savedImage( const DrawingCanvas &canvas )
+  {
+    return QImage( canvas.save() ).convertToFormat( QImage::Format_ARGB32 );
+  }
+
+  QImage paintedImage( DrawingCanvas &canvas, const QRect &clip = QRect() )
+  {
+    QImage image( sItemSize.toSize(), QImage::Format_ARGB32 );
+    image.fill( Qt::transparent );
+    QPainter painter( &image );
+    if ( !clip.isNull() )
+      painter.setClipRect( clip );
+    canvas.paint( &painter );
+    painter.end();
+    return image;
+  }
+} // namespace
+
+TEST_CASE( "DrawingCanvas" )
+{
+  DrawingCanvas canvas;
+  createCanvas( canvas );
+  REQUIRE( canvas.zoomFactor() == 1.0 );
+  REQUIRE( !canvas.isDirty() );
+
+  SECTION( "Tiles" )
+  {
+    // A stroke across tile boundaries is drawn seamlessly on every tile it covers
+    drawStroke( canvas, QPointF( 10, 250 ), QPointF( 600, 250 ) );
+    drawStroke( canvas, QPointF( 512, 10 ), QPointF( 512, 700 ) );
+    REQUIRE( canvas.isDirty() );
+
+    const QImage image = savedImage( canvas );
+    REQUIRE( image.size() == QSize( 1000, 1000 ) );
+    for ( const int x : { 20, 255, 256, 257, 511, 590 } )
+      REQUIRE( qGray( image.pixel( x, 250 ) ) < 64 );
+    for ( const int y : { 20, 255, 256, 511, 512, 690 } )
+      REQUIRE( qGray( image.pixel( 512, y ) ) < 64 );
+
+    // Untouched tiles keep the background
+    REQUIRE( image.pixel( 100, 100 ) == qRgb( 255, 255, 255 ) );
+    REQUIRE( image.pixel( 900, 900 ) == qRgb( 255, 255, 255 ) );
+    REQUIRE( image.pixel( 800, 250 ) == qRgb( 255, 255, 255 ) );
+  }
+
+  SECTION( "Checkpoints" )
+  {
+    // Enough strokes to go through a couple of checkpoints
+    const int strokeCount = 40;
+    for ( int i = 0; i < strokeCount; i++ )
+      drawNumberedStroke( canvas, i );
+
+    // Undoing back past checkpoints gives the same result as never drawing the undone strokes
+    int remaining = strokeCount;
+    for ( const int expectedRemaining : { 35, 32, 31, 17, 15, 3 } )
+    {
+      for ( ; remaining > expectedRemaining; remaining-- )
+        canvas.undo();
+      REQUIRE( canvas.isDirty() );
+
+      DrawingCanvas reference;
+      createCanvas( reference );
+      for ( int i = 0; i < remaining; i++ )
+        drawNumberedStroke( reference, i );
+      REQUIRE( savedImage( canvas ) == savedImage( reference ) );
+    }
+
+    // Drawing after undoing resumes from the restored tiles
+    drawNumberedStroke( canvas, 20 );
+    DrawingCanvas reference;
+    createCanvas( reference );
+    for ( int i = 0; i < remaining; i++ )
+      drawNumberedStroke( reference, i );
+    drawNumberedStroke( reference, 20 );
+    REQUIRE( savedImage( canvas ) == savedImage( reference ) );
+
+    // Undoing every stroke gets the blank canvas back
+    for ( int i = 0; i <= remaining; i++ )
+      canvas.undo();
+    REQUIRE( !canvas.isDirty() );
+    const QImage image = savedImage( canvas );
+    for ( int y = 0; y < image.height(); y += 50 )
+      for ( int x = 0; x < image.width(); x += 50 )
+        REQUIRE( image.pixel( x, y ) == qRgb( 255, 255, 255 ) );
+  }
+
+  SECTION( "DeepUndo" )
+  {
+    // Far more strokes than checkpoints kept
+    const int strokeCount = 200;
+    for ( int i = 0; i < strokeCount; i++ )
+      drawNumberedStroke( canvas, i );
+
+    int remaining = strokeCount;
+    for ( const int expectedRemaining : { 150, 100, 96, 95, 64, 40, 39, 16, 1 } )
+    {
+      for ( ; remaining > expectedRemaining; remaining-- )
+        canvas.undo();
+
+      DrawingCanvas reference;
+      createCanvas( reference );
+      for ( int i = 0; i < remaining; i++ )
+        drawNumberedStroke( reference, i );
+      REQUIRE( savedImage( canvas ) == savedImage( reference ) );
+    }
+  }
+
+  SECTION( "PartialUpdates" )
+  {
+    drawStroke( canvas, QPointF( 10, 250 ), QPointF( 600, 250 ) );
+    drawStroke( canvas, QPointF( 240, 100 ), QPointF( 280, 400 ), QColor( 255, 0, 0 ) );
+
+    // Repainting an area only draws the tiles within it, to the same result as a full repaint
+    const QImage full = paintedImage( canvas );
+    const QRect area = QRect( sCanvasTopLeft.toPoint() + QPoint( 200, 200 ), QSize( 120, 120 ) );
+    const QImage partial = paintedImage( canvas, area );
+    REQUIRE( partial.copy( area ) == full.copy( area ) );
+
+    // Nothing is drawn outside of the repainted area
+    REQUIRE( qAlpha( partial.pixel( sCanvasTopLeft.toPoint() + QPoint( 500, 250 ) ) ) == 0 );
+    REQUIRE( qAlpha( full.pixel( sCanvasTopLeft.toPoint() + QPoint( 500, 250 ) ) ) == 255 );
+  }
+}
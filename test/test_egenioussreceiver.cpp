@@ -0,0 +1,162 @@
+/***************************************************************************
+                        test_egenioussreceiver.cpp
+                        --------------------
+  begin                : Oct 2026
+  copyright            : (C) 2026 by SIGPACGO contributors
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#define QFIELDTEST_MAIN
+#include "catch2.h"
+#include "egenioussframeparser.h"
+#include "egenioussreceiver.h"
+
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QTest>
+#include <QtEndian>
+
+#include <algorithm>
+
+namespace
+{
+  QByteArray frame( const QByteArray &payload )
+  {
+    QByteArray data( EgenioussFrameParser::HeaderSize, '\0' );
+    data[0] = static_cast<char>( EgenioussFrameParser::StartByte );
+    qToLittleEndian<quint32>( payload.size(), data.data() + 4 );
+    return data + payload;
+  }
+
+  const QByteArray samplePayload = QByteArrayLiteral( R"({"lat": 46.9481, "lon": 7.4474, "alt": 540.25, "src": "a \"quoted\" }", "sats": [{"id": 3}, {"id": 7}], "utc": 1760659200000000000, "q": 4})" );
+} // namespace
+
+TEST_CASE( "EgenioussFrameParser" )
+{
+  EgenioussFrameParser parser;
+  QByteArrayView payload;
+
+  SECTION( "Fragmented" )
+  {
+    const QByteArray stream = frame( samplePayload ) + frame( QByteArrayLiteral( "{}" ) );
+
+    // Frames straddling reads are completed by the following ones
+    QList<QByteArray> payloads;
+    for ( const char byte : stream )
+    {
+      parser.append( QByteArrayView( &byte, 1 ) );
+      while ( parser.nextPayload( payload ) )
+        payloads << payload.toByteArray();
+    }
+    REQUIRE( payloads == QList<QByteArray>( { samplePayload, QByteArrayLiteral( "{}" ) } ) );
+    REQUIRE( parser.bufferedSize() == 0 );
+    REQUIRE( parser.discardedBytes() == 0 );
+  }
+
+  SECTION( "Resynchronisation" )
+  {
+    // A start byte announcing an oversized payload isn't mistaken for a frame
+    QByteArray garbage = QByteArrayLiteral( "garbage" );
+    garbage += static_cast<char>( EgenioussFrameParser::StartByte );
+    garbage += QByteArray( 7, '\xff' );
+
+    parser.append( garbage + frame( samplePayload ) );
+    REQUIRE( parser.nextPayload( payload ) );
+    REQUIRE( payload.toByteArray() == samplePayload );
+    REQUIRE( parser.discardedBytes() == static_cast<quint64>( garbage.size() ) );
+    REQUIRE( !parser.nextPayload( payload ) );
+  }
+
+  SECTION( "Fix" )
+  {
+    EgenioussFrameParser::Fix fix;
+    REQUIRE( EgenioussFrameParser::parseFix( samplePayload, fix ) );
+    REQUIRE( fix.latitude == 46.9481 );
+    REQUIRE( fix.longitude == 7.4474 );
+    REQUIRE( fix.altitude == 540.25 );
+    REQUIRE( fix.utc == 1760659200000000000.0 );
+    REQUIRE( fix.quality == 4 );
+
+    REQUIRE( !EgenioussFrameParser::parseFix( QByteArrayLiteral( R"({"lat": 46.9481, "lon")" ), fix ) );
+    REQUIRE( !EgenioussFrameParser::parseFix( QByteArrayLiteral( R"(["lat", 46.9481])" ), fix ) );
+  }
+}
+
+TEST_CASE( "EgenioussReceiver" )
+{
+  QTcpServer server;
+  REQUIRE( server.listen( QHostAddress::LocalHost, 1235 ) );
+
+  EgenioussReceiver receiver;
+  QList<GnssPositionInformation> positions;
+  QObject::connect( &receiver, &AbstractGnssReceiver::lastGnssPositionInformationChanged, &receiver, [&positions]( const GnssPositionInformation &position ) { positions << position; } );
+
+  receiver.connectDevice();
+  REQUIRE( QTest::qWaitFor( [&server] { return server.hasPendingConnections(); }, 2000 ) );
+  QTcpSocket *socket = server.nextPendingConnection();
+
+  SECTION( "Stream" )
+  {
+    constexpr int frameCount = 3;
+    QByteArray stream;
+    for ( int i = 0; i < frameCount; ++i )
+      stream += frame( samplePayload );
+
+    // Segments cutting through headers and payloads
+    for ( qsizetype offset = 0; offset < stream.size(); offset += 5 )
+    {
+      socket->write( stream.constData() + offset, std::min<qsizetype>( 5, stream.size() - offset ) );
+      socket->flush();
+      QTest::qWait( 1 );
+    }
+
+    REQUIRE( QTest::qWaitFor( [&positions] { return positions.size() == frameCount; }, 2000 ) );
+    REQUIRE( positions.last().latitude() == 46.9481 );
+    REQUIRE( positions.last().longitude() == 7.4474 );
+    REQUIRE( receiver.lastError().isEmpty() );
+    REQUIRE( receiver.details().names() == QList<QString>( { QStringLiteral( "q" ) } ) );
+    REQUIRE( receiver.details().values().first().toDouble() == 4 );
+  }
+}
+
+TEST_CASE( "EgenioussReceiverThroughput", "[.benchmark]" )
+{
+  constexpr int frameCount = 10000;
+  constexpr qsizetype segmentSize = 1400;
+
+  QTcpServer server;
+  REQUIRE( server.listen( QHostAddress::LocalHost, 1235 ) );
+
+  EgenioussReceiver receiver;
+  int fixes = 0;
+  QObject::connect( &receiver, &AbstractGnssReceiver::lastGnssPositionInformationChanged, &receiver, [&fixes] { fixes++; } );
+
+  receiver.connectDevice();
+  REQUIRE( QTest::qWaitFor( [&server] { return server.hasPendingConnections(); }, 2000 ) );
+  QTcpSocket *socket = server.nextPendingConnection();
+
+  QByteArray stream;
+  for ( int i = 0; i < frameCount; ++i )
+    stream += frame( samplePayload );
+
+  BENCHMARK( "Stream 10000 fixes in TCP sized segments" )
+  {
+    fixes = 0;
+    for ( qsizetype offset = 0; offset < stream.size(); offset += segmentSize )
+      socket->write( stream.constData() + offset, std::min( segmentSize, stream.size() - offset ) );
+    socket->flush();
+
+    QTest::qWaitFor( [&fixes] { return fixes == frameCount; }, 10000 );
+    return fixes;
+  };
+
+  REQUIRE( fixes == frameCount );
+}
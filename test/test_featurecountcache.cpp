@@ -0,0 +1,205 @@
+/***************************************************************************
+                        test_featurecountcache.cpp
+                        --------------------
+  begin                : Oct 2026
+  copyright            : (C) 2026 by SIGPACGO contributors
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#define QFIELDTEST_MAIN
+#include "catch2.h"
+#include "featurecountcache.h"
+#include "layerobserver.h"
+
+#include <QFile>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QTemporaryDir>
+#include <QTest>
+#include <qgscategorizedsymbolrenderer.h>
+#include <qgsgeometry.h>
+#include <qgspoint.h>
+#include <qgsproject.h>
+#include <qgsrenderer.h>
+#include <qgssinglesymbolrenderer.h>
+#include <qgssymbol.h>
+#include <qgsvectorfilewriter.h>
+#include <qgsvectorlayer.h>
+
+namespace
+{
+  QgsFeature pointFeature( const QgsFields &fields, int id )
+  {
+    QgsFeature feature( fields );
+    feature.setAttribute( QStringLiteral( "id" ), id );
+    feature.setGeometry( QgsGeometry( new QgsPoint( id, id ) ) );
+    return feature;
+  }
+} // namespace
+
+TEST_CASE( "FeatureCountCache" )
+{
+  QTemporaryDir dir;
+  REQUIRE( dir.isValid() );
+
+  const QString gpkgPath = dir.filePath( QStringLiteral( "parcels.gpkg" ) );
+  {
+    QgsVectorLayer memoryLayer( QStringLiteral( "Point?crs=EPSG:3857&field=id:integer" ), QStringLiteral( "parcels" ), QStringLiteral( "memory" ) );
+    REQUIRE( memoryLayer.startEditing() );
+    for ( int i = 1; i <= 3; i++ )
+      REQUIRE( memoryLayer.addFeature( pointFeature( memoryLayer.fields(), i ) ) );
+    REQUIRE( memoryLayer.commitChanges() );
+
+    QgsVectorFileWriter::SaveVectorOptions options;
+    options.driverName = QStringLiteral( "GPKG" );
+    options.layerName = QStringLiteral( "parcels" );
+    REQUIRE( QgsVectorFileWriter::writeAsVectorFormatV3( &memoryLayer, gpkgPath, QgsProject::instance()->transformContext(), options ) == QgsVectorFileWriter::NoError );
+  }
+
+  const QString projectPath = dir.filePath( QStringLiteral( "project.qgs" ) );
+  {
+    QFile projectFile( projectPath );
+    REQUIRE( projectFile.open( QIODevice::WriteOnly ) );
+  }
+
+  QgsVectorLayer *layer = new QgsVectorLayer( QStringLiteral( "%1|layername=parcels" ).arg( gpkgPath ), QStringLiteral( "parcels" ), QStringLiteral( "ogr" ) );
+  REQUIRE( layer->isValid() );
+  const QString ruleKey = layer->renderer()->legendSymbolItems().first().ruleKey();
+
+  QgsProject project;
+  LayerObserver layerObserver( &project );
+  FeatureCountCache cache( &project, &layerObserver );
+  project.setFileName( projectPath );
+  REQUIRE( project.addMapLayer( layer ) );
+
+  // Counted in the background
+  REQUIRE( cache.featureCount( layer ) == -1 );
+  REQUIRE( QTest::qWaitFor( [&] { return cache.featureCount( layer ) == 3; }, 5000 ) );
+  REQUIRE( cache.symbolFeatureCount( layer, ruleKey ) == 3 );
+
+  SECTION( "CommitDeltas" )
+  {
+    // Totals are adjusted as soon as the commit is reported, symbols once the added features are classified
+    REQUIRE( layer->startEditing() );
+    REQUIRE( layer->addFeature( pointFeature( layer->fields(), 4 ) ) );
+    REQUIRE( layer->addFeature( pointFeature( layer->fields(), 5 ) ) );
+    REQUIRE( layer->commitChanges() );
+    REQUIRE( cache.featureCount( layer ) == 5 );
+    REQUIRE( QTest::qWaitFor( [&] { return cache.symbolFeatureCount( layer, ruleKey ) == 5; }, 5000 ) );
+
+    QgsFeature feature;
+    REQUIRE( layer->getFeatures().nextFeature( feature ) );
+    REQUIRE( layer->startEditing() );
+    REQUIRE( layer->deleteFeature( feature.id() ) );
+    REQUIRE( layer->commitChanges() );
+    REQUIRE( cache.featureCount( layer ) == 4 );
+    REQUIRE( QTest::qWaitFor( [&] { return cache.symbolFeatureCount( layer, ruleKey ) == 4; }, 5000 ) );
+  }
+
+  SECTION( "ChangeDeltas" )
+  {
+    QgsCategorizedSymbolRenderer *renderer = new QgsCategorizedSymbolRenderer( QStringLiteral( "\"id\" % 2" ) );
+    renderer->addCategory( QgsRendererCategory( 1, QgsSymbol::defaultSymbol( layer->geometryType() ), QStringLiteral( "odd" ) ) );
+    renderer->addCategory( QgsRendererCategory( 0, QgsSymbol::defaultSymbol( layer->geometryType() ), QStringLiteral( "even" ) ) );
+    layer->setRenderer( renderer );
+
+    QString oddKey;
+    QString evenKey;
+    const QgsLegendSymbolList legendSymbolItems = layer->renderer()->legendSymbolItems();
+    for ( const QgsLegendSymbolItem &item : legendSymbolItems )
+      ( item.label() == QLatin1String( "odd" ) ? oddKey : evenKey ) = item.ruleKey();
+    REQUIRE( QTest::qWaitFor( [&] { return cache.symbolFeatureCount( layer, oddKey ) == 2; }, 5000 ) );
+    REQUIRE( cache.symbolFeatureCount( layer, evenKey ) == 1 );
+
+    // Modified and deleted features leave their symbols as soon as the commit is reported, without recounting the layer
+    QgsFeature feature;
+    REQUIRE( layer->getFeatures( QgsFeatureRequest().setFilterExpression( QStringLiteral( "\"id\" = 1" ) ) ).nextFeature( feature ) );
+    const QgsFeatureId modifiedFid = feature.id();
+    REQUIRE( layer->getFeatures( QgsFeatureRequest().setFilterExpression( QStringLiteral( "\"id\" = 2" ) ) ).nextFeature( feature ) );
+    const QgsFeatureId deletedFid = feature.id();
+    REQUIRE( layer->startEditing() );
+    REQUIRE( layer->changeAttributeValue( modifiedFid, layer->fields().lookupField( QStringLiteral( "id" ) ), 4 ) );
+    REQUIRE( layer->deleteFeature( deletedFid ) );
+    REQUIRE( layer->commitChanges() );
+    REQUIRE( cache.featureCount( layer ) == 2 );
+    REQUIRE( cache.symbolFeatureCount( layer, oddKey ) == 1 );
+    REQUIRE( cache.symbolFeatureCount( layer, evenKey ) == 0 );
+
+    // Then get into the ones they are classified into
+    REQUIRE( QTest::qWaitFor( [&] { return cache.symbolFeatureCount( layer, evenKey ) == 1; }, 5000 ) );
+    REQUIRE( cache.symbolFeatureCount( layer, oddKey ) == 1 );
+  }
+
+  SECTION( "Rollback" )
+  {
+    REQUIRE( layer->startEditing() );
+    REQUIRE( layer->addFeature( pointFeature( layer->fields(), 4 ) ) );
+
+    // A renderer change while editing has the counts include the uncommitted feature
+    QgsSymbol *symbol = QgsSymbol::defaultSymbol( layer->geometryType() );
+    symbol->setColor( Qt::red );
+    layer->setRenderer( new QgsSingleSymbolRenderer( symbol ) );
+    const QString editedRuleKey = layer->renderer()->legendSymbolItems().first().ruleKey();
+    REQUIRE( cache.symbolFeatureCount( layer, editedRuleKey ) == -1 );
+    REQUIRE( QTest::qWaitFor( [&] { return cache.symbolFeatureCount( layer, editedRuleKey ) == 4; }, 5000 ) );
+    REQUIRE( cache.featureCount( layer ) == 4 );
+
+    // Rolling back gets the counts back to the committed features
+    REQUIRE( layer->rollBack() );
+    REQUIRE( QTest::qWaitFor( [&] { return cache.featureCount( layer ) == 3; }, 5000 ) );
+    REQUIRE( cache.symbolFeatureCount( layer, editedRuleKey ) == 3 );
+  }
+
+  SECTION( "Persistence" )
+  {
+    REQUIRE( layer->startEditing() );
+    REQUIRE( layer->addFeature( pointFeature( layer->fields(), 4 ) ) );
+    REQUIRE( layer->commitChanges() );
+    REQUIRE( QTest::qWaitFor( [&] { return cache.symbolFeatureCount( layer, ruleKey ) == 4; }, 5000 ) );
+
+    // The counts are persisted once the revision of the committed data is known
+    REQUIRE( QTest::qWaitFor( [&] {
+      QFile sidecar( dir.filePath( QStringLiteral( ".project.counts.json" ) ) );
+      if ( !sidecar.open( QIODevice::ReadOnly ) )
+        return false;
+      const QJsonObject layerCounts = QJsonDocument::fromJson( sidecar.readAll() ).object().value( layer->id() ).toObject();
+      return layerCounts.value( QStringLiteral( "total" ) ).toInt() == 4;
+    },
+                               5000 ) );
+
+    // Reopening the unchanged project serves the persisted counts without counting
+    QgsProject reopenedProject;
+    LayerObserver reopenedLayerObserver( &reopenedProject );
+    FeatureCountCache reopenedCache( &reopenedProject, &reopenedLayerObserver );
+    reopenedProject.setFileName( projectPath );
+    REQUIRE( project.takeMapLayer( layer ) == layer );
+    REQUIRE( reopenedProject.addMapLayer( layer ) );
+    REQUIRE( reopenedCache.featureCount( layer ) == 4 );
+    REQUIRE( reopenedCache.symbolFeatureCount( layer, ruleKey ) == 4 );
+
+    // Changes made behind the back of the project are detected in the background, the persisted counts being shown meanwhile
+    REQUIRE( reopenedProject.takeMapLayer( layer ) == layer );
+    {
+      QgsVectorLayer otherLayer( QStringLiteral( "%1|layername=parcels" ).arg( gpkgPath ), QStringLiteral( "parcels" ), QStringLiteral( "ogr" ) );
+      REQUIRE( otherLayer.startEditing() );
+      REQUIRE( otherLayer.addFeature( pointFeature( otherLayer.fields(), 5 ) ) );
+      REQUIRE( otherLayer.commitChanges() );
+    }
+    QgsProject changedProject;
+    LayerObserver changedLayerObserver( &changedProject );
+    FeatureCountCache changedCache( &changedProject, &changedLayerObserver );
+    changedProject.setFileName( projectPath );
+    REQUIRE( changedProject.addMapLayer( layer ) );
+    REQUIRE( changedCache.featureCount( layer ) == 4 );
+    REQUIRE( QTest::qWaitFor( [&] { return changedCache.featureCount( layer ) == 5; }, 5000 ) );
+    REQUIRE( changedCache.symbolFeatureCount( layer, ruleKey ) == 5 );
+  }
+}
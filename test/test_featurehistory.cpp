@@ -0,0 +1,174 @@
+/***************************************************************************
+                        test_featurehistory.cpp
+                        --------------------
+  begin                : Oct 2026
+  copyright            : (C) 2026 by SIGPACGO contributors
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#define QFIELDTEST_MAIN
+#include "catch2.h"
+#include "featurehistory.h"
+#include "trackingmodel.h"
+
+#include <QFile>
+#include <QSignalSpy>
+#include <QTemporaryDir>
+#include <qgsgeometry.h>
+#include <qgsproject.h>
+#include <qgsvectorlayer.h>
+
+namespace
+{
+  //! Waits for the pending changes of a \a history to be recorded as an undo step
+  bool waitForStep( FeatureHistory *history )
+  {
+    QSignalSpy spy( history, &FeatureHistory::isUndoAvailableChanged );
+    return spy.wait( 1000 );
+  }
+
+  QgsFeature onlyFeature( QgsVectorLayer *layer )
+  {
+    QgsFeature feature;
+    layer->getFeatures().nextFeature( feature );
+    return feature;
+  }
+} // namespace
+
+
+TEST_CASE( "FeatureHistory" )
+{
+  SECTION( "GeometryDelta" )
+  {
+    const QByteArray before = QgsGeometry::fromWkt( QStringLiteral( "Polygon ((0 0, 10 0, 10 10, 0 10, 0 0))" ) ).asWkb();
+    const QByteArray after = QgsGeometry::fromWkt( QStringLiteral( "Polygon ((0 0, 10 0, 12 11, 0 10, 0 0))" ) ).asWkb();
+
+    int offset = 0;
+    QByteArray beforeBytes;
+    QByteArray afterBytes;
+    FeatureHistory::bytesDelta( before, after, offset, beforeBytes, afterBytes );
+
+    // Only the moved vertex is kept
+    REQUIRE( afterBytes.size() <= 16 );
+    REQUIRE( beforeBytes.size() == afterBytes.size() );
+
+    QByteArray wkb = after;
+    REQUIRE( FeatureHistory::applyBytesDelta( wkb, offset, afterBytes, beforeBytes ) );
+    REQUIRE( wkb == before );
+    REQUIRE( FeatureHistory::applyBytesDelta( wkb, offset, beforeBytes, afterBytes ) );
+    REQUIRE( wkb == after );
+
+    // A delta doesn't apply to bytes it wasn't computed from
+    REQUIRE( !FeatureHistory::applyBytesDelta( wkb, offset, beforeBytes, afterBytes ) );
+  }
+
+  SECTION( "NullGeometryDelta" )
+  {
+    const QByteArray after = QgsGeometry::fromWkt( QStringLiteral( "Point (1 2)" ) ).asWkb();
+
+    int offset = 0;
+    QByteArray beforeBytes;
+    QByteArray afterBytes;
+    FeatureHistory::bytesDelta( QByteArray(), after, offset, beforeBytes, afterBytes );
+
+    QByteArray wkb = after;
+    REQUIRE( FeatureHistory::applyBytesDelta( wkb, offset, afterBytes, beforeBytes ) );
+    REQUIRE( wkb.isEmpty() );
+  }
+
+  SECTION( "JournalUndoRedo" )
+  {
+    QTemporaryDir dir;
+    REQUIRE( dir.isValid() );
+    const QString projectPath = dir.filePath( QStringLiteral( "project.qgs" ) );
+    {
+      QFile projectFile( projectPath );
+      REQUIRE( projectFile.open( QIODevice::WriteOnly ) );
+    }
+
+    QgsVectorLayer *layer = new QgsVectorLayer( QStringLiteral( "Point?crs=EPSG:3857&field=name:string" ), QStringLiteral( "points" ), QStringLiteral( "memory" ) );
+    REQUIRE( layer->isValid() );
+
+    TrackingModel trackingModel;
+    QgsProject project;
+    std::unique_ptr<FeatureHistory> history = std::make_unique<FeatureHistory>( &project, &trackingModel );
+    project.setFileName( projectPath );
+    REQUIRE( project.addMapLayer( layer ) );
+    REQUIRE( !history->isUndoAvailable() );
+
+    // Create a feature, then update its attribute and geometry
+    QgsFeature feature( layer->fields() );
+    feature.setAttribute( QStringLiteral( "name" ), QStringLiteral( "before" ) );
+    feature.setGeometry( QgsGeometry::fromWkt( QStringLiteral( "Point (1 2)" ) ) );
+    REQUIRE( layer->startEditing() );
+    REQUIRE( layer->addFeature( feature ) );
+    REQUIRE( layer->commitChanges() );
+    REQUIRE( waitForStep( history.get() ) );
+    REQUIRE( history->isUndoAvailable() );
+
+    const QgsFeatureId fid = onlyFeature( layer ).id();
+    REQUIRE( layer->startEditing() );
+    REQUIRE( layer->changeAttributeValue( fid, 0, QStringLiteral( "after" ) ) );
+    REQUIRE( layer->changeGeometry( fid, QgsGeometry::fromWkt( QStringLiteral( "Point (3 4)" ) ) ) );
+    REQUIRE( layer->commitChanges() );
+    REQUIRE( waitForStep( history.get() ) );
+
+    // The steps are journaled next to the project
+    REQUIRE( QFile::exists( dir.filePath( QStringLiteral( ".project.history.sqlite" ) ) ) );
+
+    SECTION( "UndoRedo" )
+    {
+      REQUIRE( history->undo() );
+      REQUIRE( onlyFeature( layer ).attribute( QStringLiteral( "name" ) ) == QStringLiteral( "before" ) );
+      REQUIRE( onlyFeature( layer ).geometry().asWkt() == QStringLiteral( "Point (1 2)" ) );
+      REQUIRE( history->isRedoAvailable() );
+
+      REQUIRE( history->redo() );
+      REQUIRE( onlyFeature( layer ).attribute( QStringLiteral( "name" ) ) == QStringLiteral( "after" ) );
+      REQUIRE( onlyFeature( layer ).geometry().asWkt() == QStringLiteral( "Point (3 4)" ) );
+      REQUIRE( !history->isRedoAvailable() );
+
+      // Undoing the creation removes the feature, redoing it restores the feature as created
+      REQUIRE( history->undo() );
+      REQUIRE( history->undo() );
+      REQUIRE( layer->featureCount() == 0 );
+      REQUIRE( !history->isUndoAvailable() );
+
+      REQUIRE( history->redo() );
+      REQUIRE( layer->featureCount() == 1 );
+      REQUIRE( onlyFeature( layer ).attribute( QStringLiteral( "name" ) ) == QStringLiteral( "before" ) );
+    }
+
+    SECTION( "Restart" )
+    {
+      // Undo a step so that both stacks hold one, then reopen the project
+      REQUIRE( history->undo() );
+      history.reset();
+
+      QgsProject reopenedProject;
+      FeatureHistory reopenedHistory( &reopenedProject, &trackingModel );
+      reopenedProject.setFileName( projectPath );
+      REQUIRE( project.takeMapLayer( layer ) == layer );
+      REQUIRE( reopenedProject.addMapLayer( layer ) );
+
+      REQUIRE( reopenedHistory.isUndoAvailable() );
+      REQUIRE( reopenedHistory.isRedoAvailable() );
+      REQUIRE( reopenedHistory.redo() );
+      REQUIRE( onlyFeature( layer ).attribute( QStringLiteral( "name" ) ) == QStringLiteral( "after" ) );
+      REQUIRE( onlyFeature( layer ).geometry().asWkt() == QStringLiteral( "Point (3 4)" ) );
+
+      REQUIRE( reopenedHistory.undo() );
+      REQUIRE( reopenedHistory.undo() );
+      REQUIRE( layer->featureCount() == 0 );
+      REQUIRE( !reopenedHistory.isUndoAvailable() );
+    }
+  }
+}
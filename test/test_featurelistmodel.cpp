@@ -0,0 +1,132 @@
+/***************************************************************************
+                        test_featurelistmodel.cpp
+                        --------------------
+  begin                : Oct 2026
+  copyright            : (C) 2026 by SIGPACGO contributors
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#define QFIELDTEST_MAIN
+#include "catch2.h"
+#include "featurelistmodel.h"
+
+#include <QSignalSpy>
+#include <QTest>
+#include <qgsexpression.h>
+#include <qgsexpressionfunction.h>
+#include <qgsvectorlayer.h>
+
+#include <atomic>
+
+namespace
+{
+  std::atomic<int> sEvaluations( 0 );
+
+  //! Returns its argument, counting how many times it is evaluated
+  class CountingFunction : public QgsExpressionFunction
+  {
+    public:
+      CountingFunction()
+        : QgsExpressionFunction( QStringLiteral( "test_counted" ), 1, QStringLiteral( "Custom" ) )
+      {}
+
+      QVariant func( const QVariantList &values, const QgsExpressionContext *, QgsExpression *, const QgsExpressionNodeFunction * ) override
+      {
+        sEvaluations++;
+        return values.value( 0 );
+      }
+  };
+
+  void setupModel( FeatureListModel *model, QgsVectorLayer *layer, const QString &filterExpression )
+  {
+    model->setKeyField( QStringLiteral( "id" ) );
+    model->setDisplayValueField( QStringLiteral( "name" ) );
+    model->setFilterExpression( filterExpression );
+    model->setCurrentLayer( layer );
+  }
+} // namespace
+
+TEST_CASE( "FeatureListModel" )
+{
+  if ( !QgsExpression::isFunctionName( QStringLiteral( "test_counted" ) ) )
+    QgsExpression::registerFunction( new CountingFunction() );
+
+  std::unique_ptr<QgsVectorLayer> layer = std::make_unique<QgsVectorLayer>( QStringLiteral( "Point?crs=EPSG:3857&field=id:integer&field=name:string" ), QStringLiteral( "parcels" ), QStringLiteral( "memory" ) );
+  REQUIRE( layer->isValid() );
+  REQUIRE( layer->startEditing() );
+  const QStringList names { QStringLiteral( "Alpha" ), QStringLiteral( "Beta" ), QStringLiteral( "Gamma" ) };
+  for ( int i = 0; i < names.size(); i++ )
+  {
+    QgsFeature feature( layer->fields() );
+    feature.setAttribute( QStringLiteral( "id" ), i + 1 );
+    feature.setAttribute( QStringLiteral( "name" ), names.at( i ) );
+    REQUIRE( layer->addFeature( feature ) );
+  }
+  REQUIRE( layer->commitChanges() );
+
+  sEvaluations = 0;
+
+  SECTION( "SharedQueries" )
+  {
+    FeatureListModel singleModel;
+    setupModel( &singleModel, layer.get(), QStringLiteral( "test_counted( true )" ) );
+    REQUIRE( QTest::qWaitFor( [&] { return singleModel.rowCount() == 3; }, 2000 ) );
+    const int singleEvaluations = sEvaluations;
+    REQUIRE( singleEvaluations > 0 );
+
+    // Value relations listing the same features share a single query
+    sEvaluations = 0;
+    FeatureListModel model;
+    FeatureListModel otherModel;
+    setupModel( &model, layer.get(), QStringLiteral( "test_counted( id > 0 )" ) );
+    setupModel( &otherModel, layer.get(), QStringLiteral( "test_counted( id > 0 )" ) );
+    REQUIRE( QTest::qWaitFor( [&] { return model.rowCount() == 3 && otherModel.rowCount() == 3; }, 2000 ) );
+    REQUIRE( sEvaluations == singleEvaluations );
+
+    // A model going away leaves the query shared with another model running
+    sEvaluations = 0;
+    std::unique_ptr<FeatureListModel> droppedModel = std::make_unique<FeatureListModel>();
+    FeatureListModel sharingModel;
+    setupModel( droppedModel.get(), layer.get(), QStringLiteral( "test_counted( name <> 'Beta' )" ) );
+    setupModel( &sharingModel, layer.get(), QStringLiteral( "test_counted( name <> 'Beta' )" ) );
+    QMetaObject::invokeMethod( droppedModel.get(), "gatherFeatureList", Qt::DirectConnection );
+    QMetaObject::invokeMethod( &sharingModel, "gatherFeatureList", Qt::DirectConnection );
+    droppedModel.reset();
+    REQUIRE( QTest::qWaitFor( [&] { return sharingModel.rowCount() == 2; }, 2000 ) );
+
+    // The pending reload of the model is served from the cached result
+    QTest::qWait( 300 );
+    REQUIRE( sharingModel.rowCount() == 2 );
+    REQUIRE( sEvaluations == singleEvaluations );
+  }
+
+  SECTION( "CancelQueries" )
+  {
+    FeatureListModel model;
+    QSignalSpy resetSpy( &model, &QAbstractItemModel::modelReset );
+    setupModel( &model, layer.get(), QStringLiteral( "test_counted( true )" ) );
+
+    // A query replaced before its result came in is never delivered
+    QMetaObject::invokeMethod( &model, "gatherFeatureList", Qt::DirectConnection );
+    model.setFilterExpression( QStringLiteral( "test_counted( name = 'Beta' )" ) );
+    REQUIRE( QTest::qWaitFor( [&] { return model.rowCount() == 1; }, 2000 ) );
+    QTest::qWait( 100 );
+    REQUIRE( resetSpy.count() == 1 );
+    REQUIRE( model.data( model.index( 0, 0 ), FeatureListModel::DisplayStringRole ) == QStringLiteral( "Beta" ) );
+
+    // Destroying a model with a pending query is safe
+    std::unique_ptr<FeatureListModel> droppedModel = std::make_unique<FeatureListModel>();
+    setupModel( droppedModel.get(), layer.get(), QStringLiteral( "test_counted( name = 'Gamma' )" ) );
+    QMetaObject::invokeMethod( droppedModel.get(), "gatherFeatureList", Qt::DirectConnection );
+    droppedModel.reset();
+    QTest::qWait( 100 );
+  }
+}
@@ -0,0 +1,114 @@
+/***************************************************************************
+                        test_featurequeryexecutor.cpp
+                        --------------------
+  begin                : Oct 2026
+  copyright            : (C) 2026 by SIGPACGO contributors
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#define QFIELDTEST_MAIN
+#include "catch2.h"
+#include "featurequeryexecutor.h"
+
+#include <QTest>
+#include <qgsvectorlayer.h>
+
+#include <atomic>
+
+TEST_CASE( "FeatureQueryExecutor" )
+{
+  std::unique_ptr<QgsVectorLayer> layer = std::make_unique<QgsVectorLayer>( QStringLiteral( "Point?crs=EPSG:3857&field=id:int" ), QStringLiteral( "points" ), QStringLiteral( "memory" ) );
+  REQUIRE( layer->isValid() );
+
+  FeatureQueryExecutor *executor = FeatureQueryExecutor::instance();
+  QObject context;
+
+  auto executions = std::make_shared<std::atomic<int>>( 0 );
+  std::function<int( QgsFeedback * )> task = [executions]( QgsFeedback * ) {
+    QThread::msleep( 50 );
+    return ++( *executions );
+  };
+
+  FeatureQueryExecutor::Query query;
+  query.key = QStringLiteral( "test" );
+  query.layers << layer.get();
+
+  SECTION( "SharedExecutions" )
+  {
+    QList<int> results;
+    executor->submit<int>( query, task, &context, [&results]( const int &result ) { results << result; } );
+    executor->submit<int>( query, task, &context, [&results]( const int &result ) { results << result; } );
+    REQUIRE( QTest::qWaitFor( [&results] { return results.size() == 2; }, 2000 ) );
+    REQUIRE( results == QList<int>( { 1, 1 } ) );
+
+    // Served from the cache
+    executor->submit<int>( query, task, &context, [&results]( const int &result ) { results << result; } );
+    REQUIRE( QTest::qWaitFor( [&results] { return results.size() == 3; }, 2000 ) );
+    REQUIRE( results.last() == 1 );
+
+    // Changing the layer invalidates the cached result
+    layer->setSubsetString( QStringLiteral( "id > 0" ) );
+    executor->submit<int>( query, task, &context, [&results]( const int &result ) { results << result; } );
+    REQUIRE( QTest::qWaitFor( [&results] { return results.size() == 4; }, 2000 ) );
+    REQUIRE( results.last() == 2 );
+    REQUIRE( executions->load() == 2 );
+  }
+
+  SECTION( "Cancel" )
+  {
+    query.key = QString();
+
+    bool canceledDelivered = false;
+    bool delivered = false;
+    const quint64 ticket = executor->submit<int>( query, task, &context, [&canceledDelivered]( const int & ) { canceledDelivered = true; } );
+    executor->submit<int>( query, task, &context, [&delivered]( const int & ) { delivered = true; } );
+    executor->cancel( ticket );
+
+    REQUIRE( QTest::qWaitFor( [&delivered] { return delivered; }, 2000 ) );
+    QTest::qWait( 100 );
+    REQUIRE( !canceledDelivered );
+  }
+
+  SECTION( "BackgroundLimit" )
+  {
+    query.key = QString();
+
+    auto released = std::make_shared<std::atomic<bool>>( false );
+    auto running = std::make_shared<std::atomic<int>>( 0 );
+    auto maximumRunning = std::make_shared<std::atomic<int>>( 0 );
+    std::function<int( QgsFeedback * )> backgroundTask = [released, running, maximumRunning]( QgsFeedback * ) {
+      const int count = ++( *running );
+      if ( count > maximumRunning->load() )
+        maximumRunning->store( count );
+      while ( !released->load() )
+        QThread::msleep( 10 );
+      --( *running );
+      return count;
+    };
+
+    FeatureQueryExecutor::Query backgroundQuery = query;
+    backgroundQuery.priority = FeatureQueryExecutor::Priority::Background;
+    int backgroundDelivered = 0;
+    executor->submit<int>( backgroundQuery, backgroundTask, &context, [&backgroundDelivered]( const int & ) { backgroundDelivered++; } );
+    executor->submit<int>( backgroundQuery, backgroundTask, &context, [&backgroundDelivered]( const int & ) { backgroundDelivered++; } );
+
+    // Blocked background queries leave a worker to interactive ones
+    query.priority = FeatureQueryExecutor::Priority::Interactive;
+    bool delivered = false;
+    executor->submit<int>( query, task, &context, [&delivered]( const int & ) { delivered = true; } );
+    REQUIRE( QTest::qWaitFor( [&delivered] { return delivered; }, 2000 ) );
+    REQUIRE( backgroundDelivered == 0 );
+
+    released->store( true );
+    REQUIRE( QTest::qWaitFor( [&backgroundDelivered] { return backgroundDelivered == 2; }, 2000 ) );
+    REQUIRE( maximumRunning->load() == FeatureQueryExecutor::MaximumBackgroundThreadCount );
+  }
+}
@@ -0,0 +1,151 @@
+/***************************************************************************
+                        test_featuresearchindex.cpp
+                        --------------------
+  begin                : Oct 2026
+  copyright            : (C) 2026 by SIGPACGO contributors
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#define QFIELDTEST_MAIN
+#include "catch2.h"
+#include "featuresearchindex.h"
+#include "layerobserver.h"
+
+#include <QFile>
+#include <QSignalSpy>
+#include <QTemporaryDir>
+#include <QTest>
+#include <qgsproject.h>
+#include <qgsvectorfilewriter.h>
+#include <qgsvectorlayer.h>
+
+namespace
+{
+  QStringList titles( const QList<FeatureSearchIndex::Match> &matches )
+  {
+    QStringList result;
+    for ( const FeatureSearchIndex::Match &match : matches )
+      result << match.title;
+    return result;
+  }
+} // namespace
+
+TEST_CASE( "FeatureSearchIndex" )
+{
+  SECTION( "Tokenize" )
+  {
+    REQUIRE( FeatureSearchIndex::tokenize( QStringLiteral( "  Jaén, Olivar-12 " ) ) == QStringList( { QStringLiteral( "jaen" ), QStringLiteral( "olivar" ), QStringLiteral( "12" ) } ) );
+    REQUIRE( FeatureSearchIndex::tokenize( QStringLiteral( " - " ) ).isEmpty() );
+  }
+
+  SECTION( "EditDistance" )
+  {
+    REQUIRE( FeatureSearchIndex::editDistance( QStringLiteral( "santa" ), QStringLiteral( "santa" ), 2 ) == 0 );
+    REQUIRE( FeatureSearchIndex::editDistance( QStringLiteral( "snata" ), QStringLiteral( "santa" ), 2 ) == 1 );
+    REQUIRE( FeatureSearchIndex::editDistance( QStringLiteral( "sant" ), QStringLiteral( "santa" ), 2 ) == 1 );
+    REQUIRE( FeatureSearchIndex::editDistance( QStringLiteral( "olivar" ), QStringLiteral( "santa" ), 2 ) == 3 );
+  }
+
+  SECTION( "MatchQuery" )
+  {
+    const QStringList tokens( { QStringLiteral( "parc" ), QStringLiteral( "sntan" ) } );
+    REQUIRE( FeatureSearchIndex::matchQuery( tokens ) == QStringLiteral( "\"parc\"* AND \"sntan\"*" ) );
+
+    QHash<QString, QStringList> alternatives;
+    alternatives.insert( QStringLiteral( "sntan" ), QStringList( { QStringLiteral( "santander" ) } ) );
+    REQUIRE( FeatureSearchIndex::matchQuery( tokens, alternatives ) == QStringLiteral( "\"parc\"* AND ( \"sntan\"* OR \"santander\" )" ) );
+  }
+
+  SECTION( "LayerIndex" )
+  {
+    QTemporaryDir dir;
+    REQUIRE( dir.isValid() );
+
+    const QString gpkgPath = dir.filePath( QStringLiteral( "parcels.gpkg" ) );
+    {
+      QgsVectorLayer memoryLayer( QStringLiteral( "Point?crs=EPSG:3857&field=name:string" ), QStringLiteral( "parcels" ), QStringLiteral( "memory" ) );
+      REQUIRE( memoryLayer.startEditing() );
+      for ( const QString &name : { QStringLiteral( "Olivar Santa Ana" ), QStringLiteral( "Viña del Rey" ), QStringLiteral( "Almendral Jaén" ) } )
+      {
+        QgsFeature feature( memoryLayer.fields() );
+        feature.setAttribute( QStringLiteral( "name" ), name );
+        REQUIRE( memoryLayer.addFeature( feature ) );
+      }
+      REQUIRE( memoryLayer.commitChanges() );
+
+      QgsVectorFileWriter::SaveVectorOptions options;
+      options.driverName = QStringLiteral( "GPKG" );
+      options.layerName = QStringLiteral( "parcels" );
+      REQUIRE( QgsVectorFileWriter::writeAsVectorFormatV3( &memoryLayer, gpkgPath, QgsProject::instance()->transformContext(), options ) == QgsVectorFileWriter::NoError );
+    }
+
+    const QString projectPath = dir.filePath( QStringLiteral( "project.qgs" ) );
+    {
+      QFile projectFile( projectPath );
+      REQUIRE( projectFile.open( QIODevice::WriteOnly ) );
+    }
+
+    QgsVectorLayer *layer = new QgsVectorLayer( QStringLiteral( "%1|layername=parcels" ).arg( gpkgPath ), QStringLiteral( "parcels" ), QStringLiteral( "ogr" ) );
+    REQUIRE( layer->isValid() );
+    layer->setDisplayExpression( QStringLiteral( "\"name\"" ) );
+
+    QgsProject project;
+    LayerObserver layerObserver( &project );
+    FeatureSearchIndex index( &project, &layerObserver );
+    project.setFileName( projectPath );
+
+    QSignalSpy indexedSpy( &index, &FeatureSearchIndex::layerIndexed );
+    REQUIRE( project.addMapLayer( layer ) );
+    REQUIRE( indexedSpy.wait( 5000 ) );
+    REQUIRE( index.isReady( layer->id() ) );
+    REQUIRE( QFile::exists( dir.filePath( QStringLiteral( ".project.search.sqlite" ) ) ) );
+
+    // Words match as prefixes, regardless of case and diacritics
+    REQUIRE( titles( index.search( layer->id(), QStringLiteral( "santa" ), 10 ) ) == QStringList( { QStringLiteral( "Olivar Santa Ana" ) } ) );
+    REQUIRE( titles( index.search( layer->id(), QStringLiteral( "VIÑA re" ), 10 ) ) == QStringList( { QStringLiteral( "Viña del Rey" ) } ) );
+    REQUIRE( titles( index.search( layer->id(), QStringLiteral( "jaen" ), 10 ) ) == QStringList( { QStringLiteral( "Almendral Jaén" ) } ) );
+
+    // Misspelled words fall back to similar indexed terms
+    const QList<FeatureSearchIndex::Match> fuzzyMatches = index.search( layer->id(), QStringLiteral( "almendarl" ), 10 );
+    REQUIRE( titles( fuzzyMatches ) == QStringList( { QStringLiteral( "Almendral Jaén" ) } ) );
+    REQUIRE( fuzzyMatches.first().fuzzy );
+
+    // Commits are applied to the index
+    QgsFeature vineyard;
+    QgsFeature almondGrove;
+    QgsFeatureIterator iterator = layer->getFeatures();
+    QgsFeature feature;
+    while ( iterator.nextFeature( feature ) )
+    {
+      if ( feature.attribute( QStringLiteral( "name" ) ) == QStringLiteral( "Viña del Rey" ) )
+        vineyard = feature;
+      else if ( feature.attribute( QStringLiteral( "name" ) ) == QStringLiteral( "Almendral Jaén" ) )
+        almondGrove = feature;
+    }
+    REQUIRE( vineyard.isValid() );
+    REQUIRE( almondGrove.isValid() );
+
+    const int nameIndex = layer->fields().indexOf( QStringLiteral( "name" ) );
+    REQUIRE( layer->startEditing() );
+    REQUIRE( layer->changeAttributeValue( vineyard.id(), nameIndex, QStringLiteral( "Viña del Marqués" ) ) );
+    REQUIRE( layer->deleteFeature( almondGrove.id() ) );
+    QgsFeature newFeature( layer->fields() );
+    newFeature.setAttribute( QStringLiteral( "name" ), QStringLiteral( "Olivar Nuevo" ) );
+    REQUIRE( layer->addFeature( newFeature ) );
+    REQUIRE( layer->commitChanges() );
+
+    REQUIRE( QTest::qWaitFor( [&] { return index.search( layer->id(), QStringLiteral( "olivar" ), 10 ).size() == 2; }, 5000 ) );
+    REQUIRE( titles( index.search( layer->id(), QStringLiteral( "marques" ), 10 ) ) == QStringList( { QStringLiteral( "Viña del Marqués" ) } ) );
+    REQUIRE( index.search( layer->id(), QStringLiteral( "rey" ), 10 ).isEmpty() );
+    REQUIRE( index.search( layer->id(), QStringLiteral( "jaen" ), 10 ).isEmpty() );
+    REQUIRE( index.isReady( layer->id() ) );
+  }
+}
@@ -0,0 +1,133 @@
+/***************************************************************************
+                        test_flusher.cpp
+                        --------------------
+  begin                : Oct 2026
+  copyright            : (C) 2026 by SIGPACGO contributors
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#define QFIELDTEST_MAIN
+#include "catch2.h"
+#include "qgsflusher.h"
+#include "qgsgpkgflusher.h"
+
+#include <QFileInfo>
+#include <QTemporaryDir>
+#include <QTest>
+#include <qgsproject.h>
+#include <qgssqliteutils.h>
+
+namespace
+{
+  //! Opens a database at \a path writing to a WAL which is only checkpointed by the flusher
+  sqlite3_database_unique_ptr openDatabase( const QString &path )
+  {
+    sqlite3_database_unique_ptr database;
+    REQUIRE( database.open( path ) == 0 );
+
+    QString error;
+    database.exec( QStringLiteral( "PRAGMA journal_mode=WAL;" ), error );
+    database.exec( QStringLiteral( "PRAGMA wal_autocheckpoint=0;" ), error );
+    database.exec( QStringLiteral( "CREATE TABLE data (id INTEGER PRIMARY KEY, value BLOB);" ), error );
+    REQUIRE( error.isEmpty() );
+    return database;
+  }
+
+  //! Inserts \a count rows of \a size bytes in a single transaction
+  void insertRows( sqlite3_database_unique_ptr &database, int count, int size )
+  {
+    QString error;
+    database.exec( QStringLiteral( "BEGIN;" ), error );
+    for ( int i = 0; i < count; ++i )
+      database.exec( QStringLiteral( "INSERT INTO data (value) VALUES (zeroblob(%1));" ).arg( size ), error );
+    database.exec( QStringLiteral( "COMMIT;" ), error );
+    REQUIRE( error.isEmpty() );
+  }
+} // namespace
+
+TEST_CASE( "Flusher" )
+{
+  SECTION( "CheckpointMode" )
+  {
+    // Small WALs are written back without resetting them
+    REQUIRE( Flusher::checkpointMode( 0, 0 ) == Flusher::CheckpointMode::Passive );
+    REQUIRE( Flusher::checkpointMode( Flusher::LargeWalSize - 1, 0 ) == Flusher::CheckpointMode::Passive );
+    REQUIRE( Flusher::checkpointMode( Flusher::LargeWalSize - 1, Flusher::BusyWriteRate * 10 ) == Flusher::CheckpointMode::Passive );
+
+    // Large WALs are truncated once editing calms down
+    REQUIRE( Flusher::checkpointMode( Flusher::LargeWalSize, 0 ) == Flusher::CheckpointMode::Truncate );
+    REQUIRE( Flusher::checkpointMode( Flusher::LargeWalSize, Flusher::BusyWriteRate - 1 ) == Flusher::CheckpointMode::Truncate );
+    REQUIRE( Flusher::checkpointMode( Flusher::OversizedWalSize, Flusher::BusyWriteRate - 1 ) == Flusher::CheckpointMode::Truncate );
+
+    // While editing is ongoing, only oversized WALs are reset
+    REQUIRE( Flusher::checkpointMode( Flusher::LargeWalSize, Flusher::BusyWriteRate ) == Flusher::CheckpointMode::Passive );
+    REQUIRE( Flusher::checkpointMode( Flusher::OversizedWalSize - 1, Flusher::BusyWriteRate ) == Flusher::CheckpointMode::Passive );
+    REQUIRE( Flusher::checkpointMode( Flusher::OversizedWalSize, Flusher::BusyWriteRate ) == Flusher::CheckpointMode::Restart );
+  }
+
+  QTemporaryDir dir;
+  const QString path = dir.filePath( QStringLiteral( "data.gpkg" ) );
+  QgsProject project;
+  QgsGpkgFlusher flusher( &project );
+
+  SECTION( "Metrics" )
+  {
+    const QStringList keys { QStringLiteral( "checkpointCount" ), QStringLiteral( "checkpointLatency" ), QStringLiteral( "checkpointMode" ), QStringLiteral( "pagesWritten" ), QStringLiteral( "walBytes" ), QStringLiteral( "writeRate" ) };
+
+    // Nothing was flushed yet
+    QVariantMap metrics = flusher.metrics( path );
+    REQUIRE( metrics.keys() == keys );
+    REQUIRE( metrics.value( QStringLiteral( "walBytes" ) ).toLongLong() == 0 );
+    REQUIRE( metrics.value( QStringLiteral( "checkpointLatency" ) ).toLongLong() == -1 );
+    REQUIRE( metrics.value( QStringLiteral( "checkpointMode" ) ).toString() == QStringLiteral( "passive" ) );
+    REQUIRE( metrics.value( QStringLiteral( "pagesWritten" ) ).toLongLong() == 0 );
+    REQUIRE( metrics.value( QStringLiteral( "checkpointCount" ) ).toInt() == 0 );
+    REQUIRE( metrics.value( QStringLiteral( "writeRate" ) ).toInt() == 0 );
+
+    sqlite3_database_unique_ptr database = openDatabase( path );
+    insertRows( database, 10, 100 );
+    const qint64 walBytes = QFileInfo( path + QStringLiteral( "-wal" ) ).size();
+    REQUIRE( walBytes > 0 );
+
+    emit flusher.requestFlush( path );
+    REQUIRE( QTest::qWaitFor( [&] { return flusher.metrics( path ).value( QStringLiteral( "checkpointCount" ) ).toInt() == 1; }, 5000 ) );
+
+    metrics = flusher.metrics( path );
+    REQUIRE( metrics.keys() == keys );
+    REQUIRE( metrics.value( QStringLiteral( "walBytes" ) ).toLongLong() == walBytes );
+    REQUIRE( metrics.value( QStringLiteral( "checkpointLatency" ) ).toLongLong() >= 0 );
+    REQUIRE( metrics.value( QStringLiteral( "checkpointMode" ) ).toString() == QStringLiteral( "passive" ) );
+    REQUIRE( metrics.value( QStringLiteral( "pagesWritten" ) ).toLongLong() > 0 );
+    REQUIRE( metrics.value( QStringLiteral( "writeRate" ) ).toInt() == 1 );
+
+    // Passive checkpoints leave the WAL in place
+    REQUIRE( QFileInfo( path + QStringLiteral( "-wal" ) ).size() == walBytes );
+  }
+
+  SECTION( "TruncateLargeWal" )
+  {
+    sqlite3_database_unique_ptr database = openDatabase( path );
+    insertRows( database, 5, 1024 * 1024 );
+    const qint64 walBytes = QFileInfo( path + QStringLiteral( "-wal" ) ).size();
+    REQUIRE( walBytes >= Flusher::LargeWalSize );
+
+    emit flusher.requestFlush( path );
+    REQUIRE( QTest::qWaitFor( [&] { return flusher.metrics( path ).value( QStringLiteral( "checkpointCount" ) ).toInt() == 1; }, 5000 ) );
+
+    const QVariantMap metrics = flusher.metrics( path );
+    REQUIRE( metrics.value( QStringLiteral( "walBytes" ) ).toLongLong() == walBytes );
+    REQUIRE( metrics.value( QStringLiteral( "checkpointMode" ) ).toString() == QStringLiteral( "truncate" ) );
+    REQUIRE( metrics.value( QStringLiteral( "pagesWritten" ) ).toLongLong() > 0 );
+
+    // The WAL is reset and its file truncated
+    REQUIRE( QFileInfo( path + QStringLiteral( "-wal" ) ).size() == 0 );
+  }
+}
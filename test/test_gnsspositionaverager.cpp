@@ -0,0 +1,145 @@
+/***************************************************************************
+                        test_gnsspositionaverager.cpp
+                        --------------------
+  begin                : Oct 2026
+  copyright            : (C) 2026 by SIGPACGO contributors
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "catch2.h"
+#include "gnsspositionaverager.h"
+
+#include <cmath>
+
+using Catch::Approx;
+
+namespace
+{
+  GnssPositionInformation positionInformation( double latitude, double longitude, double elevation, double hdop = 0.8 )
+  {
+    return GnssPositionInformation( latitude, longitude, elevation, 1.2, 90.0, QList<QgsSatelliteInfo>(), 1.1, hdop, 0.9, 0.02, 0.03,
+                                    QDateTime(), QChar( 'A' ), 3, 4, 12, QChar( 'A' ), QList<int>(), true,
+                                    0.1, std::numeric_limits<double>::quiet_NaN(), 0, QStringLiteral( "nmea" ) );
+  }
+
+  double mean( const QList<double> &values )
+  {
+    double sum = 0;
+    for ( const double value : values )
+      sum += value;
+    return sum / values.size();
+  }
+
+  //! Two-pass sample variance
+  double variance( const QList<double> &values )
+  {
+    const double valuesMean = mean( values );
+    double sum = 0;
+    for ( const double value : values )
+      sum += ( value - valuesMean ) * ( value - valuesMean );
+    return sum / ( values.size() - 1 );
+  }
+} // namespace
+
+TEST_CASE( "GnssPositionAverager" )
+{
+  GnssPositionAverager averager;
+
+  SECTION( "Welford" )
+  {
+    const QList<double> latitudes { 46.90001, 46.90003, 46.89998, 46.90004, 46.90000, 46.89997, 46.90002 };
+    const QList<double> longitudes { 7.40002, 7.39999, 7.40001, 7.40004, 7.39997, 7.40000, 7.40003 };
+    const QList<double> elevations { 540.2, 539.8, 541.1, 540.0, 539.5, 540.7, 540.3 };
+    const QList<double> hdops { 0.8, 0.9, 0.7, 1.0, 0.8, 0.6, 0.9 };
+
+    averager.addPositionInformation( positionInformation( latitudes.at( 0 ), longitudes.at( 0 ), elevations.at( 0 ), hdops.at( 0 ) ) );
+
+    // A single position has no spread yet
+    REQUIRE( std::isnan( averager.horizontalStandardDeviation() ) );
+    REQUIRE( std::isnan( averager.verticalStandardDeviation() ) );
+
+    for ( int i = 1; i < latitudes.size(); i++ )
+      REQUIRE( averager.addPositionInformation( positionInformation( latitudes.at( i ), longitudes.at( i ), elevations.at( i ), hdops.at( i ) ) ) );
+    REQUIRE( averager.count() == latitudes.size() );
+
+    const GnssPositionInformation averaged = averager.averagedPositionInformation();
+    REQUIRE( averaged.latitude() == Approx( mean( latitudes ) ).epsilon( 1e-12 ) );
+    REQUIRE( averaged.longitude() == Approx( mean( longitudes ) ).epsilon( 1e-12 ) );
+    REQUIRE( averaged.elevation() == Approx( mean( elevations ) ).epsilon( 1e-12 ) );
+    REQUIRE( averaged.hdop() == Approx( mean( hdops ) ).epsilon( 1e-12 ) );
+    REQUIRE( averaged.averagedCount() == latitudes.size() );
+
+    // Values missing from every position stay missing
+    REQUIRE( std::isnan( averaged.magneticVariation() ) );
+
+    // The running variance matches the two-pass one
+    REQUIRE( averager.verticalStandardDeviation() == Approx( std::sqrt( variance( elevations ) ) ).epsilon( 1e-9 ) );
+    const double longitudeScale = std::cos( mean( latitudes ) * M_PI / 180.0 );
+    const double horizontalStandardDeviation = std::sqrt( variance( latitudes ) + variance( longitudes ) * longitudeScale * longitudeScale ) * 111320.0;
+    REQUIRE( averager.horizontalStandardDeviation() == Approx( horizontalStandardDeviation ).epsilon( 1e-6 ) );
+
+    averager.reset();
+    REQUIRE( averager.count() == 0 );
+    REQUIRE( std::isnan( averager.averagedPositionInformation().latitude() ) );
+  }
+
+  SECTION( "NaNValues" )
+  {
+    // Positions without elevation don't weigh on the elevation mean
+    averager.addPositionInformation( positionInformation( 46.9, 7.4, 540.0 ) );
+    averager.addPositionInformation( positionInformation( 46.9, 7.4, std::numeric_limits<double>::quiet_NaN() ) );
+    averager.addPositionInformation( positionInformation( 46.9, 7.4, 542.0 ) );
+    REQUIRE( averager.count() == 3 );
+    REQUIRE( averager.averagedPositionInformation().elevation() == Approx( 541.0 ) );
+  }
+
+  SECTION( "OutlierRejection" )
+  {
+    averager.setOutlierRejection( true );
+    averager.setOutlierThreshold( 3.0 );
+
+    // Positions spread over about a meter
+    const QList<double> offsets { 0, 1, -1, 0.5, -0.5, 0.8 };
+    for ( int i = 0; i < 5; i++ )
+      REQUIRE( averager.addPositionInformation( positionInformation( 46.9 + offsets.at( i ) / 111320.0, 7.4, 540.0 ) ) );
+
+    const double latitude = averager.averagedPositionInformation().latitude();
+
+    // A position a hundred meters away is rejected without affecting the average
+    REQUIRE( !averager.addPositionInformation( positionInformation( 46.9 + 100 / 111320.0, 7.4, 540.0 ) ) );
+    REQUIRE( averager.rejectedCount() == 1 );
+    REQUIRE( averager.count() == 5 );
+    REQUIRE( averager.averagedPositionInformation().latitude() == latitude );
+
+    // Positions within the spread are still accumulated
+    REQUIRE( averager.addPositionInformation( positionInformation( 46.9 + offsets.at( 5 ) / 111320.0, 7.4, 540.0 ) ) );
+    REQUIRE( averager.count() == 6 );
+    REQUIRE( averager.rejectedCount() == 1 );
+  }
+
+  SECTION( "OutlierRejectionWarmUp" )
+  {
+    averager.setOutlierRejection( true );
+
+    // Too few positions to estimate the spread, nothing is rejected
+    REQUIRE( averager.addPositionInformation( positionInformation( 46.9, 7.4, 540.0 ) ) );
+    REQUIRE( averager.addPositionInformation( positionInformation( 46.9 + 1 / 111320.0, 7.4, 540.0 ) ) );
+    REQUIRE( averager.addPositionInformation( positionInformation( 46.9 + 100 / 111320.0, 7.4, 540.0 ) ) );
+    REQUIRE( averager.rejectedCount() == 0 );
+
+    // Without rejection, far away positions are accumulated
+    averager.reset();
+    for ( int i = 0; i < 5; i++ )
+      averager.addPositionInformation( positionInformation( 46.9 + i / 111320.0, 7.4, 540.0 ) );
+    REQUIRE( averager.addPositionInformation( positionInformation( 46.9 + 1000 / 111320.0, 7.4, 540.0 ) ) );
+    REQUIRE( averager.count() == 6 );
+  }
+}
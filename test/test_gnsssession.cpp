@@ -0,0 +1,83 @@
+/***************************************************************************
+                        test_gnsssession.cpp
+                        --------------------
+  begin                : Oct 2026
+  copyright            : (C) 2026 by SIGPACGO contributors
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "catch2.h"
+#include "gnsssession.h"
+
+#include <QTemporaryDir>
+#include <QTimeZone>
+
+namespace
+{
+  GnssPositionInformation positionInformation( int index )
+  {
+    return GnssPositionInformation( 46.9 + index * 1e-5, 7.4, 540.0, 1.2, 90.0, QList<QgsSatelliteInfo>(), 1.1, 0.8, 0.9, 0.02, 0.03,
+                                    QDateTime( QDate( 2026, 10, 17 ), QTime( 8, 0 ), QTimeZone( QTimeZone::Initialization::UTC ) ).addSecs( index ),
+                                    QChar( 'A' ), 3, 4, 12, QChar( 'A' ), QList<int>( { 3, 7, 12 } ), true,
+                                    0.1, std::numeric_limits<double>::quiet_NaN(), 0, QStringLiteral( "nmea" ) );
+  }
+} // namespace
+
+TEST_CASE( "GnssSession" )
+{
+  QTemporaryDir dir;
+  const QString path = dir.filePath( QStringLiteral( "session.gnss" ) );
+
+  {
+    GnssSessionWriter writer;
+    REQUIRE( writer.open( path ) );
+    for ( int i = 0; i < 3; ++i )
+      REQUIRE( writer.write( positionInformation( i ) ) );
+  }
+
+  SECTION( "Read" )
+  {
+    GnssSessionReader reader( path );
+    REQUIRE( reader.isValid() );
+    REQUIRE( reader.count() == 3 );
+
+    const GnssPositionInformation position = reader.positionInformation( 2 );
+    const GnssPositionInformation expected = positionInformation( 2 );
+    REQUIRE( position.latitude() == expected.latitude() );
+    REQUIRE( position.utcDateTime() == expected.utcDateTime() );
+    REQUIRE( position.fixMode() == expected.fixMode() );
+    REQUIRE( position.quality() == expected.quality() );
+    REQUIRE( position.satPrn() == expected.satPrn() );
+    REQUIRE( position.satInfoComplete() );
+    REQUIRE( std::isnan( position.magneticVariation() ) );
+    REQUIRE( position.sourceName() == QStringLiteral( "nmea" ) );
+  }
+
+  SECTION( "Append" )
+  {
+    // A record left incomplete by an interrupted write is dropped
+    {
+      QFile file( path );
+      REQUIRE( file.open( QIODevice::Append ) );
+      file.write( QByteArray( 10, '\0' ) );
+    }
+    REQUIRE( GnssSessionReader( path ).count() == 3 );
+
+    GnssSessionWriter writer;
+    REQUIRE( writer.open( path ) );
+    REQUIRE( writer.write( positionInformation( 3 ) ) );
+    writer.close();
+
+    GnssSessionReader reader( path );
+    REQUIRE( reader.count() == 4 );
+    REQUIRE( reader.positionInformation( 3 ).utcDateTime() == positionInformation( 3 ).utcDateTime() );
+  }
+}
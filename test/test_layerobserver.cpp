@@ -19,10 +19,15 @@
 #include "catch2.h"
 #include "layerobserver.h"
 
-QStringList getDeltaOperations( QString fileName )
+QStringList getDeltaOperations( DeltaFileWrapper *deltaFileWrapper )
 {
   QStringList operations;
-  QFile deltaFile( fileName );
+
+  // changes are appended to the journal, bring them into the JSON snapshot before reading it
+  if ( !deltaFileWrapper->compact() )
+    return operations;
+
+  QFile deltaFile( deltaFileWrapper->fileName() );
 
   if ( !deltaFile.open( QIODevice::ReadOnly ) )
     return operations;
@@ -121,7 +126,7 @@ TEST_CASE( "LayerObserver" )
     REQUIRE( mLayer->startEditing() );
     REQUIRE( mLayer->addFeature( f1 ) );
     REQUIRE( mLayer->commitChanges() );
-    REQUIRE( getDeltaOperations( mLayerObserver->deltaFileWrapper()->fileName() ).size() == 1 );
+    REQUIRE( getDeltaOperations( mLayerObserver->deltaFileWrapper() ).size() == 1 );
 
     QgsFeature f2( mLayer->fields() );
     f2.setAttribute( QStringLiteral( "fid" ), 1001 );
@@ -131,13 +136,13 @@ TEST_CASE( "LayerObserver" )
     REQUIRE( mLayer->startEditing() );
     REQUIRE( mLayer->addFeature( f1 ) );
     REQUIRE( mLayer->commitChanges() );
-    REQUIRE( getDeltaOperations( mLayerObserver->deltaFileWrapper()->fileName() ).size() == 2 );
+    REQUIRE( getDeltaOperations( mLayerObserver->deltaFileWrapper() ).size() == 2 );
 
     mLayerObserver->reset();
     REQUIRE( mLayer->startEditing() );
     REQUIRE( mLayer->commitChanges() );
 
-    REQUIRE( getDeltaOperations( mLayerObserver->deltaFileWrapper()->fileName() ).size() == 0 );
+    REQUIRE( getDeltaOperations( mLayerObserver->deltaFileWrapper() ).size() == 0 );
   }
 
 
@@ -151,10 +156,10 @@ TEST_CASE( "LayerObserver" )
     REQUIRE( mLayer->startEditing() );
     REQUIRE( mLayer->addFeature( f1 ) );
     // the changes are not written on the disk yet
-    REQUIRE( getDeltaOperations( mLayerObserver->deltaFileWrapper()->fileName() ) == QStringList() );
+    REQUIRE( getDeltaOperations( mLayerObserver->deltaFileWrapper() ) == QStringList() );
     // when we stop editing, all changes are written
     REQUIRE( mLayer->commitChanges() );
-    REQUIRE( getDeltaOperations( mLayerObserver->deltaFileWrapper()->fileName() ) == QStringList( { "create" } ) );
+    REQUIRE( getDeltaOperations( mLayerObserver->deltaFileWrapper() ) == QStringList( { "create" } ) );
   }
 
 
@@ -168,7 +173,7 @@ TEST_CASE( "LayerObserver" )
     REQUIRE( mLayer->startEditing() );
     REQUIRE( mLayer->addFeature( f1 ) );
     REQUIRE( mLayer->commitChanges() );
-    REQUIRE( getDeltaOperations( mLayerObserver->deltaFileWrapper()->fileName() ) == QStringList( { "create" } ) );
+    REQUIRE( getDeltaOperations( mLayerObserver->deltaFileWrapper() ) == QStringList( { "create" } ) );
   }
 
 
@@ -177,7 +182,7 @@ TEST_CASE( "LayerObserver" )
     REQUIRE( mLayer->startEditing() );
     REQUIRE( mLayer->deleteFeature( 1 ) );
     REQUIRE( mLayer->commitChanges() );
-    REQUIRE( getDeltaOperations( mLayerObserver->deltaFileWrapper()->fileName() ) == QStringList( { "delete" } ) );
+    REQUIRE( getDeltaOperations( mLayerObserver->deltaFileWrapper() ) == QStringList( { "delete" } ) );
   }
 
 
@@ -193,7 +198,7 @@ TEST_CASE( "LayerObserver" )
     REQUIRE( mLayer->updateFeature( f1 ) );
     REQUIRE( mLayer->updateFeature( f2 ) );
     REQUIRE( mLayer->commitChanges() );
-    REQUIRE( getDeltaOperations( mLayerObserver->deltaFileWrapper()->fileName() ) == QStringList( { "patch", "patch" } ) );
+    REQUIRE( getDeltaOperations( mLayerObserver->deltaFileWrapper() ) == QStringList( { "patch", "patch" } ) );
   }
 
 
@@ -211,6 +216,6 @@ TEST_CASE( "LayerObserver" )
     REQUIRE( mLayer->updateFeature( f2 ) );
 
     REQUIRE( mLayer->commitChanges() );
-    REQUIRE( getDeltaOperations( mLayerObserver->deltaFileWrapper()->fileName() ) == QStringList( { "patch", "patch" } ) );
+    REQUIRE( getDeltaOperations( mLayerObserver->deltaFileWrapper() ) == QStringList( { "patch", "patch" } ) );
   }
 }
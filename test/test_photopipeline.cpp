@@ -0,0 +1,127 @@
+/***************************************************************************
+                        test_photopipeline.cpp
+                        --------------------
+  begin                : Oct 2026
+  copyright            : (C) 2026 by SIGPACGO contributors
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#define QFIELDTEST_MAIN
+#include "catch2.h"
+#include "gnsspositioninformation.h"
+#include "photopipeline.h"
+
+#include <QImageReader>
+#include <QTemporaryDir>
+#include <QTimeZone>
+#include <qgsexiftools.h>
+#include <qgspoint.h>
+
+TEST_CASE( "PhotoPipeline" )
+{
+  const GnssPositionInformation position( 46.5, -7.25, -12.5, 3.6, 90.0, QList<QgsSatelliteInfo>(), 1.1, 0.8, 0.9, 0.02, 0.03,
+                                          QDateTime( QDate( 2026, 10, 17 ), QTime( 8, 5, 30 ), QTimeZone( QTimeZone::Initialization::UTC ) ),
+                                          QChar( 'A' ), 3, 4, 7, QChar( 'A' ), QList<int>(), false );
+
+  SECTION( "PositionTags" )
+  {
+    const QVariantMap tags = PhotoPipeline::positionTags( position );
+    REQUIRE( tags.value( QStringLiteral( "Exif.GPSInfo.GPSLatitude" ) ).toDouble() == 46.5 );
+    REQUIRE( tags.value( QStringLiteral( "Exif.GPSInfo.GPSLatitudeRef" ) ).toString() == QStringLiteral( "N" ) );
+    REQUIRE( tags.value( QStringLiteral( "Exif.GPSInfo.GPSLongitude" ) ).toDouble() == 7.25 );
+    REQUIRE( tags.value( QStringLiteral( "Exif.GPSInfo.GPSLongitudeRef" ) ).toString() == QStringLiteral( "W" ) );
+    // Altitudes are positive, below sea level being told by the reference
+    REQUIRE( tags.value( QStringLiteral( "Exif.GPSInfo.GPSAltitude" ) ).toDouble() == 12.5 );
+    REQUIRE( tags.value( QStringLiteral( "Exif.GPSInfo.GPSAltitudeRef" ) ).toString() == QStringLiteral( "1" ) );
+    REQUIRE( tags.value( QStringLiteral( "Exif.GPSInfo.GPSSpeed" ) ).toDouble() == 3.6 );
+    REQUIRE( tags.value( QStringLiteral( "Exif.GPSInfo.GPSDateStamp" ) ).toDate() == QDate( 2026, 10, 17 ) );
+    REQUIRE( tags.value( QStringLiteral( "Exif.GPSInfo.GPSTimeStamp" ) ).toTime() == QTime( 8, 5, 30 ) );
+    REQUIRE( tags.value( QStringLiteral( "Exif.GPSInfo.GPSSatellites" ) ).toString() == QStringLiteral( "07" ) );
+    REQUIRE( tags.value( QStringLiteral( "Exif.Image.Make" ) ).toString() == QStringLiteral( "SIGPACGO" ) );
+    REQUIRE( !tags.contains( QStringLiteral( "Exif.GPSInfo.GPSImgDirection" ) ) );
+
+    // Positions without a fix aren't geotagged
+    const QVariantMap emptyTags = PhotoPipeline::positionTags( GnssPositionInformation() );
+    REQUIRE( !emptyTags.contains( QStringLiteral( "Exif.GPSInfo.GPSLatitude" ) ) );
+    REQUIRE( !emptyTags.contains( QStringLiteral( "Exif.GPSInfo.GPSAltitude" ) ) );
+  }
+
+  SECTION( "ExifValueString" )
+  {
+    // Coordinates are written as degrees, minutes and seconds
+    REQUIRE( PhotoPipeline::exifValueString( QStringLiteral( "Exif.GPSInfo.GPSLatitude" ), 46.5 ) == QStringLiteral( "46/1 30/1 0/1000" ) );
+    REQUIRE( PhotoPipeline::exifValueString( QStringLiteral( "Exif.GPSInfo.GPSLongitude" ), 7.2575 ) == QStringLiteral( "7/1 15/1 27000/1000" ) );
+    REQUIRE( PhotoPipeline::exifValueString( QStringLiteral( "Exif.GPSInfo.GPSAltitude" ), 540.25 ) == QStringLiteral( "540250/1000" ) );
+    REQUIRE( PhotoPipeline::exifValueString( QStringLiteral( "Exif.GPSInfo.GPSDateStamp" ), QDate( 2026, 10, 17 ) ) == QStringLiteral( "2026:10:17" ) );
+    REQUIRE( PhotoPipeline::exifValueString( QStringLiteral( "Exif.GPSInfo.GPSTimeStamp" ), QTime( 8, 5, 30 ) ) == QStringLiteral( "8/1 5/1 30/1" ) );
+    REQUIRE( PhotoPipeline::exifValueString( QStringLiteral( "Exif.Photo.DateTimeOriginal" ), QDateTime( QDate( 2026, 10, 17 ), QTime( 8, 5, 30 ) ) ) == QStringLiteral( "2026:10:17 08:05:30" ) );
+    REQUIRE( PhotoPipeline::exifValueString( QStringLiteral( "Exif.Image.Make" ), QStringLiteral( "SIGPACGO" ) ) == QStringLiteral( "SIGPACGO" ) );
+    // Unknown keys are written as is
+    REQUIRE( PhotoPipeline::exifValueString( QStringLiteral( "Exif.Unknown" ), 1.5 ) == QStringLiteral( "1.5" ) );
+  }
+
+  SECTION( "ProcessNow" )
+  {
+    QTemporaryDir dir;
+    REQUIRE( dir.isValid() );
+    const QString path = dir.filePath( QStringLiteral( "photo.jpg" ) );
+
+    QImage photo( 1024, 768, QImage::Format_RGB32 );
+    photo.fill( QColor( 0, 160, 0 ) );
+    REQUIRE( photo.save( path, "JPEG", 95 ) );
+
+    // Tags alone are written without re-encoding the photo
+    QVariantMap tags;
+    tags[QStringLiteral( "Exif.Image.Artist" )] = QStringLiteral( "Surveyor" );
+    REQUIRE( PhotoPipeline::processNow( path, { { QStringLiteral( "tags" ), tags } } ) );
+    REQUIRE( QgsExifTools::readTag( path, QStringLiteral( "Exif.Image.Artist" ) ).toString() == QStringLiteral( "Surveyor" ) );
+
+    QVariantMap styling;
+    styling[QStringLiteral( "fontSize" )] = 20;
+    styling[QStringLiteral( "backgroundColor" )] = QStringLiteral( "#ff0000" );
+    styling[QStringLiteral( "padding" )] = 30;
+    styling[QStringLiteral( "position" )] = QStringLiteral( "bottomLeft" );
+    styling[QStringLiteral( "shadow" )] = false;
+
+    QVariantMap operations;
+    operations[QStringLiteral( "maximumWidthHeight" )] = 512;
+    operations[QStringLiteral( "stampText" )] = QStringLiteral( "17/10/2026\nParcela 28-079-1-2-3\nSIGPACGO" );
+    operations[QStringLiteral( "stampStyling" )] = styling;
+    operations[QStringLiteral( "positionInformation" )] = QVariant::fromValue( position );
+    REQUIRE( PhotoPipeline::processNow( path, operations ) );
+
+    // Resized to fit the maximum width and height, keeping its aspect ratio
+    QImageReader reader( path );
+    REQUIRE( reader.size() == QSize( 512, 384 ) );
+
+    // Stamped at the bottom left, below the text of the last line, the rest of the photo left untouched
+    const QImage processed = reader.read();
+    REQUIRE( !processed.isNull() );
+    const QColor stampColor = processed.pixelColor( 60, 384 - 30 - 10 );
+    REQUIRE( stampColor.red() > 200 );
+    REQUIRE( stampColor.green() < 60 );
+    const QColor photoColor = processed.pixelColor( 500, 10 );
+    REQUIRE( photoColor.red() < 60 );
+    REQUIRE( photoColor.green() > 120 );
+
+    // The original tags are carried over along with the position ones
+    REQUIRE( QgsExifTools::readTag( path, QStringLiteral( "Exif.Image.Artist" ) ).toString() == QStringLiteral( "Surveyor" ) );
+    REQUIRE( QgsExifTools::readTag( path, QStringLiteral( "Exif.Image.Make" ) ).toString() == QStringLiteral( "SIGPACGO" ) );
+    REQUIRE( QgsExifTools::readTag( path, QStringLiteral( "Exif.GPSInfo.GPSLatitudeRef" ) ).toString() == QStringLiteral( "N" ) );
+    REQUIRE( QgsExifTools::readTag( path, QStringLiteral( "Exif.GPSInfo.GPSLongitudeRef" ) ).toString() == QStringLiteral( "W" ) );
+    bool ok = false;
+    const QgsPoint geoTag = QgsExifTools::getGeoTag( path, ok );
+    REQUIRE( ok );
+    REQUIRE( geoTag.y() == Catch::Approx( 46.5 ).margin( 1e-6 ) );
+    REQUIRE( geoTag.x() == Catch::Approx( -7.25 ).margin( 1e-6 ) );
+    REQUIRE( geoTag.z() == Catch::Approx( -12.5 ).margin( 1e-3 ) );
+  }
+}
@@ -0,0 +1,194 @@
+/***************************************************************************
+                        test_projectbackupmanager.cpp
+                        --------------------
+  begin                : Oct 2026
+  copyright            : (C) 2026 by SIGPACGO contributors
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#define QFIELDTEST_MAIN
+#include "catch2.h"
+#include "projectbackupmanager.h"
+
+#include <QDirIterator>
+#include <QJsonArray>
+#include <QJsonDocument>
+#include <QJsonObject>
+#include <QSignalSpy>
+#include <QTemporaryDir>
+#include <qgsproject.h>
+#include <qgsvectorfilewriter.h>
+#include <qgsvectorlayer.h>
+
+namespace
+{
+  QByteArray readFile( const QString &path )
+  {
+    QFile file( path );
+    return file.open( QIODevice::ReadOnly ) ? file.readAll() : QByteArray();
+  }
+} // namespace
+
+TEST_CASE( "ProjectBackupManager" )
+{
+  QTemporaryDir dir;
+  REQUIRE( dir.isValid() );
+  REQUIRE( QDir( dir.path() ).mkpath( QStringLiteral( "project" ) ) );
+  REQUIRE( QDir( dir.path() ).mkpath( QStringLiteral( "shared" ) ) );
+
+  // A GeoPackage living outside of the project directory
+  const QString gpkgPath = dir.filePath( QStringLiteral( "shared/parcels.gpkg" ) );
+  QgsVectorLayer layer( QStringLiteral( "Point?crs=EPSG:4326&field=id:integer" ), QStringLiteral( "parcels" ), QStringLiteral( "memory" ) );
+  REQUIRE( layer.isValid() );
+  QgsVectorFileWriter::SaveVectorOptions options;
+  options.driverName = QStringLiteral( "GPKG" );
+  REQUIRE( QgsVectorFileWriter::writeAsVectorFormatV3( &layer, gpkgPath, QgsProject::instance()->transformContext(), options ) == QgsVectorFileWriter::NoError );
+  const QByteArray gpkgContent = readFile( gpkgPath );
+  REQUIRE( !gpkgContent.isEmpty() );
+
+  const QString projectPath = dir.filePath( QStringLiteral( "project/project.qgs" ) );
+  const QByteArray projectContent = QStringLiteral( "<qgis><maplayer><datasource source=\"%1\"/></maplayer></qgis>" ).arg( gpkgPath ).toUtf8();
+  {
+    QFile projectFile( projectPath );
+    REQUIRE( projectFile.open( QIODevice::WriteOnly ) );
+    projectFile.write( projectContent );
+  }
+
+  ProjectBackupManager manager;
+  manager.setBackupDirectory( dir.filePath( QStringLiteral( "backups" ) ) );
+
+  const QString chunksDirectory = dir.filePath( QStringLiteral( "backups/.chunks" ) );
+  QSignalSpy createdSpy( &manager, &ProjectBackupManager::backupCreated );
+  QSignalSpy errorSpy( &manager, &ProjectBackupManager::backupError );
+
+  SECTION( "Restore" )
+  {
+    REQUIRE( manager.createBackup( projectPath, ProjectBackupManager::ProjectAndGpkg ) );
+    REQUIRE( createdSpy.wait( 5000 ) );
+    const QString backupPath = createdSpy.first().first().toString();
+
+    // Out of tree files are stored under a relative path, their chunks in the shared store
+    QFile manifestFile( backupPath + QStringLiteral( "/manifest.json" ) );
+    REQUIRE( manifestFile.open( QIODevice::ReadOnly ) );
+    const QJsonArray entries = QJsonDocument::fromJson( manifestFile.readAll() ).object().value( QStringLiteral( "files" ) ).toArray();
+    QStringList paths;
+    for ( const QJsonValue &entry : entries )
+    {
+      paths << entry.toObject().value( QStringLiteral( "path" ) ).toString();
+      const QJsonArray chunks = entry.toObject().value( QStringLiteral( "chunks" ) ).toArray();
+      REQUIRE( !chunks.isEmpty() );
+      for ( const QJsonValue &hash : chunks )
+        REQUIRE( QFile::exists( ProjectBackupManager::chunkFilePath( chunksDirectory, hash.toString() ) ) );
+    }
+    REQUIRE( paths == QStringList( { QStringLiteral( "project.qgs" ), QStringLiteral( "data/parcels.gpkg" ) } ) );
+
+    // Restoring somewhere else leaves the live files alone
+    const QFileInfo liveInfo( gpkgPath );
+    const QString restorePath = dir.filePath( QStringLiteral( "restored" ) );
+    REQUIRE( manager.restoreBackup( backupPath, restorePath ) );
+
+    REQUIRE( readFile( restorePath + QStringLiteral( "/project.qgs" ) ) == projectContent );
+    REQUIRE( QFile::exists( restorePath + QStringLiteral( "/data/parcels.gpkg" ) ) );
+    REQUIRE( QFileInfo( gpkgPath ).lastModified() == liveInfo.lastModified() );
+    REQUIRE( readFile( gpkgPath ) == gpkgContent );
+
+    QgsVectorLayer restoredLayer( restorePath + QStringLiteral( "/data/parcels.gpkg" ), QStringLiteral( "parcels" ), QStringLiteral( "ogr" ) );
+    REQUIRE( restoredLayer.isValid() );
+  }
+
+  SECTION( "Deduplication" )
+  {
+    auto backupChunks = [&]( const QString &backupPath ) {
+      QFile manifestFile( backupPath + QStringLiteral( "/manifest.json" ) );
+      REQUIRE( manifestFile.open( QIODevice::ReadOnly ) );
+      QMap<QString, QJsonArray> chunks;
+      const QJsonArray entries = QJsonDocument::fromJson( manifestFile.readAll() ).object().value( QStringLiteral( "files" ) ).toArray();
+      for ( const QJsonValue &entry : entries )
+        chunks.insert( entry.toObject().value( QStringLiteral( "path" ) ).toString(), entry.toObject().value( QStringLiteral( "chunks" ) ).toArray() );
+      return chunks;
+    };
+    auto chunkCount = [&] {
+      int count = 0;
+      QDirIterator it( chunksDirectory, QDir::Files, QDirIterator::Subdirectories );
+      while ( it.hasNext() )
+      {
+        it.next();
+        count++;
+      }
+      return count;
+    };
+
+    REQUIRE( manager.createBackup( projectPath, ProjectBackupManager::ProjectAndGpkg ) );
+    REQUIRE( createdSpy.wait( 5000 ) );
+    const QMap<QString, QJsonArray> firstChunks = backupChunks( createdSpy.last().first().toString() );
+    const int firstChunkCount = chunkCount();
+    REQUIRE( firstChunkCount > 0 );
+
+    // A project file rewritten with the same content is read again, its chunks are shared all the same
+    {
+      QFile projectFile( projectPath );
+      REQUIRE( projectFile.open( QIODevice::ReadWrite ) );
+      REQUIRE( projectFile.setFileTime( QDateTime::currentDateTime().addSecs( 60 ), QFileDevice::FileModificationTime ) );
+    }
+    REQUIRE( manager.createBackup( projectPath, ProjectBackupManager::ProjectAndGpkg ) );
+    REQUIRE( createdSpy.wait( 5000 ) );
+    const QString secondBackupPath = createdSpy.last().first().toString();
+    REQUIRE( secondBackupPath != createdSpy.first().first().toString() );
+    REQUIRE( backupChunks( secondBackupPath ) == firstChunks );
+    REQUIRE( chunkCount() == firstChunkCount );
+
+    // Only the chunks of a changed file are stored anew
+    {
+      QFile projectFile( projectPath );
+      REQUIRE( projectFile.open( QIODevice::Append ) );
+      projectFile.write( "<!-- edited -->" );
+    }
+    REQUIRE( manager.createBackup( projectPath, ProjectBackupManager::ProjectAndGpkg ) );
+    REQUIRE( createdSpy.wait( 5000 ) );
+    const QMap<QString, QJsonArray> thirdChunks = backupChunks( createdSpy.last().first().toString() );
+    REQUIRE( thirdChunks.value( QStringLiteral( "data/parcels.gpkg" ) ) == firstChunks.value( QStringLiteral( "data/parcels.gpkg" ) ) );
+    REQUIRE( thirdChunks.value( QStringLiteral( "project.qgs" ) ) != firstChunks.value( QStringLiteral( "project.qgs" ) ) );
+    REQUIRE( chunkCount() == firstChunkCount + 1 );
+
+    // Deleting a backup keeps the chunks still referenced by the others
+    REQUIRE( manager.deleteBackup( secondBackupPath ) );
+    REQUIRE( chunkCount() == firstChunkCount + 1 );
+  }
+
+  SECTION( "Cancel" )
+  {
+    // A project file large enough for the backup to be canceled halfway
+    {
+      QFile projectFile( projectPath );
+      REQUIRE( projectFile.open( QIODevice::Append ) );
+      for ( int i = 0; i < 64; i++ )
+        projectFile.write( QByteArray( ProjectBackupManager::ChunkSize, static_cast<char>( 'a' + i % 26 ) ) + QByteArray::number( i ) );
+    }
+
+    QSignalSpy busySpy( &manager, &ProjectBackupManager::busyChanged );
+    REQUIRE( manager.createBackup( projectPath, ProjectBackupManager::ProjectAndGpkg ) );
+    REQUIRE( manager.isBusy() );
+    manager.cancelBackup();
+
+    REQUIRE( errorSpy.wait( 10000 ) );
+    REQUIRE( createdSpy.isEmpty() );
+    REQUIRE( !manager.isBusy() );
+    REQUIRE( busySpy.count() == 2 );
+
+    // Neither the backup nor the chunks it stored are left behind
+    REQUIRE( manager.listBackups( QStringLiteral( "project" ) ).isEmpty() );
+    REQUIRE( !QDirIterator( chunksDirectory, QDir::Files, QDirIterator::Subdirectories ).hasNext() );
+
+    // The next backup goes through
+    REQUIRE( manager.createBackup( projectPath, ProjectBackupManager::ProjectOnly ) );
+    REQUIRE( createdSpy.wait( 10000 ) );
+  }
+}
@@ -21,11 +21,36 @@
 
 #include <QAbstractItemModelTester>
 #include <QSignalSpy>
+#include <QTest>
 #include <qgsapplication.h>
+#include <qgsexpression.h>
+#include <qgsexpressionfunction.h>
 #include <qgsproject.h>
 #include <qgsrelationmanager.h>
 #include <qgsvectorlayer.h>
 
+#include <atomic>
+
+namespace
+{
+  std::atomic<int> sEvaluations( 0 );
+
+  //! Returns its argument, counting how many times it is evaluated
+  class CountingFunction : public QgsExpressionFunction
+  {
+    public:
+      CountingFunction()
+        : QgsExpressionFunction( QStringLiteral( "test_counted" ), 1, QStringLiteral( "Custom" ) )
+      {}
+
+      QVariant func( const QVariantList &values, const QgsExpressionContext *, QgsExpression *, const QgsExpressionNodeFunction * ) override
+      {
+        sEvaluations++;
+        return values.value( 0 );
+      }
+  };
+} // namespace
+
 TEST_CASE( "ReferencingFeatureListModel" )
 {
   /* TEST PROJECT
@@ -323,6 +348,60 @@ TEST_CASE( "ReferencingFeatureListModel" )
     REQUIRE( mModel->rowCount() == 4 );
   }
 
+  SECTION( "SharedQueries" )
+  {
+    if ( !QgsExpression::isFunctionName( QStringLiteral( "test_counted" ) ) )
+      QgsExpression::registerFunction( new CountingFunction() );
+    mL_Land->setDisplayExpression( QStringLiteral( "test_counted( name )" ) );
+    sEvaluations = 0;
+
+    // Models showing the same features share a single query
+    std::unique_ptr<ReferencingFeatureListModel> otherModel = std::make_unique<ReferencingFeatureListModel>();
+    mModel->setRelation( mR_Landhasoneking );
+    otherModel->setRelation( mR_Landhasoneking );
+    mModel->setFeature( mL_King->getFeature( 1 ) );
+    otherModel->setFeature( mL_King->getFeature( 1 ) );
+    REQUIRE( QTest::qWaitFor( [&] { return mModel->rowCount() == 3 && otherModel->rowCount() == 3; }, 2000 ) );
+    REQUIRE( otherModel->data( otherModel->index( 0, 0 ), ReferencingFeatureListModel::DisplayString ) == mModel->data( mModel->index( 0, 0 ), ReferencingFeatureListModel::DisplayString ) );
+    REQUIRE( sEvaluations == 3 );
+
+    // A model going away leaves the query shared with another model running
+    mL_Land->setDisplayExpression( QStringLiteral( "test_counted( name ) || ' (land)'" ) );
+    sEvaluations = 0;
+    std::unique_ptr<ReferencingFeatureListModel> droppedModel = std::make_unique<ReferencingFeatureListModel>();
+    QSignalSpy otherModelSpy( otherModel.get(), &ReferencingFeatureListModel::modelUpdated );
+    droppedModel->setRelation( mR_Landhasoneking );
+    droppedModel->setFeature( mL_King->getFeature( 1 ) );
+    otherModel->setRelation( mR_Landhasoneking );
+    droppedModel.reset();
+    REQUIRE( otherModelSpy.wait( 2000 ) );
+    REQUIRE( otherModel->rowCount() == 3 );
+    REQUIRE( otherModel->data( otherModel->index( 0, 0 ), ReferencingFeatureListModel::DisplayString ).toString().endsWith( QStringLiteral( " (land)" ) ) );
+    REQUIRE( sEvaluations == 3 );
+  }
+
+  SECTION( "CancelQueries" )
+  {
+    mModel->setRelation( mR_Landhasoneking );
+
+    // Only the last of successive queries is delivered
+    QSignalSpy spy( mModel.get(), &ReferencingFeatureListModel::modelUpdated );
+    mModel->setFeature( mL_King->getFeature( 2 ) );
+    REQUIRE( mModel->isLoading() );
+    mModel->setFeature( mL_King->getFeature( 1 ) );
+    REQUIRE( spy.wait( 2000 ) );
+    QTest::qWait( 100 );
+    REQUIRE( spy.count() == 1 );
+    REQUIRE( mModel->rowCount() == 3 );
+    REQUIRE( !mModel->isLoading() );
+
+    // Destroying a model with a pending query is safe
+    mModel->setFeature( mL_King->getFeature( 2 ) );
+    REQUIRE( mModel->isLoading() );
+    mModel.reset();
+    QTest::qWait( 100 );
+  }
+
   SECTION( "QAbstractItemModelTester" )
   {
     std::unique_ptr<ReferencingFeatureListModel> modelTest = std::make_unique<ReferencingFeatureListModel>();
@@ -0,0 +1,85 @@
+/***************************************************************************
+                        test_ringbuffer.cpp
+                        --------------------
+  begin                : Oct 2026
+  copyright            : (C) 2026 by SIGPACGO contributors
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#include "catch2.h"
+#include "ringbuffer.h"
+
+#include <QSet>
+#include <QString>
+
+#include <thread>
+#include <vector>
+
+TEST_CASE( "RingBuffer" )
+{
+  SECTION( "Bounded" )
+  {
+    RingBuffer<QString> buffer( 3 );
+    REQUIRE( buffer.capacity() == 4 );
+
+    for ( int i = 0; i < 4; ++i )
+      REQUIRE( buffer.push( QString::number( i ) ) );
+    REQUIRE( !buffer.push( QStringLiteral( "overflow" ) ) );
+
+    QString value;
+    REQUIRE( buffer.pop( value ) );
+    REQUIRE( value == QStringLiteral( "0" ) );
+    REQUIRE( buffer.push( QStringLiteral( "4" ) ) );
+
+    QStringList values;
+    while ( buffer.pop( value ) )
+      values << value;
+    REQUIRE( values == QStringList( { QStringLiteral( "1" ), QStringLiteral( "2" ), QStringLiteral( "3" ), QStringLiteral( "4" ) } ) );
+  }
+
+  SECTION( "ConcurrentProducers" )
+  {
+    constexpr int producerCount = 4;
+    constexpr int itemsPerProducer = 10000;
+    RingBuffer<int> buffer( 256 );
+
+    std::vector<std::thread> producers;
+    for ( int producer = 0; producer < producerCount; ++producer )
+    {
+      producers.emplace_back( [&buffer, producer] {
+        for ( int i = 0; i < itemsPerProducer; ++i )
+        {
+          while ( !buffer.push( producer * itemsPerProducer + i ) )
+            std::this_thread::yield();
+        }
+      } );
+    }
+
+    // Every item is received exactly once, in order for a given producer
+    QSet<int> received;
+    QVector<int> lastReceived( producerCount, -1 );
+    int value = 0;
+    while ( received.size() < producerCount * itemsPerProducer )
+    {
+      if ( !buffer.pop( value ) )
+        continue;
+
+      REQUIRE( !received.contains( value ) );
+      received.insert( value );
+      REQUIRE( value % itemsPerProducer > lastReceived[value / itemsPerProducer] );
+      lastReceived[value / itemsPerProducer] = value % itemsPerProducer;
+    }
+
+    for ( std::thread &producer : producers )
+      producer.join();
+    REQUIRE( !buffer.pop( value ) );
+  }
+}
@@ -0,0 +1,291 @@
+/***************************************************************************
+                        test_tilestore.cpp
+                        --------------------
+  begin                : Oct 2026
+  copyright            : (C) 2026 by SIGPACGO contributors
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#define QFIELDTEST_MAIN
+#include "catch2.h"
+#include "offlinepackdownloader.h"
+#include "tilestore.h"
+
+#include <QNetworkReply>
+#include <QSignalSpy>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QTemporaryDir>
+#include <QThread>
+#include <qgscoordinatereferencesystem.h>
+#include <qgsnetworkaccessmanager.h>
+#include <qgsproject.h>
+#include <qgsrasterlayer.h>
+#include <qgsvectortilelayer.h>
+
+/**
+ * A minimal HTTP stand-in answering every GET request with a small tile
+ * whose content is derived from the request path.
+ */
+class TileServer : public QTcpServer
+{
+  public:
+    TileServer()
+    {
+      connect( this, &QTcpServer::newConnection, this, [this] {
+        while ( QTcpSocket *socket = nextPendingConnection() )
+        {
+          connect( socket, &QTcpSocket::readyRead, socket, [this, socket] {
+            const QByteArray request = socket->readAll();
+            const QByteArray path = request.mid( 4, request.indexOf( ' ', 4 ) - 4 );
+            const QByteArray body = QByteArray( "tile:" ) + path;
+            mRequestCount++;
+            socket->write( QByteArray( "HTTP/1.1 200 OK\r\nContent-Type: image/png\r\nContent-Length: " ) + QByteArray::number( body.size() ) + "\r\nConnection: close\r\n\r\n" + body );
+            socket->disconnectFromHost();
+          } );
+          connect( socket, &QTcpSocket::disconnected, socket, &QObject::deleteLater );
+        }
+      } );
+      listen( QHostAddress::LocalHost );
+    }
+
+    QString baseUrl() const { return QStringLiteral( "http://127.0.0.1:%1/" ).arg( serverPort() ); }
+    int requestCount() const { return mRequestCount; }
+
+  private:
+    int mRequestCount = 0;
+};
+
+TEST_CASE( "TileStore" )
+{
+  QTemporaryDir dir;
+  REQUIRE( dir.isValid() );
+
+  SECTION( "InsertAndLookup" )
+  {
+    TileStore store( dir.filePath( QStringLiteral( "tiles.sqlite" ) ) );
+    REQUIRE( store.isValid() );
+
+    const QUrl url( QStringLiteral( "https://tile.openstreetmap.org/1/0/0.png" ) );
+    REQUIRE( !store.contains( url ) );
+    REQUIRE( store.insertTile( url, QByteArray( "png" ), QStringLiteral( "image/png" ) ) );
+    REQUIRE( store.size() == 3 );
+
+    QByteArray data;
+    QString contentType;
+    bool fresh = false;
+    REQUIRE( store.tile( url, data, contentType, &fresh ) );
+    REQUIRE( data == QByteArray( "png" ) );
+    REQUIRE( contentType == QStringLiteral( "image/png" ) );
+    REQUIRE( fresh );
+
+    // Replacing a tile accounts for its previous size
+    REQUIRE( store.insertTile( url, QByteArray( "png2" ), QStringLiteral( "image/png" ) ) );
+    REQUIRE( store.size() == 4 );
+  }
+
+  SECTION( "EvictionSparesPinnedTiles" )
+  {
+    TileStore store( dir.filePath( QStringLiteral( "tiles.sqlite" ) ), 100 );
+    const QByteArray data( 40, 'x' );
+    const QUrl pinned( QStringLiteral( "https://tile.openstreetmap.org/1/0/0.png" ) );
+    REQUIRE( store.insertTile( pinned, data, QString(), QStringLiteral( "pack" ) ) );
+    for ( int i = 0; i < 4; i++ )
+      REQUIRE( store.insertTile( QUrl( QStringLiteral( "https://tile.openstreetmap.org/2/%1/0.png" ).arg( i ) ), data, QString() ) );
+
+    REQUIRE( store.contains( pinned ) );
+    REQUIRE( store.size() <= 40 + 100 );
+    REQUIRE( store.packs() == QStringList() << QStringLiteral( "pack" ) );
+    REQUIRE( store.packTileCount( QStringLiteral( "pack" ) ) == 1 );
+
+    // Once the pack is removed, its tiles become evictable again
+    store.removePack( QStringLiteral( "pack" ) );
+    REQUIRE( store.packs().isEmpty() );
+    store.clear();
+    REQUIRE( !store.contains( pinned ) );
+    REQUIRE( store.size() == 0 );
+  }
+
+  SECTION( "Persistence" )
+  {
+    const QUrl url( QStringLiteral( "https://tile.openstreetmap.org/1/1/1.png" ) );
+    {
+      TileStore store( dir.filePath( QStringLiteral( "tiles.sqlite" ) ) );
+      REQUIRE( store.insertTile( url, QByteArray( "png" ), QStringLiteral( "image/png" ) ) );
+    }
+    TileStore store( dir.filePath( QStringLiteral( "tiles.sqlite" ) ) );
+    REQUIRE( store.contains( url ) );
+    REQUIRE( store.size() == 3 );
+  }
+
+  SECTION( "ConcurrentReads" )
+  {
+    TileStore store( dir.filePath( QStringLiteral( "tiles.sqlite" ) ) );
+    for ( int i = 0; i < 50; i++ )
+      REQUIRE( store.insertTile( QUrl( QStringLiteral( "https://tile.openstreetmap.org/8/%1/0.png" ).arg( i ) ), QByteArray::number( i ), QStringLiteral( "image/png" ) ) );
+
+    // Threads look tiles up through their own connection while tiles keep being written
+    std::atomic<int> found = 0;
+    QList<QThread *> threads;
+    for ( int t = 0; t < 4; t++ )
+    {
+      threads << QThread::create( [&store, &found] {
+        for ( int round = 0; round < 10; round++ )
+        {
+          for ( int i = 0; i < 50; i++ )
+          {
+            QByteArray data;
+            QString contentType;
+            if ( store.tile( QUrl( QStringLiteral( "https://tile.openstreetmap.org/8/%1/0.png" ).arg( i ) ), data, contentType ) && data == QByteArray::number( i ) )
+              found++;
+          }
+        }
+      } );
+      threads.last()->start();
+    }
+
+    for ( int i = 0; i < 50; i++ )
+      REQUIRE( store.insertTile( QUrl( QStringLiteral( "https://tile.openstreetmap.org/9/%1/0.png" ).arg( i ) ), QByteArray::number( i ), QStringLiteral( "image/png" ) ) );
+
+    for ( QThread *thread : std::as_const( threads ) )
+    {
+      REQUIRE( thread->wait( 30000 ) );
+      delete thread;
+    }
+    REQUIRE( found == 4 * 10 * 50 );
+    REQUIRE( store.contains( QUrl( QStringLiteral( "https://tile.openstreetmap.org/9/49/0.png" ) ) ) );
+  }
+
+  SECTION( "ReadThrough" )
+  {
+    TileServer server;
+    REQUIRE( server.isListening() );
+
+    QgsNetworkAccessManager *manager = QgsNetworkAccessManager::instance();
+
+    TileStore store( dir.filePath( QStringLiteral( "tiles.sqlite" ) ) );
+    store.addSource( server.baseUrl().mid( 7 ) );
+    store.install();
+
+    // Stored tiles are answered without reaching the server
+    const QUrl storedUrl( server.baseUrl() + QStringLiteral( "stored/0/0/0.png" ) );
+    REQUIRE( store.insertTile( storedUrl, QByteArray( "stored" ), QStringLiteral( "image/png" ) ) );
+    QNetworkReply *reply = manager->get( QNetworkRequest( storedUrl ) );
+    REQUIRE( QSignalSpy( reply, &QNetworkReply::finished ).wait( 5000 ) );
+    REQUIRE( reply->readAll() == QByteArray( "stored" ) );
+    REQUIRE( server.requestCount() == 0 );
+    reply->deleteLater();
+
+    // Fetched tiles are written back to the store
+    const QUrl fetchedUrl( server.baseUrl() + QStringLiteral( "fetched/0/0/0.png" ) );
+    reply = manager->get( QNetworkRequest( fetchedUrl ) );
+    REQUIRE( QSignalSpy( reply, &QNetworkReply::finished ).wait( 5000 ) );
+    REQUIRE( server.requestCount() == 1 );
+    REQUIRE( store.contains( fetchedUrl ) );
+    reply->deleteLater();
+
+    // Stale tiles are served as is while the network is unreachable
+    store.setMaximumAge( -1 );
+    store.setNetworkReachability( TileStore::NetworkReachability::Unreachable );
+    reply = manager->get( QNetworkRequest( storedUrl ) );
+    REQUIRE( QSignalSpy( reply, &QNetworkReply::finished ).wait( 5000 ) );
+    REQUIRE( reply->readAll() == QByteArray( "stored" ) );
+    REQUIRE( server.requestCount() == 1 );
+    reply->deleteLater();
+
+    // And refreshed once it is reachable
+    store.setNetworkReachability( TileStore::NetworkReachability::Reachable );
+    reply = manager->get( QNetworkRequest( storedUrl ) );
+    REQUIRE( QSignalSpy( reply, &QNetworkReply::finished ).wait( 5000 ) );
+    REQUIRE( reply->readAll() == QByteArray( "tile:/stored/0/0/0.png" ) );
+    REQUIRE( server.requestCount() == 2 );
+    reply->deleteLater();
+
+    store.uninstall();
+  }
+}
+
+TEST_CASE( "OfflinePackDownloader" )
+{
+  SECTION( "TileEnumeration" )
+  {
+    const QgsRectangle world( -180, -85, 180, 85 );
+    REQUIRE( OfflinePackDownloader::countTiles( world, 0, 2 ) == 1 + 4 + 16 );
+
+    const QList<QUrl> urls = OfflinePackDownloader::tileUrls( QStringLiteral( "https://example.com/{z}/{x}/{y}.png" ), QgsRectangle( 0.1, 0.1, 0.2, 0.2 ), 1, 1 );
+    REQUIRE( urls == QList<QUrl>() << QUrl( QStringLiteral( "https://example.com/1/1/0.png" ) ) );
+
+    const QList<QUrl> tmsUrls = OfflinePackDownloader::tileUrls( QStringLiteral( "https://example.com/{z}/{x}/{-y}.png" ), QgsRectangle( 0.1, 0.1, 0.2, 0.2 ), 1, 1 );
+    REQUIRE( tmsUrls == QList<QUrl>() << QUrl( QStringLiteral( "https://example.com/1/1/1.png" ) ) );
+  }
+
+  SECTION( "BulkDownloadPolicy" )
+  {
+    REQUIRE( OfflinePackDownloader::isBulkDownloadAllowed( QStringLiteral( "https://sigpac-hubcloud.es/mvt/recinto@3857@pbf/{z}/{x}/{y}.pbf" ) ) );
+    REQUIRE( OfflinePackDownloader::isBulkDownloadAllowed( QStringLiteral( "https://www.ign.es/wmts/pnoa-ma/{z}/{x}/{y}.jpeg" ) ) );
+    REQUIRE( !OfflinePackDownloader::isBulkDownloadAllowed( QStringLiteral( "https://tile.openstreetmap.org/{z}/{x}/{y}.png" ) ) );
+    REQUIRE( !OfflinePackDownloader::isBulkDownloadAllowed( QStringLiteral( "http://www.google.cn/maps/vt?lyrs=s@189&x={x}&y={y}&z={z}" ) ) );
+    REQUIRE( !OfflinePackDownloader::isBulkDownloadAllowed( QStringLiteral( "https://notign.es/{z}/{x}/{y}.png" ) ) );
+
+    // Layers whose provider forbids prefetching are left out of packs and reported
+    QgsProject project;
+    QgsRasterLayer *osmLayer = new QgsRasterLayer( QStringLiteral( "type=xyz&url=https://tile.openstreetmap.org/%7Bz%7D/%7Bx%7D/%7By%7D.png&zmax=19&zmin=0" ), QStringLiteral( "OpenStreetMap" ), QStringLiteral( "wms" ) );
+    QgsVectorTileLayer *sigpacLayer = new QgsVectorTileLayer( QStringLiteral( "type=xyz&url=https://sigpac-hubcloud.es/mvt/recinto@3857@pbf/%7Bz%7D/%7Bx%7D/%7By%7D.pbf&zmax=14&zmin=0" ), QStringLiteral( "Recintos" ) );
+    REQUIRE( osmLayer->isValid() );
+    REQUIRE( sigpacLayer->isValid() );
+    project.addMapLayers( QList<QgsMapLayer *>() << osmLayer << sigpacLayer );
+
+    OfflinePackDownloader downloader;
+    QSignalSpy skippedSpy( &downloader, &OfflinePackDownloader::skippedSourcesChanged );
+    downloader.setSourcesFromProject( &project );
+    REQUIRE( downloader.urlTemplates() == QStringList() << QStringLiteral( "https://sigpac-hubcloud.es/mvt/recinto@3857@pbf/{z}/{x}/{y}.pbf" ) );
+    REQUIRE( downloader.skippedSources() == QStringList() << QStringLiteral( "OpenStreetMap" ) );
+    REQUIRE( skippedSpy.count() == 1 );
+  }
+
+  SECTION( "Download" )
+  {
+    QTemporaryDir dir;
+    TileServer server;
+    REQUIRE( server.isListening() );
+
+    TileStore store( dir.filePath( QStringLiteral( "tiles.sqlite" ) ) );
+    OfflinePackDownloader downloader;
+    downloader.setTileStore( &store );
+    downloader.setName( QStringLiteral( "Finca" ) );
+    downloader.setUrlTemplates( QStringList() << server.baseUrl() + QStringLiteral( "{z}/{x}/{y}.png" ) );
+    downloader.setExtent( QgsRectangle( -4.0, 37.0, -3.9, 37.1 ), QgsCoordinateReferenceSystem( QStringLiteral( "EPSG:4326" ) ) );
+    downloader.setMinimumZoom( 0 );
+    downloader.setMaximumZoom( 12 );
+
+    const int tileCount = downloader.tileCount();
+    REQUIRE( tileCount > 0 );
+
+    QSignalSpy finishedSpy( &downloader, &OfflinePackDownloader::finished );
+    REQUIRE( downloader.start() );
+    REQUIRE( finishedSpy.wait( 30000 ) );
+    REQUIRE( finishedSpy.at( 0 ).at( 0 ).toBool() );
+    REQUIRE( downloader.completedCount() == tileCount );
+    REQUIRE( server.requestCount() == tileCount );
+    REQUIRE( store.packTileCount( QStringLiteral( "Finca" ) ) == tileCount );
+
+    QByteArray data;
+    QString contentType;
+    REQUIRE( store.tile( QUrl( server.baseUrl() + QStringLiteral( "0/0/0.png" ) ), data, contentType ) );
+    REQUIRE( data == QByteArray( "tile:/0/0/0.png" ) );
+
+    // A second download pins stored tiles without hitting the server again
+    downloader.setName( QStringLiteral( "Finca 2" ) );
+    REQUIRE( downloader.start() );
+    REQUIRE( finishedSpy.count() == 2 );
+    REQUIRE( server.requestCount() == tileCount );
+  }
+}
@@ -0,0 +1,217 @@
+/***************************************************************************
+                        test_tracker.cpp
+                        --------------------
+  begin                : Oct 2026
+  copyright            : (C) 2026 by SIGPACGO contributors
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#define QFIELDTEST_MAIN
+#include "catch2.h"
+#include "featuremodel.h"
+#include "geometry.h"
+#include "gnsssession.h"
+#include "qgsquickcoordinatetransformer.h"
+#include "rubberbandmodel.h"
+#include "tracker.h"
+#include "trackingmodel.h"
+
+#include <QFile>
+#include <QSignalSpy>
+#include <QStandardPaths>
+#include <QTemporaryDir>
+#include <QTest>
+#include <QThread>
+#include <QTimeZone>
+#include <qgsgeometry.h>
+#include <qgsvectorlayer.h>
+#include <qgsvectorlayerutils.h>
+
+using Catch::Approx;
+
+namespace
+{
+  QgsFeatureId addFeature( QgsVectorLayer *layer, const QString &wkt )
+  {
+    QgsFeature feature( layer->fields() );
+    feature.setGeometry( QgsGeometry::fromWkt( wkt ) );
+    layer->startEditing();
+    layer->addFeature( feature );
+    layer->commitChanges();
+
+    QgsFeature committedFeature;
+    layer->getFeatures().nextFeature( committedFeature );
+    return committedFeature.id();
+  }
+
+  GnssPositionInformation positionInformation( int index )
+  {
+    return GnssPositionInformation( 46.9, 7.4 + index * 1e-5, 540.0, 1.2, 90.0, QList<QgsSatelliteInfo>(), 1.1, 0.8, 0.9, 0.02, 0.03,
+                                    QDateTime( QDate( 2026, 10, 17 ), QTime( 8, 0 ), QTimeZone( QTimeZone::Initialization::UTC ) ).addSecs( index ),
+                                    QChar( 'A' ), 3, 4 );
+  }
+} // namespace
+
+TEST_CASE( "Tracker" )
+{
+  QStandardPaths::setTestModeEnabled( true );
+
+  SECTION( "RecoverLineVertices" )
+  {
+    QgsVectorLayer layer( QStringLiteral( "LineString?crs=EPSG:3857" ), QStringLiteral( "track" ), QStringLiteral( "memory" ) );
+    const QgsFeatureId fid = addFeature( &layer, QStringLiteral( "LineString (0 0, 1 1)" ) );
+
+    REQUIRE( Tracker::writeRecoveryVertex( &layer, fid, QgsPoint( 2, 2 ) ) );
+    REQUIRE( Tracker::writeRecoveryVertex( &layer, fid, QgsPoint( 3, 3 ) ) );
+    REQUIRE( QFile::exists( Tracker::recoveryFilePath( &layer ) ) );
+
+    REQUIRE( Tracker::recoverUnflushedVertices( &layer ) );
+    REQUIRE( layer.getFeature( fid ).geometry().asWkt() == QStringLiteral( "LineString (0 0, 1 1, 2 2, 3 3)" ) );
+    REQUIRE( !layer.isEditable() );
+
+    // The recovery file is consumed
+    REQUIRE( !QFile::exists( Tracker::recoveryFilePath( &layer ) ) );
+    REQUIRE( !Tracker::recoverUnflushedVertices( &layer ) );
+  }
+
+  SECTION( "RecoverPolygonVertices" )
+  {
+    QgsVectorLayer layer( QStringLiteral( "Polygon?crs=EPSG:3857" ), QStringLiteral( "track" ), QStringLiteral( "memory" ) );
+    const QgsFeatureId fid = addFeature( &layer, QStringLiteral( "Polygon ((0 0, 1 0, 1 1, 0 0))" ) );
+
+    REQUIRE( Tracker::writeRecoveryVertex( &layer, fid, QgsPoint( 0, 1 ) ) );
+    REQUIRE( Tracker::recoverUnflushedVertices( &layer ) );
+
+    // The ring stays closed
+    REQUIRE( layer.getFeature( fid ).geometry().asWkt() == QStringLiteral( "Polygon ((0 0, 1 0, 1 1, 0 1, 0 0))" ) );
+  }
+
+  SECTION( "TruncatedTail" )
+  {
+    QgsVectorLayer layer( QStringLiteral( "LineString?crs=EPSG:3857" ), QStringLiteral( "track" ), QStringLiteral( "memory" ) );
+    const QgsFeatureId fid = addFeature( &layer, QStringLiteral( "LineString (0 0, 1 1)" ) );
+
+    REQUIRE( Tracker::writeRecoveryVertex( &layer, fid, QgsPoint( 2, 2 ) ) );
+    REQUIRE( Tracker::writeRecoveryVertex( &layer, fid, QgsPoint( 3, 3 ) ) );
+
+    // The application was terminated while writing the last vertex
+    QFile file( Tracker::recoveryFilePath( &layer ) );
+    REQUIRE( file.resize( file.size() - 12 ) );
+
+    REQUIRE( Tracker::recoverUnflushedVertices( &layer ) );
+    REQUIRE( layer.getFeature( fid ).geometry().asWkt() == QStringLiteral( "LineString (0 0, 1 1, 2 2)" ) );
+    REQUIRE( !QFile::exists( Tracker::recoveryFilePath( &layer ) ) );
+  }
+
+  SECTION( "TruncatedHeader" )
+  {
+    QgsVectorLayer layer( QStringLiteral( "LineString?crs=EPSG:3857" ), QStringLiteral( "track" ), QStringLiteral( "memory" ) );
+    const QgsFeatureId fid = addFeature( &layer, QStringLiteral( "LineString (0 0, 1 1)" ) );
+
+    REQUIRE( Tracker::writeRecoveryVertex( &layer, fid, QgsPoint( 2, 2 ) ) );
+
+    // Not even a whole vertex made it to the file, the feature is left alone
+    QFile file( Tracker::recoveryFilePath( &layer ) );
+    REQUIRE( file.resize( sizeof( qint64 ) + 4 ) );
+
+    REQUIRE( !Tracker::recoverUnflushedVertices( &layer ) );
+    REQUIRE( layer.getFeature( fid ).geometry().asWkt() == QStringLiteral( "LineString (0 0, 1 1)" ) );
+    REQUIRE( !QFile::exists( Tracker::recoveryFilePath( &layer ) ) );
+  }
+
+  SECTION( "ReplaySessionSlices" )
+  {
+    const int positionCount = 200;
+    QTemporaryDir dir;
+    const QString path = dir.filePath( QStringLiteral( "session.gnss" ) );
+    {
+      GnssSessionWriter writer;
+      REQUIRE( writer.open( path ) );
+      for ( int i = 0; i < positionCount; ++i )
+        REQUIRE( writer.write( positionInformation( i ) ) );
+    }
+
+    const QgsCoordinateReferenceSystem crs = QgsCoordinateReferenceSystem::fromEpsgId( 4326 );
+    QgsVectorLayer layer( QStringLiteral( "LineString?crs=EPSG:4326" ), QStringLiteral( "track" ), QStringLiteral( "memory" ) );
+
+    RubberbandModel rubberbandModel;
+    rubberbandModel.setVectorLayer( &layer );
+    rubberbandModel.setCrs( crs );
+    rubberbandModel.setGeometryType( layer.geometryType() );
+
+    Geometry geometry;
+    geometry.setRubberbandModel( &rubberbandModel );
+    geometry.setVectorLayer( &layer );
+
+    FeatureModel featureModel;
+    featureModel.setCurrentLayer( &layer );
+    featureModel.setProperty( "geometry", QVariant::fromValue( &geometry ) );
+
+    TrackingModel trackingModel;
+    trackingModel.createTracker( &layer );
+    Tracker *tracker = trackingModel.trackerForLayer( &layer );
+    tracker->setRubberbandModel( &rubberbandModel );
+    tracker->setFeatureModel( &featureModel );
+
+    const QgsFeature feature = QgsVectorLayerUtils::createFeature( &layer );
+    tracker->setFeature( feature );
+    featureModel.setFeature( feature );
+
+    trackingModel.startTracker( &layer );
+    trackingModel.suspendUntilReplay();
+    REQUIRE( tracker->isSuspended() );
+
+    QgsQuickCoordinateTransformer coordinateTransformer;
+    coordinateTransformer.setDestinationCrs( crs );
+
+    // Slow every position down so that the session cannot be replayed within a single slice
+    QObject::connect( &rubberbandModel, &RubberbandModel::currentCoordinateChanged, &rubberbandModel, [] { QThread::msleep( 1 ); } );
+
+    QSignalSpy progressSpy( &trackingModel, &TrackingModel::replayProgressChanged );
+    QSignalSpy finishedSpy( &trackingModel, &TrackingModel::replayFinished );
+    trackingModel.replayPositionInformationSession( path, &coordinateTransformer );
+
+    // Nothing is replayed until the event loop runs
+    REQUIRE( tracker->isReplaying() );
+    REQUIRE( progressSpy.size() == 1 );
+    REQUIRE( progressSpy.at( 0 ).at( 0 ).toDouble() == 0.0 );
+    REQUIRE( rubberbandModel.vertexCount() == 1 );
+
+    REQUIRE( QTest::qWaitFor( [&finishedSpy] { return finishedSpy.size() == 1; }, 10000 ) );
+
+    // The start, at least two intermediate slices and the end
+    REQUIRE( progressSpy.size() >= 4 );
+    REQUIRE( progressSpy.last().at( 0 ).toDouble() == 1.0 );
+    for ( int i = 1; i < progressSpy.size(); ++i )
+    {
+      REQUIRE( progressSpy.at( i ).at( 0 ).toDouble() > progressSpy.at( i - 1 ).at( 0 ).toDouble() );
+    }
+
+    // The tracker picks up live positions again
+    REQUIRE( !tracker->isReplaying() );
+    REQUIRE( !tracker->isSuspended() );
+    REQUIRE( tracker->isActive() );
+
+    // The whole session is written once, at the end of the replay
+    REQUIRE( layer.featureCount() == 1 );
+    REQUIRE( tracker->feature().id() != FID_NULL );
+    const QgsGeometry track = layer.getFeature( tracker->feature().id() ).geometry();
+    REQUIRE( track.constGet()->nCoordinates() >= positionCount );
+    const GnssPositionInformation first = positionInformation( 0 );
+    const GnssPositionInformation last = positionInformation( positionCount - 1 );
+    REQUIRE( track.vertexAt( 0 ).x() == Approx( first.longitude() ) );
+    REQUIRE( track.vertexAt( 0 ).y() == Approx( first.latitude() ) );
+    REQUIRE( track.vertexAt( track.constGet()->nCoordinates() - 1 ).x() == Approx( last.longitude() ) );
+    REQUIRE( track.vertexAt( track.constGet()->nCoordinates() - 1 ).y() == Approx( last.latitude() ) );
+
+    trackingModel.stopTracker( &layer );
+  }
+}
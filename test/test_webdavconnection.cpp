@@ -0,0 +1,209 @@
+/***************************************************************************
+                        test_webdavconnection.cpp
+                        --------------------
+  begin                : Oct 2026
+  copyright            : (C) 2026 by SIGPACGO contributors
+***************************************************************************/
+
+/***************************************************************************
+ *                                                                         *
+ *   This program is free software; you can redistribute it and/or modify  *
+ *   it under the terms of the GNU General Public License as published by  *
+ *   the Free Software Foundation; either version 2 of the License, or     *
+ *   (at your option) any later version.                                   *
+ *                                                                         *
+ ***************************************************************************/
+
+#define QFIELDTEST_MAIN
+#include "catch2.h"
+#include "webdavconnection.h"
+
+#include <QCryptographicHash>
+#include <QJsonDocument>
+#include <QSignalSpy>
+#include <QTcpServer>
+#include <QTcpSocket>
+#include <QTemporaryDir>
+
+/**
+ * A minimal WebDAV stand-in serving a single file through PROPFIND and GET,
+ * honoring range requests and optionally interrupting the next download halfway.
+ */
+class WebdavServer : public QTcpServer
+{
+  public:
+    WebdavServer()
+      : mContent( 64 * 1024, 'p' )
+    {
+      connect( this, &QTcpServer::newConnection, this, [this] {
+        while ( QTcpSocket *socket = nextPendingConnection() )
+        {
+          connect( socket, &QTcpSocket::readyRead, socket, [this, socket] { processRequest( socket ); } );
+          connect( socket, &QTcpSocket::disconnected, socket, &QObject::deleteLater );
+        }
+      } );
+      listen( QHostAddress::LocalHost );
+    }
+
+    QString baseUrl() const { return QStringLiteral( "http://127.0.0.1:%1" ).arg( serverPort() ); }
+    QByteArray content() const { return mContent; }
+    int getCount() const { return mGetCount; }
+    QList<qint64> rangeStarts() const { return mRangeStarts; }
+    void interruptNextGet() { mInterruptNextGet = true; }
+
+  private:
+    void processRequest( QTcpSocket *socket )
+    {
+      QByteArray request = socket->property( "request" ).toByteArray() + socket->readAll();
+      const qsizetype headerEnd = request.indexOf( "\r\n\r\n" );
+      if ( headerEnd < 0 )
+      {
+        socket->setProperty( "request", request );
+        return;
+      }
+
+      const QList<QByteArray> lines = request.left( headerEnd ).split( '\n' );
+      QMap<QByteArray, QByteArray> headers;
+      for ( const QByteArray &line : lines.mid( 1 ) )
+        headers.insert( line.left( line.indexOf( ':' ) ).trimmed().toLower(), line.mid( line.indexOf( ':' ) + 1 ).trimmed() );
+
+      const qsizetype bodySize = headers.value( "content-length" ).toLongLong();
+      if ( request.size() < headerEnd + 4 + bodySize )
+      {
+        socket->setProperty( "request", request );
+        return;
+      }
+      socket->setProperty( "request", request.mid( headerEnd + 4 + bodySize ) );
+
+      const QList<QByteArray> requestLine = lines.first().trimmed().split( ' ' );
+      const QByteArray method = requestLine.value( 0 );
+      const QByteArray path = requestLine.value( 1 );
+      const QByteArray lastModified = "Sat, 17 Oct 2026 10:00:00 GMT";
+
+      if ( method == "PROPFIND" )
+      {
+        const QByteArray etag = QCryptographicHash::hash( mContent, QCryptographicHash::Md5 ).toHex();
+        const QString body = QStringLiteral( "<?xml version=\"1.0\" encoding=\"utf-8\"?>"
+                                             "<d:multistatus xmlns:d=\"DAV:\">"
+                                             "<d:response><d:href>/project/</d:href><d:propstat><d:prop>"
+                                             "<d:resourcetype><d:collection/></d:resourcetype>"
+                                             "<d:getlastmodified>%1</d:getlastmodified>"
+                                             "</d:prop><d:status>HTTP/1.1 200 OK</d:status></d:propstat></d:response>"
+                                             "<d:response><d:href>/project/photo.jpg</d:href><d:propstat><d:prop>"
+                                             "<d:resourcetype/><d:getcontenttype>image/jpeg</d:getcontenttype>"
+                                             "<d:getcontentlength>%2</d:getcontentlength>"
+                                             "<d:getlastmodified>%1</d:getlastmodified>"
+                                             "<d:getetag>\"%3\"</d:getetag>"
+                                             "</d:prop><d:status>HTTP/1.1 200 OK</d:status></d:propstat></d:response>"
+                                             "</d:multistatus>" )
+                               .arg( QString::fromLatin1( lastModified ) )
+                               .arg( mContent.size() )
+                               .arg( QString::fromLatin1( etag ) );
+        socket->write( "HTTP/1.1 207 Multi-Status\r\nContent-Type: application/xml; charset=utf-8\r\nContent-Length: " + QByteArray::number( body.toUtf8().size() ) + "\r\n\r\n" + body.toUtf8() );
+      }
+      else if ( method == "GET" && path == "/project/photo.jpg" )
+      {
+        mGetCount++;
+
+        qint64 from = 0;
+        const QByteArray range = headers.value( "range" );
+        if ( range.startsWith( "bytes=" ) )
+        {
+          from = range.mid( 6, range.indexOf( '-' ) - 6 ).toLongLong();
+          mRangeStarts << from;
+        }
+
+        const QByteArray body = mContent.mid( from );
+        QByteArray response = from > 0 ? QByteArray( "HTTP/1.1 206 Partial Content\r\nContent-Range: bytes " ) + QByteArray::number( from ) + "-" + QByteArray::number( mContent.size() - 1 ) + "/" + QByteArray::number( mContent.size() ) + "\r\n"
+                                        : QByteArray( "HTTP/1.1 200 OK\r\n" );
+        response += "Content-Type: image/jpeg\r\nLast-Modified: " + lastModified + "\r\nContent-Length: " + QByteArray::number( body.size() ) + "\r\n\r\n";
+
+        if ( mInterruptNextGet )
+        {
+          mInterruptNextGet = false;
+          socket->write( response + body.left( body.size() / 2 ) );
+          socket->flush();
+          socket->disconnectFromHost();
+          return;
+        }
+
+        socket->write( response + body );
+      }
+      else
+      {
+        socket->write( "HTTP/1.1 404 Not Found\r\nContent-Length: 0\r\n\r\n" );
+      }
+    }
+
+    QByteArray mContent;
+    int mGetCount = 0;
+    QList<qint64> mRangeStarts;
+    bool mInterruptNextGet = false;
+};
+
+static void download( WebdavConnection &connection, const QString &path )
+{
+  QSignalSpy spy( &connection, &WebdavConnection::isDownloadingPathChanged );
+  connection.downloadPath( path );
+  REQUIRE( connection.isDownloadingPath() );
+  connection.confirmRequest();
+  REQUIRE( spy.wait( 10000 ) );
+  REQUIRE( !connection.isDownloadingPath() );
+}
+
+TEST_CASE( "WebdavConnection" )
+{
+  WebdavServer server;
+  REQUIRE( server.isListening() );
+
+  QTemporaryDir dir;
+  REQUIRE( dir.isValid() );
+
+  QVariantMap configuration;
+  configuration[QStringLiteral( "url" )] = server.baseUrl();
+  configuration[QStringLiteral( "username" )] = QStringLiteral( "user" );
+  configuration[QStringLiteral( "remote_path" )] = QStringLiteral( "/project/" );
+  QFile configurationFile( dir.filePath( QStringLiteral( "qfield_webdav_configuration.json" ) ) );
+  REQUIRE( configurationFile.open( QFile::WriteOnly ) );
+  configurationFile.write( QJsonDocument::fromVariant( configuration ).toJson() );
+  configurationFile.close();
+
+  WebdavConnection connection;
+  connection.setPassword( QStringLiteral( "secret" ) );
+
+  const QString photoPath = dir.filePath( QStringLiteral( "photo.jpg" ) );
+  auto readPhoto = [&photoPath] {
+    QFile file( photoPath );
+    return file.open( QFile::ReadOnly ) ? file.readAll() : QByteArray();
+  };
+
+  SECTION( "SkipsUnchangedFiles" )
+  {
+    download( connection, dir.path() );
+    REQUIRE( server.getCount() == 1 );
+    REQUIRE( readPhoto() == server.content() );
+
+    // A touched file with the same content is recognized through its entity tag
+    QFile file( photoPath );
+    REQUIRE( file.open( QFile::Append ) );
+    file.setFileTime( QDateTime::currentDateTime(), QFileDevice::FileModificationTime );
+    file.close();
+
+    download( connection, dir.path() );
+    REQUIRE( server.getCount() == 1 );
+  }
+
+  SECTION( "ResumesInterruptedDownloads" )
+  {
+    server.interruptNextGet();
+    download( connection, dir.path() );
+    REQUIRE( !QFileInfo::exists( photoPath ) );
+
+    download( connection, dir.path() );
+    REQUIRE( server.getCount() == 2 );
+    REQUIRE( server.rangeStarts().size() == 1 );
+    REQUIRE( server.rangeStarts().first() > 0 );
+    REQUIRE( readPhoto() == server.content() );
+    REQUIRE( QDir( dir.path() ).entryList( { QStringLiteral( "*.part" ) }, QDir::Files ).isEmpty() );
+  }
+}